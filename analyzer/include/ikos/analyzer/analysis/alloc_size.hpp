@@ -0,0 +1,103 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Allocation sizes of the global memory locations
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <ikos/core/number/machine_int.hpp>
+
+#include <ikos/analyzer/analysis/context.hpp>
+#include <ikos/analyzer/analysis/memory_location.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Allocation sizes of the global memory locations
+///
+/// The allocation size of a global variable is the store size of its type,
+/// and the allocation size of a function is zero. These facts do not depend
+/// on the program point, so they are computed once per bundle and shared by
+/// the execution engine and the checkers, instead of being asserted into the
+/// invariants.
+class GlobalAllocSizes {
+private:
+  /// \brief Analysis context
+  Context& _ctx;
+
+  /// \brief Allocation size of the global variables and functions
+  llvm::DenseMap< MemoryLocation*, core::MachineInt > _sizes;
+
+public:
+  /// \brief Constructor
+  explicit GlobalAllocSizes(Context& ctx);
+
+  /// \brief Deleted copy constructor
+  GlobalAllocSizes(const GlobalAllocSizes&) = delete;
+
+  /// \brief Deleted move constructor
+  GlobalAllocSizes(GlobalAllocSizes&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  GlobalAllocSizes& operator=(const GlobalAllocSizes&) = delete;
+
+  /// \brief Deleted move assignment operator
+  GlobalAllocSizes& operator=(GlobalAllocSizes&&) = delete;
+
+  /// \brief Destructor
+  ~GlobalAllocSizes();
+
+  /// \brief Compute the allocation sizes of the whole bundle
+  void run();
+
+  /// \brief Return the allocation size of the given memory location, or null
+  /// if it is not a global variable or a function
+  const core::MachineInt* get(MemoryLocation* addr) const {
+    auto it = this->_sizes.find(addr);
+    return it != this->_sizes.end() ? &it->second : nullptr;
+  }
+
+}; // end class GlobalAllocSizes
+
+} // end namespace analyzer
+} // end namespace ikos
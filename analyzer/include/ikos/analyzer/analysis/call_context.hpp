@@ -43,19 +43,39 @@
 
 #pragma once
 
-#include <memory>
+#include <atomic>
+#include <cstdint>
+#include <deque>
 
 #include <llvm/ADT/DenseMap.h>
 
 #include <ikos/ar/semantic/statement.hpp>
 
 #include <ikos/analyzer/support/assert.hpp>
+#include <ikos/analyzer/util/concurrency.hpp>
 
 namespace ikos {
 namespace analyzer {
 
 /// \brief Represents a calling context
+///
+/// Call contexts form a trie: each call context points to its parent context
+/// and to the last call statement. They are owned by the CallContextFactory.
 class CallContext {
+public:
+  /// \brief Identifier of a call context, unique within its factory
+  ///
+  /// The empty call context has the identifier 0.
+  using Id = uint32_t;
+
+  /// \brief Tag of the constructors, only created by the CallContextFactory
+  class PrivateCtor {
+  private:
+    PrivateCtor() {}
+
+    friend class CallContextFactory;
+  };
+
 private:
   /// \brief Parent call context
   CallContext* _parent = nullptr;
@@ -63,17 +83,22 @@ private:
   /// \brief Call statement
   ar::CallBase* _call = nullptr;
 
-private:
+  /// \brief Identifier
+  Id _id = 0;
+
+  /// \brief Number of call statements
+  uint32_t _depth = 0;
+
+public:
   /// \brief Create an empty call context
-  CallContext() = default;
+  explicit CallContext(PrivateCtor) {}
 
   /// \brief Create a call context
-  CallContext(CallContext* parent, ar::CallBase* call)
-      : _parent(parent), _call(call) {
+  CallContext(CallContext* parent, ar::CallBase* call, Id id, PrivateCtor)
+      : _parent(parent), _call(call), _id(id), _depth(parent->_depth + 1) {
     ikos_assert(this->_parent != nullptr && this->_call != nullptr);
   }
 
-public:
   /// \brief Deleted copy constructor
   CallContext(const CallContext&) = delete;
 
@@ -107,19 +132,39 @@ public:
     return this->_call;
   }
 
-private:
-  friend class CallContextFactory;
+  /// \brief Return the identifier of the calling context
+  Id id() const { return this->_id; }
+
+  /// \brief Return the number of call statements in the calling context
+  std::size_t depth() const { return this->_depth; }
 
 }; // end class CallContext
 
 /// \brief Management of calling contexts
+///
+/// The call contexts are allocated in arenas and never freed before the
+/// factory. Their identifiers are allocated sequentially.
 class CallContextFactory {
 private:
-  llvm::DenseMap< std::pair< CallContext*, ar::CallBase* >,
-                  std::unique_ptr< CallContext > >
-      _map;
+  /// \brief Call contexts of a shard
+  struct Trie {
+    /// \brief Map from (parent context, call statement) to child context
+    llvm::DenseMap< std::pair< CallContext*, ar::CallBase* >, CallContext* >
+        children;
+
+    /// \brief Arena of the call contexts, never moved
+    std::deque< CallContext > arena;
+  };
+
+private:
+  /// \brief Call contexts, sharded by (parent context, call statement)
+  ShardedMap< Trie > _tries;
+
+  /// \brief Empty call context
+  CallContext _empty_call_context;
 
-  std::unique_ptr< CallContext > _empty_call_context;
+  /// \brief Next identifier
+  std::atomic< CallContext::Id > _next_id;
 
 public:
   /// \brief Constructor
@@ -141,7 +186,7 @@ public:
   ~CallContextFactory();
 
   /// \brief Get the empty call context
-  CallContext* get_empty() { return this->_empty_call_context.get(); }
+  CallContext* get_empty() { return &this->_empty_call_context; }
 
   /// \brief Get or Create the call context with the given parameters
   ///
@@ -149,6 +194,22 @@ public:
   /// \param call Call statement
   CallContext* get_context(CallContext* parent, ar::CallBase* call);
 
+  /// \brief Get or Create the call context with the given parameters, keeping
+  /// only the last `depth` call statements
+  ///
+  /// \param parent Parent call context
+  /// \param call Call statement
+  /// \param depth Maximum number of call statements
+  CallContext* get_context(CallContext* parent,
+                           ar::CallBase* call,
+                           std::size_t depth);
+
+  /// \brief Return the number of call contexts created so far, including the
+  /// empty call context
+  ///
+  /// The identifiers are smaller than this number.
+  std::size_t size() const { return this->_next_id; }
+
 }; // end class CallContextFactory
 
 } // end namespace analyzer
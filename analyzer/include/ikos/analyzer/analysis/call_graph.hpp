@@ -0,0 +1,144 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Call graph and strongly connected components
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <ikos/ar/semantic/function.hpp>
+
+#include <ikos/analyzer/analysis/context.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Call graph of the defined functions of a bundle, with its strongly
+/// connected components
+///
+/// Indirect calls are resolved to all the functions whose address is taken
+/// and whose type matches the call. This is an over-approximation of the
+/// callees resolved by the value analyses, whatever pointer information they
+/// use.
+class CallGraph {
+private:
+  /// \brief Analysis context
+  Context& _ctx;
+
+  /// \brief Map from a function to its callees
+  llvm::DenseMap< ar::Function*, std::vector< ar::Function* > > _callees;
+
+  /// \brief Map from a function to the index of its strongly connected
+  /// component
+  llvm::DenseMap< ar::Function*, unsigned > _scc;
+
+  /// \brief True if the strongly connected component of the given index is
+  /// recursive
+  std::vector< bool > _recursive;
+
+  /// \brief Defined functions, callees first
+  std::vector< ar::Function* > _bottom_up;
+
+public:
+  /// \brief Constructor
+  explicit CallGraph(Context& ctx);
+
+  /// \brief Deleted copy constructor
+  CallGraph(const CallGraph&) = delete;
+
+  /// \brief Deleted move constructor
+  CallGraph(CallGraph&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  CallGraph& operator=(const CallGraph&) = delete;
+
+  /// \brief Deleted move assignment operator
+  CallGraph& operator=(CallGraph&&) = delete;
+
+  /// \brief Destructor
+  ~CallGraph();
+
+  /// \brief Compute the call graph and its strongly connected components
+  void run();
+
+  /// \brief Return the callees of the given function
+  const std::vector< ar::Function* >& callees(ar::Function* fun) const;
+
+  /// \brief Return true if the given functions are in the same strongly
+  /// connected component
+  ///
+  /// A function can only be called while another one is being analyzed, if
+  /// they are in the same strongly connected component.
+  bool same_scc(ar::Function* f, ar::Function* g) const {
+    return this->scc(f) == this->scc(g);
+  }
+
+  /// \brief Return true if the given function is part of a cycle of calls
+  bool is_recursive(ar::Function* fun) const {
+    return this->_recursive[this->scc(fun)];
+  }
+
+  /// \brief Return the functions reachable from the given function, including
+  /// itself
+  std::vector< ar::Function* > reachable(ar::Function* fun) const;
+
+  /// \brief Return the number of strongly connected components
+  std::size_t num_sccs() const { return this->_recursive.size(); }
+
+  /// \brief Return the defined functions, callees first
+  ///
+  /// The strongly connected components are in reverse topological order.
+  const std::vector< ar::Function* >& bottom_up_order() const {
+    return this->_bottom_up;
+  }
+
+private:
+  /// \brief Return the index of the strongly connected component of the given
+  /// function
+  unsigned scc(ar::Function* fun) const;
+
+}; // end class CallGraph
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Checkpoints of the interprocedural analysis
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <fstream>
+#include <set>
+#include <string>
+#include <utility>
+
+#include <ikos/ar/semantic/function.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+class OutputDatabase;
+
+/// \brief Checkpoints of the interprocedural analysis
+///
+/// Once the checks of an entry point are written, the output database is
+/// committed and a line `entry-point <domain> <next check id> <name>`
+/// (tab-separated) is appended to the checkpoint file. Each run starts with a
+/// line `run`.
+///
+/// When resuming, the entry points listed in the file are skipped and the new
+/// lines are appended. The checks with an id greater or equal to the last
+/// recorded one belong to an interrupted entry point: the ikos driver removes
+/// them before merging the databases of the successive runs.
+class Checkpoint {
+private:
+  /// \brief Checkpoint file
+  std::ofstream _out;
+
+  /// \brief Analyzed entry points, as (domain, name)
+  std::set< std::pair< std::string, std::string > > _done;
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param path Path of the checkpoint file
+  /// \param resume If true, read the analyzed entry points from the file and
+  /// append to it, otherwise truncate it
+  Checkpoint(const std::string& path, bool resume);
+
+  /// \brief Deleted copy constructor
+  Checkpoint(const Checkpoint&) = delete;
+
+  /// \brief Deleted move constructor
+  Checkpoint(Checkpoint&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  Checkpoint& operator=(const Checkpoint&) = delete;
+
+  /// \brief Deleted move assignment operator
+  Checkpoint& operator=(Checkpoint&&) = delete;
+
+  /// \brief Destructor
+  ~Checkpoint() = default;
+
+  /// \brief Return true if the checkpoint file was successfully opened
+  bool is_open() const { return this->_out.is_open(); }
+
+  /// \brief Return true if the entry point was analyzed in a previous run,
+  /// with the current domain of the checks table
+  bool done(const OutputDatabase& output_db, ar::Function* entry_point) const;
+
+  /// \brief Commit the output database and record the entry point as analyzed
+  void save(OutputDatabase& output_db, ar::Function* entry_point);
+
+}; // end class Checkpoint
+
+} // end namespace analyzer
+} // end namespace ikos
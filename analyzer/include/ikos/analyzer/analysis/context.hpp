@@ -58,10 +58,25 @@ class MemoryFactory;
 class VariableFactory;
 class LiteralFactory;
 class CallContextFactory;
+class WtoCache;
 class LivenessAnalysis;
+class SparseScalarAnalysis;
+class CallGraph;
+class ModRefAnalysis;
+class ExceptionAnalysis;
+class GlobalAllocSizes;
 class FunctionPointerAnalysis;
 class PointerAnalysis;
+class ContextSensitivePointerAnalysis;
 class FixpointProfileAnalysis;
+class FixpointTraceWriter;
+class BudgetDowngrades;
+class FunctionProfiler;
+class MemoryBudget;
+class ProgressReporter;
+class ResultCache;
+class Checkpoint;
+class FunctionQueue;
 
 /// \brief Global analysis context
 ///
@@ -92,18 +107,63 @@ public:
   /// \brief Call context factory
   CallContextFactory* call_context_factory;
 
+  /// \brief Cache of weak topological orders
+  WtoCache* wto_cache;
+
   /// \brief Liveness analysis
   LivenessAnalysis* liveness;
 
+  /// \brief Sparse scalar analysis, or null
+  SparseScalarAnalysis* sparse_scalars;
+
+  /// \brief Call graph, or null
+  CallGraph* call_graph;
+
+  /// \brief Mod/ref analysis, or null
+  ModRefAnalysis* mod_ref;
+
+  /// \brief Exception analysis, or null
+  ExceptionAnalysis* exception;
+
+  /// \brief Allocation sizes of the global memory locations, or null
+  GlobalAllocSizes* global_alloc_sizes;
+
   /// \brief Function pointer analysis
   FunctionPointerAnalysis* function_pointer;
 
   /// \brief Pointer analysis
   PointerAnalysis* pointer;
 
+  /// \brief Context-sensitive pointer analysis
+  ContextSensitivePointerAnalysis* context_pointer;
+
   /// \brief Fixpoint Profile Analysis;
   FixpointProfileAnalysis* fixpoint_profiler;
 
+  /// \brief Profiler of the fixpoint computations on functions, or null
+  FunctionProfiler* function_profiler;
+
+  /// \brief Live progress reporter, or null
+  ProgressReporter* progress;
+
+  /// \brief Writer of the fixpoint trace, or null
+  FixpointTraceWriter* fixpoint_trace;
+
+  /// \brief Memory budget of the analysis, or null
+  MemoryBudget* memory_budget;
+
+  /// \brief Callees that exceeded their budget, or null
+  BudgetDowngrades* budget_downgrades;
+
+  /// \brief Persistent cache of analysis results
+  ResultCache* result_cache;
+
+  /// \brief Checkpoints of the analyzed entry points, or null
+  Checkpoint* checkpoint;
+
+  /// \brief Queue of the functions shared with other processes, or null
+  FunctionQueue* function_queue;
+
 public:
   /// \brief Constructor
   Context(ar::Bundle* bundle_,
@@ -113,7 +173,8 @@ public:
           MemoryFactory& mem_factory_,
           VariableFactory& var_factory_,
           LiteralFactory& lit_factory_,
-          CallContextFactory& call_context_factory_)
+          CallContextFactory& call_context_factory_,
+          WtoCache& wto_cache_)
       : bundle(bundle_),
         opts(std::move(opts_)),
         wd(std::move(wd_)),
@@ -122,10 +183,25 @@ public:
         var_factory(&var_factory_),
         lit_factory(&lit_factory_),
         call_context_factory(&call_context_factory_),
+        wto_cache(&wto_cache_),
         liveness(nullptr),
+        sparse_scalars(nullptr),
+        call_graph(nullptr),
+        mod_ref(nullptr),
+        exception(nullptr),
+        global_alloc_sizes(nullptr),
         function_pointer(nullptr),
         pointer(nullptr),
-        fixpoint_profiler(nullptr) {}
+        context_pointer(nullptr),
+        fixpoint_profiler(nullptr),
+        function_profiler(nullptr),
+        progress(nullptr),
+        fixpoint_trace(nullptr),
+        memory_budget(nullptr),
+        budget_downgrades(nullptr),
+        result_cache(nullptr),
+        checkpoint(nullptr),
+        function_queue(nullptr) {}
 
   /// \brief Deleted copy constructor
   Context(const Context&) = delete;
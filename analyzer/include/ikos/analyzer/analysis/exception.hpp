@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Whole-program exception analysis
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <ikos/analyzer/analysis/context.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Whole-program exception analysis
+///
+/// Checks whether an exception can be caught anywhere in the program.
+///
+/// Exceptions only come back to the normal execution flow through the
+/// exception edge of an invoke statement. A program without any invoke
+/// statement (e.g, C code, or C++ code compiled with -fno-exceptions) cannot
+/// catch exceptions, so the exception states of the value analysis can be
+/// discarded: thrown exceptions end the execution.
+class ExceptionAnalysis {
+private:
+  /// \brief Analysis context
+  Context& _ctx;
+
+  /// \brief True if an exception can be caught, conservative until run()
+  bool _can_catch = true;
+
+public:
+  /// \brief Constructor
+  explicit ExceptionAnalysis(Context& ctx);
+
+  /// \brief Deleted copy constructor
+  ExceptionAnalysis(const ExceptionAnalysis&) = delete;
+
+  /// \brief Deleted move constructor
+  ExceptionAnalysis(ExceptionAnalysis&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  ExceptionAnalysis& operator=(const ExceptionAnalysis&) = delete;
+
+  /// \brief Deleted move assignment operator
+  ExceptionAnalysis& operator=(ExceptionAnalysis&&) = delete;
+
+  /// \brief Destructor
+  ~ExceptionAnalysis();
+
+  /// \brief Look for exception handlers in the whole program
+  void run();
+
+  /// \brief Return true if the program cannot catch any exception
+  bool exception_free() const { return !this->_can_catch; }
+
+}; // end class ExceptionAnalysis
+
+} // end namespace analyzer
+} // end namespace ikos
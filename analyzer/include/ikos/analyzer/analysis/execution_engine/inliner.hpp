@@ -46,24 +46,309 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <string>
 
 #include <boost/container/flat_map.hpp>
+#include <boost/optional.hpp>
 
 #include <llvm/ADT/DenseMap.h>
 
 #include <ikos/ar/semantic/function.hpp>
 #include <ikos/ar/verify/type.hpp>
 
+#include <ikos/analyzer/analysis/call_context.hpp>
 #include <ikos/analyzer/analysis/execution_engine/engine.hpp>
 #include <ikos/analyzer/analysis/execution_engine/numerical.hpp>
+#include <ikos/analyzer/analysis/function_budget.hpp>
 #include <ikos/analyzer/analysis/pointer/value.hpp>
 #include <ikos/analyzer/util/demangle.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
 #include <ikos/analyzer/util/log.hpp>
 
 namespace ikos {
 namespace analyzer {
 
+/// \brief Cache of callee summaries for the inliner
+///
+/// Map a pair (call context, callee) to the last entry invariant used to
+/// analyze the callee and the resulting exit invariant.
+///
+/// Whenever a function is inlined again in the same call context with an entry
+/// invariant smaller or equal to the cached one, the cached exit invariant can
+/// be used as a sound approximation instead of running the fixpoint again.
+///
+/// Note that the call context is part of the key because the exit invariant
+/// refers to memory locations created in that context (e.g, dynamic
+/// allocations).
+///
+/// It also keeps the entry invariants of the callees in merged call contexts,
+/// shared by several call paths (see -context-depth and -context-merge), and
+/// the invariants at the cycle heads of the last fixpoint on each callee (see
+/// -warm-start-cycles), and the summaries of the context-independent callees
+/// (see ModRefAnalysis::is_context_independent()).
+///
+/// The cache is cleared before each entry point and global destructor, since
+/// most of its keys are call contexts of the previous one.
+template < typename AbstractDomain >
+class CalleeSummaryCache {
+public:
+  /// \brief Summary of a callee
+  struct Summary {
+    /// \brief Entry invariant
+    AbstractDomain entry;
+
+    /// \brief Exit invariant
+    AbstractDomain exit;
+
+    /// \brief Return statement, or null
+    ar::ReturnValue* return_stmt;
+  };
+
+  /// \brief Invariants at the cycle heads of a fixpoint on a callee
+  struct CycleSeeds {
+    /// \brief Entry invariant of the fixpoint
+    AbstractDomain entry;
+
+    /// \brief Map from cycle head to invariant
+    llvm::DenseMap< ar::BasicBlock*, AbstractDomain > heads;
+  };
+
+  /// \brief Summary of a context-independent callee, valid for all its calls
+  struct IndependentSummary {
+    /// \brief Exit invariant
+    AbstractDomain exit;
+
+    /// \brief Return statement, or null
+    ar::ReturnValue* return_stmt;
+
+    /// \brief True if the callee was checked
+    bool checked;
+  };
+
+  /// \brief Number of joins of the entry invariants of a callee in a merged
+  /// call context before using a widening
+  static constexpr unsigned MergeWideningDelay = 2;
+
+private:
+  /// \brief Map from (call context, callee) to summary
+  using SummaryMap =
+      llvm::DenseMap< std::pair< CallContext*, ar::Function* >, Summary >;
+
+  /// \brief Entry invariants of a callee in a merged call context
+  struct MergedEntry {
+    /// \brief Join of the entry invariants so far
+    AbstractDomain entry;
+
+    /// \brief Number of joins so far
+    unsigned joins;
+
+    /// \brief Entry invariant used to check the callee, if any
+    boost::optional< AbstractDomain > checked;
+  };
+
+  /// \brief Map from (call context, callee) to merged entry invariants
+  using MergedEntryMap =
+      llvm::DenseMap< std::pair< CallContext*, ar::Function* >, MergedEntry >;
+
+private:
+  /// \brief Summaries
+  SummaryMap _map;
+
+  /// \brief Merged entry invariants
+  MergedEntryMap _merged;
+
+  /// \brief Map from callee to the invariants at its cycle heads
+  llvm::DenseMap< ar::Function*, std::shared_ptr< const CycleSeeds > > _seeds;
+
+  /// \brief Map from context-independent callee to summary
+  llvm::DenseMap< ar::Function*, IndependentSummary > _independent;
+
+  /// \brief Number of cache hits
+  std::size_t _hits = 0;
+
+  /// \brief Number of cache misses
+  std::size_t _misses = 0;
+
+  /// \brief Largest number of entries before a call to clear()
+  std::size_t _peak_size = 0;
+
+public:
+  /// \brief Constructor
+  CalleeSummaryCache() = default;
+
+  /// \brief Deleted copy constructor
+  CalleeSummaryCache(const CalleeSummaryCache&) = delete;
+
+  /// \brief Deleted move constructor
+  CalleeSummaryCache(CalleeSummaryCache&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  CalleeSummaryCache& operator=(const CalleeSummaryCache&) = delete;
+
+  /// \brief Deleted move assignment operator
+  CalleeSummaryCache& operator=(CalleeSummaryCache&&) = delete;
+
+  /// \brief Destructor
+  ~CalleeSummaryCache() = default;
+
+  /// \brief Return the summary of the given callee if the given entry
+  /// invariant is smaller or equal to the cached one, or null
+  ///
+  /// The returned pointer is invalidated by the next call to insert().
+  const Summary* find(CallContext* context,
+                      ar::Function* callee,
+                      const AbstractDomain& entry) {
+    auto it = this->_map.find({context, callee});
+    if (it != this->_map.end() && entry.leq(it->second.entry)) {
+      this->_hits++;
+      return &it->second;
+    }
+    this->_misses++;
+    return nullptr;
+  }
+
+  /// \brief Insert or replace the summary of the given callee
+  void insert(CallContext* context,
+              ar::Function* callee,
+              AbstractDomain entry,
+              AbstractDomain exit,
+              ar::ReturnValue* return_stmt) {
+    this->_map.erase({context, callee});
+    this->_map.try_emplace({context, callee},
+                           Summary{std::move(entry),
+                                   std::move(exit),
+                                   return_stmt});
+  }
+
+  /// \brief Merge the given entry invariant of a callee in a merged call
+  /// context, and return the merged entry invariant
+  ///
+  /// The merged entry invariant is the join of all the entry invariants given
+  /// so far, widened after MergeWideningDelay joins.
+  AbstractDomain merge(CallContext* context,
+                       ar::Function* callee,
+                       const AbstractDomain& entry) {
+    auto res = this->_merged.try_emplace({context, callee},
+                                         MergedEntry{entry, 0, boost::none});
+    MergedEntry& merged = res.first->second;
+    if (!res.second && !entry.leq(merged.entry)) {
+      if (merged.joins < MergeWideningDelay) {
+        merged.entry.join_with(entry);
+      } else {
+        merged.entry.widen_with(entry);
+      }
+      merged.joins++;
+    }
+    return merged.entry;
+  }
+
+  /// \brief Return true if the callee was checked in the given merged call
+  /// context with an entry invariant greater or equal to the given one
+  bool is_checked(CallContext* context,
+                  ar::Function* callee,
+                  const AbstractDomain& entry) const {
+    auto it = this->_merged.find({context, callee});
+    return it != this->_merged.end() && it->second.checked &&
+           entry.leq(*it->second.checked);
+  }
+
+  /// \brief Mark that the callee is checked in the given merged call context
+  /// with the given entry invariant, returned by merge()
+  void mark_checked(CallContext* context,
+                    ar::Function* callee,
+                    const AbstractDomain& entry) {
+    auto it = this->_merged.find({context, callee});
+    ikos_assert(it != this->_merged.end());
+    it->second.checked = entry;
+  }
+
+  /// \brief Return the invariants at the cycle heads of the last fixpoint on
+  /// the given callee, if its entry invariant is comparable with the given
+  /// one, or null
+  std::shared_ptr< const CycleSeeds > find_cycle_seeds(
+      ar::Function* callee, const AbstractDomain& entry) const {
+    auto it = this->_seeds.find(callee);
+    if (it != this->_seeds.end() && (entry.leq(it->second->entry) ||
+                                     it->second->entry.leq(entry))) {
+      return it->second;
+    }
+    return nullptr;
+  }
+
+  /// \brief Insert or replace the invariants at the cycle heads of the given
+  /// callee
+  void insert_cycle_seeds(ar::Function* callee,
+                          std::shared_ptr< const CycleSeeds > seeds) {
+    this->_seeds[callee] = std::move(seeds);
+  }
+
+  /// \brief Return the summary of the given context-independent callee, or
+  /// null
+  ///
+  /// The returned pointer is invalidated by the next call to
+  /// insert_independent().
+  const IndependentSummary* find_independent(ar::Function* callee) const {
+    auto it = this->_independent.find(callee);
+    if (it != this->_independent.end()) {
+      return &it->second;
+    }
+    return nullptr;
+  }
+
+  /// \brief Insert or replace the summary of the given context-independent
+  /// callee
+  void insert_independent(ar::Function* callee,
+                          AbstractDomain exit,
+                          ar::ReturnValue* return_stmt,
+                          bool checked) {
+    this->_independent.erase(callee);
+    this->_independent.try_emplace(callee,
+                                   IndependentSummary{std::move(exit),
+                                                      return_stmt,
+                                                      checked});
+  }
+
+  /// \brief Remove all summaries
+  ///
+  /// The hit and miss counters and the peak size are kept.
+  void clear() {
+    this->_peak_size = this->peak_size();
+    this->_map.clear();
+    this->_merged.clear();
+    this->_seeds.clear();
+    this->_independent.clear();
+  }
+
+  /// \brief Return the number of cache hits
+  std::size_t hits() const { return this->_hits; }
+
+  /// \brief Return the number of cache misses
+  std::size_t misses() const { return this->_misses; }
+
+  /// \brief Return the number of entries: summaries, merged entry invariants,
+  /// cycle head invariants and summaries of context-independent callees
+  std::size_t size() const {
+    return this->_map.size() + this->_merged.size() + this->_seeds.size() +
+           this->_independent.size();
+  }
+
+  /// \brief Return the largest number of entries so far
+  std::size_t peak_size() const {
+    return std::max(this->_peak_size, this->size());
+  }
+
+  /// \brief Add the hit and miss counters of another cache to this one, and
+  /// take the largest peak size
+  void merge_statistics(const CalleeSummaryCache& other) {
+    this->_hits += other._hits;
+    this->_misses += other._misses;
+    this->_peak_size = std::max(this->peak_size(), other.peak_size());
+  }
+
+}; // end class CalleeSummaryCache
+
 /// \brief Inliner of function calls.
 ///
 /// The inlining of a function is done dynamically by matching formal and actual
@@ -71,6 +356,18 @@ namespace analyzer {
 /// the callee returns by simulating call-by-ref and updating the return value
 /// at the call site. The inlining also supports function pointers by resolving
 /// first the set of possible callees and joining the results.
+///
+/// While the fixpoint on the caller is not reached, callee exit invariants are
+/// memoized in a CalleeSummaryCache shared by all the functions analyzed from
+/// the same entry point.
+///
+/// By default, the callee fix-points are kept until the checks of the caller
+/// are run, so the whole inlined call tree is in memory at once. With
+/// -stream-checks, a callee fix-point is dropped as soon as its exit invariant
+/// is used. Once the convergence on the caller is achieved, the callee is
+/// analyzed again, checked and destroyed, so that the memory is bounded by the
+/// call depth instead of the size of the call tree, at the cost of a second
+/// fix-point computation per callee.
 template < typename FunctionAnalyzer, typename AbstractDomain >
 class InlineCallExecutionEngine final : public CallExecutionEngine {
 public:
@@ -170,6 +467,7 @@ public:
   void exec_exit(ar::Function* fun) override {
     this->_engine.deallocate_local_variables(fun->local_variable_begin(),
                                              fun->local_variable_end());
+    this->_engine.collect_unreachable_memory();
     this->_exit_inv = this->_engine.inv();
   }
 
@@ -327,9 +625,30 @@ private:
       ikos_assert(callee->is_definition());
 
       if (this->_caller.is_currently_analyzed(callee)) {
-        // TODO(jnavas): we can be more precise by making top only lhs of
-        // call_stmt, actual parameters of pointer type and any global variable
-        // that might be touched by the recursive function.
+        // Only the memory written by the recursive function is forgotten, for
+        // a direct call (see ModRefAnalysis)
+        this->_engine.exec_unknown_intern_call(call);
+        return;
+      }
+
+      if (this->_ctx.mod_ref != nullptr &&
+          this->_ctx.mod_ref->is_context_independent(callee)) {
+        if (!this->exec_independent_call(call, callee, callee_map, post)) {
+          this->_engine.exec_unknown_intern_call(call);
+          return;
+        }
+
+        resolved = true;
+        continue;
+      }
+
+      bool merged = false;
+      CallContext* callee_context = this->callee_context(call, callee, merged);
+
+      if (this->_ctx.budget_downgrades != nullptr &&
+          this->_ctx.budget_downgrades->contains(callee, callee_context)) {
+        // The callee already exceeded its budget in this context, see
+        // analyze_callee()
         this->_engine.exec_unknown_intern_call(call);
         return;
       }
@@ -346,41 +665,136 @@ private:
       // Analyze recursively the callee
       //
 
-      const InlineCallExecutionEngineT* callee_inliner = nullptr;
-
-      if (this->_convergence_achieved) {
+      const AbstractDomain* exit_inv = nullptr;
+      ar::ReturnValue* return_stmt = nullptr;
+
+      // Callee analyzer removed from the callee map, destroyed at the end of
+      // the iteration, with -stream-checks
+      std::unique_ptr< FunctionAnalyzer > streamed;
+
+      auto& cache = this->_caller.summary_cache();
+
+      if (this->_convergence_achieved && merged) {
+        // The callee is checked once for all the call paths sharing the call
+        // context, unless the entry invariant grows
+        auto it = callee_map.find(callee);
+        const auto* summary =
+            cache.is_checked(callee_context, callee, engine.inv())
+                ? cache.find(callee_context, callee, engine.inv())
+                : nullptr;
+
+        if (summary != nullptr) {
+          // Already checked with a larger entry invariant
+          if (it != callee_map.end()) {
+            streamed = std::move(it->second);
+            callee_map.erase(it);
+          }
+          exit_inv = &summary->exit;
+          return_stmt = summary->return_stmt;
+        } else {
+          if (it != callee_map.end()) {
+            callee_map.erase(it);
+          }
+          AbstractDomain entry =
+              cache.merge(callee_context, callee, engine.inv());
+          it = this->analyze_callee(callee_map, callee_context, callee, entry);
+          if (it == callee_map.end()) {
+            this->_engine.exec_unknown_intern_call(call);
+            return;
+          }
+          const InlineCallExecutionEngineT& callee_inliner =
+              it->second->inliner();
+          cache.mark_checked(callee_context, callee, entry);
+          cache.insert(callee_context,
+                       callee,
+                       std::move(entry),
+                       callee_inliner.exit_invariant(),
+                       callee_inliner.return_stmt());
+          exit_inv = &callee_inliner.exit_invariant();
+          return_stmt = callee_inliner.return_stmt();
+
+          if (this->_ctx.opts.stream_checks) {
+            // Check the callee now, then free its invariants and its callees
+            it->second->run_checks();
+            streamed = std::move(it->second);
+            callee_map.erase(it);
+          }
+        }
+      } else if (this->_convergence_achieved) {
         // Use the previously computed fix-point
-        FunctionAnalyzer* callee_analyzer = callee_map.at(callee).get();
-
-        if (this->_context_stable) {
+        auto it = callee_map.find(callee);
+
+        if (it == callee_map.end()) {
+          // The last analysis of the callee was skipped using the summary
+          // cache, compute the fix-point now to be able to run the checks
+          it = this->analyze_callee(callee_map,
+                                    callee_context,
+                                    callee,
+                                    engine.inv());
+          if (it == callee_map.end()) {
+            this->_engine.exec_unknown_intern_call(call);
+            return;
+          }
+        } else if (this->_context_stable) {
           // Calling context is stable
-          callee_analyzer->mark_context_stable();
+          it->second->mark_context_stable();
         }
 
-        callee_inliner = &callee_analyzer->inliner();
+        exit_inv = &it->second->inliner().exit_invariant();
+        return_stmt = it->second->inliner().return_stmt();
+
+        if (this->_ctx.opts.stream_checks) {
+          // Check the callee now, then free its invariants and its callees
+          it->second->run_checks();
+          streamed = std::move(it->second);
+          callee_map.erase(it);
+        }
       } else {
         // Erase the previous fix-point
         callee_map.erase(callee);
 
-        auto callee_analyzer = std::make_unique<
-            FunctionAnalyzer >(_ctx,
-                               _caller,
-                               call,
-                               callee,
-                               this->_context_stable &&
-                                   this->_convergence_achieved);
-
-        callee_inliner = &callee_analyzer->inliner();
-
-        // Run analysis on callee
-        log::debug("Analyzing function: " + demangle(callee->name()));
-        callee_analyzer->run(engine.inv());
-
-        // insert in the callee map
-        callee_map.emplace(callee, std::move(callee_analyzer));
+        if (auto summary = cache.find(callee_context, callee, engine.inv())) {
+          // Use the cached exit invariant, the fix-point on the callee will
+          // be computed once the convergence is achieved, if needed
+          log::debug([callee] {
+            return "Using summary of function: " + demangle(callee);
+          });
+          exit_inv = &summary->exit;
+          return_stmt = summary->return_stmt;
+        } else {
+          // In a merged call context, analyze the callee with the join of the
+          // entry invariants of all the call paths
+          AbstractDomain entry =
+              merged ? cache.merge(callee_context, callee, engine.inv())
+                     : engine.inv();
+          auto it = this->analyze_callee(callee_map,
+                                         callee_context,
+                                         callee,
+                                         entry);
+          if (it == callee_map.end()) {
+            this->_engine.exec_unknown_intern_call(call);
+            return;
+          }
+          const InlineCallExecutionEngineT& callee_inliner =
+              it->second->inliner();
+          cache.insert(callee_context,
+                       callee,
+                       std::move(entry),
+                       callee_inliner.exit_invariant(),
+                       callee_inliner.return_stmt());
+          exit_inv = &callee_inliner.exit_invariant();
+          return_stmt = callee_inliner.return_stmt();
+
+          if (this->_ctx.opts.stream_checks) {
+            // The fix-point will be computed again to run the checks, once
+            // the convergence is achieved
+            streamed = std::move(it->second);
+            callee_map.erase(it);
+          }
+        }
       }
 
-      engine.set_inv(callee_inliner->exit_invariant());
+      engine.set_inv(*exit_inv);
 
       // Merge exceptions in caught_exceptions, in case it's an invoke
       engine.inv().merge_propagated_in_caught_exceptions();
@@ -392,7 +806,7 @@ private:
         continue;
       }
 
-      engine.match_up(call, callee_inliner->return_stmt());
+      engine.match_up(call, return_stmt);
       post.join_with(engine.inv());
 
       resolved = true;
@@ -408,6 +822,162 @@ private:
     this->_engine.set_inv(std::move(post));
   }
 
+  /// \brief Execute a call to a context-independent callee, and join the
+  /// result in `post`
+  ///
+  /// The callee is analyzed once from top in the empty call context, and its
+  /// exit invariant is used for all its calls. Only the returned value is
+  /// propagated to the caller, since the callee only accesses its own local
+  /// variables. The callee is analyzed again once, at the first call checked,
+  /// to run its checks.
+  ///
+  /// Returns false if the analysis of the callee exceeded its budget.
+  bool exec_independent_call(ar::CallBase* call,
+                             ar::Function* callee,
+                             CalleeMap& callee_map,
+                             AbstractDomain& post) {
+    auto& cache = this->_caller.summary_cache();
+    const auto* summary = cache.find_independent(callee);
+    bool check = this->_convergence_achieved &&
+                 (summary == nullptr || !summary->checked);
+
+    if (summary == nullptr || check) {
+      AbstractDomain entry = this->inv();
+      entry.normal().set_to_top();
+      entry.ignore_exceptions();
+
+      // The fix-point is kept in the callee map only to run the checks
+      CalleeMap unchecked;
+      CalleeMap& analyzers = check ? callee_map : unchecked;
+      analyzers.erase(callee);
+      auto it = this->analyze_callee(analyzers,
+                                     this->_ctx.call_context_factory
+                                         ->get_empty(),
+                                     callee,
+                                     entry);
+      if (it == analyzers.end()) {
+        return false;
+      }
+      cache.insert_independent(callee,
+                               it->second->inliner().exit_invariant(),
+                               it->second->inliner().return_stmt(),
+                               check);
+      summary = cache.find_independent(callee);
+
+      if (check && this->_ctx.opts.stream_checks) {
+        // Check the callee now, then free its invariants
+        it->second->run_checks();
+        analyzers.erase(it);
+      }
+    } else {
+      log::debug([callee] {
+        return "Using context-independent summary of function: " +
+               demangle(callee);
+      });
+    }
+
+    NumericalExecutionEngineT engine(this->_engine.fork());
+    engine.inv().ignore_exceptions();
+
+    if (summary->exit.is_normal_flow_bottom()) {
+      // The callee never returns
+      engine.inv().set_normal_flow_to_bottom();
+      post.join_with(engine.inv());
+      return true;
+    }
+
+    ar::ReturnValue* return_stmt = summary->return_stmt;
+    if (return_stmt != nullptr && return_stmt->has_operand() &&
+        call->has_result()) {
+      // Bring the returned variable into the caller, match_up() then assigns
+      // it to the result and forgets it
+      const ScalarLit& ret =
+          this->_ctx.lit_factory->get_scalar(return_stmt->operand());
+      const auto& exit = summary->exit.normal();
+      if (ret.is_machine_int_var()) {
+        engine.inv().normal().integers().set(ret.var(),
+                                             exit.integers().to_interval(
+                                                 ret.var()));
+      }
+      if (ret.is_var()) {
+        engine.inv().normal().uninitialized().set(ret.var(),
+                                                  exit.uninitialized().get(
+                                                      ret.var()));
+      }
+    }
+
+    engine.match_up(call, return_stmt);
+    post.join_with(engine.inv());
+    return true;
+  }
+
+  /// \brief Return the call context of the given callee
+  ///
+  /// Sets `merged` to true if the call context is shared by several call
+  /// paths, because of -context-merge or -context-depth.
+  CallContext* callee_context(ar::CallBase* call,
+                              ar::Function* callee,
+                              bool& merged) const {
+    CallContext* parent = this->_caller.call_context();
+    const AnalysisOptions& opts = this->_ctx.opts;
+
+    if (std::find(opts.context_merge.begin(),
+                  opts.context_merge.end(),
+                  callee) != opts.context_merge.end()) {
+      merged = true;
+      return this->_ctx.call_context_factory->get_empty();
+    }
+
+    if (opts.context_depth > 0 && parent->depth() >= opts.context_depth) {
+      merged = true;
+      return this->_ctx.call_context_factory->get_context(parent,
+                                                          call,
+                                                          opts.context_depth);
+    }
+
+    merged = false;
+    return this->_ctx.call_context_factory->get_context(parent, call);
+  }
+
+  /// \brief Compute the fix-point on the given callee and insert it in the
+  /// given CalleeMap
+  ///
+  /// Returns the end of the CalleeMap if the fix-point computation exceeded
+  /// its budget. The callee should then be treated as an unknown call.
+  typename CalleeMap::iterator analyze_callee(CalleeMap& callee_map,
+                                              CallContext* callee_context,
+                                              ar::Function* callee,
+                                              const AbstractDomain& entry) {
+    auto callee_analyzer = std::make_unique<
+        FunctionAnalyzer >(_ctx,
+                           _caller,
+                           callee_context,
+                           callee,
+                           this->_context_stable &&
+                               this->_convergence_achieved);
+
+    // Run analysis on callee
+    log::debug([callee] { return "Analyzing function: " + demangle(callee); });
+    try {
+      callee_analyzer->run(entry);
+    } catch (const FunctionBudgetExceeded& err) {
+      ikos_assert(err.function() == callee);
+      log::debug([&err, callee] {
+        return "Exceeded the " + std::string(budget_kind_str(err.kind())) +
+               " budget, treating function as unknown: " + demangle(callee);
+      });
+      if (this->_ctx.budget_downgrades != nullptr) {
+        this->_ctx.budget_downgrades->record(callee,
+                                             callee_analyzer->call_context(),
+                                             err.kind());
+      }
+      return callee_map.end();
+    }
+
+    // insert in the callee map
+    return callee_map.emplace(callee, std::move(callee_analyzer)).first;
+  }
+
 }; // end class InlineCallExecutionEngine
 
 } // end namespace analyzer
@@ -58,12 +58,16 @@
 #include <ikos/core/domain/pointer/abstract_domain.hpp>
 #include <ikos/core/domain/uninitialized/abstract_domain.hpp>
 
+#include <ikos/analyzer/analysis/alloc_size.hpp>
 #include <ikos/analyzer/analysis/context.hpp>
+#include <ikos/analyzer/analysis/exception.hpp>
 #include <ikos/analyzer/analysis/execution_engine/engine.hpp>
 #include <ikos/analyzer/analysis/literal.hpp>
 #include <ikos/analyzer/analysis/liveness.hpp>
+#include <ikos/analyzer/analysis/mod_ref.hpp>
 #include <ikos/analyzer/analysis/option.hpp>
 #include <ikos/analyzer/analysis/pointer/value.hpp>
+#include <ikos/analyzer/analysis/sparse_scalar.hpp>
 #include <ikos/analyzer/support/assert.hpp>
 #include <ikos/analyzer/support/cast.hpp>
 
@@ -183,6 +187,15 @@ private:
   /// \brief Optional pointer information
   const PointerInfo* _pointer_info;
 
+  /// \brief Optional values of the sparse scalars of the analyzed code
+  SparseScalarValues* _sparse_scalars;
+
+  /// \brief True if the program cannot catch exceptions
+  ///
+  /// In that case, thrown exceptions are discarded and the exception states
+  /// of the invariant remain bottom.
+  bool _exception_free;
+
 public:
   /// \brief Constructor
   ///
@@ -207,7 +220,10 @@ public:
         _call_context(call_context),
         _precision(precision),
         _liveness(liveness),
-        _pointer_info(pointer_info) {}
+        _pointer_info(pointer_info),
+        _sparse_scalars(nullptr),
+        _exception_free(ctx.exception != nullptr &&
+                        ctx.exception->exception_free()) {}
 
 private:
   /// \brief Private copy constructor
@@ -249,6 +265,22 @@ public:
   /// \brief Return the pointer information, or null
   const PointerInfo* pointer_info() const { return this->_pointer_info; }
 
+  /// \brief Update the pointer information, or null
+  void set_pointer_info(const PointerInfo* pointer_info) {
+    this->_pointer_info = pointer_info;
+  }
+
+  /// \brief Return the values of the sparse scalars, or null
+  SparseScalarValues* sparse_scalars() const { return this->_sparse_scalars; }
+
+  /// \brief Update the values of the sparse scalars, or null
+  ///
+  /// The sparse scalars are then removed from the invariant when leaving a
+  /// basic block, and restored when entering a basic block using them.
+  void set_sparse_scalars(SparseScalarValues* sparse_scalars) {
+    this->_sparse_scalars = sparse_scalars;
+  }
+
 public:
   /// \name Helpers for memory statements
   /// @{
@@ -385,6 +417,15 @@ private:
     }
   }
 
+  /// \brief Return the allocation size of a global variable or a function,
+  /// or null for any other memory location
+  const MachineInt* global_alloc_size(MemoryLocation* addr) const {
+    if (this->_ctx.global_alloc_sizes == nullptr) {
+      return nullptr;
+    }
+    return this->_ctx.global_alloc_sizes->get(addr);
+  }
+
 private:
   /// \brief Prepare a memory access (read/write) on the given pointer
   ///
@@ -853,6 +894,9 @@ private:
   ///
   /// Equivalent to if (rand()) { throw rand(); }
   void throw_unknown_exceptions() {
+    if (this->_exception_free) {
+      return;
+    }
     this->_inv.caught_exceptions().join_with(this->_inv.normal());
   }
 
@@ -894,18 +938,114 @@ public:
     }
   }
 
+  /// \brief Forget the dynamic allocations and the deallocated memory
+  /// locations that are no longer reachable from a pointer variable
+  ///
+  /// Their memory contents, lifetime and allocated size are forgotten.
+  void collect_unreachable_memory() {
+    if (this->_precision < Precision::Pointer) {
+      return;
+    }
+
+    this->collect_unreachable_memory(this->_inv.normal());
+    this->collect_unreachable_memory(this->_inv.caught_exceptions());
+    this->collect_unreachable_memory(this->_inv.propagated_exceptions());
+  }
+
+private:
+  /// \brief Forget the unreachable memory locations of the given invariant
+  template < typename MemoryDomain >
+  void collect_unreachable_memory(MemoryDomain& inv) {
+    std::vector< MemoryLocation* > collected =
+        inv.forget_unreachable_mem([](MemoryLocation* addr) {
+          return isa< DynAllocMemoryLocation >(addr);
+        });
+
+    for (MemoryLocation* addr : collected) {
+      inv.integers().forget(this->_var_factory.get_alloc_size(addr));
+    }
+  }
+
+  /// \brief Record the values of the sparse scalars defined in the given
+  /// basic block, and remove the sparse scalars from the invariant
+  void leave_sparse_scalars(ar::BasicBlock* bb) {
+    const SparseScalarValues::VariableRefList* defined =
+        this->_sparse_scalars->defined_in(bb);
+    const SparseScalarValues::VariableRefList* used =
+        this->_sparse_scalars->used_in(bb);
+
+    if (defined != nullptr) {
+      for (Variable* var : *defined) {
+        this->record_sparse_scalar(var, this->_inv.normal());
+        this->record_sparse_scalar(var, this->_inv.caught_exceptions());
+        this->record_sparse_scalar(var, this->_inv.propagated_exceptions());
+        this->forget_sparse_scalar(var);
+      }
+    }
+    if (used != nullptr) {
+      for (Variable* var : *used) {
+        this->forget_sparse_scalar(var);
+      }
+    }
+  }
+
+  /// \brief Join the value of a sparse scalar in the given invariant
+  template < typename MemoryDomain >
+  void record_sparse_scalar(Variable* var, const MemoryDomain& inv) {
+    if (inv.is_bottom()) {
+      return;
+    }
+
+    this->_sparse_scalars->join(var,
+                                inv.integers().to_interval_congruence(var),
+                                inv.uninitialized().get(var));
+  }
+
+  /// \brief Remove a sparse scalar from the invariant
+  void forget_sparse_scalar(Variable* var) {
+    this->_inv.normal().forget_surface(var);
+    this->_inv.caught_exceptions().forget_surface(var);
+    this->_inv.propagated_exceptions().forget_surface(var);
+  }
+
 public:
   /// @}
   /// \name Implement ExecutionEngine
   /// @{
 
   /// \brief Enter a basic block
-  void exec_enter(ar::BasicBlock*) override {}
+  ///
+  /// Restore the sparse scalars used in the basic block
+  void exec_enter(ar::BasicBlock* bb) override {
+    if (this->_sparse_scalars == nullptr) {
+      return;
+    }
+
+    const SparseScalarValues::VariableRefList* used =
+        this->_sparse_scalars->used_in(bb);
+
+    if (used == nullptr || this->_inv.is_normal_flow_bottom()) {
+      return;
+    }
+
+    for (Variable* var : *used) {
+      const SparseScalarValues::Value* value = this->_sparse_scalars->get(var);
+      if (value != nullptr) {
+        this->_inv.normal().integers().set(var, value->integer);
+        this->_inv.normal().uninitialized().set(var, value->uninitialized);
+      }
+    }
+  }
 
   /// \brief Leave a basic block
   ///
-  /// Use the liveness analysis to remove dead variables
+  /// Record and remove the sparse scalars, then use the liveness analysis to
+  /// remove dead variables
   void exec_leave(ar::BasicBlock* bb) override {
+    if (this->_sparse_scalars != nullptr) {
+      this->leave_sparse_scalars(bb);
+    }
+
     if (this->_liveness == nullptr) {
       return;
     }
@@ -955,6 +1095,14 @@ public:
       this->_inv.caught_exceptions().forget_surface(var);
       this->_inv.propagated_exceptions().forget_surface(var);
     }
+
+    // Clean-up deallocated memory locations that are no longer referenced,
+    // e.g, local variables of returned callees or freed dynamic allocations
+    if (this->_precision >= Precision::Pointer) {
+      this->_inv.normal().forget_unreachable_mem();
+      this->_inv.caught_exceptions().forget_unreachable_mem();
+      this->_inv.propagated_exceptions().forget_unreachable_mem();
+    }
   }
 
   /// \brief Execute an edge from `src` to `dest`
@@ -2031,14 +2179,31 @@ public:
   }
 
   /// \brief Execute a call to an unknown internal function
+  ///
+  /// For a direct call, only the memory locations that the callee may write
+  /// are forgotten (see ModRefAnalysis).
   void exec_unknown_intern_call(ar::CallBase* call) override {
     if (this->_inv.is_normal_flow_bottom()) {
       return;
     }
 
+    // Memory locations written by the callee, or top
+    PointsToSet modified = PointsToSet::top();
+    if (this->_ctx.mod_ref != nullptr) {
+      if (auto cst = dyn_cast< ar::FunctionPointerConstant >(call->called())) {
+        modified = this->_ctx.mod_ref->modified(cst->function());
+      }
+    }
+
     if (this->_precision >= Precision::Memory) {
-      // Forget all memory contents
-      this->_inv.normal().forget_mem();
+      if (modified.is_top()) {
+        // Forget all memory contents
+        this->_inv.normal().forget_mem();
+      } else {
+        for (MemoryLocation* addr : modified) {
+          this->_inv.normal().forget_mem(addr);
+        }
+      }
     }
 
     // Forget the result
@@ -2051,7 +2216,13 @@ public:
 
         this->_inv.normal().forget_surface(ret.scalar().var());
       } else if (ret.is_aggregate()) {
-        // Nothing to do, because we already forgot all memory contents
+        ikos_assert_msg(ret.aggregate().is_var(),
+                        "left hand side is not a variable");
+
+        if (this->_precision >= Precision::Memory && !modified.is_top()) {
+          ScalarLit ret_ptr = this->aggregate_pointer(ret.aggregate());
+          this->_inv.normal().forget_reachable_mem(ret_ptr.var());
+        }
       } else {
         ikos_unreachable("unexpected left hand side");
       }
@@ -2425,7 +2596,14 @@ private:
   /// After constructing the exception object with the throw argument value, the
   /// generated code calls the __cxa_throw runtime library routine. This routine
   /// never returns.
-  void exec_throw(ar::CallBase* /*call*/) { this->_inv.throw_exception(); }
+  void exec_throw(ar::CallBase* /*call*/) {
+    if (this->_exception_free) {
+      // The exception cannot be caught
+      this->_inv.set_normal_flow_to_bottom();
+    } else {
+      this->_inv.throw_exception();
+    }
+  }
 
   /// \brief Execute a libcpp begin catch
   ///
@@ -2491,12 +2669,8 @@ private:
     for (MemoryLocation* addr : points_to) {
       AbstractDomain tmp(this->_inv);
 
-      if (auto gv = dyn_cast< GlobalMemoryLocation >(addr)) {
-        MachineInt alloc_size(this->_data_layout.store_size_in_bytes(
-                                  gv->global_var()->type()->pointee()),
-                              this->_data_layout.pointers.bit_width,
-                              Unsigned);
-        tmp.normal().integers().add(IntPredicate::LT, lhs.var(), alloc_size);
+      if (const MachineInt* alloc_size = this->global_alloc_size(addr)) {
+        tmp.normal().integers().add(IntPredicate::LT, lhs.var(), *alloc_size);
       } else {
         Variable* size_var = this->_var_factory.get_alloc_size(addr);
         tmp.normal().integers().add(IntPredicate::LT, lhs.var(), size_var);
@@ -0,0 +1,252 @@
+/******************************************************************************
+ *
+ * \file
+ * \brief Call semantic using bottom-up function summaries
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+#include <boost/container/flat_map.hpp>
+
+#include <ikos/analyzer/analysis/execution_engine/engine.hpp>
+#include <ikos/analyzer/analysis/execution_engine/numerical.hpp>
+#include <ikos/analyzer/analysis/variable.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Summary of a function, computed with a top entry invariant
+template < typename AbstractDomain >
+struct FunctionSummary {
+  /// \brief Invariant at the exit of the function
+  ///
+  /// It only relates the parameters, the returned value, the memory contents
+  /// and the lifetime and allocated size of memory locations. Exception states
+  /// are ignored.
+  AbstractDomain exit;
+
+  /// \brief Return statement of the function, or null
+  ar::ReturnValue* return_stmt;
+};
+
+/// \brief Table of function summaries
+template < typename AbstractDomain >
+class FunctionSummaryTable {
+public:
+  using FunctionSummaryT = FunctionSummary< AbstractDomain >;
+
+private:
+  /// \brief Map from function to summary
+  boost::container::flat_map< ar::Function*,
+                              std::unique_ptr< const FunctionSummaryT > >
+      _map;
+
+public:
+  /// \brief Constructor
+  FunctionSummaryTable() = default;
+
+  /// \brief Deleted copy constructor
+  FunctionSummaryTable(const FunctionSummaryTable&) = delete;
+
+  /// \brief Deleted move constructor
+  FunctionSummaryTable(FunctionSummaryTable&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  FunctionSummaryTable& operator=(const FunctionSummaryTable&) = delete;
+
+  /// \brief Deleted move assignment operator
+  FunctionSummaryTable& operator=(FunctionSummaryTable&&) = delete;
+
+  /// \brief Destructor
+  ~FunctionSummaryTable() = default;
+
+  /// \brief Return the summary of the given function, or null
+  const FunctionSummaryT* find(ar::Function* fun) const {
+    auto it = this->_map.find(fun);
+    if (it == this->_map.end()) {
+      return nullptr;
+    }
+    return it->second.get();
+  }
+
+  /// \brief Insert the summary of the given function
+  void insert(ar::Function* fun, AbstractDomain exit, ar::ReturnValue* ret) {
+    this->_map[fun] = std::make_unique< const FunctionSummaryT >(
+        FunctionSummaryT{std::move(exit), ret});
+  }
+
+  /// \brief Return the number of summaries
+  std::size_t size() const { return this->_map.size(); }
+
+}; // end class FunctionSummaryTable
+
+/// \brief Call semantic using function summaries
+///
+/// A direct call to a function with a summary is executed as follows:
+///   * The parameters of the callee are assigned with the arguments;
+///   * The call is treated as a call to an unknown internal function, which
+///     forgets all memory contents and might throw exceptions;
+///   * The lifetime and allocated size of the memory locations constrained by
+///     the summary are forgotten;
+///   * The invariant is refined with the exit invariant of the summary;
+///   * The returned value is assigned to the result, and the parameters are
+///     removed.
+///
+/// Since the summary is computed with a top entry invariant, this is sound
+/// and at least as precise as ContextInsensitiveCallExecutionEngine.
+///
+/// Other calls (recursive calls, indirect calls) are handled as in
+/// ContextInsensitiveCallExecutionEngine.
+template < typename AbstractDomain >
+class SummaryCallExecutionEngine final : public CallExecutionEngine {
+public:
+  using NumericalExecutionEngineT = NumericalExecutionEngine< AbstractDomain >;
+  using FunctionSummaryT = FunctionSummary< AbstractDomain >;
+  using FunctionSummaryTableT = FunctionSummaryTable< AbstractDomain >;
+
+private:
+  /// \brief Numerical execution engine
+  NumericalExecutionEngineT& _engine;
+
+  /// \brief Variable factory
+  VariableFactory& _var_factory;
+
+  /// \brief Summaries of the functions analyzed so far
+  const FunctionSummaryTableT& _summaries;
+
+public:
+  /// \brief Constructor
+  SummaryCallExecutionEngine(NumericalExecutionEngineT& engine,
+                             VariableFactory& var_factory,
+                             const FunctionSummaryTableT& summaries)
+      : _engine(engine), _var_factory(var_factory), _summaries(summaries) {}
+
+  /// \brief Exit a function
+  void exec_exit(ar::Function*) override {}
+
+  /// \brief Execute any call statement
+  void exec(ar::CallBase* call) {
+    if (auto cst = dyn_cast< ar::FunctionPointerConstant >(call->called())) {
+      // Direct call
+      ar::Function* fun = cst->function();
+
+      if (fun->is_declaration()) {
+        // Extern function
+        this->_engine.exec_extern_call(call, fun);
+        return;
+      }
+
+      if (const FunctionSummaryT* summary = this->_summaries.find(fun)) {
+        this->exec_summary(call, fun, *summary);
+        return;
+      }
+    }
+
+    // Otherwise
+    this->_engine.exec_unknown_intern_call(call);
+  }
+
+  /// \brief Execute a Call statement
+  void exec(ar::Call* s) override {
+    // execute the call statement
+    this->exec(cast< ar::CallBase >(s));
+
+    // exceptions aren't caught, propagate them
+    this->_engine.inv().merge_caught_in_propagated_exceptions();
+  }
+
+  /// \brief Execute an Invoke statement
+  void exec(ar::Invoke* s) override {
+    // execute the call base statement
+    this->exec(cast< ar::CallBase >(s));
+
+    // Exceptions are caught.
+    // Nothing to do here.
+    // see NumericalExecutionEngine::exec_edge()
+  }
+
+  /// \brief Execute a ReturnValue statement
+  void exec(ar::ReturnValue*) override {}
+
+private:
+  /// \brief Execute a call to a function with the given summary
+  void exec_summary(ar::CallBase* call,
+                    ar::Function* callee,
+                    const FunctionSummaryT& summary) {
+    AbstractDomain& inv = this->_engine.inv();
+
+    if (inv.is_normal_flow_bottom()) {
+      return;
+    }
+
+    // Assign parameters
+    this->_engine.match_down(call, callee);
+
+    // Forget the memory contents and the result, throw unknown exceptions
+    this->_engine.exec_unknown_intern_call(call);
+
+    // Apply the summary
+    if (summary.exit.is_normal_flow_bottom()) {
+      inv.normal().set_to_bottom();
+    } else {
+      for (const auto& entry : summary.exit.normal().lifetime()) {
+        MemoryLocation* addr = entry.first;
+        inv.normal().lifetime().forget(addr);
+        inv.normal().integers().forget(this->_var_factory.get_alloc_size(addr));
+      }
+      inv.normal().meet_with(summary.exit.normal());
+      this->_engine.match_up(call, summary.return_stmt);
+    }
+
+    // Remove the parameters
+    for (auto it = callee->param_begin(), et = callee->param_end(); it != et;
+         ++it) {
+      InternalVariable* param = this->_var_factory.get_internal(*it);
+      inv.normal().forget_surface(param);
+      inv.caught_exceptions().forget_surface(param);
+    }
+  }
+
+}; // end class SummaryCallExecutionEngine
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -43,7 +43,11 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <boost/optional.hpp>
 
@@ -77,14 +81,27 @@ class FixpointProfile;
 /// \endcode
 ///
 /// It will mark the constant '10' as a widening hint.
+///
+/// It also collects the constants compared against anywhere in a cycle of the
+/// function into a set of widening thresholds, so that the widening can jump
+/// to a stable bound even when it is not the loop exit constant.
+///
+/// The profile of a function is computed on the first call to profile(), so
+/// that the functions that are never analyzed do not pay for it. run()
+/// computes the profiles of all the functions.
 class FixpointProfileAnalysis {
 private:
   /// \brief Analysis context
   Context& _ctx;
 
   /// \brief Map that associates a function to a fixpoint profile
+  ///
+  /// The profile is null if the function has no widening hint.
   llvm::DenseMap< ar::Function*, std::unique_ptr< FixpointProfile > > _map;
 
+  /// \brief Mutex, used within a concurrent scope
+  std::mutex _mutex;
+
 public:
   /// \brief Constructor
   FixpointProfileAnalysis(Context& ctx) : _ctx(ctx) {}
@@ -101,14 +118,28 @@ public:
   /// \brief Delete move assignment operator
   FixpointProfileAnalysis& operator=(FixpointProfileAnalysis&&) = delete;
 
-  /// \brief Run the analysis
+  /// \brief Compute the profiles of all the functions
   void run();
 
-  /// \brief Dump the fixpoint profile analysis, for debugging purpose
+  /// \brief Dump the computed fixpoint profiles, for debugging purpose
   void dump(std::ostream& o) const;
 
   /// \brief Return the profile associated with a function
-  boost::optional< const FixpointProfile& > profile(ar::Function*) const;
+  ///
+  /// The profile is computed on the first call.
+  boost::optional< const FixpointProfile& > profile(ar::Function*);
+
+  /// \brief Write the computed profiles on the given stream
+  ///
+  /// Functions are identified by name, basic blocks by their position in the
+  /// function body, thus the profiles can only be loaded back on the same
+  /// bundle, e.g. a bundle from the AR cache. `key` identifies that bundle.
+  void save(std::ostream& o, const std::string& key) const;
+
+  /// \brief Load profiles written by save()
+  ///
+  /// Returns false if the stream is invalid or the key does not match.
+  bool load(std::istream& i, const std::string& key);
 
 private:
   /// \brief Analyze a function
@@ -120,7 +151,8 @@ private:
 ///
 /// A fixpoint profile is associated with a function.
 /// Inside a function, if there are some cycles, it will associate the head of
-/// each cycle with a widening hint, if found.
+/// each cycle with a widening hint, if found, and hold the widening thresholds
+/// of the function.
 class FixpointProfile {
 private:
   /// \brief Function associated to the profile
@@ -130,6 +162,11 @@ private:
   llvm::DenseMap< ar::BasicBlock*, std::unique_ptr< core::MachineInt > >
       _widening_hints;
 
+  /// \brief Constants compared against in the cycles of the function
+  ///
+  /// Thresholds can have different bit-widths and signs.
+  std::vector< core::MachineInt > _widening_thresholds;
+
   /// \brief Constructor
   FixpointProfile(ar::Function* fun) : _function(fun) {}
 
@@ -141,7 +178,12 @@ public:
   boost::optional< const core::MachineInt& > widening_hint(
       ar::BasicBlock*) const;
 
-  /// \brief Return true if there is at least one widening hint
+  /// \brief Return the widening thresholds of the function
+  const std::vector< core::MachineInt >& widening_thresholds() const {
+    return this->_widening_thresholds;
+  }
+
+  /// \brief Return true if there is no widening hint and no threshold
   bool empty() const;
 
   /// \brief Dump the fixpoint profile, for debugging purpose
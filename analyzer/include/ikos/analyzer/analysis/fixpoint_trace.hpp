@@ -0,0 +1,224 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Tracing of the fixpoint iterators, in the Chrome trace event format
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ikos/core/fixpoint/fixpoint_tracer.hpp>
+
+#include <ikos/ar/semantic/code.hpp>
+#include <ikos/ar/semantic/function.hpp>
+
+#include <ikos/analyzer/json/json.hpp>
+#include <ikos/analyzer/util/timer.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Writer of a fixpoint trace, in the Chrome trace event format
+///
+/// Each event is written as a complete event, so the file can be loaded in
+/// chrome://tracing or in Perfetto. Events shorter than the threshold are
+/// dropped, to keep the traces of large programs readable.
+class FixpointTraceWriter {
+private:
+  /// \brief Output file
+  std::ofstream _out;
+
+  /// \brief Start of the trace
+  Timer::TimePoint _start;
+
+  /// \brief Minimum duration of the written events
+  Timer::Duration _threshold;
+
+  /// \brief Small identifier of each thread
+  std::map< std::thread::id, std::size_t > _threads;
+
+  /// \brief True until the first event is written
+  bool _first = true;
+
+  /// \brief Protects the output file and _threads
+  std::mutex _mutex;
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param path Path of the trace file
+  /// \param threshold Minimum duration of the written events
+  FixpointTraceWriter(const std::string& path,
+                      std::chrono::microseconds threshold);
+
+  /// \brief Deleted copy constructor
+  FixpointTraceWriter(const FixpointTraceWriter&) = delete;
+
+  /// \brief Deleted move constructor
+  FixpointTraceWriter(FixpointTraceWriter&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  FixpointTraceWriter& operator=(const FixpointTraceWriter&) = delete;
+
+  /// \brief Deleted move assignment operator
+  FixpointTraceWriter& operator=(FixpointTraceWriter&&) = delete;
+
+  /// \brief Destructor
+  ///
+  /// Terminates the list of events.
+  ~FixpointTraceWriter();
+
+  /// \brief Return true if the trace file was successfully opened
+  bool is_open() const { return this->_out.is_open(); }
+
+  /// \brief Return true if an event of the given duration should be written
+  bool keep(Timer::Duration duration) const {
+    return duration >= this->_threshold;
+  }
+
+  /// \brief Write a complete event for the current thread
+  ///
+  /// \param name Name of the event
+  /// \param category Category of the event
+  /// \param begin Start of the event
+  /// \param end End of the event
+  /// \param args Additional information displayed with the event
+  void write(const std::string& name,
+             const char* category,
+             Timer::TimePoint begin,
+             Timer::TimePoint end,
+             const JsonDict& args);
+
+}; // end class FixpointTraceWriter
+
+/// \brief Fixpoint tracer for the analysis of a function
+///
+/// Writes an event for each node visit, cycle, iteration, extrapolation and
+/// refinement step of the fixpoint iterator, and for the whole analysis of the
+/// function (see begin_function() and end_function()).
+class FunctionFixpointTracer final
+    : public core::FixpointTracer< ar::BasicBlock* > {
+private:
+  /// \brief Trace writer
+  FixpointTraceWriter& _writer;
+
+  /// \brief Analyzed function
+  ar::Function* _function;
+
+  /// \brief Start of the pending events, per thread
+  std::map< std::thread::id, std::vector< Timer::TimePoint > > _stacks;
+
+  /// \brief Protects _stacks
+  std::mutex _mutex;
+
+public:
+  /// \brief Constructor
+  FunctionFixpointTracer(FixpointTraceWriter& writer, ar::Function* function)
+      : _writer(writer), _function(function) {}
+
+  /// \brief Called before the fixpoint computation of the function
+  void begin_function();
+
+  /// \brief Called after the fixpoint computation of the function
+  void end_function();
+
+  void begin(core::FixpointEvent event,
+             ar::BasicBlock* node,
+             unsigned iteration) override;
+
+  void end(core::FixpointEvent event,
+           ar::BasicBlock* node,
+           unsigned iteration) override;
+
+private:
+  /// \brief Push the start of an event for the current thread
+  void push();
+
+  /// \brief Pop the start of the last event of the current thread
+  Timer::TimePoint pop();
+
+}; // end class FunctionFixpointTracer
+
+/// \brief Trace the analysis of a function for the lifetime of the object
+///
+/// Does nothing if the tracer is null.
+class FunctionTraceScope {
+private:
+  FunctionFixpointTracer* _tracer;
+
+public:
+  /// \brief Begin the analysis of the function
+  explicit FunctionTraceScope(FunctionFixpointTracer* tracer)
+      : _tracer(tracer) {
+    if (this->_tracer != nullptr) {
+      this->_tracer->begin_function();
+    }
+  }
+
+  /// \brief Deleted copy constructor
+  FunctionTraceScope(const FunctionTraceScope&) = delete;
+
+  /// \brief Deleted move constructor
+  FunctionTraceScope(FunctionTraceScope&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  FunctionTraceScope& operator=(const FunctionTraceScope&) = delete;
+
+  /// \brief Deleted move assignment operator
+  FunctionTraceScope& operator=(FunctionTraceScope&&) = delete;
+
+  /// \brief End the analysis of the function
+  ~FunctionTraceScope() {
+    if (this->_tracer != nullptr) {
+      this->_tracer->end_function();
+    }
+  }
+
+}; // end class FunctionTraceScope
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -0,0 +1,216 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Budget of the fixpoint computations on callees
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <ikos/ar/semantic/function.hpp>
+
+#include <ikos/analyzer/analysis/call_context.hpp>
+#include <ikos/analyzer/analysis/option.hpp>
+#include <ikos/analyzer/exception.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+// forward declaration
+class DowngradesTable;
+
+/// \brief Kind of budget exceeded by a fixpoint computation
+enum class BudgetKind {
+  /// \brief Analysis time, in seconds
+  Time,
+
+  /// \brief Number of basic block analyses
+  Iterations,
+
+  /// \brief Number of memory cells in an invariant at a cycle head
+  InvariantSize,
+};
+
+/// \brief Return a string representing a BudgetKind
+const char* budget_kind_str(BudgetKind kind);
+
+/// \brief Budget of a fixpoint computation on a callee
+///
+/// The interprocedural value analysis inlines callees. A single expensive
+/// callee can therefore make the whole analysis run out of time or memory.
+/// When the fixpoint computation on a callee exceeds its budget, it throws a
+/// FunctionBudgetExceeded, and the caller falls back to the semantic of a call
+/// to an unknown internal function for that callee.
+class FunctionBudget {
+private:
+  using Clock = std::chrono::steady_clock;
+
+private:
+  /// \brief Maximum time, or 0 for no limit
+  std::chrono::seconds _time;
+
+  /// \brief Maximum number of basic block analyses, or 0 for no limit
+  uint64_t _iterations;
+
+  /// \brief Maximum number of memory cells at a cycle head, or 0 for no limit
+  std::size_t _invariant_size;
+
+  /// \brief Start of the fixpoint computation
+  Clock::time_point _start;
+
+  /// \brief Number of basic block analyses since the start
+  uint64_t _count = 0;
+
+public:
+  /// \brief Create a budget from the analysis options
+  explicit FunctionBudget(const AnalysisOptions& opts)
+      : _time(opts.function_time_budget),
+        _iterations(opts.function_iteration_budget),
+        _invariant_size(opts.function_invariant_budget) {}
+
+  /// \brief Return true if there is a limit
+  bool enabled() const {
+    return this->_time.count() > 0 || this->_iterations > 0 ||
+           this->_invariant_size > 0;
+  }
+
+  /// \brief Start a fixpoint computation on `fun`
+  void start() {
+    this->_start = Clock::now();
+    this->_count = 0;
+  }
+
+  /// \brief Count a basic block analysis of `fun`, and check the time and
+  /// iteration limits
+  void check_iteration(ar::Function* fun);
+
+  /// \brief Check the size of an invariant of `fun` at a cycle head
+  void check_invariant_size(ar::Function* fun, std::size_t size) const;
+
+}; // end class FunctionBudget
+
+/// \brief Exception thrown when a fixpoint computation on a callee exceeds
+/// its budget
+///
+/// This is caught by the inliner of the caller.
+class FunctionBudgetExceeded : public Exception {
+private:
+  /// \brief Function being analyzed
+  ar::Function* _function;
+
+  /// \brief Exceeded budget
+  BudgetKind _kind;
+
+public:
+  /// \brief Constructor
+  FunctionBudgetExceeded(ar::Function* fun, BudgetKind kind)
+      : _function(fun), _kind(kind) {}
+
+  /// \brief Return the function being analyzed
+  ar::Function* function() const { return this->_function; }
+
+  /// \brief Return the exceeded budget
+  BudgetKind kind() const { return this->_kind; }
+
+  /// \brief Get the explanatory string
+  const char* what() const noexcept override;
+
+}; // end class FunctionBudgetExceeded
+
+/// \brief Downgrades of callees that exceeded their budget
+///
+/// Collects, from any thread, the (function, call context) pairs analyzed as
+/// unknown calls, and writes them in the downgrades table of the output
+/// database. The checks of these functions are missing in these call
+/// contexts, and the analysis of their callers is less precise.
+class BudgetDowngrades {
+private:
+  /// \brief Map from (function, call context) to the exceeded budget
+  llvm::DenseMap< std::pair< ar::Function*, CallContext* >, BudgetKind >
+      _downgrades;
+
+  /// \brief Mutex, for the worker threads of the value analysis
+  mutable std::mutex _mutex;
+
+public:
+  /// \brief Constructor
+  BudgetDowngrades() = default;
+
+  /// \brief Deleted copy constructor
+  BudgetDowngrades(const BudgetDowngrades&) = delete;
+
+  /// \brief Deleted move constructor
+  BudgetDowngrades(BudgetDowngrades&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  BudgetDowngrades& operator=(const BudgetDowngrades&) = delete;
+
+  /// \brief Deleted move assignment operator
+  BudgetDowngrades& operator=(BudgetDowngrades&&) = delete;
+
+  /// \brief Destructor
+  ~BudgetDowngrades() = default;
+
+  /// \brief Record that `fun` exceeded its budget in the given call context
+  void record(ar::Function* fun, CallContext* call_context, BudgetKind kind);
+
+  /// \brief Return true if `fun` exceeded its budget in the given call context
+  bool contains(ar::Function* fun, CallContext* call_context) const;
+
+  /// \brief Return the number of downgrades
+  std::size_t size() const;
+
+  /// \brief Write the downgrades in the given table
+  ///
+  /// `domain` is the tag of the analysis configuration, or empty.
+  void save(DowngradesTable& table, const std::string& domain = {}) const;
+
+}; // end class BudgetDowngrades
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Profiler of the fixpoint computations on functions
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <ikos/ar/semantic/code.hpp>
+#include <ikos/ar/semantic/function.hpp>
+
+#include <ikos/analyzer/analysis/call_context.hpp>
+#include <ikos/analyzer/util/timer.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+// forward declaration
+class ProfileTable;
+
+/// \brief Statistics of the fixpoint computations on a function, in a given
+/// call context
+struct FunctionProfile {
+  /// \brief Number of fixpoint computations
+  ///
+  /// A callee is analyzed again each time the fixpoint iterator of the caller
+  /// reaches the call with a new invariant.
+  uint64_t runs = 0;
+
+  /// \brief Time spent in the fixpoint computations, including the callees
+  Timer::Duration inclusive_time{0};
+
+  /// \brief Time spent in the fixpoint computations, excluding the callees
+  Timer::Duration exclusive_time{0};
+
+  /// \brief Number of basic block analyses
+  uint64_t iterations = 0;
+
+  /// \brief Number of widenings
+  uint64_t widenings = 0;
+
+  /// \brief Number of narrowings
+  uint64_t narrowings = 0;
+
+  /// \brief Heads of the cycles on which the narrowing was stopped by the
+  /// narrowing iterations limit, before convergence
+  std::vector< ar::BasicBlock* > narrowing_capped_loops;
+
+  /// \brief Largest invariant, in number of memory cells, at the cycle heads
+  /// and at the exit of the function
+  std::size_t peak_invariant_size = 0;
+
+  /// \brief Largest invariant, in estimated bytes, at the cycle heads and at
+  /// the exit of the function
+  std::size_t peak_invariant_bytes = 0;
+
+  /// \brief Bytes of the machine integer domain, in the largest invariant
+  std::size_t peak_integer_bytes = 0;
+
+  /// \brief Bytes of the points-to sets and the nullity domain, in the
+  /// largest invariant
+  std::size_t peak_pointer_bytes = 0;
+
+  /// \brief Number of GMP allocations made by the thread of the fixpoint
+  /// computations, including the callees
+  uint64_t gmp_allocations = 0;
+
+  /// \brief Merge the statistics of another run
+  void merge(const FunctionProfile& other);
+
+}; // end struct FunctionProfile
+
+/// \brief Profiler of the fixpoint computations on functions
+///
+/// Collects a FunctionProfile per (function, call context), from any thread,
+/// and writes them in the profile table of the output database.
+class FunctionProfiler {
+private:
+  /// \brief Map from (function, call context) to profile
+  llvm::DenseMap< std::pair< ar::Function*, CallContext* >, FunctionProfile >
+      _profiles;
+
+  /// \brief Mutex, for the worker threads of the value analysis
+  std::mutex _mutex;
+
+public:
+  /// \brief Constructor
+  FunctionProfiler() = default;
+
+  /// \brief Deleted copy constructor
+  FunctionProfiler(const FunctionProfiler&) = delete;
+
+  /// \brief Deleted move constructor
+  FunctionProfiler(FunctionProfiler&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  FunctionProfiler& operator=(const FunctionProfiler&) = delete;
+
+  /// \brief Deleted move assignment operator
+  FunctionProfiler& operator=(FunctionProfiler&&) = delete;
+
+  /// \brief Destructor
+  ~FunctionProfiler() = default;
+
+  /// \brief Record the statistics of a fixpoint computation on `fun`
+  void record(ar::Function* fun,
+              CallContext* call_context,
+              const FunctionProfile& profile);
+
+  /// \brief Write the profiles in the given table
+  ///
+  /// `domain` is the tag of the analysis configuration, or empty.
+  void save(ProfileTable& table, const std::string& domain = {}) const;
+
+}; // end class FunctionProfiler
+
+} // end namespace analyzer
+} // end namespace ikos
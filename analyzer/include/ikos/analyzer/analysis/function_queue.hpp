@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Queue of the functions to analyze, shared by several processes
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+
+#include <ikos/ar/semantic/function.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Queue of the functions to analyze, shared by several processes
+///
+/// Several ikos-analyzer processes running the intraprocedural analysis on the
+/// same bundle with the same queue directory split its functions dynamically:
+/// a process only analyzes a function if it is the first one to claim it, by
+/// creating a file named after a hash of the function name in the directory.
+///
+/// Each process writes its own output database, with the checks of the
+/// functions it claimed.
+class FunctionQueue {
+private:
+  /// \brief Queue directory
+  boost::filesystem::path _directory;
+
+public:
+  /// \brief Constructor
+  ///
+  /// Creates the queue directory if it does not exist.
+  explicit FunctionQueue(boost::filesystem::path directory);
+
+  /// \brief Deleted copy constructor
+  FunctionQueue(const FunctionQueue&) = delete;
+
+  /// \brief Deleted move constructor
+  FunctionQueue(FunctionQueue&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  FunctionQueue& operator=(const FunctionQueue&) = delete;
+
+  /// \brief Deleted move assignment operator
+  FunctionQueue& operator=(FunctionQueue&&) = delete;
+
+  /// \brief Destructor
+  ~FunctionQueue() = default;
+
+  /// \brief Claim the given function
+  ///
+  /// Returns true if no process claimed it before. Thread-safe.
+  bool claim(ar::Function* fun) const;
+
+}; // end class FunctionQueue
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -61,12 +61,19 @@ namespace analyzer {
 /// \brief Class that handles a set of readable/writable addresses
 ///
 /// We can declare hardware addresses with an argument or by giving a file
+///
+/// A file either contains ranges (x-y), one or more per line separated by
+/// commas, or starts with the 8 bytes `IKOSHWA1` followed by pairs of 64-bit
+/// little-endian unsigned integers (lower bound, upper bound). Empty lines and
+/// lines starting with `#` are ignored in text files.
+///
+/// Ranges are kept sorted and merged, so that queries are binary searches.
 class HardwareAddresses {
 private:
   using Interval = core::machine_int::Interval;
 
 private:
-  /// \brief Range of hardware addresses
+  /// \brief Sorted disjoint ranges of hardware addresses
   std::vector< Interval > _address_ranges;
 
   const ar::DataLayout& _data_layout;
@@ -81,7 +88,7 @@ public:
   /// \brief Add a range from a string
   void add_range(StringRef);
 
-  /// \brief Add a range from a file
+  /// \brief Add the ranges from a file
   void add_range_from_file(const std::string&);
 
   /// \brief Get all the ranges
@@ -99,9 +106,18 @@ public:
   void dump(std::ostream& o) const;
 
 private:
-  /// \brief Add a range
+  /// \brief Add a range, without sorting
   void add_range(Interval);
 
+  /// \brief Add the ranges from a text file, without sorting
+  void add_ranges_from_text(std::istream&);
+
+  /// \brief Add the ranges from a binary file, without sorting
+  void add_ranges_from_binary(std::istream&);
+
+  /// \brief Sort and merge the ranges
+  void sort_ranges();
+
 }; // end class HardwareAddresses
 
 /// \brief Exception for HardwareAddresses
@@ -112,7 +128,8 @@ public:
     InvalidFormatKind,
     InvalidRangeKind,
     CannotOpenFileKind,
-    EmptyFileKind
+    EmptyFileKind,
+    TruncatedFileKind
   };
 
 private:
@@ -45,6 +45,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <unordered_map>
 
 #include <boost/variant.hpp>
@@ -60,6 +63,7 @@
 #include <ikos/analyzer/analysis/variable.hpp>
 #include <ikos/analyzer/exception.hpp>
 #include <ikos/analyzer/support/number.hpp>
+#include <ikos/analyzer/util/concurrency.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -326,7 +330,18 @@ private:
   const ar::DataLayout& _data_layout;
 
   /// \brief Map from ar::Value* to Literal
-  Map _map;
+  ShardedMap< Map > _map;
+
+  /// \brief Side array from ar::Value::index() to the cached Literal
+  ///
+  /// Variables and operand constants have a dense index, so once built
+  /// their literal (including the field decomposition of aggregate
+  /// constants) is shared through a single atomic load, without hashing or
+  /// locking. Entries point into `_map`.
+  std::unique_ptr< std::atomic< const Literal* >[] > _index_table;
+
+  /// \brief Size of `_index_table`
+  std::uint32_t _index_table_size;
 
 public:
   /// \brief Constructor
@@ -363,6 +378,9 @@ public:
   const Literal& get(ar::Value* value);
 
 private:
+  /// \brief Look up or create the literal in the sharded map
+  const Literal& get_or_create(ar::Value* value);
+
   /// \brief Translate an ar::Value* into a Literal
   Literal create_literal(ar::Value* value);
 
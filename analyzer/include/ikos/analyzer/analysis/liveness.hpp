@@ -59,6 +59,9 @@ namespace ikos {
 namespace analyzer {
 
 /// \brief Compute liveness of variables for a whole bundle
+///
+/// Each code is solved on bit-vectors, over the variables that can be live at
+/// a basic block boundary only.
 class LivenessAnalysis {
 public:
   /// \brief List of variables
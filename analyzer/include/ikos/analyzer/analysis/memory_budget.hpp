@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Memory budget of the analysis
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+#include <ikos/ar/semantic/function.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Return the resident set size of the process, in bytes, or 0 if it
+/// is unknown
+std::size_t resident_set_size();
+
+/// \brief Memory budget of the analysis
+///
+/// The fixpoint iterators check the resident set size of the process at each
+/// extrapolation on a cycle head, where invariants tend to grow, and stop the
+/// analysis with a MemoryBudgetError once it exceeds the budget. This allows
+/// the caller to stop gracefully, or to run the analysis again with a cheaper
+/// abstract domain, instead of being killed by the system.
+class MemoryBudget {
+private:
+  /// \brief Budget, in bytes
+  std::size_t _limit;
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param limit Budget, in bytes
+  explicit MemoryBudget(std::size_t limit) : _limit(limit) {}
+
+  /// \brief Return the budget, in bytes
+  std::size_t limit() const { return this->_limit; }
+
+  /// \brief Throw a MemoryBudgetError if the budget is exceeded
+  ///
+  /// The free blocks of the pool allocators are returned to the system first
+  /// (see core::trim_pool_allocators()).
+  ///
+  /// \param fun Function being analyzed, for the error message
+  void check(ar::Function* fun) const;
+
+}; // end class MemoryBudget
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -45,10 +45,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <string>
 
 #include <boost/container/flat_map.hpp>
+#include <boost/optional.hpp>
 
 #include <llvm/ADT/DenseMap.h>
 #include <llvm/ADT/StringMap.h>
@@ -64,6 +68,7 @@
 
 #include <ikos/analyzer/analysis/call_context.hpp>
 #include <ikos/analyzer/support/number.hpp>
+#include <ikos/analyzer/util/concurrency.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -94,6 +99,9 @@ protected:
   /// \brief Kind of the MemoryLocation
   MemoryLocationKind _kind;
 
+  /// \brief Dense index, assigned by the MemoryFactory
+  std::uint32_t _index = 0;
+
 protected:
   /// \brief Protected constructor
   explicit MemoryLocation(MemoryLocationKind kind);
@@ -117,9 +125,17 @@ public:
   /// \brief Return the kind of the object
   MemoryLocationKind kind() const { return this->_kind; }
 
+  /// \brief Return the dense index of the memory location
+  ///
+  /// Indexes are allocated sequentially by the MemoryFactory, and are smaller
+  /// than MemoryFactory::size().
+  std::uint32_t index() const { return this->_index; }
+
   /// \brief Dump the memory location, for debugging purpose
   virtual void dump(std::ostream&) const = 0;
 
+  friend class MemoryFactory;
+
 }; // end class MemoryLocation
 
 /// \brief Local memory location
@@ -299,34 +315,78 @@ public:
 }; // end class DynAllocMemoryLocation
 
 /// \brief Management of memory locations
+///
+/// The memory locations are allocated in arenas and never freed before the
+/// factory. Their dense indexes are allocated sequentially.
+///
+/// The factory can be used by several analysis threads at the same time.
 class MemoryFactory {
 private:
-  llvm::DenseMap< ar::LocalVariable*, std::unique_ptr< LocalMemoryLocation > >
+  /// \brief Memory locations of a shard
+  template < typename Map, typename Location >
+  struct Table {
+    /// \brief Map from key to memory location
+    Map map;
+
+    /// \brief Arena of the memory locations, never moved
+    std::deque< Location > arena;
+  };
+
+private:
+  /// \brief Call context factory, to bound the call contexts of dynamic
+  /// allocation sites
+  CallContextFactory& _call_context_factory;
+
+  /// \brief Maximum number of call statements in the call context of a
+  /// dynamic allocation site, or none
+  boost::optional< unsigned > _dyn_alloc_context_depth;
+
+  /// \brief Next dense index
+  std::atomic< std::uint32_t > _next_index;
+
+  ShardedMap<
+      Table< llvm::DenseMap< ar::LocalVariable*, LocalMemoryLocation* >,
+             LocalMemoryLocation > >
       _local_memory_map;
 
-  llvm::DenseMap< ar::GlobalVariable*, std::unique_ptr< GlobalMemoryLocation > >
+  ShardedMap<
+      Table< llvm::DenseMap< ar::GlobalVariable*, GlobalMemoryLocation* >,
+             GlobalMemoryLocation > >
       _global_memory_map;
 
-  llvm::DenseMap< ar::Function*, std::unique_ptr< FunctionMemoryLocation > >
+  ShardedMap< Table< llvm::DenseMap< ar::Function*, FunctionMemoryLocation* >,
+                     FunctionMemoryLocation > >
       _function_memory_map;
 
-  llvm::DenseMap< ar::InternalVariable*,
-                  std::unique_ptr< AggregateMemoryLocation > >
+  ShardedMap<
+      Table< llvm::DenseMap< ar::InternalVariable*, AggregateMemoryLocation* >,
+             AggregateMemoryLocation > >
       _aggregate_memory_map;
 
-  llvm::StringMap< std::unique_ptr< VaArgMemoryLocation > > _va_arg_map;
+  ShardedMap< Table< llvm::StringMap< VaArgMemoryLocation* >,
+                     VaArgMemoryLocation > >
+      _va_arg_map;
 
-  std::unique_ptr< AbsoluteZeroMemoryLocation > _absolute_zero_memory;
+  AbsoluteZeroMemoryLocation _absolute_zero_memory;
 
-  std::unique_ptr< ArgvMemoryLocation > _argv_memory;
+  ArgvMemoryLocation _argv_memory;
 
-  llvm::DenseMap< std::pair< ar::CallBase*, CallContext* >,
-                  std::unique_ptr< DynAllocMemoryLocation > >
+  ShardedMap< Table< llvm::DenseMap< std::pair< ar::CallBase*, CallContext* >,
+                                     DynAllocMemoryLocation* >,
+                     DynAllocMemoryLocation > >
       _dyn_alloc_map;
 
 public:
-  /// \brief Default constructor for factory
-  MemoryFactory();
+  /// \brief Constructor
+  ///
+  /// \param call_context_factory The call context factory
+  /// \param dyn_alloc_context_depth Maximum number of call statements in the
+  ///   call context of a dynamic allocation site, or none for no limit. With
+  ///   0, dynamic allocation sites are only distinguished by their call
+  ///   statement.
+  explicit MemoryFactory(
+      CallContextFactory& call_context_factory,
+      boost::optional< unsigned > dyn_alloc_context_depth = boost::none);
 
   /// \brief Deleted copy constructor
   MemoryFactory(const MemoryFactory&) = delete;
@@ -369,9 +429,26 @@ public:
   ArgvMemoryLocation* get_argv();
 
   /// \brief Get or create a DynAllocMemoryLocation
+  ///
+  /// The call context is truncated to its last call statements, according to
+  /// the dynamic allocation context depth.
   DynAllocMemoryLocation* get_dyn_alloc(ar::CallBase* call,
                                         CallContext* context);
 
+  /// \brief Return the number of memory locations created so far
+  ///
+  /// The dense indexes are smaller than this number.
+  std::size_t size() const { return this->_next_index; }
+
+private:
+  /// \brief Get or create the memory location with the given key in the
+  /// given sharded table
+  template < typename Location,
+             typename ShardedTable,
+             typename Key,
+             typename... Args >
+  Location* get_or_create(ShardedTable& table, const Key& key, Args&&... args);
+
 }; // end class MemoryFactory
 
 } // end namespace analyzer
@@ -382,11 +459,11 @@ namespace core {
 
 /// \brief Implement IndexableTraits for MemoryLocation*
 ///
-/// The index of MemoryLocation* is the address of the pointer
+/// The index of MemoryLocation* is its dense index
 template <>
 struct IndexableTraits< analyzer::MemoryLocation* > {
   static Index index(const analyzer::MemoryLocation* m) {
-    return reinterpret_cast< Index >(m);
+    return static_cast< Index >(m->index());
   }
 };
 
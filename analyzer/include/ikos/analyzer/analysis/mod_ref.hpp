@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Mod/ref analysis: memory locations that functions may write
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/DenseSet.h>
+
+#include <ikos/ar/semantic/function.hpp>
+
+#include <ikos/analyzer/analysis/call_graph.hpp>
+#include <ikos/analyzer/analysis/context.hpp>
+#include <ikos/analyzer/analysis/pointer/value.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Mod/ref analysis
+///
+/// Computes, for each defined function, the memory locations that it or its
+/// callees may write. This is used when a call to an internal function is not
+/// analyzed (e.g, recursive calls, intraprocedural analysis), to forget only
+/// these memory locations instead of the whole memory.
+///
+/// Only the modified locations are computed: the read locations do not matter
+/// to the value analysis. The writes through pointers are resolved using the
+/// pointer analysis, if available. Without it, only the writes to global and
+/// local variables are precise.
+///
+/// It also finds the context-independent functions: functions that only
+/// access their own local variables, do not use their parameters and only
+/// call context-independent functions. Their behavior does not depend on the
+/// caller, so a single analysis can be used for all their calls.
+class ModRefAnalysis {
+private:
+  /// \brief Analysis context
+  Context& _ctx;
+
+  /// \brief Call graph
+  const CallGraph& _call_graph;
+
+  /// \brief Map from a function to the memory locations it may write, or top
+  llvm::DenseMap< ar::Function*, PointsToSet > _modified;
+
+  /// \brief Returned for the functions not in the map
+  PointsToSet _top;
+
+  /// \brief Set of context-independent functions
+  llvm::DenseSet< ar::Function* > _context_independent;
+
+public:
+  /// \brief Constructor
+  ModRefAnalysis(Context& ctx, const CallGraph& call_graph);
+
+  /// \brief Deleted copy constructor
+  ModRefAnalysis(const ModRefAnalysis&) = delete;
+
+  /// \brief Deleted move constructor
+  ModRefAnalysis(ModRefAnalysis&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  ModRefAnalysis& operator=(const ModRefAnalysis&) = delete;
+
+  /// \brief Deleted move assignment operator
+  ModRefAnalysis& operator=(ModRefAnalysis&&) = delete;
+
+  /// \brief Destructor
+  ~ModRefAnalysis();
+
+  /// \brief Compute the modified memory locations of all functions
+  void run();
+
+  /// \brief Return the memory locations that the given function or its
+  /// callees may write, or top if they are unknown
+  const PointsToSet& modified(ar::Function* fun) const;
+
+  /// \brief Return true if the behavior of the given function does not
+  /// depend on its calling context
+  ///
+  /// The function does not read or write the memory of its callers, does not
+  /// use its parameters, cannot throw exceptions, has no cycles and returns a
+  /// scalar, if anything.
+  bool is_context_independent(ar::Function* fun) const {
+    return this->_context_independent.count(fun) != 0;
+  }
+
+private:
+  /// \brief Return the memory locations that the body of the given function
+  /// may write, ignoring its internal callees
+  PointsToSet local_modified(ar::Function* fun) const;
+
+  /// \brief Return true if the body of the given function is
+  /// context-independent, assuming that its callees are
+  bool local_context_independent(ar::Function* fun) const;
+
+  /// \brief Return the memory locations that the given pointer may point to,
+  /// or top
+  PointsToSet points_to(ar::Value* ptr) const;
+
+}; // end class ModRefAnalysis
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -65,7 +65,9 @@ enum class MachineIntDomainOption {
   Interval,
   Congruence,
   IntervalCongruence,
+  IntervalCongruenceKnownBits,
   DBM,
+  SplitDBM,
   VarPackDBM,
   VarPackDBMCongruence,
   Gauge,
@@ -94,8 +96,12 @@ inline const char* machine_int_domain_option_str(MachineIntDomainOption d) {
       return "congruence";
     case MachineIntDomainOption::IntervalCongruence:
       return "interval-congruence";
+    case MachineIntDomainOption::IntervalCongruenceKnownBits:
+      return "interval-congruence-known-bits";
     case MachineIntDomainOption::DBM:
       return "dbm";
+    case MachineIntDomainOption::SplitDBM:
+      return "sdbm";
     case MachineIntDomainOption::VarPackDBM:
       return "var-pack-dbm";
     case MachineIntDomainOption::VarPackDBMCongruence:
@@ -155,6 +161,49 @@ inline bool machine_int_domain_option_has_narrowing(MachineIntDomainOption d) {
   }
 }
 
+/// \brief Return true if the MachineIntDomainOption is a variable packing
+/// domain
+inline bool machine_int_domain_option_is_var_pack(MachineIntDomainOption d) {
+  switch (d) {
+    case MachineIntDomainOption::VarPackDBM:
+    case MachineIntDomainOption::VarPackDBMCongruence:
+    case MachineIntDomainOption::VarPackApronOctagon:
+    case MachineIntDomainOption::VarPackApronPolkaPolyhedra:
+    case MachineIntDomainOption::VarPackApronPolkaLinearEqualities:
+    case MachineIntDomainOption::VarPackApronPplPolyhedra:
+    case MachineIntDomainOption::VarPackApronPplLinearCongruences:
+    case MachineIntDomainOption::VarPackApronPkgridPolyhedraLinearCongruences:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// \brief Return true if the given machine integer domain uses APRON
+///
+/// APRON managers are not thread-safe, so these domains are only used by a
+/// single thread.
+inline bool machine_int_domain_option_is_apron(MachineIntDomainOption d) {
+  switch (d) {
+    case MachineIntDomainOption::ApronInterval:
+    case MachineIntDomainOption::ApronOctagon:
+    case MachineIntDomainOption::ApronPolkaPolyhedra:
+    case MachineIntDomainOption::ApronPolkaLinearEqualities:
+    case MachineIntDomainOption::ApronPplPolyhedra:
+    case MachineIntDomainOption::ApronPplLinearCongruences:
+    case MachineIntDomainOption::ApronPkgridPolyhedraLinearCongruences:
+    case MachineIntDomainOption::VarPackApronOctagon:
+    case MachineIntDomainOption::VarPackApronPolkaPolyhedra:
+    case MachineIntDomainOption::VarPackApronPolkaLinearEqualities:
+    case MachineIntDomainOption::VarPackApronPplPolyhedra:
+    case MachineIntDomainOption::VarPackApronPplLinearCongruences:
+    case MachineIntDomainOption::VarPackApronPkgridPolyhedraLinearCongruences:
+      return true;
+    default:
+      return false;
+  }
+}
+
 /// \brief Represents the precision of an analysis
 enum class Precision {
   /// \brief Only track values in "registers", ie. ar::InternalVariable
@@ -182,13 +231,38 @@ inline const char* precision_str(Precision p) {
   }
 }
 
-/// \brief Either Interprocedural or Intraprocedural
+/// \brief Precision of the offsets in the pointer constraint solver
+enum class PointerOffsetsOption {
+  /// \brief Compute an interval of offsets for each pointer
+  Interval,
+
+  /// \brief Only compute the points-to sets, offsets are top
+  None,
+};
+
+/// \brief Return a string representing a PointerOffsetsOption
+inline const char* pointer_offsets_option_str(PointerOffsetsOption o) {
+  switch (o) {
+    case PointerOffsetsOption::Interval:
+      return "interval";
+    case PointerOffsetsOption::None:
+      return "none";
+    default:
+      ikos_unreachable("unreachable");
+  }
+}
+
+/// \brief Either Interprocedural, Intraprocedural or Summary
 enum class Procedural {
   /// \brief Analyzes function by taking into account other functions
   Interprocedural,
 
   /// \brief Analyze function independently
   Intraprocedural,
+
+  /// \brief Analyze function independently, callees first, using the
+  /// summaries of the callees at call sites
+  Summary,
 };
 
 /// \brief Return a string representing a Procedural
@@ -198,6 +272,8 @@ inline const char* procedural_str(Procedural proc) {
       return "interprocedural";
     case Procedural::Intraprocedural:
       return "intraprocedural";
+    case Procedural::Summary:
+      return "summary";
     default: {
       ikos_unreachable("unreachable");
     }
@@ -229,6 +305,10 @@ enum class GlobalsInitPolicy {
 
   /// \brief Do not initialize any global variable
   None,
+
+  /// \brief Initialize only the global variables used by the code reachable
+  /// from the entry points, or by the initializers of such global variables
+  Lazy,
 };
 
 /// \brief Return a string representing a GlobalsInitPolicy
@@ -242,6 +322,8 @@ inline const char* globals_init_policy_str(GlobalsInitPolicy p) {
       return "skip-strings";
     case GlobalsInitPolicy::None:
       return "none";
+    case GlobalsInitPolicy::Lazy:
+      return "lazy";
     default: {
       ikos_unreachable("unreachable");
     }
@@ -281,9 +363,27 @@ public:
   /// \brief Wether we should use a liveness analysis or not
   bool use_liveness;
 
+  /// \brief Wether the sparse scalars are propagated along their def-use
+  /// chains instead of through the invariants
+  bool use_sparse_scalars;
+
   /// \brief Wether we should use a pointer analysis or not
   bool use_pointer;
 
+  /// \brief Wether we should use a mod/ref analysis or not
+  bool use_mod_ref;
+
+  /// \brief Number of updates of a pointer value using a join in the pointer
+  /// constraint solver, before the widening is applied
+  unsigned pointer_widening_threshold;
+
+  /// \brief Precision of the offsets in the pointer constraint solver
+  PointerOffsetsOption pointer_offsets;
+
+  /// \brief Wether the indirect calls are first resolved using the signatures
+  /// of the address-taken functions
+  bool type_function_pointers;
+
   /// \brief Precision of the analysis
   Precision precision;
 
@@ -302,6 +402,114 @@ public:
   /// \brief Value of argc, or boost::none
   boost::optional< int > argc;
 
+  /// \brief Number of threads used by the value analysis
+  unsigned jobs;
+
+  /// \brief Run the checks during the fixpoint computation, to save memory
+  ///
+  /// Only supported by the intraprocedural value analysis.
+  bool fused_checks;
+
+  /// \brief Number of threads used to analyze the independent components of
+  /// the weak topological order of a function (experimental)
+  ///
+  /// Only supported by the intraprocedural value analysis.
+  unsigned wto_jobs;
+
+  /// \brief Number of threads used to run the checkers of a function in
+  /// parallel, after its fixpoint
+  ///
+  /// Only supported by the interprocedural value analysis.
+  unsigned check_jobs;
+
+  /// \brief Run the checks of a callee and free its fixpoint as soon as the
+  /// fixpoint on its caller is reached, to save memory
+  ///
+  /// Only supported by the interprocedural value analysis.
+  bool stream_checks;
+
+  /// \brief Maximum number of call statements in the call context of a
+  /// callee, or 0 for no limit
+  ///
+  /// Callees with deeper call contexts are analyzed in the context of their
+  /// last call statements, shared by all the call paths ending with them.
+  ///
+  /// Only supported by the interprocedural value analysis.
+  unsigned context_depth;
+
+  /// \brief List of functions analyzed in a single call context, shared by all
+  /// their call sites
+  ///
+  /// Only supported by the interprocedural value analysis.
+  std::vector< ar::Function* > context_merge;
+
+  /// \brief Maximum number of (call context, function) with a cached
+  /// context-sensitive pointer information, or 0 to disable it
+  ///
+  /// Only supported by the interprocedural value analysis.
+  unsigned context_pointer_cache;
+
+  /// \brief Maximum number of call statements in the call context of a
+  /// dynamic allocation site, or none for no limit
+  ///
+  /// With 0, dynamic allocation sites are only distinguished by their call
+  /// statement. Only relevant for the interprocedural value analysis.
+  boost::optional< unsigned > dyn_alloc_context_depth;
+
+  /// \brief Start the iterations on the cycles of a callee from the
+  /// invariants of its previous fixpoint, if the entry invariants are
+  /// comparable
+  ///
+  /// Only supported by the interprocedural value analysis.
+  bool warm_start_cycles;
+
+  /// \brief Maximum number of cells of a memory location before they are
+  /// smashed into a summary cell, or 0 to disable it
+  unsigned smash_threshold;
+
+  /// \brief Maximum number of segments of a summary cell
+  ///
+  /// Elements written at a single index get their own segment, up to this
+  /// number of segments.
+  unsigned array_segments;
+
+  /// \brief Forget the unreachable dynamic allocations at cycle heads
+  ///
+  /// They are always forgotten at function exits.
+  bool gc_loop_heads;
+
+  /// \brief Number of increasing iterations on a cycle performed with a join,
+  /// before the widening is applied
+  unsigned widening_delay;
+
+  /// \brief Maximum number of decreasing iterations (narrowings) on a cycle,
+  /// or 0 to narrow until convergence
+  unsigned narrowing_iterations;
+
+  /// \brief Maximum time of a fixpoint computation on a callee, in seconds,
+  /// or 0 for no limit
+  ///
+  /// Only supported by the interprocedural value analysis.
+  unsigned function_time_budget;
+
+  /// \brief Maximum number of basic block analyses of a fixpoint computation
+  /// on a callee, or 0 for no limit
+  ///
+  /// Only supported by the interprocedural value analysis.
+  unsigned function_iteration_budget;
+
+  /// \brief Maximum number of memory cells of an invariant at a cycle head of
+  /// a callee, or 0 for no limit
+  ///
+  /// Only supported by the interprocedural value analysis.
+  unsigned function_invariant_budget;
+
+  /// \brief Relational domain used to analyze again the functions with
+  /// unproved assertions, or none
+  ///
+  /// Only supported by the intraprocedural value analysis.
+  boost::optional< MachineIntDomainOption > assert_refine_domain;
+
 public:
   /// \brief Save the options in the output database
   void save(SettingsTable&);
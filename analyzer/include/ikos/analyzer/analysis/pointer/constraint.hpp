@@ -47,7 +47,17 @@
 
 #pragma once
 
+#include <functional>
+#include <vector>
+
+#include <ikos/core/domain/exception/exception.hpp>
+#include <ikos/core/domain/lifetime/dummy.hpp>
+#include <ikos/core/domain/machine_int/dummy.hpp>
+#include <ikos/core/domain/memory/dummy.hpp>
+#include <ikos/core/domain/nullity/dummy.hpp>
+#include <ikos/core/domain/pointer/dummy.hpp>
 #include <ikos/core/domain/pointer/solver.hpp>
+#include <ikos/core/domain/uninitialized/dummy.hpp>
 
 #include <ikos/ar/semantic/code.hpp>
 #include <ikos/ar/semantic/data_layout.hpp>
@@ -99,8 +109,14 @@ public:
   /// \brief Add a pointer constraint
   void add(std::unique_ptr< PointerConstraint > cst);
 
-  /// \brief Solve pointer constraints
-  void solve();
+  /// \brief Move the constraints of `other` into this system
+  void merge(PointerConstraints& other);
+
+  /// \brief Move the constraints out of this system, leaving it empty
+  std::vector< std::unique_ptr< PointerConstraint > > release();
+
+  /// \brief Solve pointer constraints, with the solver options of `opts`
+  void solve(const AnalysisOptions& opts);
 
   /// \brief Export results
   void results(PointerInfo&) const;
@@ -110,6 +126,18 @@ public:
 
 }; // end class PointerConstraints
 
+/// \brief Generate the pointer constraints of the given function definitions
+/// using `ctx.opts.jobs` threads
+///
+/// `generate(fun, csts)` is called once per function by a worker thread, with
+/// a system of constraints local to the function. The local systems are then
+/// merged into `csts`, in the order of `functions`.
+void generate_constraints_parallel(
+    Context& ctx,
+    const std::vector< ar::Function* >& functions,
+    PointerConstraints& csts,
+    const std::function< void(ar::Function*, PointerConstraints&) >& generate);
+
 /// \brief Generate points-to constraints for a given ar::Code*
 template < typename CodeInvariants >
 class PointerConstraintsGenerator {
@@ -735,5 +763,52 @@ private:
 
 }; // end class PointerConstraintsGenerator
 
+/// \brief Code invariants without numerical information
+///
+/// This is used to generate pointer constraints without running a numerical
+/// analysis first.
+class EmptyCodeInvariants {
+private:
+  /// \brief Dummy machine integer abstract domain
+  using MachineIntAbstractDomain = core::machine_int::DummyDomain< Variable* >;
+
+  /// \brief Dummy pointer abstract domain
+  using PointerAbstractDomain =
+      core::pointer::DummyDomain< Variable*,
+                                  MemoryLocation*,
+                                  MachineIntAbstractDomain,
+                                  core::nullity::DummyDomain< Variable* > >;
+
+  /// \brief Dummy memory abstract domain
+  using MemoryAbstractDomain = core::memory::DummyDomain<
+      Variable*,
+      MemoryLocation*,
+      VariableFactory,
+      MachineIntAbstractDomain,
+      core::nullity::DummyDomain< Variable* >,
+      PointerAbstractDomain,
+      core::uninitialized::DummyDomain< Variable* >,
+      core::lifetime::DummyDomain< MemoryLocation* > >;
+
+public:
+  /// \brief Dummy abstract domain
+  ///
+  /// This is either top or bottom.
+  using AbstractDomainT =
+      core::exception::ExceptionDomain< MemoryAbstractDomain >;
+
+public:
+  /// \brief Get the invariant at the entry of the given basic block
+  AbstractDomainT entry(ar::BasicBlock* /*bb*/) const {
+    return AbstractDomainT::top();
+  }
+
+  /// \brief Analyze the given statement and update the invariant
+  AbstractDomainT analyze_statement(ar::Statement* /*stmt*/,
+                                    AbstractDomainT inv) const {
+    return inv;
+  }
+};
+
 } // end namespace analyzer
 } // end namespace ikos
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Context-sensitive pointer analysis, computed on demand
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <ikos/ar/semantic/function.hpp>
+#include <ikos/ar/semantic/type.hpp>
+
+#include <ikos/analyzer/analysis/call_context.hpp>
+#include <ikos/analyzer/analysis/context.hpp>
+#include <ikos/analyzer/analysis/pointer/constraint.hpp>
+#include <ikos/analyzer/analysis/pointer/pointer.hpp>
+#include <ikos/analyzer/analysis/pointer/value.hpp>
+#include <ikos/analyzer/analysis/variable.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Context-sensitive pointer analysis, computed on demand
+///
+/// The PointerAnalysis is context-insensitive: the pointer values of the
+/// parameters of a function are merged over all its call sites. This analysis
+/// refines the pointer information of a function for a given call context, by
+/// solving again the local assignments of the function, starting from the
+/// pointer values of the parameters at the entry of the function. Loads,
+/// stores and variables defined in other functions keep their
+/// context-insensitive values.
+///
+/// Results are stored in a bounded cache keyed by (call context, function),
+/// evicting the least recently used entries.
+class ContextSensitivePointerAnalysis {
+public:
+  /// \brief Pointer values of the parameters of a function
+  ///
+  /// Non-pointer parameters have the top value.
+  using Parameters = std::vector< PointerAbsValue >;
+
+private:
+  /// \brief Local assignments of a function
+  struct LocalConstraints {
+    /// \brief Assignment constraints
+    std::vector< std::unique_ptr< PointerConstraint > > assigns;
+
+    /// \brief Variables defined by the assignments
+    std::unordered_set< Variable* > defined;
+  };
+
+  /// \brief Cached pointer information of a function in a call context
+  struct Entry {
+    /// \brief Call context
+    CallContext* context;
+
+    /// \brief Function
+    ar::Function* function;
+
+    /// \brief Pointer values of the parameters
+    Parameters parameters;
+
+    /// \brief Pointer information, or null if not more precise than the
+    /// context-insensitive information
+    std::shared_ptr< const PointerInfo > info;
+  };
+
+  /// \brief List of entries, most recently used first
+  using EntryList = std::list< Entry >;
+
+  /// \brief Map from (call context, function) to entry
+  using EntryMap = llvm::DenseMap< std::pair< CallContext*, ar::Function* >,
+                                   EntryList::iterator >;
+
+  /// \brief Map from function to local assignments
+  using LocalMap =
+      llvm::DenseMap< ar::Function*, std::unique_ptr< LocalConstraints > >;
+
+private:
+  /// \brief Analysis context
+  Context& _ctx;
+
+  /// \brief Context-insensitive pointer analysis
+  const PointerAnalysis& _pointer;
+
+  /// \brief Maximum number of entries
+  std::size_t _capacity;
+
+  /// \brief Local assignments, shared by all the call contexts
+  LocalMap _local;
+
+  /// \brief Cached entries, most recently used first
+  EntryList _entries;
+
+  /// \brief Map from (call context, function) to cached entry
+  EntryMap _map;
+
+  /// \brief Number of cache hits
+  std::size_t _hits = 0;
+
+  /// \brief Number of cache misses
+  std::size_t _misses = 0;
+
+  /// \brief Mutex, for concurrent value analyses of entry points
+  std::mutex _mutex;
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param ctx Analysis context
+  /// \param pointer Context-insensitive pointer analysis
+  /// \param capacity Maximum number of cached (call context, function)
+  ContextSensitivePointerAnalysis(Context& ctx,
+                                  const PointerAnalysis& pointer,
+                                  std::size_t capacity);
+
+  /// \brief Deleted copy constructor
+  ContextSensitivePointerAnalysis(const ContextSensitivePointerAnalysis&) =
+      delete;
+
+  /// \brief Deleted move constructor
+  ContextSensitivePointerAnalysis(ContextSensitivePointerAnalysis&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  ContextSensitivePointerAnalysis& operator=(
+      const ContextSensitivePointerAnalysis&) = delete;
+
+  /// \brief Deleted move assignment operator
+  ContextSensitivePointerAnalysis& operator=(
+      ContextSensitivePointerAnalysis&&) = delete;
+
+  /// \brief Destructor
+  ~ContextSensitivePointerAnalysis();
+
+  /// \brief Return the pointer information of `function` in the call context
+  /// `context`, given the invariant at the entry of the function
+  ///
+  /// Returns null if it is not more precise than the context-insensitive
+  /// information.
+  template < typename AbstractDomain >
+  std::shared_ptr< const PointerInfo > results(CallContext* context,
+                                               ar::Function* function,
+                                               const AbstractDomain& inv) {
+    if (inv.normal().is_bottom()) {
+      return nullptr;
+    }
+
+    const ar::DataLayout& dl = this->_ctx.bundle->data_layout();
+    Parameters parameters;
+    parameters.reserve(function->num_parameters());
+    for (auto it = function->param_begin(), et = function->param_end();
+         it != et;
+         ++it) {
+      if (isa< ar::PointerType >((*it)->type())) {
+        Variable* param = this->_ctx.var_factory->get_internal(*it);
+        parameters.push_back(inv.normal().pointers().get(param));
+      } else {
+        parameters.push_back(
+            PointerAbsValue::top(dl.pointers.bit_width, Unsigned));
+      }
+    }
+    return this->results(context, function, parameters);
+  }
+
+  /// \brief Return the pointer information of `function` in the call context
+  /// `context`, given the pointer values of its parameters
+  ///
+  /// Returns null if it is not more precise than the context-insensitive
+  /// information.
+  std::shared_ptr< const PointerInfo > results(CallContext* context,
+                                               ar::Function* function,
+                                               const Parameters& parameters);
+
+  /// \brief Return the context-insensitive pointer information
+  const PointerInfo& context_insensitive_results() const {
+    return this->_pointer.results();
+  }
+
+  /// \brief Return the number of cache hits
+  std::size_t hits() const { return this->_hits; }
+
+  /// \brief Return the number of cache misses
+  std::size_t misses() const { return this->_misses; }
+
+private:
+  /// \brief Return the local assignments of the given function
+  const LocalConstraints& local_constraints(ar::Function* function);
+
+  /// \brief Compute the pointer information of `function` given the pointer
+  /// values of its parameters
+  std::shared_ptr< const PointerInfo > compute(ar::Function* function,
+                                               const Parameters& parameters);
+
+}; // end class ContextSensitivePointerAnalysis
+
+} // end namespace analyzer
+} // end namespace ikos
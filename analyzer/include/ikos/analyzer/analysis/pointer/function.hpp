@@ -48,6 +48,9 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include <ikos/analyzer/analysis/context.hpp>
 #include <ikos/analyzer/analysis/pointer/value.hpp>
 
@@ -93,6 +96,21 @@ public:
   /// \brief Return the result of the analysis
   const PointerInfo& results() const { return this->_info; }
 
+private:
+  /// \brief Resolve the indirect calls using the signatures of the functions
+  /// whose address is taken
+  ///
+  /// The called pointer of an indirect call matching the signature of a single
+  /// address-taken function is settled in `resolved`. Sets `external` to true
+  /// if the program may receive pointers from external code (external
+  /// functions, external global variables or parameters of the entry points),
+  /// in which case the signatures are not sound on their own.
+  ///
+  /// \returns true if all indirect calls were resolved
+  bool resolve_by_type(
+      std::vector< std::pair< Variable*, PointerAbsValue > >& resolved,
+      bool& external) const;
+
 }; // end class FunctionPointerAnalysis
 
 } // end namespace analyzer
@@ -69,11 +69,16 @@ using MachineIntInterval = core::machine_int::Interval;
 /// \brief Pointer abstraction using a points-to set and an interval
 using PointerAbsValue = core::PointerAbsValue< MemoryLocation* >;
 
+/// \brief Pointer abstraction with a shared points-to set, for storage
+using PackedPointerAbsValue = core::PackedPointerAbsValue< MemoryLocation* >;
+
 /// \brief Hold pointer information
 class PointerInfo {
 private:
   /// \brief Map from variable to pointer value
-  using PointerMap = std::unordered_map< Variable*, PointerAbsValue >;
+  ///
+  /// Values are packed, so that pointers with the same points-to set share it.
+  using PointerMap = std::unordered_map< Variable*, PackedPointerAbsValue >;
 
 private:
   /// \brief Map from variables to pointer abstract values
@@ -82,9 +87,17 @@ private:
   /// \brief Data layout
   const ar::DataLayout& _data_layout;
 
+  /// \brief Information for the variables not in the map, or null
+  const PointerInfo* _parent;
+
 public:
   /// \brief Constructor
-  PointerInfo(const ar::DataLayout& data_layout);
+  ///
+  /// \param data_layout The data layout
+  /// \param parent Information returned for the variables without a value, or
+  /// null to return top
+  explicit PointerInfo(const ar::DataLayout& data_layout,
+                       const PointerInfo* parent = nullptr);
 
   /// \brief Deleted copy constructor
   PointerInfo(const PointerInfo&) = delete;
@@ -110,6 +123,9 @@ public:
   /// \brief Insert an information about a pointer
   void insert(Variable* v, const PointerAbsValue&);
 
+  /// \brief Set the information about a pointer, replacing the previous one
+  void set(Variable* v, const PointerAbsValue&);
+
   /// \brief Dump the pointer constraints, for debugging purpose
   void dump(std::ostream&) const;
 
@@ -0,0 +1,206 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Live progress of the analysis
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ikos/ar/semantic/code.hpp>
+#include <ikos/ar/semantic/function.hpp>
+
+#include <ikos/analyzer/util/timer.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Live progress of the analysis
+///
+/// The fixpoint iterators push a frame when they start analyzing a function,
+/// record the cycle they are iterating on, and pop the frame when they are
+/// done.
+///
+/// A background thread periodically writes a JSON status file with the
+/// current phase, the elapsed time, the resident set size and, for each
+/// analysis thread, the stack of functions being analyzed with the cycle
+/// being iterated and its number of iterations. The file is replaced
+/// atomically, so it can be read at any time.
+class ProgressReporter {
+private:
+  /// \brief A function being analyzed
+  struct Frame {
+    /// \brief Analyzed function
+    ar::Function* function;
+
+    /// \brief Start of the analysis of the function
+    Timer::TimePoint start;
+
+    /// \brief Head of the cycle being iterated, or null
+    ar::BasicBlock* head;
+
+    /// \brief Iteration number on the cycle
+    unsigned iteration;
+
+    /// \brief True during the increasing iterations, false during the
+    /// decreasing iterations
+    bool increasing;
+  };
+
+private:
+  /// \brief Path of the status file
+  std::string _path;
+
+  /// \brief Interval between two writes of the status file
+  std::chrono::milliseconds _interval;
+
+  /// \brief Start of the analysis
+  Timer::TimePoint _start;
+
+  /// \brief Current phase
+  std::string _phase;
+
+  /// \brief Stack of analyzed functions, per thread
+  std::map< std::thread::id, std::vector< Frame > > _stacks;
+
+  /// \brief Protects _phase, _stacks and _stop
+  std::mutex _mutex;
+
+  /// \brief Wakes up the writer thread when stopping
+  std::condition_variable _cv;
+
+  /// \brief True if the writer thread should stop
+  bool _stop = false;
+
+  /// \brief Writer thread
+  std::thread _writer;
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param path Path of the status file
+  /// \param interval Interval between two writes of the status file
+  ProgressReporter(std::string path, std::chrono::milliseconds interval);
+
+  /// \brief Deleted copy constructor
+  ProgressReporter(const ProgressReporter&) = delete;
+
+  /// \brief Deleted move constructor
+  ProgressReporter(ProgressReporter&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  ProgressReporter& operator=(const ProgressReporter&) = delete;
+
+  /// \brief Deleted move assignment operator
+  ProgressReporter& operator=(ProgressReporter&&) = delete;
+
+  /// \brief Destructor
+  ///
+  /// Stops the writer thread and writes the status file a last time.
+  ~ProgressReporter();
+
+  /// \brief Set the current phase of the analysis
+  void set_phase(std::string phase);
+
+  /// \brief Push a frame for `fun` on the stack of the current thread
+  void push(ar::Function* fun);
+
+  /// \brief Pop the last frame of the stack of the current thread
+  void pop();
+
+  /// \brief Record the cycle iterated in the last frame of the current thread
+  void set_cycle(ar::BasicBlock* head, unsigned iteration, bool increasing);
+
+private:
+  /// \brief Body of the writer thread
+  void run();
+
+  /// \brief Write the status file
+  void write();
+
+}; // end class ProgressReporter
+
+/// \brief Push a frame on construction, pop it on destruction
+///
+/// Does nothing if the progress reporter is null.
+class ProgressFrame {
+private:
+  ProgressReporter* _progress;
+
+public:
+  /// \brief Constructor
+  ProgressFrame(ProgressReporter* progress, ar::Function* fun)
+      : _progress(progress) {
+    if (this->_progress != nullptr) {
+      this->_progress->push(fun);
+    }
+  }
+
+  /// \brief Deleted copy constructor
+  ProgressFrame(const ProgressFrame&) = delete;
+
+  /// \brief Deleted move constructor
+  ProgressFrame(ProgressFrame&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  ProgressFrame& operator=(const ProgressFrame&) = delete;
+
+  /// \brief Deleted move assignment operator
+  ProgressFrame& operator=(ProgressFrame&&) = delete;
+
+  /// \brief Destructor
+  ~ProgressFrame() {
+    if (this->_progress != nullptr) {
+      this->_progress->pop();
+    }
+  }
+
+}; // end class ProgressFrame
+
+} // end namespace analyzer
+} // end namespace ikos
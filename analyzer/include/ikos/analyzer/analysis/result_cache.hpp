@@ -0,0 +1,192 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Persistent cache of the checks of functions
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <ikos/ar/semantic/function.hpp>
+
+#include <ikos/analyzer/analysis/context.hpp>
+#include <ikos/analyzer/database/check_sink.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Persistent cache of the checks of functions
+///
+/// The checks of each analyzed function are stored in a directory, in a file
+/// named after a hash of the function body, of the pointer information of its
+/// variables and of the analysis options. A function with the same hash in a
+/// later run reuses the stored checks instead of being analyzed again.
+///
+/// Only used by the intraprocedural analysis, where the checks of a function
+/// do not depend on its callers and callees.
+class ResultCache {
+private:
+  /// \brief A recorded check
+  struct CachedCheck {
+    CheckKind kind;
+    CheckerName checker;
+    Result status;
+
+    /// \brief Index of the statement in the function body
+    std::size_t statement;
+
+    /// \brief Operand numbers in the statement
+    std::vector< std::size_t > operands;
+
+    /// \brief String representation of the info, or empty
+    std::string info;
+  };
+
+  /// \brief Records the checks of a function
+  class Recorder final : public CheckSink {
+  private:
+    /// \brief Map from statement to index in the function body
+    llvm::DenseMap< ar::Statement*, std::size_t > _statements;
+
+    /// \brief Recorded checks
+    std::vector< CachedCheck > _checks;
+
+    /// \brief False if a check cannot be replayed in a later run
+    bool _cacheable = true;
+
+  public:
+    /// \brief Constructor
+    explicit Recorder(ar::Function* fun);
+
+    /// \brief Return true
+    bool is_open() const override { return true; }
+
+    /// \brief Record a check
+    void write(CheckKind kind,
+               CheckerName checker,
+               Result status,
+               ar::Statement* stmt,
+               CallContext* call_context,
+               llvm::ArrayRef< ar::Value* > operands,
+               const JsonDict& info) override;
+
+    /// \brief Do nothing
+    void close() override {}
+
+    /// \brief Return the recorded checks, or null if they cannot be cached
+    const std::vector< CachedCheck >* checks() const {
+      return this->_cacheable ? &this->_checks : nullptr;
+    }
+
+  }; // end class Recorder
+
+private:
+  /// \brief Analysis context
+  Context& _ctx;
+
+  /// \brief Cache directory
+  boost::filesystem::path _directory;
+
+  /// \brief Part of the hashes depending on the analysis options
+  std::string _options_key;
+
+  /// \brief Recorder of the current function, or null
+  std::unique_ptr< Recorder > _recorder;
+
+  /// \brief Number of functions found in the cache
+  std::size_t _hits = 0;
+
+  /// \brief Number of functions not found in the cache
+  std::size_t _misses = 0;
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param ctx Analysis context
+  /// \param directory Cache directory, created if it does not exist
+  ResultCache(Context& ctx, boost::filesystem::path directory);
+
+  /// \brief Deleted copy constructor
+  ResultCache(const ResultCache&) = delete;
+
+  /// \brief Deleted move constructor
+  ResultCache(ResultCache&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  ResultCache& operator=(const ResultCache&) = delete;
+
+  /// \brief Deleted move assignment operator
+  ResultCache& operator=(ResultCache&&) = delete;
+
+  /// \brief Destructor
+  ~ResultCache();
+
+  /// \brief Return the hash of the given function
+  std::string hash(ar::Function* fun) const;
+
+  /// \brief Insert the cached checks of the given function in the output
+  /// database
+  ///
+  /// Returns false if the cache has no entry for the given hash.
+  bool load(ar::Function* fun, const std::string& hash);
+
+  /// \brief Start recording the checks of the given function
+  void start_recording(ar::Function* fun);
+
+  /// \brief Stop recording and store the checks under the given hash
+  void stop_recording(const std::string& hash);
+
+  /// \brief Return the number of functions found in the cache
+  std::size_t hits() const { return this->_hits; }
+
+  /// \brief Return the number of functions not found in the cache
+  std::size_t misses() const { return this->_misses; }
+
+}; // end class ResultCache
+
+} // end namespace analyzer
+} // end namespace ikos
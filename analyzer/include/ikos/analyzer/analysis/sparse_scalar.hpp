@@ -0,0 +1,214 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Sparse scalars: integer variables propagated along def-use chains
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <ikos/core/value/machine_int/interval_congruence.hpp>
+#include <ikos/core/value/uninitialized.hpp>
+
+#include <ikos/ar/semantic/code.hpp>
+
+#include <ikos/analyzer/analysis/context.hpp>
+#include <ikos/analyzer/analysis/variable.hpp>
+#include <ikos/analyzer/support/assert.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Sparse scalar analysis
+///
+/// Finds the integer internal variables whose value can be propagated along
+/// their def-use chains instead of through the invariants of the fixpoint.
+///
+/// A sparse scalar has a single definition, which is not a call, in a basic
+/// block outside of any cycle. Every other basic block using it is strictly
+/// dominated by the defining block. It is never compared, since a comparison
+/// could refine it on a branch, nor returned, nor passed to a call.
+///
+/// The value of such a variable only depends on its definition: the
+/// execution engine records it when leaving the defining block, removes the
+/// variable from the invariant and restores it when entering a block using
+/// it. Thus the invariants at the merge points and cycle heads do not carry
+/// it. The relations with other variables are lost, which can only cost
+/// precision with a relational domain.
+class SparseScalarAnalysis {
+public:
+  /// \brief List of variables
+  using VariableRefList = std::vector< Variable* >;
+
+  /// \brief Sparse scalars of a code
+  struct CodeInfo {
+    /// \brief Map from basic block to the sparse scalars it defines
+    llvm::DenseMap< ar::BasicBlock*, VariableRefList > defined;
+
+    /// \brief Map from basic block to the sparse scalars it uses, defined in
+    /// another basic block
+    llvm::DenseMap< ar::BasicBlock*, VariableRefList > used;
+
+    /// \brief Map from sparse scalar to its dense index in the code
+    llvm::DenseMap< Variable*, unsigned > index;
+  };
+
+private:
+  /// \brief Analysis context
+  Context& _ctx;
+
+  /// \brief Map from code to its sparse scalars, if there is any
+  llvm::DenseMap< ar::Code*, CodeInfo > _codes;
+
+public:
+  /// \brief Constructor
+  explicit SparseScalarAnalysis(Context& ctx);
+
+  /// \brief Deleted copy constructor
+  SparseScalarAnalysis(const SparseScalarAnalysis&) = delete;
+
+  /// \brief Deleted move constructor
+  SparseScalarAnalysis(SparseScalarAnalysis&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  SparseScalarAnalysis& operator=(const SparseScalarAnalysis&) = delete;
+
+  /// \brief Deleted move assignment operator
+  SparseScalarAnalysis& operator=(SparseScalarAnalysis&&) = delete;
+
+  /// \brief Destructor
+  ~SparseScalarAnalysis();
+
+  /// \brief Find the sparse scalars of all functions
+  void run();
+
+  /// \brief Return the sparse scalars of the given code, or null if it has
+  /// none
+  const CodeInfo* code_info(ar::Code* code) const;
+
+private:
+  /// \brief Find the sparse scalars of the given code
+  void run(ar::Code* code);
+
+}; // end class SparseScalarAnalysis
+
+/// \brief Values of the sparse scalars of a code, during a fixpoint
+///
+/// The table is sized once, so that the concurrent fixpoint iterations on
+/// independent components only touch distinct entries.
+class SparseScalarValues {
+public:
+  using IntervalCongruence = core::machine_int::IntervalCongruence;
+  using Uninitialized = core::Uninitialized;
+  using VariableRefList = SparseScalarAnalysis::VariableRefList;
+
+  /// \brief Value of a sparse scalar
+  struct Value {
+    /// \brief Integer value
+    IntervalCongruence integer;
+
+    /// \brief Initialization state
+    Uninitialized uninitialized;
+  };
+
+private:
+  /// \brief Sparse scalars of the code
+  const SparseScalarAnalysis::CodeInfo& _info;
+
+  /// \brief Value of each sparse scalar, by index, or none if its definition
+  /// was not reached yet
+  std::vector< boost::optional< Value > > _values;
+
+public:
+  /// \brief Constructor
+  explicit SparseScalarValues(const SparseScalarAnalysis::CodeInfo& info)
+      : _info(info), _values(info.index.size()) {}
+
+  /// \brief Return the sparse scalars defined in the given basic block, or
+  /// null
+  const VariableRefList* defined_in(ar::BasicBlock* bb) const {
+    auto it = this->_info.defined.find(bb);
+    return it != this->_info.defined.end() ? &it->second : nullptr;
+  }
+
+  /// \brief Return the sparse scalars used in the given basic block and
+  /// defined in another one, or null
+  const VariableRefList* used_in(ar::BasicBlock* bb) const {
+    auto it = this->_info.used.find(bb);
+    return it != this->_info.used.end() ? &it->second : nullptr;
+  }
+
+  /// \brief Return the value of the given sparse scalar, or null if its
+  /// definition was not reached yet
+  const Value* get(Variable* var) const {
+    const boost::optional< Value >& value = this->_values[this->index(var)];
+    return value ? &*value : nullptr;
+  }
+
+  /// \brief Join the value of the given sparse scalar with a new value
+  void join(Variable* var,
+            const IntervalCongruence& integer,
+            const Uninitialized& uninitialized) {
+    boost::optional< Value >& value = this->_values[this->index(var)];
+    if (value) {
+      value->integer.join_with(integer);
+      value->uninitialized.join_with(uninitialized);
+    } else {
+      value = Value{integer, uninitialized};
+    }
+  }
+
+private:
+  /// \brief Return the index of the given sparse scalar
+  unsigned index(Variable* var) const {
+    auto it = this->_info.index.find(var);
+    ikos_assert_msg(it != this->_info.index.end(), "not a sparse scalar");
+    return it->second;
+  }
+
+}; // end class SparseScalarValues
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -0,0 +1,226 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Reuse of the checks of a callee analyzed with the same entry invariant
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <ikos/ar/semantic/function.hpp>
+
+#include <ikos/analyzer/analysis/call_context.hpp>
+#include <ikos/analyzer/analysis/context.hpp>
+#include <ikos/analyzer/analysis/value/abstract_domain.hpp>
+#include <ikos/analyzer/database/check_sink.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+/// \brief Cache of the checks of the callees, for the interprocedural analysis
+///
+/// Records the checks inserted while running the checks of a callee, including
+/// the checks of its own callees. When the same function is checked again in
+/// another calling context with an equal entry invariant, the recorded checks
+/// are inserted again with the new calling context, instead of running the
+/// checkers.
+///
+/// The checks of a callee are not recorded if the info of one of them can
+/// reference memory locations (see checker_info_has_table_references()),
+/// since these can depend on the calling context.
+class CheckReplayCache {
+private:
+  /// \brief A recorded check
+  struct RecordedCheck {
+    CheckKind kind;
+    CheckerName checker;
+    Result status;
+    ar::Statement* stmt;
+    CallContext* call_context;
+    std::vector< ar::Value* > operands;
+    JsonDict info;
+  };
+
+  /// \brief Records the checks inserted in the output database
+  class Recorder final : public CheckSink {
+  private:
+    /// \brief Parent cache
+    CheckReplayCache& _cache;
+
+  public:
+    /// \brief Constructor
+    explicit Recorder(CheckReplayCache& cache) : _cache(cache) {}
+
+    /// \brief Return true
+    bool is_open() const override { return true; }
+
+    /// \brief Record a check, if a callee is being checked
+    void write(CheckKind kind,
+               CheckerName checker,
+               Result status,
+               ar::Statement* stmt,
+               CallContext* call_context,
+               llvm::ArrayRef< ar::Value* > operands,
+               const JsonDict& info) override;
+
+    /// \brief Do nothing
+    void close() override {}
+
+  }; // end class Recorder
+
+  /// \brief Checks of a function in a calling context
+  struct Entry {
+    /// \brief Entry invariant
+    AbstractDomain entry;
+
+    /// \brief Calling context
+    CallContext* call_context;
+
+    /// \brief Range of the checks in the log
+    std::size_t begin;
+    std::size_t end;
+  };
+
+public:
+  /// \brief Maximum number of entries kept per function
+  ///
+  /// Finding an entry compares the entry invariants, so this bounds the cost
+  /// of a lookup.
+  static constexpr std::size_t MaxEntriesPerFunction = 8;
+
+private:
+  /// \brief Analysis context
+  Context& _ctx;
+
+  /// \brief True if the checks can be reused
+  bool _enabled;
+
+  /// \brief Recorder attached to the checks table
+  Recorder _recorder;
+
+  /// \brief Recorded checks, in insertion order
+  std::vector< RecordedCheck > _log;
+
+  /// \brief Number of callees currently being checked
+  std::size_t _depth = 0;
+
+  /// \brief Entries of each function, from the oldest to the newest
+  llvm::DenseMap< ar::Function*, std::vector< Entry > > _entries;
+
+  /// \brief Number of callees whose checks were reused
+  std::size_t _hits = 0;
+
+  /// \brief Number of callees whose checks were computed
+  std::size_t _misses = 0;
+
+public:
+  /// \brief Constructor
+  ///
+  /// The checks are never reused with a context-sensitive pointer analysis,
+  /// since the pointer information then depends on the calling context, nor
+  /// when the checks or invariants are displayed.
+  explicit CheckReplayCache(Context& ctx);
+
+  /// \brief Deleted copy constructor
+  CheckReplayCache(const CheckReplayCache&) = delete;
+
+  /// \brief Deleted move constructor
+  CheckReplayCache(CheckReplayCache&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  CheckReplayCache& operator=(const CheckReplayCache&) = delete;
+
+  /// \brief Deleted move assignment operator
+  CheckReplayCache& operator=(CheckReplayCache&&) = delete;
+
+  /// \brief Destructor
+  ~CheckReplayCache();
+
+  /// \brief Return true if the checks can be reused
+  bool enabled() const { return this->_enabled; }
+
+  /// \brief Insert the checks of the given function for the given calling
+  /// context, if it was already checked with an equal entry invariant
+  ///
+  /// Returns false if no such entry exists.
+  bool replay(ar::Function* fun,
+              CallContext* call_context,
+              const AbstractDomain& entry);
+
+  /// \brief Start recording the checks of the given callee
+  ///
+  /// Returns the position of the first recorded check, for stop_recording().
+  std::size_t start_recording();
+
+  /// \brief Stop recording the checks of the given callee, and keep them
+  void stop_recording(ar::Function* fun,
+                      CallContext* call_context,
+                      AbstractDomain entry,
+                      std::size_t begin);
+
+  /// \brief Return the number of callees whose checks were reused
+  std::size_t hits() const { return this->_hits; }
+
+  /// \brief Return the number of callees whose checks were computed
+  std::size_t misses() const { return this->_misses; }
+
+private:
+  /// \brief Return true if the recorded checks in [begin, end) can be
+  /// inserted for another calling context
+  bool is_replayable(CallContext* call_context,
+                     std::size_t begin,
+                     std::size_t end) const;
+
+  /// \brief Return the calling context `context`, descendant of `from`,
+  /// rebased on `to`
+  CallContext* rebase(CallContext* context,
+                      CallContext* from,
+                      CallContext* to) const;
+
+}; // end class CheckReplayCache
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
@@ -43,18 +43,26 @@
 
 #pragma once
 
+#ifndef IKOS_SINGLE_DOMAIN
 #include <ikos/core/domain/machine_int/polymorphic_domain.hpp>
+#endif
 
 #include <ikos/analyzer/analysis/option.hpp>
 #include <ikos/analyzer/analysis/variable.hpp>
 
+#ifdef IKOS_SINGLE_DOMAIN
+#include <ikos/analyzer/analysis/value/single_machine_int_domain.hpp>
+#endif
+
 namespace ikos {
 namespace analyzer {
 namespace value {
 
+#ifndef IKOS_SINGLE_DOMAIN
 /// \brief Machine integer abstract domain used for the value analysis
 using MachineIntAbstractDomain =
     core::machine_int::PolymorphicDomain< Variable* >;
+#endif
 
 /// \name Constructors of machine integer abstract domains
 /// @{
@@ -62,7 +70,9 @@ using MachineIntAbstractDomain =
 MachineIntAbstractDomain make_top_machine_int_interval();
 MachineIntAbstractDomain make_top_machine_int_congruence();
 MachineIntAbstractDomain make_top_machine_int_interval_congruence();
+MachineIntAbstractDomain make_top_machine_int_interval_congruence_known_bits();
 MachineIntAbstractDomain make_top_machine_int_dbm();
+MachineIntAbstractDomain make_top_machine_int_split_dbm();
 MachineIntAbstractDomain make_top_machine_int_var_pack_dbm();
 MachineIntAbstractDomain make_top_machine_int_var_pack_dbm_congruence();
 MachineIntAbstractDomain make_top_machine_int_gauge();
@@ -96,8 +106,12 @@ inline MachineIntAbstractDomain make_top_machine_int_domain(
       return make_top_machine_int_congruence();
     case MachineIntDomainOption::IntervalCongruence:
       return make_top_machine_int_interval_congruence();
+    case MachineIntDomainOption::IntervalCongruenceKnownBits:
+      return make_top_machine_int_interval_congruence_known_bits();
     case MachineIntDomainOption::DBM:
       return make_top_machine_int_dbm();
+    case MachineIntDomainOption::SplitDBM:
+      return make_top_machine_int_split_dbm();
     case MachineIntDomainOption::VarPackDBM:
       return make_top_machine_int_var_pack_dbm();
     case MachineIntDomainOption::VarPackDBMCongruence:
@@ -0,0 +1,492 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Machine integer abstract domain of a single-domain build
+ *
+ * When ikos is configured with a single machine integer abstract domain
+ * (e.g, -DIKOS_DOMAINS=dbm), the value analysis uses that domain directly
+ * instead of the PolymorphicDomain, so that its operations are not virtual.
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <ikos/analyzer/analysis/variable.hpp>
+#include <ikos/analyzer/support/number.hpp>
+
+#if defined(IKOS_SINGLE_DOMAIN_INTERVAL)
+#include <ikos/core/domain/machine_int/interval.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::IntervalDomain< Variable* >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_CONGRUENCE)
+#include <ikos/core/domain/machine_int/congruence.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::CongruenceDomain< Variable* >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_INTERVAL_CONGRUENCE)
+#include <ikos/core/domain/machine_int/interval_congruence.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::IntervalCongruenceDomain< Variable* >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_INTERVAL_CONGRUENCE_KNOWN_BITS)
+#include <ikos/core/domain/machine_int/interval_congruence_known_bits.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::IntervalCongruenceKnownBitsDomain< Variable* >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_DBM)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/dbm.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::DBM< ZNumber, Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_SDBM)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/split_dbm.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::SplitDBM< ZNumber, Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_VAR_PACK_DBM)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/var_packing_dbm.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::VarPackingDBM< ZNumber, Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_VAR_PACK_DBM_CONGRUENCE)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/var_packing_dbm_congruence.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::VarPackingDBMCongruence< ZNumber,
+                                                Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_GAUGE)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/gauge.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::GaugeDomain< ZNumber, Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_GAUGE_INTERVAL_CONGRUENCE)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/gauge_interval_congruence.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::GaugeIntervalCongruenceDomain< ZNumber,
+                                                      Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_APRON_INTERVAL)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::ApronDomain< core::numeric::apron::Interval,
+                                    ZNumber,
+                                    Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_APRON_OCTAGON)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::ApronDomain< core::numeric::apron::Octagon,
+                                    ZNumber,
+                                    Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_APRON_POLKA_POLYHEDRA)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::ApronDomain< core::numeric::apron::PolkaPolyhedra,
+                                    ZNumber,
+                                    Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_APRON_POLKA_LINEAR_EQUALITIES)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::ApronDomain<
+            core::numeric::apron::PolkaLinearEqualities,
+            ZNumber,
+            Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_APRON_PPL_POLYHEDRA)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::ApronDomain< core::numeric::apron::PplPolyhedra,
+                                    ZNumber,
+                                    Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_APRON_PPL_LINEAR_CONGRUENCES)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::ApronDomain<
+            core::numeric::apron::PplLinearCongruences,
+            ZNumber,
+            Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_APRON_PKGRID_POLYHEDRA_LIN_CONG)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::ApronDomain<
+            core::numeric::apron::PkgridPolyhedraLinCongruences,
+            ZNumber,
+            Variable* > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_VAR_PACK_APRON_OCTAGON)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+#include <ikos/core/domain/numeric/var_packing_domain.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::VarPackingDomain<
+            ZNumber,
+            Variable*,
+            core::numeric::ApronDomain< core::numeric::apron::Octagon,
+                                        ZNumber,
+                                        Variable* > > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_VAR_PACK_APRON_POLKA_POLYHEDRA)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+#include <ikos/core/domain/numeric/var_packing_domain.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::VarPackingDomain<
+            ZNumber,
+            Variable*,
+            core::numeric::ApronDomain< core::numeric::apron::PolkaPolyhedra,
+                                        ZNumber,
+                                        Variable* > > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_VAR_PACK_APRON_POLKA_LINEAR_EQUALITIES)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+#include <ikos/core/domain/numeric/var_packing_domain.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::VarPackingDomain<
+            ZNumber,
+            Variable*,
+            core::numeric::ApronDomain<
+                core::numeric::apron::PolkaLinearEqualities,
+                ZNumber,
+                Variable* > > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_VAR_PACK_APRON_PPL_POLYHEDRA)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+#include <ikos/core/domain/numeric/var_packing_domain.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::VarPackingDomain<
+            ZNumber,
+            Variable*,
+            core::numeric::ApronDomain< core::numeric::apron::PplPolyhedra,
+                                        ZNumber,
+                                        Variable* > > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_VAR_PACK_APRON_PPL_LINEAR_CONGRUENCES)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+#include <ikos/core/domain/numeric/var_packing_domain.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::VarPackingDomain<
+            ZNumber,
+            Variable*,
+            core::numeric::ApronDomain<
+                core::numeric::apron::PplLinearCongruences,
+                ZNumber,
+                Variable* > > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#elif defined(IKOS_SINGLE_DOMAIN_VAR_PACK_APRON_PKGRID_POLYHEDRA_LIN_CONG)
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
+#include <ikos/core/domain/numeric/apron.hpp>
+#include <ikos/core/domain/numeric/var_packing_domain.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+using MachineIntAbstractDomain =
+    core::machine_int::NumericDomainAdapter<
+        Variable*,
+        core::numeric::VarPackingDomain<
+            ZNumber,
+            Variable*,
+            core::numeric::ApronDomain<
+                core::numeric::apron::PkgridPolyhedraLinCongruences,
+                ZNumber,
+                Variable* > > >;
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
+
+#else
+#error "unknown machine integer abstract domain"
+#endif
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Bottom-up value analysis using function summaries
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <ikos/analyzer/analysis/context.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Bottom-up value analysis using function summaries
+///
+/// Functions are analyzed once, with a top entry invariant, callees first.
+/// The exit invariant of each function is kept as a summary, and applied at
+/// the direct calls to that function (see SummaryCallExecutionEngine).
+class SummaryValueAnalysis {
+private:
+  /// \brief Analysis context
+  Context& _ctx;
+
+public:
+  /// \brief Constructor
+  explicit SummaryValueAnalysis(Context& ctx);
+
+  /// \brief Deleted copy constructor
+  SummaryValueAnalysis(const SummaryValueAnalysis&) = delete;
+
+  /// \brief Deleted move constructor
+  SummaryValueAnalysis(SummaryValueAnalysis&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  SummaryValueAnalysis& operator=(const SummaryValueAnalysis&) = delete;
+
+  /// \brief Deleted move assignment operator
+  SummaryValueAnalysis& operator=(SummaryValueAnalysis&&) = delete;
+
+  /// \brief Destructor
+  ~SummaryValueAnalysis();
+
+  /// \brief Run the analysis
+  void run();
+
+}; // end class SummaryValueAnalysis
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -45,19 +45,26 @@
 
 #pragma once
 
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <llvm/ADT/DenseMap.h>
 #include <llvm/ADT/StringMap.h>
 #include <llvm/ADT/StringRef.h>
 
+#include <boost/optional.hpp>
+
 #include <ikos/core/semantic/dumpable.hpp>
 #include <ikos/core/semantic/indexable.hpp>
 #include <ikos/core/semantic/machine_int/variable.hpp>
 #include <ikos/core/semantic/memory/cell.hpp>
 #include <ikos/core/semantic/memory/variable.hpp>
+#include <ikos/core/semantic/numeric/packing.hpp>
 #include <ikos/core/semantic/pointer/variable.hpp>
 #include <ikos/core/semantic/variable.hpp>
 
@@ -68,6 +75,7 @@
 #include <ikos/analyzer/analysis/memory_location.hpp>
 #include <ikos/analyzer/support/cast.hpp>
 #include <ikos/analyzer/support/number.hpp>
+#include <ikos/analyzer/util/concurrency.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -122,13 +130,27 @@ protected:
   /// \brief Type of the variable
   ar::Type* _type;
 
+  /// \brief Unique identifier, allocated consecutively
+  core::Index _id;
+
   /// \brief The offset variable, or nullptr if it is not a pointer
   std::unique_ptr< Variable > _offset_var;
 
+  /// \brief The static pack of the variable, or nullptr
+  ///
+  /// See VariablePackingAnalysis
+  const std::vector< Variable* >* _pack = nullptr;
+
 protected:
-  /// \brief Protected constructor
+  /// \brief Protected constructor, allocating a fresh identifier
   Variable(VariableKind kind, ar::Type* type);
 
+  /// \brief Protected constructor
+  ///
+  /// Variables of the AR (local, global and internal variables) use the dense
+  /// index of the AR variable as identifier, if any (see ar::Value::index()).
+  Variable(VariableKind kind, ar::Type* type, ar::Value* var);
+
 public:
   /// \brief Deleted copy constructor
   Variable(const Variable&) = delete;
@@ -151,6 +173,13 @@ public:
   /// \brief Return the type of the variable
   ar::Type* type() const { return this->_type; }
 
+  /// \brief Return the unique identifier of the variable
+  ///
+  /// The identifiers of the variables of the AR are the dense indexes of the
+  /// AR variables, thus the variables of a function are numbered contiguously.
+  /// Other variables get identifiers allocated consecutively after them.
+  core::Index id() const { return this->_id; }
+
   /// \brief Return the offset variable, or nullptr if it is not a pointer
   Variable* offset_var() const { return this->_offset_var.get(); }
 
@@ -159,6 +188,12 @@ public:
     this->_offset_var = std::move(offset_var);
   }
 
+  /// \brief Return the static pack of the variable, or nullptr
+  const std::vector< Variable* >* pack() const { return this->_pack; }
+
+  /// \brief Set the static pack of the variable
+  void set_pack(const std::vector< Variable* >* pack) { this->_pack = pack; }
+
   /// \brief Dump the variable, for debugging purpose
   virtual void dump(std::ostream&) const = 0;
 
@@ -441,9 +476,11 @@ public:
 }; // end class UnnamedShadowVariable
 
 /// \brief Management of variables
+///
+/// The factory can be used by several analysis threads at the same time.
 class VariableFactory {
 private:
-  /// \brief Hash function for _cell_map
+  /// \brief Hash function for CellTable::wide_map
   struct CellMapKeyHash {
     std::size_t operator()(
         const std::tuple< MemoryLocation*, MachineInt, MachineInt >& k) const {
@@ -455,6 +492,26 @@ private:
     }
   };
 
+  /// \brief Cells of a shard
+  struct CellTable {
+    /// \brief Map from (address, (offset, size)) to cell, for offsets and
+    /// sizes that fit in 64 bits
+    llvm::DenseMap<
+        std::pair< MemoryLocation*, std::pair< uint64_t, uint64_t > >,
+        CellVariable* >
+        map;
+
+    /// \brief Map from (address, offset, size) to cell, for larger offsets
+    /// or sizes
+    std::unordered_map< std::tuple< MemoryLocation*, MachineInt, MachineInt >,
+                        CellVariable*,
+                        CellMapKeyHash >
+        wide_map;
+
+    /// \brief Arena of the cells, never moved
+    std::deque< CellVariable > arena;
+  };
+
 private:
   /// \brief The AR context
   ar::Context& _ar_context;
@@ -464,41 +521,54 @@ private:
   /// This is an unsigned integer with the bit-width of a pointer
   ar::IntegerType* _size_type;
 
-  llvm::DenseMap< ar::LocalVariable*, std::unique_ptr< LocalVariable > >
+  ShardedMap<
+      llvm::DenseMap< ar::LocalVariable*, std::unique_ptr< LocalVariable > > >
       _local_variable_map;
 
-  llvm::DenseMap< ar::GlobalVariable*, std::unique_ptr< GlobalVariable > >
+  ShardedMap<
+      llvm::DenseMap< ar::GlobalVariable*, std::unique_ptr< GlobalVariable > > >
       _global_variable_map;
 
-  llvm::DenseMap< ar::InternalVariable*, std::unique_ptr< InternalVariable > >
+  ShardedMap<
+      llvm::DenseMap< ar::InternalVariable*,
+                      std::unique_ptr< InternalVariable > > >
       _internal_variable_map;
 
-  llvm::DenseMap< ar::InlineAssemblyConstant*,
-                  std::unique_ptr< InlineAssemblyPointerVariable > >
+  ShardedMap<
+      llvm::DenseMap< ar::InlineAssemblyConstant*,
+                      std::unique_ptr< InlineAssemblyPointerVariable > > >
       _inline_asm_pointer_map;
 
-  llvm::DenseMap< ar::Function*, std::unique_ptr< FunctionPointerVariable > >
+  ShardedMap<
+      llvm::DenseMap< ar::Function*,
+                      std::unique_ptr< FunctionPointerVariable > > >
       _function_pointer_map;
 
-  std::unordered_map< std::tuple< MemoryLocation*, MachineInt, MachineInt >,
-                      std::unique_ptr< CellVariable >,
-                      CellMapKeyHash >
-      _cell_map;
+  /// \brief Cells, sharded by base address
+  ShardedMap< CellTable > _cell_map;
 
-  llvm::DenseMap< MemoryLocation*, std::unique_ptr< AllocSizeVariable > >
+  ShardedMap<
+      llvm::DenseMap< MemoryLocation*, std::unique_ptr< AllocSizeVariable > > >
       _alloc_size_map;
 
-  llvm::DenseMap< ar::Function*, std::unique_ptr< ReturnVariable > >
+  ShardedMap<
+      llvm::DenseMap< ar::Function*, std::unique_ptr< ReturnVariable > > >
       _return_variable_map;
 
-  llvm::StringMap< std::unique_ptr< NamedShadowVariable > >
+  ShardedMap< llvm::StringMap< std::unique_ptr< NamedShadowVariable > > >
       _named_shadow_variable_map;
 
+  /// \brief Mutex protecting _unnamed_shadow_variable_vec
+  std::mutex _unnamed_shadow_variable_mutex;
+
   std::vector< std::unique_ptr< UnnamedShadowVariable > >
       _unnamed_shadow_variable_vec;
 
 public:
   /// \brief Constructor
+  ///
+  /// This reserves the identifiers of the variables of the AR, so the dense
+  /// indexes of the AR variables must be assigned (see FrontendInfo).
   explicit VariableFactory(ar::Bundle* bundle);
 
   /// \brief Deleted copy constructor
@@ -540,6 +610,14 @@ public:
                          const MachineInt& offset,
                          const MachineInt& size);
 
+  /// \brief Return the CellVariable with the given parameters if it was
+  /// already created, or nullptr
+  ///
+  /// This never allocates, it is meant for membership tests.
+  CellVariable* lookup_cell(MemoryLocation* address,
+                            const MachineInt& offset,
+                            const MachineInt& size);
+
   /// \brief Get or Create an AllocSizeVariable
   AllocSizeVariable* get_alloc_size(MemoryLocation* address);
 
@@ -562,12 +640,17 @@ namespace core {
 
 /// \brief Implement IndexableTraits for Variable*
 ///
-/// The index of Variable* is the address of the pointer.
+/// The index of Variable* is its unique identifier. Identifiers are small and
+/// dense, which keeps the patricia trees shallow.
 template <>
 struct IndexableTraits< analyzer::Variable* > {
-  static Index index(const analyzer::Variable* v) {
-    return reinterpret_cast< Index >(v);
-  }
+  static Index index(const analyzer::Variable* v) { return v->id(); }
+};
+
+/// \brief Implement DenseIndexableTraits for Variable*
+template <>
+struct DenseIndexableTraits< analyzer::Variable* > {
+  static Index dense_index(const analyzer::Variable* v) { return v->id(); }
 };
 
 /// \brief Implement DumpableTraits for Variable*
@@ -596,6 +679,20 @@ struct VariableTraits< analyzer::Variable* > {
 
 } // end namespace machine_int
 
+namespace numeric {
+
+/// \brief Implement numeric::PackingTraits for Variable*
+template <>
+struct PackingTraits< analyzer::Variable* > {
+  /// \brief Return the static pack of the given variable, or nullptr
+  static const std::vector< analyzer::Variable* >* pack(
+      const analyzer::Variable* v) {
+    return v->pack();
+  }
+};
+
+} // end namespace numeric
+
 namespace pointer {
 
 /// \brief Implement pointer::VariableTraits for Variable*
@@ -677,6 +774,19 @@ struct CellFactoryTraits< analyzer::Variable*,
                                   const MachineInt& size) {
     return vfac.get_cell(base, offset, size);
   }
+
+  /// \brief Return the cell with the given base address, offset and size if
+  /// it exists, or boost::none
+  static boost::optional< analyzer::Variable* > lookup_cell(
+      analyzer::VariableFactory& vfac,
+      analyzer::MemoryLocation* base,
+      const MachineInt& offset,
+      const MachineInt& size) {
+    if (analyzer::CellVariable* c = vfac.lookup_cell(base, offset, size)) {
+      return boost::optional< analyzer::Variable* >(c);
+    }
+    return boost::none;
+  }
 };
 
 } // end namespace memory
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Variable packing pre-analysis
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <ikos/ar/semantic/function.hpp>
+
+#include <ikos/analyzer/analysis/context.hpp>
+#include <ikos/analyzer/analysis/variable.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Variable packing pre-analysis
+///
+/// Groups the integer variables of each function into packs, using the
+/// syntactic relations between them: assignments, conversions, arithmetic
+/// operations and comparisons. This is similar to the octagon packing of
+/// Astrée.
+///
+/// The packs are attached to the variables (see Variable::pack()) and used by
+/// the variable packing abstract domains: a variable is put in the equivalence
+/// class of its pack as soon as it appears, instead of merging equivalence
+/// classes when the relation is created or at join points.
+///
+/// Packs are bounded by MaxPackSize variables.
+class VariablePackingAnalysis {
+public:
+  /// \brief Maximum number of variables in a pack
+  static const std::size_t MaxPackSize = 8;
+
+private:
+  /// \brief Analysis context
+  Context& _ctx;
+
+  /// \brief Packs
+  std::vector< std::unique_ptr< std::vector< Variable* > > > _packs;
+
+public:
+  /// \brief Constructor
+  explicit VariablePackingAnalysis(Context& ctx);
+
+  /// \brief Deleted copy constructor
+  VariablePackingAnalysis(const VariablePackingAnalysis&) = delete;
+
+  /// \brief Deleted move constructor
+  VariablePackingAnalysis(VariablePackingAnalysis&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  VariablePackingAnalysis& operator=(const VariablePackingAnalysis&) = delete;
+
+  /// \brief Deleted move assignment operator
+  VariablePackingAnalysis& operator=(VariablePackingAnalysis&&) = delete;
+
+  /// \brief Destructor
+  ///
+  /// Detaches the packs from the variables.
+  ~VariablePackingAnalysis();
+
+  /// \brief Compute the packs of all functions
+  void run();
+
+  /// \brief Return the number of packs
+  std::size_t num_packs() const { return this->_packs.size(); }
+
+private:
+  /// \brief Compute the packs of the given function
+  void run(ar::Function* fun);
+
+}; // end class VariablePackingAnalysis
+
+} // end namespace analyzer
+} // end namespace ikos
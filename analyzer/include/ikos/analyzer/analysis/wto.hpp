@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Cache of weak topological orders
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <ikos/core/fixpoint/wto.hpp>
+
+#include <ikos/ar/semantic/code.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Cache of weak topological orders
+///
+/// The control flow graphs are not modified by the analyses, thus the weak
+/// topological order (and its nesting) of a given ar::Code is computed once
+/// and shared, read-only, by all the fixpoint iterators on that code.
+class WtoCache {
+public:
+  using WtoT = core::Wto< const ar::CodeGraph* >;
+
+private:
+  /// \brief Map from code to weak topological order
+  llvm::DenseMap< ar::Code*, std::unique_ptr< const WtoT > > _map;
+
+  /// \brief Mutex, used within a concurrent scope
+  std::mutex _mutex;
+
+public:
+  /// \brief Constructor
+  WtoCache() = default;
+
+  /// \brief Deleted copy constructor
+  WtoCache(const WtoCache&) = delete;
+
+  /// \brief Deleted move constructor
+  WtoCache(WtoCache&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  WtoCache& operator=(const WtoCache&) = delete;
+
+  /// \brief Deleted move assignment operator
+  WtoCache& operator=(WtoCache&&) = delete;
+
+  /// \brief Destructor
+  ~WtoCache();
+
+  /// \brief Return the weak topological order of the given code
+  ///
+  /// The weak topological order is computed on the first call.
+  const WtoT& wto(ar::Code* code);
+
+}; // end class WtoCache
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -43,34 +43,67 @@
 
 #pragma once
 
+#include <llvm/ADT/DenseSet.h>
+
 #include <ikos/analyzer/checker/checker.hpp>
 
 namespace ikos {
 namespace analyzer {
 
 /// \brief Assertion prover checker
+///
+/// With -assert-refine-domain, the intraprocedural value analysis checks the
+/// assertions that are not proved with the selected domain again, with a
+/// relational domain on the enclosing function only. The checker defers these
+/// assertions (see take_unproved()), and a second checker created on them
+/// inserts the final results.
 class AssertProverChecker final : public Checker {
+public:
+  /// \brief Set of assertions
+  using AssertSet = llvm::DenseSet< ar::Statement* >;
+
 private:
   using IntInterval = core::machine_int::Interval;
   using PointsToSet = core::PointsToSet< MemoryLocation* >;
   using Nullity = core::Nullity;
   using Uninitialized = core::Uninitialized;
 
+private:
+  /// \brief True if the unproved assertions are deferred
+  bool _defer_unproved;
+
+  /// \brief True if only the assertions in `_unproved` are checked
+  bool _refine;
+
+  /// \brief Unproved assertions, either deferred or to check again
+  AssertSet _unproved;
+
 public:
   /// \brief Constructor
   explicit AssertProverChecker(Context& ctx);
 
+  /// \brief Create a checker for the given unproved assertions only
+  ///
+  /// The assertions that are not checked are inserted as warnings.
+  AssertProverChecker(Context& ctx, AssertSet unproved);
+
   /// \brief Get the checker name
   CheckerName name() const override;
 
   /// \brief Get the checker description
   const char* description() const override;
 
+  /// \brief End the checks for the given function
+  void leave(ar::Function* fun, CallContext* call_context) override;
+
   /// \brief Check a statement
   void check(ar::Statement* stmt,
              const value::AbstractDomain& inv,
              CallContext* call_context) override;
 
+  /// \brief Return and clear the deferred unproved assertions
+  AssertSet take_unproved() { return std::move(this->_unproved); }
+
 private:
   /// \brief Check result
   struct CheckResult {
@@ -43,10 +43,12 @@
 
 #pragma once
 
+#include <map>
 #include <utility>
 
 #include <llvm/ADT/SmallVector.h>
 
+#include <ikos/analyzer/analysis/alloc_size.hpp>
 #include <ikos/analyzer/checker/checker.hpp>
 
 namespace ikos {
@@ -62,6 +64,13 @@ private:
   using IntVariable = core::VariableExpression< MachineInt, Variable* >;
   using IntLinearExpression = core::LinearExpression< MachineInt, Variable* >;
 
+  /// \brief Results of the out-of-bound checks of a memory access, by constant
+  /// allocation size
+  ///
+  /// Memory locations with the same constant allocation size (e.g, nodes
+  /// allocated by the same malloc() call) give the same result.
+  using OutOfBoundCache = std::map< MachineInt, Result >;
+
 private:
   //// \brief The AR context
   ar::Context& _ar_context;
@@ -75,6 +84,9 @@ private:
   /// \brief The integer constant 1
   ar::IntegerConstant* _size_one;
 
+  /// \brief Allocation sizes of the global variables and functions
+  const GlobalAllocSizes* _global_alloc_sizes;
+
 public:
   enum class BufferOverflowCheckKind {
     /// \brief Check for a memory access on a function memory location
@@ -148,11 +160,11 @@ private:
   /// \param stmt The statement
   /// \param pointer The pointer operand
   /// \param access_size The read/written size (in bytes)
-  /// \param inv The invariant
+  /// \param pre The invariant before the statement
   CheckResult check_mem_access(ar::Statement* stmt,
                                ar::Value* pointer,
                                ar::Value* access_size,
-                               value::AbstractDomain inv);
+                               const value::AbstractDomain& pre);
 
   /// \brief Check a memory access (read/write)
   ///
@@ -171,6 +183,7 @@ private:
   /// \param offset_plus_size Shadow variable, = offset + access size
   /// \param offset_intv Offset int interval
   /// \param block_info Json dictionnary for adding extra information
+  /// \param cache Results of the out-of-bound checks, by allocation size
   std::pair< Result, BufferOverflowCheckKind > check_memory_location_access(
       ar::Statement* stmt,
       ar::Value* pointer,
@@ -181,7 +194,20 @@ private:
       Variable* offset_var,
       Variable* offset_plus_size,
       const IntInterval& offset_intv,
-      JsonDict& block_info);
+      JsonDict& block_info,
+      OutOfBoundCache& cache);
+
+  /// \brief Check `offset <= size && offset + access_size <= size`
+  ///
+  /// The size is `global_size` if it is not null, otherwise `size_var`.
+  ///
+  /// \returns Ok if it always holds, Error if it never holds, otherwise
+  /// Warning
+  Result check_out_of_bound(const value::AbstractDomain& inv,
+                            AllocSizeVariable* size_var,
+                            const MachineInt* global_size,
+                            Variable* offset_var,
+                            Variable* offset_plus_size) const;
 
   /// \brief Check a string copy for overflow
   ///
@@ -206,11 +232,11 @@ private:
   /// \param stmt The statement
   /// \param dest_op The destination pointer operand
   /// \param src_op The source pointer operand
-  /// \param inv The invariant
+  /// \param pre The invariant before the statement
   CheckResult check_strcpy(ar::Statement* stmt,
                            ar::Value* dest_op,
                            ar::Value* src_op,
-                           value::AbstractDomain inv);
+                           const value::AbstractDomain& pre);
 
   /// \brief Return the store size for the given type, as an integer constant
   ar::IntegerConstant* store_size(ar::Type*);
@@ -218,10 +244,15 @@ private:
   /// \brief Initialize global variable pointers and function pointers
   void init_global_ptr(ar::Value* value, value::AbstractDomain& inv);
 
-  /// \brief Initialize global variable sizes and function sizes
-  void init_global_alloc_size(MemoryLocation* addr,
-                              AllocSizeVariable* size_var,
-                              value::AbstractDomain& inv);
+  /// \brief Return true if the given pointer is initialized by
+  /// init_global_ptr()
+  static bool is_global_ptr(ar::Value* value);
+
+  /// \brief Return the allocation size of a global variable or a function,
+  /// or null for any other memory location
+  const MachineInt* global_alloc_size(MemoryLocation* addr) const {
+    return this->_global_alloc_sizes->get(addr);
+  }
 
   /// \brief Check whether a memory access is an array access
   ///
@@ -43,6 +43,8 @@
 
 #pragma once
 
+#include <bitset>
+#include <initializer_list>
 #include <memory>
 
 #include <ikos/ar/semantic/statement.hpp>
@@ -52,11 +54,28 @@
 #include <ikos/analyzer/analysis/literal.hpp>
 #include <ikos/analyzer/analysis/value/abstract_domain.hpp>
 #include <ikos/analyzer/checker/name.hpp>
+#include <ikos/analyzer/checker/query_cache.hpp>
 #include <ikos/analyzer/database/output.hpp>
 
 namespace ikos {
 namespace analyzer {
 
+/// \brief Number of kinds of statements
+constexpr std::size_t NumStatementKinds = ar::Statement::ResumeKind + 1;
+
+/// \brief Set of kinds of statements
+using StatementKinds = std::bitset< NumStatementKinds >;
+
+/// \brief Return the set of the given kinds of statements
+inline StatementKinds statement_kinds(
+    std::initializer_list< ar::Statement::StatementKind > kinds) {
+  StatementKinds set;
+  for (ar::Statement::StatementKind kind : kinds) {
+    set.set(kind);
+  }
+  return set;
+}
+
 /// \brief Base class for property checkers
 class Checker {
 protected:
@@ -75,14 +94,24 @@ protected:
   /// \brief Option to display the checks
   DisplayOption _display_checks;
 
+private:
+  /// \brief Kinds of statements inspected by check()
+  StatementKinds _statement_kinds;
+
 protected:
   /// \brief Constructor
-  explicit Checker(Context& ctx)
+  ///
+  /// \param ctx Analysis context
+  /// \param kinds Kinds of statements inspected by check(). The analyses do
+  /// not call check() on the other statements.
+  explicit Checker(Context& ctx,
+                   StatementKinds kinds = StatementKinds().set())
       : _ctx(ctx),
         _lit_factory(*ctx.lit_factory),
         _checks(ctx.output_db->checks),
         _display_invariants(ctx.opts.display_invariants),
-        _display_checks(ctx.opts.display_checks) {}
+        _display_checks(ctx.opts.display_checks),
+        _statement_kinds(kinds) {}
 
 public:
   /// \brief Deleted copy constructor
@@ -112,6 +141,11 @@ public:
   /// \brief Get the checker description
   virtual const char* description() const = 0;
 
+  /// \brief Return true if check() inspects the given statement
+  bool inspects(ar::Statement* stmt) const {
+    return this->_statement_kinds.test(stmt->kind());
+  }
+
   /// \brief Start the checks for the given function
   virtual void enter(ar::Function*, CallContext*) {}
 
@@ -128,7 +162,12 @@ public:
                      const value::AbstractDomain&,
                      CallContext*) {}
 
+  /// \brief End the checks, once all the functions are checked
+  virtual void finish() {}
+
   /// \brief Check a statement
+  ///
+  /// Only called on the statements inspected by the checker.
   virtual void check(ar::Statement* stmt,
                      const value::AbstractDomain& inv,
                      CallContext* call_context) = 0;
@@ -189,6 +228,34 @@ protected:
   /// \brief Display a check result
   void display_result(Result result) const;
 
+protected:
+  // Helpers to insert the operands of checks in the output database
+  //
+  // These are safe to call while checkers run in parallel.
+
+  /// \brief Insert a memory location and return its id
+  sqlite::DbInt64 memory_location_id(MemoryLocation* mem_loc);
+
+  /// \brief Insert a function and return its id
+  sqlite::DbInt64 function_id(ar::Function* fun);
+
+protected:
+  // Helpers to query the invariant before a statement
+  //
+  // The results are shared with the other checkers of the statement, through
+  // the StatementQueryCache of the current thread, if it is bound to `inv`.
+
+  /// \brief Return the uninitialized value of `var` in `inv`
+  static core::Uninitialized uninitialized(const value::AbstractDomain& inv,
+                                           Variable* var);
+
+  /// \brief Return the nullity value of `ptr` in `inv`
+  static core::Nullity nullity(const value::AbstractDomain& inv, Variable* ptr);
+
+  /// \brief Return the points-to set of `ptr` in `inv`
+  static StatementQueryCache::PointsToSet points_to(
+      const value::AbstractDomain& inv, Variable* ptr);
+
 }; // end class Checker
 
 /// \brief Create a checker, given its name
@@ -43,16 +43,30 @@
 
 #pragma once
 
+#include <vector>
+
+#include <llvm/ADT/DenseSet.h>
+
 #include <ikos/analyzer/checker/checker.hpp>
 
 namespace ikos {
 namespace analyzer {
 
 /// \brief Dead code checker
+///
+/// Reachability is a property of basic blocks: the checker only looks at the
+/// invariants at the entry of the basic blocks, and reports one check per
+/// maximal region of connected unreachable basic blocks, on its first
+/// statement with debug information. It does not inspect any statement.
 class DeadCodeChecker final : public Checker {
 private:
-  /// \brief Previous statement in the basic block
-  ar::Statement* _prev_stmt = nullptr;
+  using BasicBlockSet = llvm::DenseSet< ar::BasicBlock* >;
+
+private:
+  /// \brief Unreachable basic blocks of the functions being checked
+  ///
+  /// Checks can be nested (e.g, with inlining), the innermost function is last.
+  std::vector< BasicBlockSet > _dead_blocks;
 
 public:
   /// \brief Constructor
@@ -64,12 +78,20 @@ public:
   /// \brief Get the checker description
   const char* description() const override;
 
+  /// \brief Start the checks for the given function
+  void enter(ar::Function* fun, CallContext* call_context) override;
+
+  /// \brief End the checks for the given function
+  void leave(ar::Function* fun, CallContext* call_context) override;
+
   /// \brief Start the checks for the given basic block
   void enter(ar::BasicBlock* bb,
              const value::AbstractDomain& inv,
              CallContext* call_context) override;
 
   /// \brief Check a statement
+  ///
+  /// Never called, the checker does not inspect any statement.
   void check(ar::Statement* stmt,
              const value::AbstractDomain& inv,
              CallContext* call_context) override;
@@ -78,9 +100,9 @@ private:
   /// \brief Return true if we need to skip the check for the given statement
   static bool skip_check(ar::Statement* stmt);
 
-  /// \brief Return true if we need a check for the current statement,
-  /// given the previous statement (or null) and the current basic block
-  static bool needs_check(ar::Statement* prev_stmt, ar::BasicBlock* bb);
+  /// \brief Return the first statement of the given basic block that can be
+  /// reported, or null
+  static ar::Statement* first_checked_statement(ar::BasicBlock* bb);
 
   /// \brief Dispay a dead code check, if requested
   void display_dead_code_check(Result result, ar::Statement* stmt) const;
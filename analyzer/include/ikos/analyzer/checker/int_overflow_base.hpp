@@ -43,6 +43,10 @@
 
 #pragma once
 
+#include <cstddef>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/DenseSet.h>
 #include <llvm/ADT/SmallVector.h>
 
 #include <ikos/analyzer/checker/checker.hpp>
@@ -51,16 +55,37 @@ namespace ikos {
 namespace analyzer {
 
 /// \brief Base for integer overflow checker
+///
+/// Before querying the invariant, the checker looks at the ranges of the
+/// operands known from the AR: constants, and variables only defined by
+/// extensions, masks, remainders or shifts by a constant. An operation that
+/// cannot overflow on these ranges is safe, whatever the invariant is.
 class IntOverflowCheckerBase : public Checker {
 private:
   using IntInterval = core::machine_int::Interval;
   using ZInterval = core::numeric::Interval< ZNumber >;
   using ZBound = core::Bound< ZNumber >;
 
+private:
+  /// \brief Ranges of the variables known from their definitions
+  llvm::DenseMap< ar::InternalVariable*, ZInterval > _static_ranges;
+
+  /// \brief Functions whose variables are in `_static_ranges`
+  llvm::DenseSet< ar::Function* > _ranged_functions;
+
+  /// \brief Number of statements proved safe without querying the invariant
+  std::size_t _num_static_safe = 0;
+
 public:
   /// \brief Constructor
   explicit IntOverflowCheckerBase(Context& ctx);
 
+  /// \brief Start the checks for the given function
+  void enter(ar::Function* fun, CallContext* call_context) override;
+
+  /// \brief End the checks of the whole program
+  void finish() override;
+
 protected:
   /// \brief Check an integer overflow and insert the checks in the database
   void check_integer_overflow(ar::BinaryOperation* stmt,
@@ -80,6 +105,13 @@ private:
   llvm::SmallVector< CheckResult, 2 > check_integer_overflow(
       ar::BinaryOperation* stmt, const value::AbstractDomain& inv);
 
+  /// \brief Return the range of the given operand known from the AR, or top
+  ZInterval static_range(ar::Value* value) const;
+
+  /// \brief Return true if the operation cannot overflow on the ranges of its
+  /// operands known from the AR
+  bool is_statically_safe(ar::BinaryOperation* stmt) const;
+
 private:
   /// \brief Display info about the check
   bool display_int_overflow_check(Result result,
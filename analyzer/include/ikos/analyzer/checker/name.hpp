@@ -145,5 +145,23 @@ inline const char* checker_short_name(CheckerName checker) {
   }
 }
 
+/// \brief Return true if the info of a check from the given checker can
+/// reference rows of other tables of the output database
+///
+/// These ids are only valid for the current run, and can refer to memory
+/// locations of a specific calling context.
+inline bool checker_info_has_table_references(CheckerName checker) {
+  switch (checker) {
+    case CheckerName::BufferOverflow:
+    case CheckerName::DoubleFree:
+    case CheckerName::FunctionCall:
+    case CheckerName::PointerCompare:
+    case CheckerName::UnalignedPointer:
+      return true;
+    default:
+      return false;
+  }
+}
+
 } // end namespace analyzer
 } // end namespace ikos
@@ -0,0 +1,180 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Cache of the queries of the checkers on a statement
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <ikos/core/value/nullity.hpp>
+#include <ikos/core/value/pointer/points_to_set.hpp>
+#include <ikos/core/value/uninitialized.hpp>
+
+#include <ikos/analyzer/analysis/memory_location.hpp>
+#include <ikos/analyzer/analysis/value/abstract_domain.hpp>
+#include <ikos/analyzer/analysis/variable.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Cache of the queries of the checkers on a statement
+///
+/// Several checkers query the same facts on the same operands of a statement,
+/// e.g, the buffer overflow, null dereference, pointer alignment and double
+/// free checkers all query the nullity and the points-to set of the
+/// dereferenced pointer. The cache is bound to the invariant before the
+/// statement, and computes each fact once, on the first query.
+///
+/// The cache is safe to query from several threads, within a ConcurrentScope.
+class StatementQueryCache {
+public:
+  using PointsToSet = core::PointsToSet< MemoryLocation* >;
+
+private:
+  /// \brief Cached facts of a variable
+  struct Entry {
+    Variable* var;
+    boost::optional< core::Uninitialized > uninitialized;
+    boost::optional< core::Nullity > nullity;
+    boost::optional< PointsToSet > points_to;
+  };
+
+private:
+  /// \brief Invariant before the statement, or null
+  const value::AbstractDomain* _inv = nullptr;
+
+  /// \brief Cached facts, per variable
+  std::vector< Entry > _entries;
+
+  /// \brief Mutex, locked within a ConcurrentScope
+  std::mutex _mutex;
+
+  /// \brief Cache used by the checkers of the current thread, or null
+  static thread_local StatementQueryCache* ThreadCache;
+
+public:
+  /// \brief Constructor
+  StatementQueryCache() = default;
+
+  /// \brief Deleted copy constructor
+  StatementQueryCache(const StatementQueryCache&) = delete;
+
+  /// \brief Deleted move constructor
+  StatementQueryCache(StatementQueryCache&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  StatementQueryCache& operator=(const StatementQueryCache&) = delete;
+
+  /// \brief Deleted move assignment operator
+  StatementQueryCache& operator=(StatementQueryCache&&) = delete;
+
+  /// \brief Destructor
+  ~StatementQueryCache() = default;
+
+  /// \brief Bind the cache to the given invariant, dropping the cached facts
+  ///
+  /// The invariant must outlive the queries.
+  void bind(const value::AbstractDomain& inv);
+
+  /// \brief Return true if the cache is bound to the given invariant
+  bool is_bound_to(const value::AbstractDomain& inv) const {
+    return this->_inv == &inv;
+  }
+
+  /// \brief Return the uninitialized value of the given variable
+  core::Uninitialized uninitialized(Variable* var);
+
+  /// \brief Return the nullity value of the given pointer variable
+  core::Nullity nullity(Variable* ptr);
+
+  /// \brief Return the points-to set of the given pointer variable
+  PointsToSet points_to(Variable* ptr);
+
+  /// \brief Return the cache used by the checkers of the current thread
+  static StatementQueryCache* thread_cache() { return ThreadCache; }
+
+private:
+  /// \brief Return the entry of the given variable, creating it if needed
+  ///
+  /// The mutex must be held.
+  Entry& entry(Variable* var);
+
+  friend class StatementQueryScope;
+
+}; // end class StatementQueryCache
+
+/// \brief Use the given cache for the checkers of the current thread, until
+/// the end of the scope
+class StatementQueryScope {
+private:
+  /// \brief Previous cache of the current thread
+  StatementQueryCache* _previous;
+
+public:
+  /// \brief Constructor
+  explicit StatementQueryScope(StatementQueryCache* cache)
+      : _previous(StatementQueryCache::ThreadCache) {
+    StatementQueryCache::ThreadCache = cache;
+  }
+
+  /// \brief Deleted copy constructor
+  StatementQueryScope(const StatementQueryScope&) = delete;
+
+  /// \brief Deleted move constructor
+  StatementQueryScope(StatementQueryScope&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  StatementQueryScope& operator=(const StatementQueryScope&) = delete;
+
+  /// \brief Deleted move assignment operator
+  StatementQueryScope& operator=(StatementQueryScope&&) = delete;
+
+  /// \brief Destructor
+  ~StatementQueryScope() { StatementQueryCache::ThreadCache = this->_previous; }
+
+}; // end class StatementQueryScope
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Streaming output of the checks
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <fstream>
+#include <string>
+
+#include <llvm/ADT/ArrayRef.h>
+
+#include <ikos/ar/semantic/statement.hpp>
+
+#include <ikos/analyzer/analysis/call_context.hpp>
+#include <ikos/analyzer/analysis/result.hpp>
+#include <ikos/analyzer/checker/kind.hpp>
+#include <ikos/analyzer/checker/name.hpp>
+#include <ikos/analyzer/json/json.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Base class for streaming outputs of the checks
+///
+/// When a sink is attached to the output database, the checks are written to
+/// the sink as soon as they are produced instead of being inserted in the
+/// relational tables. Only the checks that are not `ok` are written.
+class CheckSink {
+public:
+  /// \brief Constructor
+  CheckSink() = default;
+
+  /// \brief Deleted copy constructor
+  CheckSink(const CheckSink&) = delete;
+
+  /// \brief Deleted move constructor
+  CheckSink(CheckSink&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  CheckSink& operator=(const CheckSink&) = delete;
+
+  /// \brief Deleted move assignment operator
+  CheckSink& operator=(CheckSink&&) = delete;
+
+  /// \brief Return true if the output is ready to be written
+  virtual bool is_open() const = 0;
+
+  /// \brief Write a check
+  virtual void write(CheckKind kind,
+                     CheckerName checker,
+                     Result status,
+                     ar::Statement* stmt,
+                     CallContext* call_context,
+                     llvm::ArrayRef< ar::Value* > operands,
+                     const JsonDict& info) = 0;
+
+  /// \brief Write the trailing data and flush the output
+  ///
+  /// This should be called once the analysis is done.
+  virtual void close() = 0;
+
+  /// \brief Destructor
+  virtual ~CheckSink();
+
+}; // end class CheckSink
+
+/// \brief Write the checks as newline-delimited JSON
+///
+/// Each line is a JSON object describing one check.
+class JsonLinesCheckSink final : public CheckSink {
+private:
+  /// \brief Output file
+  std::ofstream _out;
+
+  /// \brief True to flush the output after each check
+  bool _flush;
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param path Output file path
+  /// \param flush Flush the output after each check, for a reader consuming
+  /// the checks while they are written
+  explicit JsonLinesCheckSink(const std::string& path, bool flush = false);
+
+  /// \brief Return true if the output file was successfully opened
+  bool is_open() const override { return this->_out.is_open(); }
+
+  /// \brief Write a check
+  void write(CheckKind kind,
+             CheckerName checker,
+             Result status,
+             ar::Statement* stmt,
+             CallContext* call_context,
+             llvm::ArrayRef< ar::Value* > operands,
+             const JsonDict& info) override;
+
+  /// \brief Flush the output
+  void close() override;
+
+}; // end class JsonLinesCheckSink
+
+/// \brief Write the checks as a SARIF 2.1.0 log
+///
+/// The results are written as they are produced, the enclosing document is
+/// completed by close().
+class SarifCheckSink final : public CheckSink {
+private:
+  /// \brief Output file
+  std::ofstream _out;
+
+  /// \brief True if no result was written yet
+  bool _first = true;
+
+  /// \brief True if close() was called
+  bool _closed = false;
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param path Output file path
+  explicit SarifCheckSink(const std::string& path);
+
+  /// \brief Return true if the output file was successfully opened
+  bool is_open() const override { return this->_out.is_open(); }
+
+  /// \brief Write a check
+  void write(CheckKind kind,
+             CheckerName checker,
+             Result status,
+             ar::Statement* stmt,
+             CallContext* call_context,
+             llvm::ArrayRef< ar::Value* > operands,
+             const JsonDict& info) override;
+
+  /// \brief Complete the document and flush the output
+  void close() override;
+
+  /// \brief Destructor
+  ~SarifCheckSink() override;
+
+}; // end class SarifCheckSink
+
+} // end namespace analyzer
+} // end namespace ikos
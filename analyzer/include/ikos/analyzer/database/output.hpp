@@ -43,13 +43,20 @@
 
 #pragma once
 
+#include <mutex>
+
+#include <ikos/analyzer/database/check_sink.hpp>
 #include <ikos/analyzer/database/sqlite.hpp>
 #include <ikos/analyzer/database/table/call_contexts.hpp>
+#include <ikos/analyzer/database/table/check_counters.hpp>
 #include <ikos/analyzer/database/table/checks.hpp>
+#include <ikos/analyzer/database/table/compression_dictionaries.hpp>
+#include <ikos/analyzer/database/table/downgrades.hpp>
 #include <ikos/analyzer/database/table/files.hpp>
 #include <ikos/analyzer/database/table/functions.hpp>
 #include <ikos/analyzer/database/table/memory_locations.hpp>
 #include <ikos/analyzer/database/table/operands.hpp>
+#include <ikos/analyzer/database/table/profile.hpp>
 #include <ikos/analyzer/database/table/settings.hpp>
 #include <ikos/analyzer/database/table/statements.hpp>
 #include <ikos/analyzer/database/table/times.hpp>
@@ -66,14 +73,52 @@ public:
   FilesTable files;
   FunctionsTable functions;
   StatementsTable statements;
+  CompressionDictionariesTable compression_dictionaries;
   OperandsTable operands;
   CallContextsTable call_contexts;
   MemoryLocationsTable memory_locations;
+  CheckCountersTable check_counters;
   ChecksTable checks;
+  ProfileTable profile;
+  DowngradesTable downgrades;
+
+  /// \brief Mutex for the tables written by the checkers, when they run in
+  /// parallel (see Checker::memory_location_id())
+  std::mutex checkers_mutex;
+
+private:
+  /// \brief Streaming output of the checks, or null
+  CheckSink* _sink;
 
 public:
   /// \brief Constructor
-  explicit OutputDatabase(sqlite::DbConnection& db_);
+  ///
+  /// \param db_ The database connection
+  /// \param sink If not null, the checks are streamed to the sink instead of
+  /// being stored in the database
+  /// \param compact_checks If true, only store the checks that are not `ok`
+  /// and count the others in the check counters table
+  /// \param aggregate_checks If true, store identical checks found in several
+  /// calling contexts in one row
+  /// \param compress_columns If true, compress the bulky text columns (see
+  /// CompressionDictionariesTable)
+  explicit OutputDatabase(sqlite::DbConnection& db_,
+                          CheckSink* sink = nullptr,
+                          bool compact_checks = false,
+                          bool aggregate_checks = false,
+                          bool compress_columns = false);
+
+  /// \brief Write the buffered rows and create the indexes of all tables
+  ///
+  /// The indexes are only created here, once all the rows are inserted, and
+  /// SQLite sorts their entries using up to `jobs` threads.
+  ///
+  /// This also closes the check sink, if any.
+  ///
+  /// This should be called once the analysis is done. It only uses the
+  /// database connection, so it can run on another thread while the analyzer
+  /// does something else.
+  void finalize(unsigned jobs = 1);
 
 }; // end class OutputDatabase
 
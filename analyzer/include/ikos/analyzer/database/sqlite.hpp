@@ -47,6 +47,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <sqlite3.h>
 
@@ -126,6 +127,15 @@ using DbInt64 = sqlite3_int64;
 /// \brief Double type for SQLite
 using DbDouble = double;
 
+/// \brief Binary data for SQLite
+///
+/// The data is not owned, it must stay alive until it is inserted.
+struct DbBlob {
+  StringRef data;
+
+  explicit DbBlob(StringRef data_) : data(data_) {}
+};
+
 /// \brief Column type
 enum class DbColumnType { Text, Integer, Real, Blob };
 
@@ -148,10 +158,13 @@ enum class CommitPolicy {
   Auto = 1,
 };
 
+class DbOstream;
+
 /// \brief SQLite connection
 class DbConnection {
 public:
-  /// \brief Maximum number of rows per transaction, in CommitPolicy::Auto
+  /// \brief Default maximum number of rows per transaction, in
+  /// CommitPolicy::Auto
   static const int MaxRowsPerTransaction = 8192;
 
 private:
@@ -167,6 +180,12 @@ private:
   /// \brief Number of inserted rows, in CommitPolicy::Auto
   std::size_t _inserted_rows = 0;
 
+  /// \brief Maximum number of rows per transaction, in CommitPolicy::Auto
+  std::size_t _max_rows_per_transaction = MaxRowsPerTransaction;
+
+  /// \brief Open output streams
+  std::vector< DbOstream* > _streams;
+
 public:
   /// \brief Deleted default constructor
   DbConnection() = delete;
@@ -213,9 +232,20 @@ public:
   /// \brief Return the current commit policy
   CommitPolicy commit_policy() const { return this->_commit_policy; }
 
+  /// \brief Set the maximum number of rows per transaction, in
+  /// CommitPolicy::Auto
+  void set_max_rows_per_transaction(std::size_t n);
+
+  /// \brief Write the rows buffered by the output streams
+  void flush();
+
+  /// \brief Write the buffered rows and commit the current transaction, in
+  /// CommitPolicy::Auto
+  void commit();
+
 private:
-  /// \brief Called upon a row insertion
-  void row_inserted();
+  /// \brief Called upon the insertion of `n` rows
+  void rows_inserted(std::size_t n);
 
 public:
   /// \brief Remove a table
@@ -231,8 +261,9 @@ public:
       StringRef name,
       llvm::ArrayRef< std::pair< StringRef, DbColumnType > > columns);
 
-  /// \brief Create an index on the given column of the given table
-  void create_index(StringRef index, StringRef table, StringRef column);
+  /// \brief Create an index on the given comma-separated list of columns of
+  /// the given table
+  void create_index(StringRef index, StringRef table, StringRef columns);
 
   /// \brief Set the journal mode
   void set_journal_mode(JournalMode mode);
@@ -240,6 +271,24 @@ public:
   /// \brief Set the synchronous flag
   void set_synchronous_flag(SynchronousFlag flag);
 
+  /// \brief Set the page size, in bytes
+  ///
+  /// This only has an effect on a new database.
+  void set_page_size(int bytes);
+
+  /// \brief Set the maximum size of the page cache, in KiB
+  void set_cache_size(int kib);
+
+  /// \brief Set the maximum number of auxiliary threads used by a statement,
+  /// e.g, to sort the rows when creating an index
+  void set_threads(int n);
+
+  /// \brief Copy the whole database into the given file
+  ///
+  /// This uses the SQLite online backup API. The previous content of the file
+  /// is replaced.
+  void save(const std::string& filename);
+
   // friends
   friend class DbOstream;
   friend class DbIstream;
@@ -247,20 +296,57 @@ public:
 }; // end class DbConnection
 
 /// \brief Stream-based interface for populating tables
+///
+/// Rows are buffered and inserted by batches, using a single multi-row INSERT
+/// statement per batch. The remaining rows are inserted when the stream is
+/// destroyed or when DbConnection::flush() is called.
 class DbOstream {
+public:
+  /// \brief Maximum number of rows inserted by a single statement
+  static const int MaxRowsPerInsert = 64;
+
+  /// \brief Maximum number of parameters in a statement
+  ///
+  /// This is the default value of SQLITE_MAX_VARIABLE_NUMBER.
+  static const int MaxParameters = 999;
+
+private:
+  /// \brief A buffered value
+  struct Value {
+    /// \brief Kind of value
+    enum class Kind { Null, Integer, Real, Text, Blob };
+
+    Kind kind = Kind::Null;
+    DbInt64 integer = 0;
+    DbDouble real = 0.0;
+    std::string text;
+  };
+
 private:
   /// \brief Database connection
   DbConnection& _db;
 
-  /// \brief SQLite3 prepared statement
+  /// \brief SQLite3 prepared statement inserting one row
   sqlite3_stmt* _stmt = nullptr;
 
+  /// \brief SQLite3 prepared statement inserting `_batch_rows` rows
+  sqlite3_stmt* _batch_stmt = nullptr;
+
   /// \brief Number of columns
   int _columns;
 
+  /// \brief Number of rows inserted by `_batch_stmt`
+  int _batch_rows;
+
   /// \brief Current number of column entered
   int _current_column = 1;
 
+  /// \brief Number of complete buffered rows
+  int _buffered_rows = 0;
+
+  /// \brief Buffered values, `_columns` per row
+  std::vector< Value > _values;
+
 public:
   /// \brief Deleted default constructor
   DbOstream() = delete;
@@ -300,9 +386,22 @@ public:
   /// \brief Insert a double
   void add(DbDouble d);
 
+  /// \brief Insert binary data
+  void add(DbBlob b);
+
   /// \brief Flush the row
   void flush();
 
+  /// \brief Insert the buffered rows in the database
+  void write_buffered_rows();
+
+private:
+  /// \brief Return the buffered value for the current column
+  Value& current_value();
+
+  /// \brief Insert the buffered rows with the batch statement
+  void write_batch();
+
   // friends
   friend DbOstream& end_row(DbOstream&);
 
@@ -338,6 +437,12 @@ inline DbOstream& operator<<(DbOstream& o, DbDouble d) {
   return o;
 }
 
+/// \brief Insert binary data
+inline DbOstream& operator<<(DbOstream& o, DbBlob b) {
+  o.add(b);
+  return o;
+}
+
 /// \brief Insert sqlite::end_row or sqlite::null
 inline DbOstream& operator<<(DbOstream& o, DbOstream& (*m)(DbOstream&)) {
   if (m == &end_row) {
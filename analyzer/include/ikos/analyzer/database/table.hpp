@@ -44,6 +44,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <ikos/analyzer/database/sqlite.hpp>
 
@@ -59,6 +60,9 @@ protected:
   /// \brief Table name
   std::string _name;
 
+  /// \brief Indexed columns
+  std::vector< std::string > _indexes;
+
 public:
   /// \brief Deleted default constructor
   DatabaseTable() = delete;
@@ -68,7 +72,8 @@ public:
   /// \param db The database connection
   /// \param name The table name
   /// \param cols The table columns
-  /// \param indexes The table indexes
+  /// \param indexes The table indexes, created by create_indexes(), as
+  /// comma-separated lists of columns
   DatabaseTable(
       sqlite::DbConnection& db,
       std::string name,
@@ -93,6 +98,12 @@ public:
   /// \brief Name of the table
   const std::string& name() const { return this->_name; }
 
+  /// \brief Create the indexes of the table
+  ///
+  /// This should be called once the table is populated, since maintaining an
+  /// index during insertions is slower than creating it at the end.
+  void create_indexes();
+
 }; // end class DatabaseTable
 
 } // end namespace analyzer
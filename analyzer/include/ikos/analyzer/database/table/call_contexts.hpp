@@ -43,7 +43,8 @@
 
 #pragma once
 
-#include <llvm/ADT/DenseMap.h>
+#include <cstdint>
+#include <vector>
 
 #include <ikos/analyzer/analysis/call_context.hpp>
 #include <ikos/analyzer/database/table.hpp>
@@ -54,6 +55,9 @@ namespace ikos {
 namespace analyzer {
 
 /// \brief Call contexts table
+///
+/// Each row is an edge of the call context trie: the parent context and the
+/// call statement.
 class CallContextsTable : public DatabaseTable {
 private:
   /// \brief Functions table
@@ -65,8 +69,9 @@ private:
   /// \brief Database output stream
   sqlite::DbOstream _row;
 
-  /// \brief Map from CallContext* to id
-  llvm::DenseMap< CallContext*, sqlite::DbInt64 > _map;
+  /// \brief Map from call context identifier to database id plus one, or 0
+  /// if the call context is not inserted yet
+  std::vector< uint32_t > _ids;
 
   /// \brief Last inserted id
   sqlite::DbInt64 _last_insert_id = 0;
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Check counters database table
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include <ikos/analyzer/analysis/result.hpp>
+#include <ikos/analyzer/checker/name.hpp>
+#include <ikos/analyzer/database/table.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Check counters table
+///
+/// Holds the number of checks per checker and status, when the checks table
+/// only stores the checks that are not `ok` (see ChecksTable).
+///
+/// The row with a null checker holds the number of statements with only `ok`
+/// checks, which do not appear in the checks table.
+class CheckCountersTable : public DatabaseTable {
+private:
+  sqlite::DbOstream _row;
+
+public:
+  /// \brief Constructor
+  explicit CheckCountersTable(sqlite::DbConnection& db);
+
+  /// \brief Insert the number of checks for the given checker and status
+  ///
+  /// `domain` is the tag of the analysis configuration, or empty.
+  void insert(CheckerName checker,
+              Result status,
+              sqlite::DbInt64 count,
+              const std::string& domain = {});
+
+  /// \brief Insert the number of statements with only `ok` checks
+  void insert_ok_statements(sqlite::DbInt64 count,
+                            const std::string& domain = {});
+
+private:
+  /// \brief Insert the domain column and end the row
+  void insert_domain(const std::string& domain);
+
+}; // end class CheckCountersTable
+
+} // end namespace analyzer
+} // end namespace ikos
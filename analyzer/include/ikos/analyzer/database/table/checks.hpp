@@ -43,20 +43,130 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/DenseSet.h>
+
 #include <ikos/analyzer/analysis/result.hpp>
 #include <ikos/analyzer/checker/kind.hpp>
 #include <ikos/analyzer/checker/name.hpp>
+#include <ikos/analyzer/database/check_sink.hpp>
 #include <ikos/analyzer/database/table.hpp>
 #include <ikos/analyzer/database/table/call_contexts.hpp>
+#include <ikos/analyzer/database/table/check_counters.hpp>
+#include <ikos/analyzer/database/table/compression_dictionaries.hpp>
 #include <ikos/analyzer/database/table/operands.hpp>
 #include <ikos/analyzer/database/table/statements.hpp>
 #include <ikos/analyzer/json/json.hpp>
+#include <ikos/analyzer/json/writer.hpp>
 
 namespace ikos {
 namespace analyzer {
 
+// forward declaration
+class ChecksTable;
+
+/// \brief Buffer of checks
+///
+/// Receives the checks inserted by a thread running checkers in parallel (see
+/// ChecksTable::set_thread_buffer()), until they are inserted in the checks
+/// table by the thread owning the output database.
+class CheckBuffer final : public CheckSink {
+private:
+  /// \brief Buffered check
+  struct BufferedCheck {
+    CheckKind kind;
+    CheckerName checker;
+    Result status;
+    ar::Statement* stmt;
+    CallContext* call_context;
+    std::vector< ar::Value* > operands;
+    JsonDict info;
+  };
+
+private:
+  /// \brief Buffered checks, in insertion order
+  std::vector< BufferedCheck > _checks;
+
+public:
+  /// \brief Constructor
+  CheckBuffer() = default;
+
+  /// \brief Return true
+  bool is_open() const override { return true; }
+
+  /// \brief Buffer a check
+  void write(CheckKind kind,
+             CheckerName checker,
+             Result status,
+             ar::Statement* stmt,
+             CallContext* call_context,
+             llvm::ArrayRef< ar::Value* > operands,
+             const JsonDict& info) override;
+
+  /// \brief Do nothing
+  void close() override {}
+
+  /// \brief Insert the buffered checks in the given table and clear the
+  /// buffer
+  void flush(ChecksTable& table);
+
+}; // end class CheckBuffer
+
 /// \brief Checks table
+///
+/// In compact mode, the `ok` checks are only counted in the check counters
+/// table. Their rows are omitted, except one per statement and calling context
+/// with only `ok` checks on a statement that also has other checks, so that
+/// the result of each calling context can still be computed.
+///
+/// In aggregated mode, identical checks (same statement, kind, checker,
+/// status, operands and info) found in several calling contexts are stored in
+/// one row. The first calling context is in `call_context_id` and the others
+/// are in `call_context_ids`, as a JSON list.
+///
+/// When several abstract domains are analyzed in the same run, each check is
+/// tagged with the domain that produced it (see set_domain()).
 class ChecksTable : public DatabaseTable {
+private:
+  /// \brief State of the checks on a statement for a calling context
+  struct ContextState {
+    /// \brief True if a check is not `ok`
+    bool not_ok;
+
+    /// \brief Kind of the first `ok` check
+    CheckKind kind;
+
+    /// \brief Checker of the first `ok` check
+    CheckerName checker;
+  };
+
+  /// \brief Row of identical checks, in aggregated mode
+  struct AggregatedRow {
+    CheckKind kind;
+    CheckerName checker;
+    Result status;
+    sqlite::DbInt64 statement_id;
+    std::string operands;
+    std::string info;
+    std::vector< sqlite::DbInt64 > call_context_ids;
+  };
+
+  /// \brief Key of an aggregated row
+  ///
+  /// Statement id, kind, checker, status, operands and info.
+  using AggregateKey = std::tuple< sqlite::DbInt64,
+                                   CheckKind,
+                                   CheckerName,
+                                   Result,
+                                   std::string,
+                                   std::string >;
+
 private:
   /// \brief Statements table
   StatementsTable& _statements;
@@ -67,18 +177,72 @@ private:
   /// \brief Call contexts table
   CallContextsTable& _call_contexts;
 
+  /// \brief Compression of the JSON columns
+  CompressionDictionariesTable& _compression;
+
   /// \brief Database output stream
   sqlite::DbOstream _row;
 
+  /// \brief Buffer for the JSON columns, reused between rows
+  JsonWriter _json;
+
   /// \brief Last inserted id
   sqlite::DbInt64 _last_insert_id = 0;
 
+  /// \brief Streaming output, or null
+  CheckSink* _sink;
+
+  /// \brief Recorder of all the inserted checks, or null
+  CheckSink* _recorder = nullptr;
+
+  /// \brief Stream of the checks that are not `ok`, or null
+  CheckSink* _stream = nullptr;
+
+  /// \brief Tag of the current analysis configuration, or empty
+  std::string _domain;
+
+  /// \brief Check counters table, or null if not in compact mode
+  CheckCountersTable* _counters_table;
+
+  /// \brief Number of checks per checker and status, in compact mode
+  std::map< std::pair< CheckerName, Result >, sqlite::DbInt64 > _counters;
+
+  /// \brief State of each statement and calling context, in compact mode
+  llvm::DenseMap< std::pair< ar::Statement*, CallContext* >, ContextState >
+      _contexts;
+
+  /// \brief Statements with a check that is not `ok`, in compact mode
+  llvm::DenseSet< ar::Statement* > _not_ok_statements;
+
+  /// \brief True if the table is in aggregated mode
+  bool _aggregate;
+
+  /// \brief Aggregated rows, in order of first insertion
+  std::vector< AggregatedRow > _aggregated;
+
+  /// \brief Index of each aggregated row
+  std::map< AggregateKey, std::size_t > _aggregated_index;
+
+  /// \brief Buffer of the checks inserted by the current thread, or null
+  static thread_local CheckBuffer* ThreadBuffer;
+
 public:
   /// \brief Constructor
+  ///
+  /// If `sink` is not null, the checks that are not `ok` are written to the
+  /// sink and nothing is inserted in the database.
+  ///
+  /// If `counters` is not null, the table is in compact mode.
+  ///
+  /// If `aggregate` is true, the table is in aggregated mode.
   explicit ChecksTable(sqlite::DbConnection& db,
                        StatementsTable& statements,
                        OperandsTable& operands,
-                       CallContextsTable& call_contexts);
+                       CallContextsTable& call_contexts,
+                       CompressionDictionariesTable& compression,
+                       CheckSink* sink = nullptr,
+                       CheckCountersTable* counters = nullptr,
+                       bool aggregate = false);
 
   /// \brief Insert a check in the database
   void insert(CheckKind kind,
@@ -89,6 +253,63 @@ public:
               llvm::ArrayRef< ar::Value* > operands = {},
               const JsonDict& info = {});
 
+  /// \brief Buffer the checks inserted by the current thread in `buffer`, or
+  /// insert them directly if `buffer` is null
+  ///
+  /// This allows checkers to run on other threads than the one writing the
+  /// output database.
+  static void set_thread_buffer(CheckBuffer* buffer) { ThreadBuffer = buffer; }
+
+  /// \brief Set a sink receiving all the inserted checks, including the `ok`
+  /// checks, or null to stop recording
+  void set_recorder(CheckSink* recorder) { this->_recorder = recorder; }
+
+  /// \brief Set a sink receiving the checks that are not `ok` as soon as they
+  /// are inserted, in addition to the database, or null
+  void set_stream(CheckSink* stream) { this->_stream = stream; }
+
+  /// \brief Set the tag of the following checks
+  ///
+  /// In compact or aggregated mode, the rows and counters of the previous
+  /// domain are inserted first.
+  void set_domain(std::string domain);
+
+  /// \brief Return the tag of the following checks, or empty
+  const std::string& domain() const { return this->_domain; }
+
+  /// \brief Return the id of the next inserted row
+  sqlite::DbInt64 next_id() const { return this->_last_insert_id; }
+
+  /// \brief Insert the remaining rows and the counters, in compact or
+  /// aggregated mode
+  ///
+  /// This should be called once the analysis is done.
+  void finalize();
+
+private:
+  /// \brief Insert a row in the checks table
+  void insert_row(CheckKind kind,
+                  CheckerName checker,
+                  Result status,
+                  ar::Statement* stmt,
+                  CallContext* call_context,
+                  llvm::ArrayRef< ar::Value* > operands,
+                  const JsonDict& info);
+
+  /// \brief Insert the remaining `ok` rows and the counters, in compact mode
+  void finalize_counters();
+
+  /// \brief Write a row in the checks table
+  ///
+  /// Empty `operands` and `info` are written as null.
+  void write_row(CheckKind kind,
+                 CheckerName checker,
+                 Result status,
+                 sqlite::DbInt64 statement_id,
+                 const std::string& operands,
+                 llvm::ArrayRef< sqlite::DbInt64 > call_context_ids,
+                 const std::string& info);
+
 }; // end class ChecksTable
 
 } // end namespace analyzer
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Compression dictionaries database table
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <ikos/analyzer/database/table.hpp>
+
+struct z_stream_s;
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Compression dictionaries table
+///
+/// When compression is enabled, the bulky text columns of the output database
+/// (operand representations, and the operands, information and calling
+/// contexts of the checks) are stored as zlib streams, using a preset
+/// dictionary of frequent substrings. The dictionary is stored in this table
+/// with its zlib identifier, so that readers can decompress these values.
+///
+/// A value is only compressed if it gets smaller, hence readers must accept
+/// both text and blob values in these columns.
+class CompressionDictionariesTable : public DatabaseTable {
+private:
+  /// \brief zlib stream, or null if compression is disabled
+  std::unique_ptr< z_stream_s > _stream;
+
+  /// \brief Buffer for the compressed values
+  std::string _buffer;
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param db The database connection
+  /// \param enabled If true, insert the dictionary and compress the values
+  CompressionDictionariesTable(sqlite::DbConnection& db, bool enabled);
+
+  /// \brief Destructor
+  ~CompressionDictionariesTable();
+
+  /// \brief Return true if compression is enabled
+  bool enabled() const { return this->_stream != nullptr; }
+
+  /// \brief Insert the given text in the current row of `row`
+  ///
+  /// The text is compressed if compression is enabled and it gets smaller.
+  ///
+  /// This is not thread-safe.
+  void write(sqlite::DbOstream& row, StringRef text);
+
+  /// \brief Return the preset dictionary
+  static StringRef dictionary();
+
+}; // end class CompressionDictionariesTable
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -43,9 +43,9 @@
 
 #pragma once
 
+#include <boost/filesystem.hpp>
+
 #include <llvm/ADT/DenseMap.h>
-#include <llvm/ADT/StringMap.h>
-#include <llvm/IR/DebugInfoMetadata.h>
 
 #include <ikos/analyzer/database/table.hpp>
 
@@ -58,11 +58,8 @@ private:
   /// \brief Database output stream
   sqlite::DbOstream _row;
 
-  /// \brief Map from llvm::DIFile* to id
-  llvm::DenseMap< llvm::DIFile*, sqlite::DbInt64 > _di_file_map;
-
-  /// \brief Map from full path to id
-  llvm::StringMap< sqlite::DbInt64 > _path_map;
+  /// \brief Map from interned path to id
+  llvm::DenseMap< const boost::filesystem::path*, sqlite::DbInt64 > _map;
 
   /// \brief Last inserted id
   sqlite::DbInt64 _last_insert_id = 0;
@@ -72,7 +69,9 @@ public:
   explicit FilesTable(sqlite::DbConnection& db);
 
   /// \brief Insert the given file in the database and return the id
-  sqlite::DbInt64 insert(llvm::DIFile* file);
+  ///
+  /// \param file Interned path, see SourceLocation::file()
+  sqlite::DbInt64 insert(const boost::filesystem::path* file);
 
 }; // end class FilesTable
 
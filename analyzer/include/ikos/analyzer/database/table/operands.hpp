@@ -43,7 +43,10 @@
 
 #pragma once
 
+#include <vector>
+
 #include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/StringMap.h>
 #include <llvm/IR/Constant.h>
 #include <llvm/IR/Type.h>
 #include <llvm/IR/Value.h>
@@ -51,6 +54,7 @@
 #include <ikos/ar/semantic/value.hpp>
 
 #include <ikos/analyzer/database/table.hpp>
+#include <ikos/analyzer/database/table/compression_dictionaries.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -58,22 +62,40 @@ namespace analyzer {
 /// \brief Operands table
 class OperandsTable : public DatabaseTable {
 private:
+  /// \brief Compression of the representations
+  CompressionDictionariesTable& _compression;
+
   /// \brief Database output stream
   sqlite::DbOstream _row;
 
-  /// \brief Map from ar::Value* to id
+  /// \brief Map from the dense index of a variable to id, or -1
+  std::vector< sqlite::DbInt64 > _ids;
+
+  /// \brief Map from ar::Value* to id, for values without a dense index
   llvm::DenseMap< ar::Value*, sqlite::DbInt64 > _map;
 
+  /// \brief Map from the content of a row (kind and representation) to id
+  ///
+  /// Distinct values with the same representation share the same row.
+  llvm::StringMap< sqlite::DbInt64 > _content_map;
+
   /// \brief Last inserted id
   sqlite::DbInt64 _last_insert_id = 0;
 
 public:
   /// \brief Constructor
-  OperandsTable(sqlite::DbConnection& db);
+  OperandsTable(sqlite::DbConnection& db,
+                CompressionDictionariesTable& compression);
 
   /// \brief Insert the given operand in the database and return the id
   sqlite::DbInt64 insert(ar::Value* value);
 
+private:
+  /// \brief Return the id of the row with the content of the given value,
+  /// inserting it if needed
+  sqlite::DbInt64 insert_row(ar::Value* value);
+
+public:
   /// \brief Return a textual representation of a llvm::Type
   static std::string repr(llvm::Type* type);
 
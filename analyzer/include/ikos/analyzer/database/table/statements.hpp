@@ -43,6 +43,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <llvm/ADT/DenseMap.h>
 
 #include <ikos/ar/semantic/statement.hpp>
@@ -66,7 +68,11 @@ private:
   /// \brief Database output stream
   sqlite::DbOstream _row;
 
-  /// \brief Map from ar::Statement* to id
+  /// \brief Map from the dense index of a statement to id, or -1
+  std::vector< sqlite::DbInt64 > _ids;
+
+  /// \brief Map from ar::Statement* to id, for statements without a dense
+  /// index
   llvm::DenseMap< ar::Statement*, sqlite::DbInt64 > _map;
 
   /// \brief Last inserted id
@@ -81,6 +87,10 @@ public:
   /// \brief Insert the given statement in the database and return the id
   sqlite::DbInt64 insert(ar::Statement* stmt);
 
+private:
+  /// \brief Insert a new row for the given statement and return the id
+  sqlite::DbInt64 insert_row(ar::Statement* stmt);
+
 }; // end class StatementsTable
 
 } // end namespace analyzer
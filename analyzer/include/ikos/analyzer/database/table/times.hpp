@@ -44,6 +44,7 @@
 #pragma once
 
 #include <ikos/analyzer/database/table.hpp>
+#include <ikos/analyzer/util/timer.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -60,6 +61,11 @@ public:
   /// \brief Insert a row
   void insert(StringRef name, sqlite::DbDouble time);
 
+  /// \brief Insert a row, with the performance counters of the pass
+  void insert(StringRef name,
+              sqlite::DbDouble time,
+              const PerfCounters::Values& counters);
+
 }; // end class TimesTable
 
 } // end namespace analyzer
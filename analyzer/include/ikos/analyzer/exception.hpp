@@ -120,5 +120,41 @@ public:
 
 }; // end class LogicError
 
+/// \brief Exception thrown when the analysis exceeds its memory budget
+class MemoryBudgetError : public Exception {
+private:
+  /// \brief Explanatory message
+  std::shared_ptr< const std::string > _msg;
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param msg Explanatory message
+  explicit MemoryBudgetError(const std::string& msg)
+      : _msg(std::make_shared< const std::string >(msg)) {}
+
+  /// \brief Remove the default constructor
+  MemoryBudgetError() = delete;
+
+  /// \brief Copy constructor
+  MemoryBudgetError(const MemoryBudgetError&) noexcept = default;
+
+  /// \brief Move constructor
+  MemoryBudgetError(MemoryBudgetError&&) noexcept = default;
+
+  /// \brief Copy assignment operator
+  MemoryBudgetError& operator=(const MemoryBudgetError&) noexcept = default;
+
+  /// \brief Move assignment operator
+  MemoryBudgetError& operator=(MemoryBudgetError&&) noexcept = default;
+
+  /// \brief Get the explanatory string
+  const char* what() const noexcept override;
+
+  /// \brief Destructor
+  ~MemoryBudgetError() override;
+
+}; // end class MemoryBudgetError
+
 } // end namespace analyzer
 } // end namespace ikos
@@ -45,11 +45,16 @@
 
 #include <string>
 
+#include <ikos/analyzer/support/assert.hpp>
 #include <ikos/analyzer/support/number.hpp>
+#include <ikos/analyzer/support/string_ref.hpp>
 
 namespace ikos {
 namespace analyzer {
 
+/// \brief Append the JSON representation of the string `s` to `out`
+void json_escape(std::string& out, StringRef s);
+
 /// \brief Base class for JSON objects
 class JsonNode {
 public:
@@ -71,6 +76,9 @@ public:
   /// \brief Return the string representation
   virtual std::string str() const = 0;
 
+  /// \brief Append the string representation to `out`
+  virtual void write(std::string& out) const { out.append(this->str()); }
+
   /// \brief Destructor
   virtual ~JsonNode();
 
@@ -148,6 +156,11 @@ public:
   /// \brief Return the string representation
   std::string str() const override;
 
+  /// \brief Append the string representation to `out`
+  void write(std::string& out) const override {
+    out.append(this->_b ? "true" : "false");
+  }
+
 }; // end class JsonBool
 
 /// \brief Convert booleans to JsonBool
@@ -167,6 +180,9 @@ public:
   /// \brief Return the string representation
   std::string str() const override;
 
+  /// \brief Append the string representation to `out`
+  void write(std::string& out) const override { json_escape(out, this->_s); }
+
 }; // end class JsonString
 
 /// \brief Convert strings to JsonString
@@ -224,12 +240,15 @@ public:
     if (!this->_buf.empty()) {
       this->_buf.push_back(',');
     }
-    this->_buf.append(to_json(v).str());
+    to_json(v).write(this->_buf);
   }
 
   /// \brief Return the string representation
   std::string str() const override;
 
+  /// \brief Append the string representation to `out`
+  void write(std::string& out) const override;
+
 private:
   // Implementation details for JsonList(const Args&... args)
 
@@ -270,10 +289,10 @@ private:
   public:
     /// \brief Constructor
     template < typename T >
-    Binding(std::string key, const T& value) {
-      this->_buf.append(JsonString(std::move(key)).str());
+    Binding(StringRef key, const T& value) {
+      json_escape(this->_buf, key);
       this->_buf.push_back(':');
-      this->_buf.append(to_json(value).str());
+      to_json(value).write(this->_buf);
     }
 
     /// \brief Copy constructor
@@ -323,6 +342,16 @@ public:
   /// \brief Destructor
   ~JsonDict() override = default;
 
+  /// \brief Create a dictionary from its string representation
+  ///
+  /// The string must have been returned by str(), it is not parsed.
+  static JsonDict from_str(const std::string& s) {
+    ikos_assert(s.size() >= 2 && s.front() == '{' && s.back() == '}');
+    JsonDict d;
+    d._buf = s.substr(1, s.size() - 2);
+    return d;
+  }
+
   /// \brief Clear the dictionary
   void clear() { this->_buf.clear(); }
 
@@ -331,18 +360,21 @@ public:
 
   /// \brief Add a (key, value) pair in the dictionary
   template < typename T >
-  void put(std::string key, const T& value) {
+  void put(StringRef key, const T& value) {
     if (!this->_buf.empty()) {
       this->_buf.push_back(',');
     }
-    this->_buf.append(JsonString(std::move(key)).str());
+    json_escape(this->_buf, key);
     this->_buf.push_back(':');
-    this->_buf.append(to_json(value).str());
+    to_json(value).write(this->_buf);
   }
 
   /// \brief Return the string representation
   std::string str() const override;
 
+  /// \brief Append the string representation to `out`
+  void write(std::string& out) const override;
+
 }; // end class JsonDict
 
 /// \brief Write a JSON node on a stream
@@ -0,0 +1,222 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Streaming writer of JSON documents
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <ikos/analyzer/json/json.hpp>
+#include <ikos/analyzer/support/string_ref.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Streaming writer of JSON documents
+///
+/// Unlike JsonList and JsonDict, the writer does not build intermediate
+/// objects: values are serialized directly into a buffer, which is reused
+/// after clear(). This is used to serialize the rows of the output database.
+///
+/// Example:
+/// \code
+///   JsonWriter w;
+///   w.begin_list();
+///   w.value(1);
+///   w.value("a");
+///   w.end_list();
+///   w.str(); // [1,"a"]
+/// \endcode
+class JsonWriter {
+private:
+  /// \brief Output buffer
+  std::string _buf;
+
+  /// \brief For each open list or dictionary, true if it has no element yet
+  std::vector< bool > _first;
+
+  /// \brief True if the next value is bound to a dictionary key
+  bool _after_key = false;
+
+public:
+  /// \brief Constructor
+  JsonWriter() = default;
+
+  /// \brief Deleted copy constructor
+  JsonWriter(const JsonWriter&) = delete;
+
+  /// \brief Move constructor
+  JsonWriter(JsonWriter&&) = default;
+
+  /// \brief Deleted copy assignment operator
+  JsonWriter& operator=(const JsonWriter&) = delete;
+
+  /// \brief Move assignment operator
+  JsonWriter& operator=(JsonWriter&&) = default;
+
+  /// \brief Destructor
+  ~JsonWriter() = default;
+
+  /// \brief Clear the output, keeping the allocated memory
+  void clear() {
+    this->_buf.clear();
+    this->_first.clear();
+    this->_after_key = false;
+  }
+
+  /// \brief Return true if nothing was written
+  bool empty() const { return this->_buf.empty(); }
+
+  /// \brief Return the output
+  ///
+  /// The result is invalidated by the next call on the writer.
+  StringRef str() const {
+    ikos_assert_msg(this->_first.empty(), "unterminated list or dictionary");
+    return this->_buf;
+  }
+
+  /// \brief Begin a list
+  void begin_list() {
+    this->separator();
+    this->_buf.push_back('[');
+    this->_first.push_back(true);
+  }
+
+  /// \brief End the current list
+  void end_list() {
+    ikos_assert(!this->_first.empty() && !this->_after_key);
+    this->_buf.push_back(']');
+    this->_first.pop_back();
+  }
+
+  /// \brief Begin a dictionary
+  void begin_dict() {
+    this->separator();
+    this->_buf.push_back('{');
+    this->_first.push_back(true);
+  }
+
+  /// \brief End the current dictionary
+  void end_dict() {
+    ikos_assert(!this->_first.empty() && !this->_after_key);
+    this->_buf.push_back('}');
+    this->_first.pop_back();
+  }
+
+  /// \brief Write a dictionary key, the next value is bound to it
+  void key(StringRef k) {
+    ikos_assert(!this->_first.empty() && !this->_after_key);
+    this->separator();
+    json_escape(this->_buf, k);
+    this->_buf.push_back(':');
+    this->_after_key = true;
+  }
+
+  /// \brief Write an integer
+  template < typename T,
+             class = std::enable_if_t< core::IsSupportedIntegral< T >::value > >
+  void value(T n) {
+    this->separator();
+    if (std::is_signed< T >::value) {
+      this->write_integer(static_cast< int64_t >(n));
+    } else {
+      this->write_unsigned(static_cast< uint64_t >(n));
+    }
+  }
+
+  /// \brief Write an integer
+  void value(const ZNumber& n) {
+    this->separator();
+    this->_buf.append(n.str());
+  }
+
+  /// \brief Write a boolean
+  void value(bool b) {
+    this->separator();
+    this->_buf.append(b ? "true" : "false");
+  }
+
+  /// \brief Write a string
+  void value(StringRef s) {
+    this->separator();
+    json_escape(this->_buf, s);
+  }
+
+  /// \brief Write a string
+  void value(const char* s) { this->value(StringRef(s)); }
+
+  /// \brief Write a string
+  void value(const std::string& s) { this->value(StringRef(s)); }
+
+  /// \brief Write a JSON node
+  void value(const JsonNode& n) {
+    this->separator();
+    n.write(this->_buf);
+  }
+
+private:
+  /// \brief Write the separator before a value
+  void separator() {
+    if (this->_after_key) {
+      this->_after_key = false;
+    } else if (!this->_first.empty()) {
+      if (this->_first.back()) {
+        this->_first.back() = false;
+      } else {
+        this->_buf.push_back(',');
+      }
+    }
+  }
+
+  /// \brief Write a signed integer
+  void write_integer(int64_t n);
+
+  /// \brief Write an unsigned integer
+  void write_unsigned(uint64_t n);
+
+}; // end class JsonWriter
+
+} // end namespace analyzer
+} // end namespace ikos
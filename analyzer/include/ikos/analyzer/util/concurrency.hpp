@@ -0,0 +1,192 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Concurrency utilities
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+#include <llvm/ADT/DenseMapInfo.h>
+
+#include <ikos/core/support/parallel.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Scope in which several analysis threads may run concurrently
+///
+/// Shared data structures (e.g, factories) only use locks while such a scope
+/// is active, so that the single-threaded analysis does not pay for them.
+///
+/// Scopes must be created and destroyed by the main thread, while no other
+/// analysis thread is running. Abstract values shared between copies are also
+/// locked on reads within a scope (see core::ConcurrentReads).
+class ConcurrentScope {
+private:
+  /// \brief Number of active scopes
+  static std::atomic< unsigned > Active;
+
+public:
+  /// \brief Constructor
+  ConcurrentScope() {
+    Active.fetch_add(1);
+    core::ConcurrentReads::enter();
+  }
+
+  /// \brief Deleted copy constructor
+  ConcurrentScope(const ConcurrentScope&) = delete;
+
+  /// \brief Deleted move constructor
+  ConcurrentScope(ConcurrentScope&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  ConcurrentScope& operator=(const ConcurrentScope&) = delete;
+
+  /// \brief Deleted move assignment operator
+  ConcurrentScope& operator=(ConcurrentScope&&) = delete;
+
+  /// \brief Destructor
+  ~ConcurrentScope() {
+    core::ConcurrentReads::exit();
+    Active.fetch_sub(1);
+  }
+
+  /// \brief Return true if a concurrent scope is active
+  static bool active() { return Active.load(std::memory_order_relaxed) != 0; }
+
+}; // end class ConcurrentScope
+
+/// \brief Lock guard that only locks the mutex within a concurrent scope
+class ConcurrentLockGuard {
+private:
+  /// \brief Locked mutex, or nullptr
+  std::mutex* _mutex;
+
+public:
+  /// \brief Constructor
+  explicit ConcurrentLockGuard(std::mutex& mutex)
+      : _mutex(ConcurrentScope::active() ? &mutex : nullptr) {
+    if (this->_mutex != nullptr) {
+      this->_mutex->lock();
+    }
+  }
+
+  /// \brief Deleted copy constructor
+  ConcurrentLockGuard(const ConcurrentLockGuard&) = delete;
+
+  /// \brief Deleted move constructor
+  ConcurrentLockGuard(ConcurrentLockGuard&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  ConcurrentLockGuard& operator=(const ConcurrentLockGuard&) = delete;
+
+  /// \brief Deleted move assignment operator
+  ConcurrentLockGuard& operator=(ConcurrentLockGuard&&) = delete;
+
+  /// \brief Destructor
+  ~ConcurrentLockGuard() {
+    if (this->_mutex != nullptr) {
+      this->_mutex->unlock();
+    }
+  }
+
+}; // end class ConcurrentLockGuard
+
+/// \brief Map split into several shards, each protected by its own mutex
+///
+/// This is used for interning tables: a key is always stored in the same
+/// shard, thus pointer identity of the interned objects is preserved.
+///
+/// Usage:
+///   auto& shard = map.shard(key);
+///   ConcurrentLockGuard lock(shard.mutex);
+///   auto it = shard.map.find(key);
+///   ...
+template < typename Map, std::size_t NumShards = 16 >
+class ShardedMap {
+public:
+  /// \brief A shard
+  struct Shard {
+    std::mutex mutex;
+    Map map;
+  };
+
+private:
+  std::array< Shard, NumShards > _shards;
+
+public:
+  /// \brief Constructor
+  ShardedMap() = default;
+
+  /// \brief Deleted copy constructor
+  ShardedMap(const ShardedMap&) = delete;
+
+  /// \brief Deleted move constructor
+  ShardedMap(ShardedMap&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  ShardedMap& operator=(const ShardedMap&) = delete;
+
+  /// \brief Deleted move assignment operator
+  ShardedMap& operator=(ShardedMap&&) = delete;
+
+  /// \brief Destructor
+  ~ShardedMap() = default;
+
+  /// \brief Return the shard for the given hash value
+  Shard& shard_for_hash(std::size_t hash) {
+    return this->_shards[(hash ^ (hash >> 11)) % NumShards];
+  }
+
+  /// \brief Return the shard for the given key
+  template < typename Key >
+  Shard& shard(const Key& key) {
+    return this->shard_for_hash(llvm::DenseMapInfo< Key >::getHashValue(key));
+  }
+
+}; // end class ShardedMap
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -0,0 +1,230 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Compact copy of the source information of the LLVM module
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/DenseSet.h>
+
+#include <ikos/ar/semantic/bundle.hpp>
+
+#include <ikos/analyzer/support/assert.hpp>
+#include <ikos/analyzer/util/demangle.hpp>
+#include <ikos/analyzer/util/source_location.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Compact copy of the source information of the LLVM module
+///
+/// The AR keeps pointers on the llvm::Module it was imported from, but the
+/// analyses and checkers only need source locations and names. This class
+/// copies them into small tables, so that the llvm::Module and its
+/// llvm::LLVMContext can be freed right after the import.
+///
+/// Source locations of statements are interned in a table, and each statement
+/// holds its 32-bit index in that table (see ar::Statement::source_location()).
+///
+/// Statements and variables are also given dense indexes (see
+/// ar::Statement::index() and ar::Value::index()), so that tables keyed by
+/// statement or variable can be side arrays.
+///
+/// Once the module is released, the frontend pointers of the AR objects must
+/// not be dereferenced anymore. `has_frontend()` remains meaningful.
+class FrontendInfo {
+public:
+  /// \brief Interned source location
+  struct Location {
+    /// \brief Index of the file in the interned source file paths
+    std::uint32_t file;
+
+    /// \brief Line
+    std::uint32_t line;
+
+    /// \brief Column
+    std::uint32_t column;
+  };
+
+  /// \brief Source information of a function
+  struct FunctionInfo {
+    /// \brief Name of the llvm::Function
+    std::string name;
+
+    /// \brief Demangled name, or the name if it is not mangled
+    std::string demangled;
+
+    /// \brief Location of the definition (without column), or null
+    SourceLocation location;
+  };
+
+  /// \brief Source information of a variable
+  struct VariableInfo {
+    /// \brief Name in the debug information, or empty
+    std::string debug_name;
+
+    /// \brief Textual representation
+    ///
+    /// For internal variables, the representation of the llvm::Value.
+    /// For constant global variables, the representation of the initializer.
+    /// Otherwise, empty.
+    std::string repr;
+  };
+
+private:
+  /// \brief Interned source file paths
+  std::vector< std::unique_ptr< boost::filesystem::path > > _files;
+
+  /// \brief Interned source locations of statements
+  std::vector< Location > _locations;
+
+  /// \brief Statements coming from a phi node or a comparison
+  llvm::DenseSet< ar::Statement* > _phi_or_comparisons;
+
+  /// \brief Functions with a frontend
+  llvm::DenseMap< ar::Function*, FunctionInfo > _functions;
+
+  /// \brief Global, local and internal variables with a frontend
+  llvm::DenseMap< ar::Value*, VariableInfo > _variables;
+
+  /// \brief Number of statements with a dense index
+  std::uint32_t _num_statements = 0;
+
+  /// \brief Number of variables with a dense index
+  std::uint32_t _num_variables = 0;
+
+  /// \brief Number of values (variables and constants) with a dense index
+  std::uint32_t _num_values = 0;
+
+  /// \brief Source information of the analyzed program, or null
+  static const FrontendInfo* Current;
+
+public:
+  /// \brief Create the source information of the given bundle
+  ///
+  /// The llvm::Module of the bundle must still be alive. This sets the source
+  /// location index of every statement with a frontend, and the dense index of
+  /// every statement and variable.
+  explicit FrontendInfo(ar::Bundle* bundle);
+
+  /// \brief No copy constructor
+  FrontendInfo(const FrontendInfo&) = delete;
+
+  /// \brief No move constructor
+  FrontendInfo(FrontendInfo&&) = delete;
+
+  /// \brief No copy assignment operator
+  FrontendInfo& operator=(const FrontendInfo&) = delete;
+
+  /// \brief No move assignment operator
+  FrontendInfo& operator=(FrontendInfo&&) = delete;
+
+  /// \brief Destructor
+  ~FrontendInfo();
+
+  /// \brief Return the source location with the given index
+  SourceLocation location(std::uint32_t index) const {
+    ikos_assert(index < this->_locations.size());
+    const Location& loc = this->_locations[index];
+    return SourceLocation(this->_files[loc.file].get(), loc.line, loc.column);
+  }
+
+  /// \brief Return true if the statement comes from a phi node or a
+  /// comparison
+  bool is_phi_or_comparison(ar::Statement* stmt) const {
+    return this->_phi_or_comparisons.count(stmt) != 0;
+  }
+
+  /// \brief Return the number of statements with a dense index
+  std::uint32_t num_statements() const { return this->_num_statements; }
+
+  /// \brief Return the number of variables with a dense index
+  std::uint32_t num_variables() const { return this->_num_variables; }
+
+  /// \brief Return the number of values with a dense index
+  ///
+  /// Variables are numbered first, in [0, num_variables()), followed by the
+  /// constants used as statement operands.
+  std::uint32_t num_values() const { return this->_num_values; }
+
+  /// \brief Return the source information of the given function, or null
+  const FunctionInfo* function(ar::Function* fun) const;
+
+  /// \brief Return the source information of the given variable, or null
+  const VariableInfo* variable(ar::Value* var) const;
+
+  /// \brief Return true if the source information of the analyzed program
+  /// is available
+  static bool is_set() { return Current != nullptr; }
+
+  /// \brief Return the source information of the analyzed program
+  static const FrontendInfo& get() {
+    ikos_assert_msg(Current != nullptr, "no frontend information");
+    return *Current;
+  }
+
+  /// \brief Set the source information of the analyzed program
+  static void set(const FrontendInfo* info) { Current = info; }
+
+}; // end class FrontendInfo
+
+/// \brief Return the demangled name of the given function
+///
+/// The names of the functions with a frontend are demangled once, when the
+/// source information is created, so this is cheap on hot paths.
+inline std::string demangle(ar::Function* fun) {
+  if (FrontendInfo::is_set()) {
+    if (const FrontendInfo::FunctionInfo* info =
+            FrontendInfo::get().function(fun)) {
+      return info->demangled;
+    }
+  }
+  return demangle(fun->name());
+}
+
+} // end namespace analyzer
+} // end namespace ikos
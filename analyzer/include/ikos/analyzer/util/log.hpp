@@ -44,6 +44,7 @@
 #pragma once
 
 #include <iostream>
+#include <utility>
 
 #include <ikos/core/support/compiler.hpp>
 
@@ -130,6 +131,18 @@ inline void info(StringRef message) {
   }
 }
 
+/// \brief Log an informative message returned by `make_message`
+///
+/// `make_message` is only called if informative messages are displayed, which
+/// avoids building the message on hot paths.
+template < typename Function,
+           typename = decltype(std::declval< Function& >()()) >
+inline void info(Function&& make_message) {
+  if (ikos_unlikely(is_enabled_for(LogLevel::Info))) {
+    info_out() << make_message() << std::endl;
+  }
+}
+
 /// \brief Logging stream for debug messages
 inline std::ostream& debug_out() {
   return out() << "[" << color::magenta() << "." << color::off() << "] ";
@@ -142,6 +155,17 @@ inline void debug(StringRef message) {
   }
 }
 
+/// \brief Log a debug message returned by `make_message`
+///
+/// `make_message` is only called if debug messages are displayed.
+template < typename Function,
+           typename = decltype(std::declval< Function& >()()) >
+inline void debug(Function&& make_message) {
+  if (ikos_unlikely(is_enabled_for(LogLevel::Debug))) {
+    debug_out() << make_message() << std::endl;
+  }
+}
+
 } // end namespace log
 
 } // end namespace analyzer
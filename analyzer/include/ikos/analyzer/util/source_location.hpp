@@ -47,19 +47,69 @@
 
 #include <ikos/ar/semantic/statement.hpp>
 
-#include <ikos/frontend/llvm/import/source_location.hpp>
+#include <ikos/analyzer/support/assert.hpp>
 
 namespace ikos {
 namespace analyzer {
 
 /// \brief Represents a source code location
-using frontend::import::SourceLocation;
+///
+/// Source files are interned by FrontendInfo: two locations in the same file
+/// share the same path pointer.
+class SourceLocation {
+private:
+  /// \brief Absolute path of the source file, or null
+  const boost::filesystem::path* _file = nullptr;
+
+  /// \brief Line
+  unsigned _line = 0;
+
+  /// \brief Column
+  unsigned _column = 0;
+
+public:
+  /// \brief Create a null source location
+  SourceLocation() = default;
+
+  /// \brief Create a source location
+  SourceLocation(const boost::filesystem::path* file,
+                 unsigned line,
+                 unsigned column)
+      : _file(file), _line(line), _column(column) {
+    ikos_assert(file != nullptr);
+  }
+
+  /// \brief Return true if the source location is null
+  bool is_null() const { return this->_file == nullptr; }
+
+  /// \brief Return true if the source location is not null
+  explicit operator bool() const { return this->_file != nullptr; }
+
+  /// \brief Return the interned path of the file
+  const boost::filesystem::path* file() const {
+    ikos_assert(this->_file != nullptr);
+    return this->_file;
+  }
+
+  /// \brief Return the line
+  unsigned line() const {
+    ikos_assert(this->_file != nullptr);
+    return this->_line;
+  }
+
+  /// \brief Return the column
+  unsigned column() const {
+    ikos_assert(this->_file != nullptr);
+    return this->_column;
+  }
+
+  /// \brief Return the absolute path to the filename
+  const boost::filesystem::path& path() const { return *this->file(); }
 
-/// \brief Return the absolute path of the given source file
-using frontend::import::source_path;
+}; // end class SourceLocation
 
 /// \brief Return the source location of the given statement
-using frontend::import::source_location;
+SourceLocation source_location(ar::Statement* stmt);
 
 /// \brief Return the source location of the given statement as a string
 ///
@@ -43,7 +43,9 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <string>
 
@@ -131,6 +133,74 @@ public:
 
 }; // end class ScopeTimer
 
+/// \brief Hardware performance counters and peak memory growth of a scope
+///
+/// The counters are read with perf_event_open(2), for the calling thread and
+/// the threads it creates after start(). They are only available on Linux,
+/// and only collected if PerfCounters::Enable is true.
+class PerfCounters {
+public:
+  /// \brief True to collect the counters
+  static bool Enable;
+
+  /// \brief Values of the counters, or -1 if unavailable
+  struct Values {
+    /// \brief CPU cycles
+    int64_t cycles = -1;
+
+    /// \brief Retired instructions
+    int64_t instructions = -1;
+
+    /// \brief Last level cache misses
+    int64_t llc_misses = -1;
+
+    /// \brief Page faults
+    int64_t page_faults = -1;
+
+    /// \brief Growth of the peak resident set size, in kilobytes
+    int64_t max_rss_delta = -1;
+  };
+
+private:
+  /// \brief File descriptors of the perf events, or -1
+  std::array< int, 4 > _fds;
+
+  /// \brief Peak resident set size at start(), in kilobytes
+  int64_t _max_rss;
+
+  /// \brief Values computed by stop()
+  Values _values;
+
+public:
+  /// \brief Constructor
+  PerfCounters();
+
+  /// \brief Deleted copy constructor
+  PerfCounters(const PerfCounters&) = delete;
+
+  /// \brief Deleted move constructor
+  PerfCounters(PerfCounters&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  /// \brief Deleted move assignment operator
+  PerfCounters& operator=(PerfCounters&&) = delete;
+
+  /// \brief Destructor
+  ~PerfCounters();
+
+  /// \brief Start the counters, if enabled
+  void start();
+
+  /// \brief Stop the counters
+  void stop();
+
+  /// \brief Return the values of the counters between start() and stop()
+  const Values& values() const { return this->_values; }
+
+}; // end class PerfCounters
+
 // forward declaration
 class TimesTable;
 
@@ -141,6 +211,9 @@ private:
   /// \brief Actual timer
   Timer _timer;
 
+  /// \brief Performance counters
+  PerfCounters _counters;
+
   /// \brief Times table
   TimesTable& _table;
 
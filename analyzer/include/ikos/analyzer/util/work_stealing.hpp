@@ -0,0 +1,130 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Work-stealing thread pool
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ikos {
+namespace analyzer {
+
+/// \brief Pool of threads running a fixed set of tasks
+///
+/// Each thread owns a queue of tasks. A thread runs the tasks of its own queue
+/// from the front, and when it runs out of work, steals tasks from the back of
+/// the other queues.
+///
+/// Tasks are distributed in a round-robin fashion, in the given order. Giving
+/// the most expensive tasks first lets the cheap ones fill the gaps at the end.
+class WorkStealingPool {
+public:
+  using Task = std::function< void() >;
+
+private:
+  /// \brief Queue of tasks owned by a thread
+  struct Queue {
+    std::mutex mutex;
+    std::deque< Task > tasks;
+  };
+
+private:
+  /// \brief Queues, one per thread
+  std::vector< std::unique_ptr< Queue > > _queues;
+
+  /// \brief Threads
+  std::vector< std::thread > _threads;
+
+  /// \brief True if the remaining tasks should be dropped
+  std::atomic< bool > _cancelled;
+
+public:
+  /// \brief Create a pool of `num_threads` threads
+  explicit WorkStealingPool(unsigned num_threads);
+
+  /// \brief Deleted copy constructor
+  WorkStealingPool(const WorkStealingPool&) = delete;
+
+  /// \brief Deleted move constructor
+  WorkStealingPool(WorkStealingPool&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  /// \brief Deleted move assignment operator
+  WorkStealingPool& operator=(WorkStealingPool&&) = delete;
+
+  /// \brief Destructor
+  ///
+  /// Cancels the remaining tasks and waits for the running ones.
+  ~WorkStealingPool();
+
+  /// \brief Start running the given tasks
+  ///
+  /// Tasks should not throw exceptions.
+  void start(std::vector< Task > tasks);
+
+  /// \brief Drop the tasks that have not started yet
+  void cancel() { this->_cancelled.store(true); }
+
+  /// \brief Wait for all threads to finish
+  void join();
+
+private:
+  /// \brief Main loop of the thread `id`
+  void work(std::size_t id);
+
+  /// \brief Pop a task from the queue `id`, or steal one from another queue
+  ///
+  /// Returns false if there is no task left.
+  bool pop(std::size_t id, Task& task);
+
+}; // end class WorkStealingPool
+
+} // end namespace analyzer
+} // end namespace ikos
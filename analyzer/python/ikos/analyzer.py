@@ -41,7 +41,9 @@
 ###############################################################################
 import argparse
 import atexit
+import copy
 import datetime
+import hashlib
 import json
 import os
 import os.path
@@ -49,11 +51,14 @@ import pipes
 import shlex
 import shutil
 import signal
+import sqlite3
 import subprocess
 import sys
 import tempfile
 import threading
 
+from multiprocessing.pool import ThreadPool
+
 from ikos import args
 from ikos import colors
 from ikos import log
@@ -61,11 +66,12 @@ from ikos import report
 from ikos import settings
 from ikos import stats
 from ikos.log import printf
+from ikos.output_db import DatabaseMerger
 from ikos.output_db import OutputDatabase
 
 
 def parse_arguments(argv):
-    usage = '%(prog)s [options] file[.c|.cpp|.bc]'
+    usage = '%(prog)s [options] file[.c|.cpp|.bc|.json]'
     description = 'ikos static analyzer'
     formatter_class = argparse.RawTextHelpFormatter
     parser = argparse.ArgumentParser(usage=usage,
@@ -74,8 +80,10 @@ def parse_arguments(argv):
 
     # Positional arguments
     parser.add_argument('file',
-                        metavar='file[.c|.cpp|.bc]',
-                        help='File to analyze')
+                        metavar='file[.c|.cpp|.bc|.json]',
+                        help='File to analyze, or compilation database '
+                             '(compile_commands.json) of the files to '
+                             'analyze')
 
     # Optional arguments
     parser.add_argument('-o', '--output-db',
@@ -83,6 +91,41 @@ def parse_arguments(argv):
                         metavar='<file>',
                         help='Output database file (default: output.db)',
                         default='output.db')
+    parser.add_argument('--output-format',
+                        dest='output_format',
+                        metavar='',
+                        help=args.help('Output format:',
+                                       args.output_formats,
+                                       args.default_output_format),
+                        choices=args.choices(args.output_formats),
+                        default=args.default_output_format)
+    parser.add_argument('--compact-checks',
+                        dest='compact_checks',
+                        help='Only store the checks that are not ok in the '
+                             'output database, and count the others',
+                        action='store_true',
+                        default=False)
+    parser.add_argument('--aggregate-checks',
+                        dest='aggregate_checks',
+                        help='Store identical checks found in several calling '
+                             'contexts in one row of the output database',
+                        action='store_true',
+                        default=False)
+    parser.add_argument('--compress-db',
+                        dest='compress_db',
+                        help='Compress the operands, check information and '
+                             'calling contexts columns of the output '
+                             'database',
+                        action='store_true',
+                        default=False)
+    parser.add_argument('--db-profile',
+                        dest='db_profile',
+                        metavar='',
+                        help=args.help('Output database profile:',
+                                       args.db_profiles,
+                                       args.default_db_profile),
+                        choices=args.choices(args.db_profiles),
+                        default=args.default_db_profile)
     parser.add_argument('-v',
                         dest='verbosity',
                         help='Increase verbosity',
@@ -110,10 +153,12 @@ def parse_arguments(argv):
     analysis.add_argument('-d', '--domain',
                           dest='domain',
                           metavar='',
-                          help=args.help('Available abstract domains:',
+                          help=args.help('Available abstract domains '
+                                         '(a comma-separated list runs the '
+                                         'value analysis once per domain, '
+                                         'sharing the pre-analyses):',
                                          args.domains,
                                          args.default_domain),
-                          choices=args.choices(args.domains),
                           default=args.default_domain)
     analysis.add_argument('--entry-points',
                           dest='entry_points',
@@ -140,11 +185,23 @@ def parse_arguments(argv):
                           help='Disable the liveness analysis',
                           action='store_true',
                           default=False)
+    analysis.add_argument('--sparse-scalars',
+                          dest='sparse_scalars',
+                          help='Propagate the integer variables with a '
+                               'single definition outside of cycles along '
+                               'their def-use chains',
+                          action='store_true',
+                          default=False)
     analysis.add_argument('--no-pointer',
                           dest='no_pointer',
                           help='Disable the pointer analysis',
                           action='store_true',
                           default=False)
+    analysis.add_argument('--no-mod-ref',
+                          dest='no_mod_ref',
+                          help='Disable the mod/ref analysis',
+                          action='store_true',
+                          default=False)
     analysis.add_argument('--no-fixpoint-profiles',
                           dest='no_fixpoint_profiles',
                           help='Disable the fixpoint profiles analysis',
@@ -176,12 +233,284 @@ def parse_arguments(argv):
                           dest='hardware_addresses_file',
                           metavar='',
                           help='Specify ranges (x-y) of hardware addresses'
-                               ' from a file (one range per line)')
+                               ' from a file (ranges separated by commas or'
+                               ' new lines, or binary)')
     analysis.add_argument('--argc',
                           dest='argc',
                           metavar='',
                           help='Specify a value for argc',
                           type=int)
+    analysis.add_argument('-j', '--jobs',
+                          dest='jobs',
+                          metavar='<n>',
+                          help='Number of threads used to compile the files '
+                               'of a compilation database, to analyze entry '
+                               'points and to generate pointer constraints in '
+                               'parallel, and of processes used to generate '
+                               'the report (default: 1)',
+                          type=int,
+                          default=1)
+    analysis.add_argument('--fused-checks',
+                          dest='fused_checks',
+                          help='Run the checks during the fixpoint '
+                               'computation to reduce the memory usage '
+                               '(--proc=intra only)',
+                          action='store_true',
+                          default=False)
+    analysis.add_argument('--wto-jobs',
+                          dest='wto_jobs',
+                          metavar='<n>',
+                          help='Number of threads used to analyze the '
+                               'independent components of a function '
+                               '(experimental, --proc=intra only, default: 1)',
+                          type=int,
+                          default=1)
+    analysis.add_argument('--domain-jobs',
+                          dest='domain_jobs',
+                          metavar='<n>',
+                          help='Number of threads used by the variable packing '
+                               'domains to process independent packs in '
+                               'parallel (default: 1)',
+                          type=int,
+                          default=1)
+    analysis.add_argument('--check-jobs',
+                          dest='check_jobs',
+                          metavar='<n>',
+                          help='Number of threads used to run the checkers of '
+                               'a function in parallel (--proc=inter only, '
+                               'default: 1)',
+                          type=int,
+                          default=1)
+    analysis.add_argument('--stream-checks',
+                          dest='stream_checks',
+                          help='Run the checks of a callee as soon as the '
+                               'fixpoint on its caller is reached, to reduce '
+                               'the memory usage (--proc=inter only)',
+                          action='store_true',
+                          default=False)
+    analysis.add_argument('--context-depth',
+                          dest='context_depth',
+                          metavar='<k>',
+                          help='Maximum number of call statements in the '
+                               'call context of a callee, deeper call '
+                               'contexts are merged (--proc=inter only, '
+                               'default: 0, no limit)',
+                          type=int,
+                          default=0)
+    analysis.add_argument('--context-merge',
+                          dest='context_merge',
+                          metavar='<function>',
+                          help='Analyze the given function in a single call '
+                               'context for all its call sites (--proc=inter '
+                               'only)',
+                          action='append')
+    analysis.add_argument('--dyn-alloc-context-depth',
+                          dest='dyn_alloc_context_depth',
+                          metavar='<k>',
+                          help='Maximum number of call statements in the '
+                               'call context of a dynamic allocation site, '
+                               '0 to only distinguish them by their call '
+                               'statement (--proc=inter only, default: no '
+                               'limit)',
+                          type=int,
+                          default=None)
+    analysis.add_argument('--context-pointer-cache',
+                          dest='context_pointer_cache',
+                          metavar='<n>',
+                          help='Number of (call context, function) pairs for '
+                               'which a context-sensitive pointer information '
+                               'is cached, or 0 to disable the '
+                               'context-sensitive pointer analysis '
+                               '(--proc=inter only, default: 0)',
+                          type=int,
+                          default=0)
+    analysis.add_argument('--warm-start-cycles',
+                          dest='warm_start_cycles',
+                          help='Start the iterations on the cycles of a callee '
+                               'from the invariants of its previous analysis, '
+                               'when the entry invariants are comparable '
+                               '(--proc=inter only)',
+                          action='store_true',
+                          default=False)
+    analysis.add_argument('--smash-threshold',
+                          dest='smash_threshold',
+                          metavar='<n>',
+                          help='Smash the cells of a memory location into a '
+                               'summary cell once it has more than <n> cells, '
+                               'or 0 to never smash cells (default: 0)',
+                          type=int,
+                          default=0)
+    analysis.add_argument('--array-segments',
+                          dest='array_segments',
+                          metavar='<n>',
+                          help='Maximum number of segments of a summary cell, '
+                               'to keep elements written at a single index '
+                               'precise (default: 1)',
+                          type=int,
+                          default=1)
+    analysis.add_argument('--gc-loop-heads',
+                          dest='gc_loop_heads',
+                          help='Forget the dynamic allocations that are no '
+                               'longer reachable from any pointer at cycle '
+                               'heads',
+                          action='store_true',
+                          default=False)
+    analysis.add_argument('--pointer-widening-threshold',
+                          dest='pointer_widening_threshold',
+                          metavar='<n>',
+                          help='Number of updates of a pointer value using a '
+                               'join in the pointer constraint solver, before '
+                               'the widening is applied (default: 50)',
+                          type=int,
+                          default=50)
+    analysis.add_argument('--pointer-offsets',
+                          dest='pointer_offsets',
+                          help='Precision of the offsets in the pointer '
+                               'constraint solver: interval (default) or '
+                               'none, only computing the points-to sets',
+                          choices=('interval', 'none'),
+                          default='interval')
+    analysis.add_argument('--type-function-pointers',
+                          dest='type_function_pointers',
+                          help='Resolve the indirect calls matching the '
+                               'signature of a single address-taken '
+                               'function before solving the function '
+                               'pointer constraints (the constraints are '
+                               'still solved if pointers are exchanged with '
+                               'external code)',
+                          action='store_true',
+                          default=False)
+    analysis.add_argument('--widening-delay',
+                          dest='widening_delay',
+                          metavar='<n>',
+                          help='Number of iterations on a cycle performed '
+                               'with a join before the widening is applied '
+                               '(default: 1)',
+                          type=int,
+                          default=1)
+    analysis.add_argument('--narrowing-iterations',
+                          dest='narrowing_iterations',
+                          metavar='<n>',
+                          help='Maximum number of narrowing iterations on a '
+                               'cycle, or 0 to narrow until convergence '
+                               '(default: 0)',
+                          type=int,
+                          default=0)
+    analysis.add_argument('--function-time-budget',
+                          dest='function_time_budget',
+                          metavar='<seconds>',
+                          help='Treat a callee as an unknown function once its '
+                               'analysis takes more than <seconds> '
+                               '(--proc=inter only, default: 0, no limit)',
+                          type=int,
+                          default=0)
+    analysis.add_argument('--function-iteration-budget',
+                          dest='function_iteration_budget',
+                          metavar='<n>',
+                          help='Treat a callee as an unknown function once its '
+                               'analysis takes more than <n> basic block '
+                               'iterations (--proc=inter only, default: 0, '
+                               'no limit)',
+                          type=int,
+                          default=0)
+    analysis.add_argument('--function-invariant-budget',
+                          dest='function_invariant_budget',
+                          metavar='<cells>',
+                          help='Treat a callee as an unknown function once an '
+                               'invariant at one of its cycle heads has more '
+                               'than <cells> memory cells (--proc=inter only, '
+                               'default: 0, no limit)',
+                          type=int,
+                          default=0)
+    analysis.add_argument('--assert-refine-domain',
+                          dest='assert_refine_domain',
+                          metavar='',
+                          help='Analyze again the functions with unproved '
+                               'assertions using the given relational '
+                               'domain (--proc=intra only): '
+                               + ', '.join(args.assert_refine_domains),
+                          choices=args.assert_refine_domains,
+                          default=None)
+    analysis.add_argument('--result-cache',
+                          dest='result_cache',
+                          metavar='<directory>',
+                          help='Directory of the persistent cache of analysis '
+                               'results, reused for unchanged functions '
+                               '(--proc=intra only)',
+                          default=None)
+    analysis.add_argument('--profile-functions',
+                          dest='profile_functions',
+                          help='Record the time, the number of iterations and '
+                               'the peak invariant size of the analysis of '
+                               'each function, per call context (see '
+                               'ikos-report --profile, --proc=inter only)',
+                          action='store_true',
+                          default=False)
+    analysis.add_argument('--perf-record',
+                          dest='perf_record',
+                          metavar='<file>',
+                          help='Write a JSON record of the performance of '
+                               'the run: time and peak memory of each phase, '
+                               'analyzer passes and counters, bitcode size '
+                               'and number of functions and statements',
+                          default=None)
+    analysis.add_argument('--checkpoint',
+                          dest='checkpoint',
+                          help='Commit the output database after each entry '
+                               'point, so that an interrupted analysis can '
+                               'be resumed (--proc=inter only)',
+                          action='store_true',
+                          default=False)
+    analysis.add_argument('--resume',
+                          dest='resume',
+                          help='Resume an interrupted analysis run with '
+                               '--checkpoint, skipping the entry points it '
+                               'already analyzed',
+                          action='store_true',
+                          default=False)
+    analysis.add_argument('--perf-counters',
+                          dest='perf_counters',
+                          help='Record the hardware performance counters '
+                               'and the peak memory growth of each pass',
+                          action='store_true',
+                          default=False)
+    analysis.add_argument('--progress-file',
+                          dest='progress_file',
+                          metavar='<file>',
+                          help='Periodically write the current phase, the '
+                               'stack of functions being analyzed and the '
+                               'current cycle of each thread to the given '
+                               'JSON file',
+                          default=None)
+    analysis.add_argument('--progress-interval',
+                          dest='progress_interval',
+                          metavar='<seconds>',
+                          help='Interval between two writes of the progress '
+                               'file (default: 10)',
+                          type=int,
+                          default=10)
+    analysis.add_argument('--fixpoint-trace',
+                          dest='fixpoint_trace',
+                          metavar='<file>',
+                          help='Write a trace of the fixpoint iterations to '
+                               'the given file, in the Chrome trace event '
+                               'format',
+                          default=None)
+    analysis.add_argument('--fixpoint-trace-threshold',
+                          dest='fixpoint_trace_threshold',
+                          metavar='<microseconds>',
+                          help='Drop the events of the fixpoint trace shorter '
+                               'than the given duration (default: 100)',
+                          type=int,
+                          default=100)
+    analysis.add_argument('--incremental',
+                          dest='incremental',
+                          help='Reuse the output database if the program and '
+                               'the options did not change since the previous '
+                               'run, otherwise reuse the results of the '
+                               'unchanged functions (--proc=intra only)',
+                          action='store_true',
+                          default=False)
 
     # Preprocessing options
     preprocess = parser.add_argument_group('Preprocessing Options')
@@ -198,11 +527,47 @@ def parse_arguments(argv):
                             help='Front-end inline all functions',
                             action='store_true',
                             default=False)
+    preprocess.add_argument('--inline-small',
+                            dest='inline_small',
+                            help='Front-end inline small leaf functions '
+                                 'without loops that have few call sites',
+                            action='store_true',
+                            default=False)
+    preprocess.add_argument('--inline-max-size',
+                            dest='inline_max_size',
+                            metavar='<n>',
+                            help='Maximum number of instructions of a '
+                                 'function inlined by --inline-small '
+                                 '(default: 30)',
+                            type=int,
+                            default=30)
+    preprocess.add_argument('--inline-max-call-sites',
+                            dest='inline_max_call_sites',
+                            metavar='<n>',
+                            help='Maximum number of call sites of a function '
+                                 'inlined by --inline-small (default: 4)',
+                            type=int,
+                            default=4)
     preprocess.add_argument('--disable-bc-verify',
                             dest='disable_bc_verify',
                             help='Do not run the LLVM bitcode verifier',
                             action='store_true',
                             default=False)
+    preprocess.add_argument('--pp-cache',
+                            dest='pp_cache',
+                            metavar='<directory>',
+                            help='Cache the preprocessed bitcode in the given '
+                                 'directory, keyed by a hash of the input '
+                                 'bitcode and of the options',
+                            default=None)
+    preprocess.add_argument('--bc-cache',
+                            dest='bc_cache',
+                            metavar='<directory>',
+                            help='Cache the bitcode of each file of a '
+                                 'compilation database in the given '
+                                 'directory, keyed by a hash of the '
+                                 'preprocessed file and of the flags',
+                            default=None)
 
     # Import options
     imports = parser.add_argument_group('Import Options')
@@ -224,6 +589,25 @@ def parse_arguments(argv):
                               '(__ikos_assert, etc.)',
                          action='store_true',
                          default=False)
+    imports.add_argument('--lazy-import',
+                         dest='lazy_import',
+                         help='Only translate the functions reachable from '
+                              'the entry points (requires --proc=inter)',
+                         action='store_true',
+                         default=False)
+    imports.add_argument('--import-jobs',
+                         dest='import_jobs',
+                         metavar='<n>',
+                         help='Number of threads used to translate the '
+                              'function bodies from LLVM to AR (default: 1)',
+                         type=int,
+                         default=1)
+    imports.add_argument('--ar-cache',
+                         dest='ar_cache',
+                         metavar='<file>',
+                         help='Load the AR bundle from the given file, or '
+                              'save it there after the AR passes',
+                         default=None)
 
     # AR passes options
     passes = parser.add_argument_group('AR Passes Options')
@@ -237,11 +621,39 @@ def parse_arguments(argv):
                         help='Do not run the simplify-cfg pass',
                         action='store_true',
                         default=False)
+    passes.add_argument('--constant-propagation',
+                        dest='constant_propagation',
+                        help='Propagate integer constants and remove '
+                             'infeasible branches before the analysis',
+                        action='store_true',
+                        default=False)
+    passes.add_argument('--unroll-loops',
+                        dest='unroll_loops',
+                        metavar='<n>',
+                        help='Unroll the innermost loops running at most '
+                             '<n> iterations (default: 0, disabled)',
+                        type=int,
+                        default=0)
+    passes.add_argument('--slice',
+                        dest='slice',
+                        help='Remove the statements that the selected '
+                             'checkers do not depend on (only with dbz, shc, '
+                             'sio, uio and prover)',
+                        action='store_true',
+                        default=False)
     passes.add_argument('--no-simplify-upcast-comparison',
                         dest='no_simplify_upcast_comparison',
                         help='Do not run the simplify-upcast-comparison pass',
                         action='store_true',
                         default=False)
+    passes.add_argument('--pass-jobs',
+                        dest='pass_jobs',
+                        metavar='<n>',
+                        help='Number of threads used to verify the AR and '
+                             'run the AR passes on the functions '
+                             '(default: 1)',
+                        type=int,
+                        default=1)
 
     # Debug options
     debug = parser.add_argument_group('Debug Options')
@@ -306,6 +718,20 @@ def parse_arguments(argv):
                        metavar='<directory>',
                        help='Output directory for .dot files',
                        default=None)
+    debug.add_argument('--generate-dot-functions',
+                       dest='generate_dot_functions',
+                       metavar='<regex>',
+                       help='Only generate .dot files for the functions '
+                            'whose name matches the given regular expression',
+                       default=None)
+    debug.add_argument('--format-jobs',
+                       dest='format_jobs',
+                       metavar='<n>',
+                       help='Number of threads used to format the functions '
+                            'for --display-ar and --generate-dot '
+                            '(default: 1)',
+                       type=int,
+                       default=1)
     debug.add_argument('--save-temps',
                        dest='save_temps',
                        help='Do not delete temporary files',
@@ -380,6 +806,12 @@ def parse_arguments(argv):
                                        args.status_filters,
                                        args.default_status_filter),
                         action='append')
+    report.add_argument('--live-checks',
+                        dest='live_checks',
+                        help='Display the warnings and errors as soon as they '
+                             'are found, before the report',
+                        action='store_true',
+                        default=False)
     report.add_argument('--report-verbosity',
                         dest='report_verbosity',
                         metavar='[1-4]',
@@ -399,6 +831,36 @@ def parse_arguments(argv):
                           type=int,
                           help='MEM limit (MB)',
                           default=-1)
+    resource.add_argument('--mem-budget',
+                          dest='mem_budget',
+                          type=int,
+                          help='Stop the value analysis gracefully once it '
+                          'uses more than the given memory (MB)',
+                          default=0)
+    resource.add_argument('--mem-budget-fallback-domain',
+                          dest='mem_budget_fallback_domain',
+                          metavar='',
+                          choices=args.choices(args.domains),
+                          help='Abstract domain used to run the analysis '
+                          'again when the memory budget is exceeded',
+                          default=None)
+    resource.add_argument('--partitions',
+                          dest='partitions',
+                          metavar='<n>',
+                          type=int,
+                          help='Split the entry points (--proc=inter) or '
+                          'the functions (--proc=intra) in n partitions '
+                          'analyzed by concurrent workers, and merge their '
+                          'results',
+                          default=1)
+    resource.add_argument('--worker-command',
+                          dest='worker_command',
+                          metavar='<cmd>',
+                          help='Command prefix starting a worker, where '
+                          '{partition} is replaced by the partition number, '
+                          'e.g. "ssh node{partition}". The working directory '
+                          'must be shared with the workers, see --temp-dir',
+                          default=None)
 
     opt = parser.parse_args(argv)
 
@@ -410,10 +872,31 @@ def parse_arguments(argv):
                                        default=args.default_analyses,
                                        value=opt.analyses)
 
+    # parse --domain, keeping the order of the domains
+    domains = []
+    for domain in opt.domain.split(','):
+        domain = domain.strip()
+        if domain not in args.choices(args.domains):
+            parser.error("argument -d/--domain: invalid choice: '%s'" % domain)
+        if domain not in domains:
+            domains.append(domain)
+    opt.domain = ','.join(domains)
+
     # by default, the entry point is main
     if not opt.entry_points:
         opt.entry_points = ('main',)
 
+    # --partitions splits the entry points of an interprocedural analysis, or
+    # the functions of an intraprocedural analysis
+    if opt.partitions > 1:
+        if opt.procedural == 'summary':
+            parser.error('argument --partitions: not supported with '
+                         '--proc=summary')
+        if opt.output_format != 'db':
+            parser.error('argument --partitions: requires --output-format=db')
+        if opt.procedural == 'inter':
+            opt.partitions = min(opt.partitions, len(opt.entry_points))
+
     # verbosity changes the log level, if --log is not specified
     if opt.log_level is None:
         if opt.verbosity <= 0:
@@ -425,6 +908,34 @@ def parse_arguments(argv):
         else:
             opt.log_level = 'all'
 
+    # --checkpoint keeps its state next to the output database
+    opt.checkpoint = opt.checkpoint or opt.resume
+    if opt.checkpoint:
+        if opt.procedural != 'inter':
+            parser.error('argument --checkpoint: requires --proc=inter')
+        if (opt.output_format != 'db' or opt.db_profile == 'memory' or
+                opt.compact_checks or opt.aggregate_checks):
+            parser.error('argument --checkpoint: requires '
+                         '--output-format=db, without --db-profile=memory, '
+                         '--compact-checks and --aggregate-checks')
+        if opt.partitions > 1 or opt.mem_budget_fallback_domain:
+            parser.error('argument --checkpoint: not supported with '
+                         '--partitions and --mem-budget-fallback-domain')
+        opt.checkpoint_file = opt.output_db + '.checkpoint'
+        opt.resumed_db = opt.output_db + '.resumed'
+
+    # --incremental keeps its state next to the output database
+    if opt.incremental:
+        opt.incremental_dir = opt.output_db + '.incremental'
+        if not opt.result_cache and opt.procedural == 'intra':
+            opt.result_cache = os.path.join(opt.incremental_dir, 'results')
+        if not opt.ar_cache:
+            opt.ar_cache = os.path.join(opt.incremental_dir, 'bundle.ar')
+        if not opt.pp_cache:
+            opt.pp_cache = os.path.join(opt.incremental_dir, 'pp')
+        if not opt.bc_cache:
+            opt.bc_cache = os.path.join(opt.incremental_dir, 'bc')
+
     # default value for generate-dot-dir
     if opt.generate_dot and not opt.generate_dot_dir:
         if opt.temp_dir and opt.save_temps:
@@ -505,6 +1016,59 @@ def namer(path, ext, wd):
     return os.path.join(wd, os.path.splitext(base)[0] + ext)
 
 
+def write_perf_record(path, opt, start_date, bc_path, pp_path, db=None):
+    '''
+    Write a JSON record of the performance of the run in the given file
+
+    The analyzer passes, the program size and the profile totals come from
+    the output database, if any, as well as the number of checks.
+    '''
+    def file_size(path):
+        return os.path.getsize(path) if os.path.isfile(path) else None
+
+    record = {
+        'version': settings.VERSION,
+        'start-date': start_date.isoformat(' '),
+        'end-date': datetime.datetime.now().isoformat(' '),
+        'input': opt.file,
+        'domain': opt.domain,
+        'procedural': opt.procedural,
+        'bc-size': file_size(bc_path),
+        'pp-bc-size': file_size(pp_path),
+        'phases': {
+            name: {'time': elapsed, 'children-peak-rss': stats.peak_rss(name)}
+            for name, elapsed in stats.rows()
+        },
+    }
+
+    if db is not None:
+        keys = ('time', 'cycles', 'instructions', 'llc-misses',
+                'page-faults', 'max-rss-delta')
+        passes = {}
+        for row in db.load_timing_results():
+            if not row[0].startswith('ikos-analyzer.'):
+                continue
+            passes[row[0]] = {key: value
+                              for key, value in zip(keys, row[1:])
+                              if value is not None}
+        record['analyzer-passes'] = passes
+        for key in ('functions', 'statements'):
+            entry = passes.get('ikos-analyzer.ar.%s' % key)
+            record[key] = int(entry['time']) if entry else None
+        record['profile'] = db.load_profile_totals()
+        summary = report.generate_summary(db)
+        record['checks'] = {
+            'ok': summary.ok,
+            'error': summary.error,
+            'warning': summary.warning,
+            'unreachable': summary.unreachable,
+        }
+
+    with open(path, 'w') as f:
+        json.dump(record, f, indent=2, sort_keys=True)
+        f.write('\n')
+
+
 def signal_name(signum):
     ''' Return the signal name given the signal number '''
     for name, value in signal.__dict__.items():
@@ -543,9 +1107,17 @@ def clang_ikos_flags():
 # ikos toolchain #
 ##################
 
-def clang(bc_path, cpp_path, colors=True):
+def clang(bc_path, cpp_path, colors=True, flags=None, cwd=None):
+    '''
+    Compile the given source file to llvm bitcode
+
+    flags are the compilation flags of the project, or None to use the
+    default language standard. The command is run in the directory cwd.
+    '''
     cmd = [settings.clang()]
     cmd += clang_emit_llvm_flags()
+    if flags is not None:
+        cmd += flags
     cmd += clang_ikos_flags()
     cmd += [cpp_path,
             '-o',
@@ -559,25 +1131,165 @@ def clang(bc_path, cpp_path, colors=True):
     else:
         cmd.append('-fno-color-diagnostics')
 
-    if cpp_path.endswith('.cpp'):
+    if flags is None and cpp_path.endswith('.cpp'):
         cmd.append('-std=c++14')  # available because clang >= 4.0
 
     log.info('Compiling %s' % cpp_path)
     log.debug('Running %s' % command_string(cmd))
+    subprocess.check_call(cmd, cwd=cwd)
+
+
+def clang_cache_key(cpp_path, flags, cwd):
+    '''
+    Return the key of the given compilation in the bitcode cache
+
+    The key is a hash of the preprocessed source file, of the flags and of the
+    directory, which appears in the debug information.
+    '''
+    cmd = [settings.clang(), '-E']
+    cmd += flags
+    cmd += clang_ikos_flags()
+    cmd += ['-isystem', settings.INCLUDE_DIR, cpp_path]
+    log.debug('Running %s' % command_string(cmd))
+
+    h = hashlib.sha256()
+    h.update(subprocess.check_output(cmd, cwd=cwd))
+    for item in [settings.clang(), cwd] + flags:
+        h.update(b'\0')
+        h.update(item.encode('utf-8'))
+    return h.hexdigest()
+
+
+def compile_database(path):
+    '''
+    Return the translation units of the given compilation database, as a list
+    of (directory, source path, flags)
+
+    The output and dependency flags are removed. A source file compiled
+    several times is only kept once, since the bitcode files are linked.
+    '''
+    from ikos import scan
+
+    with open(path) as f:
+        entries = json.load(f)
+
+    units = []
+    seen = set()
+    for entry in entries:
+        directory = entry['directory']
+        if 'arguments' in entry:
+            cmd = entry['arguments']
+        else:
+            cmd = shlex.split(entry['command'])
+
+        parser = scan.ClangArgumentParser(cmd[1:])
+        if parser.skip_bitcode_gen():
+            continue
+
+        src_path = os.path.normpath(os.path.join(directory, entry['file']))
+        if src_path in seen:
+            continue
+        seen.add(src_path)
+
+        flags = []
+        if cmd[0].endswith('++'):
+            flags.append('--driver-mode=g++')
+        compile_args = iter(parser.compile_args)
+        for arg in compile_args:
+            if arg in scan.DEPENDENCY_FLAGS:
+                for _ in range(scan.DEPENDENCY_FLAGS[arg]):
+                    next(compile_args, None)
+            else:
+                flags.append(arg)
+
+        units.append((directory, src_path, flags))
+
+    return units
+
+
+def clang_compile_database(bc_path, db_path, wd, opt):
+    '''
+    Compile the files of the given compilation database to llvm bitcode on
+    opt.jobs threads, then link them into bc_path
+
+    If opt.bc_cache is set, the bitcode of a file is taken from the cache when
+    the preprocessed file and the flags did not change.
+    '''
+    units = compile_database(db_path)
+    if not units:
+        raise ValueError('no source file in %s' % db_path)
+
+    tu_dir = os.path.join(wd, 'tu')
+    if not os.path.isdir(tu_dir):
+        os.makedirs(tu_dir)
+    tu_paths = [namer('%d-%s' % (i, os.path.basename(src_path)), '.bc',
+                      tu_dir)
+                for i, (_, src_path, _) in enumerate(units)]
+
+    def build(i):
+        directory, src_path, flags = units[i]
+        if not opt.bc_cache:
+            clang(tu_paths[i], src_path, colors.ENABLE, flags, directory)
+            return
+
+        key = clang_cache_key(src_path, flags, directory)
+        cache_path = os.path.join(opt.bc_cache, key[:2], key + '.bc')
+        if os.path.isfile(cache_path):
+            log.debug('Using cached bitcode %s for %s'
+                      % (cache_path, src_path))
+            shutil.copyfile(cache_path, tu_paths[i])
+            return
+
+        clang(tu_paths[i], src_path, colors.ENABLE, flags, directory)
+
+        # copy in a temporary file, then rename it, so that concurrent runs
+        # never read a partial entry
+        if not os.path.isdir(os.path.dirname(cache_path)):
+            try:
+                os.makedirs(os.path.dirname(cache_path))
+            except OSError:
+                pass  # created by a concurrent thread
+        fd, tmp_path = tempfile.mkstemp(suffix='.tmp',
+                                        dir=os.path.dirname(cache_path))
+        os.close(fd)
+        shutil.copyfile(tu_paths[i], tmp_path)
+        os.rename(tmp_path, cache_path)
+
+    pool = ThreadPool(max(min(opt.jobs, len(units)), 1))
+    try:
+        pool.map(build, range(len(units)))
+    finally:
+        pool.close()
+        pool.join()
+
+    cmd = [settings.llvm_link()]
+    cmd += tu_paths
+    cmd += ['-o', bc_path]
+    log.info('Linking %d bitcode files' % len(tu_paths))
+    log.debug('Running %s' % command_string(cmd))
     subprocess.check_call(cmd)
 
 
-def ikos_pp(pp_path, bc_path, entry_points, opt_level, inline_all, verify):
+def ikos_pp(pp_path, bc_path, entry_points, opt_level, inline_all, verify,
+            cache_dir=None, inline_small=None):
     cmd = [settings.ikos_pp(),
            '-opt=%s' % opt_level,
            '-entry-points=%s' % ','.join(entry_points)]
 
     if inline_all:
         cmd.append('-inline-all')
+    elif inline_small:
+        max_size, max_call_sites = inline_small
+        cmd += ['-inline-small',
+                '-inline-max-size=%d' % max_size,
+                '-inline-max-call-sites=%d' % max_call_sites]
 
     if not verify:
         cmd.append('-disable-verify')
 
+    if cache_dir:
+        cmd.append('-cache-dir=%s' % os.path.abspath(cache_dir))
+
     cmd += [bc_path, '-o', pp_path]
 
     log.info('Running ikos preprocessor')
@@ -598,12 +1310,9 @@ class AnalyzerError(Exception):
         self.returncode = returncode
 
 
-def ikos_analyzer(db_path, pp_path, opt):
-    # Fix huge slow down when ikos-analyzer uses DROP TABLE on an existing db
-    if os.path.isfile(db_path):
-        os.remove(db_path)
-
-    cmd = [settings.ikos_analyzer()]
+def ikos_analyzer_options(opt):
+    ''' Return the options of ikos-analyzer, without the input and output '''
+    cmd = []
 
     # analysis options
     cmd += ['-a=%s' % ','.join(opt.analyses),
@@ -617,8 +1326,12 @@ def ikos_analyzer(db_path, pp_path, opt):
         cmd.append('-no-init-globals=%s' % ','.join(opt.no_init_globals))
     if opt.no_liveness:
         cmd.append('-no-liveness')
+    if opt.sparse_scalars:
+        cmd.append('-sparse-scalars')
     if opt.no_pointer:
         cmd.append('-no-pointer')
+    if opt.no_mod_ref:
+        cmd.append('-no-mod-ref')
     if opt.no_fixpoint_profiles:
         cmd.append('-no-fixpoint-profiles')
     if opt.hardware_addresses:
@@ -627,6 +1340,87 @@ def ikos_analyzer(db_path, pp_path, opt):
         cmd.append('-hardware-addresses-file=%s' % opt.hardware_addresses_file)
     if opt.argc is not None:
         cmd.append('-argc=%d' % opt.argc)
+    if opt.jobs > 1:
+        cmd.append('-jobs=%d' % opt.jobs)
+    if opt.fused_checks:
+        cmd.append('-fused-checks')
+    if opt.wto_jobs > 1:
+        cmd.append('-wto-jobs=%d' % opt.wto_jobs)
+    if opt.domain_jobs > 1:
+        cmd.append('-domain-jobs=%d' % opt.domain_jobs)
+    if opt.check_jobs > 1:
+        cmd.append('-check-jobs=%d' % opt.check_jobs)
+    if opt.stream_checks:
+        cmd.append('-stream-checks')
+    if opt.context_depth > 0:
+        cmd.append('-context-depth=%d' % opt.context_depth)
+    if opt.context_merge:
+        cmd.append('-context-merge=%s' % ','.join(opt.context_merge))
+    if opt.context_pointer_cache > 0:
+        cmd.append('-context-pointer-cache=%d' % opt.context_pointer_cache)
+    if opt.dyn_alloc_context_depth is not None:
+        cmd.append('-dyn-alloc-context-depth=%d'
+                   % opt.dyn_alloc_context_depth)
+    if opt.warm_start_cycles:
+        cmd.append('-warm-start-cycles')
+    if opt.smash_threshold > 0:
+        cmd.append('-smash-threshold=%d' % opt.smash_threshold)
+    if opt.array_segments != 1:
+        cmd.append('-array-segments=%d' % opt.array_segments)
+    if opt.gc_loop_heads:
+        cmd.append('-gc-loop-heads')
+    if opt.pointer_widening_threshold != 50:
+        cmd.append('-pointer-widening-threshold=%d'
+                   % opt.pointer_widening_threshold)
+    if opt.pointer_offsets != 'interval':
+        cmd.append('-pointer-offsets=%s' % opt.pointer_offsets)
+    if opt.type_function_pointers:
+        cmd.append('-type-function-pointers')
+    if opt.widening_delay != 1:
+        cmd.append('-widening-delay=%d' % opt.widening_delay)
+    if opt.narrowing_iterations > 0:
+        cmd.append('-narrowing-iterations=%d' % opt.narrowing_iterations)
+    if opt.function_time_budget > 0:
+        cmd.append('-function-time-budget=%d' % opt.function_time_budget)
+    if opt.function_iteration_budget > 0:
+        cmd.append('-function-iteration-budget=%d'
+                   % opt.function_iteration_budget)
+    if opt.function_invariant_budget > 0:
+        cmd.append('-function-invariant-budget=%d'
+                   % opt.function_invariant_budget)
+    if opt.assert_refine_domain:
+        cmd.append('-assert-refine-domain=%s' % opt.assert_refine_domain)
+    if opt.result_cache:
+        cmd.append('-result-cache=%s' % os.path.abspath(opt.result_cache))
+    if opt.profile_functions:
+        cmd.append('-profile-functions')
+    if opt.checkpoint:
+        cmd.append('-checkpoint=%s' % os.path.abspath(opt.checkpoint_file))
+        if opt.resume:
+            cmd.append('-resume')
+    if opt.perf_counters:
+        cmd.append('-perf-counters')
+    if opt.progress_file:
+        cmd.append('-progress-file=%s' % os.path.abspath(opt.progress_file))
+        if opt.progress_interval != 10:
+            cmd.append('-progress-interval=%d' % opt.progress_interval)
+    if opt.fixpoint_trace:
+        cmd.append('-fixpoint-trace=%s' % os.path.abspath(opt.fixpoint_trace))
+        if opt.fixpoint_trace_threshold != 100:
+            cmd.append('-fixpoint-trace-threshold=%d'
+                       % opt.fixpoint_trace_threshold)
+    if opt.mem_budget > 0:
+        cmd.append('-memory-budget=%d' % opt.mem_budget)
+    if opt.output_format != args.default_output_format:
+        cmd.append('-format=%s' % opt.output_format)
+    if opt.compact_checks:
+        cmd.append('-compact-checks')
+    if opt.aggregate_checks:
+        cmd.append('-aggregate-checks')
+    if opt.compress_db:
+        cmd.append('-compress-db')
+    if opt.db_profile != args.default_db_profile:
+        cmd.append('-db-profile=%s' % opt.db_profile)
 
     # import options
     if opt.no_libc:
@@ -635,6 +1429,12 @@ def ikos_analyzer(db_path, pp_path, opt):
         cmd.append('-no-libcpp')
     if opt.no_libikos:
         cmd.append('-no-libikos')
+    if opt.lazy_import:
+        cmd.append('-lazy-import')
+    if opt.import_jobs > 1:
+        cmd.append('-import-jobs=%d' % opt.import_jobs)
+    if opt.ar_cache:
+        cmd.append('-ar-cache=%s' % os.path.abspath(opt.ar_cache))
 
     # add -allow-dbg-mismatch if necessary
     if opt.opt_level in ('basic', 'aggressive'):
@@ -647,8 +1447,16 @@ def ikos_analyzer(db_path, pp_path, opt):
         cmd.append('-no-simplify-cfg')
     if opt.no_simplify_upcast_comparison:
         cmd.append('-no-simplify-upcast-comparison')
+    if opt.constant_propagation:
+        cmd.append('-constant-propagation')
+    if opt.unroll_loops > 0:
+        cmd.append('-unroll-loops=%d' % opt.unroll_loops)
+    if opt.slice:
+        cmd.append('-slice')
     if 'gauge' in opt.domain:
         cmd.append('-add-loop-counters')
+    if opt.pass_jobs > 1:
+        cmd.append('-pass-jobs=%d' % opt.pass_jobs)
 
     # debug options
     cmd += ['-display-checks=%s' % opt.display_checks,
@@ -666,6 +1474,11 @@ def ikos_analyzer(db_path, pp_path, opt):
         cmd.append('-display-fixpoint-profiles')
     if opt.generate_dot:
         cmd += ['-generate-dot', '-generate-dot-dir', opt.generate_dot_dir]
+        if opt.generate_dot_functions:
+            cmd.append('-generate-dot-functions=%s' %
+                       opt.generate_dot_functions)
+    if opt.format_jobs > 1:
+        cmd.append('-format-jobs=%d' % opt.format_jobs)
 
     # add -name-values if necessary
     if (opt.display_checks in ('all', 'fail') or
@@ -677,10 +1490,88 @@ def ikos_analyzer(db_path, pp_path, opt):
             opt.display_raw_checks):
         cmd.append('-name-values')
 
+    return cmd
+
+
+def log_progress(path):
+    ''' Log the innermost function and cycle of each thread, from the last
+    progress file written by ikos-analyzer '''
+    try:
+        with open(path) as f:
+            status = json.load(f)
+    except (IOError, ValueError):
+        return
+
+    log.error('Last progress: phase %s, after %.1fs'
+              % (status['phase'], status['elapsed']))
+    for thread in status['threads']:
+        if not thread['stack']:
+            continue
+        frame = thread['stack'][-1]
+        msg = 'Analyzing %s for %.1fs' % (frame['function'], frame['elapsed'])
+        if 'cycle' in frame:
+            msg += ', cycle %s (%s iteration %d)' % (
+                frame['cycle'],
+                'increasing' if frame['increasing'] else 'decreasing',
+                frame['iteration'])
+        log.error(msg)
+
+
+# Serializes the display of checks streamed by concurrent ikos-analyzer
+live_checks_lock = threading.Lock()
+
+
+def display_live_checks(fd):
+    ''' Display the checks written by ikos-analyzer on the given pipe '''
+    with os.fdopen(fd, 'r') as f:
+        for line in f:
+            try:
+                check = json.loads(line)
+            except ValueError:
+                continue  # partial line, ikos-analyzer was killed
+
+            if 'file' in check:
+                location = '%s:%d:%d' % (report.format_path(check['file']),
+                                         check['line'],
+                                         check['column'])
+            else:
+                location = check['function']
+
+            with live_checks_lock:
+                printf('%s: %s: %s in function %s\n',
+                       colors.bold(location),
+                       report.format_status(check['status']),
+                       check['checker'],
+                       check['function'],
+                       file=log.out)
+
+
+def ikos_analyzer(db_path, pp_path, opt, extra_args=(), launcher=()):
+    # Fix huge slow down when ikos-analyzer uses DROP TABLE on an existing db
+    if os.path.isfile(db_path):
+        os.remove(db_path)
+
+    cmd = list(launcher)
+    cmd.append(settings.ikos_analyzer())
+    cmd += ikos_analyzer_options(opt)
+    cmd += extra_args
+
     # misc. options
     cmd += ['-color=%s' % opt.color,
             '-log=%s' % opt.log_level]
 
+    # stream the checks on a pipe, if asked
+    popen_args = {}
+    live_checks = None
+    if (opt.live_checks and not launcher and
+            not sys.platform.startswith('win')):
+        read_fd, write_fd = os.pipe()
+        cmd.append('-stream-checks=/dev/fd/%d' % write_fd)
+        if sys.version_info[0] >= 3:
+            popen_args['pass_fds'] = (write_fd,)
+        live_checks = threading.Thread(target=display_live_checks,
+                                       args=(read_fd,))
+
     # input/output
     cmd += [pp_path, '-o', db_path]
 
@@ -698,15 +1589,22 @@ def ikos_analyzer(db_path, pp_path, opt):
     def kill(p):
         try:
             log.error('Timeout')
+            if opt.progress_file:
+                log_progress(opt.progress_file)
             p.send_signal(signal.SIGALRM)
         except OSError:
             pass
 
     log.info('Running ikos analyzer')
     log.debug('Running %s' % command_string(cmd))
-    p = subprocess.Popen(cmd, preexec_fn=set_limits)
+    p = subprocess.Popen(cmd, preexec_fn=set_limits, **popen_args)
     timer = threading.Timer(opt.cpu, kill, [p])
 
+    if live_checks is not None:
+        # the pipe is closed once ikos-analyzer exits
+        os.close(write_fd)
+        live_checks.start()
+
     if opt.cpu > 0:
         timer.start()
 
@@ -720,6 +1618,9 @@ def ikos_analyzer(db_path, pp_path, opt):
         if timer.isAlive():
             timer.cancel()
 
+        if live_checks is not None:
+            live_checks.join()
+
     # special case for Windows, since it does not define WIFEXITED & co.
     if sys.platform.startswith('win'):
         if return_status != 0:
@@ -745,6 +1646,182 @@ def ikos_analyzer(db_path, pp_path, opt):
                             signum)
 
 
+def ikos_analyzer_partitions(db_path, pp_path, wd, opt):
+    '''
+    Run ikos-analyzer on each partition of the entry points, concurrently, then
+    merge the output databases into db_path
+
+    In an intraprocedural analysis, the workers share a queue of the functions
+    instead, each function being analyzed by the first worker claiming it.
+    '''
+    base = copy.copy(opt)
+    extra_args = []
+    if opt.procedural == 'intra':
+        queue_dir = os.path.join(wd, 'function-queue')
+        if os.path.isdir(queue_dir):
+            shutil.rmtree(queue_dir)
+        extra_args.append('-function-queue=%s' % os.path.abspath(queue_dir))
+        if opt.result_cache:
+            log.warning('--result-cache is not supported with --partitions, '
+                        'ignoring it')
+            base.result_cache = None
+
+    if opt.lazy_import:
+        # the bundle depends on the entry points, it cannot be shared
+        base.ar_cache = None
+    else:
+        if not base.ar_cache:
+            base.ar_cache = os.path.join(wd, 'bundle.ar')
+
+        # translate the bitcode once, the workers load the saved bundle
+        log.info('Saving the AR bundle in %s' % base.ar_cache)
+        ikos_analyzer(os.path.join(wd, 'ar-cache.db'), pp_path, base,
+                      extra_args=['-ar-cache-only'])
+
+    shard_paths = [namer(db_path, '.part%d.db' % i, wd)
+                   for i in range(opt.partitions)]
+
+    def run(i):
+        part = copy.copy(base)
+        if opt.procedural == 'inter':
+            part.entry_points = opt.entry_points[i::opt.partitions]
+        if opt.progress_file:
+            part.progress_file = '%s.%d' % (opt.progress_file, i)
+        if opt.fixpoint_trace:
+            part.fixpoint_trace = '%s.%d' % (opt.fixpoint_trace, i)
+
+        launcher = ()
+        if opt.worker_command:
+            launcher = shlex.split(opt.worker_command.format(partition=i))
+
+        if opt.procedural == 'inter':
+            log.info('Analyzing partition %d: %s'
+                     % (i, ', '.join(part.entry_points)))
+        else:
+            log.info('Starting worker %d' % i)
+        ikos_analyzer(shard_paths[i], pp_path, part, extra_args=extra_args,
+                      launcher=launcher)
+
+    pool = ThreadPool(opt.partitions)
+    try:
+        pool.map(run, range(opt.partitions))
+    finally:
+        pool.close()
+        pool.join()
+
+    log.info('Merging the results of %d partitions' % opt.partitions)
+    shutil.copyfile(shard_paths[0], db_path)
+    merger = DatabaseMerger(db_path)
+    for path in shard_paths[1:]:
+        merger.merge(path)
+    merger.con.execute("UPDATE settings SET value = ? "
+                       "WHERE name = 'entry-points'",
+                       (json.dumps(list(opt.entry_points)),))
+    merger.con.commit()
+    merger.close()
+
+
+def incremental_fingerprint(pp_path, opt):
+    ''' Return a hash of the preprocessed bitcode and the analyzer options '''
+    h = hashlib.sha256()
+    with open(pp_path, 'rb') as f:
+        for chunk in iter(lambda: f.read(1 << 20), b''):
+            h.update(chunk)
+    h.update(b'\0'.join(arg.encode('utf-8')
+                         for arg in ikos_analyzer_options(opt)))
+    return h.hexdigest()
+
+
+def incremental_state_path(opt):
+    ''' Return the path of the file holding the fingerprint of the last run '''
+    return os.path.join(opt.incremental_dir, 'fingerprint')
+
+
+def incremental_up_to_date(opt, fingerprint):
+    ''' Return True if the output database matches the given fingerprint '''
+    if opt.output_format != 'db' or not os.path.isfile(opt.output_db):
+        return False
+
+    try:
+        with open(incremental_state_path(opt)) as f:
+            return f.read().strip() == fingerprint
+    except IOError:
+        return False
+
+
+def incremental_save(opt, fingerprint):
+    ''' Record the fingerprint of the output database '''
+    if not os.path.isdir(opt.incremental_dir):
+        os.makedirs(opt.incremental_dir)
+
+    with open(incremental_state_path(opt), 'w') as f:
+        f.write(fingerprint + '\n')
+
+
+def checkpoint_next_id(checkpoint_path):
+    '''
+    Return the id of the first check written after the last checkpoint of the
+    last run, or None if there is no checkpoint file
+    '''
+    if not os.path.isfile(checkpoint_path):
+        return None
+
+    next_id = 0
+    with open(checkpoint_path) as f:
+        for line in f:
+            fields = line.rstrip('\n').split('\t', 3)
+            if fields[0] == 'run':
+                next_id = 0
+            elif fields[0] == 'entry-point' and len(fields) == 4:
+                next_id = int(fields[2])
+    return next_id
+
+
+def checkpoint_collect(opt):
+    '''
+    Move the results of an interrupted run with --checkpoint into
+    opt.resumed_db, without the checks of the entry point it was analyzing
+    '''
+    next_id = checkpoint_next_id(opt.checkpoint_file)
+    if next_id is None or not os.path.isfile(opt.output_db):
+        return
+
+    con = sqlite3.connect(opt.output_db)
+    try:
+        con.execute('DELETE FROM checks WHERE id >= ?', (next_id,))
+        con.commit()
+    except sqlite3.DatabaseError as e:
+        log.warning('Ignoring the interrupted run in %s: %s'
+                    % (opt.output_db, e))
+        return
+    finally:
+        con.close()
+
+    log.info('Keeping the results of the interrupted run in %s'
+             % opt.resumed_db)
+    if not os.path.isfile(opt.resumed_db):
+        shutil.move(opt.output_db, opt.resumed_db)
+    else:
+        merger = DatabaseMerger(opt.resumed_db)
+        merger.merge(opt.output_db)
+        merger.close()
+        os.remove(opt.output_db)
+
+
+def checkpoint_finish(opt):
+    '''
+    Merge the results of the interrupted runs into the output database, once
+    the analysis is complete
+    '''
+    if os.path.isfile(opt.resumed_db):
+        log.info('Merging the results of the interrupted runs')
+        merger = DatabaseMerger(opt.output_db)
+        merger.merge(opt.resumed_db)
+        merger.close()
+        os.remove(opt.resumed_db)
+    os.remove(opt.checkpoint_file)
+
+
 def ikos_view(opt, db):
     from ikos import view
     v = view.View(db)
@@ -767,7 +1844,8 @@ def main(argv):
     colors.setup(opt.color, file=log.out)
     log.setup(opt.log_level)
 
-    if opt.domain.startswith('apron-') and not settings.HAS_APRON:
+    if (any(domain.startswith('apron-') for domain in opt.domain.split(','))
+            and not settings.HAS_APRON):
         printf('%s: error: cannot use apron abstract domains.\n'
                'ikos was compiled without apron support, '
                'see analyzer/README.md\n',
@@ -793,6 +1871,24 @@ def main(argv):
 
         input_path = bc_path
 
+    # compile and link the files of a compilation database
+    if path_ext(input_path) == '.json':
+        bc_path = namer(opt.file, '.bc', wd)
+
+        try:
+            with stats.timer('clang'):
+                clang_compile_database(bc_path, input_path, wd, opt)
+        except (IOError, ValueError, KeyError) as e:
+            printf('%s: error: invalid compilation database %s: %s\n',
+                   progname, input_path, e, file=sys.stderr)
+            sys.exit(1)
+        except subprocess.CalledProcessError as e:
+            printf('%s: error while compiling %s, abort.\n',
+                   progname, input_path, file=sys.stderr)
+            sys.exit(e.returncode)
+
+        input_path = bc_path
+
     if path_ext(input_path) != '.bc':
         printf('%s: error: unexpected file extension.\n',
                progname, file=sys.stderr)
@@ -804,7 +1900,10 @@ def main(argv):
         with stats.timer('ikos-pp'):
             ikos_pp(pp_path, input_path,
                     opt.entry_points, opt.opt_level,
-                    opt.inline_all, not opt.disable_bc_verify)
+                    opt.inline_all, not opt.disable_bc_verify,
+                    opt.pp_cache,
+                    (opt.inline_max_size, opt.inline_max_call_sites)
+                    if opt.inline_small else None)
     except subprocess.CalledProcessError as e:
         printf('%s: error while preprocessing llvm bitcode, abort.\n',
                progname, file=sys.stderr)
@@ -814,45 +1913,110 @@ def main(argv):
     if opt.display_llvm:
         display_llvm(pp_path)
 
+    # --incremental: skip the analysis if nothing changed
+    fingerprint = None
+    up_to_date = False
+    if opt.incremental:
+        fingerprint = incremental_fingerprint(pp_path, opt)
+        up_to_date = incremental_up_to_date(opt, fingerprint)
+        if up_to_date:
+            log.info('Program and options unchanged, reusing %s'
+                     % opt.output_db)
+        else:
+            # a failed run must not leave a stale fingerprint behind
+            if os.path.isfile(incremental_state_path(opt)):
+                os.remove(incremental_state_path(opt))
+
     # ikos-analyzer: analyze llvm bitcode
-    try:
-        with stats.timer('ikos-analyzer'):
-            ikos_analyzer(opt.output_db, pp_path, opt)
-    except AnalyzerError as e:
-        printf('%s: error: %s\n', progname, e, file=sys.stderr)
-        sys.exit(e.returncode)
+    def analyze(db_path, pp_path, opt):
+        if opt.partitions > 1:
+            ikos_analyzer_partitions(db_path, pp_path, wd, opt)
+        else:
+            ikos_analyzer(db_path, pp_path, opt)
+
+    # --checkpoint: keep the results of the interrupted runs
+    if opt.checkpoint and not up_to_date:
+        if opt.resume:
+            checkpoint_collect(opt)
+        elif os.path.isfile(opt.resumed_db):
+            os.remove(opt.resumed_db)
+
+    if not up_to_date:
+        try:
+            with stats.timer('ikos-analyzer'):
+                try:
+                    analyze(opt.output_db, pp_path, opt)
+                except AnalyzerError as e:
+                    # exit code 10: the memory budget is exceeded
+                    fallback = opt.mem_budget_fallback_domain
+                    if e.returncode != 10 or fallback is None:
+                        raise
+                    log.warning('Memory budget exceeded, analyzing again '
+                                'with domain %s' % fallback)
+                    opt.domain = fallback
+                    if opt.incremental:
+                        fingerprint = incremental_fingerprint(pp_path, opt)
+                    analyze(opt.output_db, pp_path, opt)
+        except AnalyzerError as e:
+            printf('%s: error: %s\n', progname, e, file=sys.stderr)
+            sys.exit(e.returncode)
+
+        if opt.checkpoint:
+            checkpoint_finish(opt)
+
+    # the checks were streamed into opt.output_db, there is no database
+    if opt.output_format != 'db':
+        if opt.perf_record:
+            write_perf_record(opt.perf_record, opt, start_date, input_path,
+                              pp_path)
+        return
 
     # open output database
     db = OutputDatabase(path=opt.output_db)
 
-    # insert timing results in the database
-    db.insert_timing_results(stats.rows())
-
-    # insert settings in the database
-    settings_rows = [
-        ('version', settings.VERSION),
-        ('start-date', start_date.isoformat(' ')),
-        ('end-date', datetime.datetime.now().isoformat(' ')),
-        ('working-directory', wd),
-        ('input', opt.file),
-        ('bc-file', input_path),
-        ('pp-bc-file', pp_path),
-        ('clang', settings.clang()),
-        ('ikos-pp', settings.ikos_pp()),
-        ('opt-level', opt.opt_level),
-        ('inline-all', json.dumps(opt.inline_all)),
-        ('use-libc-intrinsics', json.dumps(not opt.no_libc)),
-        ('use-libcpp-intrinsics', json.dumps(not opt.no_libcpp)),
-        ('use-libikos-intrinsics', json.dumps(not opt.no_libikos)),
-        ('use-simplify-cfg', json.dumps(not opt.no_simplify_cfg)),
-        ('use-simplify-upcast-comparison',
-         json.dumps(not opt.no_simplify_upcast_comparison)),
-    ]
-    if opt.cpu > 0:
-        settings_rows.append(('cpu-limit', opt.cpu))
-    if opt.mem > 0:
-        settings_rows.append(('mem-limit', opt.mem))
-    db.insert_settings(settings_rows)
+    # the timing results and settings of a reused database are kept
+    if not up_to_date:
+        # insert timing results in the database
+        db.insert_timing_results(stats.rows())
+
+        # insert settings in the database
+        settings_rows = [
+            ('version', settings.VERSION),
+            ('start-date', start_date.isoformat(' ')),
+            ('end-date', datetime.datetime.now().isoformat(' ')),
+            ('working-directory', wd),
+            ('input', opt.file),
+            ('bc-file', input_path),
+            ('pp-bc-file', pp_path),
+            ('clang', settings.clang()),
+            ('ikos-pp', settings.ikos_pp()),
+            ('opt-level', opt.opt_level),
+            ('inline-all', json.dumps(opt.inline_all)),
+            ('inline-small', json.dumps(opt.inline_small)),
+            ('use-libc-intrinsics', json.dumps(not opt.no_libc)),
+            ('use-libcpp-intrinsics', json.dumps(not opt.no_libcpp)),
+            ('use-libikos-intrinsics', json.dumps(not opt.no_libikos)),
+            ('use-lazy-import', json.dumps(opt.lazy_import)),
+            ('use-simplify-cfg', json.dumps(not opt.no_simplify_cfg)),
+            ('use-simplify-upcast-comparison',
+             json.dumps(not opt.no_simplify_upcast_comparison)),
+            ('use-constant-propagation',
+             json.dumps(opt.constant_propagation)),
+            ('unroll-loops', opt.unroll_loops),
+            ('use-slicing', json.dumps(opt.slice)),
+        ]
+        if opt.cpu > 0:
+            settings_rows.append(('cpu-limit', opt.cpu))
+        if opt.mem > 0:
+            settings_rows.append(('mem-limit', opt.mem))
+        db.insert_settings(settings_rows)
+
+        if opt.incremental:
+            incremental_save(opt, fingerprint)
+
+    if opt.perf_record:
+        write_perf_record(opt.perf_record, opt, start_date, input_path,
+                          pp_path, db)
 
     first = (log.LEVEL >= log.ERROR)
 
@@ -897,6 +2061,8 @@ def main(argv):
         rep = report.generate_report(db,
                                      status_filter=opt.status_filter,
                                      analyses_filter=None)
+        if opt.format in ('text', 'csv'):
+            report.generate_messages(rep, opt.report_verbosity, opt.jobs)
 
         # format report
         formatter_class = report.formats[opt.format]
@@ -176,8 +176,12 @@ domains = (
      'Congruence domain'),
     ('interval-congruence',
      'Reduced product of Interval and Congruence'),
+    ('interval-congruence-known-bits',
+     'Reduced product of Interval, Congruence and Known Bits'),
     ('dbm',
      'Difference-Bound Matrices domain'),
+    ('sdbm',
+     'Sparse Difference-Bound Matrices domain'),
     ('var-pack-dbm',
      'Difference-Bound Matrices domain with variable packing'),
     ('var-pack-dbm-congruence',
@@ -217,11 +221,17 @@ domains = (
 
 default_domain = 'interval'
 
+# Relational domains used to check unproved assertions again
+assert_refine_domains = ('dbm', 'var-pack-dbm', 'apron-octagon',
+                         'var-pack-apron-octagon')
+
 globals_init_policies = (
     ('all', 'Initialize all global variables'),
     ('skip-big-arrays', 'Initialize all global variables except big arrays'),
     ('skip-strings', 'Initialize all global variables except strings'),
     ('none', 'Do not initialize any global variable'),
+    ('lazy', 'Initialize only the global variables used by the code reachable'
+             ' from the entry points'),
 )
 
 default_globals_init_policy = 'skip-big-arrays'
@@ -237,10 +247,29 @@ default_precision_level = 'mem'
 proceduralities = (
     ('inter', 'Interprocedural analysis'),
     ('intra', 'Intraprocedural analysis'),
+    ('summary', 'Bottom-up analysis using function summaries'),
 )
 
 default_procedurality = 'inter'
 
+# Output database options choices
+
+db_profiles = (
+    ('fast', 'No journal and large transactions'),
+    ('safe', 'Journal and synchronous writes, small transactions'),
+    ('memory', 'Build the database in memory, write it at exit'),
+)
+
+default_db_profile = 'fast'
+
+output_formats = (
+    ('db', 'SQLite database'),
+    ('jsonl', 'Stream non-ok checks as newline-delimited JSON'),
+    ('sarif', 'Stream non-ok checks as a SARIF log'),
+)
+
+default_output_format = 'db'
+
 # Preprocessing options choices
 
 opt_levels = (
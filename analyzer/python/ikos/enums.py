@@ -369,3 +369,5 @@ class ChecksTable:
     OPERANDS = auto()
     CALL_CONTEXT_ID = auto()
     INFO = auto()
+    DOMAIN = auto()
+    CALL_CONTEXT_IDS = auto()
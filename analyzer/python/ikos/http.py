@@ -42,11 +42,18 @@
 try:
     # Python 3
     from http.server import HTTPServer, BaseHTTPRequestHandler
+    from socketserver import ThreadingMixIn
     from urllib.parse import parse_qs, urlencode
     from urllib.request import urlopen
 except ImportError:
     # Python 2
     from BaseHTTPServer import HTTPServer, BaseHTTPRequestHandler
+    from SocketServer import ThreadingMixIn
     from urlparse import parse_qs
     from urllib import urlencode
     from urllib2 import urlopen
+
+
+class ThreadingHTTPServer(ThreadingMixIn, HTTPServer):
+    ''' HTTP server handling each request in a new thread '''
+    daemon_threads = True
@@ -40,11 +40,19 @@
 #
 ###############################################################################
 import collections
+import itertools
 import json
+import operator
+import os.path
+import re
 import sqlite3
+import struct
+import sys
+import zlib
 
 from ikos.enums import FilesTable, FunctionsTable, StatementsTable, \
-    CallContextsTable, OperandsTable, MemoryLocationsTable, ChecksTable
+    CallContextsTable, OperandsTable, MemoryLocationsTable, ChecksTable, \
+    MemoryLocationKind
 
 
 class CachedProperty(object):
@@ -61,11 +69,98 @@ class CachedProperty(object):
 
 
 class OutputDatabase(object):
-    ''' Represents an output database '''
+    '''
+    Represents an output database
 
-    def __init__(self, path):
+    If lazy is True, the rows of the files, functions, statements, operands,
+    call contexts and memory locations tables are fetched on demand instead
+    of being loaded at the first access.
+
+    If read_only is True, the database file is memory mapped and a larger page
+    cache is used, which is faster for the queries of the reports on large
+    databases.
+    '''
+
+    # Maximum size of the memory mapped part of the database, in bytes
+    # SQLite caps it at its compile-time limit, 2GB by default
+    MMAP_SIZE = 1 << 34
+
+    # Size of the page cache of a read-only connection, in KiB
+    CACHE_SIZE = 256 * 1024
+
+    def __init__(self, path, lazy=False, read_only=False):
         self.path = path
-        self.con = sqlite3.connect(path)
+        self.lazy = lazy
+        self.read_only = read_only
+        if read_only:
+            self.con = _connect_read_only(path)
+            self.con.execute('PRAGMA mmap_size = %d' % self.MMAP_SIZE)
+            self.con.execute('PRAGMA cache_size = -%d' % self.CACHE_SIZE)
+        else:
+            self.con = sqlite3.connect(path)
+        _enable_decompression(self.con)
+
+    # Indexes used to query a database on demand, as (table, columns)
+    # The statements index covers the ordering of the reports by location.
+    INDEXES = (
+        ('statements', 'file_id, line, "column", id'),
+        ('checks', 'statement_id, call_context_id'),
+        ('checks', 'status'),
+        ('checks', 'kind'),
+    )
+
+    @staticmethod
+    def index_name(table, columns):
+        ''' Return the name of an index, as created by ikos-analyzer '''
+        columns = re.sub(r'[^A-Za-z0-9_,]', '', columns).replace(',', '_')
+        return 'index_%s_%s' % (table, columns)
+
+    def create_indexes(self):
+        '''
+        Create the indexes needed by the queries on demand, if they are missing
+
+        Recent versions of ikos-analyzer already create these indexes. A
+        read-only database is opened for writing only if an index is missing.
+        '''
+        c = self.con.cursor()
+        c.execute("SELECT name FROM sqlite_master WHERE type = 'index'")
+        existing = set(name for name, in c)
+        missing = [(table, columns) for table, columns in self.INDEXES
+                   if self.index_name(table, columns) not in existing]
+        if not missing:
+            return
+
+        con = sqlite3.connect(self.path) if self.read_only else self.con
+        for table, columns in missing:
+            con.execute('CREATE INDEX IF NOT EXISTS %s ON %s(%s)'
+                        % (self.index_name(table, columns), table, columns))
+        con.commit()
+        if con is not self.con:
+            con.close()
+
+    def attach(self, path, schema):
+        '''
+        Attach another output database to the connection, under the given
+        schema name
+
+        The attached database is opened read-only if this database is.
+        '''
+        uri = _read_only_uri(path) if self.read_only else None
+        self.con.execute('ATTACH DATABASE ? AS %s' % schema, (uri or path,))
+        _enable_decompression(self.con, schema)
+
+    def load_check_kinds(self):
+        ''' Return the sorted list of check kinds in the checks table '''
+        # Walk through the index on checks.kind, one distinct value at a time
+        c = self.con.cursor()
+        kinds = []
+        c.execute('SELECT MIN(kind) FROM checks')
+        kind, = c.fetchone()
+        while kind is not None:
+            kinds.append(kind)
+            c.execute('SELECT MIN(kind) FROM checks WHERE kind > ?', (kind,))
+            kind, = c.fetchone()
+        return kinds
 
     def close(self):
         self.con.close()
@@ -93,20 +188,127 @@ class OutputDatabase(object):
     def load_timing_results(self, full=True, sort=True):
         '''
         Load the timing results from the database,
-        as a list of tuples (pass, elapsed)
+        as a list of tuples (pass, elapsed, cycles, instructions, llc_misses,
+        page_faults, max_rss_delta)
+
+        The performance counters are None unless the analysis ran with
+        --perf-counters.
         '''
         c = self.con.cursor()
         where = "WHERE pass NOT LIKE '%ikos-analyzer.%'" if not full else ''
         order_by = 'ORDER BY pass' if sort else ''
-        c.execute('SELECT pass, time FROM times %s %s' % (where, order_by))
+        c.execute('SELECT pass, time, cycles, instructions, llc_misses, '
+                  'page_faults, max_rss_delta FROM times %s %s'
+                  % (where, order_by))
         return c.fetchall()
 
     def insert_timing_results(self, rows):
         ''' Insert the timing results into the database '''
         c = self.con.cursor()
-        c.executemany('INSERT INTO times VALUES (?, ?)', rows)
+        c.executemany('INSERT INTO times (pass, time) VALUES (?, ?)', rows)
         self.con.commit()
 
+    def load_ok_statements_count(self, domain=None):
+        '''
+        Return the number of statements with only ok checks that are not
+        stored in the checks table (see --compact-checks)
+        '''
+        c = self.con.cursor()
+        c.execute("SELECT name FROM sqlite_master "
+                  "WHERE type = 'table' AND name = 'check_counters'")
+        if c.fetchone() is None:
+            return 0
+
+        if domain is None:
+            c.execute('SELECT SUM(count) FROM check_counters '
+                      'WHERE checker IS NULL')
+        else:
+            c.execute('SELECT SUM(count) FROM check_counters '
+                      'WHERE checker IS NULL AND domain = ?', (domain,))
+        count, = c.fetchone()
+        return count or 0
+
+    def load_profile(self, limit, domain=None):
+        '''
+        Return the `limit` function analyses with the largest exclusive time,
+        as a list of tuples (function_id, call_context_id, runs,
+        inclusive_time, exclusive_time, iterations, widenings, narrowings,
+        narrowing_capped_loops, peak_invariant_size, peak_invariant_bytes,
+        peak_integer_bytes, peak_pointer_bytes, gmp_allocations)
+        '''
+        c = self.con.cursor()
+        c.execute("SELECT name FROM sqlite_master "
+                  "WHERE type = 'table' AND name = 'profile'")
+        if c.fetchone() is None:
+            return []
+
+        columns = ('function_id, call_context_id, runs, inclusive_time, '
+                   'exclusive_time, iterations, widenings, narrowings, '
+                   'narrowing_capped_loops, peak_invariant_size, '
+                   'peak_invariant_bytes, peak_integer_bytes, '
+                   'peak_pointer_bytes, gmp_allocations')
+        if domain is None:
+            c.execute('SELECT %s FROM profile '
+                      'ORDER BY exclusive_time DESC LIMIT ?' % columns,
+                      (limit,))
+        else:
+            c.execute('SELECT %s FROM profile WHERE domain = ? '
+                      'ORDER BY exclusive_time DESC LIMIT ?' % columns,
+                      (domain, limit))
+        return c.fetchall()
+
+    def load_profile_totals(self):
+        '''
+        Return the totals of the function profiles, as a dictionary, or None
+        if the analysis did not run with --profile-functions
+        '''
+        if not _has_table(self.con, 'profile'):
+            return None
+
+        c = self.con.cursor()
+        c.execute('SELECT COUNT(*), SUM(runs), SUM(iterations), '
+                  'SUM(widenings), SUM(narrowings), SUM(gmp_allocations), '
+                  'MAX(peak_invariant_size), MAX(peak_invariant_bytes) '
+                  'FROM profile')
+        keys = ('function_analyses', 'runs', 'iterations', 'widenings',
+                'narrowings', 'gmp_allocations', 'peak_invariant_size',
+                'peak_invariant_bytes')
+        return dict(zip(keys, c.fetchone()))
+
+    def load_downgrades(self, domain=None):
+        '''
+        Return the functions analyzed as unknown calls because they exceeded
+        their budget, as a list of tuples (function_id, call_context_id,
+        budget)
+        '''
+        c = self.con.cursor()
+        c.execute("SELECT name FROM sqlite_master "
+                  "WHERE type = 'table' AND name = 'downgrades'")
+        if c.fetchone() is None:
+            return []
+
+        if domain is None:
+            c.execute('SELECT function_id, call_context_id, budget '
+                      'FROM downgrades')
+        else:
+            c.execute('SELECT function_id, call_context_id, budget '
+                      'FROM downgrades WHERE domain = ?', (domain,))
+        return c.fetchall()
+
+    def load_domains(self):
+        '''
+        Return the abstract domains of the checks, if several domains were
+        analyzed in the same run, otherwise an empty list
+        '''
+        c = self.con.cursor()
+        c.execute("SELECT value FROM settings "
+                  "WHERE name = 'machine-int-domains'")
+        row = c.fetchone()
+        if row is None:
+            return []
+
+        return json.loads(row[0])
+
     @CachedProperty
     def files(self):
         return self._fetch_table('files', File)
@@ -132,11 +334,52 @@ class OutputDatabase(object):
         return self._fetch_table('memory_locations', MemoryLocation)
 
     def _fetch_table(self, table, klass):
+        if self.lazy:
+            return LazyTable(self, table, klass)
+
         c = self.con.cursor()
         c.execute('SELECT * FROM %s ORDER BY id' % table)
         return [klass(row, self) for row in c]
 
 
+class LazyTable(object):
+    ''' A table whose rows are fetched by id on demand, and then cached '''
+
+    def __init__(self, db, table, klass):
+        self._db = db
+        self._table = table
+        self._klass = klass
+        self._cache = {}
+
+    def __getitem__(self, id):
+        try:
+            return self._cache[id]
+        except KeyError:
+            pass
+
+        c = self._db.con.cursor()
+        c.execute('SELECT * FROM %s WHERE id = ?' % self._table, (id,))
+        row = c.fetchone()
+        if row is None:
+            raise IndexError('%s: no row with id %d' % (self._table, id))
+
+        obj = self._klass(row, self._db)
+        self._cache[id] = obj
+        return obj
+
+    def __iter__(self):
+        c = self._db.con.cursor()
+        c.execute('SELECT * FROM %s ORDER BY id' % self._table)
+        for row in c:
+            yield self._klass(row, self._db)
+
+    def __len__(self):
+        c = self._db.con.cursor()
+        c.execute('SELECT COUNT(*) FROM %s' % self._table)
+        count, = c.fetchone()
+        return count
+
+
 class File(object):
     ''' Represents a source file '''
 
@@ -384,3 +627,390 @@ class Check(object):
         operands = json.loads(self.operands)
         return [NumOperandPair(num, self.db.operands[id])
                 for num, id in operands]
+
+
+def expand_check(row):
+    '''
+    Return the rows of a check, one per calling context
+
+    With --aggregate-checks, a row holds the check for all the calling
+    contexts in call_context_id and call_context_ids.
+    '''
+    if not row[ChecksTable.CALL_CONTEXT_IDS]:
+        return [row]
+
+    context_ids = [row[ChecksTable.CALL_CONTEXT_ID]]
+    context_ids.extend(json.loads(row[ChecksTable.CALL_CONTEXT_IDS]))
+    rows = []
+    for context_id in context_ids:
+        expanded = list(row)
+        expanded[ChecksTable.CALL_CONTEXT_ID] = context_id
+        expanded[ChecksTable.CALL_CONTEXT_IDS] = None
+        rows.append(tuple(expanded))
+    return rows
+
+
+def expand_checks(rows):
+    '''
+    Expand the rows of the checks table into one row per calling context
+
+    The rows must be sorted by statement and calling context, the expanded
+    rows are sorted the same way.
+    '''
+    stmt_id_key = operator.itemgetter(ChecksTable.STATEMENT_ID)
+    context_id_key = operator.itemgetter(ChecksTable.CALL_CONTEXT_ID)
+
+    for _, statement_rows in itertools.groupby(rows, key=stmt_id_key):
+        statement_rows = list(statement_rows)
+        if any(row[ChecksTable.CALL_CONTEXT_IDS] for row in statement_rows):
+            statement_rows = [expanded
+                              for row in statement_rows
+                              for expanded in expand_check(row)]
+            statement_rows.sort(key=context_id_key)
+        for row in statement_rows:
+            yield row
+
+
+class DatabaseMerger(object):
+    '''
+    Merge the output databases of several runs, on the same program or on
+    programs sharing source files
+
+    The rows of the files, functions, statements, operands, call contexts and
+    memory locations tables are identified by their content rather than their
+    id, since ids depend on the order in which each run inserted them. Rows
+    that are identical after translating their references are inserted once,
+    including the checks of the functions analyzed by several runs.
+    '''
+
+    def __init__(self, path):
+        self.con = sqlite3.connect(path)
+        _enable_decompression(self.con)
+        self.files = {}
+        self.functions = {}
+        self.statements = {}
+        self.operands = {}
+        self.call_contexts = {}
+        self.memory_locations = {}
+        self.checks = set()
+        self.next_id = {}
+
+        c = self.con.cursor()
+        for table, key in (('files', self._file_key),
+                           ('functions', self._function_key),
+                           ('statements', self._statement_key),
+                           ('operands', self._operand_key),
+                           ('call_contexts', self._call_context_key),
+                           ('memory_locations', self._memory_location_key)):
+            ids = getattr(self, table)
+            c.execute('SELECT * FROM %s' % table)
+            for row in c:
+                ids[key(row)] = row[0]
+            c.execute('SELECT MAX(id) FROM %s' % table)
+            max_id, = c.fetchone()
+            self.next_id[table] = (max_id or 0) + 1
+
+        c.execute('SELECT * FROM checks')
+        for row in c:
+            self.checks.add(self._check_key(row))
+        c.execute('SELECT MAX(id) FROM checks')
+        max_id, = c.fetchone()
+        self.next_id['checks'] = (max_id or 0) + 1
+
+    @staticmethod
+    def _file_key(row):
+        return row[FilesTable.PATH]
+
+    @staticmethod
+    def _function_key(row):
+        # distinct programs can define static functions with the same name
+        return (row[FunctionsTable.NAME], row[FunctionsTable.FILE_ID])
+
+    @staticmethod
+    def _statement_key(row):
+        return tuple(row[1:])
+
+    @staticmethod
+    def _operand_key(row):
+        return tuple(row[1:])
+
+    @staticmethod
+    def _call_context_key(row):
+        return tuple(row[1:])
+
+    @staticmethod
+    def _memory_location_key(row):
+        return (row[MemoryLocationsTable.KIND],
+                _canonical_json(row[MemoryLocationsTable.INFO]))
+
+    @staticmethod
+    def _check_key(row):
+        return (tuple(row[ChecksTable.KIND:ChecksTable.OPERANDS]) +
+                (_canonical_json(row[ChecksTable.OPERANDS]),
+                 row[ChecksTable.CALL_CONTEXT_ID],
+                 _canonical_json(row[ChecksTable.INFO]),
+                 row[ChecksTable.DOMAIN],
+                 row[ChecksTable.CALL_CONTEXT_IDS]))
+
+    def _insert(self, table, key, row):
+        ''' Insert a row (without its id) unless it exists, return its id '''
+        ids = getattr(self, table)
+        id = ids.get(key)
+        if id is None:
+            id = self.next_id[table]
+            self.next_id[table] = id + 1
+            self.con.execute('INSERT INTO %s VALUES (%s)'
+                             % (table, ', '.join('?' * (len(row) + 1))),
+                             (id,) + tuple(row))
+            ids[key] = id
+        return id
+
+    def merge(self, path):
+        ''' Merge the database at the given path '''
+        other = sqlite3.connect(path)
+        _enable_decompression(other)
+        c = other.cursor()
+
+        files = {None: None}
+        c.execute('SELECT * FROM files')
+        for row in c:
+            files[row[0]] = self._insert('files', self._file_key(row), row[1:])
+
+        functions = {None: None}
+        c.execute('SELECT * FROM functions')
+        for row in c:
+            row = list(row)
+            row[FunctionsTable.FILE_ID] = files[row[FunctionsTable.FILE_ID]]
+            functions[row[0]] = self._insert('functions',
+                                             self._function_key(row),
+                                             row[1:])
+
+        statements = {None: None}
+        c.execute('SELECT * FROM statements')
+        for row in c:
+            row = list(row)
+            row[StatementsTable.FUNCTION_ID] = \
+                functions[row[StatementsTable.FUNCTION_ID]]
+            row[StatementsTable.FILE_ID] = files[row[StatementsTable.FILE_ID]]
+            statements[row[0]] = self._insert('statements',
+                                              self._statement_key(row),
+                                              row[1:])
+
+        operands = {None: None}
+        c.execute('SELECT * FROM operands')
+        for row in c:
+            operands[row[0]] = self._insert('operands',
+                                            self._operand_key(row),
+                                            row[1:])
+
+        # parents are inserted before their children
+        call_contexts = {None: None}
+        c.execute('SELECT * FROM call_contexts ORDER BY id')
+        for row in c:
+            row = list(row)
+            row[CallContextsTable.CALL_ID] = \
+                statements[row[CallContextsTable.CALL_ID]]
+            row[CallContextsTable.FUNCTION_ID] = \
+                functions[row[CallContextsTable.FUNCTION_ID]]
+            row[CallContextsTable.PARENT_ID] = \
+                call_contexts[row[CallContextsTable.PARENT_ID]]
+            call_contexts[row[0]] = self._insert('call_contexts',
+                                                 self._call_context_key(row),
+                                                 row[1:])
+
+        memory_locations = {None: None}
+        c.execute('SELECT * FROM memory_locations')
+        for row in c:
+            row = list(row)
+            info = row[MemoryLocationsTable.INFO]
+            if info:
+                info = json.loads(info)
+                kind = row[MemoryLocationsTable.KIND]
+                if kind == MemoryLocationKind.FUNCTION:
+                    info['id'] = functions[info['id']]
+                elif kind == MemoryLocationKind.DYN_ALLOC:
+                    info['call_id'] = statements[info['call_id']]
+                    info['context_id'] = call_contexts[info['context_id']]
+                row[MemoryLocationsTable.INFO] = json.dumps(info)
+            memory_locations[row[0]] = self._insert(
+                'memory_locations', self._memory_location_key(row), row[1:])
+
+        c.execute('SELECT * FROM checks')
+        for row in c:
+            row = list(row)
+            row[ChecksTable.STATEMENT_ID] = \
+                statements[row[ChecksTable.STATEMENT_ID]]
+            if row[ChecksTable.OPERANDS]:
+                row[ChecksTable.OPERANDS] = json.dumps(
+                    [[num, operands[id]]
+                     for num, id in json.loads(row[ChecksTable.OPERANDS])])
+            row[ChecksTable.CALL_CONTEXT_ID] = \
+                call_contexts[row[ChecksTable.CALL_CONTEXT_ID]]
+            if row[ChecksTable.CALL_CONTEXT_IDS]:
+                row[ChecksTable.CALL_CONTEXT_IDS] = json.dumps(
+                    [call_contexts[id]
+                     for id in json.loads(row[ChecksTable.CALL_CONTEXT_IDS])])
+            if row[ChecksTable.INFO]:
+                info = json.loads(row[ChecksTable.INFO])
+                _translate_check_info(info, functions, memory_locations)
+                row[ChecksTable.INFO] = json.dumps(info)
+
+            key = self._check_key(row)
+            if key not in self.checks:
+                self.checks.add(key)
+                row[ChecksTable.ID] = self.next_id['checks']
+                self.next_id['checks'] += 1
+                self.con.execute('INSERT INTO checks VALUES (%s)'
+                                 % ', '.join('?' * len(row)), row)
+
+        # per-function statistics, with translated references
+        for table in ('profile', 'downgrades'):
+            if not _has_table(other, table) or not _has_table(self.con, table):
+                continue
+            c.execute('SELECT * FROM %s' % table)
+            for row in c:
+                row = (functions[row[0]], call_contexts[row[1]]) + row[2:]
+                self.con.execute('INSERT INTO %s VALUES (%s)'
+                                 % (table, ', '.join('?' * len(row))), row)
+
+        # counters of the checks that are not stored, summed
+        if _has_table(other, 'check_counters') and \
+                _has_table(self.con, 'check_counters'):
+            c.execute('SELECT checker, status, count, domain '
+                      'FROM check_counters')
+            for checker, status, count, domain in c:
+                updated = self.con.execute(
+                    'UPDATE check_counters SET count = count + ? '
+                    'WHERE checker IS ? AND status IS ? AND domain IS ?',
+                    (count, checker, status, domain))
+                if updated.rowcount == 0:
+                    self.con.execute('INSERT INTO check_counters '
+                                     'VALUES (?, ?, ?, ?)',
+                                     (checker, status, count, domain))
+
+        # the runs are concurrent, keep the longest time of each pass and
+        # sum the performance counters
+        c.execute('SELECT pass, time, cycles, instructions, llc_misses, '
+                  'page_faults, max_rss_delta FROM times')
+        for row in c:
+            name, time = row[0], row[1]
+            counters = row[2:]
+            updated = self.con.execute(
+                'UPDATE times SET time = MAX(time, ?), '
+                'cycles = cycles + ?, instructions = instructions + ?, '
+                'llc_misses = llc_misses + ?, page_faults = page_faults + ?, '
+                'max_rss_delta = MAX(max_rss_delta, ?) WHERE pass = ?',
+                (time,) + tuple(counters) + (name,))
+            if updated.rowcount == 0:
+                self.con.execute('INSERT INTO times '
+                                 'VALUES (?, ?, ?, ?, ?, ?, ?)',
+                                 row)
+
+        other.close()
+        self.con.commit()
+
+    def close(self):
+        self.con.close()
+
+
+def _canonical_json(text):
+    ''' Return a canonical representation of a json string, or None '''
+    if not text:
+        return None
+    return json.dumps(json.loads(text), sort_keys=True)
+
+
+def _translate_check_info(info, functions, memory_locations):
+    ''' Translate the ids of functions and memory locations of a check info '''
+    for key in ('left_points_to', 'right_points_to'):
+        if key in info:
+            info[key] = [memory_locations[id] for id in info[key]]
+    for block in info.get('points_to', ()):
+        if 'id' in block:
+            block['id'] = memory_locations[block['id']]
+        if 'fun_id' in block:
+            block['fun_id'] = functions[block['fun_id']]
+
+
+class _Decompressor(object):
+    '''
+    Row factory decompressing the values of the columns compressed by
+    ikos-analyzer -compress-db
+
+    Compressed values are blobs holding a zlib stream with a preset dictionary,
+    identified by its Adler-32 checksum in the header of the stream.
+    '''
+
+    def __init__(self):
+        self.dictionaries = {}
+
+    def load(self, con, schema):
+        ''' Load the dictionaries of a database, return True if any '''
+        # the dictionaries must not go through the row factory
+        c = con.cursor()
+        c.row_factory = None
+        c.execute("SELECT name FROM %s.sqlite_master "
+                  "WHERE type = 'table' "
+                  "AND name = 'compression_dictionaries'" % schema)
+        if c.fetchone() is None:
+            return False
+
+        c.execute('SELECT id, dictionary FROM %s.compression_dictionaries'
+                  % schema)
+        rows = c.fetchall()
+        for id, dictionary in rows:
+            self.dictionaries[id] = bytes(dictionary)
+        return bool(rows)
+
+    def decompress(self, data):
+        dictionary_id, = struct.unpack('>I', data[2:6])
+        d = zlib.decompressobj(zdict=self.dictionaries[dictionary_id])
+        return (d.decompress(data) + d.flush()).decode('utf-8')
+
+    def __call__(self, cursor, row):
+        if not any(type(value) is bytes for value in row):
+            return row
+        return tuple(self.decompress(value) if type(value) is bytes else value
+                     for value in row)
+
+
+def _enable_decompression(con, schema='main'):
+    ''' Decompress the compressed values of a database, if any '''
+    if isinstance(con.row_factory, _Decompressor):
+        decompressor = con.row_factory
+    else:
+        decompressor = _Decompressor()
+
+    if decompressor.load(con, schema):
+        if sys.version_info < (3, 3):
+            raise RuntimeError('Reading a compressed database requires '
+                               'python 3.3 or newer')
+        con.row_factory = decompressor
+
+
+def _has_table(con, table):
+    c = con.execute("SELECT name FROM sqlite_master "
+                    "WHERE type = 'table' AND name = ?", (table,))
+    return c.fetchone() is not None
+
+
+def _read_only_uri(path):
+    ''' Return the read-only uri of the given database, or None '''
+    try:
+        from urllib.parse import quote
+    except ImportError:
+        # python 2 does not support uri filenames
+        return None
+
+    return 'file:%s?mode=ro' % quote(os.path.abspath(path))
+
+
+def _connect_read_only(path):
+    ''' Open a read-only connection to the given database '''
+    uri = _read_only_uri(path)
+    if uri is None:
+        con = sqlite3.connect(path)
+        con.execute('PRAGMA query_only = ON')
+        return con
+
+    return sqlite3.connect(uri, uri=True)
@@ -46,6 +46,7 @@ import functools
 import io
 import itertools
 import json
+import multiprocessing
 import operator
 import os
 import os.path
@@ -62,7 +63,8 @@ from ikos.enums import Result, CheckKind, CheckerName, ValueKind, \
     BufferOverflowCheckKind, ChecksTable
 from ikos.log import printf
 from ikos.output_db import OutputDatabase, File, Function, Statement, \
-    CallContext, Operand, NumOperandPair, MemoryLocation, Check
+    CallContext, Operand, NumOperandPair, MemoryLocation, Check, \
+    expand_check, expand_checks
 
 
 ##################
@@ -96,14 +98,214 @@ def format_time(elapsed):
     return ' '.join(s)
 
 
+def format_count(n):
+    ''' Format a large count.
+
+    >>> format_count(512)
+    '512'
+    >>> format_count(3 * 1000 * 1000 + 512 * 1000)
+    '3.5M'
+    '''
+    for unit in ('', 'K', 'M', 'G'):
+        if n < 1000:
+            return ('%d%s' if unit == '' else '%.1f%s') % (n, unit)
+        n /= 1000.0
+    return '%.1fT' % n
+
+
+def format_bytes(size):
+    ''' Format a size in bytes.
+
+    >>> format_bytes(512)
+    '512 B'
+    >>> format_bytes(3 * 1024 * 1024 + 512 * 1024)
+    '3.5 MB'
+    '''
+    for unit in ('B', 'KB', 'MB'):
+        if size < 1024:
+            return ('%d %s' if unit == 'B' else '%.1f %s') % (size, unit)
+        size /= 1024.0
+    return '%.1f GB' % size
+
+
 def print_timing_results(db, full=True, sort=True):
     ''' Print the timing results from the database '''
     results = db.load_timing_results(full, sort)
 
     printf(bold('# Time stats:') + '\n')
-    name_width = max(len(name) for name, _ in results)
-    for name, elapsed in results:
-        printf('%s: %s\n', name.ljust(name_width), format_time(elapsed))
+    name_width = max(len(row[0]) for row in results)
+    for (name, elapsed, cycles, instructions, llc_misses, page_faults,
+         max_rss_delta) in results:
+        counters = []
+        if cycles is not None and instructions is not None:
+            counters.append('cycles: %s, instructions: %s' %
+                            (format_count(cycles), format_count(instructions)))
+            if cycles > 0:
+                counters.append('IPC: %.2f' % (instructions / float(cycles)))
+        if llc_misses is not None:
+            counters.append('LLC misses: %s' % format_count(llc_misses))
+        if page_faults is not None:
+            counters.append('page faults: %s' % format_count(page_faults))
+        if max_rss_delta is not None:
+            counters.append('peak RSS: +%s' %
+                            format_bytes(max_rss_delta * 1024))
+        if counters:
+            printf('%s: %s (%s)\n', name.ljust(name_width),
+                   format_time(elapsed), ', '.join(counters))
+        else:
+            printf('%s: %s\n', name.ljust(name_width), format_time(elapsed))
+
+
+def print_profile(db, limit, domain=None):
+    ''' Print the function analyses with the largest exclusive time '''
+    rows = db.load_profile(limit, domain)
+
+    printf(bold('# Profile:') + '\n')
+    if not rows:
+        printf('No profile, run the analysis with --profile-functions\n')
+        return
+
+    for (function_id, call_context_id, runs, inclusive_time, exclusive_time,
+         iterations, widenings, narrowings, narrowing_capped_loops,
+         peak_invariant_size, peak_invariant_bytes, peak_integer_bytes,
+         peak_pointer_bytes, gmp_allocations) in rows:
+        function = db.functions[function_id]
+        call_context = db.call_contexts[call_context_id]
+        printf('%s\n', bold(function.pretty_name()))
+        if not call_context.empty():
+            printf('  Call context: %s\n', call_context.str())
+        printf('  Exclusive time: %s\n', format_time(exclusive_time))
+        printf('  Inclusive time: %s\n', format_time(inclusive_time))
+        printf('  Runs: %d, iterations: %d, widenings: %d, narrowings: %d\n',
+               runs, iterations, widenings, narrowings)
+        if narrowing_capped_loops:
+            printf('  Narrowing stopped before convergence on: %s\n',
+                   narrowing_capped_loops)
+        printf('  Peak invariant size: %d cells, %s (integers: %s, '
+               'pointers: %s)\n',
+               peak_invariant_size,
+               format_bytes(peak_invariant_bytes),
+               format_bytes(peak_integer_bytes),
+               format_bytes(peak_pointer_bytes))
+        printf('  GMP allocations: %d\n', gmp_allocations)
+
+
+########
+# diff #
+########
+
+# Checks of an output database, numbered in source order among the checks
+# with the same key. Line numbers are not part of the key, so that a check is
+# still matched after code was added or removed above it.
+DIFF_CHECKS_QUERY = '''
+SELECT path, function, pretty_name, statement_kind, col, kind, checker,
+       status, line,
+       ROW_NUMBER() OVER (PARTITION BY path, function, statement_kind, col,
+                                       kind, checker, status
+                          ORDER BY line, statement_id) AS rank
+FROM (SELECT DISTINCT IFNULL(files.path, '') AS path,
+                      IFNULL(functions.name, '') AS function,
+                      COALESCE(functions.demangled, functions.name)
+                        AS pretty_name,
+                      statements.kind AS statement_kind,
+                      IFNULL(statements."column", -1) AS col,
+                      checks.kind AS kind,
+                      checks.checker AS checker,
+                      checks.status AS status,
+                      statements.line AS line,
+                      statements.id AS statement_id
+      FROM {schema}.checks AS checks
+      JOIN {schema}.statements AS statements
+        ON statements.id = checks.statement_id
+      LEFT JOIN {schema}.files AS files
+        ON files.id = statements.file_id
+      LEFT JOIN {schema}.functions AS functions
+        ON functions.id = statements.function_id
+      WHERE {where})
+'''
+
+# Checks of the first table without a match in the second one
+DIFF_JOIN_QUERY = '''
+SELECT {side}, a.path, a.pretty_name, a.line, a.col, a.kind, a.checker,
+       a.status
+FROM {a} AS a LEFT JOIN {b} AS b
+  ON b.path = a.path AND b.function = a.function
+ AND b.statement_kind = a.statement_kind AND b.col = a.col
+ AND b.kind = a.kind AND b.checker = a.checker AND b.status = a.status
+ AND b.rank = a.rank
+WHERE b.rank IS NULL
+'''
+
+
+def generate_diff(db, old_path, status_filter=None, analyses_filter=None,
+                  domain=None):
+    '''
+    Return the warnings and errors of db that are not in the output database
+    old_path, and the ones of old_path that are not in db anymore, as two
+    lists of (path, function, line, column, kind, checker, status)
+
+    Checks are matched on the file, the function, the kind and the column of
+    the statement, the check kind, the checker and the status. The join is
+    done by SQLite on the attached database.
+    '''
+    statuses = [Result.WARNING, Result.ERROR]
+    if status_filter is not None:
+        statuses = [status for status in statuses
+                    if Result.str(status) in status_filter]
+
+    where = ['checks.status IN (%s)' % ','.join(map(str, statuses or [-1]))]
+    if analyses_filter is not None:
+        checkers = [CheckerName.from_short_name(checker)
+                    for checker in analyses_filter]
+        where.append('checks.checker IN (%s)'
+                     % ','.join(map(str, checkers or [-1])))
+    if domain is not None:
+        where.append('checks.domain = :domain')
+    where = ' AND '.join(where)
+
+    db.attach(old_path, 'old')
+    try:
+        query = 'WITH new AS (%s), old AS (%s) %s UNION ALL %s ' \
+                'ORDER BY 1, 2, 4, 5, 6' % (
+                    DIFF_CHECKS_QUERY.format(schema='main', where=where),
+                    DIFF_CHECKS_QUERY.format(schema='old', where=where),
+                    DIFF_JOIN_QUERY.format(side=0, a='new', b='old'),
+                    DIFF_JOIN_QUERY.format(side=1, a='old', b='new'))
+        c = db.con.cursor()
+        c.execute(query, {'domain': domain})
+        diff = ([], [])
+        for row in c:
+            diff[row[0]].append(row[1:])
+        return diff
+    finally:
+        db.con.execute('DETACH DATABASE old')
+
+
+def print_diff(db, old_path, status_filter=None, analyses_filter=None,
+               domain=None):
+    ''' Print the new and the fixed warnings and errors since old_path '''
+    new, fixed = generate_diff(db, old_path, status_filter, analyses_filter,
+                               domain)
+
+    for i, (title, checks) in enumerate((('# New checks:', new),
+                                         ('# Fixed checks:', fixed))):
+        if i > 0:
+            printf('\n')
+        printf(bold(title) + ' %d\n', len(checks))
+        for path, function, line, column, kind, checker, status in checks:
+            location = format_path(path) or '?'
+            if line is not None:
+                location += ':%d' % line
+                if column != -1:
+                    location += ':%d' % column
+            printf('%s: %s: %s [%s]', location,
+                   bold_red('error') if status == Result.ERROR
+                   else bold_yellow('warning'),
+                   CheckKind.long_name(kind),
+                   CheckerName.short_name(checker))
+            if function:
+                printf(' in %s', function)
+            printf('\n')
 
 
 ###########
@@ -174,21 +376,30 @@ class Summary:
         return self.ok + self.error + self.warning + self.unreachable
 
 
-def generate_summary(db):
+def generate_summary(db, domain=None):
     '''
     Return the analysis summary: number of errors, warnings, ok and
     unreachable per checked statements.
+
+    If domain is not None, only the checks of the given abstract domain are
+    taken into account.
     '''
     summary = Summary(ok=0, error=0, warning=0, unreachable=0)
 
     c = db.con.cursor()
     order_by = 'statement_id, call_context_id'
-    c.execute('SELECT * FROM checks ORDER BY %s' % order_by)
+    if domain is None:
+        c.execute('SELECT * FROM checks ORDER BY %s' % order_by)
+    else:
+        c.execute('SELECT * FROM checks WHERE domain = ? ORDER BY %s' %
+                  order_by, (domain,))
 
     stmt_id_key = operator.itemgetter(ChecksTable.STATEMENT_ID)
     context_id_key = operator.itemgetter(ChecksTable.CALL_CONTEXT_ID)
 
-    for statement_id, statement_checks in itertools.groupby(c,
+    rows = expand_checks(c)
+
+    for statement_id, statement_checks in itertools.groupby(rows,
                                                             key=stmt_id_key):
         # Iterate over the checks for statement = statement_id
         statement_results = set()
@@ -224,14 +435,35 @@ def generate_summary(db):
             summary.warning += len(statement_warnings)
 
     c.close()
+
+    # statements with only ok checks, omitted with --compact-checks
+    summary.ok += db.load_ok_statements_count(domain)
+
     return summary
 
 
-def print_summary(db, full=True):
-    ''' Print the analysis summary from the database '''
-    summary = generate_summary(db)
+def print_summary(db, full=True, domain=None):
+    '''
+    Print the analysis summary from the database
 
-    printf(bold('# Summary:') + '\n')
+    If several abstract domains were analyzed in the same run and domain is
+    None, print one summary per domain.
+    '''
+    if domain is None:
+        domains = db.load_domains()
+        if domains:
+            for i, domain in enumerate(domains):
+                if i > 0:
+                    printf('\n')
+                print_summary(db, full, domain)
+            return
+
+    summary = generate_summary(db, domain)
+
+    if domain is None:
+        printf(bold('# Summary:') + '\n')
+    else:
+        printf(bold('# Summary (%s):' % domain) + '\n')
 
     if full:
         printf('Total number of checks                : %s\n',
@@ -262,6 +494,20 @@ def print_summary(db, full=True):
         else:
             printf(bold_yellow('The program is potentially UNSAFE') + '\n')
 
+    downgrades = db.load_downgrades(domain)
+    if downgrades:
+        printf('\n')
+        printf(bold_yellow('%d function analyses exceeded their budget and '
+                           'were treated as unknown calls, their checks are '
+                           'missing:' % len(downgrades)) + '\n')
+        if full:
+            for function_id, call_context_id, budget in downgrades:
+                function = db.functions[function_id]
+                call_context = db.call_contexts[call_context_id]
+                printf('  %s (%s budget)\n', function.pretty_name(), budget)
+                if not call_context.empty():
+                    printf('    Call context: %s\n', call_context.str())
+
 
 ######################
 # display raw checks #
@@ -333,13 +579,26 @@ def print_raw_checks(db, interprocedural):
         'info'
     ]
     order_by = 'call_context_id, statement_id, kind'
+    sort_columns = [ChecksTable.CALL_CONTEXT_ID,
+                    ChecksTable.STATEMENT_ID,
+                    ChecksTable.KIND]
 
     if not interprocedural:
         header.pop(0)  # no context column if intraprocedural
 
+    # domain column if several domains were analyzed
+    tagged = bool(db.load_domains())
+    if tagged:
+        header.insert(0, 'domain')
+        order_by = 'domain, ' + order_by
+        sort_columns.insert(0, ChecksTable.DOMAIN)
+
     c = db.con.cursor()
     c.execute('SELECT * FROM checks ORDER BY %s' % order_by)
-    rows = c.fetchall()
+    rows = [expanded for row in c for expanded in expand_check(row)]
+
+    # Aggregated checks are expanded out of order
+    rows.sort(key=operator.itemgetter(*sort_columns))
 
     # Format all rows
     for i, row in enumerate(rows):
@@ -363,6 +622,9 @@ def print_raw_checks(db, interprocedural):
         if not interprocedural:
             rows[i].pop(0)  # no context column if intraprocedural
 
+        if tagged:
+            rows[i].insert(0, row[ChecksTable.DOMAIN])
+
     # Reorganize data by columns
     cols = zip(*([header] + rows))
 
@@ -428,6 +690,7 @@ class StatementReport:
         self.call_context_ids = call_context_ids
         self.operands = operands
         self.info = info
+        self.message = None  # see generate_messages()
 
     def statement(self):
         return self.db.statements[self.statement_id]
@@ -467,13 +730,26 @@ class StatementReport:
                     self.info)
 
 
-def generate_report(db, status_filter=None, analyses_filter=None):
+def check_kind_key(item):
+    ''' Sorting key for the (CheckTuple, context_ids) pairs of a statement '''
+    return item[0].kind
+
+
+def generate_report(db, status_filter=None, analyses_filter=None,
+                    file_id=None, domain=None):
     '''
     Generate an analysis report.
 
     Arguments:
         status_filter(list): List of status, or None
         analyses_filter(list): List of checkers, or None
+        file_id(int): Only report the statements of the given file, or None
+        domain(str): Only report the checks of the given abstract domain, when
+            several domains were analyzed in the same run, or None
+
+    Filtering, grouping by statement and sorting by source location are done
+    by the database. The statement reports are sorted by source location, and
+    by check kind for a given statement and status.
     '''
     report = Report(db)
 
@@ -518,19 +794,39 @@ def generate_report(db, status_filter=None, analyses_filter=None):
         # checks from the DeadCodeChecker, especially 'ok' checks.
         where = '(%s) OR (checker=%d)' % (where, CheckerName.DEAD_CODE)
 
+    if file_id is not None:
+        file_clause = ('statement_id IN '
+                       '(SELECT id FROM statements WHERE file_id=%d)' % file_id)
+        if where:
+            where = '(%s) AND (%s)' % (where, file_clause)
+        else:
+            where = file_clause
+
+    if domain is not None:
+        domain_clause = "domain='%s'" % domain
+        if where:
+            where = '(%s) AND (%s)' % (where, domain_clause)
+        else:
+            where = domain_clause
+
     if where:
         where = 'WHERE %s' % where
 
-    order_by = 'ORDER BY statement_id, call_context_id'
+    order_by = ('ORDER BY statements.file_id, statements.line, '
+                'statements."column", statement_id, call_context_id')
 
     # Execute query
     c = db.con.cursor()
-    c.execute('SELECT * FROM checks %s %s' % (where, order_by))
+    c.execute('SELECT checks.* FROM checks '
+              'JOIN statements ON statements.id = checks.statement_id '
+              '%s %s' % (where, order_by))
 
     stmt_id_key = operator.itemgetter(ChecksTable.STATEMENT_ID)
     context_id_key = operator.itemgetter(ChecksTable.CALL_CONTEXT_ID)
 
-    for statement_id, statement_checks in itertools.groupby(c,
+    rows = expand_checks(c)
+
+    for statement_id, statement_checks in itertools.groupby(rows,
                                                             key=stmt_id_key):
         # Iterate over the checks for statement = statement_id
         statement_results = set()
@@ -572,7 +868,8 @@ def generate_report(db, status_filter=None, analyses_filter=None):
                     call_context_ids=statement_context_ids
                 ))
         else:
-            for check, context_ids in statement_errors.items():
+            for check, context_ids in sorted(statement_errors.items(),
+                                             key=check_kind_key):
                 report.append(StatementReport(db=db,
                                               kind=check.kind,
                                               status=Result.ERROR,
@@ -580,7 +877,8 @@ def generate_report(db, status_filter=None, analyses_filter=None):
                                               call_context_ids=context_ids,
                                               operands=check.operands,
                                               info=check.info))
-            for check, context_ids in statement_warnings.items():
+            for check, context_ids in sorted(statement_warnings.items(),
+                                             key=check_kind_key):
                 report.append(StatementReport(db=db,
                                               kind=check.kind,
                                               status=Result.WARNING,
@@ -588,7 +886,8 @@ def generate_report(db, status_filter=None, analyses_filter=None):
                                               call_context_ids=context_ids,
                                               operands=check.operands,
                                               info=check.info))
-            for check, context_ids in statement_oks.items():
+            for check, context_ids in sorted(statement_oks.items(),
+                                             key=check_kind_key):
                 report.append(StatementReport(db=db,
                                               kind=check.kind,
                                               status=Result.OK,
@@ -621,6 +920,13 @@ class Formatter(object):
     def format(self, report):
         raise NotImplementedError
 
+    def message(self, statement_report):
+        ''' Return the message of a statement report '''
+        if statement_report.message is not None:
+            return statement_report.message
+
+        return generate_message(statement_report, self.verbosity)
+
 
 class TextFormatter(Formatter):
     ''' Text output formatter (similar to clang compilation warnings) '''
@@ -634,12 +940,8 @@ class TextFormatter(Formatter):
 
     @classmethod
     def sorting_key(cls, report):
-        statement = report.statement()
-        return (cls.RESULT_ORDER[report.status],
-                statement.file_id_or(-1),
-                statement.line_or(-1),
-                statement.column_or(-1),
-                report.kind)
+        # generate_report() already sorts by location and kind
+        return cls.RESULT_ORDER[report.status]
 
     def write_path(self, file):
         printf(bold('%s: '), format_path(file.path) if file else '?',
@@ -747,7 +1049,7 @@ class TextFormatter(Formatter):
         for statement_report in statement_reports:
             statement = statement_report.statement()
             function = statement.function()
-            message = generate_message(statement_report, self.verbosity)
+            message = self.message(statement_report)
 
             self.write_path(function.file())
             self.write_in_function(function)
@@ -909,7 +1211,7 @@ class CSVFormatter(Formatter):
                            in statement_report.call_contexts()),
                 Result.str(statement_report.status),
                 CheckKind.short_name(statement_report.kind),
-                generate_message(statement_report, self.verbosity),
+                self.message(statement_report),
             ])
 
 
@@ -959,6 +1261,62 @@ def generate_message(report, verbosity):
     return GENERATE_MESSAGE_MAP[report.kind](report, verbosity)
 
 
+# Minimum number of statement reports to generate the messages in parallel
+PARALLEL_MESSAGES_THRESHOLD = 1000
+
+# Output database of a worker process of generate_messages()
+_worker_db = None
+
+
+def _init_message_worker(path):
+    global _worker_db
+    _worker_db = OutputDatabase(path, lazy=True, read_only=True)
+
+
+def _generate_worker_message(args):
+    kind, status, statement_id, call_context_ids, operands, info, \
+        verbosity = args
+    report = StatementReport(db=_worker_db,
+                             kind=kind,
+                             status=status,
+                             statement_id=statement_id,
+                             call_context_ids=call_context_ids,
+                             operands=operands,
+                             info=info)
+    return generate_message(report, verbosity)
+
+
+def generate_messages(report, verbosity, jobs=1):
+    '''
+    Generate the message of each statement report
+
+    The decoding of operands and info and the formatting of the messages are
+    distributed over `jobs` processes, each with its own database connection.
+    '''
+    statement_reports = report.statement_reports
+
+    if jobs <= 1 or len(statement_reports) < PARALLEL_MESSAGES_THRESHOLD:
+        for statement_report in statement_reports:
+            statement_report.message = generate_message(statement_report,
+                                                        verbosity)
+        return
+
+    tasks = ((r.kind, r.status, r.statement_id, r.call_context_ids,
+              r.operands, r.info, verbosity)
+             for r in statement_reports)
+    chunksize = max(1, len(statement_reports) // (jobs * 4))
+    pool = multiprocessing.Pool(jobs,
+                                initializer=_init_message_worker,
+                                initargs=(report.db.path,))
+    try:
+        messages = pool.imap(_generate_worker_message, tasks, chunksize)
+        for statement_report, message in zip(statement_reports, messages):
+            statement_report.message = message
+    finally:
+        pool.close()
+        pool.join()
+
+
 def is_variable_name(s):
     ''' Return true if the given string is a variable name '''
     # First letter is alpha or underscore
@@ -1843,6 +2201,16 @@ def parse_arguments(argv):
                         help='Display analysis raw checks',
                         action='store_true',
                         default=False)
+    parser.add_argument('--profile',
+                        dest='profile',
+                        metavar='<n>',
+                        help='Display the <n> function analyses with the '
+                             'largest exclusive time, per call context '
+                             '(requires --profile-functions, default: 10)',
+                        nargs='?',
+                        const=10,
+                        default=None,
+                        type=int)
     parser.add_argument('-f', '--format',
                         dest='format',
                         metavar='',
@@ -1877,12 +2245,31 @@ def parse_arguments(argv):
                                        args.analyses,
                                        '*'),
                         action='append')
+    parser.add_argument('--domain',
+                        dest='domain',
+                        metavar='<domain>',
+                        help='Only report the checks of the given abstract '
+                             'domain, when several domains were analyzed',
+                        default=None)
+    parser.add_argument('--diff',
+                        dest='diff',
+                        metavar='<old.db>',
+                        help='Display the warnings and errors that are new '
+                             'or fixed since the given output database',
+                        default=None)
     parser.add_argument('-v', '--report-verbosity',
                         dest='report_verbosity',
                         metavar='[1-4]',
                         help='Report verbosity (default: 1)',
                         default=1,
                         type=int)
+    parser.add_argument('-j', '--jobs',
+                        dest='jobs',
+                        metavar='',
+                        help='Number of processes used to generate the '
+                             'report messages (default: 1)',
+                        default=1,
+                        type=int)
 
     opt = parser.parse_args(argv)
 
@@ -1902,6 +2289,10 @@ def parse_arguments(argv):
                                               default='*',
                                               value=opt.analyses_filter)
 
+    # check that --diff is given an existing database
+    if opt.diff is not None and not os.path.isfile(opt.diff):
+        parser.error("no such file: '%s'" % opt.diff)
+
     # check for consistency between --web-port and -f=web
     if opt.web_port != 8080 and opt.format != 'web':
         parser.error('cannot use --web-port without --format=web')
@@ -1938,13 +2329,28 @@ def main(argv):
 
     try:
         # open result database
-        db = OutputDatabase(opt.file)
+        db = OutputDatabase(opt.file, read_only=True)
 
         first = True
 
         # load settings
         settings = db.load_settings()
 
+        if opt.domain is not None and opt.domain not in db.load_domains():
+            printf("%s: error: no checks for domain \'%s\'\n",
+                   progname, opt.domain, file=sys.stderr)
+            sys.exit(1)
+
+        # display the differences with an older database
+        if opt.diff is not None:
+            print_diff(db,
+                       opt.diff,
+                       status_filter=opt.status_filter,
+                       analyses_filter=opt.analyses_filter,
+                       domain=opt.domain)
+            db.close()
+            return
+
         # display timing results
         if opt.display_times != 'no':
             if not first:
@@ -1956,7 +2362,14 @@ def main(argv):
         if opt.display_summary != 'no':
             if not first:
                 printf('\n')
-            print_summary(db, opt.display_summary == 'full')
+            print_summary(db, opt.display_summary == 'full', opt.domain)
+            first = False
+
+        # display the profile
+        if opt.profile is not None:
+            if not first:
+                printf('\n')
+            print_profile(db, opt.profile, opt.domain)
             first = False
 
         # display raw checks
@@ -1982,7 +2395,10 @@ def main(argv):
             # generate report
             rep = generate_report(db,
                                   status_filter=opt.status_filter,
-                                  analyses_filter=opt.analyses_filter)
+                                  analyses_filter=opt.analyses_filter,
+                                  domain=opt.domain)
+            if opt.format in ('text', 'csv'):
+                generate_messages(rep, opt.report_verbosity, opt.jobs)
 
             # format report
             formatter_class = formats[opt.format]
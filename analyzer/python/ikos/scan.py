@@ -42,25 +42,33 @@
 import argparse
 import codecs
 import collections
+import hashlib
 import itertools
+import multiprocessing
 import os
 import os.path
 import random
 import re
+import shutil
 import subprocess
 import sys
 import tempfile
 import threading
 
+from multiprocessing.pool import ThreadPool
+
 from ikos import analyzer
 from ikos import args
 from ikos import colors
 from ikos import http
 from ikos import log
+from ikos import report
 from ikos import settings
 from ikos.analyzer import command_string
 from ikos.filetype import filetype
 from ikos.log import printf
+from ikos.output_db import DatabaseMerger
+from ikos.output_db import OutputDatabase
 
 
 def parse_arguments(argv):
@@ -107,6 +115,52 @@ def parse_arguments(argv):
                                        args.default_log_level),
                         choices=args.choices(args.log_levels),
                         default=None)
+    parser.add_argument('-j', '--jobs',
+                        dest='jobs',
+                        metavar='<n>',
+                        help='Number of threads used by each compiler '
+                             'wrapper to build and link llvm bitcode '
+                             '(default: number of CPUs)',
+                        type=int,
+                        default=multiprocessing.cpu_count())
+    parser.add_argument('--cache-dir',
+                        dest='cache_dir',
+                        metavar='<directory>',
+                        help='Directory of a cache of llvm bitcode files, '
+                             'reused for unchanged translation units',
+                        default=None)
+    parser.add_argument('--incremental',
+                        dest='incremental',
+                        help='Reuse the results of the previous analysis of '
+                             'each binary for the unchanged functions',
+                        action='store_true',
+                        default=False)
+    parser.add_argument('--batch',
+                        dest='batch',
+                        help='Analyze all the binaries without asking, '
+                             'concurrently, and report the merged results',
+                        action='store_true',
+                        default=False)
+    parser.add_argument('--analysis-jobs',
+                        dest='analysis_jobs',
+                        metavar='<n>',
+                        help='Number of concurrent analyses with --batch '
+                             '(default: number of CPUs)',
+                        type=int,
+                        default=multiprocessing.cpu_count())
+    parser.add_argument('--mem-budget',
+                        dest='mem_budget',
+                        metavar='<MB>',
+                        help='Memory budget shared by the concurrent analyses '
+                             'with --batch',
+                        type=int,
+                        default=0)
+    parser.add_argument('--batch-db',
+                        dest='batch_db',
+                        metavar='<file>',
+                        help='Output database of the merged results with '
+                             '--batch (default: ikos-scan.db)',
+                        default='ikos-scan.db')
 
     opt = parser.parse_args(argv)
 
@@ -512,24 +566,163 @@ def check_output(cmd, executable=None):
         sys.exit(e.errno)
 
 
+def scan_jobs():
+    ''' Return the number of threads to use in the compiler wrapper '''
+    return max(int(os.environ.get('IKOS_SCAN_JOBS', '1')), 1)
+
+
+def parallel_for_each(fun, items):
+    '''
+    Call fun on each item, using up to scan_jobs() threads
+
+    The first exception raised by fun, including SystemExit, is raised again in
+    the calling thread.
+    '''
+    queue = collections.deque(items)
+    num_threads = min(scan_jobs(), len(queue))
+
+    if num_threads <= 1:
+        for item in queue:
+            fun(item)
+        return
+
+    lock = threading.Lock()
+    errors = []
+
+    def worker():
+        while True:
+            with lock:
+                if not queue or errors:
+                    return
+                item = queue.popleft()
+            try:
+                fun(item)
+            except BaseException as e:
+                with lock:
+                    errors.append(e)
+                return
+
+    threads = [threading.Thread(target=worker) for _ in range(num_threads)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    if errors:
+        raise errors[0]
+
+
+# Dependency generator flags, with their number of parameters
+DEPENDENCY_FLAGS = {
+    '-M': 0,
+    '-MM': 0,
+    '-MF': 1,
+    '-MG': 0,
+    '-MP': 0,
+    '-MT': 1,
+    '-MQ': 1,
+    '-MD': 0,
+    '-MMD': 0,
+}
+
+
+def bitcode_cache_key(mode, parser, src_path, cmd):
+    '''
+    Return the key of the given bitcode compilation in the bitcode cache
+
+    The key is a hash of the preprocessed source file, of the compilation flags
+    and of the current directory, which appears in the debug information.
+    '''
+    # preprocess without the dependency generator flags
+    pp_cmd = [mode, '-E']
+    args = iter(parser.compile_args)
+    for arg in args:
+        if arg in DEPENDENCY_FLAGS:
+            for _ in range(DEPENDENCY_FLAGS[arg]):
+                next(args, None)
+        else:
+            pp_cmd.append(arg)
+    pp_cmd += analyzer.clang_ikos_flags()
+    pp_cmd.append(src_path)
+
+    h = hashlib.sha256()
+    h.update(check_output(pp_cmd, executable=settings.clang()))
+    for item in [settings.clang(), os.getcwd()] + cmd:
+        h.update(b'\0')
+        h.update(item.encode('utf-8'))
+    return h.hexdigest()
+
+
 def build_bitcode(mode, parser, src_path, bc_path):
-    ''' Compile the given source file to llvm bitcode '''
+    '''
+    Compile the given source file to llvm bitcode
+
+    If IKOS_SCAN_CACHE_DIR is set, the bitcode is taken from the cache when
+    the preprocessed source file and the flags did not change.
+    '''
     cmd = [mode]
     cmd += analyzer.clang_emit_llvm_flags()
     cmd += parser.compile_args
     cmd += analyzer.clang_ikos_flags()
-    cmd += [src_path,
-            '-o',
-            bc_path]
-    run(cmd, executable=settings.clang())
+
+    cache_dir = os.environ.get('IKOS_SCAN_CACHE_DIR')
+    if not cache_dir:
+        run(cmd + [src_path, '-o', bc_path], executable=settings.clang())
+        return
+
+    key = bitcode_cache_key(mode, parser, src_path, cmd)
+    cache_path = os.path.join(cache_dir, key[:2], key + '.bc')
+    if os.path.isfile(cache_path):
+        log.debug('Using cached bitcode %s for %s' % (cache_path, src_path))
+        shutil.copyfile(cache_path, bc_path)
+        return
+
+    run(cmd + [src_path, '-o', bc_path], executable=settings.clang())
+
+    # copy in a temporary file, then rename it, so that concurrent builds
+    # never read a partial entry
+    if not os.path.isdir(os.path.dirname(cache_path)):
+        try:
+            os.makedirs(os.path.dirname(cache_path))
+        except OSError:
+            pass  # created by a concurrent build
+    fd, tmp_path = tempfile.mkstemp(suffix='.tmp',
+                                    dir=os.path.dirname(cache_path))
+    os.close(fd)
+    shutil.copyfile(bc_path, tmp_path)
+    os.rename(tmp_path, cache_path)
+
+
+# Maximum number of files given to a single llvm-link command
+LINK_BATCH_SIZE = 16
 
 
 def link_bitcodes(input_paths, output_path):
-    ''' Link the given bitcode files to a single llvm bitcode '''
-    cmd = ['llvm-link']
-    cmd += input_paths
-    cmd += ['-o', output_path]
-    run(cmd, executable=settings.llvm_link())
+    '''
+    Link the given bitcode files to a single llvm bitcode
+
+    Large links are done hierarchically: batches of files are linked in
+    parallel into temporary files, which are then linked together.
+    '''
+    if len(input_paths) <= LINK_BATCH_SIZE or scan_jobs() <= 1:
+        cmd = ['llvm-link']
+        cmd += input_paths
+        cmd += ['-o', output_path]
+        run(cmd, executable=settings.llvm_link())
+        return
+
+    tmp_dir = tempfile.mkdtemp(prefix='ikos-scan-')
+    try:
+        batches = [input_paths[i:i + LINK_BATCH_SIZE]
+                   for i in range(0, len(input_paths), LINK_BATCH_SIZE)]
+        partial_paths = [os.path.join(tmp_dir, '%d.bc' % i)
+                         for i in range(len(batches))]
+        parallel_for_each(lambda i: link_bitcodes(batches[i],
+                                                  partial_paths[i]),
+                          range(len(batches)))
+        link_bitcodes(partial_paths, output_path)
+    finally:
+        shutil.rmtree(tmp_dir, ignore_errors=True)
 
 
 def build_object(mode, parser, src_path, obj_path):
@@ -654,7 +847,8 @@ class ScanServerRequestHandler(http.BaseHTTPRequestHandler):
             'exe_path': data['exe'][0],
             'bc_path': data['bc'][0],
         }
-        self.server.binaries.append(binary)
+        with self.server.lock:
+            self.server.binaries.append(binary)
         log.debug('Received %r' % binary)
 
         # send response
@@ -670,7 +864,8 @@ class ScanServer(threading.Thread):
     '''
     HTTP server that logs the output files of the compiler
 
-    Note that the server is single threaded.
+    Each request is handled in its own thread, so that parallel builds are not
+    serialized by the notifications.
     '''
 
     def __init__(self):
@@ -681,13 +876,14 @@ class ScanServer(threading.Thread):
             try:
                 # try to start the http server on a random port
                 self.port = random.randint(8000, 9000)
-                self.httpd = http.HTTPServer(('', self.port),
-                                             ScanServerRequestHandler)
+                self.httpd = http.ThreadingHTTPServer(('', self.port),
+                                                      ScanServerRequestHandler)
             except (OSError, IOError):
                 self.port = None  # port already in use
 
         self.httpd.timeout = 0.1
         self.httpd.binaries = []  # list of built binaries
+        self.httpd.lock = threading.Lock()  # protects binaries
         self.running = False
 
     def run(self):
@@ -700,7 +896,8 @@ class ScanServer(threading.Thread):
 
     @property
     def binaries(self):
-        return self.httpd.binaries
+        with self.httpd.lock:
+            return list(self.httpd.binaries)
 
 
 ###########################################
@@ -744,13 +941,12 @@ def compile(mode, argv):
             attach_bitcode_path(obj_path, bc_path)
             return
 
-        # compile the source files one by one and attach the llvm bitcode path
-        new_object_files = []
-        for src_path in parser.source_files:
+        # compile the source files in parallel and attach the llvm bitcode
+        # paths
+        def build_source(src_path):
             # build the object file
             obj_path = '%s.o' % src_path
             build_object(mode, parser, src_path, obj_path)
-            new_object_files.append(obj_path)
 
             # build the bitcode file
             if src_path.endswith('.bc'):
@@ -762,6 +958,10 @@ def compile(mode, argv):
             # attach the bitcode path to the object file, ready to be linked
             attach_bitcode_path(obj_path, bc_path)
 
+        parallel_for_each(build_source, parser.source_files)
+        new_object_files = ['%s.o' % src_path
+                            for src_path in parser.source_files]
+
         # re-link to merge the llvm bitcode paths section
         if new_object_files:
             if parser.is_link:
@@ -784,6 +984,86 @@ def compile(mode, argv):
             raise error
 
 
+def ikos_command(bc_path, db_path, opt):
+    ''' Return the ikos command analyzing the given bitcode '''
+    cmd = [sys.executable,
+           settings.ikos(),
+           bc_path,
+           '-o',
+           db_path,
+           '--color=%s' % opt.color,
+           '--log=%s' % opt.log_level]
+    if opt.incremental:
+        cmd.append('--incremental')
+    return cmd
+
+
+def analyze_batch(binaries, opt):
+    '''
+    Analyze all the binaries with up to opt.analysis_jobs concurrent ikos
+    processes, then report the merged results
+    '''
+    jobs = max(min(opt.analysis_jobs, len(binaries)), 1)
+
+    # the reports are only displayed once, for the merged database
+    extra_args = ['--format=no', '--display-summary=no', '--display-times=no']
+    if opt.mem_budget > 0:
+        # each concurrent analysis gets its share of the budget
+        extra_args.append('--mem-budget=%d' % max(opt.mem_budget // jobs, 1))
+
+    def analyze(binary):
+        exe_path = os.path.relpath(binary['exe_path'])
+        bc_path = os.path.relpath(binary['bc_path'])
+        db_path = '%s.db' % exe_path
+        cmd = ikos_command(bc_path, db_path, opt) + extra_args
+        log.info('Analyzing %s' % colors.bold(exe_path))
+        log.debug('Running %s' % command_string(cmd))
+        try:
+            rc = subprocess.call(cmd)
+        except OSError as e:
+            printf('error: %s: %s\n', cmd[0], e.strerror, file=sys.stderr)
+            rc = e.errno
+        return exe_path, db_path, rc
+
+    pool = ThreadPool(jobs)
+    try:
+        results = pool.map(analyze, binaries)
+    finally:
+        pool.close()
+        pool.join()
+
+    db_paths = []
+    for exe_path, db_path, rc in results:
+        if rc == 0:
+            db_paths.append(db_path)
+        else:
+            log.error('Analysis of %s failed with exit code %d'
+                      % (exe_path, rc))
+
+    if not db_paths:
+        sys.exit(1)
+
+    # merge the results of all binaries
+    log.info('Merging the results in %s' % opt.batch_db)
+    shutil.copyfile(db_paths[0], opt.batch_db)
+    merger = DatabaseMerger(opt.batch_db)
+    for db_path in db_paths[1:]:
+        merger.merge(db_path)
+    merger.close()
+
+    db = OutputDatabase(path=opt.batch_db)
+    report.print_summary(db)
+    printf('\n' + colors.bold('# Results') + '\n')
+    rep = report.generate_report(db,
+                                 status_filter=args.default_status_filter)
+    report.generate_messages(rep, 1)
+    report.TextFormatter(sys.stdout, 1).format(rep)
+    db.close()
+
+    if len(db_paths) != len(results):
+        sys.exit(1)
+
+
 ######################
 # main for ikos-scan #
 ######################
@@ -805,6 +1085,9 @@ def main(argv):
     os.environ['IKOS_SCAN_COLOR'] = 'yes' if colors.ENABLE else 'no'
     os.environ['IKOS_SCAN_LOG_LEVEL'] = opt.log_level
     os.environ['IKOS_SCAN_SERVER'] = 'http://localhost:%d' % server.port
+    os.environ['IKOS_SCAN_JOBS'] = str(max(opt.jobs, 1))
+    if opt.cache_dir:
+        os.environ['IKOS_SCAN_CACHE_DIR'] = os.path.abspath(opt.cache_dir)
     os.environ['CC'] = settings.ikos_scan_cc()
     os.environ['CXX'] = settings.ikos_scan_cxx()
     os.environ['LD'] = settings.ikos_scan_cc()
@@ -826,6 +1109,9 @@ def main(argv):
 
     if not binaries:
         printf('Nothing to analyze.\n')
+    elif opt.batch:
+        analyze_batch(binaries, opt)
+        return
 
     # analyze each binary
     for binary in binaries:
@@ -837,13 +1123,8 @@ def main(argv):
 
         if answer in ('', 'y', 'yes'):
             cmd = ['ikos', bc_path, '-o', '%s.db' % exe_path]
+            if opt.incremental:
+                cmd.append('--incremental')
             log.info('Running %s' % colors.bold(command_string(cmd)))
 
-            cmd = [sys.executable,
-                   settings.ikos(),
-                   bc_path,
-                   '-o',
-                   '%s.db' % exe_path,
-                   '--color=%s' % opt.color,
-                   '--log=%s' % opt.log_level]
-            run(cmd)
+            run(ikos_command(bc_path, '%s.db' % exe_path, opt))
@@ -41,8 +41,14 @@
 # UNILATERAL TERMINATION OF THIS AGREEMENT.
 #
 ###############################################################################
+import sys
 import time
 
+try:
+    import resource
+except ImportError:  # not available on Windows
+    resource = None
+
 
 # use monotonic clock if available
 if hasattr(time, 'monotonic'):
@@ -95,6 +101,23 @@ class Stopwatch:
 
 _statistics = dict()
 
+# peak resident memory of the child processes (in KB), at the end of each
+# named stopwatch
+_peak_rss = dict()
+
+
+def children_peak_rss():
+    '''
+    Return the peak resident memory of the largest terminated child process,
+    in KB, or None if unavailable
+    '''
+    if resource is None:
+        return None
+    usage = resource.getrusage(resource.RUSAGE_CHILDREN)
+    if sys.platform == 'darwin':
+        return usage.ru_maxrss // 1024
+    return usage.ru_maxrss
+
 
 def get(key):
     ''' Gets a value from statistics table '''
@@ -122,6 +145,18 @@ def stop(key):
     sw = get(key)
     if sw is not None:
         sw.stop()
+        _peak_rss[key] = children_peak_rss()
+
+
+def peak_rss(key):
+    '''
+    Return the peak resident memory of the child processes (in KB) when the
+    named stopwatch was last stopped, or None
+
+    This is an upper bound of the memory used by the phase, since the
+    children of the previous phases are included.
+    '''
+    return _peak_rss.get(key)
 
 
 def rows():
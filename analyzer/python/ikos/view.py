@@ -45,10 +45,12 @@ import argparse
 import collections
 import io
 import json
+import multiprocessing
 import operator
 import os
 import os.path
 import re
+import shutil
 import sqlite3
 import sys
 import threading
@@ -128,7 +130,9 @@ class RequestHandler(BaseHTTPRequestHandler):
             (r'^/settings$',
              self._serve_settings),
             (r'^/report/(?P<id>[0-9]+)(\?k=(?P<kinds_filter>[A-Z0-9]+))?$',
-             self._serve_report)
+             self._serve_report),
+            (r'^/api/files(\?page=(?P<page>[0-9]+))?$',
+             self._serve_api_files),
         ]
 
         for pattern, f in urls:
@@ -158,14 +162,14 @@ class RequestHandler(BaseHTTPRequestHandler):
         self._write_template('homepage.html', {
             'check_kinds': json.dumps(self._check_kinds()),
             'check_kinds_filter': json.dumps(self._check_kinds_filter()),
-            'files': json.dumps(self._files()),
+            'files': '[]',
+            'files_url': json.dumps('/api/files'),
+            'report_url': json.dumps('/report/%d'),
         })
 
     def _check_kinds(self):
         ''' Generate the Javascript variable check_kinds '''
-        view_report = View.get().report
-        return [{'id': kind, 'name': CheckKind.long_name(kind)}
-                for kind in view_report.kinds]
+        return check_kinds(View.get().report)
 
     def _check_kinds_filter(self, param=None):
         ''' Generate the Javascript variable check_kinds_filter '''
@@ -186,42 +190,34 @@ class RequestHandler(BaseHTTPRequestHandler):
 
         return filter
 
-    def _files(self):
-        ''' Generate the Javascript variable files '''
+    # JSON API
+
+    # Number of files per page of /api/files
+    FILES_PER_PAGE = 50
+
+    def _serve_api_files(self, page):
+        ''' Serve a page of the list of files, sorted by path '''
+        page = int(page) if page else 0
         view_report = View.get().report
-        files = []
+        per_page = RequestHandler.FILES_PER_PAGE
+        num_pages = max(1, -(-len(view_report.sorted_files) // per_page))
 
-        for file in view_report.files:
+        files = []
+        for file in view_report.sorted_files[page * per_page:
+                                             (page + 1) * per_page]:
             files.append({
                 'id': file.id,
-                'path': report.format_path(file.path),
-                'status_kinds': view_report.files_status_kinds[file.id]
+                'path': file.path,
+                'status_kinds': view_report.file_status_kinds(file.id)
             })
 
-        # Sort by path
-        files.sort(key=operator.itemgetter('path'))
-
-        return files
+        self._write_json({'files': files, 'page': page, 'pages': num_pages})
 
     # Settings
 
     def _serve_settings(self):
         ''' Serve the settings page '''
-        db = View.get().db
-        settings = db.load_settings()
-        s = []
-
-        for name, value in settings.items():
-            if isinstance(value, list):
-                s.append('<tr><td>%s</td><td><i>%s</i></td></tr>'
-                         % (html.escape(name),
-                            html.escape(json.dumps(value))))
-            else:
-                s.append('<tr><td>%s</td><td><i>%s</i></td></tr>'
-                         % (html.escape(name),
-                            html.escape(str(value))))
-
-        self._write_template('settings.html', {'settings': '\n\t'.join(s)})
+        self._write_template('settings.html', settings_values(View.get().db))
 
     # File report
 
@@ -237,27 +233,14 @@ class RequestHandler(BaseHTTPRequestHandler):
             return
 
         try:
-            with io.open(file.path, 'r',
-                         encoding='utf-8',
-                         errors='ignore') as f:
-                code = f.read()
+            values = report_values(view_report, file)
         except (OSError, IOError):
             self._serve_error("No such file: %s" % file.path)
             return
 
-        fmt = Formatter(file)
-        code = highlight(code, CppLexer(), fmt)
         check_kinds_filter = self._check_kinds_filter(param=kinds_filter)
-        self._write_template('report.html', {
-            'filepath': html.escape(report.format_path(file.path)),
-            'check_kinds': json.dumps(self._check_kinds()),
-            'check_kinds_filter': json.dumps(check_kinds_filter),
-            'code': code,
-            'functions': json.dumps(fmt.functions),
-            'call_contexts': json.dumps(fmt.call_contexts),
-            'checks': json.dumps(fmt.checks),
-            'pygments_css': fmt.get_style_defs('.highlight')
-        })
+        values['check_kinds_filter'] = json.dumps(check_kinds_filter)
+        self._write_template('report.html', values)
 
     # Helpers
 
@@ -288,9 +271,24 @@ class RequestHandler(BaseHTTPRequestHandler):
             self.wfile.write(data)
             RequestHandler._static_cache[fullpath] = data
 
+    def _write_json(self, value):
+        ''' Write a JSON value to the response stream '''
+        self.send_response(200)
+        self.send_header('Content-Type', 'application/json; charset=UTF-8')
+        self.end_headers()
+        self.wfile.write(json.dumps(value).encode('utf8'))
+
+    # URLs of the pages, used by all the templates
+    URLS = {
+        'home_url': '/',
+        'settings_url': '/settings',
+        'static_url': '/static/',
+    }
+
     def _write_template(self, path, values={}, status=200):
         ''' Write a template to the response stream '''
         engine = TemplateEngine.get()
+        values = dict(values, **RequestHandler.URLS)
         self.send_response(status)
         self.send_header('Content-Type', 'text/html; charset=UTF-8')
         self.end_headers()
@@ -309,6 +307,51 @@ class RequestHandler(BaseHTTPRequestHandler):
                              status=500)
 
 
+def check_kinds(view_report):
+    ''' Generate the Javascript variable check_kinds '''
+    return [{'id': kind, 'name': CheckKind.long_name(kind)}
+            for kind in view_report.kinds]
+
+
+def settings_values(db):
+    ''' Return the values of the settings template '''
+    s = []
+    for name, value in db.load_settings().items():
+        if isinstance(value, list):
+            s.append('<tr><td>%s</td><td><i>%s</i></td></tr>'
+                     % (html.escape(name),
+                        html.escape(json.dumps(value))))
+        else:
+            s.append('<tr><td>%s</td><td><i>%s</i></td></tr>'
+                     % (html.escape(name),
+                        html.escape(str(value))))
+
+    return {'settings': '\n\t'.join(s)}
+
+
+def report_values(view_report, file):
+    '''
+    Return the values of the report template of a file, except the check
+    kinds filter
+
+    Raises IOError if the source file cannot be read.
+    '''
+    with io.open(file.path, 'r', encoding='utf-8', errors='ignore') as f:
+        code = f.read()
+
+    fmt = Formatter(file, view_report.file_lines_reports(file.id))
+    code = highlight(code, CppLexer(), fmt)
+    return {
+        'filepath': html.escape(report.format_path(file.path)),
+        'check_kinds': json.dumps(check_kinds(view_report)),
+        'code': code,
+        'functions': json.dumps(fmt.functions),
+        'call_contexts': json.dumps(fmt.call_contexts),
+        'checks': json.dumps(fmt.checks),
+        'pygments_css': fmt.get_style_defs('.highlight')
+    }
+
+
 class View:
     ''' Class for IKOS view (ikos-view) '''
 
@@ -343,71 +386,87 @@ class View:
 StatusKinds = collections.namedtuple('StatusKinds',
                                      ['ok', 'warning', 'error', 'unreachable'])
 
+# Entry of the list of files, with a formatted path
+FileEntry = collections.namedtuple('FileEntry', ['id', 'path'])
+
 
 class ViewReport:
-    ''' IKOS view report '''
+    '''
+    IKOS view report
+
+    The report of a file is only generated when it is requested.
+    '''
 
     def __init__(self, db):
         self.db = db
-        self._report = None
         self.kinds = None
         self.files = None
 
-        # Map[file.id, Map[check.status, Map[check.kind, count]]]
-        self.files_status_kinds = None
+        # List of files, sorted by formatted path
+        self.sorted_files = None
 
-        # Map[file.id, Map[check.line, List[Check]]]
-        self.files_lines_reports = None
+        # Map[file.id, Map[check.status, Map[check.kind, count]]]
+        self._files_status_kinds = {}
 
     def pre_process(self):
-        ''' Pre processing some values '''
-        # List of CheckKind
-        c = self.db.con.cursor()
-        rows = c.execute("SELECT DISTINCT kind FROM checks ORDER BY kind")
-        self.kinds = [row[0] for row in rows]
+        ''' Create the indexes and load the list of files '''
+        self.db.create_indexes()
 
-        # Generate report
-        self._report = report.generate_report(self.db)
+        # List of CheckKind
+        self.kinds = self.db.load_check_kinds()
 
         self.files = self.db.files
-        self.files_status_kinds = {}
-        self.files_lines_reports = {}
-        for file in self.files:
-            self.files_status_kinds[file.id] = StatusKinds(ok={},
-                                                           warning={},
-                                                           error={},
-                                                           unreachable={})
-            self.files_lines_reports[file.id] = {}
-
-        for statement_report in self._report.statement_reports:
-            stmt = statement_report.statement()
-            file = stmt.file()
 
-            if file is None:
-                continue  # Ignore checks without a file
+        c = self.db.con.cursor()
+        c.execute('SELECT id, path FROM files')
+        self.sorted_files = [FileEntry(id, report.format_path(path))
+                             for id, path in c]
+        self.sorted_files.sort(key=operator.attrgetter('path'))
+
+    def file_lines_reports(self, file_id):
+        '''
+        Generate the report of a file
+
+        Return a Map[check.line, List[StatementReport]]
+        '''
+        status_kinds = StatusKinds(ok={}, warning={}, error={}, unreachable={})
+        lines_reports = {}
 
+        file_report = report.generate_report(self.db, file_id=file_id)
+        for statement_report in file_report.statement_reports:
+            stmt = statement_report.statement()
             kind = statement_report.kind
             status = statement_report.status
 
-            # Update self.files_status_kinds
-            kinds = self.files_status_kinds[file.id][status]
+            # Update status_kinds
+            kinds = status_kinds[status]
             if kind not in kinds:
                 kinds[kind] = 0
             kinds[kind] += 1
 
-            # Update self.files_lines_reports
-            lines_reports = self.files_lines_reports[file.id]
+            # Update lines_reports
             if stmt.line not in lines_reports:
                 lines_reports[stmt.line] = []
             lines_reports[stmt.line].append(statement_report)
 
+        self._files_status_kinds[file_id] = status_kinds
+        return lines_reports
+
+    def file_status_kinds(self, file_id):
+        ''' Return the number of checks per status and kind of a file '''
+        if file_id not in self._files_status_kinds:
+            self.file_lines_reports(file_id)
+
+        return self._files_status_kinds[file_id]
+
 
 class Formatter(HtmlFormatter):
     ''' Source code HTML formatter '''
 
-    def __init__(self, file):
+    def __init__(self, file, lines_reports):
         super(Formatter, self).__init__()
         self.file = file
+        self.lines_reports = lines_reports
         self.functions = {}
         self.call_contexts = {}
         self.checks = {}
@@ -416,8 +475,7 @@ class Formatter(HtmlFormatter):
         return self._wrap_code(source)
 
     def _wrap_code(self, source):
-        view_report = View.get().report
-        lines_reports = view_report.files_lines_reports[self.file.id]
+        lines_reports = self.lines_reports
 
         yield 0, '<div class="highlight">\n'
         line_num = 1
@@ -526,6 +584,126 @@ class Formatter(HtmlFormatter):
         self.call_contexts[call_context_id] = '\n'.join(lines)
 
 
+##########
+# export #
+##########
+
+# View report of a worker process of export()
+_export_report = None
+
+
+def _init_export_worker(path, kinds):
+    global _export_report
+    db = OutputDatabase(path, lazy=True, read_only=True)
+    _export_report = ViewReport(db)
+    _export_report.kinds = kinds
+    _export_report.files = db.files
+
+
+def _export_file(args):
+    ''' Write the report page of a file, return its status kinds '''
+    file_id, directory = args
+    view_report = _export_report
+    file = view_report.files[file_id]
+    urls = {
+        'home_url': '../index.html',
+        'settings_url': '../settings.html',
+        'static_url': '../static/',
+    }
+    engine = TemplateEngine.get()
+
+    try:
+        values = report_values(view_report, file)
+        values['check_kinds_filter'] = json.dumps(
+            {kind: True for kind in view_report.kinds})
+        page = engine.process('report.html', dict(values, **urls))
+    except (OSError, IOError):
+        page = engine.process('error.html', dict(
+            urls, message=html.escape('No such file: %s' % file.path)))
+
+    path = os.path.join(directory, 'report', '%d.html' % file_id)
+    with io.open(path, 'w', encoding='utf-8') as f:
+        f.write(page)
+
+    return file_id, view_report.file_status_kinds(file_id)
+
+
+def export(db, directory, jobs):
+    '''
+    Write the pages of ikos-view in the given directory, as static files
+
+    The report pages of the files are generated by `jobs` processes, each with
+    its own database connection.
+    '''
+    view_report = ViewReport(db)
+    view_report.pre_process()
+
+    report_dir = os.path.join(directory, 'report')
+    if not os.path.isdir(report_dir):
+        os.makedirs(report_dir)
+
+    # static resources
+    static_dir = os.path.join(directory, 'static')
+    if os.path.isdir(static_dir):
+        shutil.rmtree(static_dir)
+    shutil.copytree(os.path.join(SHARE_DIR, 'static'), static_dir)
+
+    # report pages, in parallel
+    log.info('Exporting the reports of %d files'
+             % len(view_report.sorted_files))
+    tasks = [(file.id, directory) for file in view_report.sorted_files]
+    status_kinds = {}
+    if jobs > 1 and len(tasks) > 1:
+        pool = multiprocessing.Pool(jobs,
+                                    _init_export_worker,
+                                    (db.path, view_report.kinds))
+        try:
+            for file_id, kinds in pool.imap_unordered(_export_file,
+                                                      tasks,
+                                                      chunksize=8):
+                status_kinds[file_id] = kinds
+        finally:
+            pool.close()
+            pool.join()
+    else:
+        _init_export_worker(db.path, view_report.kinds)
+        for task in tasks:
+            file_id, kinds = _export_file(task)
+            status_kinds[file_id] = kinds
+
+    # homepage and settings
+    urls = {
+        'home_url': 'index.html',
+        'settings_url': 'settings.html',
+        'static_url': 'static/',
+    }
+    engine = TemplateEngine.get()
+    files = [{'id': file.id,
+              'path': file.path,
+              'status_kinds': status_kinds[file.id]}
+             for file in view_report.sorted_files]
+    homepage = engine.process('homepage.html', dict(urls, **{
+        'check_kinds': json.dumps(check_kinds(view_report)),
+        'check_kinds_filter': json.dumps(
+            {kind: True for kind in view_report.kinds}),
+        'files': json.dumps(files),
+        'files_url': 'null',
+        'report_url': json.dumps('report/%d.html'),
+    }))
+    with io.open(os.path.join(directory, 'index.html'), 'w',
+                 encoding='utf-8') as f:
+        f.write(homepage)
+
+    settings_page = engine.process('settings.html',
+                                   dict(urls, **settings_values(db)))
+    with io.open(os.path.join(directory, 'settings.html'), 'w',
+                 encoding='utf-8') as f:
+        f.write(settings_page)
+
+    log.info('Open %s in a web browser'
+             % os.path.join(directory, 'index.html'))
+
+
 ##########################
 # command line interface #
 ##########################
@@ -571,6 +749,19 @@ def parse_arguments(argv):
                         help='Listening port',
                         default=8080,
                         type=int)
+    parser.add_argument('--export',
+                        dest='export_dir',
+                        metavar='<directory>',
+                        help='Write the pages in the given directory, as '
+                             'static files, instead of starting a server',
+                        default=None)
+    parser.add_argument('-j', '--jobs',
+                        dest='jobs',
+                        metavar='<n>',
+                        help='Number of processes rendering the pages with '
+                             '--export (default: number of CPUs)',
+                        type=int,
+                        default=multiprocessing.cpu_count())
 
     return parser.parse_args(argv)
 
@@ -601,7 +792,12 @@ def main(argv):
 
     try:
         # open result database
-        db = OutputDatabase(opt.file)
+        db = OutputDatabase(opt.file, lazy=True, read_only=True)
+
+        if opt.export_dir:
+            export(db, opt.export_dir, opt.jobs)
+            db.close()
+            return
 
         v = View(db, port=opt.port)
         browser_timer = threading.Timer(0.1,
@@ -61,15 +61,25 @@ function check_kinds_filter_parameter() {
  * param e - event
  */
 function init_files_list(e) {
-  var check_kinds_filter_param = check_kinds_filter_parameter();
   var table = document.getElementById('table_files_tbody');
   table.innerHTML = '';
-  for (var i = 0; i < window.files.length; i++) {
-    var file = window.files[i];
+  append_files(window.files);
+}
+
+/** Append rows to the list of files
+ *
+ * param files - the files to append
+ */
+function append_files(files) {
+  var check_kinds_filter_param = check_kinds_filter_parameter();
+  var table = document.getElementById('table_files_tbody');
+  for (var i = 0; i < files.length; i++) {
+    var file = files[i];
 
     var a = document.createElement('a');
     a.className = 'file_link';
-    a.href = '/report/' + file.id + '?k=' + check_kinds_filter_param;
+    a.href = window.report_url.replace('%d', file.id) +
+             '?k=' + check_kinds_filter_param;
     a.appendChild(document.createTextNode(file.path));
 
     var td_name = document.createElement('td');
@@ -100,6 +110,24 @@ function init_files_list(e) {
   }
 }
 
+/** Load a page of the list of files from the server, then the next ones
+ *
+ * param page - the page number
+ */
+function load_files(page) {
+  var request = new XMLHttpRequest();
+  request.addEventListener('load', function(e) {
+    var response = JSON.parse(request.responseText);
+    window.files = window.files.concat(response.files);
+    append_files(response.files);
+    if (response.page + 1 < response.pages) {
+      load_files(response.page + 1);
+    }
+  });
+  request.open('GET', window.files_url + '?page=' + page);
+  request.send();
+}
+
 /** Count the number of checks given the map from kind to count
  *
  * param kinds - the map from kind to count
@@ -116,4 +144,11 @@ function count_checks(kinds) {
 
 /** load event */
 window.addEventListener('load', init_check_kinds_list);
-window.addEventListener('load', init_files_list);
+window.addEventListener('load', function(e) {
+  // The list of files of an exported report is part of the page
+  if (window.files_url === null) {
+    init_files_list();
+  } else {
+    load_files(0);
+  }
+});
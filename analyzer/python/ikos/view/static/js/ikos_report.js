@@ -1,3 +1,26 @@
+/** Read the check kinds filter from the URL parameter
+ *
+ * The server already applies it, but an exported report is a static page.
+ *
+ * param e - event
+ */
+function parse_check_kinds_filter_parameter(e) {
+  var match = /[?&]k=([0-9A-F]+)/.exec(window.location.search);
+  if (match === null) {
+    return;
+  }
+
+  var param = match[1];
+  for (var i = 0; i < window.check_kinds.length; i++) {
+    var kind = window.check_kinds[i].id;
+    var byte_index = Math.floor(kind / 8);
+    if (2 * byte_index + 2 <= param.length) {
+      var byte = parseInt(param.substr(2 * byte_index, 2), 16);
+      window.check_kinds_filter[kind] = (byte & (1 << (kind % 8))) !== 0;
+    }
+  }
+}
+
 /** Init the list of checks
  *
  * param e - event
@@ -406,6 +429,7 @@ function close_modal(e) {
 }
 
 //** load events */
+window.addEventListener('load', parse_check_kinds_filter_parameter);
 window.addEventListener('load', init_checks);
 window.addEventListener('load', init_check_kinds_list);
 window.addEventListener('load', init_status_checkbox);
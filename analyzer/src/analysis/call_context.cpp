@@ -41,28 +41,58 @@
  *
  ******************************************************************************/
 
+#include <vector>
+
 #include <ikos/analyzer/analysis/call_context.hpp>
 
 namespace ikos {
 namespace analyzer {
 
 CallContextFactory::CallContextFactory()
-    : _empty_call_context(new CallContext()) {}
+    : _empty_call_context(CallContext::PrivateCtor()), _next_id(1) {}
 
 CallContextFactory::~CallContextFactory() = default;
 
 CallContext* CallContextFactory::get_context(CallContext* parent,
                                              ar::CallBase* call) {
   ikos_assert(parent != nullptr && call != nullptr);
-  auto it = this->_map.find({parent, call});
-  if (it == this->_map.end()) {
-    auto call_context = new CallContext(parent, call);
-    this->_map.try_emplace({parent, call},
-                           std::unique_ptr< CallContext >(call_context));
+  auto& shard = this->_tries.shard(std::make_pair(parent, call));
+  ConcurrentLockGuard lock(shard.mutex);
+  auto it = shard.map.children.find({parent, call});
+  if (it == shard.map.children.end()) {
+    CallContext::Id id = this->_next_id++;
+    ikos_assert_msg(id != 0, "too many call contexts");
+    shard.map.arena.emplace_back(parent, call, id, CallContext::PrivateCtor());
+    CallContext* call_context = &shard.map.arena.back();
+    shard.map.children.try_emplace({parent, call}, call_context);
     return call_context;
   } else {
-    return it->second.get();
+    return it->second;
+  }
+}
+
+CallContext* CallContextFactory::get_context(CallContext* parent,
+                                             ar::CallBase* call,
+                                             std::size_t depth) {
+  if (parent->depth() < depth) {
+    return this->get_context(parent, call);
+  }
+
+  // Last call statements, most recent first
+  std::vector< ar::CallBase* > calls;
+  calls.reserve(depth);
+  if (depth > 0) {
+    calls.push_back(call);
+  }
+  for (CallContext* it = parent; calls.size() < depth; it = it->parent()) {
+    calls.push_back(it->call());
+  }
+
+  CallContext* context = this->get_empty();
+  for (auto it = calls.rbegin(), et = calls.rend(); it != et; ++it) {
+    context = this->get_context(context, *it);
   }
+  return context;
 }
 
 } // end namespace analyzer
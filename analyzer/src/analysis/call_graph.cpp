@@ -0,0 +1,270 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Call graph and strongly connected components implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <utility>
+
+#include <ikos/ar/semantic/statement.hpp>
+#include <ikos/ar/semantic/value.hpp>
+#include <ikos/ar/verify/type.hpp>
+
+#include <ikos/analyzer/analysis/call_graph.hpp>
+#include <ikos/analyzer/support/assert.hpp>
+#include <ikos/analyzer/support/cast.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+namespace {
+
+/// \brief Insert the functions whose address is used by the given value
+void collect_address_taken(ar::Value* value,
+                           std::vector< ar::Function* >& functions) {
+  if (auto cst = dyn_cast< ar::FunctionPointerConstant >(value)) {
+    functions.push_back(cst->function());
+  } else if (auto cst = dyn_cast< ar::StructConstant >(value)) {
+    for (auto it = cst->field_begin(), et = cst->field_end(); it != et; ++it) {
+      collect_address_taken(it->second, functions);
+    }
+  } else if (auto cst = dyn_cast< ar::SequentialConstant >(value)) {
+    for (auto it = cst->element_begin(), et = cst->element_end(); it != et;
+         ++it) {
+      collect_address_taken(*it, functions);
+    }
+  }
+}
+
+/// \brief Insert the functions whose address is used in the given code
+///
+/// The called operand of a call statement is not an address use.
+void collect_address_taken(ar::Code* code,
+                           std::vector< ar::Function* >& functions) {
+  for (ar::BasicBlock* bb : *code) {
+    for (ar::Statement* stmt : *bb) {
+      auto call = dyn_cast< ar::CallBase >(stmt);
+      for (auto it = stmt->op_begin(), et = stmt->op_end(); it != et; ++it) {
+        if (call != nullptr && *it == call->called()) {
+          continue;
+        }
+        collect_address_taken(*it, functions);
+      }
+    }
+  }
+}
+
+} // end anonymous namespace
+
+CallGraph::CallGraph(Context& ctx) : _ctx(ctx) {}
+
+CallGraph::~CallGraph() = default;
+
+void CallGraph::run() {
+  ar::Bundle* bundle = this->_ctx.bundle;
+
+  // Functions whose address is taken, potential targets of indirect calls
+  std::vector< ar::Function* > address_taken;
+  for (auto it = bundle->global_begin(), et = bundle->global_end(); it != et;
+       ++it) {
+    if ((*it)->is_definition()) {
+      collect_address_taken((*it)->initializer(), address_taken);
+    }
+  }
+  for (auto it = bundle->function_begin(), et = bundle->function_end();
+       it != et;
+       ++it) {
+    if ((*it)->is_definition()) {
+      collect_address_taken((*it)->body(), address_taken);
+    }
+  }
+  std::sort(address_taken.begin(), address_taken.end());
+  address_taken.erase(std::unique(address_taken.begin(), address_taken.end()),
+                      address_taken.end());
+  address_taken.erase(std::remove_if(address_taken.begin(),
+                                     address_taken.end(),
+                                     [](ar::Function* fun) {
+                                       return fun->is_declaration();
+                                     }),
+                      address_taken.end());
+
+  // Edges
+  std::vector< ar::Function* > functions;
+  for (auto it = bundle->function_begin(), et = bundle->function_end();
+       it != et;
+       ++it) {
+    ar::Function* fun = *it;
+    if (fun->is_declaration()) {
+      continue;
+    }
+    functions.push_back(fun);
+
+    std::vector< ar::Function* >& callees = this->_callees[fun];
+    for (ar::BasicBlock* bb : *fun->body()) {
+      for (ar::Statement* stmt : *bb) {
+        auto call = dyn_cast< ar::CallBase >(stmt);
+        if (call == nullptr) {
+          continue;
+        }
+        ar::Value* called = call->called();
+        if (auto cst = dyn_cast< ar::FunctionPointerConstant >(called)) {
+          if (cst->function()->is_definition()) {
+            callees.push_back(cst->function());
+          }
+        } else if (isa< ar::InternalVariable >(called)) {
+          for (ar::Function* callee : address_taken) {
+            if (ar::TypeVerifier::is_valid_call(call, callee->type())) {
+              callees.push_back(callee);
+            }
+          }
+        }
+      }
+    }
+    std::sort(callees.begin(), callees.end());
+    callees.erase(std::unique(callees.begin(), callees.end()), callees.end());
+  }
+
+  // Strongly connected components, using an iterative version of Tarjan's
+  // algorithm. Components are found in reverse topological order.
+  struct Frame {
+    ar::Function* fun;
+    std::size_t next_callee;
+  };
+  llvm::DenseMap< ar::Function*, std::pair< unsigned, unsigned > > index_low;
+  std::vector< ar::Function* > stack;
+  llvm::DenseMap< ar::Function*, bool > on_stack;
+  std::vector< Frame > frames;
+  unsigned next_index = 0;
+
+  for (ar::Function* root : functions) {
+    if (index_low.count(root) != 0) {
+      continue;
+    }
+
+    index_low[root] = {next_index, next_index};
+    next_index++;
+    stack.push_back(root);
+    on_stack[root] = true;
+    frames.push_back(Frame{root, 0});
+
+    while (!frames.empty()) {
+      Frame& frame = frames.back();
+      const std::vector< ar::Function* >& callees = this->_callees[frame.fun];
+
+      if (frame.next_callee < callees.size()) {
+        ar::Function* callee = callees[frame.next_callee++];
+        auto it = index_low.find(callee);
+        if (it == index_low.end()) {
+          index_low[callee] = {next_index, next_index};
+          next_index++;
+          stack.push_back(callee);
+          on_stack[callee] = true;
+          frames.push_back(Frame{callee, 0});
+        } else if (on_stack[callee]) {
+          auto& low = index_low[frame.fun].second;
+          low = std::min(low, it->second.first);
+        }
+        continue;
+      }
+
+      ar::Function* fun = frame.fun;
+      frames.pop_back();
+      std::pair< unsigned, unsigned > fun_index_low = index_low[fun];
+
+      if (!frames.empty()) {
+        auto& low = index_low[frames.back().fun].second;
+        low = std::min(low, fun_index_low.second);
+      }
+
+      if (fun_index_low.first == fun_index_low.second) {
+        // Root of a strongly connected component
+        auto scc = static_cast< unsigned >(this->_recursive.size());
+        bool recursive = false;
+        ar::Function* member;
+        do {
+          member = stack.back();
+          stack.pop_back();
+          on_stack[member] = false;
+          this->_scc[member] = scc;
+          this->_bottom_up.push_back(member);
+          recursive = recursive || member != fun;
+        } while (member != fun);
+
+        const std::vector< ar::Function* >& fun_callees = this->_callees[fun];
+        recursive = recursive || std::binary_search(fun_callees.begin(),
+                                                    fun_callees.end(),
+                                                    fun);
+        this->_recursive.push_back(recursive);
+      }
+    }
+  }
+}
+
+const std::vector< ar::Function* >& CallGraph::callees(
+    ar::Function* fun) const {
+  auto it = this->_callees.find(fun);
+  ikos_assert_msg(it != this->_callees.end(), "function not in call graph");
+  return it->second;
+}
+
+std::vector< ar::Function* > CallGraph::reachable(ar::Function* fun) const {
+  std::vector< ar::Function* > result{fun};
+  llvm::DenseMap< ar::Function*, bool > visited;
+  visited[fun] = true;
+  for (std::size_t i = 0; i < result.size(); i++) {
+    for (ar::Function* callee : this->callees(result[i])) {
+      if (!visited[callee]) {
+        visited[callee] = true;
+        result.push_back(callee);
+      }
+    }
+  }
+  return result;
+}
+
+unsigned CallGraph::scc(ar::Function* fun) const {
+  auto it = this->_scc.find(fun);
+  ikos_assert_msg(it != this->_scc.end(), "function not in call graph");
+  return it->second;
+}
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Checkpoint implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <ikos/analyzer/analysis/checkpoint.hpp>
+#include <ikos/analyzer/database/output.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+Checkpoint::Checkpoint(const std::string& path, bool resume) {
+  if (resume) {
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+      // entry-point <domain> <next check id> <name>
+      std::size_t domain = line.find('\t');
+      if (domain == std::string::npos ||
+          line.compare(0, domain, "entry-point") != 0) {
+        continue;
+      }
+      std::size_t id = line.find('\t', domain + 1);
+      if (id == std::string::npos) {
+        continue;
+      }
+      std::size_t name = line.find('\t', id + 1);
+      if (name == std::string::npos) {
+        continue;
+      }
+      this->_done.emplace(line.substr(domain + 1, id - domain - 1),
+                          line.substr(name + 1));
+    }
+  }
+
+  this->_out.open(path, resume ? std::ios::app : std::ios::trunc);
+  if (this->_out.is_open()) {
+    this->_out << "run\n";
+    this->_out.flush();
+  }
+}
+
+bool Checkpoint::done(const OutputDatabase& output_db,
+                      ar::Function* entry_point) const {
+  return this->_done.count({output_db.checks.domain(), entry_point->name()}) !=
+         0;
+}
+
+void Checkpoint::save(OutputDatabase& output_db, ar::Function* entry_point) {
+  output_db.db.commit();
+  this->_out << "entry-point\t" << output_db.checks.domain() << "\t"
+             << output_db.checks.next_id() << "\t" << entry_point->name()
+             << "\n";
+  this->_out.flush();
+}
+
+} // end namespace analyzer
+} // end namespace ikos
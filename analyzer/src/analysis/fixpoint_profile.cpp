@@ -41,12 +41,17 @@
  *
  ******************************************************************************/
 
-#include <ikos/core/fixpoint/wto.hpp>
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <vector>
 
 #include <ikos/ar/semantic/statement.hpp>
 
 #include <ikos/analyzer/analysis/fixpoint_profile.hpp>
+#include <ikos/analyzer/analysis/wto.hpp>
 #include <ikos/analyzer/support/cast.hpp>
+#include <ikos/analyzer/util/concurrency.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -54,21 +59,28 @@ namespace analyzer {
 namespace {
 
 class FixpointProfileWtoVisitor
-    : public core::WtoComponentVisitor< ar::Code* > {
+    : public core::WtoComponentVisitor< const ar::CodeGraph* > {
 private:
-  using WtoVertexT = core::WtoVertex< ar::Code* >;
-  using WtoCycleT = core::WtoCycle< ar::Code* >;
+  using WtoVertexT = core::WtoVertex< const ar::CodeGraph* >;
+  using WtoCycleT = core::WtoCycle< const ar::CodeGraph* >;
 
 private:
   llvm::DenseMap< ar::BasicBlock*, std::unique_ptr< core::MachineInt > >*
       _collector;
 
+  std::vector< core::MachineInt >* _thresholds;
+
+  /// \brief Number of cycles containing the current component
+  unsigned _depth = 0;
+
 public:
   /// \brief Default constructor
-  explicit FixpointProfileWtoVisitor(
+  FixpointProfileWtoVisitor(
       llvm::DenseMap< ar::BasicBlock*, std::unique_ptr< core::MachineInt > >*
-          collector) {
+          collector,
+      std::vector< core::MachineInt >* thresholds) {
     this->_collector = collector;
+    this->_thresholds = thresholds;
   }
 
   /// \brief Default copy constructor
@@ -87,7 +99,11 @@ public:
   /// \brief Destructor
   ~FixpointProfileWtoVisitor() override = default;
 
-  void visit(const WtoVertexT&) override {}
+  void visit(const WtoVertexT& vertex) override {
+    if (this->_depth > 0) {
+      this->collect_thresholds(vertex.node());
+    }
+  }
 
   void visit(const WtoCycleT& cycle) override {
     auto head = cycle.head();
@@ -98,12 +114,42 @@ public:
         this->_collector->try_emplace(head,
                                       std::make_unique< ar::MachineInt >(
                                           *constant));
+        this->add_threshold(*constant);
       }
     }
 
+    this->collect_thresholds(head);
+
+    this->_depth++;
     for (auto it = cycle.begin(), et = cycle.end(); it != et; ++it) {
       it->accept(*this);
     }
+    this->_depth--;
+  }
+
+  /// \brief Add the constants compared against in the given basic block to
+  /// the widening thresholds
+  void collect_thresholds(ar::BasicBlock* bb) {
+    for (ar::Statement* stmt : *bb) {
+      if (auto cmp = dyn_cast< ar::Comparison >(stmt)) {
+        if (auto constant = this->comparison_constant(cmp)) {
+          this->add_threshold(*constant);
+        }
+      }
+    }
+  }
+
+  /// \brief Add a widening threshold, if not already present
+  void add_threshold(const ar::MachineInt& n) {
+    auto it = std::find_if(this->_thresholds->begin(),
+                           this->_thresholds->end(),
+                           [&n](const ar::MachineInt& m) {
+                             return m.bit_width() == n.bit_width() &&
+                                    m.sign() == n.sign() && m == n;
+                           });
+    if (it == this->_thresholds->end()) {
+      this->_thresholds->push_back(n);
+    }
   }
 
   boost::optional< ar::MachineInt > extract_constant(ar::BasicBlock* bb) const {
@@ -111,52 +157,59 @@ public:
       return boost::none;
     }
 
-    // we have a comparison, check if there is a constant
     if (auto cmp = dyn_cast< ar::Comparison >(bb->front())) {
-      ar::IntegerConstant* constant = nullptr;
-      bool cst_left;
-
-      if (cmp->left()->is_integer_constant()) {
-        constant = cast< ar::IntegerConstant >(cmp->left());
-        cst_left = true;
-      } else if (cmp->right()->is_integer_constant()) {
-        constant = cast< ar::IntegerConstant >(cmp->right());
-        cst_left = false;
-      } else {
-        return boost::none;
-      }
+      return this->comparison_constant(cmp);
+    } else {
+      return boost::none;
+    }
+  }
 
-      ar::MachineInt value = constant->value();
-      ar::MachineInt one(1, value.bit_width(), value.sign());
-      bool overflow = false;
-
-      // check if the comparison is <= or >=
-      if (cmp->predicate() == ar::Comparison::UIGE ||
-          cmp->predicate() == ar::Comparison::SIGE) {
-        if (cst_left) {
-          // case `cst >= var` <=> `cst + 1 > var`
-          value = add(value, one, overflow);
-        } else {
-          // case `var >= cst` <=> `var > cst - 1`
-          value = sub(value, one, overflow);
-        }
-      } else if (cmp->predicate() == ar::Comparison::UILE ||
-                 cmp->predicate() == ar::Comparison::SILE) {
-        if (cst_left) {
-          // case `cst <= var` <=> `cst - 1 < var`
-          value = sub(value, one, overflow);
-        } else {
-          // case `var <= cst` <=> `var < cst + 1`
-          value = add(value, one, overflow);
-        }
+  /// \brief Return the constant compared against in the given comparison,
+  /// adjusted into a strict bound
+  boost::optional< ar::MachineInt > comparison_constant(
+      ar::Comparison* cmp) const {
+    // check if there is a constant
+    ar::IntegerConstant* constant = nullptr;
+    bool cst_left;
+
+    if (cmp->left()->is_integer_constant()) {
+      constant = cast< ar::IntegerConstant >(cmp->left());
+      cst_left = true;
+    } else if (cmp->right()->is_integer_constant()) {
+      constant = cast< ar::IntegerConstant >(cmp->right());
+      cst_left = false;
+    } else {
+      return boost::none;
+    }
+
+    ar::MachineInt value = constant->value();
+    ar::MachineInt one(1, value.bit_width(), value.sign());
+    bool overflow = false;
+
+    // check if the comparison is <= or >=
+    if (cmp->predicate() == ar::Comparison::UIGE ||
+        cmp->predicate() == ar::Comparison::SIGE) {
+      if (cst_left) {
+        // case `cst >= var` <=> `cst + 1 > var`
+        value = add(value, one, overflow);
+      } else {
+        // case `var >= cst` <=> `var > cst - 1`
+        value = sub(value, one, overflow);
       }
-      if (overflow) {
-        return boost::none;
+    } else if (cmp->predicate() == ar::Comparison::UILE ||
+               cmp->predicate() == ar::Comparison::SILE) {
+      if (cst_left) {
+        // case `cst <= var` <=> `cst - 1 < var`
+        value = sub(value, one, overflow);
+      } else {
+        // case `var <= cst` <=> `var < cst + 1`
+        value = add(value, one, overflow);
       }
-      return value;
-    } else {
+    }
+    if (overflow) {
       return boost::none;
     }
+    return value;
   }
 
 }; // end class FixpointProfileWtoVisitor
@@ -168,20 +221,132 @@ void FixpointProfileAnalysis::run() {
   for (auto it = bundle->function_begin(), et = bundle->function_end();
        it != et;
        it++) {
-    if (auto profile = this->analyze_function(*it)) {
-      this->_map.try_emplace(*it, std::move(profile));
-    }
+    this->profile(*it);
   }
 }
 
 void FixpointProfileAnalysis::dump(std::ostream& o) const {
   for (const auto& item : this->_map) {
+    if (item.second == nullptr) {
+      continue;
+    }
     o << "function " << item.first->name() << ':' << std::endl;
     item.second->dump(o);
     o << std::endl;
   }
 }
 
+namespace {
+
+/// \brief Header of the persisted profiles
+constexpr const char* ProfilesHeader = "ikos-fixpoint-profiles 2";
+
+} // end anonymous namespace
+
+void FixpointProfileAnalysis::save(std::ostream& o,
+                                   const std::string& key) const {
+  o << ProfilesHeader << ' ' << key << '\n';
+  for (const auto& item : this->_map) {
+    ar::Function* fun = item.first;
+    const FixpointProfile* profile = item.second.get();
+
+    o << (profile != nullptr ? profile->_widening_hints.size() : 0) << ' '
+      << (profile != nullptr ? profile->_widening_thresholds.size() : 0) << ' '
+      << fun->name() << '\n';
+    if (profile == nullptr) {
+      continue;
+    }
+
+    std::size_t index = 0;
+    for (ar::BasicBlock* bb : *fun->body()) {
+      auto it = profile->_widening_hints.find(bb);
+      if (it != profile->_widening_hints.end()) {
+        const core::MachineInt& hint = *it->second;
+        o << index << ' ' << hint.bit_width() << ' '
+          << (hint.is_signed() ? 's' : 'u') << ' ' << hint.to_z_number()
+          << '\n';
+      }
+      index++;
+    }
+    for (const core::MachineInt& threshold : profile->_widening_thresholds) {
+      o << threshold.bit_width() << ' ' << (threshold.is_signed() ? 's' : 'u')
+        << ' ' << threshold.to_z_number() << '\n';
+    }
+  }
+}
+
+bool FixpointProfileAnalysis::load(std::istream& i, const std::string& key) {
+  std::string line;
+  if (!std::getline(i, line) ||
+      line != std::string(ProfilesHeader) + ' ' + key) {
+    return false;
+  }
+
+  auto bundle = this->_ctx.bundle;
+  llvm::DenseMap< ar::Function*, std::unique_ptr< FixpointProfile > > map;
+  std::size_t num_hints;
+  std::size_t num_thresholds;
+  while (i >> num_hints >> num_thresholds) {
+    std::string name;
+    i.get();
+    if (!std::getline(i, name)) {
+      return false;
+    }
+    ar::Function* fun = bundle->function_or_null(name);
+    if (fun == nullptr || !fun->is_definition()) {
+      return false;
+    }
+    if (num_hints == 0 && num_thresholds == 0) {
+      map.try_emplace(fun, nullptr);
+      continue;
+    }
+
+    std::vector< ar::BasicBlock* > blocks(fun->body()->begin(),
+                                          fun->body()->end());
+    std::unique_ptr< FixpointProfile > profile(new FixpointProfile(fun));
+    for (std::size_t n = 0; n < num_hints; n++) {
+      std::size_t index;
+      uint64_t bit_width;
+      char sign;
+      std::string value;
+      if (!(i >> index >> bit_width >> sign >> value) ||
+          index >= blocks.size() || bit_width == 0 ||
+          (sign != 's' && sign != 'u')) {
+        return false;
+      }
+      profile->_widening_hints
+          .try_emplace(blocks[index],
+                       std::make_unique< core::MachineInt >(
+                           core::ZNumber::from_string(value),
+                           bit_width,
+                           sign == 's' ? core::Signed : core::Unsigned));
+    }
+    for (std::size_t n = 0; n < num_thresholds; n++) {
+      uint64_t bit_width;
+      char sign;
+      std::string value;
+      if (!(i >> bit_width >> sign >> value) || bit_width == 0 ||
+          (sign != 's' && sign != 'u')) {
+        return false;
+      }
+      profile->_widening_thresholds
+          .emplace_back(core::ZNumber::from_string(value),
+                        bit_width,
+                        sign == 's' ? core::Signed : core::Unsigned);
+    }
+    map.try_emplace(fun, std::move(profile));
+  }
+  if (!i.eof()) {
+    return false;
+  }
+
+  ConcurrentLockGuard lock(this->_mutex);
+  for (auto& item : map) {
+    this->_map.try_emplace(item.first, std::move(item.second));
+  }
+  return true;
+}
+
 std::unique_ptr< FixpointProfile > FixpointProfileAnalysis::analyze_function(
     ar::Function* fun) {
   if (!fun->is_definition()) {
@@ -189,8 +354,9 @@ std::unique_ptr< FixpointProfile > FixpointProfileAnalysis::analyze_function(
   }
 
   std::unique_ptr< FixpointProfile > profile(new FixpointProfile(fun));
-  FixpointProfileWtoVisitor visitor(&profile->_widening_hints);
-  core::Wto< ar::Code* > wto(fun->body());
+  FixpointProfileWtoVisitor visitor(&profile->_widening_hints,
+                                    &profile->_widening_thresholds);
+  WtoCache::WtoT wto = this->_ctx.wto_cache->wto(fun->body());
   wto.accept(visitor);
   if (!profile->empty()) {
     return profile;
@@ -200,13 +366,27 @@ std::unique_ptr< FixpointProfile > FixpointProfileAnalysis::analyze_function(
 }
 
 boost::optional< const FixpointProfile& > FixpointProfileAnalysis::profile(
-    ar::Function* fun) const {
-  auto it = this->_map.find(fun);
-  if (it != this->_map.end()) {
-    return *(it->second);
-  } else {
+    ar::Function* fun) {
+  {
+    ConcurrentLockGuard lock(this->_mutex);
+    auto it = this->_map.find(fun);
+    if (it != this->_map.end()) {
+      if (it->second == nullptr) {
+        return boost::none;
+      }
+      return *(it->second);
+    }
+  }
+
+  // Compute the profile without holding the lock
+  std::unique_ptr< FixpointProfile > profile = this->analyze_function(fun);
+
+  ConcurrentLockGuard lock(this->_mutex);
+  auto res = this->_map.try_emplace(fun, std::move(profile));
+  if (res.first->second == nullptr) {
     return boost::none;
   }
+  return *(res.first->second);
 }
 
 boost::optional< const core::MachineInt& > FixpointProfile::widening_hint(
@@ -220,7 +400,7 @@ boost::optional< const core::MachineInt& > FixpointProfile::widening_hint(
 }
 
 bool FixpointProfile::empty() const {
-  return this->_widening_hints.empty();
+  return this->_widening_hints.empty() && this->_widening_thresholds.empty();
 }
 
 void FixpointProfile::dump(std::ostream& o) const {
@@ -229,6 +409,13 @@ void FixpointProfile::dump(std::ostream& o) const {
     item.first->dump(o);
     o << ": " << *item.second << std::endl;
   }
+  if (!this->_widening_thresholds.empty()) {
+    o << " • thresholds:";
+    for (const core::MachineInt& threshold : this->_widening_thresholds) {
+      o << ' ' << threshold;
+    }
+    o << std::endl;
+  }
 }
 
 } // namespace analyzer
@@ -0,0 +1,210 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief FixpointTraceWriter implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <ikos/core/support/assert.hpp>
+
+#include <ikos/analyzer/analysis/fixpoint_trace.hpp>
+#include <ikos/analyzer/util/demangle.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
+#include <ikos/analyzer/util/source_location.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+namespace {
+
+/// \brief Return the number of microseconds in the given duration
+double microseconds(Timer::Duration d) {
+  return d.count() * 1e6;
+}
+
+/// \brief Return the name of a basic block
+std::string block_name(ar::BasicBlock* bb) {
+  return bb->has_name() ? bb->name() : "?";
+}
+
+/// \brief Return the source location of the first statement of a basic
+/// block, or an empty string
+std::string block_location(ar::BasicBlock* bb) {
+  for (ar::Statement* stmt : *bb) {
+    if (stmt->has_frontend()) {
+      SourceLocation loc = source_location(stmt);
+      if (loc) {
+        return loc.path().string() + ":" + std::to_string(loc.line());
+      }
+    }
+  }
+  return "";
+}
+
+} // end anonymous namespace
+
+FixpointTraceWriter::FixpointTraceWriter(const std::string& path,
+                                         std::chrono::microseconds threshold)
+    : _out(path, std::ios::out | std::ios::trunc),
+      _start(Timer::Clock::now()),
+      _threshold(threshold) {
+  this->_out << "[";
+}
+
+FixpointTraceWriter::~FixpointTraceWriter() {
+  this->_out << "\n]\n";
+}
+
+void FixpointTraceWriter::write(const std::string& name,
+                                const char* category,
+                                Timer::TimePoint begin,
+                                Timer::TimePoint end,
+                                const JsonDict& args) {
+  std::lock_guard< std::mutex > lock(this->_mutex);
+  auto it = this->_threads.emplace(std::this_thread::get_id(),
+                                   this->_threads.size());
+
+  JsonDict event{{"name", name},
+                 {"cat", category},
+                 {"ph", "X"},
+                 {"ts", microseconds(begin - this->_start)},
+                 {"dur", microseconds(end - begin)},
+                 {"pid", 0},
+                 {"tid", it.first->second},
+                 {"args", args}};
+  this->_out << (this->_first ? "\n" : ",\n") << event;
+  this->_first = false;
+}
+
+void FunctionFixpointTracer::push() {
+  Timer::TimePoint now = Timer::Clock::now();
+  std::lock_guard< std::mutex > lock(this->_mutex);
+  this->_stacks[std::this_thread::get_id()].push_back(now);
+}
+
+Timer::TimePoint FunctionFixpointTracer::pop() {
+  std::lock_guard< std::mutex > lock(this->_mutex);
+  auto it = this->_stacks.find(std::this_thread::get_id());
+  ikos_assert(it != this->_stacks.end() && !it->second.empty());
+  Timer::TimePoint begin = it->second.back();
+  it->second.pop_back();
+  if (it->second.empty()) {
+    this->_stacks.erase(it);
+  }
+  return begin;
+}
+
+void FunctionFixpointTracer::begin_function() {
+  this->push();
+}
+
+void FunctionFixpointTracer::end_function() {
+  Timer::TimePoint begin = this->pop();
+  Timer::TimePoint end = Timer::Clock::now();
+  if (!this->_writer.keep(end - begin)) {
+    return;
+  }
+
+  std::string name = demangle(this->_function);
+  this->_writer.write(name,
+                      "function",
+                      begin,
+                      end,
+                      JsonDict{{"function", name}});
+}
+
+void FunctionFixpointTracer::begin(core::FixpointEvent /*event*/,
+                                   ar::BasicBlock* /*node*/,
+                                   unsigned /*iteration*/) {
+  this->push();
+}
+
+void FunctionFixpointTracer::end(core::FixpointEvent event,
+                                 ar::BasicBlock* node,
+                                 unsigned iteration) {
+  Timer::TimePoint begin = this->pop();
+  Timer::TimePoint end = Timer::Clock::now();
+  if (!this->_writer.keep(end - begin)) {
+    return;
+  }
+
+  JsonDict args{{"function", demangle(this->_function)},
+                {"block", block_name(node)}};
+  std::string name;
+  const char* category = nullptr;
+  switch (event) {
+    case core::FixpointEvent::Node: {
+      name = block_name(node);
+      category = "node";
+    } break;
+    case core::FixpointEvent::Cycle: {
+      name = "cycle " + block_name(node);
+      category = "cycle";
+      std::string location = block_location(node);
+      if (!location.empty()) {
+        args.put("location", location);
+      }
+    } break;
+    case core::FixpointEvent::IncreasingIteration: {
+      name = "increasing #" + std::to_string(iteration);
+      category = "iteration";
+    } break;
+    case core::FixpointEvent::DecreasingIteration: {
+      name = "decreasing #" + std::to_string(iteration);
+      category = "iteration";
+    } break;
+    case core::FixpointEvent::Extrapolate: {
+      name = (iteration <= 1 ? "join #" : "widening #") +
+             std::to_string(iteration);
+      category = "extrapolate";
+    } break;
+    case core::FixpointEvent::Refine: {
+      name = "narrowing #" + std::to_string(iteration);
+      category = "refine";
+    } break;
+    default: {
+      ikos_unreachable("unexpected event");
+    }
+  }
+
+  this->_writer.write(name, category, begin, end, args);
+}
+
+} // end namespace analyzer
+} // end namespace ikos
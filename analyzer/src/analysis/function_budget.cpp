@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of the budget of the fixpoint computations on callees
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <ikos/analyzer/analysis/function_budget.hpp>
+#include <ikos/analyzer/database/table/downgrades.hpp>
+#include <ikos/analyzer/support/assert.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+const char* budget_kind_str(BudgetKind kind) {
+  switch (kind) {
+    case BudgetKind::Time:
+      return "time";
+    case BudgetKind::Iterations:
+      return "iterations";
+    case BudgetKind::InvariantSize:
+      return "invariant-size";
+    default: {
+      ikos_unreachable("unreachable");
+    }
+  }
+}
+
+void FunctionBudget::check_iteration(ar::Function* fun) {
+  this->_count++;
+  if (this->_iterations > 0 && this->_count > this->_iterations) {
+    throw FunctionBudgetExceeded(fun, BudgetKind::Iterations);
+  }
+  if (this->_time.count() > 0 && Clock::now() - this->_start > this->_time) {
+    throw FunctionBudgetExceeded(fun, BudgetKind::Time);
+  }
+}
+
+void FunctionBudget::check_invariant_size(ar::Function* fun,
+                                          std::size_t size) const {
+  if (this->_invariant_size > 0 && size > this->_invariant_size) {
+    throw FunctionBudgetExceeded(fun, BudgetKind::InvariantSize);
+  }
+}
+
+const char* FunctionBudgetExceeded::what() const noexcept {
+  return "function budget exceeded";
+}
+
+void BudgetDowngrades::record(ar::Function* fun,
+                              CallContext* call_context,
+                              BudgetKind kind) {
+  std::lock_guard< std::mutex > lock(this->_mutex);
+  this->_downgrades.try_emplace({fun, call_context}, kind);
+}
+
+bool BudgetDowngrades::contains(ar::Function* fun,
+                                CallContext* call_context) const {
+  std::lock_guard< std::mutex > lock(this->_mutex);
+  return this->_downgrades.count({fun, call_context}) != 0;
+}
+
+std::size_t BudgetDowngrades::size() const {
+  std::lock_guard< std::mutex > lock(this->_mutex);
+  return this->_downgrades.size();
+}
+
+void BudgetDowngrades::save(DowngradesTable& table,
+                            const std::string& domain) const {
+  std::lock_guard< std::mutex > lock(this->_mutex);
+  for (const auto& entry : this->_downgrades) {
+    table.insert(entry.first.first, entry.first.second, entry.second, domain);
+  }
+}
+
+} // end namespace analyzer
+} // end namespace ikos
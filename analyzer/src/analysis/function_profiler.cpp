@@ -0,0 +1,92 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of the function profiler
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <algorithm>
+
+#include <ikos/analyzer/analysis/function_profiler.hpp>
+#include <ikos/analyzer/database/table/profile.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+void FunctionProfile::merge(const FunctionProfile& other) {
+  this->runs += other.runs;
+  this->inclusive_time += other.inclusive_time;
+  this->exclusive_time += other.exclusive_time;
+  this->iterations += other.iterations;
+  this->widenings += other.widenings;
+  this->narrowings += other.narrowings;
+  this->gmp_allocations += other.gmp_allocations;
+  for (ar::BasicBlock* head : other.narrowing_capped_loops) {
+    if (std::find(this->narrowing_capped_loops.begin(),
+                  this->narrowing_capped_loops.end(),
+                  head) == this->narrowing_capped_loops.end()) {
+      this->narrowing_capped_loops.push_back(head);
+    }
+  }
+  this->peak_invariant_size =
+      std::max(this->peak_invariant_size, other.peak_invariant_size);
+  if (other.peak_invariant_bytes > this->peak_invariant_bytes) {
+    this->peak_invariant_bytes = other.peak_invariant_bytes;
+    this->peak_integer_bytes = other.peak_integer_bytes;
+    this->peak_pointer_bytes = other.peak_pointer_bytes;
+  }
+}
+
+void FunctionProfiler::record(ar::Function* fun,
+                              CallContext* call_context,
+                              const FunctionProfile& profile) {
+  std::lock_guard< std::mutex > lock(this->_mutex);
+  this->_profiles[{fun, call_context}].merge(profile);
+}
+
+void FunctionProfiler::save(ProfileTable& table,
+                            const std::string& domain) const {
+  for (const auto& entry : this->_profiles) {
+    table.insert(entry.first.first, entry.first.second, entry.second, domain);
+  }
+}
+
+} // end namespace analyzer
+} // end namespace ikos
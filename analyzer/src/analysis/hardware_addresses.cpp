@@ -41,6 +41,7 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
 #include <fstream>
 #include <regex>
 #include <sstream>
@@ -59,6 +60,30 @@ const std::regex RangeRegex(
     "^[\\s]*((?:0x)?[0-9a-f]+)[\\s]*-[\\s]*((?:0x)?[0-9a-f]+)[\\s]*$",
     std::regex_constants::icase);
 
+/// \brief Magic bytes at the beginning of a binary file
+const char BinaryMagic[] = {'I', 'K', 'O', 'S', 'H', 'W', 'A', '1'};
+
+/// \brief Size of a range in a binary file
+constexpr std::size_t BinaryRangeSize = 16;
+
+static Interval make_range(uint64_t lbound,
+                           uint64_t ubound,
+                           StringRef buffer,
+                           unsigned n_line,
+                           unsigned ptr_bit_width) {
+  if (lbound > ubound ||
+      (ptr_bit_width < 64 && (ubound >> ptr_bit_width) != 0)) {
+    throw HardwareAddressesException(buffer,
+                                     HardwareAddressesException::
+                                         HardwareAddressesExceptionKind::
+                                             InvalidRangeKind,
+                                     n_line);
+  }
+
+  return Interval(core::MachineInt(lbound, ptr_bit_width, core::Unsigned),
+                  core::MachineInt(ubound, ptr_bit_width, core::Unsigned));
+}
+
 static Interval parse_range(StringRef buffer,
                             unsigned n_line,
                             unsigned ptr_bit_width) {
@@ -71,7 +96,7 @@ static Interval parse_range(StringRef buffer,
                                              InvalidFormatKind,
                                      n_line);
   }
-  std::string lbound_str = rmatch.str(0);
+  std::string lbound_str = rmatch.str(1);
   std::string ubound_str = rmatch.str(2);
   try {
     lbound = std::stoull(lbound_str, nullptr, 0);
@@ -90,16 +115,16 @@ static Interval parse_range(StringRef buffer,
                                      n_line);
   }
 
-  if (lbound > ubound) {
-    throw HardwareAddressesException(buffer,
-                                     HardwareAddressesException::
-                                         HardwareAddressesExceptionKind::
-                                             InvalidRangeKind,
-                                     n_line);
-  }
+  return make_range(lbound, ubound, buffer, n_line, ptr_bit_width);
+}
 
-  return Interval(core::MachineInt(lbound, ptr_bit_width, core::Unsigned),
-                  core::MachineInt(ubound, ptr_bit_width, core::Unsigned));
+/// \brief Decode a 64-bit little-endian unsigned integer
+static uint64_t decode_uint64(const unsigned char* bytes) {
+  uint64_t value = 0;
+  for (std::size_t i = 0; i < 8; i++) {
+    value |= static_cast< uint64_t >(bytes[i]) << (8 * i);
+  }
+  return value;
 }
 
 } // end anonymous namespace
@@ -111,8 +136,10 @@ HardwareAddresses::HardwareAddresses(
     : _data_layout(bundle->data_layout()) {
   if (!hardware_addresses.empty()) {
     for (const auto& range : hardware_addresses) {
-      this->add_range(range);
+      this->add_range(
+          parse_range(range, 0, this->_data_layout.pointers.bit_width));
     }
+    this->sort_ranges();
   }
   if (!hardware_addresses_file.empty()) {
     this->add_range_from_file(hardware_addresses_file.getValue());
@@ -122,38 +149,83 @@ HardwareAddresses::HardwareAddresses(
 void HardwareAddresses::add_range(StringRef range_str) {
   this->add_range(
       parse_range(range_str, 0, this->_data_layout.pointers.bit_width));
+  this->sort_ranges();
 }
 
 void HardwareAddresses::add_range_from_file(const std::string& filepath) {
-  std::ifstream stream(filepath);
+  std::ifstream stream(filepath, std::ios::binary);
   if (!stream.is_open()) {
     throw HardwareAddressesException(StringRef(),
                                      HardwareAddressesException::
                                          HardwareAddressesExceptionKind::
                                              CannotOpenFileKind);
   }
-  // parse each line
-  char buffer[32];
+
+  std::size_t n_ranges = this->_address_ranges.size();
+
+  char magic[sizeof(BinaryMagic)];
+  if (stream.read(magic, sizeof(magic)) &&
+      std::equal(magic, magic + sizeof(magic), BinaryMagic)) {
+    this->add_ranges_from_binary(stream);
+  } else {
+    stream.clear();
+    stream.seekg(0);
+    this->add_ranges_from_text(stream);
+  }
+
+  if (this->_address_ranges.size() == n_ranges) {
+    throw HardwareAddressesException(StringRef(),
+                                     HardwareAddressesException::
+                                         HardwareAddressesExceptionKind::
+                                             EmptyFileKind);
+  }
+
+  this->sort_ranges();
+}
+
+void HardwareAddresses::add_ranges_from_text(std::istream& stream) {
+  // parse each line, with one or more ranges separated by commas
+  std::string line;
   unsigned n_line = 0;
-  for (; stream.getline(buffer, 32);) {
+  while (std::getline(stream, line)) {
     n_line++;
-    std::cmatch rmatch;
-    if (std::regex_match(buffer, rmatch, RangeRegex)) {
+    if (!line.empty() && line.back() == '\r') {
+      line.pop_back();
+    }
+
+    std::size_t first = line.find_first_not_of(" \t");
+    if (first == std::string::npos || line[first] == '#') {
+      continue;
+    }
+
+    std::size_t begin = 0;
+    while (true) {
+      std::size_t end = line.find(',', begin);
+      std::string range = line.substr(begin, end - begin);
       this->add_range(
-          parse_range(buffer, n_line, this->_data_layout.pointers.bit_width));
-    } else {
-      throw HardwareAddressesException(buffer,
-                                       HardwareAddressesException::
-                                           HardwareAddressesExceptionKind::
-                                               InvalidFormatKind,
-                                       n_line);
+          parse_range(range, n_line, this->_data_layout.pointers.bit_width));
+      if (end == std::string::npos) {
+        break;
+      }
+      begin = end + 1;
     }
   }
-  if (n_line == 0) {
+}
+
+void HardwareAddresses::add_ranges_from_binary(std::istream& stream) {
+  unsigned char buffer[BinaryRangeSize];
+  while (stream.read(reinterpret_cast< char* >(buffer), BinaryRangeSize)) {
+    this->add_range(make_range(decode_uint64(buffer),
+                               decode_uint64(buffer + 8),
+                               StringRef(),
+                               0,
+                               this->_data_layout.pointers.bit_width));
+  }
+  if (stream.gcount() != 0) {
     throw HardwareAddressesException(StringRef(),
                                      HardwareAddressesException::
                                          HardwareAddressesExceptionKind::
-                                             EmptyFileKind);
+                                             TruncatedFileKind);
   }
 }
 
@@ -161,22 +233,74 @@ void HardwareAddresses::add_range(Interval range) {
   this->_address_ranges.push_back(std::move(range));
 }
 
-bool HardwareAddresses::geq(const Interval& other) const {
-  for (const auto& it : this->ranges()) {
-    if (other.leq(it)) {
-      return true;
+void HardwareAddresses::sort_ranges() {
+  std::vector< Interval >& ranges = this->_address_ranges;
+
+  std::sort(ranges.begin(),
+            ranges.end(),
+            [](const Interval& a, const Interval& b) {
+              return a.lb() < b.lb();
+            });
+
+  // Merge overlapping and adjacent ranges
+  core::MachineInt one(1,
+                       this->_data_layout.pointers.bit_width,
+                       core::Unsigned);
+  auto last = ranges.begin();
+  for (auto it = ranges.begin(), et = ranges.end(); it != et; ++it) {
+    if (it == last) {
+      continue;
+    } else if (it->lb() <= last->ub() ||
+               (!last->ub().is_max() && it->lb() == last->ub() + one)) {
+      if (last->ub() < it->ub()) {
+        *last = Interval(last->lb(), it->ub());
+      }
+    } else {
+      ++last;
+      *last = *it;
     }
   }
-  return false;
+  if (!ranges.empty()) {
+    ranges.erase(std::next(last), ranges.end());
+  }
+}
+
+bool HardwareAddresses::geq(const Interval& other) const {
+  if (other.is_bottom()) {
+    return !this->_address_ranges.empty();
+  }
+
+  // Last range starting before `other`
+  auto it = std::upper_bound(this->_address_ranges.begin(),
+                             this->_address_ranges.end(),
+                             other.lb(),
+                             [](const core::MachineInt& n, const Interval& r) {
+                               return n < r.lb();
+                             });
+  if (it == this->_address_ranges.begin()) {
+    return false;
+  }
+  --it;
+  return other.ub() <= it->ub();
 }
 
 bool HardwareAddresses::is_meet_bottom(const Interval& other) const {
-  for (const auto& it : this->ranges()) {
-    if (!it.meet(other).is_bottom()) {
-      return false;
-    }
+  if (other.is_bottom()) {
+    return true;
+  }
+
+  // Last range starting before the end of `other`
+  auto it = std::upper_bound(this->_address_ranges.begin(),
+                             this->_address_ranges.end(),
+                             other.ub(),
+                             [](const core::MachineInt& n, const Interval& r) {
+                               return n < r.lb();
+                             });
+  if (it == this->_address_ranges.begin()) {
+    return true;
   }
-  return true;
+  --it;
+  return it->ub() < other.lb();
 }
 
 void HardwareAddresses::dump(std::ostream& o) const {
@@ -226,6 +350,9 @@ void HardwareAddressesException::create_errstr(StringRef pattern) {
     case EmptyFileKind: {
       ss << "File is empty";
     } break;
+    case TruncatedFileKind: {
+      ss << "Truncated hardware addresses file";
+    } break;
   }
 
   if (this->_n_line != 0) {
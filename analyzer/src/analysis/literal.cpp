@@ -46,13 +46,22 @@
 #include <ikos/ar/semantic/value_visitor.hpp>
 
 #include <ikos/analyzer/analysis/literal.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
 
 namespace ikos {
 namespace analyzer {
 
 LiteralFactory::LiteralFactory(VariableFactory& vfac,
                                const ar::DataLayout& data_layout)
-    : _vfac(vfac), _data_layout(data_layout) {}
+    : _vfac(vfac),
+      _data_layout(data_layout),
+      _index_table_size(FrontendInfo::get().num_values()) {
+  this->_index_table.reset(
+      new std::atomic< const Literal* >[this->_index_table_size]);
+  for (std::uint32_t i = 0; i < this->_index_table_size; i++) {
+    this->_index_table[i].store(nullptr, std::memory_order_relaxed);
+  }
+}
 
 LiteralFactory::~LiteralFactory() = default;
 
@@ -77,10 +86,26 @@ const AggregateLit& LiteralFactory::get_aggregate(ar::Value* value) {
 }
 
 const Literal& LiteralFactory::get(ar::Value* value) {
-  auto it = this->_map.find(value);
-  if (it == this->_map.end()) {
+  if (value->has_index() && value->index() < this->_index_table_size) {
+    std::atomic< const Literal* >& entry = this->_index_table[value->index()];
+    const Literal* lit = entry.load(std::memory_order_acquire);
+    if (lit == nullptr) {
+      lit = &this->get_or_create(value);
+      entry.store(lit, std::memory_order_release);
+    }
+    return *lit;
+  }
+
+  return this->get_or_create(value);
+}
+
+const Literal& LiteralFactory::get_or_create(ar::Value* value) {
+  auto& shard = this->_map.shard(value);
+  ConcurrentLockGuard lock(shard.mutex);
+  auto it = shard.map.find(value);
+  if (it == shard.map.end()) {
     std::pair< Map::iterator, bool > res =
-        this->_map.emplace(value, this->create_literal(value));
+        shard.map.emplace(value, this->create_literal(value));
     return (res.first)->second;
   } else {
     return it->second;
@@ -43,8 +43,10 @@
  *
  ******************************************************************************/
 
-#include <ikos/core/domain/discrete_domain.hpp>
-#include <ikos/core/fixpoint/fwd_fixpoint_iterator.hpp>
+#include <limits>
+
+#include <llvm/ADT/BitVector.h>
+#include <llvm/ADT/DenseSet.h>
 
 #include <ikos/ar/semantic/code.hpp>
 
@@ -56,309 +58,265 @@ namespace ikos {
 namespace analyzer {
 namespace {
 
-/// \brief Lattice of liveness
-///
-/// This is a small wrapper around core::DiscreteDomain, with a few changes:
-///   * The default constructor returns bottom
-///   * Has convenient operator+ and operator-
-template < typename VariableRef >
-class LivenessDomain final
-    : public core::AbstractDomain< LivenessDomain< VariableRef > > {
-private:
-  using DiscreteDomain = core::DiscreteDomain< VariableRef >;
-
-public:
-  using Iterator = typename DiscreteDomain::Iterator;
-
-private:
-  DiscreteDomain _inv;
-
-private:
-  /// \brief Private constructor
-  explicit LivenessDomain(DiscreteDomain inv) : _inv(std::move(inv)) {}
-
-public:
-  /// \brief Create the empty liveness domain
-  LivenessDomain() : _inv(DiscreteDomain::bottom()) {}
-
-  /// \brief Create the liveness domain with the given elements
-  LivenessDomain(std::initializer_list< VariableRef > elements)
-      : _inv(elements) {}
-
-  /// \brief Copy constructor
-  LivenessDomain(const LivenessDomain&) = default;
-
-  /// \brief Move constructor
-  LivenessDomain(LivenessDomain&&) = default;
-
-  /// \brief Copy assignment operator
-  LivenessDomain& operator=(const LivenessDomain&) = default;
-
-  /// \brief Move assignment operator
-  LivenessDomain& operator=(LivenessDomain&&) = default;
-
-  /// \brief Destructor
-  ~LivenessDomain() override = default;
-
-  /// \brief Create the top liveness domain
-  static LivenessDomain top() { return LivenessDomain(DiscreteDomain::top()); }
-
-  /// \brief Create the bottom liveness domain
-  static LivenessDomain bottom() {
-    return LivenessDomain(DiscreteDomain::bottom());
-  }
-
-  /// \brief Return the number of elements in the liveness domain
-  std::size_t size() const { return this->_inv.size(); }
-
-  /// \brief Begin iterator over the elements
-  Iterator begin() const { return this->_inv.begin(); }
-
-  /// \brief End iterator over the elements
-  Iterator end() const { return this->_inv.end(); }
-
-  bool is_bottom() const override { return this->_inv.is_bottom(); }
-
-  bool is_top() const override { return this->_inv.is_top(); }
-
-  void set_to_bottom() override { this->_inv.set_to_bottom(); }
-
-  void set_to_top() override { this->_inv.set_to_top(); }
-
-  bool leq(const LivenessDomain& other) const override {
-    return this->_inv.leq(other._inv);
-  }
-
-  bool equals(const LivenessDomain& other) const override {
-    return this->_inv.equals(other._inv);
-  }
-
-  void join_with(const LivenessDomain& other) override {
-    this->_inv.join_with(other._inv);
-  }
-
-  void widen_with(const LivenessDomain& other) override {
-    this->_inv.widen_with(other._inv);
-  }
-
-  void meet_with(const LivenessDomain& other) override {
-    this->_inv.meet_with(other._inv);
-  }
-
-  void narrow_with(const LivenessDomain& other) override {
-    this->_inv.narrow_with(other._inv);
-  }
-
-  void operator-=(const LivenessDomain& other) {
-    this->_inv.difference_with(other._inv);
-  }
-
-  void operator-=(VariableRef v) { this->_inv.remove(v); }
-
-  void operator+=(const LivenessDomain& other) {
-    this->_inv.join_with(other._inv);
-  }
-
-  void operator+=(VariableRef v) { this->_inv.add(v); }
+/// \brief Position of the basic blocks not reaching the exit
+constexpr unsigned Unreached = std::numeric_limits< unsigned >::max();
 
-  void dump(std::ostream& o) const override { this->_inv.dump(o); }
-
-  static std::string name() { return "liveness domain"; }
-
-}; // end class LivenessDomain
-
-/// \brief Inverse an ar::Code* graph
+/// \brief Liveness solver for a ar::Code
 ///
-/// The entry node is the exit node, and successors and predecessors are swapped
-struct ReverseCodeGraphTrait {
-  using NodeRef = ar::BasicBlock*;
-  using SuccessorNodeIterator = ar::BasicBlock::BasicBlockIterator;
-  using PredecessorNodeIterator = ar::BasicBlock::BasicBlockIterator;
-
-  static ar::BasicBlock* entry(ar::Code* code) {
-    ikos_assert_msg(code->has_exit_block(), "code graph cannot be inversed");
-    return code->exit_block();
-  }
-
-  static SuccessorNodeIterator successor_begin(ar::BasicBlock* bb) {
-    return bb->predecessor_begin();
-  }
+/// This is a backward dataflow analysis on bit-vectors.
+///
+/// Only the variables with an upward-exposed use (i.e, used in a basic block
+/// before any definition in that block) can be live at a block boundary. These
+/// are numbered densely and are the only ones in the bit-vectors, thus the
+/// temporaries local to a basic block, usually the vast majority, cost nothing
+/// in the fixpoint. On a single basic block, no variable needs to be tracked.
+///
+/// As in a fixpoint on the reversed graph, only the basic blocks that can
+/// reach the exit block get results.
+///
+/// The edges are read from the frozen control flow graph of the code.
+class LivenessSolver {
+private:
+  /// \brief Information about a basic block
+  struct BlockInfo {
+    /// \brief Basic block
+    ar::BasicBlock* bb = nullptr;
 
-  static SuccessorNodeIterator successor_end(ar::BasicBlock* bb) {
-    return bb->predecessor_end();
-  }
+    /// \brief All variables defined or used in the block
+    std::vector< Variable* > all;
 
-  static PredecessorNodeIterator predecessor_begin(ar::BasicBlock* bb) {
-    return bb->successor_begin();
-  }
+    /// \brief Upward-exposed uses
+    llvm::BitVector gen;
 
-  static PredecessorNodeIterator predecessor_end(ar::BasicBlock* bb) {
-    return bb->successor_end();
-  }
+    /// \brief Definitions
+    llvm::BitVector kill;
 
-}; // end struct ReverseCodeGraphTrait
+    /// \brief Live variables at the entry of the block
+    llvm::BitVector live_in;
 
-/// \brief Liveness fixpoint iterator
-class LivenessFixpointIterator final
-    : public core::InterleavedFwdFixpointIterator< ar::Code*,
-                                                   LivenessDomain< Variable* >,
-                                                   ReverseCodeGraphTrait > {
-private:
-  /// \brief Parent class
-  using FwdFixpointIterator =
-      core::InterleavedFwdFixpointIterator< ar::Code*,
-                                            LivenessDomain< Variable* >,
-                                            ReverseCodeGraphTrait >;
-
-  /// \brief Liveness abstract domain
-  using LivenessDomainT = LivenessDomain< Variable* >;
-
-  /// \brief A pair (kill, gen)
-  struct KillGen {
-    LivenessDomainT kill;
-    LivenessDomainT gen;
+    /// \brief Live variables at the end of the block
+    llvm::BitVector live_out;
   };
 
-  /// \brief Map from basic block to a (kill, gen) pair
-  using KillGenMap = llvm::DenseMap< ar::BasicBlock*, KillGen >;
-
-  /// \brief Map from basic block to liveness domain
-  using LivenessMap = llvm::DenseMap< ar::BasicBlock*, LivenessDomainT >;
+private:
+  /// \brief Analyzed code
+  ar::Code* _code;
 
-public:
-  /// \brief Iterator on a map from basic block to liveness domain
-  using LivenessMapIterator = LivenessMap::const_iterator;
+  /// \brief Frozen control flow graph of the code
+  const ar::CodeGraph* _graph;
 
-private:
   /// \brief Variable factory
   VariableFactory& _vfac;
 
-  /// \brief Store (kill, gen) sets for each basic block
-  KillGenMap _kg_map;
+  /// \brief Basic blocks reaching the exit, in reverse post-order of the
+  /// reversed graph
+  std::vector< BlockInfo > _blocks;
 
-  /// \brief Set of all variables (defined and used) for each basic blocks
-  LivenessMap _all_vars_map;
+  /// \brief Position in `_blocks` of each basic block, by index
+  std::vector< unsigned > _block_index;
 
-  /// \brief Set of live variables at the **entry** of a basic block
-  LivenessMap _live_at_entry_map;
+  /// \brief Map from tracked variable to its number
+  llvm::DenseMap< Variable*, unsigned > _var_index;
 
-  /// \brief Set of dead variables at the **end** of a basic block
-  LivenessMap _dead_at_end_map;
+  /// \brief Tracked variables, by number
+  std::vector< Variable* > _vars;
 
 public:
-  LivenessFixpointIterator(ar::Code* code, VariableFactory& vfac)
-      : FwdFixpointIterator(code), _vfac(vfac) {
+  /// \brief Constructor
+  LivenessSolver(ar::Code* code, VariableFactory& vfac)
+      : _code(code), _graph(code->graph()), _vfac(vfac) {}
+
+  /// \brief Compute the live variables
+  void run() {
+    this->order_blocks();
     this->init();
+    this->solve();
+  }
+
+  /// \brief Return the list of live variables at the entry of each block
+  template < typename Callback >
+  void live_at_entry(Callback f) const {
+    for (const BlockInfo& info : this->_blocks) {
+      LivenessAnalysis::VariableRefList list;
+      list.reserve(info.live_in.count());
+      for (int i = info.live_in.find_first(); i != -1;
+           i = info.live_in.find_next(i)) {
+        list.push_back(this->_vars[i]);
+      }
+      f(info.bb, std::move(list));
+    }
   }
 
-  LivenessMapIterator live_at_entry_begin() const {
-    return this->_live_at_entry_map.begin();
+  /// \brief Return the list of dead variables at the end of each block
+  template < typename Callback >
+  void dead_at_end(Callback f) const {
+    for (const BlockInfo& info : this->_blocks) {
+      LivenessAnalysis::VariableRefList list;
+      list.reserve(info.all.size());
+      for (Variable* var : info.all) {
+        auto it = this->_var_index.find(var);
+        if (it == this->_var_index.end() || !info.live_out.test(it->second)) {
+          list.push_back(var);
+        }
+      }
+      f(info.bb, std::move(list));
+    }
   }
 
-  LivenessMapIterator live_at_entry_end() const {
-    return this->_live_at_entry_map.end();
-  }
+private:
+  /// \brief Collect the basic blocks reaching the exit block, in reverse
+  /// post-order of the reversed graph
+  void order_blocks() {
+    using PredecessorIterator = ar::CodeGraph::BasicBlockIterator;
+
+    // Iterative depth-first search from the exit block, on predecessors
+    std::vector< ar::BasicBlock* > post_order;
+    std::vector< bool > visited(this->_graph->num_indices(), false);
+    std::vector< std::pair< ar::BasicBlock*, PredecessorIterator > > stack;
+
+    ar::BasicBlock* exit = this->_code->exit_block();
+    visited[exit->index()] = true;
+    stack.emplace_back(exit, this->_graph->predecessor_begin(exit));
+    while (!stack.empty()) {
+      ar::BasicBlock* bb = stack.back().first;
+      PredecessorIterator& it = stack.back().second;
+      if (it != this->_graph->predecessor_end(bb)) {
+        ar::BasicBlock* pred = *it;
+        ++it;
+        if (!visited[pred->index()]) {
+          visited[pred->index()] = true;
+          stack.emplace_back(pred, this->_graph->predecessor_begin(pred));
+        }
+      } else {
+        post_order.push_back(bb);
+        stack.pop_back();
+      }
+    }
 
-  LivenessMapIterator dead_at_end_begin() const {
-    return this->_dead_at_end_map.begin();
+    this->_blocks.resize(post_order.size());
+    this->_block_index.assign(this->_graph->num_indices(), Unreached);
+    for (std::size_t i = 0; i < post_order.size(); i++) {
+      ar::BasicBlock* bb = post_order[post_order.size() - 1 - i];
+      this->_blocks[i].bb = bb;
+      this->_block_index[bb->index()] = static_cast< unsigned >(i);
+    }
   }
 
-  LivenessMapIterator dead_at_end_end() const {
-    return this->_dead_at_end_map.end();
-  }
+  /// \brief Compute the gen and kill sets
+  void init() {
+    // Variables used or defined in each block, and upward-exposed uses
+    std::vector< std::vector< Variable* > > exposed(this->_blocks.size());
+    std::vector< std::vector< Variable* > > defined(this->_blocks.size());
+    llvm::DenseSet< Variable* > all;
+    llvm::DenseSet< Variable* > defs;
+
+    for (std::size_t i = 0; i < this->_blocks.size(); i++) {
+      BlockInfo& info = this->_blocks[i];
+      all.clear();
+      defs.clear();
+
+      for (ar::Statement* stmt : *info.bb) {
+        // Process uses
+        for (auto op_it = stmt->op_begin(), op_et = stmt->op_end();
+             op_it != op_et;
+             ++op_it) {
+          Variable* var = this->variable_ref(*op_it);
+          if (var != nullptr) {
+            if (all.insert(var).second) {
+              info.all.push_back(var);
+            }
+            if (defs.count(var) == 0) {
+              exposed[i].push_back(var);
+            }
+          }
+        }
 
-  /// \brief Compute the set of dead and live variables
-  void run() { FwdFixpointIterator::run(LivenessDomainT::bottom()); }
+        // Process defs
+        if (stmt->has_result()) {
+          Variable* var = this->variable_ref(stmt->result());
+          ikos_assert_msg(var != nullptr, "result is not a variable");
+
+          if (all.insert(var).second) {
+            info.all.push_back(var);
+          }
+          if (defs.insert(var).second) {
+            defined[i].push_back(var);
+          }
+        }
+      }
 
-  /// \brief Apply the kill-gen equation
-  ///
-  /// IN(B) = (OUT(B) \ kill (B)) U gen (B)
-  LivenessDomainT analyze_node(ar::BasicBlock* bb,
-                               LivenessDomainT post) override {
-    auto it = this->_kg_map.find(bb);
-    ikos_assert(it != this->_kg_map.end());
-
-    LivenessDomainT pre(post);
-    pre -= it->second.kill; // delete kill set
-    pre += it->second.gen;  // add gen set
-    return pre;
-  }
+      // Number the upward-exposed variables
+      for (Variable* var : exposed[i]) {
+        if (this->_var_index
+                .try_emplace(var, static_cast< unsigned >(this->_vars.size()))
+                .second) {
+          this->_vars.push_back(var);
+        }
+      }
+    }
 
-  LivenessDomainT analyze_edge(ar::BasicBlock*,
-                               ar::BasicBlock*,
-                               LivenessDomainT pre) override {
-    return pre;
+    // Build the bit-vectors on the tracked variables only
+    auto num_vars = static_cast< unsigned >(this->_vars.size());
+    for (std::size_t i = 0; i < this->_blocks.size(); i++) {
+      BlockInfo& info = this->_blocks[i];
+      info.gen.resize(num_vars);
+      info.kill.resize(num_vars);
+      info.live_in.resize(num_vars);
+      info.live_out.resize(num_vars);
+
+      for (Variable* var : exposed[i]) {
+        info.gen.set(this->_var_index[var]);
+      }
+      for (Variable* var : defined[i]) {
+        auto it = this->_var_index.find(var);
+        if (it != this->_var_index.end()) {
+          info.kill.set(it->second);
+        }
+      }
+    }
   }
 
-  /// \brief Store the set of dead variables at the exit of `bb`
+  /// \brief Solve the dataflow equations
   ///
-  /// Note: this is the post invariant, because we reversed the graph
-  void process_pre(ar::BasicBlock* bb,
-                   const LivenessDomainT& post_live) override {
-    ikos_assert(!post_live.is_top());
-
-    auto it = this->_all_vars_map.find(bb);
-    ikos_assert(it != this->_all_vars_map.end());
-    LivenessDomainT all = it->second;
-
-    // dead = all - live
-    LivenessDomainT dead(all);
-    dead -= post_live;
-
-    this->_dead_at_end_map.try_emplace(bb, dead);
-  }
-
-  /// \brief Store the set of live variables at the entry of `bb`
+  /// OUT(B) = U IN(S) for S successor of B
+  /// IN(B) = (OUT(B) \ kill(B)) U gen(B)
   ///
-  /// Note: this is the pre invariant, because we reversed the graph
-  void process_post(ar::BasicBlock* bb,
-                    const LivenessDomainT& pre_live) override {
-    ikos_assert(!pre_live.is_top());
-
-    this->_live_at_entry_map.try_emplace(bb, pre_live);
-  }
-
-private:
-  /// \brief Compute kill/gen sets for each basic blocks
-  void init() {
-    ar::Code* code = this->cfg();
-
-    for (auto it = code->begin(), et = code->end(); it != et; ++it) {
-      this->init(*it);
-    }
-  }
-
-  /// \brief Compute kill/gen sets for the given basic block
-  void init(ar::BasicBlock* bb) {
-    LivenessDomainT kill, gen, all;
-
-    for (auto it = bb->rbegin(), et = bb->rend(); it != et; ++it) {
-      ar::Statement* stmt = *it;
-
-      // Process defs
-      if (stmt->has_result()) {
-        Variable* var = this->variable_ref(stmt->result());
-        ikos_assert_msg(var != nullptr, "result is not a variable");
+  /// The worklist always picks the first pending block in reverse post-order
+  /// of the reversed graph.
+  void solve() {
+    llvm::BitVector pending(static_cast< unsigned >(this->_blocks.size()),
+                            true);
+    llvm::BitVector live_in;
+
+    for (int i = pending.find_first(); i != -1; i = pending.find_first()) {
+      pending.reset(i);
+      BlockInfo& info = this->_blocks[i];
+
+      for (auto it = this->_graph->successor_begin(info.bb),
+                et = this->_graph->successor_end(info.bb);
+           it != et;
+           ++it) {
+        unsigned succ = this->_block_index[(*it)->index()];
+        if (succ != Unreached) {
+          info.live_out |= this->_blocks[succ].live_in;
+        }
+      }
 
-        kill += var;
-        gen -= var;
-        all += var;
+      live_in = info.live_out;
+      live_in.reset(info.kill);
+      live_in |= info.gen;
+      if (live_in == info.live_in) {
+        continue;
       }
 
-      // Process uses
-      for (auto op_it = stmt->op_begin(), op_et = stmt->op_end();
-           op_it != op_et;
-           ++op_it) {
-        Variable* var = this->variable_ref(*op_it);
-        if (var != nullptr) {
-          gen += var;
-          all += var;
-        }
+      info.live_in = live_in;
+      for (auto it = this->_graph->predecessor_begin(info.bb),
+                et = this->_graph->predecessor_end(info.bb);
+           it != et;
+           ++it) {
+        pending.set(this->_block_index[(*it)->index()]);
       }
     }
-
-    this->_kg_map.try_emplace(bb, KillGen{kill, gen});
-    this->_all_vars_map.try_emplace(bb, all);
   }
 
   /// \brief Get the Variable* of an ar::Value
@@ -378,7 +336,7 @@ private:
     }
   }
 
-}; // end class LivenessFixpointIterator
+}; // end class LivenessSolver
 
 } // end anonymous namespace
 
@@ -425,49 +383,31 @@ void LivenessAnalysis::run() {
        ++it) {
     ar::Function* fun = *it;
     if (fun->is_definition()) {
-      log::debug("Running liveness analysis on function @" + fun->name());
+      log::debug([fun] {
+        return "Running liveness analysis on function @" + fun->name();
+      });
       this->run(fun->body());
     }
   }
 }
 
-/// \brief Convert a LivenessDomain into a VariableRefList
-static LivenessAnalysis::VariableRefList to_variable_ref_list(
-    const LivenessDomain< Variable* >& value) {
-  LivenessAnalysis::VariableRefList list;
-
-  if (!value.is_bottom()) {
-    list.reserve(value.size());
-    std::copy(value.begin(), value.end(), std::back_inserter(list));
-  }
-
-  return list;
-}
-
 void LivenessAnalysis::run(ar::Code* code) {
   // If the code has no exit block, do nothing
   if (!code->has_exit_block()) {
     return;
   }
 
-  // Run the liveness fixpoint iterator
-  LivenessFixpointIterator fixpoint(code, *_ctx.var_factory);
-  fixpoint.run();
+  // Run the liveness solver
+  LivenessSolver solver(code, *_ctx.var_factory);
+  solver.run();
 
   // Store the results
-  for (auto it = fixpoint.live_at_entry_begin(),
-            et = fixpoint.live_at_entry_end();
-       it != et;
-       ++it) {
-    this->_live_at_entry_map.try_emplace(it->first,
-                                         to_variable_ref_list(it->second));
-  }
-  for (auto it = fixpoint.dead_at_end_begin(), et = fixpoint.dead_at_end_end();
-       it != et;
-       ++it) {
-    this->_dead_at_end_map.try_emplace(it->first,
-                                       to_variable_ref_list(it->second));
-  }
+  solver.live_at_entry([this](ar::BasicBlock* bb, VariableRefList list) {
+    this->_live_at_entry_map.try_emplace(bb, std::move(list));
+  });
+  solver.dead_at_end([this](ar::BasicBlock* bb, VariableRefList list) {
+    this->_dead_at_end_map.try_emplace(bb, std::move(list));
+  });
 }
 
 void LivenessAnalysis::dump(std::ostream& o) const {
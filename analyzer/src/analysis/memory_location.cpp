@@ -155,47 +155,54 @@ void DynAllocMemoryLocation::dump(std::ostream& o) const {
 
 // MemoryFactory
 
-MemoryFactory::MemoryFactory()
-    : _absolute_zero_memory(std::make_unique< AbsoluteZeroMemoryLocation >()),
-      _argv_memory(std::make_unique< ArgvMemoryLocation >()) {}
+MemoryFactory::MemoryFactory(
+    CallContextFactory& call_context_factory,
+    boost::optional< unsigned > dyn_alloc_context_depth)
+    : _call_context_factory(call_context_factory),
+      _dyn_alloc_context_depth(dyn_alloc_context_depth),
+      _next_index(0) {
+  this->_absolute_zero_memory._index = this->_next_index++;
+  this->_argv_memory._index = this->_next_index++;
+}
 
 MemoryFactory::~MemoryFactory() = default;
 
-LocalMemoryLocation* MemoryFactory::get_local(ar::LocalVariable* var) {
-  auto it = this->_local_memory_map.find(var);
-  if (it == this->_local_memory_map.end()) {
-    auto ml = new LocalMemoryLocation(var);
-    this->_local_memory_map.try_emplace(var,
-                                        std::unique_ptr< LocalMemoryLocation >(
-                                            ml));
+template < typename Location,
+           typename ShardedTable,
+           typename Key,
+           typename... Args >
+Location* MemoryFactory::get_or_create(ShardedTable& table,
+                                       const Key& key,
+                                       Args&&... args) {
+  auto& shard = table.shard(key);
+  ConcurrentLockGuard lock(shard.mutex);
+  auto it = shard.map.map.find(key);
+  if (it == shard.map.map.end()) {
+    shard.map.arena.emplace_back(std::forward< Args >(args)...);
+    Location* ml = &shard.map.arena.back();
+    ml->_index = this->_next_index++;
+    shard.map.map.try_emplace(key, ml);
     return ml;
   } else {
-    return it->second.get();
+    return it->second;
   }
 }
 
+LocalMemoryLocation* MemoryFactory::get_local(ar::LocalVariable* var) {
+  return this->get_or_create< LocalMemoryLocation >(this->_local_memory_map,
+                                                    var,
+                                                    var);
+}
+
 GlobalMemoryLocation* MemoryFactory::get_global(ar::GlobalVariable* var) {
-  auto it = this->_global_memory_map.find(var);
-  if (it == this->_global_memory_map.end()) {
-    auto ml = new GlobalMemoryLocation(var);
-    this->_global_memory_map
-        .try_emplace(var, std::unique_ptr< GlobalMemoryLocation >(ml));
-    return ml;
-  } else {
-    return it->second.get();
-  }
+  return this->get_or_create< GlobalMemoryLocation >(this->_global_memory_map,
+                                                     var,
+                                                     var);
 }
 
 FunctionMemoryLocation* MemoryFactory::get_function(ar::Function* fun) {
-  auto it = this->_function_memory_map.find(fun);
-  if (it == this->_function_memory_map.end()) {
-    auto ml = new FunctionMemoryLocation(fun);
-    this->_function_memory_map
-        .try_emplace(fun, std::unique_ptr< FunctionMemoryLocation >(ml));
-    return ml;
-  } else {
-    return it->second.get();
-  }
+  return this->get_or_create<
+      FunctionMemoryLocation >(this->_function_memory_map, fun, fun);
 }
 
 FunctionMemoryLocation* MemoryFactory::get_function(
@@ -205,49 +212,43 @@ FunctionMemoryLocation* MemoryFactory::get_function(
 
 AggregateMemoryLocation* MemoryFactory::get_aggregate(
     ar::InternalVariable* var) {
-  auto it = this->_aggregate_memory_map.find(var);
-  if (it == this->_aggregate_memory_map.end()) {
-    auto ml = new AggregateMemoryLocation(var);
-    this->_aggregate_memory_map
-        .try_emplace(var, std::unique_ptr< AggregateMemoryLocation >(ml));
-    return ml;
-  } else {
-    return it->second.get();
-  }
+  return this->get_or_create<
+      AggregateMemoryLocation >(this->_aggregate_memory_map, var, var);
 }
 
 VaArgMemoryLocation* MemoryFactory::get_va_arg(llvm::StringRef sv) {
-  auto it = this->_va_arg_map.find(sv);
-  if (it == this->_va_arg_map.end()) {
-    auto ml = new VaArgMemoryLocation(sv);
-    this->_va_arg_map.try_emplace(sv,
-                                  std::unique_ptr< VaArgMemoryLocation >(ml));
-    return ml;
-  } else {
-    return it->second.get();
-  }
+  return this->get_or_create< VaArgMemoryLocation >(this->_va_arg_map,
+                                                    sv,
+                                                    sv.str());
 }
 
 AbsoluteZeroMemoryLocation* MemoryFactory::get_absolute_zero() {
-  return this->_absolute_zero_memory.get();
+  return &this->_absolute_zero_memory;
 }
 
 ArgvMemoryLocation* MemoryFactory::get_argv() {
-  return this->_argv_memory.get();
+  return &this->_argv_memory;
 }
 
 DynAllocMemoryLocation* MemoryFactory::get_dyn_alloc(ar::CallBase* call,
                                                      CallContext* context) {
-  auto it = this->_dyn_alloc_map.find({call, context});
-  if (it == this->_dyn_alloc_map.end()) {
-    auto ml = new DynAllocMemoryLocation(call, context);
-    this->_dyn_alloc_map.try_emplace({call, context},
-                                     std::unique_ptr< DynAllocMemoryLocation >(
-                                         ml));
-    return ml;
-  } else {
-    return it->second.get();
+  // Keep only the last call statements of the call context
+  if (this->_dyn_alloc_context_depth) {
+    unsigned depth = *this->_dyn_alloc_context_depth;
+    if (depth == 0) {
+      context = this->_call_context_factory.get_empty();
+    } else if (context->depth() > depth) {
+      context = this->_call_context_factory.get_context(context->parent(),
+                                                        context->call(),
+                                                        depth);
+    }
   }
+
+  return this->get_or_create<
+      DynAllocMemoryLocation >(this->_dyn_alloc_map,
+                               std::make_pair(call, context),
+                               call,
+                               context);
 }
 
 } // end namespace analyzer
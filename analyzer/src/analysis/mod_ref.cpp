@@ -0,0 +1,258 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Mod/ref analysis implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <ikos/ar/semantic/statement.hpp>
+#include <ikos/ar/semantic/value.hpp>
+
+#include <ikos/analyzer/analysis/literal.hpp>
+#include <ikos/analyzer/analysis/memory_location.hpp>
+#include <ikos/analyzer/analysis/mod_ref.hpp>
+#include <ikos/analyzer/analysis/pointer/pointer.hpp>
+#include <ikos/analyzer/analysis/wto.hpp>
+#include <ikos/analyzer/support/assert.hpp>
+#include <ikos/analyzer/support/cast.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+ModRefAnalysis::ModRefAnalysis(Context& ctx, const CallGraph& call_graph)
+    : _ctx(ctx), _call_graph(call_graph), _top(PointsToSet::top()) {}
+
+ModRefAnalysis::~ModRefAnalysis() = default;
+
+void ModRefAnalysis::run() {
+  const std::vector< ar::Function* >& functions =
+      this->_call_graph.bottom_up_order();
+
+  // The functions of a strongly connected component are consecutive in the
+  // bottom-up order, after their callees outside of the component
+  std::size_t begin = 0;
+  while (begin < functions.size()) {
+    std::size_t end = begin + 1;
+    while (end < functions.size() &&
+           this->_call_graph.same_scc(functions[begin], functions[end])) {
+      end++;
+    }
+
+    PointsToSet modified = PointsToSet::empty();
+    for (std::size_t i = begin; i < end && !modified.is_top(); i++) {
+      ar::Function* fun = functions[i];
+      modified.join_with(this->local_modified(fun));
+      for (ar::Function* callee : this->_call_graph.callees(fun)) {
+        if (!this->_call_graph.same_scc(fun, callee)) {
+          modified.join_with(this->modified(callee));
+        }
+      }
+    }
+
+    for (std::size_t i = begin; i < end; i++) {
+      this->_modified.try_emplace(functions[i], modified);
+    }
+
+    // Recursive functions are never context-independent
+    if (!this->_call_graph.is_recursive(functions[begin]) &&
+        this->local_context_independent(functions[begin])) {
+      this->_context_independent.insert(functions[begin]);
+    }
+    begin = end;
+  }
+}
+
+const PointsToSet& ModRefAnalysis::modified(ar::Function* fun) const {
+  auto it = this->_modified.find(fun);
+  if (it == this->_modified.end()) {
+    return this->_top;
+  }
+  return it->second;
+}
+
+PointsToSet ModRefAnalysis::local_modified(ar::Function* fun) const {
+  PointsToSet modified = PointsToSet::empty();
+
+  for (ar::BasicBlock* bb : *fun->body()) {
+    for (ar::Statement* stmt : *bb) {
+      if (auto store = dyn_cast< ar::Store >(stmt)) {
+        modified.join_with(this->points_to(store->pointer()));
+      } else if (auto call = dyn_cast< ar::CallBase >(stmt)) {
+        auto cst = dyn_cast< ar::FunctionPointerConstant >(call->called());
+        if (cst != nullptr && cst->function()->is_definition()) {
+          continue; // See run()
+        }
+
+        // Extern functions, intrinsics and inline assembly only write through
+        // their pointer parameters. An indirect call can also target them.
+        for (auto it = call->arg_begin(), et = call->arg_end(); it != et;
+             ++it) {
+          if ((*it)->type()->is_pointer()) {
+            modified.join_with(this->points_to(*it));
+          }
+        }
+      }
+
+      if (modified.is_top()) {
+        return modified;
+      }
+    }
+  }
+
+  return modified;
+}
+
+bool ModRefAnalysis::local_context_independent(ar::Function* fun) const {
+  ar::Type* return_type = fun->type()->return_type();
+  if (!return_type->is_void() && !return_type->is_integer() &&
+      !return_type->is_float()) {
+    return false;
+  }
+
+  // A function with cycles can exceed its fixpoint budgets (e.g,
+  // -function-iteration-budget), and no summary is kept in that case. It
+  // would then be analyzed again at each call, instead of being downgraded
+  // once per call context.
+  if (!this->_ctx.wto_cache->wto(fun->body()).acyclic()) {
+    return false;
+  }
+
+  llvm::DenseSet< ar::Value* > params(fun->param_begin(), fun->param_end());
+
+  // Return true if the given value does not depend on the calling context
+  auto is_local = [fun, &params](ar::Value* value) {
+    if (params.count(value) != 0 || isa< ar::GlobalVariable >(value)) {
+      return false;
+    } else if (auto lv = dyn_cast< ar::LocalVariable >(value)) {
+      return lv->function() == fun;
+    } else {
+      return !value->type()->is_aggregate();
+    }
+  };
+
+  for (ar::BasicBlock* bb : *fun->body()) {
+    for (ar::Statement* stmt : *bb) {
+      if (stmt->has_result() && stmt->result()->type()->is_aggregate()) {
+        return false;
+      }
+
+      switch (stmt->kind()) {
+        case ar::Statement::AssignmentKind:
+        case ar::Statement::UnaryOperationKind:
+        case ar::Statement::BinaryOperationKind:
+        case ar::Statement::ComparisonKind:
+        case ar::Statement::ReturnValueKind:
+        case ar::Statement::UnreachableKind: {
+        } break;
+        case ar::Statement::LoadKind: {
+          if (!isa< ar::LocalVariable >(cast< ar::Load >(stmt)->operand())) {
+            return false;
+          }
+        } break;
+        case ar::Statement::StoreKind: {
+          if (!isa< ar::LocalVariable >(cast< ar::Store >(stmt)->pointer())) {
+            return false;
+          }
+        } break;
+        case ar::Statement::CallKind: {
+          auto call = cast< ar::Call >(stmt);
+          auto cst = dyn_cast< ar::FunctionPointerConstant >(call->called());
+          if (cst == nullptr ||
+              this->_context_independent.count(cst->function()) == 0) {
+            return false;
+          }
+          // The arguments are not used by the callee
+          continue;
+        }
+        default: {
+          return false;
+        }
+      }
+
+      for (std::size_t i = 0; i < stmt->num_operands(); i++) {
+        if (!is_local(stmt->operand(i))) {
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+PointsToSet ModRefAnalysis::points_to(ar::Value* ptr) const {
+  if (auto gv = dyn_cast< ar::GlobalVariable >(ptr)) {
+    return PointsToSet{this->_ctx.mem_factory->get_global(gv)};
+  } else if (auto lv = dyn_cast< ar::LocalVariable >(ptr)) {
+    return PointsToSet{this->_ctx.mem_factory->get_local(lv)};
+  }
+
+  const ScalarLit& lit = this->_ctx.lit_factory->get_scalar(ptr);
+  if (lit.is_null() || lit.is_undefined()) {
+    // Error, nothing is written
+    return PointsToSet::empty();
+  } else if (!lit.is_pointer_var() || this->_ctx.pointer == nullptr) {
+    return PointsToSet::top();
+  }
+
+  PointsToSet points_to =
+      this->_ctx.pointer->results().get(lit.var()).points_to();
+
+  if (points_to.is_bottom() || points_to.is_empty()) {
+    // Pointer analysis and value analysis can be inconsistent
+    return PointsToSet::top();
+  } else if (points_to.is_top()) {
+    return points_to;
+  }
+
+  if (this->_ctx.opts.procedural == Procedural::Interprocedural) {
+    // The interprocedural analysis creates a memory location per allocation
+    // site and call context, the pointer analysis only per allocation site
+    for (MemoryLocation* addr : points_to) {
+      if (isa< DynAllocMemoryLocation >(addr)) {
+        return PointsToSet::top();
+      }
+    }
+  }
+
+  return points_to;
+}
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -77,8 +77,20 @@ void AnalysisOptions::save(SettingsTable& table) {
 
   table.insert("use-liveness", this->use_liveness);
 
+  table.insert("use-sparse-scalars", this->use_sparse_scalars);
+
   table.insert("use-pointer-analysis", this->use_pointer);
 
+  table.insert("use-mod-ref-analysis", this->use_mod_ref);
+
+  table.insert("pointer-widening-threshold",
+               std::to_string(this->pointer_widening_threshold));
+
+  table.insert("pointer-offsets",
+               pointer_offsets_option_str(this->pointer_offsets));
+
+  table.insert("type-function-pointers", this->type_function_pointers);
+
   table.insert("precision-level", precision_str(this->precision));
 
   table.insert("globals-init-policy",
@@ -93,6 +105,61 @@ void AnalysisOptions::save(SettingsTable& table) {
   if (this->argc) {
     table.insert("argc", std::to_string(*this->argc));
   }
+
+  table.insert("jobs", std::to_string(this->jobs));
+
+  table.insert("fused-checks", this->fused_checks);
+
+  table.insert("wto-jobs", std::to_string(this->wto_jobs));
+
+  table.insert("check-jobs", std::to_string(this->check_jobs));
+
+  table.insert("stream-checks", this->stream_checks);
+
+  table.insert("context-depth", std::to_string(this->context_depth));
+
+  table.insert("context-merge",
+               to_json(boost::make_transform_iterator(this->context_merge
+                                                          .begin(),
+                                                      function_name),
+                       boost::make_transform_iterator(this->context_merge
+                                                          .end(),
+                                                      function_name)));
+
+  table.insert("context-pointer-cache",
+               std::to_string(this->context_pointer_cache));
+
+  if (this->dyn_alloc_context_depth) {
+    table.insert("dyn-alloc-context-depth",
+                 std::to_string(*this->dyn_alloc_context_depth));
+  }
+
+  table.insert("warm-start-cycles", this->warm_start_cycles);
+
+  table.insert("smash-threshold", std::to_string(this->smash_threshold));
+
+  table.insert("array-segments", std::to_string(this->array_segments));
+
+  table.insert("gc-loop-heads", this->gc_loop_heads);
+
+  table.insert("widening-delay", std::to_string(this->widening_delay));
+
+  table.insert("narrowing-iterations",
+               std::to_string(this->narrowing_iterations));
+
+  table.insert("function-time-budget",
+               std::to_string(this->function_time_budget));
+
+  table.insert("function-iteration-budget",
+               std::to_string(this->function_iteration_budget));
+
+  table.insert("function-invariant-budget",
+               std::to_string(this->function_invariant_budget));
+
+  if (this->assert_refine_domain) {
+    table.insert("assert-refine-domain",
+                 machine_int_domain_option_str(*this->assert_refine_domain));
+  }
 }
 
 } // end namespace analyzer
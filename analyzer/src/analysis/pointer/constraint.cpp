@@ -44,7 +44,13 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
+#include <exception>
+#include <memory>
+
 #include <ikos/analyzer/analysis/pointer/constraint.hpp>
+#include <ikos/analyzer/util/concurrency.hpp>
+#include <ikos/analyzer/util/work_stealing.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -58,8 +64,18 @@ void PointerConstraints::add(std::unique_ptr< PointerConstraint > cst) {
   this->_system.add(std::move(cst));
 }
 
-void PointerConstraints::solve() {
-  this->_system.solve();
+void PointerConstraints::merge(PointerConstraints& other) {
+  this->_system.merge(other._system);
+}
+
+std::vector< std::unique_ptr< PointerConstraint > > PointerConstraints::
+    release() {
+  return this->_system.release();
+}
+
+void PointerConstraints::solve(const AnalysisOptions& opts) {
+  this->_system.solve(opts.pointer_widening_threshold,
+                      opts.pointer_offsets == PointerOffsetsOption::Interval);
 }
 
 void PointerConstraints::results(PointerInfo& info) const {
@@ -77,5 +93,94 @@ void PointerConstraints::dump(std::ostream& o) const {
   this->_system.dump(o);
 }
 
+namespace {
+
+/// \brief Constraint generation of one function, run by a worker thread
+struct GenerationTask {
+  /// \brief Function
+  ar::Function* function;
+
+  /// \brief Constraints of the function
+  PointerConstraints csts;
+
+  /// \brief Exception thrown by the worker, if any
+  std::exception_ptr error;
+
+  GenerationTask(ar::Function* function_, const ar::DataLayout& dl)
+      : function(function_), csts(dl) {}
+};
+
+/// \brief Return the number of statements in the given function body
+std::size_t num_statements(ar::Function* function) {
+  std::size_t n = 0;
+  for (ar::BasicBlock* bb : *function->body()) {
+    n += bb->num_statements();
+  }
+  return n;
+}
+
+} // end anonymous namespace
+
+void generate_constraints_parallel(
+    Context& ctx,
+    const std::vector< ar::Function* >& functions,
+    PointerConstraints& csts,
+    const std::function< void(ar::Function*, PointerConstraints&) >&
+        generate) {
+  if (functions.empty()) {
+    return;
+  }
+
+  std::vector< std::unique_ptr< GenerationTask > > tasks;
+  tasks.reserve(functions.size());
+  for (ar::Function* fun : functions) {
+    tasks.emplace_back(
+        std::make_unique< GenerationTask >(fun, ctx.bundle->data_layout()));
+  }
+
+  // Largest functions first
+  std::vector< std::pair< std::size_t, GenerationTask* > > sized;
+  sized.reserve(tasks.size());
+  for (const auto& task : tasks) {
+    sized.emplace_back(num_statements(task->function), task.get());
+  }
+  std::stable_sort(sized.begin(),
+                   sized.end(),
+                   [](const auto& a, const auto& b) {
+                     return a.first > b.first;
+                   });
+
+  std::vector< WorkStealingPool::Task > jobs;
+  jobs.reserve(sized.size());
+  for (const auto& entry : sized) {
+    GenerationTask* task = entry.second;
+    jobs.emplace_back([&generate, task]() {
+      try {
+        generate(task->function, task->csts);
+      } catch (...) {
+        task->error = std::current_exception();
+      }
+    });
+  }
+
+  {
+    // Enable locking in the factories
+    ConcurrentScope concurrent_scope;
+
+    unsigned num_threads = static_cast< unsigned >(
+        std::min(static_cast< std::size_t >(ctx.opts.jobs), jobs.size()));
+    WorkStealingPool pool(num_threads);
+    pool.start(std::move(jobs));
+    pool.join();
+  }
+
+  for (const auto& task : tasks) {
+    if (task->error) {
+      std::rethrow_exception(task->error);
+    }
+    csts.merge(task->csts);
+  }
+}
+
 } // end namespace analyzer
 } // end namespace ikos
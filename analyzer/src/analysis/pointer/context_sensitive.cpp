@@ -0,0 +1,267 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of the context-sensitive pointer analysis
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <ikos/analyzer/analysis/pointer/context_sensitive.hpp>
+#include <ikos/analyzer/analysis/pointer/function.hpp>
+#include <ikos/analyzer/util/concurrency.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+namespace {
+
+using VarOp = core::pointer::VariableOperand< Variable*, MemoryLocation* >;
+using AddrOp = core::pointer::AddressOperand< Variable*, MemoryLocation* >;
+using AssignCst = core::pointer::AssignConstraint< Variable*, MemoryLocation* >;
+using PointerOperand = core::pointer::Operand< Variable*, MemoryLocation* >;
+
+/// \brief Return a copy of the given operand
+std::unique_ptr< PointerOperand > clone(const PointerOperand* op) {
+  if (op->kind() == PointerOperand::VariableKind) {
+    auto var_op = static_cast< const VarOp* >(op);
+    return VarOp::create(var_op->var(), var_op->offset());
+  } else {
+    auto addr_op = static_cast< const AddrOp* >(op);
+    return AddrOp::create(addr_op->address(), addr_op->offset());
+  }
+}
+
+/// \brief Return the variable read by the given operand, or null
+Variable* operand_var(const PointerOperand* op) {
+  if (op->kind() == PointerOperand::VariableKind) {
+    return static_cast< const VarOp* >(op)->var();
+  } else {
+    return nullptr;
+  }
+}
+
+} // end anonymous namespace
+
+ContextSensitivePointerAnalysis::ContextSensitivePointerAnalysis(
+    Context& ctx, const PointerAnalysis& pointer, std::size_t capacity)
+    : _ctx(ctx),
+      _pointer(pointer),
+      _capacity(std::max< std::size_t >(capacity, 1)) {}
+
+ContextSensitivePointerAnalysis::~ContextSensitivePointerAnalysis() = default;
+
+std::shared_ptr< const PointerInfo > ContextSensitivePointerAnalysis::results(
+    CallContext* context,
+    ar::Function* function,
+    const Parameters& parameters) {
+  ConcurrentLockGuard lock(this->_mutex);
+
+  auto it = this->_map.find({context, function});
+  if (it != this->_map.end()) {
+    auto entry = it->second;
+    if (std::equal(parameters.begin(),
+                   parameters.end(),
+                   entry->parameters.begin(),
+                   entry->parameters.end(),
+                   [](const PointerAbsValue& a, const PointerAbsValue& b) {
+                     return a.equals(b);
+                   })) {
+      this->_hits++;
+      this->_entries.splice(this->_entries.begin(), this->_entries, entry);
+      return entry->info;
+    }
+
+    // The entry invariant changed, recompute
+    this->_entries.erase(entry);
+    this->_map.erase(it);
+  }
+
+  this->_misses++;
+  std::shared_ptr< const PointerInfo > info =
+      this->compute(function, parameters);
+  this->_entries.push_front(Entry{context, function, parameters, info});
+  this->_map.try_emplace({context, function}, this->_entries.begin());
+
+  if (this->_entries.size() > this->_capacity) {
+    const Entry& last = this->_entries.back();
+    this->_map.erase({last.context, last.function});
+    this->_entries.pop_back();
+  }
+
+  return info;
+}
+
+const ContextSensitivePointerAnalysis::LocalConstraints&
+ContextSensitivePointerAnalysis::local_constraints(ar::Function* function) {
+  auto it = this->_local.find(function);
+  if (it != this->_local.end()) {
+    return *it->second;
+  }
+
+  PointerConstraints csts(this->_ctx.bundle->data_layout());
+  PointerConstraintsGenerator< EmptyCodeInvariants >
+      generator(this->_ctx,
+                csts,
+                this->_ctx.function_pointer == nullptr
+                    ? nullptr
+                    : &this->_ctx.function_pointer->results());
+  generator.process_function_def(function, EmptyCodeInvariants());
+
+  // Only keep the assignments, loads and stores depend on the memory of the
+  // whole program
+  auto local = std::make_unique< LocalConstraints >();
+  for (auto& cst : csts.release()) {
+    if (cst->kind() == PointerConstraint::AssignKind) {
+      auto assign = static_cast< const AssignCst* >(cst.get());
+      local->defined.insert(assign->result());
+      local->assigns.push_back(std::move(cst));
+    }
+  }
+
+  return *this->_local.try_emplace(function, std::move(local)).first->second;
+}
+
+std::shared_ptr< const PointerInfo > ContextSensitivePointerAnalysis::compute(
+    ar::Function* function, const Parameters& parameters) {
+  const ar::DataLayout& dl = this->_ctx.bundle->data_layout();
+  const PointerInfo& global = this->_pointer.results();
+
+  // Pointer values of the variables read but not defined by the function
+  std::unordered_map< Variable*, PointerAbsValue > inputs;
+
+  // Parameters more precise than their context-insensitive value
+  std::vector< std::pair< Variable*, PointerAbsValue > > refined_params;
+
+  for (std::size_t i = 0; i < parameters.size(); i++) {
+    if (parameters[i].is_top()) {
+      continue;
+    }
+    Variable* param = this->_ctx.var_factory->get_internal(function->param(i));
+    PointerAbsValue value = global.get(param);
+    if (!value.leq(parameters[i])) {
+      value.meet_with(parameters[i]);
+      refined_params.emplace_back(param, value);
+    }
+    inputs.emplace(param, value);
+  }
+
+  if (refined_params.empty()) {
+    return nullptr; // Same as the context-insensitive information
+  }
+
+  const LocalConstraints& local = this->local_constraints(function);
+
+  for (const auto& cst : local.assigns) {
+    auto assign = static_cast< const AssignCst* >(cst.get());
+    Variable* var = operand_var(assign->operand());
+    if (var != nullptr && local.defined.count(var) == 0) {
+      inputs.emplace(var, global.get(var));
+    }
+  }
+
+  // Variables with an unknown points-to set cannot be seeded, keep the
+  // context-insensitive value of all the variables depending on them
+  std::unordered_set< Variable* > unknown;
+  for (const auto& input : inputs) {
+    if (input.second.points_to().is_top()) {
+      unknown.insert(input.first);
+    }
+  }
+  for (bool change = !unknown.empty(); change;) {
+    change = false;
+    for (const auto& cst : local.assigns) {
+      auto assign = static_cast< const AssignCst* >(cst.get());
+      Variable* var = operand_var(assign->operand());
+      if (var != nullptr && unknown.count(var) != 0 &&
+          unknown.insert(assign->result()).second) {
+        change = true;
+      }
+    }
+  }
+
+  // Build and solve the local system
+  PointerConstraints csts(dl);
+  for (const auto& input : inputs) {
+    const PointerAbsValue& value = input.second;
+    if (unknown.count(input.first) != 0 || value.is_bottom() ||
+        value.offset().is_bottom()) {
+      continue;
+    }
+    for (MemoryLocation* addr : value.points_to()) {
+      csts.add(AssignCst::create(input.first,
+                                 AddrOp::create(addr, value.offset())));
+    }
+  }
+  for (const auto& cst : local.assigns) {
+    auto assign = static_cast< const AssignCst* >(cst.get());
+    if (unknown.count(assign->result()) == 0) {
+      csts.add(AssignCst::create(assign->result(), clone(assign->operand())));
+    }
+  }
+  csts.solve(this->_ctx.opts);
+
+  PointerInfo solved(dl);
+  csts.results(solved);
+
+  // Only store the values more precise than the context-insensitive ones
+  auto info = std::make_shared< PointerInfo >(dl, &global);
+  for (const auto& param : refined_params) {
+    if (local.defined.count(param.first) == 0) {
+      info->insert(param.first, param.second);
+    }
+  }
+  for (Variable* var : local.defined) {
+    if (unknown.count(var) != 0) {
+      continue;
+    }
+    PointerAbsValue value = global.get(var);
+    PointerAbsValue refined = solved.get(var);
+    if (!value.leq(refined)) {
+      value.meet_with(refined);
+      info->insert(var, value);
+    }
+  }
+
+  return info;
+}
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -44,78 +44,146 @@
  *
  ******************************************************************************/
 
-#include <ikos/core/domain/exception/exception.hpp>
-#include <ikos/core/domain/lifetime/dummy.hpp>
-#include <ikos/core/domain/machine_int/dummy.hpp>
-#include <ikos/core/domain/memory/dummy.hpp>
-#include <ikos/core/domain/nullity/dummy.hpp>
-#include <ikos/core/domain/pointer/dummy.hpp>
-#include <ikos/core/domain/uninitialized/dummy.hpp>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 
+#include <ikos/ar/semantic/statement.hpp>
+#include <ikos/ar/semantic/value.hpp>
+#include <ikos/ar/verify/type.hpp>
+
+#include <ikos/analyzer/analysis/memory_location.hpp>
 #include <ikos/analyzer/analysis/pointer/constraint.hpp>
 #include <ikos/analyzer/analysis/pointer/function.hpp>
 #include <ikos/analyzer/analysis/pointer/value.hpp>
+#include <ikos/analyzer/analysis/variable.hpp>
+#include <ikos/analyzer/database/output.hpp>
 #include <ikos/analyzer/util/log.hpp>
+#include <ikos/analyzer/util/timer.hpp>
 
 namespace ikos {
 namespace analyzer {
 
-FunctionPointerAnalysis::FunctionPointerAnalysis(Context& ctx)
-    : _ctx(ctx), _info(ctx.bundle->data_layout()) {}
-
-FunctionPointerAnalysis::~FunctionPointerAnalysis() = default;
-
 namespace {
 
-/// \brief Dummy machine integer abstract domain
-using MachineIntAbstractDomain = core::machine_int::DummyDomain< Variable* >;
-
-/// \brief Dummy pointer abstract domain
-using PointerAbstractDomain =
-    core::pointer::DummyDomain< Variable*,
-                                MemoryLocation*,
-                                MachineIntAbstractDomain,
-                                core::nullity::DummyDomain< Variable* > >;
-
-/// \brief Dummy memory abstract domain
-using MemoryAbstractDomain =
-    core::memory::DummyDomain< Variable*,
-                               MemoryLocation*,
-                               VariableFactory,
-                               MachineIntAbstractDomain,
-                               core::nullity::DummyDomain< Variable* >,
-                               PointerAbstractDomain,
-                               core::uninitialized::DummyDomain< Variable* >,
-                               core::lifetime::DummyDomain< MemoryLocation* > >;
-
-/// \brief Dummy abstract domain for the function pointer analysis
-///
-/// This is either top or bottom.
-using AbstractDomain = core::exception::ExceptionDomain< MemoryAbstractDomain >;
+/// \brief Insert the functions whose address is used by the given value
+void collect_address_taken(ar::Value* value,
+                           std::unordered_set< ar::Function* >& functions) {
+  if (auto cst = dyn_cast< ar::FunctionPointerConstant >(value)) {
+    functions.insert(cst->function());
+  } else if (auto cst = dyn_cast< ar::StructConstant >(value)) {
+    for (auto it = cst->field_begin(), et = cst->field_end(); it != et; ++it) {
+      collect_address_taken(it->second, functions);
+    }
+  } else if (auto cst = dyn_cast< ar::SequentialConstant >(value)) {
+    for (auto it = cst->element_begin(), et = cst->element_end(); it != et;
+         ++it) {
+      collect_address_taken(*it, functions);
+    }
+  }
+}
 
-/// \brief An empty code invariants
-class EmptyCodeInvariants {
-public:
-  using AbstractDomainT = AbstractDomain;
+/// \brief Return true if a value of the given type may hold a pointer
+bool may_hold_pointer(ar::Type* type) {
+  if (type->is_pointer() || type->is_opaque()) {
+    return true;
+  } else if (auto struct_type = dyn_cast< ar::StructType >(type)) {
+    for (auto it = struct_type->field_begin(), et = struct_type->field_end();
+         it != et;
+         ++it) {
+      if (may_hold_pointer(it->second)) {
+        return true;
+      }
+    }
+    return false;
+  } else if (auto seq_type = dyn_cast< ar::SequentialType >(type)) {
+    return may_hold_pointer(seq_type->element_type());
+  } else {
+    return false;
+  }
+}
 
-public:
-  /// \brief Get the invariant at the entry of the given basic block
-  AbstractDomainT entry(ar::BasicBlock* /*bb*/) const {
-    return AbstractDomainT::top();
+/// \brief Return true if external code can exchange pointers with the
+/// program through a call to the given function
+///
+/// Intrinsics are modeled by the analyzer and never create function pointers.
+bool exchanges_pointers(ar::Function* fun) {
+  if (fun->is_definition() || fun->is_intrinsic()) {
+    return false;
   }
+  ar::FunctionType* type = fun->type();
+  if (fun->is_var_arg() || may_hold_pointer(type->return_type())) {
+    return true;
+  }
+  return std::any_of(type->param_begin(), type->param_end(), may_hold_pointer);
+}
 
-  /// \brief Analyze the given statement and update the invariant
-  AbstractDomainT analyze_statement(ar::Statement* /*stmt*/,
-                                    AbstractDomainT inv) const {
-    return inv;
+/// \brief Insert the functions whose address is used in the given code, and
+/// the indirect calls of the code
+///
+/// The called operand of a call statement is not an address use. Sets
+/// `external` to true if the code exchanges pointers with external code.
+void collect_address_taken(ar::Code* code,
+                           std::unordered_set< ar::Function* >& functions,
+                           std::vector< ar::CallBase* >& indirect_calls,
+                           bool& external) {
+  for (ar::BasicBlock* bb : *code) {
+    for (ar::Statement* stmt : *bb) {
+      auto it = stmt->op_begin();
+      if (auto call = dyn_cast< ar::CallBase >(stmt)) {
+        if (isa< ar::InternalVariable >(call->called())) {
+          indirect_calls.push_back(call);
+        } else if (auto cst = dyn_cast< ar::FunctionPointerConstant >(
+                       call->called())) {
+          external = external || exchanges_pointers(cst->function());
+        } else {
+          // Inline assembly
+          external = true;
+        }
+        ++it;
+      }
+      for (auto et = stmt->op_end(); it != et; ++it) {
+        collect_address_taken(*it, functions);
+      }
+    }
   }
-};
+}
 
 } // end anonymous namespace
 
+FunctionPointerAnalysis::FunctionPointerAnalysis(Context& ctx)
+    : _ctx(ctx), _info(ctx.bundle->data_layout()) {}
+
+FunctionPointerAnalysis::~FunctionPointerAnalysis() = default;
+
 void FunctionPointerAnalysis::run() {
   ar::Bundle* bundle = _ctx.bundle;
 
+  // Called pointers resolved using the function signatures
+  std::vector< std::pair< Variable*, PointerAbsValue > > resolved;
+
+  // True if function pointers may come from external code
+  bool external = false;
+
+  if (_ctx.opts.type_function_pointers) {
+    bool complete;
+    {
+      ScopeTimerDatabase t(_ctx.output_db->times,
+                           "ikos-analyzer.function-pointer.type");
+      complete = this->resolve_by_type(resolved, external);
+    }
+    if (complete && !external) {
+      for (const auto& entry : resolved) {
+        this->_info.set(entry.first, entry.second);
+      }
+      return;
+    }
+    if (external) {
+      log::info("Pointers are exchanged with external code, solving the "
+                "function pointer constraints");
+    }
+  }
+
   PointerConstraints constraints(bundle->data_layout());
 
   PointerConstraintsGenerator< EmptyCodeInvariants > visitor(_ctx,
@@ -137,23 +205,183 @@ void FunctionPointerAnalysis::run() {
     }
   }
 
+  // Function definitions, processed by worker threads when using -jobs
+  std::vector< ar::Function* > definitions;
+
   for (auto it = bundle->function_begin(), et = bundle->function_end();
        it != et;
        ++it) {
     ar::Function* fun = *it;
-    if (fun->is_definition()) {
-      log::debug("Generating pointer constraints for function @" + fun->name());
-      visitor.process_function_def(fun, EmptyCodeInvariants());
-    } else {
+    if (!fun->is_definition()) {
       visitor.process_function_decl(fun);
+    } else if (_ctx.opts.jobs > 1) {
+      definitions.push_back(fun);
+    } else {
+      log::debug([fun] {
+        return "Generating pointer constraints for function @" + fun->name();
+      });
+      visitor.process_function_def(fun, EmptyCodeInvariants());
     }
   }
 
+  generate_constraints_parallel(
+      _ctx,
+      definitions,
+      constraints,
+      [this](ar::Function* fun, PointerConstraints& csts) {
+        log::debug([fun] {
+          return "Generating pointer constraints for function @" + fun->name();
+        });
+        PointerConstraintsGenerator< EmptyCodeInvariants > local_visitor(_ctx,
+                                                                         csts,
+                                                                         nullptr);
+        local_visitor.process_function_def(fun, EmptyCodeInvariants());
+      });
+
   log::debug("Solving pointer constraints");
-  constraints.solve();
+  {
+    const char* offsets = pointer_offsets_option_str(_ctx.opts.pointer_offsets);
+    ScopeTimerDatabase t(_ctx.output_db->times,
+                         std::string("ikos-analyzer.function-pointer.solve.") +
+                             offsets);
+    constraints.solve(_ctx.opts);
+  }
 
   // Save information
   constraints.results(this->_info);
+
+  // The signatures can refine the results of the constraint system. A pointer
+  // that is top may come from external code, which can return any function,
+  // so it is only refined if no pointer is exchanged with external code.
+  for (const auto& entry : resolved) {
+    PointerAbsValue value = this->_info.get(entry.first);
+    if (value.points_to().is_top()) {
+      if (external) {
+        continue;
+      }
+      value = entry.second;
+    } else {
+      value.meet_with(entry.second);
+      if (value.is_bottom()) {
+        // The pointer is called through a cast, keep the constraint results
+        continue;
+      }
+    }
+    this->_info.set(entry.first, value);
+  }
+}
+
+bool FunctionPointerAnalysis::resolve_by_type(
+    std::vector< std::pair< Variable*, PointerAbsValue > >& resolved,
+    bool& external) const {
+  ar::Bundle* bundle = _ctx.bundle;
+
+  std::unordered_set< ar::Function* > address_taken;
+  std::vector< ar::CallBase* > indirect_calls;
+  for (auto it = bundle->global_begin(), et = bundle->global_end(); it != et;
+       ++it) {
+    ar::GlobalVariable* gv = *it;
+    if (gv->is_definition()) {
+      collect_address_taken(gv->initializer(),
+                            address_taken,
+                            indirect_calls,
+                            external);
+    } else {
+      // Initialized by external code
+      external = external || may_hold_pointer(gv->type()->pointee());
+    }
+  }
+  for (auto it = bundle->function_begin(), et = bundle->function_end();
+       it != et;
+       ++it) {
+    if ((*it)->is_definition()) {
+      collect_address_taken((*it)->body(),
+                            address_taken,
+                            indirect_calls,
+                            external);
+    }
+  }
+
+  // External functions called through a pointer
+  for (ar::Function* fun : address_taken) {
+    external = external || exchanges_pointers(fun);
+  }
+
+  // Pointer parameters of the entry points come from unknown callers. The
+  // argv parameter of main only holds strings.
+  for (ar::Function* fun : _ctx.opts.entry_points) {
+    if (fun->name() != "main" &&
+        std::any_of(fun->type()->param_begin(),
+                    fun->type()->param_end(),
+                    may_hold_pointer)) {
+      external = true;
+    }
+  }
+
+  // Group the address-taken functions by signature
+  std::unordered_map< ar::FunctionType*, std::vector< ar::Function* > >
+      signatures;
+  for (ar::Function* fun : address_taken) {
+    signatures[fun->type()].push_back(fun);
+  }
+
+  // Candidate callees of each called pointer, over all its call sites.
+  // A null entry marks a pointer with an ambiguous call site.
+  std::unordered_map< ar::InternalVariable*, std::vector< ar::Function* > >
+      candidates;
+  std::size_t num_ambiguous = 0;
+  for (ar::CallBase* call : indirect_calls) {
+    auto ptr = cast< ar::InternalVariable >(call->called());
+    ar::Function* callee = nullptr;
+    std::size_t num_callees = 0;
+    for (const auto& entry : signatures) {
+      if (ar::TypeVerifier::is_valid_call(call, entry.first)) {
+        callee = entry.second.front();
+        num_callees += entry.second.size();
+        if (num_callees > 1) {
+          break;
+        }
+      }
+    }
+
+    std::vector< ar::Function* >& callees = candidates[ptr];
+    if (num_callees != 1) {
+      // No match or several matches, requires the constraint system
+      num_ambiguous++;
+      callees.push_back(nullptr);
+    } else {
+      callees.push_back(callee);
+    }
+  }
+
+  std::size_t num_resolved = indirect_calls.size() - num_ambiguous;
+  log::info("Resolved " + std::to_string(num_resolved) + " of " +
+            std::to_string(indirect_calls.size()) +
+            " indirect calls using the function signatures");
+
+  for (auto& entry : candidates) {
+    std::vector< ar::Function* >& callees = entry.second;
+    if (std::find(callees.begin(), callees.end(), nullptr) != callees.end()) {
+      continue;
+    }
+    std::sort(callees.begin(), callees.end());
+    callees.erase(std::unique(callees.begin(), callees.end()), callees.end());
+
+    PointsToSet points_to = PointsToSet::empty();
+    for (ar::Function* callee : callees) {
+      points_to.add(_ctx.mem_factory->get_function(callee));
+    }
+    unsigned bit_width = _ctx.bundle->data_layout().pointers.bit_width;
+    resolved.emplace_back(_ctx.var_factory->get_internal(entry.first),
+                          PointerAbsValue(std::move(points_to),
+                                          MachineIntInterval(
+                                              MachineInt::zero(bit_width,
+                                                               Unsigned)),
+                                          core::Nullity::top(),
+                                          core::Uninitialized::top()));
+  }
+
+  return num_ambiguous == 0;
 }
 
 void FunctionPointerAnalysis::dump(std::ostream& o) const {
@@ -61,7 +61,10 @@
 #include <ikos/analyzer/analysis/pointer/function.hpp>
 #include <ikos/analyzer/analysis/pointer/pointer.hpp>
 #include <ikos/analyzer/analysis/pointer/value.hpp>
+#include <ikos/analyzer/analysis/wto.hpp>
+#include <ikos/analyzer/database/output.hpp>
 #include <ikos/analyzer/util/log.hpp>
+#include <ikos/analyzer/util/timer.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -102,14 +105,16 @@ using AbstractDomain = core::exception::ExceptionDomain< MemoryAbstractDomain >;
 
 /// \brief Numerical invariants on an ar::Code
 class NumericalCodeInvariants final
-    : public core::InterleavedFwdFixpointIterator< ar::Code*, AbstractDomain > {
+    : public core::InterleavedFwdFixpointIterator< const ar::CodeGraph*,
+                                                   AbstractDomain > {
 public:
   using AbstractDomainT = AbstractDomain;
 
 private:
   /// \brief Parent class
   using FwdFixpointIterator =
-      core::InterleavedFwdFixpointIterator< ar::Code*, AbstractDomainT >;
+      core::InterleavedFwdFixpointIterator< const ar::CodeGraph*,
+                                            AbstractDomainT >;
 
 private:
   /// \brief Analysis context
@@ -129,7 +134,7 @@ public:
   NumericalCodeInvariants(Context& ctx,
                           const FunctionPointerAnalysis& function_pointer,
                           ar::Code* code)
-      : FwdFixpointIterator(code),
+      : FwdFixpointIterator(code->graph(), ctx.wto_cache->wto(code)),
         _ctx(ctx),
         _empty_call_context(ctx.call_context_factory->get_empty()),
         _function_pointer(function_pointer),
@@ -266,26 +271,63 @@ void PointerAnalysis::run() {
     }
   }
 
+  // Function definitions, processed by worker threads when using -jobs
+  std::vector< ar::Function* > definitions;
+
   for (auto it = bundle->function_begin(), et = bundle->function_end();
        it != et;
        ++it) {
     ar::Function* fun = *it;
-    if (fun->is_definition()) {
-      log::debug(
-          "Generating intra-procedural numerical invariant for function @" +
-          fun->name());
+    if (!fun->is_definition()) {
+      visitor.process_function_decl(fun);
+    } else if (_ctx.opts.jobs > 1) {
+      definitions.push_back(fun);
+    } else {
+      log::debug([fun] {
+        return "Generating intra-procedural numerical invariant for "
+               "function @" +
+               fun->name();
+      });
       NumericalCodeInvariants invariants(_ctx, _function_pointer, fun->body());
       invariants.run();
 
-      log::debug("Generating pointer constraints for function @" + fun->name());
+      log::debug([fun] {
+        return "Generating pointer constraints for function @" + fun->name();
+      });
       visitor.process_function_def(fun, invariants);
-    } else {
-      visitor.process_function_decl(fun);
     }
   }
 
+  generate_constraints_parallel(
+      _ctx,
+      definitions,
+      constraints,
+      [this](ar::Function* fun, PointerConstraints& csts) {
+        log::debug([fun] {
+          return "Generating intra-procedural numerical invariant for "
+                 "function @" +
+                 fun->name();
+        });
+        NumericalCodeInvariants invariants(_ctx,
+                                           _function_pointer,
+                                           fun->body());
+        invariants.run();
+
+        log::debug([fun] {
+          return "Generating pointer constraints for function @" + fun->name();
+        });
+        PointerConstraintsGenerator< NumericalCodeInvariants >
+            local_visitor(_ctx, csts, &_function_pointer.results());
+        local_visitor.process_function_def(fun, invariants);
+      });
+
   log::debug("Solving pointer constraints");
-  constraints.solve();
+  {
+    const char* offsets = pointer_offsets_option_str(_ctx.opts.pointer_offsets);
+    ScopeTimerDatabase t(_ctx.output_db->times,
+                         std::string("ikos-analyzer.pointer.solve.") + offsets);
+    constraints.solve(_ctx.opts);
+  }
 
   // Save information
   constraints.results(this->_info);
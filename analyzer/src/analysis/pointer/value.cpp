@@ -49,8 +49,9 @@
 namespace ikos {
 namespace analyzer {
 
-PointerInfo::PointerInfo(const ar::DataLayout& data_layout)
-    : _data_layout(data_layout) {}
+PointerInfo::PointerInfo(const ar::DataLayout& data_layout,
+                         const PointerInfo* parent)
+    : _data_layout(data_layout), _parent(parent) {}
 
 PointerInfo::~PointerInfo() = default;
 
@@ -61,7 +62,9 @@ void PointerInfo::clear() {
 PointerAbsValue PointerInfo::get(Variable* v) const {
   auto it = this->_map.find(v);
   if (it != this->_map.end()) {
-    return it->second;
+    return it->second.unpack();
+  } else if (this->_parent != nullptr) {
+    return this->_parent->get(v);
   } else {
     return PointerAbsValue::top(this->_data_layout.pointers.bit_width,
                                 Unsigned);
@@ -69,14 +72,23 @@ PointerAbsValue PointerInfo::get(Variable* v) const {
 }
 
 void PointerInfo::insert(Variable* v, const PointerAbsValue& value) {
-  this->_map.insert({v, value});
+  this->_map.emplace(v, value);
+}
+
+void PointerInfo::set(Variable* v, const PointerAbsValue& value) {
+  auto it = this->_map.find(v);
+  if (it != this->_map.end()) {
+    it->second = PackedPointerAbsValue(value);
+  } else {
+    this->_map.emplace(v, value);
+  }
 }
 
 void PointerInfo::dump(std::ostream& o) const {
   for (const auto& ptr : this->_map) {
     ptr.first->dump(o);
     o << " -> ";
-    ptr.second.dump(o);
+    ptr.second.unpack().dump(o);
     o << "\n";
   }
 }
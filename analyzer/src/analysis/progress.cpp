@@ -0,0 +1,196 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief ProgressReporter implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <ikos/core/support/assert.hpp>
+
+#include <ikos/analyzer/analysis/memory_budget.hpp>
+#include <ikos/analyzer/analysis/progress.hpp>
+#include <ikos/analyzer/json/json.hpp>
+#include <ikos/analyzer/util/demangle.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
+#include <ikos/analyzer/util/log.hpp>
+#include <ikos/analyzer/util/source_location.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+namespace {
+
+/// \brief Return a description of a cycle head
+std::string cycle_head_str(ar::BasicBlock* head) {
+  for (ar::Statement* stmt : *head) {
+    if (stmt->has_frontend()) {
+      SourceLocation loc = source_location(stmt);
+      if (loc) {
+        return loc.path().string() + ":" + std::to_string(loc.line());
+      }
+    }
+  }
+  return head->has_name() ? head->name() : "?";
+}
+
+/// \brief Return the duration in seconds
+double seconds(Timer::Duration d) {
+  return d.count();
+}
+
+} // end anonymous namespace
+
+ProgressReporter::ProgressReporter(std::string path,
+                                   std::chrono::milliseconds interval)
+    : _path(std::move(path)), _interval(interval), _start(Timer::Clock::now()) {
+  this->_writer = std::thread([this] { this->run(); });
+}
+
+ProgressReporter::~ProgressReporter() {
+  {
+    std::lock_guard< std::mutex > lock(this->_mutex);
+    this->_stop = true;
+  }
+  this->_cv.notify_all();
+  this->_writer.join();
+  this->write();
+}
+
+void ProgressReporter::set_phase(std::string phase) {
+  std::lock_guard< std::mutex > lock(this->_mutex);
+  this->_phase = std::move(phase);
+}
+
+void ProgressReporter::push(ar::Function* fun) {
+  Frame frame{fun, Timer::Clock::now(), nullptr, 0, true};
+  std::lock_guard< std::mutex > lock(this->_mutex);
+  this->_stacks[std::this_thread::get_id()].push_back(frame);
+}
+
+void ProgressReporter::pop() {
+  std::lock_guard< std::mutex > lock(this->_mutex);
+  auto it = this->_stacks.find(std::this_thread::get_id());
+  ikos_assert(it != this->_stacks.end() && !it->second.empty());
+  it->second.pop_back();
+  if (it->second.empty()) {
+    this->_stacks.erase(it);
+  }
+}
+
+void ProgressReporter::set_cycle(ar::BasicBlock* head,
+                                 unsigned iteration,
+                                 bool increasing) {
+  std::lock_guard< std::mutex > lock(this->_mutex);
+  auto it = this->_stacks.find(std::this_thread::get_id());
+  if (it == this->_stacks.end() || it->second.empty()) {
+    return;
+  }
+  Frame& frame = it->second.back();
+  frame.head = head;
+  frame.iteration = iteration;
+  frame.increasing = increasing;
+}
+
+void ProgressReporter::run() {
+  std::unique_lock< std::mutex > lock(this->_mutex);
+  while (!this->_stop) {
+    if (this->_cv.wait_for(lock, this->_interval, [this] {
+          return this->_stop;
+        })) {
+      break;
+    }
+    lock.unlock();
+    this->write();
+    lock.lock();
+  }
+}
+
+void ProgressReporter::write() {
+  Timer::TimePoint now = Timer::Clock::now();
+  JsonDict status;
+
+  {
+    std::lock_guard< std::mutex > lock(this->_mutex);
+    status.put("phase", this->_phase);
+    status.put("elapsed", seconds(now - this->_start));
+    status.put("rss", resident_set_size() / 1024);
+
+    JsonList threads;
+    for (const auto& entry : this->_stacks) {
+      std::ostringstream id;
+      id << entry.first;
+
+      JsonList stack;
+      for (const Frame& frame : entry.second) {
+        JsonDict f;
+        f.put("function", demangle(frame.function));
+        f.put("elapsed", seconds(now - frame.start));
+        if (frame.head != nullptr) {
+          f.put("cycle", cycle_head_str(frame.head));
+          f.put("iteration", frame.iteration);
+          f.put("increasing", frame.increasing);
+        }
+        stack.add(f);
+      }
+
+      threads.add(JsonDict{{"thread", id.str()}, {"stack", stack}});
+    }
+    status.put("threads", threads);
+  }
+
+  // Write in a temporary file, then rename it, so that readers never see a
+  // partially written file
+  std::string tmp_path = this->_path + ".tmp";
+  {
+    std::ofstream out(tmp_path, std::ios::out | std::ios::trunc);
+    if (!out) {
+      log::error("could not write progress file " + tmp_path);
+      return;
+    }
+    out << status << "\n";
+  }
+  std::rename(tmp_path.c_str(), this->_path.c_str());
+}
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -0,0 +1,323 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Persistent cache of the checks of functions implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/MD5.h>
+
+#include <ikos/ar/format/text.hpp>
+
+#include <ikos/analyzer/analysis/pointer/pointer.hpp>
+#include <ikos/analyzer/analysis/result_cache.hpp>
+#include <ikos/analyzer/analysis/variable.hpp>
+#include <ikos/analyzer/database/output.hpp>
+#include <ikos/analyzer/support/cast.hpp>
+#include <ikos/analyzer/util/log.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+namespace {
+
+/// \brief Version of the cache file format, part of every hash
+constexpr const char* CacheFormatVersion = "1";
+
+/// \brief Return the list of statements of the given function, in order
+std::vector< ar::Statement* > function_statements(ar::Function* fun) {
+  std::vector< ar::Statement* > statements;
+  for (ar::BasicBlock* bb : *fun->body()) {
+    for (ar::Statement* stmt : *bb) {
+      statements.push_back(stmt);
+    }
+  }
+  return statements;
+}
+
+} // end anonymous namespace
+
+// ResultCache::Recorder
+
+ResultCache::Recorder::Recorder(ar::Function* fun) {
+  std::size_t i = 0;
+  for (ar::Statement* stmt : function_statements(fun)) {
+    this->_statements.try_emplace(stmt, i++);
+  }
+}
+
+void ResultCache::Recorder::write(CheckKind kind,
+                                  CheckerName checker,
+                                  Result status,
+                                  ar::Statement* stmt,
+                                  CallContext* /*call_context*/,
+                                  llvm::ArrayRef< ar::Value* > operands,
+                                  const JsonDict& info) {
+  if (!this->_cacheable) {
+    return;
+  }
+
+  auto it = this->_statements.find(stmt);
+  if (it == this->_statements.end() ||
+      (!info.empty() && checker_info_has_table_references(checker))) {
+    this->_cacheable = false;
+    return;
+  }
+
+  CachedCheck check{kind, checker, status, it->second, {}, std::string()};
+  for (ar::Value* operand : operands) {
+    auto op_it = std::find(stmt->op_begin(), stmt->op_end(), operand);
+    if (op_it == stmt->op_end()) {
+      this->_cacheable = false;
+      return;
+    }
+    check.operands.push_back(
+        static_cast< std::size_t >(op_it - stmt->op_begin()));
+  }
+  if (!info.empty()) {
+    check.info = info.str();
+  }
+  this->_checks.push_back(std::move(check));
+}
+
+// ResultCache
+
+ResultCache::ResultCache(Context& ctx, boost::filesystem::path directory)
+    : _ctx(ctx), _directory(std::move(directory)) {
+  boost::filesystem::create_directories(this->_directory);
+
+  const AnalysisOptions& opts = ctx.opts;
+  std::ostringstream key;
+  key << CacheFormatVersion;
+  for (CheckerName checker : opts.analyses) {
+    key << ',' << checker_short_name(checker);
+  }
+  key << ';' << machine_int_domain_option_str(opts.machine_int_domain);
+  key << ';' << procedural_str(opts.procedural);
+  key << ';' << opts.use_liveness;
+  key << ';' << opts.use_sparse_scalars;
+  key << ';' << opts.use_pointer;
+  key << ';' << opts.use_mod_ref;
+  key << ';' << opts.pointer_widening_threshold;
+  key << ';' << pointer_offsets_option_str(opts.pointer_offsets);
+  key << ';' << opts.type_function_pointers;
+  key << ';' << precision_str(opts.precision);
+  key << ';' << globals_init_policy_str(opts.globals_init_policy);
+  key << ';' << hardware_addresses_str(opts.hardware_addresses);
+  key << ';' << opts.smash_threshold;
+  key << ';' << opts.array_segments;
+  key << ';' << opts.gc_loop_heads;
+  key << ';' << opts.widening_delay;
+  key << ';' << opts.narrowing_iterations;
+  if (opts.argc) {
+    key << ';' << *opts.argc;
+  }
+  if (opts.assert_refine_domain) {
+    key << ";assert-refine="
+        << machine_int_domain_option_str(*opts.assert_refine_domain);
+  }
+  this->_options_key = key.str();
+}
+
+ResultCache::~ResultCache() = default;
+
+std::string ResultCache::hash(ar::Function* fun) const {
+  std::ostringstream buf;
+  buf << this->_options_key << '\n';
+
+  ar::TextFormatter formatter;
+  formatter.format(buf, fun);
+
+  // The checks also depend on the points-to sets of the variables, computed
+  // by the pointer analysis on the whole program
+  if (this->_ctx.pointer != nullptr) {
+    const PointerInfo& pointer_info = this->_ctx.pointer->results();
+    VariableFactory& vfac = *this->_ctx.var_factory;
+
+    for (ar::Statement* stmt : function_statements(fun)) {
+      for (auto it = stmt->op_begin(), et = stmt->op_end(); it != et; ++it) {
+        Variable* var = nullptr;
+        if (auto iv = dyn_cast< ar::InternalVariable >(*it)) {
+          var = vfac.get_internal(iv);
+        } else if (auto lv = dyn_cast< ar::LocalVariable >(*it)) {
+          var = vfac.get_local(lv);
+        } else if (auto gv = dyn_cast< ar::GlobalVariable >(*it)) {
+          var = vfac.get_global(gv);
+        }
+
+        if (var != nullptr && isa< ar::PointerType >(var->type())) {
+          pointer_info.get(var).dump(buf);
+          buf << '\n';
+        }
+      }
+    }
+  }
+
+  llvm::MD5 md5;
+  md5.update(buf.str());
+  llvm::MD5::MD5Result result;
+  md5.final(result);
+  llvm::SmallString< 32 > str;
+  llvm::MD5::stringifyResult(result, str);
+  return str.str().str();
+}
+
+bool ResultCache::load(ar::Function* fun, const std::string& hash) {
+  std::ifstream in((this->_directory / hash).string());
+  if (!in.is_open()) {
+    this->_misses++;
+    return false;
+  }
+
+  std::vector< ar::Statement* > statements = function_statements(fun);
+
+  // Parse and validate all the checks before inserting any of them
+  std::vector< CachedCheck > checks;
+  std::string line;
+  while (std::getline(in, line)) {
+    std::size_t tab = line.find('\t');
+    if (tab == std::string::npos) {
+      this->_misses++;
+      return false;
+    }
+
+    std::istringstream fields(line.substr(0, tab));
+    int kind = 0, checker = 0, status = 0;
+    std::size_t num_operands = 0;
+    CachedCheck check;
+    fields >> kind >> checker >> status >> check.statement >> num_operands;
+    check.operands.resize(num_operands);
+    for (std::size_t& operand : check.operands) {
+      fields >> operand;
+    }
+    if (fields.fail() || check.statement >= statements.size()) {
+      this->_misses++;
+      return false;
+    }
+    for (std::size_t operand : check.operands) {
+      if (operand >= statements[check.statement]->num_operands()) {
+        this->_misses++;
+        return false;
+      }
+    }
+
+    check.kind = static_cast< CheckKind >(kind);
+    check.checker = static_cast< CheckerName >(checker);
+    check.status = static_cast< Result >(status);
+    check.info = line.substr(tab + 1);
+    checks.push_back(std::move(check));
+  }
+
+  CallContext* empty_call_context = this->_ctx.call_context_factory->get_empty();
+  std::vector< ar::Value* > operands;
+  for (const CachedCheck& check : checks) {
+    ar::Statement* stmt = statements[check.statement];
+    operands.clear();
+    for (std::size_t operand : check.operands) {
+      operands.push_back(stmt->operand(operand));
+    }
+    this->_ctx.output_db->checks.insert(check.kind,
+                                        check.checker,
+                                        check.status,
+                                        stmt,
+                                        empty_call_context,
+                                        operands,
+                                        check.info.empty()
+                                            ? JsonDict()
+                                            : JsonDict::from_str(check.info));
+  }
+
+  this->_hits++;
+  return true;
+}
+
+void ResultCache::start_recording(ar::Function* fun) {
+  ikos_assert(!this->_recorder);
+  this->_recorder = std::make_unique< Recorder >(fun);
+  this->_ctx.output_db->checks.set_recorder(this->_recorder.get());
+}
+
+void ResultCache::stop_recording(const std::string& hash) {
+  ikos_assert(this->_recorder);
+  this->_ctx.output_db->checks.set_recorder(nullptr);
+  std::unique_ptr< Recorder > recorder = std::move(this->_recorder);
+
+  const std::vector< CachedCheck >* checks = recorder->checks();
+  if (checks == nullptr) {
+    return;
+  }
+
+  // Write in a temporary file, then rename it, so that a concurrent or
+  // interrupted run never reads a partial entry
+  boost::filesystem::path path = this->_directory / hash;
+  boost::filesystem::path tmp_path = path;
+  tmp_path += boost::filesystem::unique_path(".%%%%%%%%.tmp");
+  {
+    std::ofstream out(tmp_path.string());
+    if (!out.is_open()) {
+      log::warning("could not write " + tmp_path.string());
+      return;
+    }
+    for (const CachedCheck& check : *checks) {
+      out << static_cast< int >(check.kind) << ' '
+          << static_cast< int >(check.checker) << ' '
+          << static_cast< int >(check.status) << ' ' << check.statement << ' '
+          << check.operands.size();
+      for (std::size_t operand : check.operands) {
+        out << ' ' << operand;
+      }
+      out << '\t' << check.info << '\n';
+    }
+  }
+
+  boost::system::error_code err;
+  boost::filesystem::rename(tmp_path, path, err);
+  if (err) {
+    boost::filesystem::remove(tmp_path, err);
+  }
+}
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -0,0 +1,350 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Sparse scalar analysis implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <limits>
+#include <memory>
+
+#include <llvm/ADT/DenseSet.h>
+
+#include <ikos/ar/semantic/statement.hpp>
+
+#include <ikos/analyzer/analysis/sparse_scalar.hpp>
+#include <ikos/analyzer/analysis/wto.hpp>
+#include <ikos/analyzer/support/cast.hpp>
+#include <ikos/analyzer/util/log.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace {
+
+/// \brief Collect the basic blocks that are not in a cycle
+class AcyclicBlocksVisitor
+    : public core::WtoComponentVisitor< const ar::CodeGraph* > {
+private:
+  using WtoVertexT = core::WtoVertex< const ar::CodeGraph* >;
+  using WtoCycleT = core::WtoCycle< const ar::CodeGraph* >;
+
+private:
+  llvm::DenseSet< ar::BasicBlock* >& _blocks;
+
+public:
+  /// \brief Constructor
+  explicit AcyclicBlocksVisitor(llvm::DenseSet< ar::BasicBlock* >& blocks)
+      : _blocks(blocks) {}
+
+  void visit(const WtoVertexT& vertex) override {
+    this->_blocks.insert(vertex.node());
+  }
+
+  void visit(const WtoCycleT&) override {}
+
+}; // end class AcyclicBlocksVisitor
+
+/// \brief Dominator tree of a ar::Code
+///
+/// Computed with the iterative algorithm of Cooper, Harvey and Kennedy, on the
+/// basic blocks reachable from the entry block.
+class DominatorTree {
+private:
+  /// \brief Reachable basic blocks, in reverse post-order
+  std::vector< ar::BasicBlock* > _blocks;
+
+  /// \brief Map from basic block to its position in `_blocks`
+  llvm::DenseMap< ar::BasicBlock*, unsigned > _block_index;
+
+  /// \brief Immediate dominator of each basic block, by position
+  std::vector< unsigned > _idom;
+
+public:
+  /// \brief Compute the dominator tree of the given code
+  explicit DominatorTree(ar::Code* code) {
+    this->order_blocks(code);
+    this->solve();
+  }
+
+  /// \brief Return true if `a` strictly dominates `b`
+  ///
+  /// Returns false if `b` is not reachable from the entry block.
+  bool strictly_dominates(ar::BasicBlock* a, ar::BasicBlock* b) const {
+    auto a_it = this->_block_index.find(a);
+    auto b_it = this->_block_index.find(b);
+    if (a_it == this->_block_index.end() || b_it == this->_block_index.end() ||
+        a == b) {
+      return false;
+    }
+    unsigned x = b_it->second;
+    while (x > a_it->second) {
+      x = this->_idom[x];
+    }
+    return x == a_it->second;
+  }
+
+private:
+  /// \brief Collect the basic blocks reachable from the entry block, in
+  /// reverse post-order
+  void order_blocks(ar::Code* code) {
+    using SuccessorIterator = ar::BasicBlock::BasicBlockIterator;
+
+    std::vector< ar::BasicBlock* > post_order;
+    llvm::DenseSet< ar::BasicBlock* > visited;
+    std::vector< std::pair< ar::BasicBlock*, SuccessorIterator > > stack;
+
+    ar::BasicBlock* entry = code->entry_block();
+    visited.insert(entry);
+    stack.emplace_back(entry, entry->successor_begin());
+    while (!stack.empty()) {
+      ar::BasicBlock* bb = stack.back().first;
+      SuccessorIterator& it = stack.back().second;
+      if (it != bb->successor_end()) {
+        ar::BasicBlock* succ = *it;
+        ++it;
+        if (visited.insert(succ).second) {
+          stack.emplace_back(succ, succ->successor_begin());
+        }
+      } else {
+        post_order.push_back(bb);
+        stack.pop_back();
+      }
+    }
+
+    this->_blocks.assign(post_order.rbegin(), post_order.rend());
+    for (std::size_t i = 0; i < this->_blocks.size(); i++) {
+      this->_block_index.try_emplace(this->_blocks[i],
+                                     static_cast< unsigned >(i));
+    }
+  }
+
+  /// \brief Compute the immediate dominators
+  void solve() {
+    constexpr unsigned Undefined = std::numeric_limits< unsigned >::max();
+
+    this->_idom.assign(this->_blocks.size(), Undefined);
+    this->_idom[0] = 0;
+
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      for (std::size_t i = 1; i < this->_blocks.size(); i++) {
+        ar::BasicBlock* bb = this->_blocks[i];
+        unsigned idom = Undefined;
+        for (auto it = bb->predecessor_begin(), et = bb->predecessor_end();
+             it != et;
+             ++it) {
+          auto pred = this->_block_index.find(*it);
+          if (pred == this->_block_index.end() ||
+              this->_idom[pred->second] == Undefined) {
+            continue;
+          }
+          idom = (idom == Undefined) ? pred->second
+                                     : this->intersect(pred->second, idom);
+        }
+        if (idom != this->_idom[i]) {
+          this->_idom[i] = idom;
+          changed = true;
+        }
+      }
+    }
+  }
+
+  /// \brief Return the nearest common dominator of two basic blocks
+  unsigned intersect(unsigned a, unsigned b) const {
+    while (a != b) {
+      while (a > b) {
+        a = this->_idom[a];
+      }
+      while (b > a) {
+        b = this->_idom[b];
+      }
+    }
+    return a;
+  }
+
+}; // end class DominatorTree
+
+/// \brief Definitions and uses of a candidate sparse scalar
+struct Candidate {
+  /// \brief Number of definitions
+  unsigned num_defs = 0;
+
+  /// \brief Basic block of the last definition
+  ar::BasicBlock* def_block = nullptr;
+
+  /// \brief True if the variable cannot be a sparse scalar
+  bool excluded = false;
+
+  /// \brief Basic blocks using the variable
+  std::vector< ar::BasicBlock* > use_blocks;
+};
+
+} // end anonymous namespace
+
+SparseScalarAnalysis::SparseScalarAnalysis(Context& ctx) : _ctx(ctx) {}
+
+SparseScalarAnalysis::~SparseScalarAnalysis() = default;
+
+void SparseScalarAnalysis::run() {
+  ar::Bundle* bundle = _ctx.bundle;
+
+  for (auto it = bundle->function_begin(), et = bundle->function_end();
+       it != et;
+       ++it) {
+    ar::Function* fun = *it;
+    if (fun->is_definition()) {
+      log::debug([fun] {
+        return "Running sparse scalar analysis on function @" + fun->name();
+      });
+      this->run(fun->body());
+    }
+  }
+}
+
+const SparseScalarAnalysis::CodeInfo* SparseScalarAnalysis::code_info(
+    ar::Code* code) const {
+  auto it = this->_codes.find(code);
+  return it != this->_codes.end() ? &it->second : nullptr;
+}
+
+void SparseScalarAnalysis::run(ar::Code* code) {
+  // Collect the definitions and uses of the integer internal variables
+  llvm::DenseMap< ar::InternalVariable*, Candidate > candidates;
+  std::vector< ar::InternalVariable* > order;
+
+  for (ar::BasicBlock* bb : *code) {
+    for (ar::Statement* stmt : *bb) {
+      bool exclude_operands = isa< ar::Comparison >(stmt) ||
+                              isa< ar::ReturnValue >(stmt) ||
+                              isa< ar::CallBase >(stmt);
+
+      for (auto it = stmt->op_begin(), et = stmt->op_end(); it != et; ++it) {
+        auto iv = dyn_cast< ar::InternalVariable >(*it);
+        if (iv == nullptr || !iv->type()->is_integer()) {
+          continue;
+        }
+        auto res = candidates.try_emplace(iv);
+        if (res.second) {
+          order.push_back(iv);
+        }
+        Candidate& candidate = res.first->second;
+        if (exclude_operands) {
+          candidate.excluded = true;
+        } else if (candidate.use_blocks.empty() ||
+                   candidate.use_blocks.back() != bb) {
+          candidate.use_blocks.push_back(bb);
+        }
+      }
+
+      if (!stmt->has_result()) {
+        continue;
+      }
+      auto iv = dyn_cast< ar::InternalVariable >(stmt->result());
+      if (iv == nullptr || !iv->type()->is_integer()) {
+        continue;
+      }
+      auto res = candidates.try_emplace(iv);
+      if (res.second) {
+        order.push_back(iv);
+      }
+      Candidate& candidate = res.first->second;
+      candidate.num_defs++;
+      candidate.def_block = bb;
+      if (isa< ar::CallBase >(stmt)) {
+        candidate.excluded = true;
+      }
+    }
+  }
+
+  llvm::DenseSet< ar::BasicBlock* > acyclic;
+  AcyclicBlocksVisitor visitor(acyclic);
+  const WtoCache::WtoT& wto = _ctx.wto_cache->wto(code);
+  for (auto it = wto.begin(), et = wto.end(); it != et; ++it) {
+    it->accept(visitor);
+  }
+
+  std::unique_ptr< DominatorTree > dominators;
+  CodeInfo info;
+
+  for (ar::InternalVariable* iv : order) {
+    const Candidate& candidate = candidates[iv];
+    if (candidate.excluded || candidate.num_defs != 1 ||
+        acyclic.count(candidate.def_block) == 0) {
+      continue;
+    }
+
+    // Only the uses in other basic blocks benefit from a sparse propagation
+    bool used_elsewhere = false;
+    bool dominated = true;
+    for (ar::BasicBlock* bb : candidate.use_blocks) {
+      if (bb == candidate.def_block) {
+        continue;
+      }
+      if (dominators == nullptr) {
+        dominators = std::make_unique< DominatorTree >(code);
+      }
+      used_elsewhere = true;
+      if (!dominators->strictly_dominates(candidate.def_block, bb)) {
+        dominated = false;
+        break;
+      }
+    }
+    if (!used_elsewhere || !dominated) {
+      continue;
+    }
+
+    Variable* var = _ctx.var_factory->get_internal(iv);
+    info.index.try_emplace(var, static_cast< unsigned >(info.index.size()));
+    info.defined[candidate.def_block].push_back(var);
+    for (ar::BasicBlock* bb : candidate.use_blocks) {
+      if (bb != candidate.def_block) {
+        info.used[bb].push_back(var);
+      }
+    }
+  }
+
+  if (!info.index.empty()) {
+    this->_codes.try_emplace(code, std::move(info));
+  }
+}
+
+} // end namespace analyzer
+} // end namespace ikos
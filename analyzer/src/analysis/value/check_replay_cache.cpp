@@ -0,0 +1,222 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of the reuse of the checks of a callee
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+
+#include <ikos/analyzer/analysis/value/check_replay_cache.hpp>
+#include <ikos/analyzer/database/output.hpp>
+
+namespace ikos {
+namespace analyzer {
+namespace value {
+
+// CheckReplayCache::Recorder
+
+void CheckReplayCache::Recorder::write(CheckKind kind,
+                                       CheckerName checker,
+                                       Result status,
+                                       ar::Statement* stmt,
+                                       CallContext* call_context,
+                                       llvm::ArrayRef< ar::Value* > operands,
+                                       const JsonDict& info) {
+  if (this->_cache._depth == 0) {
+    return;
+  }
+
+  this->_cache._log.push_back(RecordedCheck{kind,
+                                            checker,
+                                            status,
+                                            stmt,
+                                            call_context,
+                                            operands.vec(),
+                                            info});
+}
+
+// CheckReplayCache
+
+CheckReplayCache::CheckReplayCache(Context& ctx)
+    : _ctx(ctx),
+      _enabled(ctx.context_pointer == nullptr &&
+               ctx.opts.display_invariants == DisplayOption::None &&
+               ctx.opts.display_checks == DisplayOption::None),
+      _recorder(*this) {
+  if (this->_enabled) {
+    this->_ctx.output_db->checks.set_recorder(&this->_recorder);
+  }
+}
+
+CheckReplayCache::~CheckReplayCache() {
+  if (this->_enabled) {
+    this->_ctx.output_db->checks.set_recorder(nullptr);
+  }
+}
+
+bool CheckReplayCache::replay(ar::Function* fun,
+                              CallContext* call_context,
+                              const AbstractDomain& entry) {
+  if (!this->_enabled) {
+    return false;
+  }
+
+  auto it = this->_entries.find(fun);
+  if (it == this->_entries.end()) {
+    this->_misses++;
+    return false;
+  }
+
+  // Look for the most recent entry first
+  const std::vector< Entry >& entries = it->second;
+  auto entry_it =
+      std::find_if(entries.rbegin(), entries.rend(), [&](const Entry& e) {
+        return entry.leq(e.entry) && e.entry.leq(entry);
+      });
+  if (entry_it == entries.rend()) {
+    this->_misses++;
+    return false;
+  }
+
+  // Copy the range, since inserting the checks appends to the log
+  std::vector< RecordedCheck > checks(this->_log.begin() +
+                                          static_cast< std::ptrdiff_t >(
+                                              entry_it->begin),
+                                      this->_log.begin() +
+                                          static_cast< std::ptrdiff_t >(
+                                              entry_it->end));
+  CallContext* from = entry_it->call_context;
+
+  for (const RecordedCheck& check : checks) {
+    this->_ctx.output_db->checks.insert(check.kind,
+                                        check.checker,
+                                        check.status,
+                                        check.stmt,
+                                        this->rebase(check.call_context,
+                                                     from,
+                                                     call_context),
+                                        check.operands,
+                                        check.info);
+  }
+
+  this->_hits++;
+  return true;
+}
+
+std::size_t CheckReplayCache::start_recording() {
+  ikos_assert(this->_enabled);
+  this->_depth++;
+  return this->_log.size();
+}
+
+void CheckReplayCache::stop_recording(ar::Function* fun,
+                                      CallContext* call_context,
+                                      AbstractDomain entry,
+                                      std::size_t begin) {
+  ikos_assert(this->_depth > 0);
+  this->_depth--;
+
+  std::size_t end = this->_log.size();
+  if (!this->is_replayable(call_context, begin, end)) {
+    if (this->_depth == 0) {
+      // Drop the checks of the outermost callee, and the entries of its own
+      // callees referring to them
+      for (auto& fun_entries : this->_entries) {
+        std::vector< Entry >& entries = fun_entries.second;
+        entries.erase(std::remove_if(entries.begin(),
+                                     entries.end(),
+                                     [begin](const Entry& e) {
+                                       return e.end > begin;
+                                     }),
+                      entries.end());
+      }
+      this->_log.erase(this->_log.begin() +
+                           static_cast< std::ptrdiff_t >(begin),
+                       this->_log.end());
+    }
+    return;
+  }
+
+  std::vector< Entry >& entries = this->_entries[fun];
+  if (entries.size() >= MaxEntriesPerFunction) {
+    entries.erase(entries.begin());
+  }
+  entries.push_back(Entry{std::move(entry), call_context, begin, end});
+}
+
+bool CheckReplayCache::is_replayable(CallContext* call_context,
+                                     std::size_t begin,
+                                     std::size_t end) const {
+  for (std::size_t i = begin; i < end; i++) {
+    const RecordedCheck& check = this->_log[i];
+
+    if (!check.info.empty() &&
+        checker_info_has_table_references(check.checker)) {
+      return false;
+    }
+
+    // The calling context of the check should be a descendant
+    CallContext* context = check.call_context;
+    while (context != call_context && !context->empty()) {
+      context = context->parent();
+    }
+    if (context != call_context) {
+      return false;
+    }
+  }
+  return true;
+}
+
+CallContext* CheckReplayCache::rebase(CallContext* context,
+                                      CallContext* from,
+                                      CallContext* to) const {
+  std::vector< ar::CallBase* > calls;
+  for (; context != from; context = context->parent()) {
+    calls.push_back(context->call());
+  }
+  for (auto it = calls.rbegin(), et = calls.rend(); it != et; ++it) {
+    to = this->_ctx.call_context_factory->get_context(to, *it);
+  }
+  return to;
+}
+
+} // end namespace value
+} // end namespace analyzer
+} // end namespace ikos
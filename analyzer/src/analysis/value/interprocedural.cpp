@@ -41,30 +41,54 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
+#include <llvm/ADT/DenseSet.h>
+
 #include <ikos/core/fixpoint/fwd_fixpoint_iterator.hpp>
+#include <ikos/core/number/gmp_allocator.hpp>
 #include <ikos/core/support/compiler.hpp>
 
 #include <ikos/ar/semantic/bundle.hpp>
 #include <ikos/ar/semantic/type.hpp>
 #include <ikos/ar/semantic/value.hpp>
 
+#include <ikos/analyzer/analysis/call_graph.hpp>
+#include <ikos/analyzer/analysis/checkpoint.hpp>
 #include <ikos/analyzer/analysis/execution_engine/engine.hpp>
 #include <ikos/analyzer/analysis/execution_engine/inliner.hpp>
 #include <ikos/analyzer/analysis/execution_engine/numerical.hpp>
 #include <ikos/analyzer/analysis/fixpoint_profile.hpp>
+#include <ikos/analyzer/analysis/fixpoint_trace.hpp>
+#include <ikos/analyzer/analysis/function_budget.hpp>
+#include <ikos/analyzer/analysis/function_profiler.hpp>
+#include <ikos/analyzer/analysis/memory_budget.hpp>
+#include <ikos/analyzer/analysis/pointer/context_sensitive.hpp>
 #include <ikos/analyzer/analysis/pointer/pointer.hpp>
+#include <ikos/analyzer/analysis/progress.hpp>
+#include <ikos/analyzer/analysis/sparse_scalar.hpp>
 #include <ikos/analyzer/analysis/value/abstract_domain.hpp>
+#include <ikos/analyzer/analysis/value/check_replay_cache.hpp>
 #include <ikos/analyzer/analysis/value/interprocedural.hpp>
 #include <ikos/analyzer/analysis/value/machine_int_domain.hpp>
 #include <ikos/analyzer/analysis/variable.hpp>
+#include <ikos/analyzer/analysis/wto.hpp>
 #include <ikos/analyzer/checker/checker.hpp>
+#include <ikos/analyzer/checker/query_cache.hpp>
 #include <ikos/analyzer/support/cast.hpp>
+#include <ikos/analyzer/util/concurrency.hpp>
 #include <ikos/analyzer/util/demangle.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
 #include <ikos/analyzer/util/log.hpp>
 #include <ikos/analyzer/util/timer.hpp>
+#include <ikos/analyzer/util/work_stealing.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -104,12 +128,80 @@ bool is_initialized(ar::GlobalVariable* gv, GlobalsInitPolicy policy) {
       // Do not initialize any global variable
       return false;
     }
+    case GlobalsInitPolicy::Lazy: {
+      // Initialize all global variables, the unused ones are filtered out
+      // by used_globals()
+      return true;
+    }
     default: {
       ikos_unreachable("unreachable");
     }
   }
 }
 
+/// \brief Insert the global variables whose address is used by the given
+/// value
+void collect_globals(ar::Value* value,
+                     llvm::DenseSet< ar::GlobalVariable* >& seen,
+                     std::vector< ar::GlobalVariable* >& globals) {
+  if (auto gv = dyn_cast< ar::GlobalVariable >(value)) {
+    if (seen.insert(gv).second) {
+      globals.push_back(gv);
+    }
+  } else if (auto cst = dyn_cast< ar::StructConstant >(value)) {
+    for (auto it = cst->field_begin(), et = cst->field_end(); it != et; ++it) {
+      collect_globals(it->second, seen, globals);
+    }
+  } else if (auto cst = dyn_cast< ar::SequentialConstant >(value)) {
+    for (auto it = cst->element_begin(), et = cst->element_end(); it != et;
+         ++it) {
+      collect_globals(*it, seen, globals);
+    }
+  }
+}
+
+/// \brief Insert the global variables whose address is used in the given code
+void collect_globals(ar::Code* code,
+                     llvm::DenseSet< ar::GlobalVariable* >& seen,
+                     std::vector< ar::GlobalVariable* >& globals) {
+  for (ar::BasicBlock* bb : *code) {
+    for (ar::Statement* stmt : *bb) {
+      for (auto it = stmt->op_begin(), et = stmt->op_end(); it != et; ++it) {
+        collect_globals(*it, seen, globals);
+      }
+    }
+  }
+}
+
+/// \brief Return the global variables that can be accessed by the functions
+/// reachable from the given roots
+///
+/// A global variable is used if its address appears in a reachable function
+/// or in the initializer of a used global variable. The other global
+/// variables can only be accessed through pointers derived from those, hence
+/// they do not need to be initialized.
+llvm::DenseSet< ar::GlobalVariable* > used_globals(
+    const CallGraph& call_graph, const std::vector< ar::Function* >& roots) {
+  llvm::DenseSet< ar::Function* > functions;
+  for (ar::Function* root : roots) {
+    for (ar::Function* fun : call_graph.reachable(root)) {
+      functions.insert(fun);
+    }
+  }
+
+  llvm::DenseSet< ar::GlobalVariable* > seen;
+  std::vector< ar::GlobalVariable* > globals;
+  for (ar::Function* fun : functions) {
+    collect_globals(fun->body(), seen, globals);
+  }
+  for (std::size_t i = 0; i < globals.size(); i++) {
+    if (globals[i]->is_definition()) {
+      collect_globals(globals[i]->initializer(), seen, globals);
+    }
+  }
+  return seen;
+}
+
 /// \brief Call execution engine for global variable initializer
 class GlobalVarCallExecutionEngine final : public CallExecutionEngine {
 public:
@@ -202,11 +294,13 @@ std::vector< std::pair< ar::Function*, MachineInt > > global_dtors(
 
 /// \brief Fixpoint on a global variable initializer
 class GlobalVarInitializerFixpoint final
-    : public core::InterleavedFwdFixpointIterator< ar::Code*, AbstractDomain > {
+    : public core::InterleavedFwdFixpointIterator< const ar::CodeGraph*,
+                                                   AbstractDomain > {
 private:
   /// \brief Parent class
   using FwdFixpointIterator =
-      core::InterleavedFwdFixpointIterator< ar::Code*, AbstractDomain >;
+      core::InterleavedFwdFixpointIterator< const ar::CodeGraph*,
+                                            AbstractDomain >;
 
   /// \brief Numerical execution engine
   using NumericalExecutionEngineT = NumericalExecutionEngine< AbstractDomain >;
@@ -224,7 +318,8 @@ private:
 public:
   /// \brief Constructor
   GlobalVarInitializerFixpoint(Context& ctx, ar::GlobalVariable* gv)
-      : FwdFixpointIterator(gv->initializer()),
+      : FwdFixpointIterator(gv->initializer()->graph(),
+                            ctx.wto_cache->wto(gv->initializer())),
         _gv(gv),
         _ctx(ctx),
         _empty_call_context(ctx.call_context_factory->get_empty()) {}
@@ -300,20 +395,174 @@ public:
 
   /// \brief Return the invariant at the end of the exit node
   const AbstractDomain& exit_invariant() const {
-    ar::Code* code = this->cfg();
+    ar::Code* code = this->cfg()->code();
     ikos_assert_msg(code->has_exit_block(), "initializer without exit block");
     return this->post(code->exit_block());
   }
 
 }; // end class GlobalVarInitializerFixpoint
 
+/// \brief Event of the checks of a function, replayed by each checker
+struct CheckEvent {
+  enum class Kind { EnterBlock, Check, LeaveBlock };
+
+  /// \brief Kind of event
+  Kind kind;
+
+  /// \brief Basic block
+  ar::BasicBlock* bb;
+
+  /// \brief Checked statement, or null
+  ar::Statement* stmt;
+
+  /// \brief Invariant before the statement, or at the entry or exit of the
+  /// basic block
+  AbstractDomain inv;
+};
+
+/// \brief Maximum number of events kept in memory before running the checkers
+constexpr std::size_t CheckBatchSize = 4096;
+
+/// \brief Minimum number of events to run the checkers in parallel
+constexpr std::size_t MinParallelCheckEvents = 64;
+
+/// \brief Return true if one of the checkers inspects the given statement
+bool is_inspected(const std::vector< std::unique_ptr< Checker > >& checkers,
+                  ar::Statement* stmt) {
+  return std::any_of(checkers.begin(),
+                     checkers.end(),
+                     [stmt](const std::unique_ptr< Checker >& checker) {
+                       return checker->inspects(stmt);
+                     });
+}
+
+/// \brief Replay the given events with the given checker
+///
+/// `caches` holds the query cache of each event, shared by all the checkers.
+void replay_check_events(Checker& checker,
+                         CallContext* call_context,
+                         const std::vector< CheckEvent >& events,
+                         std::vector< StatementQueryCache >& caches) {
+  for (std::size_t i = 0; i < events.size(); i++) {
+    const CheckEvent& event = events[i];
+    switch (event.kind) {
+      case CheckEvent::Kind::EnterBlock: {
+        checker.enter(event.bb, event.inv, call_context);
+      } break;
+      case CheckEvent::Kind::Check: {
+        if (checker.inspects(event.stmt)) {
+          StatementQueryScope query_scope(&caches[i]);
+          checker.check(event.stmt, event.inv, call_context);
+        }
+      } break;
+      case CheckEvent::Kind::LeaveBlock: {
+        checker.leave(event.bb, event.inv, call_context);
+      } break;
+      default: {
+        ikos_unreachable("unreachable");
+      }
+    }
+  }
+}
+
+/// \brief Run the checkers on the given events, using `jobs` threads
+///
+/// Each checker replays all the events, in order, as a separate task. The
+/// invariants are only read by the checkers, they are normalized first
+/// because normalization mutates packs shared between copies. The checks are
+/// buffered per checker, then inserted in the order of the checkers by the
+/// calling thread.
+///
+/// The facts queried on a statement (nullity, points-to sets, etc.) are
+/// computed once and shared by all the checkers, see StatementQueryCache.
+void run_checkers_parallel(
+    const std::vector< std::unique_ptr< Checker > >& checkers,
+    unsigned jobs,
+    ChecksTable& checks_table,
+    CallContext* call_context,
+    const std::vector< CheckEvent >& events) {
+  std::vector< StatementQueryCache > caches(events.size());
+  for (std::size_t i = 0; i < events.size(); i++) {
+    if (events[i].kind == CheckEvent::Kind::Check) {
+      caches[i].bind(events[i].inv);
+    }
+  }
+
+  if (events.size() < MinParallelCheckEvents) {
+    for (const auto& checker : checkers) {
+      replay_check_events(*checker, call_context, events, caches);
+    }
+    return;
+  }
+
+  for (const CheckEvent& event : events) {
+    event.inv.normal().normalize();
+    event.inv.caught_exceptions().normalize();
+    event.inv.propagated_exceptions().normalize();
+  }
+
+  std::vector< CheckBuffer > buffers(checkers.size());
+  std::vector< std::exception_ptr > errors(checkers.size());
+
+  std::vector< WorkStealingPool::Task > tasks;
+  tasks.reserve(checkers.size());
+  for (std::size_t i = 0; i < checkers.size(); i++) {
+    tasks.emplace_back([&, i]() {
+      ChecksTable::set_thread_buffer(&buffers[i]);
+      try {
+        replay_check_events(*checkers[i], call_context, events, caches);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+      ChecksTable::set_thread_buffer(nullptr);
+    });
+  }
+
+  {
+    // Enable locking in the factories
+    ConcurrentScope concurrent_scope;
+
+    WorkStealingPool pool(static_cast< unsigned >(
+        std::min(static_cast< std::size_t >(jobs), checkers.size())));
+    pool.start(std::move(tasks));
+    pool.join();
+  }
+
+  for (const std::exception_ptr& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  for (CheckBuffer& buffer : buffers) {
+    buffer.flush(checks_table);
+  }
+}
+
+/// \brief Return the number of threads used to run the checkers
+unsigned check_jobs(const AnalysisOptions& opts) {
+  if (opts.display_invariants != DisplayOption::None ||
+      opts.display_checks != DisplayOption::None) {
+    return 1;
+  }
+  return opts.check_jobs;
+}
+
+/// \brief Return the size of an invariant, in number of memory cells
+std::size_t invariant_size(const AbstractDomain& inv) {
+  return inv.normal().num_cells() + inv.caught_exceptions().num_cells() +
+         inv.propagated_exceptions().num_cells();
+}
+
 /// \brief Fixpoint on a function body
 class FunctionFixpoint final
-    : public core::InterleavedFwdFixpointIterator< ar::Code*, AbstractDomain > {
+    : public core::InterleavedFwdFixpointIterator< const ar::CodeGraph*,
+                                                   AbstractDomain > {
 private:
   /// \brief Parent class
   using FwdFixpointIterator =
-      core::InterleavedFwdFixpointIterator< ar::Code*, AbstractDomain >;
+      core::InterleavedFwdFixpointIterator< const ar::CodeGraph*,
+                                            AbstractDomain >;
 
   /// \brief Numerical execution engine
   using NumericalExecutionEngineT = NumericalExecutionEngine< AbstractDomain >;
@@ -322,6 +571,10 @@ private:
   using InlineCallExecutionEngineT =
       InlineCallExecutionEngine< FunctionFixpoint, AbstractDomain >;
 
+public:
+  /// \brief Cache of callee summaries
+  using CalleeSummaryCacheT = CalleeSummaryCache< AbstractDomain >;
+
 private:
   /// \brief Analyzed function
   ar::Function* _function;
@@ -335,38 +588,131 @@ private:
   /// \brief Fixpoint profile
   boost::optional< const FixpointProfile& > _profile;
 
-  /// \brief Function currently analyzed
-  ///
-  /// This is used to avoid cycles.
-  std::vector< ar::Function* > _analyzed_functions;
+  /// \brief Number of increasing iterations performed with a join
+  unsigned _widening_delay;
+
+  /// \brief Maximum number of decreasing iterations, or 0 for no limit
+  unsigned _narrowing_iterations;
+
+  /// \brief Head of the cycle whose narrowing reached the iterations limit,
+  /// or null
+  ar::BasicBlock* _narrowing_capped_head = nullptr;
+
+  /// \brief True to start the cycles from the previous fixpoint on the callee
+  bool _warm_start_cycles;
+
+  /// \brief True to forget the unreachable memory locations at cycle heads
+  bool _gc_loop_heads;
+
+  /// \brief Invariants at the cycle heads of the previous fixpoint, or null
+  std::shared_ptr< const CalleeSummaryCacheT::CycleSeeds > _cycle_seeds;
+
+  /// \brief Cycle heads entered during the current fixpoint computation
+  std::vector< ar::BasicBlock* > _cycle_heads;
 
   /// \brief List of property checks to run
   const std::vector< std::unique_ptr< Checker > >& _checkers;
 
+  /// \brief Cache of callee summaries
+  CalleeSummaryCacheT& _summary_cache;
+
+  /// \brief Cache of the checks of the callees
+  CheckReplayCache& _replay_cache;
+
+  /// \brief Entry invariant of a callee, kept to reuse its checks
+  boost::optional< AbstractDomain > _entry_inv;
+
+  /// \brief Call graph, or null
+  const CallGraph* _call_graph;
+
+  /// \brief Context-sensitive pointer analysis, or null
+  ContextSensitivePointerAnalysis* _context_pointer;
+
+  /// \brief Pointer information for the current call context, or null
+  std::shared_ptr< const PointerInfo > _context_pointer_info;
+
+  /// \brief Checks table of the output database
+  ChecksTable& _checks_table;
+
+  /// \brief Number of threads used to run the checkers
+  ///
+  /// The checkers are run sequentially when they display invariants or
+  /// checks, to keep the output readable.
+  unsigned _check_jobs;
+
   /// \brief Numerical execution engine
   NumericalExecutionEngineT _exec_engine;
 
   /// \brief Call execution engine
   InlineCallExecutionEngineT _call_exec_engine;
 
+  /// \brief Caller fixpoint, or null for an entry point
+  const FunctionFixpoint* _caller;
+
+  /// \brief Function profiler, or null
+  FunctionProfiler* _profiler;
+
+  /// \brief Statistics of the current fixpoint computation
+  FunctionProfile _stats;
+
+  /// \brief Time spent in the callees during the current fixpoint computation
+  ///
+  /// This is updated by the callee fixpoints.
+  mutable Timer::Duration _callees_time{0};
+
+  /// \brief Live progress reporter, or null
+  ProgressReporter* _progress;
+
+  /// \brief Memory budget, or null
+  MemoryBudget* _memory_budget;
+
+  /// \brief Budget of the fixpoint computation
+  FunctionBudget _budget;
+
+  /// \brief True if the budget is checked
+  ///
+  /// Only the callees have a budget, an entry point has no caller to fall
+  /// back on.
+  bool _check_budget;
+
+  /// \brief Fixpoint tracer, or null
+  std::unique_ptr< FunctionFixpointTracer > _tracer;
+
+  /// \brief Values of the sparse scalars, or null
+  std::unique_ptr< SparseScalarValues > _sparse_scalars;
+
 public:
   /// \brief Constructor for an entry point
   ///
   /// \param ctx Analysis context
   /// \param checkers List of checkers to run
+  /// \param summary_cache Cache of callee summaries
+  /// \param replay_cache Cache of the checks of the callees
   /// \param entry_point Function to analyze
   FunctionFixpoint(Context& ctx,
                    const std::vector< std::unique_ptr< Checker > >& checkers,
+                   CalleeSummaryCacheT& summary_cache,
+                   CheckReplayCache& replay_cache,
                    ar::Function* entry_point)
-      : FwdFixpointIterator(entry_point->body()),
+      : FwdFixpointIterator(entry_point->body()->graph(),
+                            ctx.wto_cache->wto(entry_point->body())),
         _function(entry_point),
         _call_context(ctx.call_context_factory->get_empty()),
         _machine_int_domain(ctx.opts.machine_int_domain),
         _profile(ctx.fixpoint_profiler == nullptr
                      ? boost::none
                      : ctx.fixpoint_profiler->profile(entry_point)),
-        _analyzed_functions{entry_point},
+        _widening_delay(ctx.opts.widening_delay),
+        _narrowing_iterations(ctx.opts.narrowing_iterations),
+        _warm_start_cycles(ctx.opts.warm_start_cycles),
+        _gc_loop_heads(ctx.opts.gc_loop_heads),
         _checkers(checkers),
+        _summary_cache(summary_cache),
+        _replay_cache(replay_cache),
+        _call_graph(ctx.call_graph),
+        _context_pointer(ctx.context_pointer),
+        _checks_table(ctx.output_db->checks),
+        _check_jobs(check_jobs(ctx.opts)),
         _exec_engine(AbstractDomain::bottom(),
                      ctx,
                      this->_call_context,
@@ -379,30 +725,48 @@ public:
                           _exec_engine,
                           *this,
                           /* context_stable = */ true,
-                          /* convergence_achieved = */ false) {}
+                          /* convergence_achieved = */ false),
+        _caller(nullptr),
+        _profiler(ctx.function_profiler),
+        _progress(ctx.progress),
+        _memory_budget(ctx.memory_budget),
+        _budget(ctx.opts),
+        _check_budget(false) {
+    this->init_tracer(ctx);
+    this->init_sparse_scalars(ctx);
+  }
 
   /// \brief Constructor for a callee
   ///
   /// \param ctx Analysis context
   /// \param caller Parent function fixpoint
-  /// \param call Call statement
+  /// \param call_context Call context of the callee
   /// \param callee Called function
   /// \param context_stable Is the calling context stable (fixpoint reached)?
   FunctionFixpoint(Context& ctx,
                    const FunctionFixpoint& caller,
-                   ar::CallBase* call,
+                   CallContext* call_context,
                    ar::Function* callee,
                    bool context_stable)
-      : FwdFixpointIterator(callee->body()),
+      : FwdFixpointIterator(callee->body()->graph(),
+                            ctx.wto_cache->wto(callee->body())),
         _function(callee),
-        _call_context(
-            ctx.call_context_factory->get_context(caller._call_context, call)),
+        _call_context(call_context),
         _machine_int_domain(ctx.opts.machine_int_domain),
         _profile(ctx.fixpoint_profiler == nullptr
                      ? boost::none
                      : ctx.fixpoint_profiler->profile(callee)),
-        _analyzed_functions(caller._analyzed_functions),
+        _widening_delay(ctx.opts.widening_delay),
+        _narrowing_iterations(ctx.opts.narrowing_iterations),
+        _warm_start_cycles(ctx.opts.warm_start_cycles),
+        _gc_loop_heads(ctx.opts.gc_loop_heads),
         _checkers(caller._checkers),
+        _summary_cache(caller._summary_cache),
+        _replay_cache(caller._replay_cache),
+        _call_graph(caller._call_graph),
+        _context_pointer(caller._context_pointer),
+        _checks_table(caller._checks_table),
+        _check_jobs(caller._check_jobs),
         _exec_engine(AbstractDomain::bottom(),
                      ctx,
                      this->_call_context,
@@ -415,14 +779,128 @@ public:
                           _exec_engine,
                           *this,
                           /* context_stable = */ context_stable,
-                          /* convergence_achieved = */ false) {
-    this->_analyzed_functions.push_back(callee);
+                          /* convergence_achieved = */ false),
+        _caller(&caller),
+        _profiler(ctx.function_profiler),
+        _progress(ctx.progress),
+        _memory_budget(ctx.memory_budget),
+        _budget(ctx.opts),
+        _check_budget(_budget.enabled()) {
+    this->init_tracer(ctx);
+    this->init_sparse_scalars(ctx);
   }
 
+private:
+  /// \brief Set up the fixpoint tracer, if a trace is requested
+  void init_tracer(Context& ctx) {
+    if (ctx.fixpoint_trace != nullptr) {
+      this->_tracer =
+          std::make_unique< FunctionFixpointTracer >(*ctx.fixpoint_trace,
+                                                     this->_function);
+      this->set_tracer(this->_tracer.get());
+    }
+  }
+
+  /// \brief Set up the values of the sparse scalars, if there are any
+  void init_sparse_scalars(Context& ctx) {
+    if (ctx.sparse_scalars == nullptr) {
+      return;
+    }
+    const SparseScalarAnalysis::CodeInfo* info =
+        ctx.sparse_scalars->code_info(this->_function->body());
+    if (info != nullptr) {
+      this->_sparse_scalars = std::make_unique< SparseScalarValues >(*info);
+      this->_exec_engine.set_sparse_scalars(this->_sparse_scalars.get());
+    }
+  }
+
+public:
+
   /// \brief Compute the fixpoint
   void run(AbstractDomain inv) {
-    FwdFixpointIterator::run(std::move(inv));
+    ProgressFrame progress_frame(this->_progress, this->_function);
+    Timer timer;
+    uint64_t gmp_allocations = 0;
+    if (this->_profiler != nullptr) {
+      this->_stats = FunctionProfile{};
+      this->_callees_time = Timer::Duration(0);
+      gmp_allocations = core::gmp_allocation_count();
+      timer.start();
+    }
+    if (this->_check_budget) {
+      this->_budget.start();
+    }
+    if (this->_caller != nullptr && this->_replay_cache.enabled()) {
+      this->_entry_inv = inv;
+    }
+
+    if (this->_context_pointer != nullptr && !this->_call_context->empty()) {
+      // Refine the pointer information with the parameters of the callee
+      this->_context_pointer_info =
+          this->_context_pointer->results(this->_call_context,
+                                          this->_function,
+                                          inv);
+      this->_exec_engine.set_pointer_info(
+          this->_context_pointer_info != nullptr
+              ? this->_context_pointer_info.get()
+              : &this->_context_pointer->context_insensitive_results());
+    }
+    boost::optional< AbstractDomain > seeds_entry;
+    if (this->_warm_start_cycles && this->_caller != nullptr) {
+      this->_cycle_seeds =
+          this->_summary_cache.find_cycle_seeds(this->_function, inv);
+      this->_cycle_heads.clear();
+      seeds_entry = inv;
+    }
+    {
+      FunctionTraceScope trace_scope(this->_tracer.get());
+      FwdFixpointIterator::run(std::move(inv));
+    }
     this->_call_exec_engine.mark_convergence_achieved();
+
+    if (seeds_entry) {
+      // Keep the invariants at the cycle heads for the next fixpoint
+      using CycleSeeds = CalleeSummaryCacheT::CycleSeeds;
+      auto seeds = std::make_shared< CycleSeeds >(
+          CycleSeeds{std::move(*seeds_entry), {}});
+      for (ar::BasicBlock* head : this->_cycle_heads) {
+        seeds->heads.try_emplace(head, this->pre(head));
+      }
+      this->_summary_cache.insert_cycle_seeds(this->_function,
+                                              std::move(seeds));
+      this->_cycle_seeds = nullptr;
+      this->_cycle_heads.clear();
+    }
+
+    if (this->_profiler != nullptr) {
+      timer.stop();
+      this->_stats.gmp_allocations =
+          core::gmp_allocation_count() - gmp_allocations;
+      this->record_profile(timer.elapsed());
+    }
+  }
+
+  /// \brief Return the abstract value at the head of a cycle for its first
+  /// iteration
+  ///
+  /// With -warm-start-cycles, this is joined with the invariant at the cycle
+  /// head from the previous fixpoint on the callee.
+  AbstractDomain initial_cycle_value(ar::BasicBlock* head,
+                                     AbstractDomain pre) override {
+    if (!this->_warm_start_cycles || this->_caller == nullptr) {
+      return pre;
+    }
+    if (std::find(this->_cycle_heads.begin(), this->_cycle_heads.end(), head) ==
+        this->_cycle_heads.end()) {
+      this->_cycle_heads.push_back(head);
+    }
+    if (this->_cycle_seeds != nullptr && !pre.is_normal_flow_bottom()) {
+      auto it = this->_cycle_seeds->heads.find(head);
+      if (it != this->_cycle_seeds->heads.end()) {
+        pre.join_with(it->second);
+      }
+    }
+    return pre;
   }
 
   /// \brief Extrapolate the new state after an increasing iteration
@@ -430,25 +908,76 @@ public:
                              unsigned iteration,
                              AbstractDomain before,
                              AbstractDomain after) override {
-    if (iteration <= 1) {
+    if (this->_progress != nullptr) {
+      this->_progress->set_cycle(head, iteration, /* increasing = */ true);
+    }
+    if (this->_memory_budget != nullptr) {
+      this->_memory_budget->check(this->_function);
+    }
+    if (this->_gc_loop_heads) {
+      this->_exec_engine.set_inv(std::move(after));
+      this->_exec_engine.collect_unreachable_memory();
+      after = std::move(this->_exec_engine.inv());
+    }
+    if (iteration <= this->_widening_delay) {
       before.join_iter_with(after);
+      this->update_peak_invariant_size(before);
+      this->check_invariant_budget(before);
       return before;
     }
-    if (iteration == 2 && this->_profile) {
-      if (auto threshold = this->_profile->widening_hint(head)) {
-        before.widen_threshold_with(after, *threshold);
-        return before;
-      }
+    this->_stats.widenings++;
+    if (this->_profile) {
+      before.widen_threshold_with(after,
+                                  this->_profile->widening_thresholds());
+      this->update_peak_invariant_size(before);
+      this->check_invariant_budget(before);
+      return before;
     }
     before.widen_with(after);
+    this->update_peak_invariant_size(before);
+    this->check_invariant_budget(before);
     return before;
   }
 
+  /// \brief Refine the new state after a decreasing iteration
+  AbstractDomain refine(ar::BasicBlock* head,
+                        unsigned iteration,
+                        AbstractDomain before,
+                        AbstractDomain after) override {
+    this->_stats.narrowings++;
+    if (this->_progress != nullptr) {
+      this->_progress->set_cycle(head, iteration, /* increasing = */ false);
+    }
+    if (this->_narrowing_iterations > 0 &&
+        iteration >= this->_narrowing_iterations) {
+      this->_narrowing_capped_head = head;
+    }
+    return FwdFixpointIterator::refine(head,
+                                       iteration,
+                                       std::move(before),
+                                       std::move(after));
+  }
+
   /// \brief Check if the decreasing iterations fixpoint is reached
   bool is_decreasing_iterations_fixpoint(const AbstractDomain& before,
                                          const AbstractDomain& after) override {
     if (machine_int_domain_option_has_narrowing(this->_machine_int_domain)) {
-      return before.leq(after);
+      ar::BasicBlock* capped_head = this->_narrowing_capped_head;
+      this->_narrowing_capped_head = nullptr;
+      if (before.leq(after)) {
+        return true;
+      } else if (capped_head != nullptr) {
+        // Stop the narrowing, the current invariant is still sound
+        if (std::find(this->_stats.narrowing_capped_loops.begin(),
+                      this->_stats.narrowing_capped_loops.end(),
+                      capped_head) ==
+            this->_stats.narrowing_capped_loops.end()) {
+          this->_stats.narrowing_capped_loops.push_back(capped_head);
+        }
+        return true;
+      } else {
+        return false;
+      }
     } else {
       return true; // stop after the first decreasing iteration
     }
@@ -456,6 +985,10 @@ public:
 
   /// \brief Propagate the invariant through the basic block
   AbstractDomain analyze_node(ar::BasicBlock* bb, AbstractDomain pre) override {
+    this->_stats.iterations++;
+    if (this->_check_budget) {
+      this->_budget.check_iteration(this->_function);
+    }
     this->_exec_engine.set_inv(std::move(pre));
     this->_exec_engine.exec_enter(bb);
     for (ar::Statement* stmt : *bb) {
@@ -481,17 +1014,65 @@ public:
   /// \brief Process the computed abstract value for a node
   void process_post(ar::BasicBlock* bb, const AbstractDomain& post) override {
     if (this->_function->body()->exit_block_or_null() == bb) {
+      this->update_peak_invariant_size(post);
       this->_exec_engine.set_inv(post);
       this->_call_exec_engine.exec_exit(this->_function);
     }
   }
 
   /// \brief Run the checks with the previously computed fix-point
+  ///
+  /// The checks of a callee, including the checks of its own callees, are
+  /// reused if it was already checked with an equal entry invariant in
+  /// another calling context (see CheckReplayCache).
   void run_checks() {
+    std::size_t replay_begin = 0;
+    if (this->_entry_inv) {
+      if (this->_replay_cache.replay(this->_function,
+                                     this->_call_context,
+                                     *this->_entry_inv)) {
+        this->_entry_inv = boost::none;
+        this->clear();
+        this->_call_exec_engine.clear();
+        return;
+      }
+      replay_begin = this->_replay_cache.start_recording();
+    }
+
+    if (this->_check_jobs > 1 && this->_checkers.size() > 1) {
+      this->run_checks_parallel();
+    } else {
+      this->run_checks_sequential();
+    }
+
+    // Clear the invariants
+    this->clear();
+
+    // Run the checks on the callees
+    this->_call_exec_engine.run_checks();
+
+    // Clear the list of callees
+    this->_call_exec_engine.clear();
+
+    if (this->_entry_inv) {
+      this->_replay_cache.stop_recording(this->_function,
+                                         this->_call_context,
+                                         std::move(*this->_entry_inv),
+                                         replay_begin);
+      this->_entry_inv = boost::none;
+    }
+  }
+
+private:
+  /// \brief Run the checkers one after the other, on each statement
+  void run_checks_sequential() {
     for (const auto& checker : this->_checkers) {
       checker->enter(this->_function, this->_call_context);
     }
 
+    // Facts queried on a statement, shared by the checkers
+    StatementQueryCache query_cache;
+
     // Check the function body
     for (ar::BasicBlock* bb : *this->cfg()) {
       this->_exec_engine.set_inv(this->pre(bb));
@@ -503,8 +1084,14 @@ public:
       for (ar::Statement* stmt : *bb) {
         // Check the statement if it's related to an llvm instruction
         if (stmt->has_frontend()) {
+          query_cache.bind(this->_exec_engine.inv());
+          StatementQueryScope query_scope(&query_cache);
           for (const auto& checker : this->_checkers) {
-            checker->check(stmt, this->_exec_engine.inv(), this->_call_context);
+            if (checker->inspects(stmt)) {
+              checker->check(stmt,
+                             this->_exec_engine.inv(),
+                             this->_call_context);
+            }
           }
         }
 
@@ -521,17 +1108,69 @@ public:
     for (const auto& checker : this->_checkers) {
       checker->leave(this->_function, this->_call_context);
     }
+  }
 
-    // Clear the invariants
-    this->clear();
+  /// \brief Run the checkers in parallel (see run_checkers_parallel())
+  ///
+  /// The statements are replayed once, keeping the invariant before each
+  /// check, by batches of CheckBatchSize events.
+  void run_checks_parallel() {
+    for (const auto& checker : this->_checkers) {
+      checker->enter(this->_function, this->_call_context);
+    }
 
-    // Run the checks on the callees
-    this->_call_exec_engine.run_checks();
+    std::vector< CheckEvent > events;
+    for (ar::BasicBlock* bb : *this->cfg()) {
+      this->_exec_engine.set_inv(this->pre(bb));
+      this->_exec_engine.exec_enter(bb);
+      events.push_back(CheckEvent{CheckEvent::Kind::EnterBlock,
+                                  bb,
+                                  nullptr,
+                                  this->_exec_engine.inv()});
 
-    // Clear the list of callees
-    this->_call_exec_engine.clear();
+      for (ar::Statement* stmt : *bb) {
+        // Check the statement if it's related to an llvm instruction, and
+        // if a checker inspects it
+        if (stmt->has_frontend() && is_inspected(this->_checkers, stmt)) {
+          events.push_back(CheckEvent{CheckEvent::Kind::Check,
+                                      bb,
+                                      stmt,
+                                      this->_exec_engine.inv()});
+        }
+
+        // Propagate
+        transfer_function(this->_exec_engine, this->_call_exec_engine, stmt);
+      }
+
+      events.push_back(CheckEvent{CheckEvent::Kind::LeaveBlock,
+                                  bb,
+                                  nullptr,
+                                  this->_exec_engine.inv()});
+      this->_exec_engine.exec_leave(bb);
+
+      if (events.size() >= CheckBatchSize) {
+        run_checkers_parallel(this->_checkers,
+                              this->_check_jobs,
+                              this->_checks_table,
+                              this->_call_context,
+                              events);
+        events.clear();
+      }
+    }
+
+    run_checkers_parallel(this->_checkers,
+                          this->_check_jobs,
+                          this->_checks_table,
+                          this->_call_context,
+                          events);
+
+    for (const auto& checker : this->_checkers) {
+      checker->leave(this->_function, this->_call_context);
+    }
   }
 
+public:
+
   /// \name Helpers for InlineCallExecutionEngine
   /// @{
 
@@ -543,11 +1182,28 @@ public:
     return this->_call_exec_engine;
   }
 
+  /// \brief Return the current call context
+  CallContext* call_context() const { return this->_call_context; }
+
+  /// \brief Return the cache of callee summaries
+  CalleeSummaryCacheT& summary_cache() const { return this->_summary_cache; }
+
   /// \brief Return true if the given function is currently analyzed
+  ///
+  /// This is used to avoid cycles. Only the callers in the strongly connected
+  /// component of the given function can be the given function, and they are
+  /// at the top of the call stack.
   bool is_currently_analyzed(ar::Function* fun) const {
-    return std::find(this->_analyzed_functions.begin(),
-                     this->_analyzed_functions.end(),
-                     fun) != this->_analyzed_functions.end();
+    for (const FunctionFixpoint* it = this; it != nullptr; it = it->_caller) {
+      if (it->_function == fun) {
+        return true;
+      }
+      if (this->_call_graph != nullptr &&
+          !this->_call_graph->same_scc(it->_function, fun)) {
+        return false;
+      }
+    }
+    return false;
   }
 
   /// @}
@@ -557,17 +1213,65 @@ public:
     return this->_call_exec_engine.exit_invariant();
   }
 
+private:
+  /// \brief Check the size of an invariant at a cycle head, if the fixpoint
+  /// computation has a budget
+  void check_invariant_budget(const AbstractDomain& inv) const {
+    if (this->_check_budget) {
+      this->_budget.check_invariant_size(this->_function, invariant_size(inv));
+    }
+  }
+
+  /// \brief Update the peak invariant size, if profiling
+  void update_peak_invariant_size(const AbstractDomain& inv) {
+    if (this->_profiler == nullptr) {
+      return;
+    }
+
+    this->_stats.peak_invariant_size =
+        std::max(this->_stats.peak_invariant_size, invariant_size(inv));
+
+    std::size_t bytes = inv.size_in_bytes();
+    if (bytes > this->_stats.peak_invariant_bytes) {
+      std::size_t integer_bytes = 0;
+      std::size_t pointer_bytes = 0;
+      for (const MemoryAbstractDomain* mem : {&inv.normal(),
+                                              &inv.caught_exceptions(),
+                                              &inv.propagated_exceptions()}) {
+        std::size_t n = mem->integers().size_in_bytes();
+        integer_bytes += n;
+        pointer_bytes += mem->pointers().size_in_bytes() - n;
+      }
+      this->_stats.peak_invariant_bytes = bytes;
+      this->_stats.peak_integer_bytes = integer_bytes;
+      this->_stats.peak_pointer_bytes = pointer_bytes;
+    }
+  }
+
+  /// \brief Record the statistics of the fixpoint computation
+  void record_profile(Timer::Duration elapsed) {
+    this->_stats.runs = 1;
+    this->_stats.inclusive_time = elapsed;
+    this->_stats.exclusive_time = elapsed - this->_callees_time;
+    if (this->_caller != nullptr) {
+      this->_caller->_callees_time += elapsed;
+    }
+    this->_profiler->record(this->_function, this->_call_context, this->_stats);
+  }
+
 }; // end class FunctionFixpoint
 
 /// \brief Return the initial invariant
-AbstractDomain init_invariant(MachineIntDomainOption machine_int_domain) {
+AbstractDomain init_invariant(const AnalysisOptions& opts) {
   return AbstractDomain(
       /*normal=*/
       MemoryAbstractDomain(PointerAbstractDomain(make_top_machine_int_domain(
-                                                     machine_int_domain),
+                                                     opts.machine_int_domain),
                                                  NullityAbstractDomain::top()),
                            UninitializedAbstractDomain::top(),
-                           LifetimeAbstractDomain::top()),
+                           LifetimeAbstractDomain::top(),
+                           opts.smash_threshold,
+                           opts.array_segments),
       /*caught_exceptions=*/MemoryAbstractDomain::bottom(),
       /*propagated_exceptions=*/MemoryAbstractDomain::bottom());
 }
@@ -630,6 +1334,514 @@ AbstractDomain init_main_invariant(Context& ctx,
   return inv;
 }
 
+/// \brief Return the initial invariant of the given entry point
+value::AbstractDomain entry_point_invariant(
+    Context& ctx,
+    ar::Function* entry_point,
+    const value::AbstractDomain& init_inv) {
+  value::AbstractDomain entry_inv = value::AbstractDomain::bottom();
+
+  if (std::find(ctx.opts.no_init_globals.begin(),
+                ctx.opts.no_init_globals.end(),
+                entry_point) == ctx.opts.no_init_globals.end()) {
+    // Use invariant with initialized global variables
+    entry_inv = init_inv;
+  } else {
+    // Default invariant
+    entry_inv = init_invariant(ctx.opts);
+  }
+
+  if (entry_point->name() == "main" && entry_point->num_parameters() >= 2) {
+    entry_inv = init_main_invariant(ctx, entry_point, entry_inv);
+  }
+
+  return entry_inv;
+}
+
+/// \brief Analysis of one function, run by a worker thread
+struct FunctionTask {
+  /// \brief Analyzed function
+  ar::Function* function;
+
+  /// \brief Initial invariant
+  value::AbstractDomain entry_inv;
+
+  /// \brief Cache of callee summaries, private to the task
+  FunctionFixpoint::CalleeSummaryCacheT summary_cache;
+
+  /// \brief Fixpoint, available once the task is done
+  std::unique_ptr< FunctionFixpoint > fixpoint;
+
+  /// \brief Time spent computing the fixpoint
+  Timer::Duration elapsed;
+
+  /// \brief Exception thrown by the worker, if any
+  std::exception_ptr error;
+
+  /// \brief True when the worker is done with the task
+  bool done = false;
+
+  FunctionTask(ar::Function* function_, value::AbstractDomain entry_inv_)
+      : function(function_), entry_inv(std::move(entry_inv_)) {}
+};
+
+/// \brief Return the number of statements of the functions reachable from the
+/// given function, or 0 if the call graph is not available
+std::size_t call_tree_size(Context& ctx, ar::Function* function) {
+  if (ctx.call_graph == nullptr) {
+    return 0;
+  }
+  std::size_t n = 0;
+  for (ar::Function* fun : ctx.call_graph->reachable(function)) {
+    for (ar::BasicBlock* bb : *fun->body()) {
+      n += bb->num_statements();
+    }
+  }
+  return n;
+}
+
+/// \brief Analyze the functions of the given tasks using `ctx.opts.jobs`
+/// threads
+///
+/// Fixpoints are computed in parallel, but checks are run on the calling
+/// thread, in the order of the tasks, so that the output database is the same
+/// as in a sequential analysis. `process` is called on each task once its
+/// checks are run, before its fixpoint is released. `kind` describes the
+/// functions in the logs, e.g. "entry point".
+///
+/// Functions with the largest call trees are analyzed first, so that a long
+/// analysis does not start last.
+template < typename Process >
+void analyze_functions_parallel(
+    Context& ctx,
+    const std::vector< std::unique_ptr< Checker > >& checkers,
+    FunctionFixpoint::CalleeSummaryCacheT& summary_cache,
+    CheckReplayCache& replay_cache,
+    std::vector< std::unique_ptr< FunctionTask > >& tasks,
+    const std::string& kind,
+    Process process) {
+  // Initial invariants are normalized here because normalization mutates
+  // packs shared between copies.
+  for (const std::unique_ptr< FunctionTask >& task : tasks) {
+    const value::AbstractDomain& inv = task->entry_inv;
+    inv.normal().normalize();
+    inv.caught_exceptions().normalize();
+    inv.propagated_exceptions().normalize();
+  }
+
+  // Largest call trees first
+  std::vector< std::pair< std::size_t, std::size_t > > schedule;
+  schedule.reserve(tasks.size());
+  for (std::size_t i = 0; i < tasks.size(); i++) {
+    schedule.emplace_back(call_tree_size(ctx, tasks[i]->function), i);
+  }
+  std::stable_sort(schedule.begin(),
+                   schedule.end(),
+                   [](const auto& a, const auto& b) {
+                     return a.first > b.first;
+                   });
+
+  // Enable locking in the factories
+  ConcurrentScope concurrent_scope;
+
+  std::atomic< std::size_t > next_task(0);
+  std::atomic< bool > stop(false);
+  std::mutex mutex;
+  std::condition_variable task_done;
+
+  auto worker = [&]() {
+    while (!stop.load()) {
+      std::size_t i = next_task.fetch_add(1);
+      if (i >= tasks.size()) {
+        return;
+      }
+
+      FunctionTask& task = *tasks[schedule[i].second];
+      try {
+        log::info("Analyzing " + kind + ": " + demangle(task.function));
+        auto fixpoint = std::make_unique< FunctionFixpoint >(ctx,
+                                                             checkers,
+                                                             task.summary_cache,
+                                                             replay_cache,
+                                                             task.function);
+        Timer timer;
+        timer.start();
+        fixpoint->run(task.entry_inv);
+        timer.stop();
+        task.elapsed = timer.elapsed();
+        task.fixpoint = std::move(fixpoint);
+      } catch (...) {
+        task.error = std::current_exception();
+      }
+
+      {
+        std::lock_guard< std::mutex > lock(mutex);
+        task.done = true;
+      }
+      task_done.notify_all();
+    }
+  };
+
+  std::vector< std::thread > threads;
+  std::size_t num_threads =
+      std::min(static_cast< std::size_t >(ctx.opts.jobs), tasks.size());
+  threads.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; i++) {
+    threads.emplace_back(worker);
+  }
+
+  auto join_all = [&]() {
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  };
+
+  try {
+    for (std::unique_ptr< FunctionTask >& task : tasks) {
+      {
+        std::unique_lock< std::mutex > lock(mutex);
+        task_done.wait(lock, [&]() { return task->done; });
+      }
+
+      if (task->error) {
+        std::rethrow_exception(task->error);
+      }
+
+      ctx.output_db->times.insert("ikos-analyzer.value." +
+                                      task->function->name(),
+                                  task->elapsed.count());
+
+      {
+        log::info("Checking properties and writing results for " + kind +
+                  ": " + demangle(task->function));
+        ScopeTimerDatabase t(ctx.output_db->times,
+                             "ikos-analyzer.check." + task->function->name());
+        task->fixpoint->run_checks();
+      }
+
+      process(*task);
+
+      summary_cache.merge_statistics(task->summary_cache);
+      task->fixpoint.reset();
+    }
+  } catch (...) {
+    stop.store(true);
+    join_all();
+    throw;
+  }
+
+  join_all();
+}
+
+/// \brief Analyze the given entry points using `ctx.opts.jobs` threads
+void analyze_entry_points_parallel(
+    Context& ctx,
+    const std::vector< std::unique_ptr< Checker > >& checkers,
+    FunctionFixpoint::CalleeSummaryCacheT& summary_cache,
+    CheckReplayCache& replay_cache,
+    const std::vector< ar::Function* >& entry_points,
+    const value::AbstractDomain& init_inv) {
+  // Initial invariants are computed on the main thread
+  std::vector< std::unique_ptr< FunctionTask > > tasks;
+  tasks.reserve(entry_points.size());
+  for (ar::Function* entry_point : entry_points) {
+    tasks.emplace_back(std::make_unique< FunctionTask >(
+        entry_point, entry_point_invariant(ctx, entry_point, init_inv)));
+  }
+
+  analyze_functions_parallel(ctx,
+                             checkers,
+                             summary_cache,
+                             replay_cache,
+                             tasks,
+                             "entry point",
+                             [&ctx](FunctionTask& task) {
+                               if (ctx.checkpoint != nullptr) {
+                                 ctx.checkpoint->save(*ctx.output_db,
+                                                      task.function);
+                               }
+                             });
+}
+
+/// \brief Initialize the given global variables, starting from `inv`
+value::AbstractDomain initialize_globals(
+    Context& ctx,
+    const std::vector< ar::GlobalVariable* >& globals,
+    value::AbstractDomain inv) {
+  for (ar::GlobalVariable* gv : globals) {
+    log::debug("Initializing global variable @" + gv->name());
+    GlobalVarInitializerFixpoint fixpoint(ctx, gv);
+    fixpoint.run(std::move(inv));
+    inv = fixpoint.exit_invariant();
+  }
+  return inv;
+}
+
+/// \brief Initialize the given global variables using `ctx.opts.jobs`
+/// threads, starting from `inv`
+///
+/// An initializer only writes the memory of its own global variable, and only
+/// takes the address of other global variables. Initializers are thus
+/// independent: each thread initializes a slice of the global variables from
+/// `inv`, and the results are combined with a meet.
+value::AbstractDomain initialize_globals_parallel(
+    Context& ctx,
+    const std::vector< ar::GlobalVariable* >& globals,
+    value::AbstractDomain inv) {
+  {
+    // Normalization mutates packs shared between copies
+    const value::AbstractDomain& shared = inv;
+    shared.normal().normalize();
+    shared.caught_exceptions().normalize();
+    shared.propagated_exceptions().normalize();
+  }
+
+  std::size_t num_threads =
+      std::min(static_cast< std::size_t >(ctx.opts.jobs), globals.size());
+  std::vector< value::AbstractDomain > results(num_threads, inv);
+  std::vector< std::exception_ptr > errors(num_threads);
+
+  {
+    // Enable locking in the factories
+    ConcurrentScope concurrent_scope;
+
+    std::vector< std::thread > threads;
+    threads.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; i++) {
+      threads.emplace_back([&, i]() {
+        // Contiguous slice, to keep the order of the bundle in each thread
+        std::size_t begin = globals.size() * i / num_threads;
+        std::size_t end = globals.size() * (i + 1) / num_threads;
+        try {
+          results[i] = initialize_globals(
+              ctx,
+              std::vector< ar::GlobalVariable* >(globals.begin() + begin,
+                                                 globals.begin() + end),
+              std::move(results[i]));
+        } catch (...) {
+          errors[i] = std::current_exception();
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+  for (const std::exception_ptr& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  for (std::size_t i = 1; i < num_threads; i++) {
+    results[0].meet_with(results[i]);
+  }
+  return std::move(results[0]);
+}
+
+/// \brief Analyze the given global constructor, starting from `inv`
+///
+/// Returns the invariant at the end of the constructor.
+value::AbstractDomain analyze_global_ctor(
+    Context& ctx,
+    const std::vector< std::unique_ptr< Checker > >& checkers,
+    FunctionFixpoint::CalleeSummaryCacheT& summary_cache,
+    CheckReplayCache& replay_cache,
+    ar::Function* ctor,
+    const value::AbstractDomain& inv) {
+  FunctionFixpoint fixpoint(ctx, checkers, summary_cache, replay_cache, ctor);
+
+  {
+    log::info("Analyzing global constructor: " + demangle(ctor));
+    ScopeTimerDatabase t(ctx.output_db->times,
+                         "ikos-analyzer.value." + ctor->name());
+    fixpoint.run(inv);
+  }
+
+  {
+    log::info(
+        "Checking properties and writing results for global constructor: " +
+        demangle(ctor));
+    ScopeTimerDatabase t(ctx.output_db->times,
+                         "ikos-analyzer.check." + ctor->name());
+    fixpoint.run_checks();
+  }
+
+  return fixpoint.exit_invariant();
+}
+
+/// \brief Functions and global variables used by a global constructor
+struct CtorFootprint {
+  /// \brief Functions reachable from the constructor
+  llvm::DenseSet< ar::Function* > functions;
+
+  /// \brief Global variables used by the reachable functions
+  llvm::DenseSet< ar::GlobalVariable* > globals;
+
+  /// \brief True if all the calls target defined functions or intrinsics
+  bool closed = true;
+};
+
+/// \brief Return the footprint of the given global constructor
+CtorFootprint ctor_footprint(const CallGraph& call_graph, ar::Function* ctor) {
+  CtorFootprint footprint;
+  for (ar::Function* fun : call_graph.reachable(ctor)) {
+    footprint.functions.insert(fun);
+    for (ar::BasicBlock* bb : *fun->body()) {
+      for (ar::Statement* stmt : *bb) {
+        auto call = dyn_cast< ar::CallBase >(stmt);
+        if (call == nullptr) {
+          continue;
+        }
+        auto cst = dyn_cast< ar::FunctionPointerConstant >(call->called());
+        if (cst == nullptr || (cst->function()->is_declaration() &&
+                               !cst->function()->is_intrinsic())) {
+          // Indirect or extern call, with unknown effects
+          footprint.closed = false;
+        }
+      }
+    }
+  }
+  footprint.globals = used_globals(call_graph, {ctor});
+  return footprint;
+}
+
+/// \brief Return true if the given sets have no element in common
+template < typename T >
+bool disjoint(const llvm::DenseSet< T >& a, const llvm::DenseSet< T >& b) {
+  if (a.size() > b.size()) {
+    return disjoint(b, a);
+  }
+  for (const T& x : a) {
+    if (b.count(x) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief Analyze the given global constructors, in order, starting from
+/// `inv`
+///
+/// With several jobs, a pre-pass computes the functions and global variables
+/// used by each constructor. Consecutive constructors that share none of them
+/// with each other nor with the previous constructors, and that only call
+/// defined functions, are analyzed in parallel from the same invariant. Each
+/// result forgets the memory of the global variables of the other constructors
+/// of the group, and the results are combined with a meet. Other constructors
+/// are analyzed sequentially, in priority order.
+///
+/// Returns the invariant after the constructors.
+value::AbstractDomain analyze_global_ctors(
+    Context& ctx,
+    const std::vector< std::unique_ptr< Checker > >& checkers,
+    FunctionFixpoint::CalleeSummaryCacheT& summary_cache,
+    CheckReplayCache& replay_cache,
+    const std::vector< ar::Function* >& ctors,
+    value::AbstractDomain inv) {
+  if (ctx.opts.jobs <= 1 || ctx.call_graph == nullptr || ctors.size() <= 1) {
+    for (ar::Function* ctor : ctors) {
+      inv = analyze_global_ctor(ctx,
+                                checkers,
+                                summary_cache,
+                                replay_cache,
+                                ctor,
+                                inv);
+    }
+    return inv;
+  }
+
+  // Group the independent constructors
+  std::vector< CtorFootprint > footprints;
+  footprints.reserve(ctors.size());
+  std::vector< std::vector< std::size_t > > groups;
+  bool parallel_group = false;
+  llvm::DenseSet< ar::Function* > seen_functions;
+  llvm::DenseSet< ar::GlobalVariable* > seen_globals;
+  for (std::size_t i = 0; i < ctors.size(); i++) {
+    footprints.push_back(ctor_footprint(*ctx.call_graph, ctors[i]));
+    const CtorFootprint& footprint = footprints.back();
+    bool independent = footprint.closed &&
+                       disjoint(footprint.functions, seen_functions) &&
+                       disjoint(footprint.globals, seen_globals);
+    if (independent && parallel_group) {
+      groups.back().push_back(i);
+    } else {
+      groups.push_back({i});
+      parallel_group = independent;
+    }
+    seen_functions.insert(footprint.functions.begin(),
+                          footprint.functions.end());
+    seen_globals.insert(footprint.globals.begin(), footprint.globals.end());
+  }
+
+  log::debug([&] {
+    return std::to_string(ctors.size()) + " global constructors in " +
+           std::to_string(groups.size()) + " groups";
+  });
+
+  for (const std::vector< std::size_t >& group : groups) {
+    if (group.size() == 1) {
+      inv = analyze_global_ctor(ctx,
+                                checkers,
+                                summary_cache,
+                                replay_cache,
+                                ctors[group.front()],
+                                inv);
+      continue;
+    }
+
+    std::vector< std::unique_ptr< FunctionTask > > tasks;
+    tasks.reserve(group.size());
+    for (std::size_t i : group) {
+      tasks.emplace_back(std::make_unique< FunctionTask >(ctors[i], inv));
+    }
+
+    std::vector< value::AbstractDomain > results;
+    results.reserve(group.size());
+    analyze_functions_parallel(ctx,
+                               checkers,
+                               summary_cache,
+                               replay_cache,
+                               tasks,
+                               "global constructor",
+                               [&results](FunctionTask& task) {
+                                 results.push_back(
+                                     task.fixpoint->exit_invariant());
+                               });
+
+    // Forget the effects of the other constructors of the group, unknown in
+    // each result
+    for (std::size_t k = 0; k < group.size(); k++) {
+      value::AbstractDomain& result = results[k];
+      for (std::size_t m = 0; m < group.size(); m++) {
+        if (m == k) {
+          continue;
+        }
+        for (ar::GlobalVariable* gv : footprints[group[m]].globals) {
+          MemoryLocation* addr = ctx.mem_factory->get_global(gv);
+          result.normal().forget_mem(addr);
+          result.caught_exceptions().forget_mem(addr);
+          result.propagated_exceptions().forget_mem(addr);
+        }
+      }
+    }
+
+    // The normal exit is the meet of the normal exits, while an exception can
+    // be thrown by any constructor
+    inv = std::move(results[0]);
+    for (std::size_t k = 1; k < group.size(); k++) {
+      inv.normal().meet_with(results[k].normal());
+      inv.caught_exceptions().join_with(results[k].caught_exceptions());
+      inv.propagated_exceptions().join_with(
+          results[k].propagated_exceptions());
+    }
+  }
+
+  return inv;
+}
+
 } // end anonymous namespace
 
 void InterproceduralValueAnalysis::run() {
@@ -642,23 +1854,66 @@ void InterproceduralValueAnalysis::run() {
     checkers.emplace_back(make_checker(_ctx, name));
   }
 
+  // Cache of callee summaries, cleared before each entry point and global
+  // destructor
+  FunctionFixpoint::CalleeSummaryCacheT summary_cache;
+
+  // Cache of the checks of the callees, shared by all entry points
+  CheckReplayCache replay_cache(_ctx);
+
   // Initial invariant
-  value::AbstractDomain init_inv = init_invariant(_ctx.opts.machine_int_domain);
+  value::AbstractDomain init_inv = init_invariant(_ctx.opts);
+
+  // Global constructors and destructors
+  ar::GlobalVariable* gv_ctors = bundle->global_or_null("ar.global_ctors");
+  ar::GlobalVariable* gv_dtors = bundle->global_or_null("ar.global_dtors");
+
+  // With the lazy policy, only initialize the global variables used by the
+  // code reachable from the entry points, constructors and destructors
+  llvm::DenseSet< ar::GlobalVariable* > used;
+  bool lazy = _ctx.opts.globals_init_policy == GlobalsInitPolicy::Lazy;
+  if (lazy) {
+    ikos_assert(_ctx.call_graph != nullptr);
+    std::vector< ar::Function* > roots;
+    for (ar::Function* entry_point : _ctx.opts.entry_points) {
+      if (entry_point->is_definition()) {
+        roots.push_back(entry_point);
+      }
+    }
+    for (ar::GlobalVariable* gv : {gv_ctors, gv_dtors}) {
+      for (const auto& entry : global_cdtors(gv)) {
+        if (entry.first->is_definition()) {
+          roots.push_back(entry.first);
+        }
+      }
+    }
+    used = used_globals(*_ctx.call_graph, roots);
+    log::debug([&used, bundle] {
+      return std::to_string(used.size()) + " of " +
+             std::to_string(bundle->num_globals()) +
+             " global variables are used";
+    });
+  }
 
   // Initialize global variables
   log::debug("Computing global variable static initialization");
+  std::vector< ar::GlobalVariable* > globals;
   for (auto it = bundle->global_begin(), et = bundle->global_end(); it != et;
        ++it) {
     ar::GlobalVariable* gv = *it;
     if (gv->is_definition() &&
-        is_initialized(gv, _ctx.opts.globals_init_policy)) {
-      log::debug("Initializing global variable @" + gv->name());
-      GlobalVarInitializerFixpoint fixpoint(_ctx, gv);
-      fixpoint.run(init_inv);
-      init_inv = fixpoint.exit_invariant();
+        is_initialized(gv, _ctx.opts.globals_init_policy) &&
+        (!lazy || used.count(gv) != 0)) {
+      globals.push_back(gv);
     }
   }
 
+  if (_ctx.opts.jobs > 1 && globals.size() > 1) {
+    init_inv = initialize_globals_parallel(_ctx, globals, std::move(init_inv));
+  } else {
+    init_inv = initialize_globals(_ctx, globals, std::move(init_inv));
+  }
+
   if (_ctx.opts.display_invariants == DisplayOption::All) {
     log::out() << "Invariant after global variable static initialization:\n";
     init_inv.dump(log::out());
@@ -666,13 +1921,11 @@ void InterproceduralValueAnalysis::run() {
   }
 
   // Call constructors
-  ar::GlobalVariable* gv_ctors = bundle->global_or_null("ar.global_ctors");
   if (gv_ctors != nullptr) {
     log::info("Computing global variable dynamic initialization");
 
-    std::vector< std::pair< ar::Function*, MachineInt > > ctors =
-        global_ctors(gv_ctors);
-    for (const auto& entry : ctors) {
+    std::vector< ar::Function* > ctors;
+    for (const auto& entry : global_ctors(gv_ctors)) {
       ar::Function* ctor = entry.first;
 
       if (ctor->is_declaration()) {
@@ -680,27 +1933,16 @@ void InterproceduralValueAnalysis::run() {
         continue;
       }
 
-      FunctionFixpoint fixpoint(_ctx, checkers, ctor);
-
-      {
-        log::info("Analyzing global constructor: " + demangle(ctor->name()));
-        ScopeTimerDatabase t(_ctx.output_db->times,
-                             "ikos-analyzer.value." + ctor->name());
-        fixpoint.run(init_inv);
-      }
-
-      {
-        log::info(
-            "Checking properties and writing results for global constructor: " +
-            demangle(ctor->name()));
-        ScopeTimerDatabase t(_ctx.output_db->times,
-                             "ikos-analyzer.check." + ctor->name());
-        fixpoint.run_checks();
-      }
-
-      init_inv = fixpoint.exit_invariant();
+      ctors.push_back(ctor);
     }
 
+    init_inv = analyze_global_ctors(_ctx,
+                                    checkers,
+                                    summary_cache,
+                                    replay_cache,
+                                    ctors,
+                                    std::move(init_inv));
+
     if (_ctx.opts.display_invariants == DisplayOption::All) {
       log::out() << "Invariant after global variable dynamic initialization:\n";
       init_inv.dump(log::out());
@@ -709,49 +1951,63 @@ void InterproceduralValueAnalysis::run() {
   }
 
   // Analyze each entry point
+  std::vector< ar::Function* > entry_points;
   for (ar::Function* entry_point : _ctx.opts.entry_points) {
     if (entry_point->is_declaration()) {
       log::error("Entry point " + entry_point->name() + " is extern");
       continue;
     }
+    if (_ctx.checkpoint != nullptr &&
+        _ctx.checkpoint->done(*_ctx.output_db, entry_point)) {
+      log::info("Skipping entry point " + demangle(entry_point) +
+                ", analyzed before the checkpoint");
+      continue;
+    }
+    entry_points.push_back(entry_point);
+  }
 
-    // Entry point initial invariant
-    value::AbstractDomain entry_inv = value::AbstractDomain::bottom();
+  if (_ctx.opts.jobs > 1 && entry_points.size() > 1) {
+    analyze_entry_points_parallel(_ctx,
+                                  checkers,
+                                  summary_cache,
+                                  replay_cache,
+                                  entry_points,
+                                  init_inv);
+  } else {
+    for (ar::Function* entry_point : entry_points) {
+      summary_cache.clear();
 
-    if (std::find(_ctx.opts.no_init_globals.begin(),
-                  _ctx.opts.no_init_globals.end(),
-                  entry_point) == _ctx.opts.no_init_globals.end()) {
-      // Use invariant with initialized global variables
-      entry_inv = init_inv;
-    } else {
-      // Default invariant
-      entry_inv = init_invariant(_ctx.opts.machine_int_domain);
-    }
+      value::AbstractDomain entry_inv =
+          entry_point_invariant(_ctx, entry_point, init_inv);
 
-    if (entry_point->name() == "main" && entry_point->num_parameters() >= 2) {
-      entry_inv = init_main_invariant(_ctx, entry_point, entry_inv);
-    }
+      FunctionFixpoint fixpoint(_ctx,
+                                checkers,
+                                summary_cache,
+                                replay_cache,
+                                entry_point);
 
-    FunctionFixpoint fixpoint(_ctx, checkers, entry_point);
+      {
+        log::info("Analyzing entry point: " + demangle(entry_point));
+        ScopeTimerDatabase t(_ctx.output_db->times,
+                             "ikos-analyzer.value." + entry_point->name());
+        fixpoint.run(entry_inv);
+      }
 
-    {
-      log::info("Analyzing entry point: " + demangle(entry_point->name()));
-      ScopeTimerDatabase t(_ctx.output_db->times,
-                           "ikos-analyzer.value." + entry_point->name());
-      fixpoint.run(entry_inv);
-    }
+      {
+        log::info("Checking properties and writing results for entry point: " +
+                  demangle(entry_point));
+        ScopeTimerDatabase t(_ctx.output_db->times,
+                             "ikos-analyzer.check." + entry_point->name());
+        fixpoint.run_checks();
+      }
 
-    {
-      log::info("Checking properties and writing results for entry point: " +
-                demangle(entry_point->name()));
-      ScopeTimerDatabase t(_ctx.output_db->times,
-                           "ikos-analyzer.check." + entry_point->name());
-      fixpoint.run_checks();
+      if (_ctx.checkpoint != nullptr) {
+        _ctx.checkpoint->save(*_ctx.output_db, entry_point);
+      }
     }
   }
 
   // Call destructors
-  ar::GlobalVariable* gv_dtors = bundle->global_or_null("ar.global_dtors");
   if (gv_dtors != nullptr) {
     log::info("Analyzing global destructors");
 
@@ -765,10 +2021,16 @@ void InterproceduralValueAnalysis::run() {
         continue;
       }
 
-      FunctionFixpoint fixpoint(_ctx, checkers, dtor);
+      summary_cache.clear();
+
+      FunctionFixpoint fixpoint(_ctx,
+                                checkers,
+                                summary_cache,
+                                replay_cache,
+                                dtor);
 
       {
-        log::info("Analyzing global destructor: " + demangle(dtor->name()));
+        log::info("Analyzing global destructor: " + demangle(dtor));
         ScopeTimerDatabase t(_ctx.output_db->times,
                              "ikos-analyzer.value." + dtor->name());
         // Note: We currently analyze destructors with the initial invariant
@@ -778,7 +2040,7 @@ void InterproceduralValueAnalysis::run() {
       {
         log::info(
             "Checking properties and writing results for global destructor: " +
-            demangle(dtor->name()));
+            demangle(dtor));
         ScopeTimerDatabase t(_ctx.output_db->times,
                              "ikos-analyzer.check." + dtor->name());
         fixpoint.run_checks();
@@ -788,6 +2050,25 @@ void InterproceduralValueAnalysis::run() {
     }
   }
 
+  for (const auto& checker : checkers) {
+    checker->finish();
+  }
+
+  // Save the summary cache statistics
+  _ctx.output_db->times.insert("ikos-analyzer.value.summary-cache.hits",
+                               static_cast< double >(summary_cache.hits()));
+  _ctx.output_db->times.insert("ikos-analyzer.value.summary-cache.misses",
+                               static_cast< double >(summary_cache.misses()));
+  _ctx.output_db->times.insert(
+      "ikos-analyzer.value.summary-cache.peak-size",
+      static_cast< double >(summary_cache.peak_size()));
+
+  // Save the check replay cache statistics
+  _ctx.output_db->times.insert("ikos-analyzer.value.check-replay-cache.hits",
+                               static_cast< double >(replay_cache.hits()));
+  _ctx.output_db->times.insert("ikos-analyzer.value.check-replay-cache.misses",
+                               static_cast< double >(replay_cache.misses()));
+
   // Insert all functions in the database
   for (auto it = bundle->function_begin(), et = bundle->function_end();
        it != et;
@@ -41,7 +41,12 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 #include <ikos/core/fixpoint/fwd_fixpoint_iterator.hpp>
@@ -50,15 +55,27 @@
 #include <ikos/analyzer/analysis/execution_engine/engine.hpp>
 #include <ikos/analyzer/analysis/execution_engine/numerical.hpp>
 #include <ikos/analyzer/analysis/fixpoint_profile.hpp>
+#include <ikos/analyzer/analysis/fixpoint_trace.hpp>
+#include <ikos/analyzer/analysis/memory_budget.hpp>
 #include <ikos/analyzer/analysis/pointer/pointer.hpp>
+#include <ikos/analyzer/analysis/progress.hpp>
+#include <ikos/analyzer/analysis/function_queue.hpp>
+#include <ikos/analyzer/analysis/result_cache.hpp>
+#include <ikos/analyzer/analysis/sparse_scalar.hpp>
 #include <ikos/analyzer/analysis/value/abstract_domain.hpp>
 #include <ikos/analyzer/analysis/value/intraprocedural.hpp>
 #include <ikos/analyzer/analysis/value/machine_int_domain.hpp>
 #include <ikos/analyzer/analysis/variable.hpp>
+#include <ikos/analyzer/analysis/wto.hpp>
+#include <ikos/analyzer/checker/assert_prover.hpp>
 #include <ikos/analyzer/checker/checker.hpp>
+#include <ikos/analyzer/checker/query_cache.hpp>
+#include <ikos/analyzer/util/concurrency.hpp>
 #include <ikos/analyzer/util/demangle.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
 #include <ikos/analyzer/util/log.hpp>
 #include <ikos/analyzer/util/timer.hpp>
+#include <ikos/analyzer/util/work_stealing.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -74,11 +91,13 @@ using namespace value;
 
 /// \brief Fixpoint on a function body
 class FunctionFixpoint
-    : public core::InterleavedFwdFixpointIterator< ar::Code*, AbstractDomain > {
+    : public core::InterleavedFwdFixpointIterator< const ar::CodeGraph*,
+                                                   AbstractDomain > {
 private:
   /// \brief Parent class
   using FwdFixpointIterator =
-      core::InterleavedFwdFixpointIterator< ar::Code*, AbstractDomain >;
+      core::InterleavedFwdFixpointIterator< const ar::CodeGraph*,
+                                            AbstractDomain >;
 
 private:
   /// \brief Analysis context
@@ -96,42 +115,105 @@ private:
   /// \brief Fixpoint profile
   boost::optional< const FixpointProfile& > _profile;
 
+  /// \brief True if the current narrowing reached the iterations limit
+  bool _narrowing_capped = false;
+
+  /// \brief Checkers run during the fixpoint, or null (see run_and_check())
+  const std::vector< std::unique_ptr< Checker > >* _fused_checkers = nullptr;
+
+  /// \brief Fixpoint tracer, or null
+  std::unique_ptr< FunctionFixpointTracer > _tracer;
+
+  /// \brief Values of the sparse scalars, or null
+  std::unique_ptr< SparseScalarValues > _sparse_scalars;
+
 public:
   /// \brief Create a function fixpoint iterator
   FunctionFixpoint(Context& ctx, ar::Function* function)
-      : FwdFixpointIterator(function->body()),
+      : FunctionFixpoint(ctx, function, ctx.opts.machine_int_domain) {}
+
+  /// \brief Create a function fixpoint iterator for the given machine integer
+  /// abstract domain
+  FunctionFixpoint(Context& ctx,
+                   ar::Function* function,
+                   MachineIntDomainOption machine_int_domain)
+      : FwdFixpointIterator(function->body()->graph(),
+                            ctx.wto_cache->wto(function->body())),
         _ctx(ctx),
         _function(function),
         _empty_call_context(ctx.call_context_factory->get_empty()),
-        _machine_int_domain(ctx.opts.machine_int_domain),
+        _machine_int_domain(machine_int_domain),
         _profile(ctx.fixpoint_profiler == nullptr
                      ? boost::none
-                     : ctx.fixpoint_profiler->profile(function)) {}
+                     : ctx.fixpoint_profiler->profile(function)) {
+    if (ctx.fixpoint_trace != nullptr) {
+      this->_tracer =
+          std::make_unique< FunctionFixpointTracer >(*ctx.fixpoint_trace,
+                                                     function);
+      this->set_tracer(this->_tracer.get());
+    }
+    if (ctx.sparse_scalars != nullptr) {
+      const SparseScalarAnalysis::CodeInfo* info =
+          ctx.sparse_scalars->code_info(function->body());
+      if (info != nullptr) {
+        this->_sparse_scalars = std::make_unique< SparseScalarValues >(*info);
+      }
+    }
+  }
+
+  /// \brief Return the fixpoint tracer, or null
+  FunctionFixpointTracer* function_tracer() const {
+    return this->_tracer.get();
+  }
 
   /// \brief Extrapolate the new state after an increasing iteration
   AbstractDomain extrapolate(ar::BasicBlock* head,
                              unsigned iteration,
                              AbstractDomain before,
                              AbstractDomain after) override {
-    if (iteration <= 1) {
+    if (this->_ctx.progress != nullptr) {
+      this->_ctx.progress->set_cycle(head, iteration, /* increasing = */ true);
+    }
+    if (this->_ctx.memory_budget != nullptr) {
+      this->_ctx.memory_budget->check(this->_function);
+    }
+    if (this->_ctx.opts.gc_loop_heads) {
+      after = this->collect_unreachable_memory(std::move(after));
+    }
+    if (iteration <= this->_ctx.opts.widening_delay) {
       before.join_iter_with(after);
       return before;
     }
-    if (iteration == 2 && this->_profile) {
-      if (auto threshold = this->_profile->widening_hint(head)) {
-        before.widen_threshold_with(after, *threshold);
-        return before;
-      }
+    if (this->_profile) {
+      before.widen_threshold_with(after,
+                                  this->_profile->widening_thresholds());
+      return before;
     }
     before.widen_with(after);
     return before;
   }
 
+  /// \brief Refine the new state after a decreasing iteration
+  AbstractDomain refine(ar::BasicBlock* head,
+                        unsigned iteration,
+                        AbstractDomain before,
+                        AbstractDomain after) override {
+    if (this->_ctx.progress != nullptr) {
+      this->_ctx.progress->set_cycle(head, iteration, /* increasing = */ false);
+    }
+    this->_narrowing_capped = this->_ctx.opts.narrowing_iterations > 0 &&
+                              iteration >= this->_ctx.opts.narrowing_iterations;
+    return FwdFixpointIterator::refine(head,
+                                       iteration,
+                                       std::move(before),
+                                       std::move(after));
+  }
+
   /// \brief Check if the decreasing iterations fixpoint is reached
   bool is_decreasing_iterations_fixpoint(const AbstractDomain& before,
                                          const AbstractDomain& after) override {
     if (machine_int_domain_option_has_narrowing(this->_machine_int_domain)) {
-      return before.leq(after);
+      return this->_narrowing_capped || before.leq(after);
     } else {
       return true; // stop after the first decreasing iteration
     }
@@ -148,6 +230,7 @@ public:
                     /* pointer_info = */ _ctx.pointer == nullptr
                         ? nullptr
                         : &_ctx.pointer->results());
+    exec_engine.set_sparse_scalars(this->_sparse_scalars.get());
     ContextInsensitiveCallExecutionEngine< AbstractDomain > call_exec_engine(
         exec_engine);
     exec_engine.exec_enter(bb);
@@ -175,9 +258,27 @@ public:
     return std::move(exec_engine.inv());
   }
 
+  /// \brief Forget the memory locations that are no longer reachable
+  AbstractDomain collect_unreachable_memory(AbstractDomain inv) {
+    NumericalExecutionEngine< AbstractDomain >
+        exec_engine(std::move(inv),
+                    _ctx,
+                    this->_empty_call_context,
+                    /* precision = */ _ctx.opts.precision,
+                    /* liveness = */ _ctx.liveness,
+                    /* pointer_info = */ _ctx.pointer == nullptr
+                        ? nullptr
+                        : &_ctx.pointer->results());
+    exec_engine.collect_unreachable_memory();
+    return std::move(exec_engine.inv());
+  }
+
   /// \brief Process the computed abstract value for a node
-  void process_pre(ar::BasicBlock* /*bb*/,
-                   const AbstractDomain& /*pre*/) override {}
+  void process_pre(ar::BasicBlock* bb, const AbstractDomain& pre) override {
+    if (this->_fused_checkers != nullptr) {
+      this->check_block(*this->_fused_checkers, bb, pre);
+    }
+  }
 
   /// \brief Process the computed abstract value for a node
   void process_post(ar::BasicBlock* /*bb*/,
@@ -191,47 +292,340 @@ public:
 
     // Check the function body
     for (ar::BasicBlock* bb : *this->cfg()) {
-      NumericalExecutionEngine< AbstractDomain >
-          exec_engine(this->pre(bb),
-                      _ctx,
-                      this->_empty_call_context,
-                      /* precision = */ _ctx.opts.precision,
-                      /* liveness = */ _ctx.liveness,
-                      /* pointer_info = */ _ctx.pointer == nullptr
-                          ? nullptr
-                          : &_ctx.pointer->results());
-      ContextInsensitiveCallExecutionEngine< AbstractDomain > call_exec_engine(
-          exec_engine);
-
-      exec_engine.exec_enter(bb);
-      for (const auto& checker : checkers) {
-        checker->enter(bb, exec_engine.inv(), this->_empty_call_context);
-      }
+      this->check_block(checkers, bb, this->pre(bb));
+    }
+
+    for (const auto& checker : checkers) {
+      checker->leave(this->_function, this->_empty_call_context);
+    }
+  }
+
+  /// \brief Compute the fixpoint and run the checks at the same time
+  ///
+  /// Each basic block is checked as soon as its invariant is stable, and the
+  /// invariants are dropped as soon as possible, to reduce the memory usage.
+  void run_and_check(
+      const AbstractDomain& init,
+      const std::vector< std::unique_ptr< Checker > >& checkers) {
+    for (const auto& checker : checkers) {
+      checker->enter(this->_function, this->_empty_call_context);
+    }
+
+    this->_fused_checkers = &checkers;
+    {
+      FunctionTraceScope trace_scope(this->_tracer.get());
+      this->run_and_process(init);
+    }
+    this->_fused_checkers = nullptr;
+
+    for (const auto& checker : checkers) {
+      checker->leave(this->_function, this->_empty_call_context);
+    }
+  }
+
+private:
+  /// \brief Run the checks on the given basic block
+  void check_block(const std::vector< std::unique_ptr< Checker > >& checkers,
+                   ar::BasicBlock* bb,
+                   const AbstractDomain& pre) {
+    NumericalExecutionEngine< AbstractDomain >
+        exec_engine(pre,
+                    _ctx,
+                    this->_empty_call_context,
+                    /* precision = */ _ctx.opts.precision,
+                    /* liveness = */ _ctx.liveness,
+                    /* pointer_info = */ _ctx.pointer == nullptr
+                        ? nullptr
+                        : &_ctx.pointer->results());
+    exec_engine.set_sparse_scalars(this->_sparse_scalars.get());
+    ContextInsensitiveCallExecutionEngine< AbstractDomain > call_exec_engine(
+        exec_engine);
 
-      for (ar::Statement* stmt : *bb) {
-        // Check the statement if it's related to an llvm instruction
-        if (stmt->has_frontend()) {
-          for (const auto& checker : checkers) {
+    exec_engine.exec_enter(bb);
+    for (const auto& checker : checkers) {
+      checker->enter(bb, exec_engine.inv(), this->_empty_call_context);
+    }
+
+    // Facts queried on a statement, shared by the checkers
+    StatementQueryCache query_cache;
+
+    for (ar::Statement* stmt : *bb) {
+      // Check the statement if it's related to an llvm instruction
+      if (stmt->has_frontend()) {
+        query_cache.bind(exec_engine.inv());
+        StatementQueryScope query_scope(&query_cache);
+        for (const auto& checker : checkers) {
+          if (checker->inspects(stmt)) {
             checker->check(stmt, exec_engine.inv(), this->_empty_call_context);
           }
         }
-        // Propagate
-        transfer_function(exec_engine, call_exec_engine, stmt);
       }
-
-      for (const auto& checker : checkers) {
-        checker->leave(bb, exec_engine.inv(), this->_empty_call_context);
-      }
-      exec_engine.exec_leave(bb);
+      // Propagate
+      transfer_function(exec_engine, call_exec_engine, stmt);
     }
 
     for (const auto& checker : checkers) {
-      checker->leave(this->_function, this->_empty_call_context);
+      checker->leave(bb, exec_engine.inv(), this->_empty_call_context);
     }
+    exec_engine.exec_leave(bb);
   }
 
 }; // end class FunctionFixpoint
 
+/// \brief Return the number of statements in the given function body
+std::size_t num_statements(ar::Function* function) {
+  std::size_t n = 0;
+  for (ar::BasicBlock* bb : *function->body()) {
+    n += bb->num_statements();
+  }
+  return n;
+}
+
+/// \brief Insert the checks of the given function from the result cache
+///
+/// Returns true if the checks were found in the cache. Otherwise, returns false
+/// and sets `hash` to the key under which the checks should be stored.
+bool load_cached_checks(Context& ctx, ar::Function* function, std::string& hash) {
+  hash = ctx.result_cache->hash(function);
+  if (!ctx.result_cache->load(function, hash)) {
+    return false;
+  }
+  log::info("Using cached results for function: " + demangle(function));
+  return true;
+}
+
+/// \brief Return the initial invariant for the given machine integer domain
+value::AbstractDomain make_init_inv(Context& ctx,
+                                    MachineIntDomainOption machine_int_domain) {
+  return value::AbstractDomain(
+      /*normal=*/value::MemoryAbstractDomain(
+          value::PointerAbstractDomain(value::make_top_machine_int_domain(
+                                           machine_int_domain),
+                                       value::NullityAbstractDomain::top()),
+          value::UninitializedAbstractDomain::top(),
+          value::LifetimeAbstractDomain::top(),
+          ctx.opts.smash_threshold,
+          ctx.opts.array_segments),
+      /*caught_exceptions=*/value::MemoryAbstractDomain::bottom(),
+      /*propagated_exceptions=*/value::MemoryAbstractDomain::bottom());
+}
+
+/// \brief Return the assertion prover whose unproved assertions are checked
+/// again with -assert-refine-domain, or null
+AssertProverChecker* refined_assert_prover(
+    Context& ctx, const std::vector< std::unique_ptr< Checker > >& checkers) {
+  if (!ctx.opts.assert_refine_domain) {
+    return nullptr;
+  }
+  for (const auto& checker : checkers) {
+    if (checker->name() == CheckerName::AssertProver) {
+      return static_cast< AssertProverChecker* >(checker.get());
+    }
+  }
+  return nullptr;
+}
+
+/// \brief Check the unproved assertions of the given function again
+///
+/// The function is analyzed again with the relational domain of
+/// -assert-refine-domain, and only its unproved assertions are checked.
+void refine_asserts(Context& ctx,
+                    AssertProverChecker* prover,
+                    ar::Function* function) {
+  if (prover == nullptr) {
+    return;
+  }
+
+  AssertProverChecker::AssertSet unproved = prover->take_unproved();
+  if (unproved.empty()) {
+    return;
+  }
+
+  MachineIntDomainOption domain = *ctx.opts.assert_refine_domain;
+  log::info("Analyzing function with unproved assertions using " +
+            std::string(machine_int_domain_option_str(domain)) + ": " +
+            demangle(function));
+  ScopeTimerDatabase t(ctx.output_db->times,
+                       "ikos-analyzer.assert-refine." + function->name());
+
+  FunctionFixpoint fixpoint(ctx, function, domain);
+  {
+    FunctionTraceScope trace_scope(fixpoint.function_tracer());
+    fixpoint.run(make_init_inv(ctx, domain));
+  }
+
+  std::vector< std::unique_ptr< Checker > > checkers;
+  checkers.emplace_back(
+      std::make_unique< AssertProverChecker >(ctx, std::move(unproved)));
+  fixpoint.run_checks(checkers);
+}
+
+/// \brief Analysis of one function, run by a worker thread
+struct FunctionTask {
+  /// \brief Analyzed function
+  ar::Function* function;
+
+  /// \brief Key in the result cache, or empty
+  std::string hash;
+
+  /// \brief Fixpoint, available once the task is done
+  std::unique_ptr< FunctionFixpoint > fixpoint;
+
+  /// \brief Time spent computing the fixpoint
+  Timer::Duration elapsed;
+
+  /// \brief Exception thrown by the worker, if any
+  std::exception_ptr error;
+
+  /// \brief True when the worker is done with the task
+  bool done = false;
+
+  FunctionTask(ar::Function* function_, std::string hash_)
+      : function(function_), hash(std::move(hash_)) {}
+};
+
+/// \brief Analyze the given functions using `ctx.opts.jobs` threads
+///
+/// Fixpoints are computed by a work-stealing pool, largest functions first.
+/// The calling thread is the only writer of the output database: it runs the
+/// checks in the order of the functions, so that the output database is the
+/// same as in a sequential analysis.
+void analyze_functions_parallel(
+    Context& ctx,
+    const std::vector< std::unique_ptr< Checker > >& checkers,
+    AssertProverChecker* prover,
+    std::vector< ar::Function* > functions,
+    const value::AbstractDomain& init_inv) {
+  // Functions found in the result cache are not analyzed
+  std::vector< std::pair< ar::Function*, std::string > > hashed;
+  hashed.reserve(functions.size());
+  for (ar::Function* function : functions) {
+    std::string hash;
+    if (ctx.result_cache != nullptr &&
+        load_cached_checks(ctx, function, hash)) {
+      continue;
+    }
+    hashed.emplace_back(function, std::move(hash));
+  }
+  if (hashed.empty()) {
+    return;
+  }
+
+  // The initial invariant is shared by all threads, normalize it now
+  init_inv.normal().normalize();
+  init_inv.caught_exceptions().normalize();
+  init_inv.propagated_exceptions().normalize();
+
+  std::vector< std::unique_ptr< FunctionTask > > tasks;
+  tasks.reserve(hashed.size());
+  for (auto& item : hashed) {
+    tasks.emplace_back(
+        std::make_unique< FunctionTask >(item.first, std::move(item.second)));
+  }
+
+  // Largest functions first
+  std::vector< std::pair< std::size_t, std::size_t > > sized;
+  sized.reserve(tasks.size());
+  for (std::size_t i = 0; i < tasks.size(); i++) {
+    sized.emplace_back(num_statements(tasks[i]->function), i);
+  }
+  std::stable_sort(sized.begin(),
+                   sized.end(),
+                   [](const auto& a, const auto& b) {
+                     return a.first > b.first;
+                   });
+
+  std::mutex mutex;
+  std::condition_variable task_done;
+
+  std::vector< WorkStealingPool::Task > jobs;
+  jobs.reserve(tasks.size());
+  for (const auto& entry : sized) {
+    FunctionTask* task = tasks[entry.second].get();
+    jobs.emplace_back([&ctx, &init_inv, &mutex, &task_done, task]() {
+      try {
+        if (ctx.function_queue != nullptr &&
+            !ctx.function_queue->claim(task->function)) {
+          log::debug([&task] {
+            return "Skipping function claimed by another process: " +
+                   demangle(task->function);
+          });
+        } else {
+          ProgressFrame progress_frame(ctx.progress, task->function);
+          log::info("Analyzing function: " +
+                    demangle(task->function));
+          auto fixpoint =
+              std::make_unique< FunctionFixpoint >(ctx, task->function);
+          Timer timer;
+          timer.start();
+          {
+            FunctionTraceScope trace_scope(fixpoint->function_tracer());
+            fixpoint->run(init_inv);
+          }
+          timer.stop();
+          task->elapsed = timer.elapsed();
+          task->fixpoint = std::move(fixpoint);
+        }
+      } catch (...) {
+        task->error = std::current_exception();
+      }
+
+      {
+        std::lock_guard< std::mutex > lock(mutex);
+        task->done = true;
+      }
+      task_done.notify_all();
+    });
+  }
+
+  // Enable locking in the factories
+  ConcurrentScope concurrent_scope;
+
+  unsigned num_threads = static_cast< unsigned >(
+      std::min(static_cast< std::size_t >(ctx.opts.jobs), tasks.size()));
+  WorkStealingPool pool(num_threads);
+  pool.start(std::move(jobs));
+
+  for (std::unique_ptr< FunctionTask >& task : tasks) {
+    {
+      std::unique_lock< std::mutex > lock(mutex);
+      task_done.wait(lock, [&]() { return task->done; });
+    }
+
+    if (task->error) {
+      pool.cancel();
+      pool.join();
+      std::rethrow_exception(task->error);
+    }
+
+    if (!task->fixpoint) {
+      continue; // claimed by another process
+    }
+
+    ctx.output_db->times.insert("ikos-analyzer.value." +
+                                    task->function->name(),
+                                task->elapsed.count());
+
+    {
+      log::info("Checking properties and writing results for function: " +
+                demangle(task->function));
+      ScopeTimerDatabase t(ctx.output_db->times,
+                           "ikos-analyzer.check." + task->function->name());
+      if (ctx.result_cache != nullptr) {
+        ctx.result_cache->start_recording(task->function);
+      }
+      task->fixpoint->run_checks(checkers);
+      task->fixpoint.reset();
+      refine_asserts(ctx, prover, task->function);
+      if (ctx.result_cache != nullptr) {
+        ctx.result_cache->stop_recording(task->hash);
+      }
+    }
+  }
+
+  pool.join();
+}
+
 } // end anonymous namespace
 
 void IntraproceduralValueAnalysis::run() {
@@ -244,16 +638,45 @@ void IntraproceduralValueAnalysis::run() {
     checkers.emplace_back(make_checker(_ctx, name));
   }
 
+  // Checker of the assertions analyzed again with a relational domain, or null
+  AssertProverChecker* prover = refined_assert_prover(_ctx, checkers);
+
   // Initial invariant
-  value::AbstractDomain init_inv(
-      /*normal=*/value::MemoryAbstractDomain(
-          value::PointerAbstractDomain(value::make_top_machine_int_domain(
-                                           _ctx.opts.machine_int_domain),
-                                       value::NullityAbstractDomain::top()),
-          value::UninitializedAbstractDomain::top(),
-          value::LifetimeAbstractDomain::top()),
-      /*caught_exceptions=*/value::MemoryAbstractDomain::bottom(),
-      /*propagated_exceptions=*/value::MemoryAbstractDomain::bottom());
+  value::AbstractDomain init_inv =
+      make_init_inv(_ctx, _ctx.opts.machine_int_domain);
+
+  if (_ctx.opts.jobs > 1 && _ctx.opts.fused_checks) {
+    log::warning("-fused-checks is not supported with -jobs, ignoring -jobs");
+  }
+
+  if (_ctx.opts.wto_jobs > 1 &&
+      (_ctx.opts.jobs > 1 || _ctx.opts.fused_checks)) {
+    log::warning("-wto-jobs is not supported with -jobs or -fused-checks, "
+                 "ignoring -wto-jobs");
+  }
+
+  if (_ctx.opts.jobs > 1 && !_ctx.opts.fused_checks) {
+    // Insert all functions in the database
+    std::vector< ar::Function* > functions;
+    for (auto it = bundle->function_begin(), et = bundle->function_end();
+         it != et;
+         ++it) {
+      _ctx.output_db->functions.insert(*it);
+      if ((*it)->is_definition()) {
+        functions.push_back(*it);
+      }
+    }
+
+    analyze_functions_parallel(_ctx,
+                               checkers,
+                               prover,
+                               std::move(functions),
+                               init_inv);
+    for (const auto& checker : checkers) {
+      checker->finish();
+    }
+    return;
+  }
 
   // Analyze every function in the bundle
   for (auto it = bundle->function_begin(), et = bundle->function_end();
@@ -268,23 +691,75 @@ void IntraproceduralValueAnalysis::run() {
       continue;
     }
 
+    if (_ctx.function_queue != nullptr &&
+        !_ctx.function_queue->claim(function)) {
+      log::debug([function] {
+        return "Skipping function claimed by another process: " +
+               demangle(function);
+      });
+      continue;
+    }
+
+    std::string hash;
+    if (_ctx.result_cache != nullptr &&
+        load_cached_checks(_ctx, function, hash)) {
+      continue;
+    }
+
     FunctionFixpoint fixpoint(_ctx, function);
+    ProgressFrame progress_frame(_ctx.progress, function);
+
+    // Without loops, the invariants are final as soon as they are computed,
+    // hence the checks are always fused with the single pass of the fixpoint
+    if (_ctx.opts.fused_checks ||
+        (_ctx.opts.wto_jobs <= 1 && fixpoint.wto().acyclic())) {
+      log::info("Analyzing and checking function: " +
+                demangle(function));
+      ScopeTimerDatabase t(_ctx.output_db->times,
+                           "ikos-analyzer.value." + function->name());
+      if (_ctx.result_cache != nullptr) {
+        _ctx.result_cache->start_recording(function);
+      }
+      fixpoint.run_and_check(init_inv, checkers);
+      refine_asserts(_ctx, prover, function);
+      if (_ctx.result_cache != nullptr) {
+        _ctx.result_cache->stop_recording(hash);
+      }
+      continue;
+    }
 
     {
-      log::info("Analyzing function: " + demangle(function->name()));
+      log::info("Analyzing function: " + demangle(function));
       ScopeTimerDatabase t(_ctx.output_db->times,
                            "ikos-analyzer.value." + function->name());
-      fixpoint.run(init_inv);
+      FunctionTraceScope trace_scope(fixpoint.function_tracer());
+      if (_ctx.opts.wto_jobs > 1) {
+        ConcurrentScope concurrent_scope;
+        fixpoint.run_concurrent(init_inv, _ctx.opts.wto_jobs);
+      } else {
+        fixpoint.run(init_inv);
+      }
     }
 
     {
       log::info("Checking properties and writing results for function: " +
-                demangle(function->name()));
+                demangle(function));
       ScopeTimerDatabase t(_ctx.output_db->times,
                            "ikos-analyzer.check." + function->name());
+      if (_ctx.result_cache != nullptr) {
+        _ctx.result_cache->start_recording(function);
+      }
       fixpoint.run_checks(checkers);
+      refine_asserts(_ctx, prover, function);
+      if (_ctx.result_cache != nullptr) {
+        _ctx.result_cache->stop_recording(hash);
+      }
     }
   }
+
+  for (const auto& checker : checkers) {
+    checker->finish();
+  }
 }
 
 } // end namespace analyzer
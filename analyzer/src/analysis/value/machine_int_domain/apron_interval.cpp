@@ -41,7 +41,7 @@
  *
  ******************************************************************************/
 
-#ifdef HAS_APRON
+#if defined(HAS_APRON) && !defined(IKOS_DOMAIN_DISABLED)
 #include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
 #include <ikos/core/domain/numeric/apron.hpp>
 #endif
@@ -54,7 +54,9 @@ namespace analyzer {
 namespace value {
 
 MachineIntAbstractDomain make_top_machine_int_apron_interval() {
-#ifdef HAS_APRON
+#if defined(IKOS_DOMAIN_DISABLED)
+  throw LogicError("ikos was compiled without the apron-interval domain");
+#elif defined(HAS_APRON)
   return MachineIntAbstractDomain(
       core::machine_int::NumericDomainAdapter<
           Variable*,
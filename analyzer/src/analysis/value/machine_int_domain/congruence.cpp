@@ -41,17 +41,24 @@
  *
  ******************************************************************************/
 
+#ifndef IKOS_DOMAIN_DISABLED
 #include <ikos/core/domain/machine_int/congruence.hpp>
+#endif
 
 #include <ikos/analyzer/analysis/value/machine_int_domain.hpp>
+#include <ikos/analyzer/exception.hpp>
 
 namespace ikos {
 namespace analyzer {
 namespace value {
 
 MachineIntAbstractDomain make_top_machine_int_congruence() {
+#ifdef IKOS_DOMAIN_DISABLED
+  throw LogicError("ikos was compiled without the congruence domain");
+#else
   return MachineIntAbstractDomain(
       core::machine_int::CongruenceDomain< Variable* >::top());
+#endif
 }
 
 } // end namespace value
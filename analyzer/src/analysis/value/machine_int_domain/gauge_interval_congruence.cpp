@@ -41,21 +41,29 @@
  *
  ******************************************************************************/
 
+#ifndef IKOS_DOMAIN_DISABLED
 #include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
 #include <ikos/core/domain/numeric/gauge_interval_congruence.hpp>
+#endif
 
 #include <ikos/analyzer/analysis/value/machine_int_domain.hpp>
+#include <ikos/analyzer/exception.hpp>
 
 namespace ikos {
 namespace analyzer {
 namespace value {
 
 MachineIntAbstractDomain make_top_machine_int_gauge_interval_congruence() {
+#ifdef IKOS_DOMAIN_DISABLED
+  throw LogicError(
+      "ikos was compiled without the gauge-interval-congruence domain");
+#else
   return MachineIntAbstractDomain(
       core::machine_int::NumericDomainAdapter<
           Variable*,
           core::numeric::GaugeIntervalCongruenceDomain< ZNumber,
                                                         Variable* > >::top());
+#endif
 }
 
 } // end namespace value
@@ -41,17 +41,24 @@
  *
  ******************************************************************************/
 
+#ifndef IKOS_DOMAIN_DISABLED
 #include <ikos/core/domain/machine_int/interval.hpp>
+#endif
 
 #include <ikos/analyzer/analysis/value/machine_int_domain.hpp>
+#include <ikos/analyzer/exception.hpp>
 
 namespace ikos {
 namespace analyzer {
 namespace value {
 
 MachineIntAbstractDomain make_top_machine_int_interval() {
+#ifdef IKOS_DOMAIN_DISABLED
+  throw LogicError("ikos was compiled without the interval domain");
+#else
   return MachineIntAbstractDomain(
       core::machine_int::IntervalDomain< Variable* >::top());
+#endif
 }
 
 } // end namespace value
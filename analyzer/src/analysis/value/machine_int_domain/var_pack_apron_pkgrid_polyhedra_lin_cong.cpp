@@ -42,7 +42,7 @@
  *
  ******************************************************************************/
 
-#ifdef HAS_APRON
+#if defined(HAS_APRON) && !defined(IKOS_DOMAIN_DISABLED)
 #include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
 #include <ikos/core/domain/numeric/apron.hpp>
 #include <ikos/core/domain/numeric/var_packing_domain.hpp>
@@ -57,7 +57,11 @@ namespace value {
 
 MachineIntAbstractDomain
 make_top_machine_int_var_pack_apron_pkgrid_polyhedra_lin_cong() {
-#ifdef HAS_APRON
+#if defined(IKOS_DOMAIN_DISABLED)
+  throw LogicError(
+      "ikos was compiled without the "
+      "var-pack-apron-pkgrid-polyhedra-lin-cong domain");
+#elif defined(HAS_APRON)
   return MachineIntAbstractDomain(
       core::machine_int::NumericDomainAdapter<
           Variable*,
@@ -41,7 +41,7 @@
  *
  ******************************************************************************/
 
-#ifdef HAS_APRON
+#if defined(HAS_APRON) && !defined(IKOS_DOMAIN_DISABLED)
 #include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
 #include <ikos/core/domain/numeric/apron.hpp>
 #include <ikos/core/domain/numeric/var_packing_domain.hpp>
@@ -56,7 +56,11 @@ namespace value {
 
 MachineIntAbstractDomain
 make_top_machine_int_var_pack_apron_ppl_linear_congruences() {
-#ifdef HAS_APRON
+#if defined(IKOS_DOMAIN_DISABLED)
+  throw LogicError(
+      "ikos was compiled without the "
+      "var-pack-apron-ppl-linear-congruences domain");
+#elif defined(HAS_APRON)
   return MachineIntAbstractDomain(
       core::machine_int::NumericDomainAdapter<
           Variable*,
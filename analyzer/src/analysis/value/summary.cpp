@@ -0,0 +1,446 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Bottom-up value analysis using function summaries implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ikos/core/fixpoint/fwd_fixpoint_iterator.hpp>
+
+#include <ikos/analyzer/analysis/call_graph.hpp>
+#include <ikos/analyzer/analysis/execution_engine/engine.hpp>
+#include <ikos/analyzer/analysis/execution_engine/numerical.hpp>
+#include <ikos/analyzer/analysis/execution_engine/summary.hpp>
+#include <ikos/analyzer/analysis/fixpoint_profile.hpp>
+#include <ikos/analyzer/analysis/fixpoint_trace.hpp>
+#include <ikos/analyzer/analysis/memory_budget.hpp>
+#include <ikos/analyzer/analysis/memory_location.hpp>
+#include <ikos/analyzer/analysis/pointer/pointer.hpp>
+#include <ikos/analyzer/analysis/progress.hpp>
+#include <ikos/analyzer/analysis/sparse_scalar.hpp>
+#include <ikos/analyzer/analysis/value/abstract_domain.hpp>
+#include <ikos/analyzer/analysis/value/machine_int_domain.hpp>
+#include <ikos/analyzer/analysis/value/summary.hpp>
+#include <ikos/analyzer/analysis/variable.hpp>
+#include <ikos/analyzer/analysis/wto.hpp>
+#include <ikos/analyzer/checker/checker.hpp>
+#include <ikos/analyzer/checker/query_cache.hpp>
+#include <ikos/analyzer/util/demangle.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
+#include <ikos/analyzer/util/log.hpp>
+#include <ikos/analyzer/util/timer.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+SummaryValueAnalysis::SummaryValueAnalysis(Context& ctx) : _ctx(ctx) {}
+
+SummaryValueAnalysis::~SummaryValueAnalysis() = default;
+
+namespace {
+
+using namespace value;
+
+/// \brief Table of function summaries for the value analysis
+using SummaryTable = FunctionSummaryTable< AbstractDomain >;
+
+/// \brief Fixpoint on a function body, using the summaries of its callees
+class FunctionFixpoint
+    : public core::InterleavedFwdFixpointIterator< const ar::CodeGraph*,
+                                                   AbstractDomain > {
+private:
+  /// \brief Parent class
+  using FwdFixpointIterator =
+      core::InterleavedFwdFixpointIterator< const ar::CodeGraph*,
+                                            AbstractDomain >;
+
+private:
+  /// \brief Analysis context
+  Context& _ctx;
+
+  /// \brief Analyzed function
+  ar::Function* _function;
+
+  /// \brief Empty call context
+  CallContext* _empty_call_context;
+
+  /// \brief Machine integer abstract domain
+  MachineIntDomainOption _machine_int_domain;
+
+  /// \brief Fixpoint profile
+  boost::optional< const FixpointProfile& > _profile;
+
+  /// \brief True if the current narrowing reached the iterations limit
+  bool _narrowing_capped = false;
+
+  /// \brief Summaries of the functions analyzed so far
+  const SummaryTable& _summaries;
+
+  /// \brief Fixpoint tracer, or null
+  std::unique_ptr< FunctionFixpointTracer > _tracer;
+
+  /// \brief Values of the sparse scalars, or null
+  std::unique_ptr< SparseScalarValues > _sparse_scalars;
+
+public:
+  /// \brief Create a function fixpoint iterator
+  FunctionFixpoint(Context& ctx,
+                   ar::Function* function,
+                   const SummaryTable& summaries)
+      : FwdFixpointIterator(function->body()->graph(),
+                            ctx.wto_cache->wto(function->body())),
+        _ctx(ctx),
+        _function(function),
+        _empty_call_context(ctx.call_context_factory->get_empty()),
+        _machine_int_domain(ctx.opts.machine_int_domain),
+        _profile(ctx.fixpoint_profiler == nullptr
+                     ? boost::none
+                     : ctx.fixpoint_profiler->profile(function)),
+        _summaries(summaries) {
+    if (ctx.fixpoint_trace != nullptr) {
+      this->_tracer =
+          std::make_unique< FunctionFixpointTracer >(*ctx.fixpoint_trace,
+                                                     function);
+      this->set_tracer(this->_tracer.get());
+    }
+    if (ctx.sparse_scalars != nullptr) {
+      const SparseScalarAnalysis::CodeInfo* info =
+          ctx.sparse_scalars->code_info(function->body());
+      if (info != nullptr) {
+        this->_sparse_scalars = std::make_unique< SparseScalarValues >(*info);
+      }
+    }
+  }
+
+  /// \brief Return the fixpoint tracer, or null
+  FunctionFixpointTracer* function_tracer() const {
+    return this->_tracer.get();
+  }
+
+  /// \brief Extrapolate the new state after an increasing iteration
+  AbstractDomain extrapolate(ar::BasicBlock* head,
+                             unsigned iteration,
+                             AbstractDomain before,
+                             AbstractDomain after) override {
+    if (this->_ctx.progress != nullptr) {
+      this->_ctx.progress->set_cycle(head, iteration, /* increasing = */ true);
+    }
+    if (this->_ctx.memory_budget != nullptr) {
+      this->_ctx.memory_budget->check(this->_function);
+    }
+    if (this->_ctx.opts.gc_loop_heads) {
+      NumericalExecutionEngine< AbstractDomain > exec_engine =
+          this->make_exec_engine(std::move(after));
+      exec_engine.collect_unreachable_memory();
+      after = std::move(exec_engine.inv());
+    }
+    if (iteration <= this->_ctx.opts.widening_delay) {
+      before.join_iter_with(after);
+      return before;
+    }
+    if (this->_profile) {
+      before.widen_threshold_with(after,
+                                  this->_profile->widening_thresholds());
+      return before;
+    }
+    before.widen_with(after);
+    return before;
+  }
+
+  /// \brief Refine the new state after a decreasing iteration
+  AbstractDomain refine(ar::BasicBlock* head,
+                        unsigned iteration,
+                        AbstractDomain before,
+                        AbstractDomain after) override {
+    if (this->_ctx.progress != nullptr) {
+      this->_ctx.progress->set_cycle(head, iteration, /* increasing = */ false);
+    }
+    this->_narrowing_capped = this->_ctx.opts.narrowing_iterations > 0 &&
+                              iteration >= this->_ctx.opts.narrowing_iterations;
+    return FwdFixpointIterator::refine(head,
+                                       iteration,
+                                       std::move(before),
+                                       std::move(after));
+  }
+
+  /// \brief Check if the decreasing iterations fixpoint is reached
+  bool is_decreasing_iterations_fixpoint(const AbstractDomain& before,
+                                         const AbstractDomain& after) override {
+    if (machine_int_domain_option_has_narrowing(this->_machine_int_domain)) {
+      return this->_narrowing_capped || before.leq(after);
+    } else {
+      return true; // stop after the first decreasing iteration
+    }
+  }
+
+  /// \brief Propagate the invariant through the basic block
+  AbstractDomain analyze_node(ar::BasicBlock* bb, AbstractDomain pre) override {
+    NumericalExecutionEngine< AbstractDomain > exec_engine =
+        this->make_exec_engine(std::move(pre));
+    SummaryCallExecutionEngine< AbstractDomain >
+        call_exec_engine(exec_engine, *_ctx.var_factory, this->_summaries);
+    exec_engine.exec_enter(bb);
+    for (ar::Statement* stmt : *bb) {
+      transfer_function(exec_engine, call_exec_engine, stmt);
+    }
+    exec_engine.exec_leave(bb);
+    return std::move(exec_engine.inv());
+  }
+
+  /// \brief Propagate the invariant through an edge
+  AbstractDomain analyze_edge(ar::BasicBlock* src,
+                              ar::BasicBlock* dest,
+                              AbstractDomain pre) override {
+    NumericalExecutionEngine< AbstractDomain > exec_engine =
+        this->make_exec_engine(std::move(pre));
+    exec_engine.exec_edge(src, dest);
+    return std::move(exec_engine.inv());
+  }
+
+  /// \brief Process the computed abstract value for a node
+  void process_pre(ar::BasicBlock* /*bb*/,
+                   const AbstractDomain& /*pre*/) override {}
+
+  /// \brief Process the computed abstract value for a node
+  void process_post(ar::BasicBlock* /*bb*/,
+                    const AbstractDomain& /*post*/) override {}
+
+  /// \brief Run the checks with the previously computed fix-point
+  void run_checks(const std::vector< std::unique_ptr< Checker > >& checkers) {
+    for (const auto& checker : checkers) {
+      checker->enter(this->_function, this->_empty_call_context);
+    }
+
+    // Check the function body
+    for (ar::BasicBlock* bb : *this->cfg()) {
+      this->check_block(checkers, bb, this->pre(bb));
+    }
+
+    for (const auto& checker : checkers) {
+      checker->leave(this->_function, this->_empty_call_context);
+    }
+  }
+
+  /// \brief Insert the summary of the function, using the previously computed
+  /// fix-point
+  ///
+  /// The summary is the invariant at the exit of the function, without the
+  /// local variables and the internal variables, except the parameters and the
+  /// returned value.
+  void insert_summary(SummaryTable& summaries) {
+    ar::Code* body = this->_function->body();
+
+    if (!body->has_exit_block()) {
+      // The function never returns
+      summaries.insert(this->_function, AbstractDomain::bottom(), nullptr);
+      return;
+    }
+
+    ar::BasicBlock* exit_bb = body->exit_block();
+    ar::ReturnValue* return_stmt = nullptr;
+    if (!exit_bb->empty() && isa< ar::ReturnValue >(exit_bb->back())) {
+      return_stmt = cast< ar::ReturnValue >(exit_bb->back());
+    }
+
+    NumericalExecutionEngine< AbstractDomain > exec_engine =
+        this->make_exec_engine(this->post(exit_bb));
+    AbstractDomain& inv = exec_engine.inv();
+    inv.ignore_exceptions();
+    exec_engine.deallocate_local_variables(this->_function
+                                               ->local_variable_begin(),
+                                           this->_function
+                                               ->local_variable_end());
+
+    for (auto it = body->internal_variable_begin(),
+              et = body->internal_variable_end();
+         it != et;
+         ++it) {
+      ar::InternalVariable* iv = *it;
+      if ((return_stmt != nullptr && return_stmt->has_operand() &&
+           return_stmt->operand() == iv) ||
+          std::find(this->_function->param_begin(),
+                    this->_function->param_end(),
+                    iv) != this->_function->param_end()) {
+        continue;
+      }
+      if (iv->type()->is_aggregate() &&
+          this->_ctx.opts.precision >= Precision::Memory) {
+        inv.normal().forget_mem(this->_ctx.mem_factory->get_aggregate(iv));
+      }
+      inv.normal().forget_surface(this->_ctx.var_factory->get_internal(iv));
+    }
+
+    summaries.insert(this->_function, std::move(inv), return_stmt);
+  }
+
+private:
+  /// \brief Create an execution engine with the given invariant
+  NumericalExecutionEngine< AbstractDomain > make_exec_engine(
+      AbstractDomain inv) {
+    NumericalExecutionEngine< AbstractDomain >
+        exec_engine(std::move(inv),
+                    _ctx,
+                    this->_empty_call_context,
+                    /* precision = */ _ctx.opts.precision,
+                    /* liveness = */ _ctx.liveness,
+                    /* pointer_info = */ _ctx.pointer == nullptr
+                        ? nullptr
+                        : &_ctx.pointer->results());
+    exec_engine.set_sparse_scalars(this->_sparse_scalars.get());
+    return exec_engine;
+  }
+
+  /// \brief Run the checks on the given basic block
+  void check_block(const std::vector< std::unique_ptr< Checker > >& checkers,
+                   ar::BasicBlock* bb,
+                   const AbstractDomain& pre) {
+    NumericalExecutionEngine< AbstractDomain > exec_engine =
+        this->make_exec_engine(pre);
+    SummaryCallExecutionEngine< AbstractDomain >
+        call_exec_engine(exec_engine, *_ctx.var_factory, this->_summaries);
+
+    exec_engine.exec_enter(bb);
+    for (const auto& checker : checkers) {
+      checker->enter(bb, exec_engine.inv(), this->_empty_call_context);
+    }
+
+    // Facts queried on a statement, shared by the checkers
+    StatementQueryCache query_cache;
+
+    for (ar::Statement* stmt : *bb) {
+      // Check the statement if it's related to an llvm instruction
+      if (stmt->has_frontend()) {
+        query_cache.bind(exec_engine.inv());
+        StatementQueryScope query_scope(&query_cache);
+        for (const auto& checker : checkers) {
+          if (checker->inspects(stmt)) {
+            checker->check(stmt, exec_engine.inv(), this->_empty_call_context);
+          }
+        }
+      }
+      // Propagate
+      transfer_function(exec_engine, call_exec_engine, stmt);
+    }
+
+    for (const auto& checker : checkers) {
+      checker->leave(bb, exec_engine.inv(), this->_empty_call_context);
+    }
+    exec_engine.exec_leave(bb);
+  }
+
+}; // end class FunctionFixpoint
+
+} // end anonymous namespace
+
+void SummaryValueAnalysis::run() {
+  // Bundle
+  ar::Bundle* bundle = _ctx.bundle;
+
+  // Create checkers
+  std::vector< std::unique_ptr< Checker > > checkers;
+  for (CheckerName name : _ctx.opts.analyses) {
+    checkers.emplace_back(make_checker(_ctx, name));
+  }
+
+  // Initial invariant
+  value::AbstractDomain init_inv(
+      /*normal=*/value::MemoryAbstractDomain(
+          value::PointerAbstractDomain(value::make_top_machine_int_domain(
+                                           _ctx.opts.machine_int_domain),
+                                       value::NullityAbstractDomain::top()),
+          value::UninitializedAbstractDomain::top(),
+          value::LifetimeAbstractDomain::top(),
+          _ctx.opts.smash_threshold,
+          _ctx.opts.array_segments),
+      /*caught_exceptions=*/value::MemoryAbstractDomain::bottom(),
+      /*propagated_exceptions=*/value::MemoryAbstractDomain::bottom());
+
+  // Insert all functions in the database
+  for (auto it = bundle->function_begin(), et = bundle->function_end();
+       it != et;
+       ++it) {
+    _ctx.output_db->functions.insert(*it);
+  }
+
+  SummaryTable summaries;
+
+  // Analyze every function in the bundle, callees first
+  //
+  // Recursive cycles are cut arbitrarily: a callee in the same strongly
+  // connected component, analyzed later, has no summary yet and is treated
+  // as an unknown function.
+  ikos_assert_msg(_ctx.call_graph != nullptr, "call graph is not computed");
+  for (ar::Function* function : _ctx.call_graph->bottom_up_order()) {
+    FunctionFixpoint fixpoint(_ctx, function, summaries);
+    ProgressFrame progress_frame(_ctx.progress, function);
+
+    {
+      log::info("Analyzing function: " + demangle(function));
+      ScopeTimerDatabase t(_ctx.output_db->times,
+                           "ikos-analyzer.value." + function->name());
+      FunctionTraceScope trace_scope(fixpoint.function_tracer());
+      fixpoint.run(init_inv);
+      fixpoint.insert_summary(summaries);
+    }
+
+    {
+      log::info("Checking properties and writing results for function: " +
+                demangle(function));
+      ScopeTimerDatabase t(_ctx.output_db->times,
+                           "ikos-analyzer.check." + function->name());
+      fixpoint.run_checks(checkers);
+    }
+  }
+
+  for (const auto& checker : checkers) {
+    checker->finish();
+  }
+
+  _ctx.output_db->times.insert("ikos-analyzer.value.summaries",
+                               static_cast< double >(summaries.size()));
+}
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -43,16 +43,48 @@
  *
  ******************************************************************************/
 
+#include <atomic>
+
 #include <ikos/analyzer/analysis/variable.hpp>
 #include <ikos/analyzer/exception.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
 
 namespace ikos {
 namespace analyzer {
 
 // Variable
 
+/// \brief Next identifier of variable
+///
+/// Identifiers below the number of variables of the AR are reserved for them.
+static std::atomic< core::Index > NextVariableId(0);
+
+/// \brief Reserve the identifiers [0, n) for the variables of the AR
+static void reserve_variable_ids(core::Index n) {
+  core::Index next = NextVariableId.load(std::memory_order_relaxed);
+  while (next < n && !NextVariableId.compare_exchange_weak(next, n)) {
+  }
+}
+
+/// \brief Return the identifier of the variable of the given AR variable
+static core::Index variable_id(ar::Value* var) {
+  if (var->has_index()) {
+    ikos_assert(var->index() < NextVariableId.load(std::memory_order_relaxed));
+    return var->index();
+  }
+  return NextVariableId.fetch_add(1, std::memory_order_relaxed);
+}
+
 Variable::Variable(VariableKind kind, ar::Type* type)
-    : _kind(kind), _type(type), _offset_var(nullptr) {
+    : _kind(kind),
+      _type(type),
+      _id(NextVariableId.fetch_add(1, std::memory_order_relaxed)),
+      _offset_var(nullptr) {
+  ikos_assert(this->_type != nullptr);
+}
+
+Variable::Variable(VariableKind kind, ar::Type* type, ar::Value* var)
+    : _kind(kind), _type(type), _id(variable_id(var)), _offset_var(nullptr) {
   ikos_assert(this->_type != nullptr);
 }
 
@@ -61,7 +93,7 @@ Variable::~Variable() = default;
 // LocalVariable
 
 LocalVariable::LocalVariable(ar::LocalVariable* var)
-    : Variable(LocalVariableKind, var->type()), _var(var) {
+    : Variable(LocalVariableKind, var->type(), var), _var(var) {
   ikos_assert(this->_var != nullptr);
 }
 
@@ -72,7 +104,7 @@ void LocalVariable::dump(std::ostream& o) const {
 // GlobalVariable
 
 GlobalVariable::GlobalVariable(ar::GlobalVariable* var)
-    : Variable(GlobalVariableKind, var->type()), _var(var) {
+    : Variable(GlobalVariableKind, var->type(), var), _var(var) {
   ikos_assert(this->_var != nullptr);
 }
 
@@ -83,7 +115,7 @@ void GlobalVariable::dump(std::ostream& o) const {
 // InternalVariable
 
 InternalVariable::InternalVariable(ar::InternalVariable* var)
-    : Variable(InternalVariableKind, var->type()), _var(var) {
+    : Variable(InternalVariableKind, var->type(), var), _var(var) {
   ikos_assert(this->_var != nullptr);
 }
 
@@ -195,18 +227,23 @@ void UnnamedShadowVariable::dump(std::ostream& o) const {
 
 VariableFactory::VariableFactory(ar::Bundle* bundle)
     : _ar_context(bundle->context()),
-      _size_type(ar::IntegerType::size_type(bundle)) {}
+      _size_type(ar::IntegerType::size_type(bundle)) {
+  if (FrontendInfo::is_set()) {
+    reserve_variable_ids(FrontendInfo::get().num_variables());
+  }
+}
 
 VariableFactory::~VariableFactory() = default;
 
 LocalVariable* VariableFactory::get_local(ar::LocalVariable* var) {
-  auto it = this->_local_variable_map.find(var);
-  if (it == this->_local_variable_map.end()) {
+  auto& shard = this->_local_variable_map.shard(var);
+  ConcurrentLockGuard lock(shard.mutex);
+  auto it = shard.map.find(var);
+  if (it == shard.map.end()) {
     auto vn = new LocalVariable(var);
     vn->set_offset_var(
         std::make_unique< OffsetVariable >(this->_size_type, vn));
-    this->_local_variable_map.try_emplace(var,
-                                          std::unique_ptr< LocalVariable >(vn));
+    shard.map.try_emplace(var, std::unique_ptr< LocalVariable >(vn));
     return vn;
   } else {
     return it->second.get();
@@ -214,14 +251,14 @@ LocalVariable* VariableFactory::get_local(ar::LocalVariable* var) {
 }
 
 GlobalVariable* VariableFactory::get_global(ar::GlobalVariable* var) {
-  auto it = this->_global_variable_map.find(var);
-  if (it == this->_global_variable_map.end()) {
+  auto& shard = this->_global_variable_map.shard(var);
+  ConcurrentLockGuard lock(shard.mutex);
+  auto it = shard.map.find(var);
+  if (it == shard.map.end()) {
     auto vn = new GlobalVariable(var);
     vn->set_offset_var(
         std::make_unique< OffsetVariable >(this->_size_type, vn));
-    this->_global_variable_map.try_emplace(var,
-                                           std::unique_ptr< GlobalVariable >(
-                                               vn));
+    shard.map.try_emplace(var, std::unique_ptr< GlobalVariable >(vn));
     return vn;
   } else {
     return it->second.get();
@@ -229,15 +266,16 @@ GlobalVariable* VariableFactory::get_global(ar::GlobalVariable* var) {
 }
 
 InternalVariable* VariableFactory::get_internal(ar::InternalVariable* var) {
-  auto it = this->_internal_variable_map.find(var);
-  if (it == this->_internal_variable_map.end()) {
+  auto& shard = this->_internal_variable_map.shard(var);
+  ConcurrentLockGuard lock(shard.mutex);
+  auto it = shard.map.find(var);
+  if (it == shard.map.end()) {
     auto vn = new InternalVariable(var);
     if (vn->type()->is_pointer() || vn->type()->is_aggregate()) {
       vn->set_offset_var(
           std::make_unique< OffsetVariable >(this->_size_type, vn));
     }
-    this->_internal_variable_map
-        .try_emplace(var, std::unique_ptr< InternalVariable >(vn));
+    shard.map.try_emplace(var, std::unique_ptr< InternalVariable >(vn));
     return vn;
   } else {
     return it->second.get();
@@ -246,13 +284,15 @@ InternalVariable* VariableFactory::get_internal(ar::InternalVariable* var) {
 
 InlineAssemblyPointerVariable* VariableFactory::get_asm_ptr(
     ar::InlineAssemblyConstant* cst) {
-  auto it = this->_inline_asm_pointer_map.find(cst);
-  if (it == this->_inline_asm_pointer_map.end()) {
+  auto& shard = this->_inline_asm_pointer_map.shard(cst);
+  ConcurrentLockGuard lock(shard.mutex);
+  auto it = shard.map.find(cst);
+  if (it == shard.map.end()) {
     auto vn = new InlineAssemblyPointerVariable(cst);
     vn->set_offset_var(
         std::make_unique< OffsetVariable >(this->_size_type, vn));
-    this->_inline_asm_pointer_map
-        .try_emplace(cst, std::unique_ptr< InlineAssemblyPointerVariable >(vn));
+    shard.map.try_emplace(cst,
+                          std::unique_ptr< InlineAssemblyPointerVariable >(vn));
     return vn;
   } else {
     return it->second.get();
@@ -260,13 +300,14 @@ InlineAssemblyPointerVariable* VariableFactory::get_asm_ptr(
 }
 
 FunctionPointerVariable* VariableFactory::get_function_ptr(ar::Function* fun) {
-  auto it = this->_function_pointer_map.find(fun);
-  if (it == this->_function_pointer_map.end()) {
+  auto& shard = this->_function_pointer_map.shard(fun);
+  ConcurrentLockGuard lock(shard.mutex);
+  auto it = shard.map.find(fun);
+  if (it == shard.map.end()) {
     auto vn = new FunctionPointerVariable(fun);
     vn->set_offset_var(
         std::make_unique< OffsetVariable >(this->_size_type, vn));
-    this->_function_pointer_map
-        .try_emplace(fun, std::unique_ptr< FunctionPointerVariable >(vn));
+    shard.map.try_emplace(fun, std::unique_ptr< FunctionPointerVariable >(vn));
     return vn;
   } else {
     return it->second.get();
@@ -278,41 +319,84 @@ FunctionPointerVariable* VariableFactory::get_function_ptr(
   return this->get_function_ptr(cst->function());
 }
 
+/// \brief Pack the given offset and size in a 64-bit key, if possible
+static bool pack_cell_key(const MachineInt& offset,
+                          const MachineInt& size,
+                          std::pair< uint64_t, uint64_t >& key) {
+  if (!offset.fits< uint64_t >() || !size.fits< uint64_t >()) {
+    return false;
+  }
+  key = {offset.to< uint64_t >(), size.to< uint64_t >()};
+  return true;
+}
+
 CellVariable* VariableFactory::get_cell(MemoryLocation* address,
                                         const MachineInt& offset,
                                         const MachineInt& size) {
-  auto key = std::make_tuple(address, offset, size);
-  auto it = this->_cell_map.find(key);
-  if (it == this->_cell_map.end()) {
-    // Create a memory cell variable
-    // A cell can be either an integer, a float or a pointer
-    // The integer type should have the right bit-width and be signed
-    // The parameter `size` is in bytes, compute bit-width = size * 8
-    bool overflow;
-    MachineInt eight(8, size.bit_width(), Unsigned);
-    MachineInt bit_width = mul(size, eight, overflow);
-    if (overflow || !bit_width.fits< unsigned >()) {
-      throw LogicError("variable factory: cell size too big");
+  auto& shard = this->_cell_map.shard(address);
+  ConcurrentLockGuard lock(shard.mutex);
+
+  std::pair< uint64_t, uint64_t > packed;
+  bool is_packed = pack_cell_key(offset, size, packed);
+  if (is_packed) {
+    auto it = shard.map.map.find({address, packed});
+    if (it != shard.map.map.end()) {
+      return it->second;
     }
-    ar::Type* type = ar::IntegerType::get(this->_ar_context,
-                                          bit_width.to< unsigned >(),
-                                          Signed);
-    auto vn = new CellVariable(type, address, offset, size);
-    vn->set_offset_var(
-        std::make_unique< OffsetVariable >(this->_size_type, vn));
-    this->_cell_map.emplace(key, std::unique_ptr< CellVariable >(vn));
-    return vn;
   } else {
-    return it->second.get();
+    auto it = shard.map.wide_map.find(std::make_tuple(address, offset, size));
+    if (it != shard.map.wide_map.end()) {
+      return it->second;
+    }
+  }
+
+  // Create a memory cell variable
+  // A cell can be either an integer, a float or a pointer
+  // The integer type should have the right bit-width and be signed
+  // The parameter `size` is in bytes, compute bit-width = size * 8
+  bool overflow;
+  MachineInt eight(8, size.bit_width(), Unsigned);
+  MachineInt bit_width = mul(size, eight, overflow);
+  if (overflow || !bit_width.fits< unsigned >()) {
+    throw LogicError("variable factory: cell size too big");
+  }
+  ar::Type* type = ar::IntegerType::get(this->_ar_context,
+                                        bit_width.to< unsigned >(),
+                                        Signed);
+  shard.map.arena.emplace_back(type, address, offset, size);
+  CellVariable* vn = &shard.map.arena.back();
+  vn->set_offset_var(std::make_unique< OffsetVariable >(this->_size_type, vn));
+  if (is_packed) {
+    shard.map.map.try_emplace({address, packed}, vn);
+  } else {
+    shard.map.wide_map.emplace(std::make_tuple(address, offset, size), vn);
+  }
+  return vn;
+}
+
+CellVariable* VariableFactory::lookup_cell(MemoryLocation* address,
+                                           const MachineInt& offset,
+                                           const MachineInt& size) {
+  auto& shard = this->_cell_map.shard(address);
+  ConcurrentLockGuard lock(shard.mutex);
+
+  std::pair< uint64_t, uint64_t > packed;
+  if (pack_cell_key(offset, size, packed)) {
+    auto it = shard.map.map.find({address, packed});
+    return (it != shard.map.map.end()) ? it->second : nullptr;
+  } else {
+    auto it = shard.map.wide_map.find(std::make_tuple(address, offset, size));
+    return (it != shard.map.wide_map.end()) ? it->second : nullptr;
   }
 }
 
 AllocSizeVariable* VariableFactory::get_alloc_size(MemoryLocation* address) {
-  auto it = this->_alloc_size_map.find(address);
-  if (it == this->_alloc_size_map.end()) {
+  auto& shard = this->_alloc_size_map.shard(address);
+  ConcurrentLockGuard lock(shard.mutex);
+  auto it = shard.map.find(address);
+  if (it == shard.map.end()) {
     auto vn = new AllocSizeVariable(this->_size_type, address);
-    this->_alloc_size_map.try_emplace(address,
-                                      std::unique_ptr< AllocSizeVariable >(vn));
+    shard.map.try_emplace(address, std::unique_ptr< AllocSizeVariable >(vn));
     return vn;
   } else {
     return it->second.get();
@@ -320,16 +404,16 @@ AllocSizeVariable* VariableFactory::get_alloc_size(MemoryLocation* address) {
 }
 
 ReturnVariable* VariableFactory::get_return(ar::Function* fun) {
-  auto it = this->_return_variable_map.find(fun);
-  if (it == this->_return_variable_map.end()) {
+  auto& shard = this->_return_variable_map.shard(fun);
+  ConcurrentLockGuard lock(shard.mutex);
+  auto it = shard.map.find(fun);
+  if (it == shard.map.end()) {
     auto vn = new ReturnVariable(fun);
     if (vn->type()->is_pointer() || vn->type()->is_aggregate()) {
       vn->set_offset_var(
           std::make_unique< OffsetVariable >(this->_size_type, vn));
     }
-    this->_return_variable_map.try_emplace(fun,
-                                           std::unique_ptr< ReturnVariable >(
-                                               vn));
+    shard.map.try_emplace(fun, std::unique_ptr< ReturnVariable >(vn));
     return vn;
   } else {
     return it->second.get();
@@ -338,15 +422,16 @@ ReturnVariable* VariableFactory::get_return(ar::Function* fun) {
 
 NamedShadowVariable* VariableFactory::get_named_shadow(ar::Type* type,
                                                        llvm::StringRef name) {
-  auto it = this->_named_shadow_variable_map.find(name);
-  if (it == this->_named_shadow_variable_map.end()) {
+  auto& shard = this->_named_shadow_variable_map.shard(name);
+  ConcurrentLockGuard lock(shard.mutex);
+  auto it = shard.map.find(name);
+  if (it == shard.map.end()) {
     auto vn = new NamedShadowVariable(type, name);
     if (vn->type()->is_pointer() || vn->type()->is_aggregate()) {
       vn->set_offset_var(
           std::make_unique< OffsetVariable >(this->_size_type, vn));
     }
-    this->_named_shadow_variable_map
-        .try_emplace(name, std::unique_ptr< NamedShadowVariable >(vn));
+    shard.map.try_emplace(name, std::unique_ptr< NamedShadowVariable >(vn));
     return vn;
   } else {
     return it->second.get();
@@ -354,6 +439,7 @@ NamedShadowVariable* VariableFactory::get_named_shadow(ar::Type* type,
 }
 
 UnnamedShadowVariable* VariableFactory::create_unnamed_shadow(ar::Type* type) {
+  ConcurrentLockGuard lock(this->_unnamed_shadow_variable_mutex);
   std::size_t id = this->_unnamed_shadow_variable_vec.size();
   auto vn = new UnnamedShadowVariable(type, id);
   if (vn->type()->is_pointer() || vn->type()->is_aggregate()) {
@@ -0,0 +1,206 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Variable packing pre-analysis implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <ikos/ar/semantic/statement.hpp>
+#include <ikos/ar/semantic/value.hpp>
+
+#include <ikos/analyzer/analysis/variable_packing.hpp>
+#include <ikos/analyzer/support/cast.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+namespace {
+
+/// \brief Union-find over the integer variables of a function, with bounded
+/// class sizes
+class PackBuilder {
+private:
+  struct Node {
+    Variable* parent;
+    std::size_t size;
+  };
+
+  /// \brief Variable factory
+  VariableFactory& _vfac;
+
+  /// \brief Union-find nodes
+  llvm::DenseMap< Variable*, Node > _nodes;
+
+public:
+  explicit PackBuilder(VariableFactory& vfac) : _vfac(vfac) {}
+
+  /// \brief Return the variable of the given value, or nullptr if the value
+  /// is not an integer variable
+  Variable* variable(ar::Value* value) const {
+    if (!value->type()->is_integer()) {
+      return nullptr;
+    }
+    if (auto iv = dyn_cast< ar::InternalVariable >(value)) {
+      return this->_vfac.get_internal(iv);
+    }
+    return nullptr;
+  }
+
+  /// \brief Find the root of the class containing `v`
+  Variable* find(Variable* v) {
+    auto it = this->_nodes.find(v);
+    if (it == this->_nodes.end()) {
+      this->_nodes.try_emplace(v, Node{v, 1});
+      return v;
+    }
+    Variable* parent = it->second.parent;
+    if (parent == v) {
+      return v;
+    }
+    Variable* root = this->find(parent);
+    this->_nodes[v].parent = root;
+    return root;
+  }
+
+  /// \brief Merge the classes of the variables of `x` and `y`, unless the
+  /// resulting pack would be too large
+  void relate(ar::Value* x, ar::Value* y) {
+    Variable* vx = this->variable(x);
+    Variable* vy = this->variable(y);
+    if (vx == nullptr || vy == nullptr) {
+      return;
+    }
+
+    Variable* rx = this->find(vx);
+    Variable* ry = this->find(vy);
+    if (rx == ry) {
+      return;
+    }
+
+    Node& nx = this->_nodes[rx];
+    Node& ny = this->_nodes[ry];
+    if (nx.size + ny.size > VariablePackingAnalysis::MaxPackSize) {
+      return;
+    }
+    if (nx.size < ny.size) {
+      nx.parent = ry;
+      ny.size += nx.size;
+    } else {
+      ny.parent = rx;
+      nx.size += ny.size;
+    }
+  }
+
+  /// \brief Call `f` on each pack of at least two variables
+  template < typename Function >
+  void for_each_pack(Function f) {
+    llvm::DenseMap< Variable*, std::vector< Variable* > > packs;
+    std::vector< Variable* > vars;
+    vars.reserve(this->_nodes.size());
+    for (const auto& entry : this->_nodes) {
+      vars.push_back(entry.first);
+    }
+    for (Variable* v : vars) {
+      packs[this->find(v)].push_back(v);
+    }
+    for (auto& entry : packs) {
+      if (entry.second.size() >= 2) {
+        f(std::move(entry.second));
+      }
+    }
+  }
+
+}; // end class PackBuilder
+
+} // end anonymous namespace
+
+VariablePackingAnalysis::VariablePackingAnalysis(Context& ctx) : _ctx(ctx) {}
+
+VariablePackingAnalysis::~VariablePackingAnalysis() {
+  for (const auto& pack : this->_packs) {
+    for (Variable* v : *pack) {
+      v->set_pack(nullptr);
+    }
+  }
+}
+
+void VariablePackingAnalysis::run() {
+  ar::Bundle* bundle = this->_ctx.bundle;
+
+  for (auto it = bundle->function_begin(), et = bundle->function_end();
+       it != et;
+       ++it) {
+    ar::Function* fun = *it;
+    if (fun->is_definition()) {
+      this->run(fun);
+    }
+  }
+}
+
+void VariablePackingAnalysis::run(ar::Function* fun) {
+  PackBuilder builder(*this->_ctx.var_factory);
+
+  for (ar::BasicBlock* bb : *fun->body()) {
+    for (ar::Statement* stmt : *bb) {
+      if (auto assign = dyn_cast< ar::Assignment >(stmt)) {
+        builder.relate(assign->result(), assign->operand());
+      } else if (auto unary = dyn_cast< ar::UnaryOperation >(stmt)) {
+        builder.relate(unary->result(), unary->operand());
+      } else if (auto binary = dyn_cast< ar::BinaryOperation >(stmt)) {
+        builder.relate(binary->result(), binary->left());
+        builder.relate(binary->result(), binary->right());
+      } else if (auto cmp = dyn_cast< ar::Comparison >(stmt)) {
+        builder.relate(cmp->left(), cmp->right());
+      }
+    }
+  }
+
+  builder.for_each_pack([this](std::vector< Variable* > vars) {
+    auto pack = std::make_unique< std::vector< Variable* > >(std::move(vars));
+    for (Variable* v : *pack) {
+      v->set_pack(pack.get());
+    }
+    this->_packs.push_back(std::move(pack));
+  });
+}
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -49,7 +49,17 @@
 namespace ikos {
 namespace analyzer {
 
-AssertProverChecker::AssertProverChecker(Context& ctx) : Checker(ctx) {}
+AssertProverChecker::AssertProverChecker(Context& ctx)
+    : Checker(ctx, statement_kinds({ar::Statement::CallKind})),
+      _defer_unproved(ctx.opts.assert_refine_domain &&
+                      ctx.opts.procedural == Procedural::Intraprocedural),
+      _refine(false) {}
+
+AssertProverChecker::AssertProverChecker(Context& ctx, AssertSet unproved)
+    : Checker(ctx, statement_kinds({ar::Statement::CallKind})),
+      _defer_unproved(false),
+      _refine(true),
+      _unproved(std::move(unproved)) {}
 
 CheckerName AssertProverChecker::name() const {
   return CheckerName::AssertProver;
@@ -59,15 +69,43 @@ const char* AssertProverChecker::description() const {
   return "Assertion prover checker";
 }
 
+void AssertProverChecker::leave(ar::Function* /*fun*/,
+                                CallContext* call_context) {
+  if (!this->_refine) {
+    return;
+  }
+
+  // Assertions not checked again
+  for (ar::Statement* stmt : this->_unproved) {
+    auto call = cast< ar::IntrinsicCall >(stmt);
+    this->_checks.insert(CheckKind::Assert,
+                         CheckerName::AssertProver,
+                         Result::Warning,
+                         stmt,
+                         call_context,
+                         std::array< ar::Value*, 1 >{{call->argument(0)}});
+  }
+  this->_unproved.clear();
+}
+
 void AssertProverChecker::check(ar::Statement* stmt,
                                 const value::AbstractDomain& inv,
                                 CallContext* call_context) {
+  if (this->_refine && !this->_unproved.erase(stmt)) {
+    return;
+  }
+
   if (auto call = dyn_cast< ar::IntrinsicCall >(stmt)) {
     ar::Function* fun = call->called_function();
 
     switch (fun->intrinsic_id()) {
       case ar::Intrinsic::IkosAssert: {
         CheckResult check = this->check_assert(call, inv);
+        if (check.result == Result::Warning && this->_defer_unproved) {
+          // Checked again with a relational domain
+          this->_unproved.insert(stmt);
+          break;
+        }
         this->display_invariant(check.result, call, inv);
         this->_checks.insert(check.kind,
                              CheckerName::AssertProver,
@@ -103,7 +141,7 @@ AssertProverChecker::CheckResult AssertProverChecker::check_assert(
 
   if (cond.is_undefined() ||
       (cond.is_machine_int_var() &&
-       inv.normal().uninitialized().is_uninitialized(cond.var()))) {
+       this->uninitialized(inv, cond.var()).is_uninitialized())) {
     // Undefined operand
     if (this->display_assert_check(Result::Error, call)) {
       out() << ": undefined operand" << std::endl;
@@ -182,7 +220,7 @@ void AssertProverChecker::exec_print_values(ar::IntrinsicCall* call,
         // ignored for now
       } else if (v.is_pointer_var()) {
         // points-to
-        PointsToSet points_to = inv.normal().pointers().points_to(v.var());
+        PointsToSet points_to = this->points_to(inv, v.var());
         out() << "\t";
         v.var()->dump(out());
         out() << " -> ";
@@ -197,7 +235,7 @@ void AssertProverChecker::exec_print_values(ar::IntrinsicCall* call,
               << "\n";
 
         // nullity
-        Nullity nullity_val = inv.normal().nullity().get(v.var());
+        Nullity nullity_val = this->nullity(inv, v.var());
         out() << "\t";
         v.var()->dump(out());
         if (nullity_val.is_null()) {
@@ -213,7 +251,7 @@ void AssertProverChecker::exec_print_values(ar::IntrinsicCall* call,
       }
 
       // initialized (available for all variables)
-      Uninitialized uninit_val = inv.normal().uninitialized().get(v.var());
+      Uninitialized uninit_val = this->uninitialized(inv, v.var());
       out() << "\t";
       v.var()->dump(out());
       if (uninit_val.is_uninitialized()) {
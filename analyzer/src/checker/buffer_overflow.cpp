@@ -43,6 +43,7 @@
 
 #include <ikos/analyzer/checker/buffer_overflow.hpp>
 #include <ikos/analyzer/json/helper.hpp>
+#include <ikos/analyzer/support/assert.hpp>
 #include <ikos/analyzer/support/cast.hpp>
 #include <ikos/analyzer/util/log.hpp>
 
@@ -50,12 +51,19 @@ namespace ikos {
 namespace analyzer {
 
 BufferOverflowChecker::BufferOverflowChecker(Context& ctx)
-    : Checker(ctx),
+    : Checker(ctx,
+              statement_kinds({ar::Statement::LoadKind,
+                               ar::Statement::StoreKind,
+                               ar::Statement::CallKind})),
       _ar_context(ctx.bundle->context()),
       _data_layout(ctx.bundle->data_layout()),
       _offset_type(ar::IntegerType::size_type(ctx.bundle)),
       _size_one(
-          ar::IntegerConstant::get(this->_ar_context, this->_offset_type, 1)) {}
+          ar::IntegerConstant::get(this->_ar_context, this->_offset_type, 1)),
+      _global_alloc_sizes(ctx.global_alloc_sizes) {
+  ikos_assert_msg(this->_global_alloc_sizes != nullptr,
+                  "global allocation sizes are not computed");
+}
 
 CheckerName BufferOverflowChecker::name() const {
   return CheckerName::BufferOverflow;
@@ -242,8 +250,8 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_mem_access(
     ar::Statement* stmt,
     ar::Value* pointer,
     ar::Value* access_size,
-    value::AbstractDomain inv) {
-  if (inv.is_normal_flow_bottom()) {
+    const value::AbstractDomain& pre) {
+  if (pre.is_normal_flow_bottom()) {
     // Statement unreachable
     if (this->display_mem_access_check(Result::Unreachable,
                                        stmt,
@@ -261,7 +269,7 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_mem_access(
 
   if (ptr.is_undefined() ||
       (ptr.is_pointer_var() &&
-       inv.normal().uninitialized().is_uninitialized(ptr.var()))) {
+       this->uninitialized(pre, ptr.var()).is_uninitialized())) {
     // Undefined pointer operand
     if (this->display_mem_access_check(Result::Error,
                                        stmt,
@@ -274,7 +282,7 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_mem_access(
 
   if (size.is_undefined() ||
       (size.is_machine_int_var() &&
-       inv.normal().uninitialized().is_uninitialized(size.var()))) {
+       this->uninitialized(pre, size.var()).is_uninitialized())) {
     // Undefined pointer operand
     if (this->display_mem_access_check(Result::Error,
                                        stmt,
@@ -288,7 +296,7 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_mem_access(
   // Check null pointer dereference
 
   if (ptr.is_null() ||
-      (ptr.is_pointer_var() && inv.normal().nullity().is_null(ptr.var()))) {
+      (ptr.is_pointer_var() && this->nullity(pre, ptr.var()).is_null())) {
     // Null pointer operand
     if (this->display_mem_access_check(Result::Error,
                                        stmt,
@@ -310,13 +318,15 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_mem_access(
   }
 
   // Initialize global variable pointer and function pointer
+  value::AbstractDomain inv(pre);
   this->init_global_ptr(pointer, inv);
 
   // Variable representing the pointer offset
   Variable* offset_var = inv.normal().pointers().offset_var(ptr.var());
 
   // Points-to set of the pointer
-  PointsToSet addrs = inv.normal().pointers().points_to(ptr.var());
+  PointsToSet addrs =
+      this->points_to(is_global_ptr(pointer) ? inv : pre, ptr.var());
 
   if (addrs.is_empty()) {
     // Pointer is invalid
@@ -376,13 +386,13 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_mem_access(
   bool all_valid = true;
   bool all_invalid = true;
 
+  OutOfBoundCache cache;
+
   for (auto addr : addrs) {
     AllocSizeVariable* size_var = _ctx.var_factory->get_alloc_size(addr);
-    this->init_global_alloc_size(addr, size_var, inv);
 
     // add block info
-    JsonDict block_info = {
-        {"id", _ctx.output_db->memory_locations.insert(addr)}};
+    JsonDict block_info = {{"id", this->memory_location_id(addr)}};
 
     // perform analysis
     auto result_pair = this->check_memory_location_access(stmt,
@@ -394,7 +404,8 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_mem_access(
                                                           offset_var,
                                                           offset_plus_size,
                                                           offset_intv,
-                                                          block_info);
+                                                          block_info,
+                                                          cache);
 
     block_info.put("status", static_cast< int >(result_pair.first));
     block_info.put("kind", static_cast< int >(result_pair.second));
@@ -409,6 +420,11 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_mem_access(
     }
 
     points_to_info.add(block_info);
+
+    if (!all_valid && !all_invalid) {
+      // The result is a warning, whatever the remaining memory locations
+      break;
+    }
   }
 
   info.put("points_to", points_to_info);
@@ -439,7 +455,8 @@ BufferOverflowChecker::check_memory_location_access(
     Variable* offset_var,
     Variable* offset_plus_size,
     const IntInterval& offset_intv,
-    JsonDict& block_info) {
+    JsonDict& block_info,
+    OutOfBoundCache& cache) {
   if (isa< FunctionMemoryLocation >(addr)) {
     // Try to dereference a function pointer, this is an error
     if (this->display_mem_access_check(Result::Error,
@@ -575,8 +592,13 @@ BufferOverflowChecker::check_memory_location_access(
     }
   }
 
+  // Global variables and functions have a constant size
+  const MachineInt* global_size = this->global_alloc_size(addr);
+
   // add `size` (min, max) to block_info
-  IntInterval size_intv = inv.normal().integers().to_interval(size_var);
+  IntInterval size_intv =
+      global_size != nullptr ? IntInterval(*global_size)
+                             : inv.normal().integers().to_interval(size_var);
   block_info.put("size", to_json(size_intv));
 
   // add `offset + access_size - size` (min, max) to block_info
@@ -584,20 +606,32 @@ BufferOverflowChecker::check_memory_location_access(
   MachineInt one(1, this->_data_layout.pointers.bit_width, Unsigned);
   IntLinearExpression expr(zero);
   expr.add(one, offset_plus_size);
-  expr.add(-one, size_var);
+  if (global_size != nullptr) {
+    expr -= *global_size;
+  } else {
+    expr.add(-one, size_var);
+  }
   IntInterval diff_intv = inv.normal().integers().to_interval(expr);
   block_info.put("diff", to_json(diff_intv));
 
-  // Checks: `offset > mem_size || offset + access_size > mem_size`
-  value::AbstractDomain tmp1(inv);
-  tmp1.normal().integers().add(IntPredicate::GT, offset_var, size_var);
-
-  value::AbstractDomain tmp2(inv);
-  tmp2.normal().integers().add(IntPredicate::GT, offset_plus_size, size_var);
-
-  bool is_bottom = tmp1.is_normal_flow_bottom() && tmp2.is_normal_flow_bottom();
+  // Memory locations with the same constant size give the same result
+  boost::optional< MachineInt > size_cst = size_intv.singleton();
+  Result result;
+  auto it = size_cst ? cache.find(*size_cst) : cache.end();
+  if (it != cache.end()) {
+    result = it->second;
+  } else {
+    result = this->check_out_of_bound(inv,
+                                      size_var,
+                                      global_size,
+                                      offset_var,
+                                      offset_plus_size);
+    if (size_cst) {
+      cache.emplace(*size_cst, result);
+    }
+  }
 
-  if (is_bottom) {
+  if (result == Result::Ok) {
     // offset_var <= size_var and offset_plus_size <= size_var, so we're
     // safe here
     if (this->display_mem_access_check(Result::Ok,
@@ -611,16 +645,7 @@ BufferOverflowChecker::check_memory_location_access(
       access_size->dump(out());
       out() << std::endl;
     }
-    return {Result::Ok, BufferOverflowCheckKind::OutOfBound};
-  }
-
-  // Check: `offset <= mem_size && offset + access_size <= mem_size`
-  value::AbstractDomain tmp3(inv);
-  tmp3.normal().integers().add(IntPredicate::LE, offset_var, size_var);
-  tmp3.normal().integers().add(IntPredicate::LE, offset_plus_size, size_var);
-  is_bottom = tmp3.is_normal_flow_bottom();
-
-  if (is_bottom) {
+  } else if (result == Result::Error) {
     if (this->display_mem_access_check(Result::Error,
                                        stmt,
                                        pointer,
@@ -632,7 +657,6 @@ BufferOverflowChecker::check_memory_location_access(
       access_size->dump(out());
       out() << std::endl;
     }
-    return {Result::Error, BufferOverflowCheckKind::OutOfBound};
   } else {
     if (this->display_mem_access_check(Result::Warning,
                                        stmt,
@@ -645,7 +669,66 @@ BufferOverflowChecker::check_memory_location_access(
       access_size->dump(out());
       out() << std::endl;
     }
-    return {Result::Warning, BufferOverflowCheckKind::OutOfBound};
+  }
+  return {result, BufferOverflowCheckKind::OutOfBound};
+}
+
+/// \brief Add the constraint `x pred size` where the size is `global_size` if
+/// it is not null, otherwise `size_var`
+static void add_size_constraint(value::AbstractDomain& inv,
+                                core::machine_int::Predicate pred,
+                                Variable* x,
+                                AllocSizeVariable* size_var,
+                                const MachineInt* global_size) {
+  if (global_size != nullptr) {
+    inv.normal().integers().add(pred, x, *global_size);
+  } else {
+    inv.normal().integers().add(pred, x, size_var);
+  }
+}
+
+Result BufferOverflowChecker::check_out_of_bound(
+    const value::AbstractDomain& inv,
+    AllocSizeVariable* size_var,
+    const MachineInt* global_size,
+    Variable* offset_var,
+    Variable* offset_plus_size) const {
+  // Checks: `offset > mem_size || offset + access_size > mem_size`
+  value::AbstractDomain tmp1(inv);
+  add_size_constraint(tmp1,
+                      IntPredicate::GT,
+                      offset_var,
+                      size_var,
+                      global_size);
+
+  value::AbstractDomain tmp2(inv);
+  add_size_constraint(tmp2,
+                      IntPredicate::GT,
+                      offset_plus_size,
+                      size_var,
+                      global_size);
+
+  if (tmp1.is_normal_flow_bottom() && tmp2.is_normal_flow_bottom()) {
+    return Result::Ok;
+  }
+
+  // Check: `offset <= mem_size && offset + access_size <= mem_size`
+  value::AbstractDomain tmp3(inv);
+  add_size_constraint(tmp3,
+                      IntPredicate::LE,
+                      offset_var,
+                      size_var,
+                      global_size);
+  add_size_constraint(tmp3,
+                      IntPredicate::LE,
+                      offset_plus_size,
+                      size_var,
+                      global_size);
+
+  if (tmp3.is_normal_flow_bottom()) {
+    return Result::Error;
+  } else {
+    return Result::Warning;
   }
 }
 
@@ -669,8 +752,8 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_strcpy(
     ar::Statement* stmt,
     ar::Value* dest_op,
     ar::Value* src_op,
-    value::AbstractDomain inv) {
-  if (inv.is_normal_flow_bottom()) {
+    const value::AbstractDomain& pre) {
+  if (pre.is_normal_flow_bottom()) {
     // Statement unreachable
     if (this->display_strcpy_check(Result::Unreachable,
                                    stmt,
@@ -688,7 +771,7 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_strcpy(
 
   if (src.is_undefined() ||
       (src.is_pointer_var() &&
-       inv.normal().uninitialized().is_uninitialized(src.var()))) {
+       this->uninitialized(pre, src.var()).is_uninitialized())) {
     // Undefined source pointer operand
     if (this->display_strcpy_check(Result::Error, stmt, dest_op, src_op)) {
       out() << ": undefined source pointer" << std::endl;
@@ -698,7 +781,7 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_strcpy(
 
   if (dest.is_undefined() ||
       (dest.is_pointer_var() &&
-       inv.normal().uninitialized().is_uninitialized(dest.var()))) {
+       this->uninitialized(pre, dest.var()).is_uninitialized())) {
     // Undefined destination pointer operand
     if (this->display_strcpy_check(Result::Error, stmt, dest_op, src_op)) {
       out() << ": undefined destination pointer" << std::endl;
@@ -709,7 +792,7 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_strcpy(
   // Check null pointer dereference
 
   if (src.is_null() ||
-      (src.is_pointer_var() && inv.normal().nullity().is_null(src.var()))) {
+      (src.is_pointer_var() && this->nullity(pre, src.var()).is_null())) {
     // Null source pointer operand
     if (this->display_mem_access_check(Result::Error, stmt, dest_op, src_op)) {
       out() << ": null source pointer" << std::endl;
@@ -718,7 +801,7 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_strcpy(
   }
 
   if (dest.is_null() ||
-      (dest.is_pointer_var() && inv.normal().nullity().is_null(dest.var()))) {
+      (dest.is_pointer_var() && this->nullity(pre, dest.var()).is_null())) {
     // Null destination pointer operand
     if (this->display_mem_access_check(Result::Error, stmt, dest_op, src_op)) {
       out() << ": null destination pointer" << std::endl;
@@ -737,11 +820,14 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_strcpy(
   }
 
   // Initialize global variable pointers and function pointers
+  value::AbstractDomain inv(pre);
   this->init_global_ptr(dest_op, inv);
   this->init_global_ptr(src_op, inv);
 
-  PointsToSet dest_addrs = inv.normal().pointers().points_to(dest.var());
-  PointsToSet src_addrs = inv.normal().pointers().points_to(src.var());
+  PointsToSet dest_addrs =
+      this->points_to(is_global_ptr(dest_op) ? inv : pre, dest.var());
+  PointsToSet src_addrs =
+      this->points_to(is_global_ptr(src_op) ? inv : pre, src.var());
 
   if (src_addrs.is_empty()) {
     // Source pointer is invalid
@@ -775,35 +861,74 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_strcpy(
 
   bool all_valid = true;
 
+  // Results by constant allocation sizes of the destination and source, since
+  // memory locations with the same constant size give the same result
+  std::map< std::pair< MachineInt, MachineInt >, bool > cache;
+
   for (auto dest_addr : dest_addrs) {
     AllocSizeVariable* dest_size = _ctx.var_factory->get_alloc_size(dest_addr);
-    this->init_global_alloc_size(dest_addr, dest_size, inv);
+    const MachineInt* dest_global_size = this->global_alloc_size(dest_addr);
     Variable* dest_offset = inv.normal().pointers().offset_var(dest.var());
     Variable* max_space_available =
         _ctx.var_factory->get_named_shadow(this->_offset_type,
                                            "shadow.max_space_available");
+    boost::optional< MachineInt > dest_size_cst =
+        dest_global_size != nullptr
+            ? *dest_global_size
+            : inv.normal().integers().to_interval(dest_size).singleton();
 
     for (auto src_addr : src_addrs) {
       AllocSizeVariable* src_size = _ctx.var_factory->get_alloc_size(src_addr);
-      this->init_global_alloc_size(src_addr, src_size, inv);
+      const MachineInt* src_global_size = this->global_alloc_size(src_addr);
       Variable* src_offset = inv.normal().pointers().offset_var(src.var());
       Variable* max_space_needed =
           _ctx.var_factory->get_named_shadow(this->_offset_type,
                                              "shadow.max_space_needed");
-
-      value::AbstractDomain tmp(inv);
-      tmp.normal().integers().apply(IntBinaryOperator::Sub,
-                                    max_space_available,
-                                    dest_size,
-                                    dest_offset);
-      tmp.normal().integers().apply(IntBinaryOperator::Sub,
+      boost::optional< MachineInt > src_size_cst =
+          src_global_size != nullptr
+              ? *src_global_size
+              : inv.normal().integers().to_interval(src_size).singleton();
+
+      bool is_bottom;
+      auto it = cache.end();
+      if (dest_size_cst && src_size_cst) {
+        it = cache.find({*dest_size_cst, *src_size_cst});
+      }
+      if (it != cache.end()) {
+        is_bottom = it->second;
+      } else {
+        value::AbstractDomain tmp(inv);
+        if (dest_global_size != nullptr) {
+          tmp.normal().integers().apply(IntBinaryOperator::Sub,
+                                        max_space_available,
+                                        *dest_global_size,
+                                        dest_offset);
+        } else {
+          tmp.normal().integers().apply(IntBinaryOperator::Sub,
+                                        max_space_available,
+                                        dest_size,
+                                        dest_offset);
+        }
+        if (src_global_size != nullptr) {
+          tmp.normal().integers().apply(IntBinaryOperator::Sub,
+                                        max_space_needed,
+                                        *src_global_size,
+                                        src_offset);
+        } else {
+          tmp.normal().integers().apply(IntBinaryOperator::Sub,
+                                        max_space_needed,
+                                        src_size,
+                                        src_offset);
+        }
+        tmp.normal().integers().add(IntPredicate::GT,
                                     max_space_needed,
-                                    src_size,
-                                    src_offset);
-      tmp.normal().integers().add(IntPredicate::GT,
-                                  max_space_needed,
-                                  max_space_available);
-      bool is_bottom = tmp.is_normal_flow_bottom();
+                                    max_space_available);
+        is_bottom = tmp.is_normal_flow_bottom();
+        if (dest_size_cst && src_size_cst) {
+          cache.emplace(std::make_pair(*dest_size_cst, *src_size_cst),
+                        is_bottom);
+        }
+      }
 
       if (is_bottom &&
           this->display_strcpy_check(Result::Ok, stmt, dest_op, src_op)) {
@@ -823,7 +948,15 @@ BufferOverflowChecker::CheckResult BufferOverflowChecker::check_strcpy(
         out() << " - d" << std::endl;
       }
 
-      all_valid = all_valid && is_bottom;
+      if (!is_bottom) {
+        // The result is a warning, whatever the remaining memory locations
+        all_valid = false;
+        break;
+      }
+    }
+
+    if (!all_valid) {
+      break;
     }
   }
 
@@ -862,19 +995,9 @@ void BufferOverflowChecker::init_global_ptr(ar::Value* value,
   }
 }
 
-void BufferOverflowChecker::init_global_alloc_size(MemoryLocation* addr,
-                                                   AllocSizeVariable* size_var,
-                                                   value::AbstractDomain& inv) {
-  if (auto gv = dyn_cast< GlobalMemoryLocation >(addr)) {
-    MachineInt size(this->_data_layout.store_size_in_bytes(
-                        gv->global_var()->type()->pointee()),
-                    this->_data_layout.pointers.bit_width,
-                    Unsigned);
-    inv.normal().integers().assign(size_var, size);
-  } else if (isa< FunctionMemoryLocation >(addr)) {
-    MachineInt size(0, this->_data_layout.pointers.bit_width, Unsigned);
-    inv.normal().integers().assign(size_var, size);
-  }
+bool BufferOverflowChecker::is_global_ptr(ar::Value* value) {
+  return isa< ar::GlobalVariable >(value) ||
+         isa< ar::FunctionPointerConstant >(value);
 }
 
 /// \brief Check whether an interval is a multiple of a number
@@ -57,6 +57,7 @@
 #include <ikos/analyzer/checker/soundness.hpp>
 #include <ikos/analyzer/checker/uninitialized_variable.hpp>
 #include <ikos/analyzer/checker/unsigned_int_overflow.hpp>
+#include <ikos/analyzer/util/concurrency.hpp>
 #include <ikos/analyzer/util/color.hpp>
 #include <ikos/analyzer/util/source_location.hpp>
 
@@ -70,6 +71,43 @@ void Checker::display_stmt_location(ar::Statement* s) const {
         << color::off();
 }
 
+sqlite::DbInt64 Checker::memory_location_id(MemoryLocation* mem_loc) {
+  ConcurrentLockGuard lock(this->_ctx.output_db->checkers_mutex);
+  return this->_ctx.output_db->memory_locations.insert(mem_loc);
+}
+
+sqlite::DbInt64 Checker::function_id(ar::Function* fun) {
+  ConcurrentLockGuard lock(this->_ctx.output_db->checkers_mutex);
+  return this->_ctx.output_db->functions.insert(fun);
+}
+
+core::Uninitialized Checker::uninitialized(const value::AbstractDomain& inv,
+                                           Variable* var) {
+  StatementQueryCache* cache = StatementQueryCache::thread_cache();
+  if (cache != nullptr && cache->is_bound_to(inv)) {
+    return cache->uninitialized(var);
+  }
+  return inv.normal().uninitialized().get(var);
+}
+
+core::Nullity Checker::nullity(const value::AbstractDomain& inv,
+                               Variable* ptr) {
+  StatementQueryCache* cache = StatementQueryCache::thread_cache();
+  if (cache != nullptr && cache->is_bound_to(inv)) {
+    return cache->nullity(ptr);
+  }
+  return inv.normal().nullity().get(ptr);
+}
+
+StatementQueryCache::PointsToSet Checker::points_to(
+    const value::AbstractDomain& inv, Variable* ptr) {
+  StatementQueryCache* cache = StatementQueryCache::thread_cache();
+  if (cache != nullptr && cache->is_bound_to(inv)) {
+    return cache->points_to(ptr);
+  }
+  return inv.normal().pointers().points_to(ptr);
+}
+
 void Checker::display_result(Result result) const {
   switch (result) {
     case Result::Ok: {
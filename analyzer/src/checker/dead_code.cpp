@@ -41,15 +41,15 @@
  *
  ******************************************************************************/
 
-#include <llvm/IR/Instructions.h>
-
 #include <ikos/analyzer/checker/dead_code.hpp>
-#include <ikos/analyzer/support/cast.hpp>
+#include <ikos/analyzer/support/assert.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
 
 namespace ikos {
 namespace analyzer {
 
-DeadCodeChecker::DeadCodeChecker(Context& ctx) : Checker(ctx) {}
+DeadCodeChecker::DeadCodeChecker(Context& ctx)
+    : Checker(ctx, StatementKinds()) {}
 
 CheckerName DeadCodeChecker::name() const {
   return CheckerName::DeadCode;
@@ -59,94 +59,103 @@ const char* DeadCodeChecker::description() const {
   return "Dead code checker";
 }
 
-void DeadCodeChecker::enter(ar::BasicBlock* /*bb*/,
-                            const value::AbstractDomain& /*inv*/,
+void DeadCodeChecker::enter(ar::Function* /*fun*/,
                             CallContext* /*call_context*/) {
-  this->_prev_stmt = nullptr;
+  this->_dead_blocks.emplace_back();
 }
 
-void DeadCodeChecker::check(ar::Statement* stmt,
-                            const value::AbstractDomain& inv,
-                            CallContext* call_context) {
-  if (skip_check(stmt)) {
+void DeadCodeChecker::leave(ar::Function* fun, CallContext* call_context) {
+  ikos_assert(!this->_dead_blocks.empty());
+  BasicBlockSet dead_blocks = std::move(this->_dead_blocks.back());
+  this->_dead_blocks.pop_back();
+
+  if (dead_blocks.empty()) {
     return;
   }
 
-  // Update _prev_stmt
-  ar::Statement* prev_stmt = this->_prev_stmt;
-  this->_prev_stmt = stmt;
+  BasicBlockSet visited;
+  std::vector< ar::BasicBlock* > worklist;
 
-  // Check if the current statement needs a check
-  if (!needs_check(prev_stmt, stmt->parent())) {
-    return;
+  for (ar::BasicBlock* entry : *fun->body()) {
+    if (dead_blocks.count(entry) == 0 || !visited.insert(entry).second) {
+      continue;
+    }
+
+    // Collect the maximal region of connected dead basic blocks, starting
+    // from the first one in the function body
+    ar::Statement* stmt = nullptr;
+    worklist.push_back(entry);
+    while (!worklist.empty()) {
+      ar::BasicBlock* bb = worklist.back();
+      worklist.pop_back();
+
+      if (stmt == nullptr) {
+        stmt = first_checked_statement(bb);
+      }
+
+      for (auto it = bb->successor_begin(), et = bb->successor_end(); it != et;
+           ++it) {
+        if (dead_blocks.count(*it) != 0 && visited.insert(*it).second) {
+          worklist.push_back(*it);
+        }
+      }
+      for (auto it = bb->predecessor_begin(), et = bb->predecessor_end();
+           it != et;
+           ++it) {
+        if (dead_blocks.count(*it) != 0 && visited.insert(*it).second) {
+          worklist.push_back(*it);
+        }
+      }
+    }
+
+    if (stmt == nullptr) {
+      // No debug information in the region
+      continue;
+    }
+
+    this->display_dead_code_check(Result::Unreachable, stmt);
+    this->_checks.insert(CheckKind::Unreachable,
+                         CheckerName::DeadCode,
+                         Result::Unreachable,
+                         stmt,
+                         call_context);
   }
+}
 
-  Result result =
-      inv.is_normal_flow_bottom() ? Result::Unreachable : Result::Ok;
-  this->display_dead_code_check(result, stmt);
-  this->display_invariant(result, stmt, inv);
-  this->_checks.insert(CheckKind::Unreachable,
-                       CheckerName::DeadCode,
-                       result,
-                       stmt,
-                       call_context);
+void DeadCodeChecker::enter(ar::BasicBlock* bb,
+                            const value::AbstractDomain& inv,
+                            CallContext* /*call_context*/) {
+  if (inv.is_normal_flow_bottom()) {
+    ikos_assert(!this->_dead_blocks.empty());
+    this->_dead_blocks.back().insert(bb);
+  }
 }
 
+void DeadCodeChecker::check(ar::Statement* /*stmt*/,
+                            const value::AbstractDomain& /*inv*/,
+                            CallContext* /*call_context*/) {}
+
 bool DeadCodeChecker::skip_check(ar::Statement* stmt) {
   if (!stmt->has_frontend()) {
     // No checks on statements without debug info
     return true;
   }
 
-  if (ar::isa< ar::Assignment >(stmt) || ar::isa< ar::UnaryOperation >(stmt)) {
-    auto value = stmt->frontend< llvm::Value >();
-
-    if (llvm::isa< llvm::PHINode >(value) ||
-        llvm::isa< llvm::CmpInst >(value)) {
-      // No checks on assignments for phi nodes and comparisons
-      return true;
-    }
+  if (FrontendInfo::get().is_phi_or_comparison(stmt)) {
+    // No checks on assignments for phi nodes and comparisons
+    return true;
   }
 
   return false;
 }
 
-bool DeadCodeChecker::needs_check(ar::Statement* prev_stmt,
-                                  ar::BasicBlock* bb) {
-  if (prev_stmt != nullptr) {
-    return isa< ar::Comparison >(prev_stmt) || isa< ar::CallBase >(prev_stmt);
-  }
-
-  // First statement of the basic block, look for predecessors
-  std::vector< ar::BasicBlock* > preds{bb->predecessor_begin(),
-                                       bb->predecessor_end()};
-
-  while (!preds.empty()) {
-    ar::BasicBlock* pred = preds.back();
-    preds.pop_back();
-
-    auto it = pred->rbegin(), et = pred->rend();
-
-    // Skip statements without debug info, as well as assignments
-    while (it != et && skip_check(*it)) {
-      ++it;
-    }
-
-    if (it == et) {
-      // Predecessor is empty, look further up
-      preds.insert(preds.end(),
-                   pred->predecessor_begin(),
-                   pred->predecessor_end());
-      continue;
-    }
-
-    ar::Statement* last_stmt = *it;
-    if (isa< ar::Comparison >(last_stmt) || isa< ar::CallBase >(last_stmt)) {
-      return true;
+ar::Statement* DeadCodeChecker::first_checked_statement(ar::BasicBlock* bb) {
+  for (ar::Statement* stmt : *bb) {
+    if (!skip_check(stmt)) {
+      return stmt;
     }
   }
-
-  return false;
+  return nullptr;
 }
 
 void DeadCodeChecker::display_dead_code_check(Result result,
@@ -50,7 +50,8 @@
 namespace ikos {
 namespace analyzer {
 
-DivisionByZeroChecker::DivisionByZeroChecker(Context& ctx) : Checker(ctx) {}
+DivisionByZeroChecker::DivisionByZeroChecker(Context& ctx)
+    : Checker(ctx, statement_kinds({ar::Statement::BinaryOperationKind})) {}
 
 CheckerName DivisionByZeroChecker::name() const {
   return CheckerName::DivisionByZero;
@@ -95,7 +96,7 @@ DivisionByZeroChecker::CheckResult DivisionByZeroChecker::check_division(
 
   if (lit.is_undefined() ||
       (lit.is_machine_int_var() &&
-       inv.normal().uninitialized().is_uninitialized(lit.var()))) {
+       this->uninitialized(inv, lit.var()).is_uninitialized())) {
     // Undefined operand
     if (this->display_division_check(Result::Error, stmt)) {
       out() << ": undefined operand" << std::endl;
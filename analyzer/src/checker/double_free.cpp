@@ -47,7 +47,8 @@
 namespace ikos {
 namespace analyzer {
 
-DoubleFreeChecker::DoubleFreeChecker(Context& ctx) : Checker(ctx) {}
+DoubleFreeChecker::DoubleFreeChecker(Context& ctx)
+    : Checker(ctx, statement_kinds({ar::Statement::CallKind})) {}
 
 CheckerName DoubleFreeChecker::name() const {
   return CheckerName::DoubleFree;
@@ -95,7 +96,7 @@ DoubleFreeChecker::CheckResult DoubleFreeChecker::check_double_free(
 
   if (ptr.is_undefined() ||
       (ptr.is_pointer_var() &&
-       inv.normal().uninitialized().is_uninitialized(ptr.var()))) {
+       this->uninitialized(inv, ptr.var()).is_uninitialized())) {
     if (this->display_double_free_check(Result::Error, stmt)) {
       out() << ": undefined operand" << std::endl;
     }
@@ -103,14 +104,14 @@ DoubleFreeChecker::CheckResult DoubleFreeChecker::check_double_free(
   }
 
   if (ptr.is_null() ||
-      (ptr.is_pointer_var() && inv.normal().nullity().is_null(ptr.var()))) {
+      (ptr.is_pointer_var() && this->nullity(inv, ptr.var()).is_null())) {
     if (this->display_double_free_check(Result::Ok, stmt)) {
       out() << ": safe call to free with NULL value" << std::endl;
     }
     return {CheckKind::Free, Result::Ok, {operand}, {}};
   }
 
-  PointsToSet addrs = inv.normal().pointers().points_to(ptr.var());
+  PointsToSet addrs = this->points_to(inv, ptr.var());
 
   if (addrs.is_empty()) {
     if (this->display_double_free_check(Result::Error, stmt)) {
@@ -131,8 +132,7 @@ DoubleFreeChecker::CheckResult DoubleFreeChecker::check_double_free(
   JsonList points_to_info;
 
   for (const auto& addr : addrs) {
-    JsonDict block_info = {
-        {"id", _ctx.output_db->memory_locations.insert(addr)}};
+    JsonDict block_info = {{"id", this->memory_location_id(addr)}};
     auto result = this->check_memory_location_free(stmt, inv, addr);
     block_info.put("status", static_cast< int >(result));
 
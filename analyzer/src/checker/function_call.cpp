@@ -50,7 +50,10 @@
 namespace ikos {
 namespace analyzer {
 
-FunctionCallChecker::FunctionCallChecker(Context& ctx) : Checker(ctx) {}
+FunctionCallChecker::FunctionCallChecker(Context& ctx)
+    : Checker(ctx,
+              statement_kinds({ar::Statement::CallKind,
+                               ar::Statement::InvokeKind})) {}
 
 CheckerName FunctionCallChecker::name() const {
   return CheckerName::FunctionCall;
@@ -92,7 +95,7 @@ FunctionCallChecker::CheckResult FunctionCallChecker::check_call(
 
   if (called.is_undefined() ||
       (called.is_pointer_var() &&
-       inv.normal().uninitialized().is_uninitialized(called.var()))) {
+       this->uninitialized(inv, called.var()).is_uninitialized())) {
     // Undefined call pointer operand
     if (this->display_call_check(Result::Error, call)) {
       out() << ": undefined call pointer operand" << std::endl;
@@ -106,7 +109,7 @@ FunctionCallChecker::CheckResult FunctionCallChecker::check_call(
   // Check null pointer dereference
 
   if (called.is_null() || (called.is_pointer_var() &&
-                           inv.normal().nullity().is_null(called.var()))) {
+                           this->nullity(inv, called.var()).is_null())) {
     // Null call pointer operand
     if (this->display_call_check(Result::Error, call)) {
       out() << ": null call pointer operand" << std::endl;
@@ -134,7 +137,7 @@ FunctionCallChecker::CheckResult FunctionCallChecker::check_call(
     callees = {_ctx.mem_factory->get_local(lv)};
   } else if (isa< ar::InternalVariable >(call->called())) {
     // Indirect call through a function pointer
-    callees = inv.normal().pointers().points_to(called.var());
+    callees = this->points_to(inv, called.var());
   } else {
     log::error("unexpected call pointer operand");
     return {CheckKind::UnexpectedOperand, Result::Error, {call->called()}, {}};
@@ -169,8 +172,7 @@ FunctionCallChecker::CheckResult FunctionCallChecker::check_call(
   JsonList points_to_info;
 
   for (MemoryLocation* addr : callees) {
-    JsonDict block_info = {
-        {"id", _ctx.output_db->memory_locations.insert(addr)}};
+    JsonDict block_info = {{"id", this->memory_location_id(addr)}};
 
     if (!isa< FunctionMemoryLocation >(addr)) {
       // Not a call to a function memory location, emit a warning
@@ -185,7 +187,7 @@ FunctionCallChecker::CheckResult FunctionCallChecker::check_call(
       all_valid = false;
     } else {
       ar::Function* callee = cast< FunctionMemoryLocation >(addr)->function();
-      block_info.put("fun_id", _ctx.output_db->functions.insert(callee));
+      block_info.put("fun_id", this->function_id(callee));
 
       if (!ar::TypeVerifier::is_valid_call(call, callee->type())) {
         // Ill-formed function call
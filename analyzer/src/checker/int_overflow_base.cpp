@@ -73,7 +73,165 @@ static char op_char(ar::BinaryOperation::Operator op) {
   }
 }
 
-IntOverflowCheckerBase::IntOverflowCheckerBase(Context& ctx) : Checker(ctx) {}
+/// \brief Return the range of the result of `stmt` that holds whatever the
+/// values of its operands are, or top
+static core::numeric::ZInterval definition_range(ar::Statement* stmt) {
+  using ZInterval = core::numeric::ZInterval;
+  using ZBound = core::Bound< ZNumber >;
+
+  auto type = cast< ar::IntegerType >(stmt->result()->type());
+
+  if (auto un = dyn_cast< ar::UnaryOperation >(stmt)) {
+    auto src = dyn_cast< ar::IntegerType >(un->operand()->type());
+    if (src == nullptr) {
+      return ZInterval::top();
+    }
+    if (un->op() == ar::UnaryOperation::ZExt) {
+      return ZInterval(ZBound(0),
+                       ZBound(MachineInt::max(src->bit_width(), Unsigned)
+                                  .to_z_number()));
+    }
+    if (un->op() == ar::UnaryOperation::SExt && type->is_signed()) {
+      return ZInterval(ZBound(
+                           MachineInt::min(src->bit_width(), Signed)
+                               .to_z_number()),
+                       ZBound(MachineInt::max(src->bit_width(), Signed)
+                                  .to_z_number()));
+    }
+  } else if (auto bin = dyn_cast< ar::BinaryOperation >(stmt)) {
+    auto left = dyn_cast< ar::IntegerConstant >(bin->left());
+    auto right = dyn_cast< ar::IntegerConstant >(bin->right());
+    switch (bin->op()) {
+      case ar::BinaryOperation::UAnd:
+      case ar::BinaryOperation::SAnd: {
+        // x & c is in [0, c] for c >= 0
+        auto mask = (right != nullptr) ? right : left;
+        if (mask != nullptr && mask->value().is_non_negative()) {
+          return ZInterval(ZBound(0), ZBound(mask->value().to_z_number()));
+        }
+      } break;
+      case ar::BinaryOperation::URem: {
+        // x % c is in [0, c - 1] for c > 0
+        if (right != nullptr && right->value().is_strictly_positive()) {
+          return ZInterval(ZBound(0),
+                           ZBound(right->value().to_z_number() - 1));
+        }
+      } break;
+      case ar::BinaryOperation::ULShr: {
+        // x >> c is in [0, 2^(n - c) - 1] for 0 < c < n
+        if (right != nullptr && right->value().is_strictly_positive() &&
+            right->value().to_z_number() < type->bit_width()) {
+          uint64_t width = type->bit_width() -
+                           right->value().to_z_number().to< uint64_t >();
+          return ZInterval(ZBound(0),
+                           ZBound(MachineInt::max(width, Unsigned)
+                                      .to_z_number()));
+        }
+      } break;
+      default: {
+        break;
+      }
+    }
+  }
+
+  return ZInterval::top();
+}
+
+IntOverflowCheckerBase::IntOverflowCheckerBase(Context& ctx)
+    : Checker(ctx, statement_kinds({ar::Statement::BinaryOperationKind})) {}
+
+void IntOverflowCheckerBase::enter(ar::Function* fun,
+                                   CallContext* /*call_context*/) {
+  if (!this->_ranged_functions.insert(fun).second) {
+    return;
+  }
+
+  // Join the ranges of all the definitions of each variable, since phi
+  // nodes are translated into several assignments
+  llvm::DenseMap< ar::InternalVariable*, ZInterval > ranges;
+  for (ar::BasicBlock* bb : *fun->body()) {
+    for (ar::Statement* stmt : *bb) {
+      if (!stmt->has_result() || !stmt->result()->type()->is_integer()) {
+        continue;
+      }
+      auto var = dyn_cast< ar::InternalVariable >(stmt->result());
+      if (var == nullptr) {
+        continue;
+      }
+      ZInterval range = definition_range(stmt);
+      auto res = ranges.try_emplace(var, range);
+      if (!res.second) {
+        res.first->second.join_with(range);
+      }
+    }
+  }
+
+  for (const auto& entry : ranges) {
+    if (!entry.second.is_top()) {
+      this->_static_ranges.try_emplace(entry.first, entry.second);
+    }
+  }
+}
+
+void IntOverflowCheckerBase::finish() {
+  this->_ctx.output_db->times
+      .insert("ikos-analyzer." + std::string(this->short_name()) +
+                  ".static-safe",
+              static_cast< double >(this->_num_static_safe));
+}
+
+IntOverflowCheckerBase::ZInterval IntOverflowCheckerBase::static_range(
+    ar::Value* value) const {
+  if (auto cst = dyn_cast< ar::IntegerConstant >(value)) {
+    return ZInterval(cst->value().to_z_number());
+  } else if (auto var = dyn_cast< ar::InternalVariable >(value)) {
+    auto it = this->_static_ranges.find(var);
+    if (it != this->_static_ranges.end()) {
+      return it->second;
+    }
+  }
+  return ZInterval::top();
+}
+
+bool IntOverflowCheckerBase::is_statically_safe(
+    ar::BinaryOperation* stmt) const {
+  ZInterval left = this->static_range(stmt->left());
+  if (left.is_top()) {
+    return false;
+  }
+  ZInterval right = this->static_range(stmt->right());
+  if (right.is_top()) {
+    return false;
+  }
+
+  ZInterval result;
+  switch (stmt->op()) {
+    case ar::BinaryOperation::SAdd:
+    case ar::BinaryOperation::UAdd: {
+      result = left + right;
+    } break;
+    case ar::BinaryOperation::SSub:
+    case ar::BinaryOperation::USub: {
+      result = left - right;
+    } break;
+    case ar::BinaryOperation::SMul:
+    case ar::BinaryOperation::UMul: {
+      result = left * right;
+    } break;
+    default: {
+      // Division and remainder, also checked for a division by zero
+      if (right.contains(0)) {
+        return false;
+      }
+      result = left / right;
+    } break;
+  }
+
+  auto type = cast< ar::IntegerType >(stmt->result()->type());
+  ZBound max(MachineInt::max(type->bit_width(), type->sign()).to_z_number());
+  ZBound min(MachineInt::min(type->bit_width(), type->sign()).to_z_number());
+  return !result.is_bottom() && result.lb() >= min && result.ub() <= max;
+}
 
 void IntOverflowCheckerBase::check_integer_overflow(
     ar::BinaryOperation* stmt,
@@ -106,12 +264,36 @@ IntOverflowCheckerBase::check_integer_overflow(
   const ScalarLit& left_lit = this->_lit_factory.get_scalar(stmt->left());
   const ScalarLit& right_lit = this->_lit_factory.get_scalar(stmt->right());
 
+  if (!left_lit.is_undefined() && !right_lit.is_undefined() &&
+      this->is_statically_safe(stmt)) {
+    // Safe on the ranges known from the AR, whatever the invariant is
+    bool initialized =
+        (!left_lit.is_machine_int_var() ||
+         !this->uninitialized(inv, left_lit.var()).is_uninitialized()) &&
+        (!right_lit.is_machine_int_var() ||
+         !this->uninitialized(inv, right_lit.var()).is_uninitialized());
+    if (initialized) {
+      this->_num_static_safe++;
+      if (this->display_int_overflow_check(Result::Ok, stmt)) {
+        out() << ": safe on the static ranges of the operands" << std::endl;
+      }
+      return {{this->underflow_check_kind(),
+               Result::Ok,
+               {stmt->left(), stmt->right()},
+               {}},
+              {this->overflow_check_kind(),
+               Result::Ok,
+               {stmt->left(), stmt->right()},
+               {}}};
+    }
+  }
+
   IntInterval left_interval;
   IntInterval right_interval;
 
   if (left_lit.is_undefined() ||
       (left_lit.is_machine_int_var() &&
-       inv.normal().uninitialized().is_uninitialized(left_lit.var()))) {
+       this->uninitialized(inv, left_lit.var()).is_uninitialized())) {
     // Undefined operand
     if (this->display_int_overflow_check(Result::Error, stmt)) {
       out() << ": undefined left operand" << std::endl;
@@ -129,7 +311,7 @@ IntOverflowCheckerBase::check_integer_overflow(
 
   if (right_lit.is_undefined() ||
       (right_lit.is_machine_int_var() &&
-       inv.normal().uninitialized().is_uninitialized(right_lit.var()))) {
+       this->uninitialized(inv, right_lit.var()).is_uninitialized())) {
     // Undefined operand
     if (this->display_int_overflow_check(Result::Error, stmt)) {
       out() << ": undefined right operand" << std::endl;
@@ -49,7 +49,12 @@
 namespace ikos {
 namespace analyzer {
 
-NullDereferenceChecker::NullDereferenceChecker(Context& ctx) : Checker(ctx) {}
+NullDereferenceChecker::NullDereferenceChecker(Context& ctx)
+    : Checker(ctx,
+              statement_kinds({ar::Statement::LoadKind,
+                               ar::Statement::StoreKind,
+                               ar::Statement::CallKind,
+                               ar::Statement::InvokeKind})) {}
 
 CheckerName NullDereferenceChecker::name() const {
   return CheckerName::NullPointerDereference;
@@ -132,7 +137,7 @@ NullDereferenceChecker::CheckResult NullDereferenceChecker::check_null(
 
   if (ptr.is_undefined() ||
       (ptr.is_pointer_var() &&
-       inv.normal().uninitialized().is_uninitialized(ptr.var()))) {
+       this->uninitialized(inv, ptr.var()).is_uninitialized())) {
     // Undefined operand
     if (this->display_null_check(Result::Error, stmt, operand)) {
       out() << ": undefined operand" << std::endl;
@@ -179,7 +184,7 @@ NullDereferenceChecker::CheckResult NullDereferenceChecker::check_null(
     return {CheckKind::NullPointerDereference, Result::Ok};
   }
 
-  core::Nullity null_val = inv.normal().nullity().get(ptr.var());
+  core::Nullity null_val = this->nullity(inv, ptr.var());
   if (null_val.is_null()) {
     // Pointer is definitely null
     if (this->display_null_check(Result::Error, stmt, operand)) {
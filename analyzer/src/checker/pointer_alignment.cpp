@@ -51,7 +51,11 @@ namespace ikos {
 namespace analyzer {
 
 PointerAlignmentChecker::PointerAlignmentChecker(Context& ctx)
-    : Checker(ctx), _data_layout(ctx.bundle->data_layout()) {}
+    : Checker(ctx,
+              statement_kinds({ar::Statement::LoadKind,
+                               ar::Statement::StoreKind,
+                               ar::Statement::CallKind})),
+      _data_layout(ctx.bundle->data_layout()) {}
 
 CheckerName PointerAlignmentChecker::name() const {
   return CheckerName::UnalignedPointer;
@@ -140,7 +144,7 @@ PointerAlignmentChecker::CheckResult PointerAlignmentChecker::check_alignment(
 
   if (ptr.is_undefined() ||
       (ptr.is_pointer_var() &&
-       inv.normal().uninitialized().is_uninitialized(ptr.var()))) {
+       this->uninitialized(inv, ptr.var()).is_uninitialized())) {
     // Undefined operand
     if (this->display_alignment_check(Result::Error, stmt, operand)) {
       out() << ": undefined operand" << std::endl;
@@ -149,7 +153,7 @@ PointerAlignmentChecker::CheckResult PointerAlignmentChecker::check_alignment(
   }
 
   if (ptr.is_null() ||
-      (ptr.is_pointer_var() && inv.normal().nullity().is_null(ptr.var()))) {
+      (ptr.is_pointer_var() && this->nullity(inv, ptr.var()).is_null())) {
     // Null operand
     if (this->display_alignment_check(Result::Error, stmt, operand)) {
       out() << ": null operand" << std::endl;
@@ -177,7 +181,7 @@ PointerAlignmentChecker::CheckResult PointerAlignmentChecker::check_alignment(
   Variable* offset_var = inv.normal().pointers().offset_var(ptr_var);
 
   // Points-to set of the pointer
-  PointsToSet addrs = inv.normal().pointers().points_to(ptr_var);
+  PointsToSet addrs = this->points_to(inv, ptr_var);
 
   if (auto gv = dyn_cast< ar::GlobalVariable >(operand)) {
     addrs = PointsToSet{_ctx.mem_factory->get_global(gv)};
@@ -230,8 +234,7 @@ PointerAlignmentChecker::CheckResult PointerAlignmentChecker::check_alignment(
 
   for (MemoryLocation* addr : addrs) {
     // Add info to json
-    JsonDict block_info = {
-        {"id", _ctx.output_db->memory_locations.insert(addr)}};
+    JsonDict block_info = {{"id", this->memory_location_id(addr)}};
 
     // Is the points_to correctly aligned?
     Result is_correctly_aligned =
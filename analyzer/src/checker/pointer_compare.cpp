@@ -49,7 +49,8 @@
 namespace ikos {
 namespace analyzer {
 
-PointerCompareChecker::PointerCompareChecker(Context& ctx) : Checker(ctx) {}
+PointerCompareChecker::PointerCompareChecker(Context& ctx)
+    : Checker(ctx, statement_kinds({ar::Statement::ComparisonKind})) {}
 
 CheckerName PointerCompareChecker::name() const {
   return CheckerName::PointerCompare;
@@ -96,7 +97,7 @@ PointerCompareChecker::CheckResult PointerCompareChecker::check_pointer_compare(
 
   if (left_ptr.is_undefined() ||
       (left_ptr.is_pointer_var() &&
-       inv.normal().uninitialized().is_uninitialized(left_ptr.var()))) {
+       this->uninitialized(inv, left_ptr.var()).is_uninitialized())) {
     if (this->display_pointer_compare_check(Result::Error, stmt)) {
       out() << ": undefined left operand" << std::endl;
     }
@@ -106,7 +107,7 @@ PointerCompareChecker::CheckResult PointerCompareChecker::check_pointer_compare(
             {}};
   } else if (right_ptr.is_undefined() ||
              (right_ptr.is_pointer_var() &&
-              inv.normal().uninitialized().is_uninitialized(right_ptr.var()))) {
+              this->uninitialized(inv, right_ptr.var()).is_uninitialized())) {
     if (this->display_pointer_compare_check(Result::Error, stmt)) {
       out() << ": undefined right operand" << std::endl;
     }
@@ -119,7 +120,7 @@ PointerCompareChecker::CheckResult PointerCompareChecker::check_pointer_compare(
   // Check for null operands
 
   if (left_ptr.is_null() || (left_ptr.is_pointer_var() &&
-                             inv.normal().nullity().is_null(left_ptr.var()))) {
+                             this->nullity(inv, left_ptr.var()).is_null())) {
     if (this->display_pointer_compare_check(Result::Error, stmt)) {
       out() << ": null left operand" << std::endl;
     }
@@ -129,7 +130,7 @@ PointerCompareChecker::CheckResult PointerCompareChecker::check_pointer_compare(
             {}};
   } else if (right_ptr.is_null() ||
              (right_ptr.is_pointer_var() &&
-              inv.normal().nullity().is_null(right_ptr.var()))) {
+              this->nullity(inv, right_ptr.var()).is_null())) {
     if (this->display_pointer_compare_check(Result::Error, stmt)) {
       out() << ": null right operand" << std::endl;
     }
@@ -153,7 +154,7 @@ PointerCompareChecker::CheckResult PointerCompareChecker::check_pointer_compare(
   } else if (auto cst = dyn_cast< ar::FunctionPointerConstant >(stmt->left())) {
     left_addrs = {_ctx.mem_factory->get_function(cst->function())};
   } else {
-    left_addrs = inv.normal().pointers().points_to(left_ptr.var());
+    left_addrs = this->points_to(inv, left_ptr.var());
   }
 
   PointsToSet right_addrs;
@@ -163,7 +164,7 @@ PointerCompareChecker::CheckResult PointerCompareChecker::check_pointer_compare(
                  dyn_cast< ar::FunctionPointerConstant >(stmt->right())) {
     right_addrs = {_ctx.mem_factory->get_function(cst->function())};
   } else {
-    right_addrs = inv.normal().pointers().points_to(right_ptr.var());
+    right_addrs = this->points_to(inv, right_ptr.var());
   }
 
   if (left_addrs.is_empty()) {
@@ -206,7 +207,7 @@ PointerCompareChecker::CheckResult PointerCompareChecker::check_pointer_compare(
     if (left_addrs.is_set()) {
       JsonList left_points_to;
       for (MemoryLocation* mem_loc : left_addrs) {
-        left_points_to.add(_ctx.output_db->memory_locations.insert(mem_loc));
+        left_points_to.add(this->memory_location_id(mem_loc));
       }
       info.put("left_points_to", left_points_to);
     } else {
@@ -216,7 +217,7 @@ PointerCompareChecker::CheckResult PointerCompareChecker::check_pointer_compare(
     if (right_addrs.is_set()) {
       JsonList right_points_to;
       for (MemoryLocation* mem_loc : right_addrs) {
-        right_points_to.add(_ctx.output_db->memory_locations.insert(mem_loc));
+        right_points_to.add(this->memory_location_id(mem_loc));
       }
       info.put("right_points_to", right_points_to);
     } else {
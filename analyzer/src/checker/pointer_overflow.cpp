@@ -50,7 +50,8 @@ namespace ikos {
 namespace analyzer {
 
 PointerOverflowChecker::PointerOverflowChecker(Context& ctx)
-    : Checker(ctx), _data_layout(ctx.bundle->data_layout()) {}
+    : Checker(ctx, statement_kinds({ar::Statement::PointerShiftKind})),
+      _data_layout(ctx.bundle->data_layout()) {}
 
 CheckerName PointerOverflowChecker::name() const {
   return CheckerName::PointerOverflow;
@@ -90,7 +91,7 @@ PointerOverflowChecker::CheckResult PointerOverflowChecker::
 
   if (base.is_undefined() ||
       (base.is_pointer_var() &&
-       inv.normal().uninitialized().is_uninitialized(base.var()))) {
+       this->uninitialized(inv, base.var()).is_uninitialized())) {
     if (this->display_pointer_overflow_check(Result::Error, stmt)) {
       out() << ": undefined base operand" << std::endl;
     }
@@ -129,7 +130,7 @@ PointerOverflowChecker::CheckResult PointerOverflowChecker::
 
     if (offset.is_undefined() ||
         (offset.is_machine_int_var() &&
-         inv.normal().uninitialized().is_uninitialized(offset.var()))) {
+         this->uninitialized(inv, offset.var()).is_uninitialized())) {
       if (this->display_pointer_overflow_check(Result::Error, stmt)) {
         out() << ": undefined operand" << std::endl;
       }
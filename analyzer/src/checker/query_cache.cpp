@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of the cache of the queries of the checkers
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+
+#include <ikos/analyzer/checker/query_cache.hpp>
+#include <ikos/analyzer/util/concurrency.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+// StatementQueryCache
+
+thread_local StatementQueryCache* StatementQueryCache::ThreadCache = nullptr;
+
+void StatementQueryCache::bind(const value::AbstractDomain& inv) {
+  this->_inv = &inv;
+  this->_entries.clear();
+}
+
+core::Uninitialized StatementQueryCache::uninitialized(Variable* var) {
+  ConcurrentLockGuard lock(this->_mutex);
+  Entry& entry = this->entry(var);
+  if (!entry.uninitialized) {
+    entry.uninitialized = this->_inv->normal().uninitialized().get(var);
+  }
+  return *entry.uninitialized;
+}
+
+core::Nullity StatementQueryCache::nullity(Variable* ptr) {
+  ConcurrentLockGuard lock(this->_mutex);
+  Entry& entry = this->entry(ptr);
+  if (!entry.nullity) {
+    entry.nullity = this->_inv->normal().nullity().get(ptr);
+  }
+  return *entry.nullity;
+}
+
+StatementQueryCache::PointsToSet StatementQueryCache::points_to(Variable* ptr) {
+  ConcurrentLockGuard lock(this->_mutex);
+  Entry& entry = this->entry(ptr);
+  if (!entry.points_to) {
+    entry.points_to = this->_inv->normal().pointers().points_to(ptr);
+  }
+  return *entry.points_to;
+}
+
+StatementQueryCache::Entry& StatementQueryCache::entry(Variable* var) {
+  auto it =
+      std::find_if(this->_entries.begin(),
+                   this->_entries.end(),
+                   [var](const Entry& entry) { return entry.var == var; });
+  if (it != this->_entries.end()) {
+    return *it;
+  }
+  this->_entries.push_back(Entry{var, boost::none, boost::none, boost::none});
+  return this->_entries.back();
+}
+
+} // end namespace analyzer
+} // end namespace ikos
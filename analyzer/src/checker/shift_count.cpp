@@ -50,7 +50,8 @@
 namespace ikos {
 namespace analyzer {
 
-ShiftCountChecker::ShiftCountChecker(Context& ctx) : Checker(ctx) {}
+ShiftCountChecker::ShiftCountChecker(Context& ctx)
+    : Checker(ctx, statement_kinds({ar::Statement::BinaryOperationKind})) {}
 
 CheckerName ShiftCountChecker::name() const {
   return CheckerName::ShiftCount;
@@ -98,7 +99,7 @@ ShiftCountChecker::CheckResult ShiftCountChecker::check_shift_count(
   IntInterval shift_count_interval;
   if (shift_count.is_undefined() ||
       (shift_count.is_machine_int_var() &&
-       inv.normal().uninitialized().is_uninitialized(shift_count.var()))) {
+       this->uninitialized(inv, shift_count.var()).is_uninitialized())) {
     if (this->display_shift_count_check(Result::Error, stmt)) {
       out() << ": undefined shift count" << std::endl;
     }
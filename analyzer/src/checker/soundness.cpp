@@ -49,7 +49,11 @@
 namespace ikos {
 namespace analyzer {
 
-SoundnessChecker::SoundnessChecker(Context& ctx) : Checker(ctx) {}
+SoundnessChecker::SoundnessChecker(Context& ctx)
+    : Checker(ctx,
+              statement_kinds({ar::Statement::StoreKind,
+                               ar::Statement::CallKind,
+                               ar::Statement::InvokeKind})) {}
 
 CheckerName SoundnessChecker::name() const {
   return CheckerName::Soundness;
@@ -152,7 +156,7 @@ boost::optional< SoundnessChecker::CheckResult > SoundnessChecker::
   // Check uninitialized
   if (ptr.is_undefined() ||
       (ptr.is_pointer_var() &&
-       inv.normal().uninitialized().is_uninitialized(ptr.var()))) {
+       this->uninitialized(inv, ptr.var()).is_uninitialized())) {
     // Undefined pointer operand
     if (this->display_soundness_check(Result::Error, stmt)) {
       out() << ": undefined pointer operand" << std::endl;
@@ -162,7 +166,7 @@ boost::optional< SoundnessChecker::CheckResult > SoundnessChecker::
 
   // Check null pointer dereference
   if (ptr.is_null() ||
-      (ptr.is_pointer_var() && inv.normal().nullity().is_null(ptr.var()))) {
+      (ptr.is_pointer_var() && this->nullity(inv, ptr.var()).is_null())) {
     // Null pointer operand
     if (this->display_soundness_check(Result::Error, stmt)) {
       out() << ": null pointer dereference" << std::endl;
@@ -183,7 +187,7 @@ boost::optional< SoundnessChecker::CheckResult > SoundnessChecker::
   }
 
   // Points-to set of the pointer
-  PointsToSet addrs = inv.normal().pointers().points_to(ptr.var());
+  PointsToSet addrs = this->points_to(inv, ptr.var());
 
   if (addrs.is_empty()) {
     // Pointer is invalid
@@ -223,7 +227,7 @@ boost::optional< SoundnessChecker::CheckResult > SoundnessChecker::check_free(
   // Check uninitialized
   if (ptr.is_undefined() ||
       (ptr.is_pointer_var() &&
-       inv.normal().uninitialized().is_uninitialized(ptr.var()))) {
+       this->uninitialized(inv, ptr.var()).is_uninitialized())) {
     // Undefined pointer operand
     if (this->display_soundness_check(Result::Error, call)) {
       out() << ": undefined pointer operand" << std::endl;
@@ -233,7 +237,7 @@ boost::optional< SoundnessChecker::CheckResult > SoundnessChecker::check_free(
 
   // Check null pointer dereference
   if (ptr.is_null() ||
-      (ptr.is_pointer_var() && inv.normal().nullity().is_null(ptr.var()))) {
+      (ptr.is_pointer_var() && this->nullity(inv, ptr.var()).is_null())) {
     // Null pointer argument, safe
     if (this->display_soundness_check(Result::Error, call)) {
       out() << ": safe call to free with NULL value" << std::endl;
@@ -254,7 +258,7 @@ boost::optional< SoundnessChecker::CheckResult > SoundnessChecker::check_free(
   }
 
   // Points-to set of the pointer
-  PointsToSet addrs = inv.normal().pointers().points_to(ptr.var());
+  PointsToSet addrs = this->points_to(inv, ptr.var());
 
   if (addrs.is_top()) {
     // Ignored memory access because points-to set is top
@@ -284,7 +288,7 @@ std::vector< SoundnessChecker::CheckResult > SoundnessChecker::check_call(
 
   if (called.is_undefined() ||
       (called.is_pointer_var() &&
-       inv.normal().uninitialized().is_uninitialized(called.var()))) {
+       this->uninitialized(inv, called.var()).is_uninitialized())) {
     // Undefined call pointer operand
     if (this->display_soundness_check(Result::Error, call)) {
       out() << ": undefined call pointer operand" << std::endl;
@@ -299,7 +303,7 @@ std::vector< SoundnessChecker::CheckResult > SoundnessChecker::check_call(
   // Check null pointer dereference
 
   if (called.is_null() || (called.is_pointer_var() &&
-                           inv.normal().nullity().is_null(called.var()))) {
+                           this->nullity(inv, called.var()).is_null())) {
     // Null call pointer operand
     if (this->display_soundness_check(Result::Error, call)) {
       out() << ": null call pointer operand" << std::endl;
@@ -325,7 +329,7 @@ std::vector< SoundnessChecker::CheckResult > SoundnessChecker::check_call(
     callees = {_ctx.mem_factory->get_local(lv)};
   } else if (isa< ar::InternalVariable >(call->called())) {
     // Indirect call through a function pointer
-    callees = inv.normal().pointers().points_to(called.var());
+    callees = this->points_to(inv, called.var());
   } else {
     log::error("unexpected call pointer operand");
     return {{CheckKind::UnexpectedOperand, Result::Error, {call->called()}}};
@@ -375,9 +379,9 @@ std::vector< SoundnessChecker::CheckResult > SoundnessChecker::check_call(
       const ScalarLit& ptr = this->_lit_factory.get_scalar(arg);
       ikos_assert(ptr.is_pointer_var());
 
-      if (!inv.normal().uninitialized().is_uninitialized(ptr.var()) &&
-          !inv.normal().nullity().is_null(ptr.var()) &&
-          inv.normal().pointers().points_to(ptr.var()).is_top()) {
+      if (!this->uninitialized(inv, ptr.var()).is_uninitialized() &&
+          !this->nullity(inv, ptr.var()).is_null() &&
+          this->points_to(inv, ptr.var()).is_top()) {
         // Ignored side effect on the memory because points-to set is top
         if (this->display_soundness_check(Result::Warning, call)) {
           out() << ": ignored call side effect on pointer ";
@@ -118,7 +118,7 @@ boost::optional< Result > UninitializedVariableChecker::check_initialized(
     return Result::Ok;
   } else if (auto iv = dyn_cast< ar::InternalVariable >(operand)) {
     Variable* var = _ctx.var_factory->get_internal(iv);
-    core::Uninitialized uninit_val = inv.normal().uninitialized().get(var);
+    core::Uninitialized uninit_val = this->uninitialized(inv, var);
 
     if (uninit_val.is_uninitialized()) {
       return Result::Error;
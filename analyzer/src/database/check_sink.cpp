@@ -0,0 +1,216 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Streaming output of the checks implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <ikos/ar/semantic/code.hpp>
+#include <ikos/ar/semantic/function.hpp>
+
+#include <ikos/analyzer/database/check_sink.hpp>
+#include <ikos/analyzer/database/table/operands.hpp>
+#include <ikos/analyzer/util/demangle.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
+#include <ikos/analyzer/util/source_location.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+// CheckSink
+
+CheckSink::~CheckSink() = default;
+
+namespace {
+
+/// \brief Return the demangled name of the function containing a statement
+std::string function_name(ar::Statement* stmt) {
+  ar::Code* code = stmt->parent()->code();
+  ikos_assert(code->is_function_body());
+  return demangle(code->function());
+}
+
+/// \brief Return the textual representations of the given operands
+JsonList operands_repr(llvm::ArrayRef< ar::Value* > operands) {
+  JsonList l;
+  for (auto operand : operands) {
+    l.add(OperandsTable::repr(operand));
+  }
+  return l;
+}
+
+/// \brief Return the list of callers of a calling context, innermost first
+JsonList call_context_repr(CallContext* call_context) {
+  JsonList l;
+  for (CallContext* c = call_context; c != nullptr && !c->empty();
+       c = c->parent()) {
+    l.add(function_name(c->call()));
+  }
+  return l;
+}
+
+} // end anonymous namespace
+
+// JsonLinesCheckSink
+
+JsonLinesCheckSink::JsonLinesCheckSink(const std::string& path, bool flush)
+    : _out(path), _flush(flush) {}
+
+void JsonLinesCheckSink::write(CheckKind kind,
+                               CheckerName checker,
+                               Result status,
+                               ar::Statement* stmt,
+                               CallContext* call_context,
+                               llvm::ArrayRef< ar::Value* > operands,
+                               const JsonDict& info) {
+  JsonDict check;
+  check.put("kind", static_cast< int >(kind));
+  check.put("checker", checker_short_name(checker));
+  check.put("status", result_str(status));
+  check.put("function", function_name(stmt));
+
+  SourceLocation loc = source_location(stmt);
+  if (loc) {
+    check.put("file", loc.path().string());
+    check.put("line", loc.line());
+    check.put("column", loc.column());
+  }
+  if (!operands.empty()) {
+    check.put("operands", operands_repr(operands));
+  }
+  check.put("call_context", call_context_repr(call_context));
+  if (!info.empty()) {
+    check.put("info", info);
+  }
+
+  this->_out << check << '\n';
+  if (this->_flush) {
+    this->_out.flush();
+  }
+}
+
+void JsonLinesCheckSink::close() {
+  this->_out.flush();
+}
+
+// SarifCheckSink
+
+SarifCheckSink::SarifCheckSink(const std::string& path) : _out(path) {
+  this->_out << "{\"version\":\"2.1.0\","
+                "\"$schema\":\"https://json.schemastore.org/sarif-2.1.0.json\","
+                "\"runs\":[{\"tool\":{\"driver\":{\"name\":\"ikos\"}},"
+                "\"results\":[";
+}
+
+void SarifCheckSink::write(CheckKind kind,
+                           CheckerName checker,
+                           Result status,
+                           ar::Statement* stmt,
+                           CallContext* call_context,
+                           llvm::ArrayRef< ar::Value* > operands,
+                           const JsonDict& info) {
+  ikos_assert(!this->_closed);
+
+  std::string message = checker_long_name(checker);
+  message += ": ";
+  message += result_str(status);
+  message += " in function ";
+  message += function_name(stmt);
+
+  JsonDict result;
+  result.put("ruleId", checker_short_name(checker));
+  switch (status) {
+    case Result::Error: {
+      result.put("level", "error");
+    } break;
+    case Result::Warning: {
+      result.put("level", "warning");
+    } break;
+    default: {
+      result.put("level", "note");
+    } break;
+  }
+  result.put("message", JsonDict{{"text", message}});
+
+  SourceLocation loc = source_location(stmt);
+  if (loc) {
+    JsonDict region = {{"startLine", loc.line()},
+                       {"startColumn", loc.column()}};
+    JsonDict physical_location = {
+        {"artifactLocation", JsonDict{{"uri", loc.path().string()}}},
+        {"region", region}};
+    JsonList locations;
+    locations.add(JsonDict{{"physicalLocation", physical_location}});
+    result.put("locations", locations);
+  }
+
+  JsonDict properties;
+  properties.put("kind", static_cast< int >(kind));
+  if (!operands.empty()) {
+    properties.put("operands", operands_repr(operands));
+  }
+  properties.put("callContext", call_context_repr(call_context));
+  if (!info.empty()) {
+    properties.put("info", info);
+  }
+  result.put("properties", properties);
+
+  if (!this->_first) {
+    this->_out << ',';
+  }
+  this->_out << result << '\n';
+  this->_first = false;
+}
+
+void SarifCheckSink::close() {
+  if (this->_closed) {
+    return;
+  }
+  this->_out << "]}]}\n";
+  this->_out.flush();
+  this->_closed = true;
+}
+
+SarifCheckSink::~SarifCheckSink() {
+  this->close();
+}
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -46,19 +46,59 @@
 namespace ikos {
 namespace analyzer {
 
-OutputDatabase::OutputDatabase(sqlite::DbConnection& db_)
+OutputDatabase::OutputDatabase(sqlite::DbConnection& db_,
+                               CheckSink* sink,
+                               bool compact_checks,
+                               bool aggregate_checks,
+                               bool compress_columns)
     : db(db_),
       settings(db_),
       times(db_),
       files(db_),
       functions(db_, files),
       statements(db_, files, functions),
-      operands(db_),
+      compression_dictionaries(db_, compress_columns),
+      operands(db_, compression_dictionaries),
       call_contexts(db_, functions, statements),
       memory_locations(db_, functions, statements, call_contexts),
-      checks(db_, statements, operands, call_contexts) {
+      check_counters(db_),
+      checks(db_,
+             statements,
+             operands,
+             call_contexts,
+             compression_dictionaries,
+             sink,
+             compact_checks ? &check_counters : nullptr,
+             aggregate_checks),
+      profile(db_, functions, call_contexts),
+      downgrades(db_, functions, call_contexts),
+      _sink(sink) {
   this->db.set_commit_policy(sqlite::CommitPolicy::Auto);
 }
 
+void OutputDatabase::finalize(unsigned jobs) {
+  this->checks.finalize();
+  this->db.flush();
+  if (jobs > 1) {
+    this->db.set_threads(static_cast< int >(jobs - 1));
+  }
+  this->settings.create_indexes();
+  this->times.create_indexes();
+  this->files.create_indexes();
+  this->functions.create_indexes();
+  this->statements.create_indexes();
+  this->compression_dictionaries.create_indexes();
+  this->operands.create_indexes();
+  this->call_contexts.create_indexes();
+  this->memory_locations.create_indexes();
+  this->check_counters.create_indexes();
+  this->checks.create_indexes();
+  this->profile.create_indexes();
+  this->downgrades.create_indexes();
+  if (this->_sink != nullptr) {
+    this->_sink->close();
+  }
+}
+
 } // end namespace analyzer
 } // end namespace ikos
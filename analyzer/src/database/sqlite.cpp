@@ -43,6 +43,7 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
 #include <sstream>
 
 #include <ikos/core/support/compiler.hpp>
@@ -204,6 +205,7 @@ void DbConnection::begin_transaction() {
 
 void DbConnection::commit_transaction() {
   ikos_assert(this->_commit_policy == CommitPolicy::Manual);
+  this->flush();
   this->exec_command("COMMIT");
 }
 
@@ -214,6 +216,7 @@ void DbConnection::rollback_transaction() {
 
 void DbConnection::set_commit_policy(CommitPolicy policy) {
   if (this->_commit_policy == CommitPolicy::Auto) {
+    this->flush();
     this->exec_command("COMMIT");
     this->_inserted_rows = 0;
   }
@@ -226,11 +229,30 @@ void DbConnection::set_commit_policy(CommitPolicy policy) {
   }
 }
 
-void DbConnection::row_inserted() {
+void DbConnection::set_max_rows_per_transaction(std::size_t n) {
+  ikos_assert_msg(n > 0, "invalid number of rows per transaction");
+  this->_max_rows_per_transaction = n;
+}
+
+void DbConnection::flush() {
+  for (DbOstream* stream : this->_streams) {
+    stream->write_buffered_rows();
+  }
+}
+
+void DbConnection::commit() {
+  ikos_assert(this->_commit_policy == CommitPolicy::Auto);
+  this->flush();
+  this->exec_command("COMMIT");
+  this->_inserted_rows = 0;
+  this->exec_command("BEGIN");
+}
+
+void DbConnection::rows_inserted(std::size_t n) {
   if (this->_commit_policy == CommitPolicy::Auto) {
-    this->_inserted_rows++;
+    this->_inserted_rows += n;
 
-    if (this->_inserted_rows >= MaxRowsPerTransaction) {
+    if (this->_inserted_rows >= this->_max_rows_per_transaction) {
       this->exec_command("COMMIT");
       this->_inserted_rows = 0;
       this->exec_command("BEGIN");
@@ -274,13 +296,13 @@ void DbConnection::create_table(
 
 void DbConnection::create_index(StringRef index,
                                 StringRef table,
-                                StringRef column) {
+                                StringRef columns) {
   std::string cmd("CREATE INDEX IF NOT EXISTS ");
   cmd += index;
   cmd += " ON ";
   cmd += table;
   cmd += '(';
-  cmd += column;
+  cmd += columns;
   cmd += ')';
   this->exec_command(cmd.c_str());
 }
@@ -325,94 +347,267 @@ void DbConnection::set_synchronous_flag(SynchronousFlag flag) {
   }
 }
 
-// DbOstream
+void DbConnection::set_page_size(int bytes) {
+  this->exec_command("PRAGMA page_size = " + std::to_string(bytes));
+}
 
-DbOstream::DbOstream(DbConnection& db, StringRef table_name, int columns)
-    : _db(db), _columns(columns) {
-  ikos_assert_msg(columns > 0, "invalid number of columns");
+void DbConnection::set_cache_size(int kib) {
+  // A negative value is a size in KiB, a positive value is a number of pages
+  this->exec_command("PRAGMA cache_size = -" + std::to_string(kib));
+}
+
+void DbConnection::set_threads(int n) {
+  this->exec_command("PRAGMA threads = " + std::to_string(n));
+}
+
+void DbConnection::save(const std::string& filename) {
+  this->flush();
+
+  sqlite3* dest = nullptr;
+  int status = sqlite3_open_v2(filename.c_str(),
+                               &dest,
+                               SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE,
+                               nullptr);
+  if (status != SQLITE_OK) {
+    sqlite3_close(dest);
+    throw DbError(status,
+                  "DbConnection::save(): cannot open database: " + filename);
+  }
 
+  sqlite3_backup* backup =
+      sqlite3_backup_init(dest, "main", this->_handle, "main");
+  if (backup == nullptr) {
+    status = sqlite3_errcode(dest);
+    sqlite3_close(dest);
+    throw DbError(status,
+                  "DbConnection::save(): cannot initialize the backup to " +
+                      filename);
+  }
+
+  status = sqlite3_backup_step(backup, -1);
+  sqlite3_backup_finish(backup);
+  sqlite3_close(dest);
+  if (status != SQLITE_DONE) {
+    throw DbError(status, "DbConnection::save(): cannot copy to " + filename);
+  }
+}
+
+// DbOstream
+
+/// \brief Prepare a statement inserting `rows` rows in the given table
+static sqlite3_stmt* prepare_insert(DbConnection& db,
+                                    sqlite3* handle,
+                                    StringRef table_name,
+                                    int columns,
+                                    int rows) {
   // Create SQL command
   std::string insert("INSERT INTO ");
   insert += table_name;
-  insert += " VALUES (";
-  for (int i = 0; i < columns; i++) {
-    insert += '?';
-    insert += (i + 1 < columns) ? ',' : ')';
+  insert += " VALUES ";
+  for (int r = 0; r < rows; r++) {
+    insert += '(';
+    for (int i = 0; i < columns; i++) {
+      insert += '?';
+      insert += (i + 1 < columns) ? ',' : ')';
+    }
+    insert += (r + 1 < rows) ? ',' : ' ';
   }
 
-  int status = sqlite3_prepare_v2(this->_db._handle,
-                                  insert.c_str(),
-                                  -1,
-                                  &this->_stmt,
-                                  nullptr);
+  sqlite3_stmt* stmt = nullptr;
+  int status = sqlite3_prepare_v2(handle, insert.c_str(), -1, &stmt, nullptr);
   if (status != SQLITE_OK) {
     throw DbError(status,
                   "DbOstream: cannot populate " + table_name.to_string() +
-                      " in database " + this->_db.filename());
+                      " in database " + db.filename());
+  }
+  return stmt;
+}
+
+/// \brief Return the number of rows inserted by a batch statement
+static int batch_rows(int columns) {
+  int rows = DbOstream::MaxParameters / std::max(1, columns);
+  if (rows > DbOstream::MaxRowsPerInsert) {
+    rows = DbOstream::MaxRowsPerInsert;
+  }
+  return std::max(1, rows);
+}
+
+DbOstream::DbOstream(DbConnection& db, StringRef table_name, int columns)
+    : _db(db),
+      _columns(columns),
+      _batch_rows(batch_rows(columns)) {
+  ikos_assert_msg(columns > 0, "invalid number of columns");
+
+  this->_stmt =
+      prepare_insert(this->_db, this->_db._handle, table_name, columns, 1);
+  if (this->_batch_rows > 1) {
+    try {
+      this->_batch_stmt = prepare_insert(this->_db,
+                                         this->_db._handle,
+                                         table_name,
+                                         columns,
+                                         this->_batch_rows);
+    } catch (...) {
+      sqlite3_finalize(this->_stmt);
+      throw;
+    }
   }
+  this->_values.resize(static_cast< std::size_t >(this->_batch_rows) *
+                       static_cast< std::size_t >(columns));
+  this->_db._streams.push_back(this);
 }
 
 DbOstream::~DbOstream() {
   // The destructor shall not throw an exception. No error check is performed.
-  sqlite3_finalize(_stmt);
+  try {
+    this->write_buffered_rows();
+  } catch (...) {
+  }
+  auto& streams = this->_db._streams;
+  streams.erase(std::remove(streams.begin(), streams.end(), this),
+                streams.end());
+  sqlite3_finalize(this->_batch_stmt);
+  sqlite3_finalize(this->_stmt);
+}
+
+DbOstream::Value& DbOstream::current_value() {
+  ikos_assert_msg(this->_current_column <= this->_columns, "too many columns");
+  std::size_t index = static_cast< std::size_t >(this->_buffered_rows) *
+                          static_cast< std::size_t >(this->_columns) +
+                      static_cast< std::size_t >(this->_current_column - 1);
+  this->_current_column++;
+  return this->_values[index];
 }
 
 void DbOstream::add(StringRef s) {
   ikos_assert(s.size() <= std::numeric_limits< int >::max());
 
-  int status = sqlite3_bind_text(this->_stmt,
-                                 this->_current_column++,
-                                 s.data(),
-                                 static_cast< int >(s.size()),
-                                 SQLITE_TRANSIENT);
-  if (status != SQLITE_OK) {
-    throw DbError(status, "DbOstream::add(StringRef)");
-  }
+  Value& value = this->current_value();
+  value.kind = Value::Kind::Text;
+  value.text.assign(s.data(), s.size());
 }
 
 void DbOstream::add_null() {
-  int status = sqlite3_bind_null(this->_stmt, this->_current_column++);
-  if (status != SQLITE_OK) {
-    throw DbError(status, "DbOstream::add_null()");
-  }
+  Value& value = this->current_value();
+  value.kind = Value::Kind::Null;
 }
 
 void DbOstream::add(DbInt64 n) {
-  int status = sqlite3_bind_int64(this->_stmt, this->_current_column++, n);
-  if (status != SQLITE_OK) {
-    throw DbError(status, "DbOstream::add(DbInt64)");
-  }
+  Value& value = this->current_value();
+  value.kind = Value::Kind::Integer;
+  value.integer = n;
 }
 
 void DbOstream::add(DbDouble d) {
-  int status = sqlite3_bind_double(this->_stmt, this->_current_column++, d);
-  if (status != SQLITE_OK) {
-    throw DbError(status, "DbOstream::add(DbDouble)");
-  }
+  Value& value = this->current_value();
+  value.kind = Value::Kind::Real;
+  value.real = d;
+}
+
+void DbOstream::add(DbBlob b) {
+  ikos_assert(b.data.size() <= std::numeric_limits< int >::max());
+
+  Value& value = this->current_value();
+  value.kind = Value::Kind::Blob;
+  value.text.assign(b.data.data(), b.data.size());
 }
 
 void DbOstream::flush() {
   ikos_assert_msg(this->_current_column == this->_columns + 1,
                   "incomplete row");
-  ikos_ignore(this->_columns);
 
-  int status = sqlite3_step(this->_stmt);
-  if (status != SQLITE_DONE) {
-    throw DbError(status, "DbOstream::flush(): step failed");
+  this->_current_column = 1;
+  this->_buffered_rows++;
+
+  if (this->_buffered_rows == this->_batch_rows) {
+    this->write_batch();
   }
+}
 
-  status = sqlite3_clear_bindings(this->_stmt);
+/// \brief Bind a buffered value to a parameter of a statement
+///
+/// Text and blob values are bound with SQLITE_STATIC, they must stay alive
+/// until the statement is executed.
+template < typename Value >
+static void bind_value(sqlite3_stmt* stmt, int index, const Value& value) {
+  int status = SQLITE_OK;
+  switch (value.kind) {
+    case Value::Kind::Null: {
+      status = sqlite3_bind_null(stmt, index);
+    } break;
+    case Value::Kind::Integer: {
+      status = sqlite3_bind_int64(stmt, index, value.integer);
+    } break;
+    case Value::Kind::Real: {
+      status = sqlite3_bind_double(stmt, index, value.real);
+    } break;
+    case Value::Kind::Text: {
+      status = sqlite3_bind_text(stmt,
+                                 index,
+                                 value.text.data(),
+                                 static_cast< int >(value.text.size()),
+                                 SQLITE_STATIC);
+    } break;
+    case Value::Kind::Blob: {
+      status = sqlite3_bind_blob(stmt,
+                                 index,
+                                 value.text.data(),
+                                 static_cast< int >(value.text.size()),
+                                 SQLITE_STATIC);
+    } break;
+  }
   if (status != SQLITE_OK) {
-    throw DbError(status, "DbOstream::flush(): clear bindings failed");
+    throw DbError(status, "DbOstream: bind failed");
+  }
+}
+
+/// \brief Execute an insert statement and reset it
+static void step_insert(sqlite3_stmt* stmt) {
+  int status = sqlite3_step(stmt);
+  if (status != SQLITE_DONE) {
+    sqlite3_reset(stmt);
+    throw DbError(status, "DbOstream::flush(): step failed");
   }
 
-  status = sqlite3_reset(this->_stmt);
+  status = sqlite3_reset(stmt);
   if (status != SQLITE_OK) {
     throw DbError(status, "DbOstream::flush(): reset failed");
   }
+}
 
-  this->_current_column = 1;
-  this->_db.row_inserted();
+void DbOstream::write_batch() {
+  ikos_assert(this->_buffered_rows == this->_batch_rows);
+
+  if (this->_batch_stmt == nullptr) {
+    this->write_buffered_rows();
+    return;
+  }
+
+  int num_values = this->_batch_rows * this->_columns;
+  for (int i = 0; i < num_values; i++) {
+    bind_value(this->_batch_stmt,
+               i + 1,
+               this->_values[static_cast< std::size_t >(i)]);
+  }
+  this->_buffered_rows = 0;
+  step_insert(this->_batch_stmt);
+  this->_db.rows_inserted(static_cast< std::size_t >(this->_batch_rows));
+}
+
+void DbOstream::write_buffered_rows() {
+  int rows = this->_buffered_rows;
+  this->_buffered_rows = 0;
+
+  for (int r = 0; r < rows; r++) {
+    for (int i = 0; i < this->_columns; i++) {
+      std::size_t index = static_cast< std::size_t >(r) *
+                              static_cast< std::size_t >(this->_columns) +
+                          static_cast< std::size_t >(i);
+      bind_value(this->_stmt, i + 1, this->_values[index]);
+    }
+    step_insert(this->_stmt);
+  }
+  this->_db.rows_inserted(static_cast< std::size_t >(rows));
 }
 
 // DbIstream
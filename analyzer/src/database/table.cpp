@@ -41,6 +41,8 @@
  *
  ******************************************************************************/
 
+#include <cctype>
+
 #include <ikos/analyzer/database/table.hpp>
 
 namespace ikos {
@@ -55,11 +57,25 @@ DatabaseTable::DatabaseTable(
   this->_db.drop_table(this->_name);
   this->_db.create_table(this->_name, cols);
   for (const auto& col : indexes) {
+    this->_indexes.push_back(col.to_string());
+  }
+}
+
+void DatabaseTable::create_indexes() {
+  for (const auto& cols : this->_indexes) {
+    // The index name is made of the column names, e.g, "a, b" gives
+    // index_<table>_a_b
     std::string index_name("index_");
     index_name += this->_name;
     index_name += '_';
-    index_name += col;
-    this->_db.create_index(index_name, this->_name, col);
+    for (char c : cols) {
+      if (std::isalnum(static_cast< unsigned char >(c)) || c == '_') {
+        index_name += c;
+      } else if (c == ',') {
+        index_name += '_';
+      }
+    }
+    this->_db.create_index(index_name, this->_name, cols);
   }
 }
 
@@ -63,9 +63,9 @@ CallContextsTable::CallContextsTable(sqlite::DbConnection& db,
 sqlite::DbInt64 CallContextsTable::insert(CallContext* call_context) {
   ikos_assert(call_context != nullptr);
 
-  auto it = this->_map.find(call_context);
-  if (it != this->_map.end()) {
-    return it->second;
+  CallContext::Id context_id = call_context->id();
+  if (context_id < this->_ids.size() && this->_ids[context_id] != 0) {
+    return this->_ids[context_id] - 1;
   }
 
   // Insert the parent first
@@ -97,7 +97,10 @@ sqlite::DbInt64 CallContextsTable::insert(CallContext* call_context) {
   }
   this->_row << sqlite::end_row;
 
-  this->_map.try_emplace(call_context, id);
+  if (context_id >= this->_ids.size()) {
+    this->_ids.resize(context_id + 1, 0);
+  }
+  this->_ids[context_id] = static_cast< uint32_t >(id + 1);
   return id;
 }
 
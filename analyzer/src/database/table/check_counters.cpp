@@ -0,0 +1,86 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Check counters database table implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <ikos/analyzer/database/table/check_counters.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+CheckCountersTable::CheckCountersTable(sqlite::DbConnection& db)
+    : DatabaseTable(db,
+                    "check_counters",
+                    {{"checker", sqlite::DbColumnType::Integer},
+                     {"status", sqlite::DbColumnType::Integer},
+                     {"count", sqlite::DbColumnType::Integer},
+                     {"domain", sqlite::DbColumnType::Text}},
+                    {}),
+      _row(db, "check_counters", 4) {}
+
+void CheckCountersTable::insert(CheckerName checker,
+                                Result status,
+                                sqlite::DbInt64 count,
+                                const std::string& domain) {
+  this->_row << static_cast< sqlite::DbInt64 >(checker)
+             << static_cast< sqlite::DbInt64 >(status) << count;
+  this->insert_domain(domain);
+}
+
+void CheckCountersTable::insert_ok_statements(sqlite::DbInt64 count,
+                                              const std::string& domain) {
+  this->_row << sqlite::null << static_cast< sqlite::DbInt64 >(Result::Ok)
+             << count;
+  this->insert_domain(domain);
+}
+
+void CheckCountersTable::insert_domain(const std::string& domain) {
+  if (!domain.empty()) {
+    this->_row << domain;
+  } else {
+    this->_row << sqlite::null;
+  }
+  this->_row << sqlite::end_row;
+}
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -46,10 +46,49 @@
 namespace ikos {
 namespace analyzer {
 
+// CheckBuffer
+
+void CheckBuffer::write(CheckKind kind,
+                        CheckerName checker,
+                        Result status,
+                        ar::Statement* stmt,
+                        CallContext* call_context,
+                        llvm::ArrayRef< ar::Value* > operands,
+                        const JsonDict& info) {
+  this->_checks.push_back(BufferedCheck{kind,
+                                        checker,
+                                        status,
+                                        stmt,
+                                        call_context,
+                                        operands.vec(),
+                                        info});
+}
+
+void CheckBuffer::flush(ChecksTable& table) {
+  for (const BufferedCheck& check : this->_checks) {
+    table.insert(check.kind,
+                 check.checker,
+                 check.status,
+                 check.stmt,
+                 check.call_context,
+                 check.operands,
+                 check.info);
+  }
+  this->_checks.clear();
+}
+
+// ChecksTable
+
+thread_local CheckBuffer* ChecksTable::ThreadBuffer = nullptr;
+
 ChecksTable::ChecksTable(sqlite::DbConnection& db,
                          StatementsTable& statements,
                          OperandsTable& operands,
-                         CallContextsTable& call_contexts)
+                         CallContextsTable& call_contexts,
+                         CompressionDictionariesTable& compression,
+                         CheckSink* sink,
+                         CheckCountersTable* counters,
+                         bool aggregate)
     : DatabaseTable(db,
                     "checks",
                     {{"id", sqlite::DbColumnType::Integer},
@@ -59,12 +98,21 @@ ChecksTable::ChecksTable(sqlite::DbConnection& db,
                      {"statement_id", sqlite::DbColumnType::Integer},
                      {"operands", sqlite::DbColumnType::Text},
                      {"call_context_id", sqlite::DbColumnType::Integer},
-                     {"info", sqlite::DbColumnType::Text}},
-                    {"statement_id", "call_context_id"}),
+                     {"info", sqlite::DbColumnType::Text},
+                     {"domain", sqlite::DbColumnType::Text},
+                     {"call_context_ids", sqlite::DbColumnType::Text}},
+                    {"statement_id, call_context_id",
+                     "call_context_id",
+                     "status",
+                     "kind"}),
       _statements(statements),
       _operands(operands),
       _call_contexts(call_contexts),
-      _row(db, "checks", 8) {}
+      _compression(compression),
+      _row(db, "checks", 10),
+      _sink(sink),
+      _counters_table(counters),
+      _aggregate(aggregate) {}
 
 void ChecksTable::insert(CheckKind kind,
                          CheckerName checker,
@@ -73,16 +121,77 @@ void ChecksTable::insert(CheckKind kind,
                          CallContext* call_context,
                          llvm::ArrayRef< ar::Value* > operands,
                          const JsonDict& info) {
-  sqlite::DbInt64 id = this->_last_insert_id++;
+  if (ThreadBuffer != nullptr) {
+    ThreadBuffer
+        ->write(kind, checker, status, stmt, call_context, operands, info);
+    return;
+  }
 
-  this->_row << id;
-  this->_row << static_cast< sqlite::DbInt64 >(kind);
-  this->_row << static_cast< sqlite::DbInt64 >(checker);
-  this->_row << static_cast< sqlite::DbInt64 >(status);
-  this->_row << this->_statements.insert(stmt);
+  if (this->_recorder != nullptr) {
+    this->_recorder
+        ->write(kind, checker, status, stmt, call_context, operands, info);
+  }
+
+  if (this->_stream != nullptr && status != Result::Ok) {
+    this->_stream
+        ->write(kind, checker, status, stmt, call_context, operands, info);
+  }
+
+  if (this->_sink != nullptr) {
+    if (status != Result::Ok) {
+      if (this->_domain.empty()) {
+        this->_sink
+            ->write(kind, checker, status, stmt, call_context, operands, info);
+      } else {
+        JsonDict tagged_info = info;
+        tagged_info.put("domain", this->_domain);
+        this->_sink->write(kind,
+                           checker,
+                           status,
+                           stmt,
+                           call_context,
+                           operands,
+                           tagged_info);
+      }
+    }
+    return;
+  }
+
+  if (this->_counters_table != nullptr) {
+    this->_counters[{checker, status}]++;
+
+    auto it = this->_contexts.find({stmt, call_context});
+    if (it == this->_contexts.end()) {
+      it = this->_contexts
+               .try_emplace({stmt, call_context},
+                            ContextState{status != Result::Ok, kind, checker})
+               .first;
+    } else if (status != Result::Ok) {
+      it->second.not_ok = true;
+    }
+
+    if (status == Result::Ok) {
+      return;
+    }
+    this->_not_ok_statements.insert(stmt);
+  }
+
+  this->insert_row(kind, checker, status, stmt, call_context, operands, info);
+}
+
+void ChecksTable::insert_row(CheckKind kind,
+                             CheckerName checker,
+                             Result status,
+                             ar::Statement* stmt,
+                             CallContext* call_context,
+                             llvm::ArrayRef< ar::Value* > operands,
+                             const JsonDict& info) {
+  sqlite::DbInt64 statement_id = this->_statements.insert(stmt);
+  std::string operands_json;
   if (!operands.empty() &&
       (status == Result::Warning || status == Result::Error)) {
-    JsonList json_operands;
+    this->_json.clear();
+    this->_json.begin_list();
     for (auto operand : operands) {
       // Find operand number
       auto it = std::find(stmt->op_begin(), stmt->op_end(), operand);
@@ -90,20 +199,164 @@ void ChecksTable::insert(CheckKind kind,
       if (it != stmt->op_end()) {
         operand_no = static_cast< sqlite::DbInt64 >(it - stmt->op_begin());
       }
-      json_operands.add(JsonList{operand_no, this->_operands.insert(operand)});
+      this->_json.begin_list();
+      this->_json.value(operand_no);
+      this->_json.value(this->_operands.insert(operand));
+      this->_json.end_list();
     }
-    this->_row << json_operands.str();
+    this->_json.end_list();
+    operands_json = this->_json.str().to_string();
+  }
+  sqlite::DbInt64 call_context_id = this->_call_contexts.insert(call_context);
+  std::string info_json;
+  if (!info.empty()) {
+    this->_json.clear();
+    this->_json.value(info);
+    info_json = this->_json.str().to_string();
+  }
+
+  if (!this->_aggregate) {
+    this->write_row(kind,
+                    checker,
+                    status,
+                    statement_id,
+                    operands_json,
+                    {call_context_id},
+                    info_json);
+    return;
+  }
+
+  AggregateKey key(statement_id,
+                   kind,
+                   checker,
+                   status,
+                   operands_json,
+                   info_json);
+  auto it = this->_aggregated_index.find(key);
+  if (it == this->_aggregated_index.end()) {
+    this->_aggregated_index.emplace(std::move(key), this->_aggregated.size());
+    this->_aggregated.push_back(AggregatedRow{kind,
+                                              checker,
+                                              status,
+                                              statement_id,
+                                              std::move(operands_json),
+                                              std::move(info_json),
+                                              {call_context_id}});
+  } else {
+    std::vector< sqlite::DbInt64 >& ids =
+        this->_aggregated[it->second].call_context_ids;
+    if (std::find(ids.begin(), ids.end(), call_context_id) == ids.end()) {
+      ids.push_back(call_context_id);
+    }
+  }
+}
+
+void ChecksTable::write_row(CheckKind kind,
+                            CheckerName checker,
+                            Result status,
+                            sqlite::DbInt64 statement_id,
+                            const std::string& operands,
+                            llvm::ArrayRef< sqlite::DbInt64 > call_context_ids,
+                            const std::string& info) {
+  sqlite::DbInt64 id = this->_last_insert_id++;
+
+  this->_row << id;
+  this->_row << static_cast< sqlite::DbInt64 >(kind);
+  this->_row << static_cast< sqlite::DbInt64 >(checker);
+  this->_row << static_cast< sqlite::DbInt64 >(status);
+  this->_row << statement_id;
+  if (!operands.empty()) {
+    this->_compression.write(this->_row, operands);
   } else {
     this->_row << sqlite::null;
   }
-  this->_row << this->_call_contexts.insert(call_context);
+  this->_row << call_context_ids.front();
   if (!info.empty()) {
-    this->_row << info.str();
+    this->_compression.write(this->_row, info);
+  } else {
+    this->_row << sqlite::null;
+  }
+  if (!this->_domain.empty()) {
+    this->_row << this->_domain;
+  } else {
+    this->_row << sqlite::null;
+  }
+  if (call_context_ids.size() > 1) {
+    this->_json.clear();
+    this->_json.begin_list();
+    for (sqlite::DbInt64 call_context_id : call_context_ids.drop_front()) {
+      this->_json.value(call_context_id);
+    }
+    this->_json.end_list();
+    this->_compression.write(this->_row, this->_json.str());
   } else {
     this->_row << sqlite::null;
   }
   this->_row << sqlite::end_row;
 }
 
+void ChecksTable::set_domain(std::string domain) {
+  if (!this->_counters.empty() || !this->_aggregated.empty()) {
+    this->finalize();
+  }
+  this->_domain = std::move(domain);
+}
+
+void ChecksTable::finalize() {
+  if (this->_counters_table != nullptr) {
+    this->finalize_counters();
+  }
+
+  for (const AggregatedRow& row : this->_aggregated) {
+    this->write_row(row.kind,
+                    row.checker,
+                    row.status,
+                    row.statement_id,
+                    row.operands,
+                    row.call_context_ids,
+                    row.info);
+  }
+  this->_aggregated.clear();
+  this->_aggregated_index.clear();
+}
+
+void ChecksTable::finalize_counters() {
+  llvm::DenseSet< ar::Statement* > ok_statements;
+  for (const auto& entry : this->_contexts) {
+    ar::Statement* stmt = entry.first.first;
+    CallContext* call_context = entry.first.second;
+    const ContextState& state = entry.second;
+
+    if (state.not_ok) {
+      continue;
+    }
+    if (this->_not_ok_statements.count(stmt) != 0) {
+      // Keep one `ok` check for this calling context
+      this->insert_row(state.kind,
+                       state.checker,
+                       Result::Ok,
+                       stmt,
+                       call_context,
+                       {},
+                       {});
+    } else {
+      ok_statements.insert(stmt);
+    }
+  }
+
+  for (const auto& entry : this->_counters) {
+    this->_counters_table->insert(entry.first.first,
+                                  entry.first.second,
+                                  entry.second,
+                                  this->_domain);
+  }
+  this->_counters_table->insert_ok_statements(
+      static_cast< sqlite::DbInt64 >(ok_statements.size()), this->_domain);
+
+  this->_contexts.clear();
+  this->_not_ok_statements.clear();
+  this->_counters.clear();
+}
+
 } // end namespace analyzer
 } // end namespace ikos
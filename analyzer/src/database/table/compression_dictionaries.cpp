@@ -0,0 +1,156 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Compression dictionaries database table implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <zlib.h>
+
+#include <ikos/analyzer/database/table/compression_dictionaries.hpp>
+#include <ikos/analyzer/exception.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+namespace {
+
+/// \brief Preset dictionary
+///
+/// Frequent substrings of the compressed columns. zlib favours the end of the
+/// dictionary, which holds the most frequent ones.
+const char Dictionary[] =
+    "(unsigned long)(unsigned int)(long)(int)(char *)(void *)sizeof("
+    "->next->data->size->len[0][1][i][j]&buf&str&array&s->"
+    "\"increasing\":\"array_element_size\":\"requirement\":"
+    "\"left_points_to\":[\"right_points_to\":[\"diff\":{"
+    "\"congruence\":{\"a\":\"b\":\"fun_id\":\"size\":{"
+    "\"left\":{\"right\":{\"access_size\":{\"offset\":{"
+    "\"type\":\"u64\"},\"type\":\"s64\"},\"type\":\"u32\"},"
+    "\"type\":\"s32\"},{\"id\":\"kind\":\"status\":"
+    "\"points_to\":[{\"id\":,\"kind\":0,\"status\":0},"
+    "\"lb\":0,\"type\":\"u64\",\"ub\":\"lb\":,\"ub\":"
+    "[[0,[[1,[[2,],[0,],[1,],[2,";
+
+/// \brief Size of the preset dictionary, without the null terminator
+const std::size_t DictionarySize = sizeof(Dictionary) - 1;
+
+/// \brief Set the preset dictionary of a zlib stream
+void set_dictionary(z_stream_s* stream) {
+  if (deflateSetDictionary(stream,
+                           reinterpret_cast< const Bytef* >(Dictionary),
+                           static_cast< uInt >(DictionarySize)) != Z_OK) {
+    throw LogicError("zlib: could not set the compression dictionary");
+  }
+}
+
+} // end anonymous namespace
+
+CompressionDictionariesTable::CompressionDictionariesTable(
+    sqlite::DbConnection& db, bool enabled)
+    : DatabaseTable(db,
+                    "compression_dictionaries",
+                    {{"id", sqlite::DbColumnType::Integer},
+                     {"dictionary", sqlite::DbColumnType::Blob}},
+                    {}) {
+  if (!enabled) {
+    return;
+  }
+
+  this->_stream = std::make_unique< z_stream_s >();
+  this->_stream->zalloc = Z_NULL;
+  this->_stream->zfree = Z_NULL;
+  this->_stream->opaque = Z_NULL;
+  if (deflateInit(this->_stream.get(), Z_DEFAULT_COMPRESSION) != Z_OK) {
+    this->_stream.reset();
+    throw LogicError("zlib: could not initialize the compression stream");
+  }
+  set_dictionary(this->_stream.get());
+
+  // The identifier of a dictionary is its Adler-32 checksum, which zlib also
+  // writes in the header of the compressed values
+  sqlite::DbOstream row(db, "compression_dictionaries", 2);
+  row << static_cast< sqlite::DbInt64 >(this->_stream->adler);
+  row << sqlite::DbBlob(dictionary());
+  row << sqlite::end_row;
+}
+
+CompressionDictionariesTable::~CompressionDictionariesTable() {
+  if (this->_stream != nullptr) {
+    deflateEnd(this->_stream.get());
+  }
+}
+
+void CompressionDictionariesTable::write(sqlite::DbOstream& row,
+                                         StringRef text) {
+  if (this->_stream == nullptr) {
+    row << text;
+    return;
+  }
+
+  z_stream_s* stream = this->_stream.get();
+  if (deflateReset(stream) != Z_OK) {
+    throw LogicError("zlib: could not reset the compression stream");
+  }
+  set_dictionary(stream);
+
+  this->_buffer.resize(deflateBound(stream, static_cast< uLong >(text.size())));
+  stream->next_in =
+      reinterpret_cast< Bytef* >(const_cast< char* >(text.data()));
+  stream->avail_in = static_cast< uInt >(text.size());
+  stream->next_out = reinterpret_cast< Bytef* >(&this->_buffer[0]);
+  stream->avail_out = static_cast< uInt >(this->_buffer.size());
+  if (deflate(stream, Z_FINISH) != Z_STREAM_END) {
+    throw LogicError("zlib: could not compress a value");
+  }
+
+  if (stream->total_out < text.size()) {
+    row << sqlite::DbBlob(StringRef(this->_buffer.data(), stream->total_out));
+  } else {
+    row << text;
+  }
+}
+
+StringRef CompressionDictionariesTable::dictionary() {
+  return StringRef(Dictionary, DictionarySize);
+}
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of the downgrades database table
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <ikos/analyzer/analysis/function_budget.hpp>
+#include <ikos/analyzer/database/table/downgrades.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+DowngradesTable::DowngradesTable(sqlite::DbConnection& db,
+                                 FunctionsTable& functions,
+                                 CallContextsTable& call_contexts)
+    : DatabaseTable(db,
+                    "downgrades",
+                    {{"function_id", sqlite::DbColumnType::Integer},
+                     {"call_context_id", sqlite::DbColumnType::Integer},
+                     {"budget", sqlite::DbColumnType::Text},
+                     {"domain", sqlite::DbColumnType::Text}},
+                    {"function_id"}),
+      _functions(functions),
+      _call_contexts(call_contexts),
+      _row(db, "downgrades", 4) {}
+
+void DowngradesTable::insert(ar::Function* fun,
+                             CallContext* call_context,
+                             BudgetKind kind,
+                             const std::string& domain) {
+  this->_row << this->_functions.insert(fun)
+             << this->_call_contexts.insert(call_context)
+             << budget_kind_str(kind);
+  if (!domain.empty()) {
+    this->_row << domain;
+  } else {
+    this->_row << sqlite::null;
+  }
+  this->_row << sqlite::end_row;
+}
+
+} // end namespace analyzer
+} // end namespace ikos
@@ -42,7 +42,6 @@
  ******************************************************************************/
 
 #include <ikos/analyzer/database/table/files.hpp>
-#include <ikos/analyzer/util/source_location.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -55,36 +54,20 @@ FilesTable::FilesTable(sqlite::DbConnection& db)
                     {}),
       _row(db, "files", 2) {}
 
-sqlite::DbInt64 FilesTable::insert(llvm::DIFile* file) {
+sqlite::DbInt64 FilesTable::insert(const boost::filesystem::path* file) {
   ikos_assert(file != nullptr);
 
-  // Check in _di_file_map
-  {
-    auto it = this->_di_file_map.find(file);
-    if (it != this->_di_file_map.end()) {
-      return it->second;
-    }
-  }
-
-  // llvm::DIFile* are not unique, use _path_map
-  boost::filesystem::path path = source_path(file);
-
-  // Check in _path_map
-  {
-    auto it = this->_path_map.find(path.string());
-    if (it != this->_path_map.end()) {
-      this->_di_file_map.try_emplace(file, it->second);
-      return it->second;
-    }
+  auto it = this->_map.find(file);
+  if (it != this->_map.end()) {
+    return it->second;
   }
 
   sqlite::DbInt64 id = this->_last_insert_id++;
   this->_row << id;
-  this->_row << path.string();
+  this->_row << file->string();
   this->_row << sqlite::end_row;
 
-  this->_di_file_map.try_emplace(file, id);
-  this->_path_map.try_emplace(path.string(), id);
+  this->_map.try_emplace(file, id);
   return id;
 }
 
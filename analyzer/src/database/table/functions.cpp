@@ -41,11 +41,11 @@
  *
  ******************************************************************************/
 
-#include <llvm/IR/DebugInfoMetadata.h>
 #include <llvm/IR/Function.h>
 
 #include <ikos/analyzer/database/table/functions.hpp>
 #include <ikos/analyzer/util/demangle.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -77,18 +77,18 @@ sqlite::DbInt64 FunctionsTable::insert(ar::Function* fun) {
   this->_row << id;
   this->_row << fun_name;
   if (is_mangled(fun_name)) {
-    this->_row << demangle(fun_name);
+    this->_row << demangle(fun);
   } else {
     this->_row << sqlite::null;
   }
   this->_row << (fun->is_definition() ? sqlite::DbInt64(1)
                                       : sqlite::DbInt64(0));
   if (fun->has_frontend()) {
-    auto llvm_fun = fun->frontend< llvm::Function >();
-    llvm::DISubprogram* dbg = llvm_fun->getSubprogram();
-    if (dbg != nullptr) {
-      this->_row << this->_files.insert(dbg->getFile());
-      this->_row << static_cast< sqlite::DbInt64 >(dbg->getLine());
+    const FrontendInfo::FunctionInfo* info = FrontendInfo::get().function(fun);
+    ikos_assert(info != nullptr);
+    if (info->location) {
+      this->_row << this->_files.insert(info->location.file());
+      this->_row << static_cast< sqlite::DbInt64 >(info->location.line());
     } else {
       this->_row << sqlite::null;
       this->_row << sqlite::null;
@@ -109,7 +109,9 @@ StringRef FunctionsTable::name(ar::Function* fun) {
     return fun->name();
   }
 
-  return name(fun->frontend< llvm::Function >());
+  const FrontendInfo::FunctionInfo* info = FrontendInfo::get().function(fun);
+  ikos_assert(info != nullptr);
+  return info->name;
 }
 
 StringRef FunctionsTable::name(llvm::Function* fun) {
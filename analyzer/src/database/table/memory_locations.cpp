@@ -41,15 +41,10 @@
  *
  ******************************************************************************/
 
-#include <llvm/IR/DebugInfoMetadata.h>
-#include <llvm/IR/Instructions.h>
-#include <llvm/IR/IntrinsicInst.h>
-#include <llvm/Transforms/Utils/Local.h>
-
 #include <ikos/analyzer/database/table/memory_locations.hpp>
-#include <ikos/analyzer/database/table/operands.hpp>
 #include <ikos/analyzer/support/cast.hpp>
 #include <ikos/analyzer/util/demangle.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
 
 namespace ikos {
 namespace analyzer {
@@ -97,37 +92,12 @@ JsonDict MemoryLocationsTable::info(MemoryLocation* mem_loc) {
   if (auto local_mem_loc = dyn_cast< LocalMemoryLocation >(mem_loc)) {
     ar::LocalVariable* lv = local_mem_loc->local_var();
     ikos_assert(lv->has_frontend());
-    auto value = lv->frontend< llvm::Value >();
-    auto alloca = llvm::cast< llvm::AllocaInst >(value);
-
-    // Check for llvm.dbg.declare and llvm.dbg.addr
-    llvm::TinyPtrVector< llvm::DbgInfoIntrinsic* > dbg_addrs =
-        llvm::FindDbgAddrUses(alloca);
-    auto dbg_addr =
-        std::find_if(dbg_addrs.begin(),
-                     dbg_addrs.end(),
-                     [](llvm::DbgInfoIntrinsic* dbg) {
-                       return dbg->getExpression()->getNumElements() == 0;
-                     });
-
-    if (dbg_addr != dbg_addrs.end()) {
-      llvm::DILocalVariable* di_var = (*dbg_addr)->getVariable();
-      return {{"name", di_var->getName()}};
-    }
+    const FrontendInfo::VariableInfo* info = FrontendInfo::get().variable(lv);
+    ikos_assert(info != nullptr);
 
-    // Check for llvm.dbg.value
-    llvm::SmallVector< llvm::DbgValueInst*, 1 > dbg_values;
-    llvm::findDbgValues(dbg_values, value);
-    auto dbg_value =
-        std::find_if(dbg_values.begin(),
-                     dbg_values.end(),
-                     [](llvm::DbgValueInst* dbg) {
-                       return dbg->getExpression()->getNumElements() == 0;
-                     });
-
-    if (dbg_value != dbg_values.end()) {
-      llvm::DILocalVariable* di_var = (*dbg_value)->getVariable();
-      return {{"name", di_var->getName()}};
+    // Check for llvm.dbg.declare, llvm.dbg.addr and llvm.dbg.value
+    if (!info->debug_name.empty()) {
+      return {{"name", info->debug_name}};
     }
 
     // Last chance, use ar variable name
@@ -139,20 +109,17 @@ JsonDict MemoryLocationsTable::info(MemoryLocation* mem_loc) {
   } else if (auto global_mem_loc = dyn_cast< GlobalMemoryLocation >(mem_loc)) {
     ar::GlobalVariable* gv = global_mem_loc->global_var();
     ikos_assert(gv->has_frontend());
-    auto llvm_gv = gv->frontend< llvm::GlobalVariable >();
+    const FrontendInfo::VariableInfo* info = FrontendInfo::get().variable(gv);
+    ikos_assert(info != nullptr);
 
     // Check for debug info
-    llvm::SmallVector< llvm::DIGlobalVariableExpression*, 1 > dbgs;
-    llvm_gv->getDebugInfo(dbgs);
-
-    if (!dbgs.empty()) {
-      llvm::DIGlobalVariable* di_gv = dbgs[0]->getVariable();
-      return {{"name", di_gv->getName()}};
+    if (!info->debug_name.empty()) {
+      return {{"name", info->debug_name}};
     }
 
     // If it's a constant (e.g, a string)
-    if (llvm_gv->isConstant() && llvm_gv->hasInitializer()) {
-      return {{"cst", OperandsTable::repr(llvm_gv->getInitializer())}};
+    if (!info->repr.empty()) {
+      return {{"cst", info->repr}};
     }
 
     // Last chance, use ar variable name
@@ -41,6 +41,7 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
 #include <regex>
 #include <vector>
 
@@ -60,34 +61,72 @@
 #include <ikos/analyzer/database/table/operands.hpp>
 #include <ikos/analyzer/exception.hpp>
 #include <ikos/analyzer/util/demangle.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
 
 namespace ikos {
 namespace analyzer {
 
-OperandsTable::OperandsTable(sqlite::DbConnection& db)
+OperandsTable::OperandsTable(sqlite::DbConnection& db,
+                             CompressionDictionariesTable& compression)
     : DatabaseTable(db,
                     "operands",
                     {{"id", sqlite::DbColumnType::Integer},
                      {"kind", sqlite::DbColumnType::Integer},
                      {"repr", sqlite::DbColumnType::Text}},
                     {}),
+      _compression(compression),
       _row(db, "operands", 3) {}
 
 sqlite::DbInt64 OperandsTable::insert(ar::Value* value) {
   ikos_assert(value != nullptr);
 
+  if (value->has_index()) {
+    std::size_t index = value->index();
+    if (index >= this->_ids.size()) {
+      std::size_t size = index + 1;
+      if (FrontendInfo::is_set()) {
+        size = std::max< std::size_t >(size,
+                                       FrontendInfo::get().num_values());
+      }
+      this->_ids.resize(size, -1);
+    }
+
+    sqlite::DbInt64& id = this->_ids[index];
+    if (id == -1) {
+      id = this->insert_row(value);
+    }
+    return id;
+  }
+
   auto it = this->_map.find(value);
   if (it != this->_map.end()) {
     return it->second;
   }
 
+  sqlite::DbInt64 id = this->insert_row(value);
+  this->_map.try_emplace(value, id);
+  return id;
+}
+
+sqlite::DbInt64 OperandsTable::insert_row(ar::Value* value) {
+  auto kind = static_cast< sqlite::DbInt64 >(value->kind());
+  std::string value_repr = repr(value);
+  std::string content = std::to_string(kind);
+  content += ':';
+  content += value_repr;
+
+  auto content_it = this->_content_map.find(content);
+  if (content_it != this->_content_map.end()) {
+    return content_it->second;
+  }
+
   sqlite::DbInt64 id = this->_last_insert_id++;
   this->_row << id;
-  this->_row << static_cast< sqlite::DbInt64 >(value->kind());
-  this->_row << repr(value);
+  this->_row << kind;
+  this->_compression.write(this->_row, value_repr);
   this->_row << sqlite::end_row;
 
-  this->_map.try_emplace(value, id);
+  this->_content_map.try_emplace(content, id);
   return id;
 }
 
@@ -960,7 +999,7 @@ struct OperandReprVisitor {
 
   std::string operator()(ar::FunctionPointerConstant* c) const {
     ar::Function* fun = c->function();
-    return "&" + demangle(FunctionsTable::name(fun));
+    return "&" + demangle(fun);
   }
 
   std::string operator()(ar::InlineAssemblyConstant* c) const {
@@ -969,20 +1008,17 @@ struct OperandReprVisitor {
 
   std::string operator()(ar::GlobalVariable* gv) const {
     ikos_assert(gv->has_frontend());
-    auto llvm_gv = gv->frontend< llvm::GlobalVariable >();
+    const FrontendInfo::VariableInfo* info = FrontendInfo::get().variable(gv);
+    ikos_assert(info != nullptr);
 
     // Check for debug info
-    llvm::SmallVector< llvm::DIGlobalVariableExpression*, 1 > dbgs;
-    llvm_gv->getDebugInfo(dbgs);
-
-    if (!dbgs.empty()) {
-      llvm::DIGlobalVariable* di_gv = dbgs[0]->getVariable();
-      return "&" + demangle(di_gv->getName());
+    if (!info->debug_name.empty()) {
+      return "&" + demangle(info->debug_name);
     }
 
     // If it's a constant (e.g, a string)
-    if (llvm_gv->isConstant() && llvm_gv->hasInitializer()) {
-      return "&" + OperandsTable::repr(llvm_gv->getInitializer());
+    if (!info->repr.empty()) {
+      return "&" + info->repr;
     }
 
     // Last chance, use ar variable name
@@ -991,38 +1027,12 @@ struct OperandReprVisitor {
 
   std::string operator()(ar::LocalVariable* lv) const {
     ikos_assert(lv->has_frontend());
-    auto value = lv->frontend< llvm::Value >();
-    ikos_assert(llvm::isa< llvm::AllocaInst >(value));
-    auto alloca = llvm::cast< llvm::AllocaInst >(value);
+    const FrontendInfo::VariableInfo* info = FrontendInfo::get().variable(lv);
+    ikos_assert(info != nullptr);
 
-    // Check for llvm.dbg.declare and llvm.dbg.addr
-    llvm::TinyPtrVector< llvm::DbgInfoIntrinsic* > dbg_addrs =
-        llvm::FindDbgAddrUses(alloca);
-    auto dbg_addr =
-        std::find_if(dbg_addrs.begin(),
-                     dbg_addrs.end(),
-                     [](llvm::DbgInfoIntrinsic* dbg) {
-                       return dbg->getExpression()->getNumElements() == 0;
-                     });
-
-    if (dbg_addr != dbg_addrs.end()) {
-      llvm::DILocalVariable* di_var = (*dbg_addr)->getVariable();
-      return "&" + demangle(di_var->getName());
-    }
-
-    // Check for llvm.dbg.value
-    llvm::SmallVector< llvm::DbgValueInst*, 1 > dbg_values;
-    llvm::findDbgValues(dbg_values, value);
-    auto dbg_value =
-        std::find_if(dbg_values.begin(),
-                     dbg_values.end(),
-                     [](llvm::DbgValueInst* dbg) {
-                       return dbg->getExpression()->getNumElements() == 0;
-                     });
-
-    if (dbg_value != dbg_values.end()) {
-      llvm::DILocalVariable* di_var = (*dbg_value)->getVariable();
-      return "&" + demangle(di_var->getName());
+    // Check for llvm.dbg.declare, llvm.dbg.addr and llvm.dbg.value
+    if (!info->debug_name.empty()) {
+      return "&" + demangle(info->debug_name);
     }
 
     // Last chance, use ar variable name
@@ -1035,8 +1045,19 @@ struct OperandReprVisitor {
 
   std::string operator()(ar::InternalVariable* iv) const {
     ikos_assert(iv->has_frontend());
-    auto value = iv->frontend< llvm::Value >();
-    return OperandsTable::repr(value);
+    const FrontendInfo::VariableInfo* info = FrontendInfo::get().variable(iv);
+    ikos_assert(info != nullptr);
+
+    if (!info->repr.empty()) {
+      return info->repr;
+    }
+
+    // Unsupported llvm::Value, use ar variable name
+    if (iv->has_name()) {
+      return demangle(iv->name());
+    }
+
+    return "__unnamed_var";
   }
 
 }; // end struct OperandReprVisitor
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief ProfileTable implementation
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <string>
+
+#include <ikos/analyzer/analysis/function_profiler.hpp>
+#include <ikos/analyzer/database/table/profile.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+ProfileTable::ProfileTable(sqlite::DbConnection& db,
+                           FunctionsTable& functions,
+                           CallContextsTable& call_contexts)
+    : DatabaseTable(db,
+                    "profile",
+                    {{"function_id", sqlite::DbColumnType::Integer},
+                     {"call_context_id", sqlite::DbColumnType::Integer},
+                     {"runs", sqlite::DbColumnType::Integer},
+                     {"inclusive_time", sqlite::DbColumnType::Real},
+                     {"exclusive_time", sqlite::DbColumnType::Real},
+                     {"iterations", sqlite::DbColumnType::Integer},
+                     {"widenings", sqlite::DbColumnType::Integer},
+                     {"narrowings", sqlite::DbColumnType::Integer},
+                     {"narrowing_capped_loops", sqlite::DbColumnType::Text},
+                     {"peak_invariant_size", sqlite::DbColumnType::Integer},
+                     {"peak_invariant_bytes", sqlite::DbColumnType::Integer},
+                     {"peak_integer_bytes", sqlite::DbColumnType::Integer},
+                     {"peak_pointer_bytes", sqlite::DbColumnType::Integer},
+                     {"gmp_allocations", sqlite::DbColumnType::Integer},
+                     {"domain", sqlite::DbColumnType::Text}},
+                    {"function_id"}),
+      _functions(functions),
+      _call_contexts(call_contexts),
+      _row(db, "profile", 15) {}
+
+void ProfileTable::insert(ar::Function* fun,
+                          CallContext* call_context,
+                          const FunctionProfile& profile,
+                          const std::string& domain) {
+  this->_row << this->_functions.insert(fun)
+             << this->_call_contexts.insert(call_context)
+             << static_cast< sqlite::DbInt64 >(profile.runs)
+             << profile.inclusive_time.count()
+             << profile.exclusive_time.count()
+             << static_cast< sqlite::DbInt64 >(profile.iterations)
+             << static_cast< sqlite::DbInt64 >(profile.widenings)
+             << static_cast< sqlite::DbInt64 >(profile.narrowings);
+  if (!profile.narrowing_capped_loops.empty()) {
+    std::string loops;
+    for (ar::BasicBlock* head : profile.narrowing_capped_loops) {
+      if (!loops.empty()) {
+        loops += ", ";
+      }
+      loops += head->has_name() ? head->name() : "?";
+    }
+    this->_row << loops;
+  } else {
+    this->_row << sqlite::null;
+  }
+  this->_row << static_cast< sqlite::DbInt64 >(profile.peak_invariant_size)
+             << static_cast< sqlite::DbInt64 >(profile.peak_invariant_bytes)
+             << static_cast< sqlite::DbInt64 >(profile.peak_integer_bytes)
+             << static_cast< sqlite::DbInt64 >(profile.peak_pointer_bytes)
+             << static_cast< sqlite::DbInt64 >(profile.gmp_allocations);
+  if (!domain.empty()) {
+    this->_row << domain;
+  } else {
+    this->_row << sqlite::null;
+  }
+  this->_row << sqlite::end_row;
+}
+
+} // end namespace analyzer
+} // end namespace ikos
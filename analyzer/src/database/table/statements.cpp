@@ -41,7 +41,10 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
+
 #include <ikos/analyzer/database/table/statements.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
 #include <ikos/analyzer/util/source_location.hpp>
 
 namespace ikos {
@@ -58,7 +61,7 @@ StatementsTable::StatementsTable(sqlite::DbConnection& db,
                      {"file_id", sqlite::DbColumnType::Integer},
                      {"line", sqlite::DbColumnType::Integer},
                      {"column", sqlite::DbColumnType::Integer}},
-                    {"function_id", "file_id"}),
+                    {"function_id", "file_id, line, \"column\", id"}),
       _files(files),
       _functions(functions),
       _row(db, "statements", 6) {}
@@ -66,11 +69,35 @@ StatementsTable::StatementsTable(sqlite::DbConnection& db,
 sqlite::DbInt64 StatementsTable::insert(ar::Statement* stmt) {
   ikos_assert(stmt != nullptr);
 
+  if (stmt->has_index()) {
+    std::size_t index = stmt->index();
+    if (index >= this->_ids.size()) {
+      std::size_t size = index + 1;
+      if (FrontendInfo::is_set()) {
+        size = std::max< std::size_t >(size,
+                                       FrontendInfo::get().num_statements());
+      }
+      this->_ids.resize(size, -1);
+    }
+
+    sqlite::DbInt64& id = this->_ids[index];
+    if (id == -1) {
+      id = this->insert_row(stmt);
+    }
+    return id;
+  }
+
   auto it = this->_map.find(stmt);
   if (it != this->_map.end()) {
     return it->second;
   }
 
+  sqlite::DbInt64 id = this->insert_row(stmt);
+  this->_map.try_emplace(stmt, id);
+  return id;
+}
+
+sqlite::DbInt64 StatementsTable::insert_row(ar::Statement* stmt) {
   sqlite::DbInt64 id = this->_last_insert_id++;
 
   this->_row << id;
@@ -93,8 +120,6 @@ sqlite::DbInt64 StatementsTable::insert(ar::Statement* stmt) {
   }
 
   this->_row << sqlite::end_row;
-
-  this->_map.try_emplace(stmt, id);
   return id;
 }
 
@@ -50,12 +50,35 @@ TimesTable::TimesTable(sqlite::DbConnection& db)
     : DatabaseTable(db,
                     "times",
                     {{"pass", sqlite::DbColumnType::Text},
-                     {"time", sqlite::DbColumnType::Real}},
+                     {"time", sqlite::DbColumnType::Real},
+                     {"cycles", sqlite::DbColumnType::Integer},
+                     {"instructions", sqlite::DbColumnType::Integer},
+                     {"llc_misses", sqlite::DbColumnType::Integer},
+                     {"page_faults", sqlite::DbColumnType::Integer},
+                     {"max_rss_delta", sqlite::DbColumnType::Integer}},
                     {"pass"}),
-      _row(db, "times", 2) {}
+      _row(db, "times", 7) {}
 
 void TimesTable::insert(StringRef name, sqlite::DbDouble time) {
-  this->_row << name << time << sqlite::end_row;
+  this->insert(name, time, PerfCounters::Values{});
+}
+
+void TimesTable::insert(StringRef name,
+                        sqlite::DbDouble time,
+                        const PerfCounters::Values& counters) {
+  this->_row << name << time;
+  for (int64_t value : {counters.cycles,
+                        counters.instructions,
+                        counters.llc_misses,
+                        counters.page_faults,
+                        counters.max_rss_delta}) {
+    if (value >= 0) {
+      this->_row << static_cast< sqlite::DbInt64 >(value);
+    } else {
+      this->_row << sqlite::null;
+    }
+  }
+  this->_row << sqlite::end_row;
 }
 
 } // end namespace analyzer
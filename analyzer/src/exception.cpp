@@ -62,5 +62,13 @@ const char* LogicError::what() const noexcept {
 
 LogicError::~LogicError() = default;
 
+// MemoryBudgetError
+
+const char* MemoryBudgetError::what() const noexcept {
+  return this->_msg->c_str();
+}
+
+MemoryBudgetError::~MemoryBudgetError() = default;
+
 } // end namespace analyzer
 } // end namespace ikos
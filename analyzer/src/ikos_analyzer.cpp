@@ -42,53 +42,93 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
+#include <cstring>
+#include <future>
 #include <iostream>
+#include <limits>
+#include <regex>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 
+#include <llvm/Config/llvm-config.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/IRReader/IRReader.h>
 #include <llvm/Support/CommandLine.h>
 #include <llvm/Support/Debug.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/PrettyStackTrace.h>
 #include <llvm/Support/Signals.h>
 #include <llvm/Support/SourceMgr.h>
 #include <llvm/Support/raw_ostream.h>
 
+#include <ikos/core/number/gmp_allocator.hpp>
+#include <ikos/core/support/parallel.hpp>
+
+#include <ikos/ar/format/binary.hpp>
 #include <ikos/ar/format/dot.hpp>
 #include <ikos/ar/format/formatter.hpp>
 #include <ikos/ar/format/text.hpp>
 #include <ikos/ar/pass/add_loop_counters.hpp>
+#include <ikos/ar/pass/constant_propagation.hpp>
 #include <ikos/ar/pass/name_values.hpp>
+#include <ikos/ar/pass/pass_manager.hpp>
 #include <ikos/ar/pass/simplify_cfg.hpp>
 #include <ikos/ar/pass/simplify_upcast_comparison.hpp>
+#include <ikos/ar/pass/slicing.hpp>
+#include <ikos/ar/pass/unroll_loops.hpp>
 #include <ikos/ar/pass/unify_exit_nodes.hpp>
 #include <ikos/ar/verify/frontend.hpp>
 #include <ikos/ar/verify/type.hpp>
 
 #include <ikos/frontend/llvm/import.hpp>
 
+#include <ikos/analyzer/analysis/alloc_size.hpp>
 #include <ikos/analyzer/analysis/call_context.hpp>
+#include <ikos/analyzer/analysis/call_graph.hpp>
+#include <ikos/analyzer/analysis/checkpoint.hpp>
 #include <ikos/analyzer/analysis/context.hpp>
+#include <ikos/analyzer/analysis/exception.hpp>
 #include <ikos/analyzer/analysis/fixpoint_profile.hpp>
+#include <ikos/analyzer/analysis/fixpoint_trace.hpp>
+#include <ikos/analyzer/analysis/function_budget.hpp>
+#include <ikos/analyzer/analysis/function_profiler.hpp>
+#include <ikos/analyzer/analysis/function_queue.hpp>
 #include <ikos/analyzer/analysis/hardware_addresses.hpp>
 #include <ikos/analyzer/analysis/literal.hpp>
 #include <ikos/analyzer/analysis/liveness.hpp>
+#include <ikos/analyzer/analysis/memory_budget.hpp>
 #include <ikos/analyzer/analysis/memory_location.hpp>
+#include <ikos/analyzer/analysis/mod_ref.hpp>
 #include <ikos/analyzer/analysis/option.hpp>
+#include <ikos/analyzer/analysis/pointer/context_sensitive.hpp>
 #include <ikos/analyzer/analysis/pointer/function.hpp>
 #include <ikos/analyzer/analysis/pointer/pointer.hpp>
+#include <ikos/analyzer/analysis/progress.hpp>
 #include <ikos/analyzer/analysis/result.hpp>
+#include <ikos/analyzer/analysis/result_cache.hpp>
+#include <ikos/analyzer/analysis/sparse_scalar.hpp>
 #include <ikos/analyzer/analysis/value/interprocedural.hpp>
 #include <ikos/analyzer/analysis/value/intraprocedural.hpp>
+#include <ikos/analyzer/analysis/value/summary.hpp>
 #include <ikos/analyzer/analysis/variable.hpp>
+#include <ikos/analyzer/analysis/variable_packing.hpp>
+#include <ikos/analyzer/analysis/wto.hpp>
 #include <ikos/analyzer/checker/name.hpp>
 #include <ikos/analyzer/database/output.hpp>
 #include <ikos/analyzer/util/color.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
 #include <ikos/analyzer/util/log.hpp>
 #include <ikos/analyzer/util/timer.hpp>
+#include <ikos/analyzer/util/work_stealing.hpp>
 
 namespace ar = ikos::ar;
 namespace llvm_to_ar = ikos::frontend::import;
@@ -107,11 +147,70 @@ static llvm::cl::opt< std::string > InputFilename(
 
 static llvm::cl::opt< std::string > OutputFilename(
     "o",
-    llvm::cl::desc("Output database filename (default: output.db)"),
+    llvm::cl::desc("Output filename (default: output.db)"),
     llvm::cl::value_desc("filename"),
     llvm::cl::init("output.db"),
     llvm::cl::cat(MainCategory));
 
+enum class OutputFormat { Db, JsonLines, Sarif };
+
+static llvm::cl::opt< OutputFormat > OutputFormatOpt(
+    "format",
+    llvm::cl::desc("Output format:"),
+    llvm::cl::values(
+        clEnumValN(OutputFormat::Db, "db", "SQLite database (default)"),
+        clEnumValN(OutputFormat::JsonLines,
+                   "jsonl",
+                   "Stream non-ok checks as newline-delimited JSON"),
+        clEnumValN(OutputFormat::Sarif,
+                   "sarif",
+                   "Stream non-ok checks as a SARIF log")),
+    llvm::cl::init(OutputFormat::Db),
+    llvm::cl::cat(MainCategory));
+
+static llvm::cl::opt< std::string > StreamChecksFilename(
+    "stream-checks",
+    llvm::cl::desc("Also write the checks that are not ok to the given file, "
+                   "as newline-delimited JSON, as soon as they are found"),
+    llvm::cl::value_desc("file"),
+    llvm::cl::cat(MainCategory));
+
+static llvm::cl::opt< bool > CompactChecks(
+    "compact-checks",
+    llvm::cl::desc("Only store the checks that are not ok in the output "
+                   "database, and count the others"),
+    llvm::cl::cat(MainCategory));
+
+static llvm::cl::opt< bool > AggregateChecks(
+    "aggregate-checks",
+    llvm::cl::desc("Store identical checks found in several calling contexts "
+                   "in one row of the output database"),
+    llvm::cl::cat(MainCategory));
+
+static llvm::cl::opt< bool > CompressDb(
+    "compress-db",
+    llvm::cl::desc("Compress the operands, check information and calling "
+                   "contexts columns of the output database"),
+    llvm::cl::cat(MainCategory));
+
+enum class DbProfile { Fast, Safe, Memory };
+
+static llvm::cl::opt< DbProfile > OutputDbProfile(
+    "db-profile",
+    llvm::cl::desc("Output database performance profile:"),
+    llvm::cl::values(
+        clEnumValN(DbProfile::Fast,
+                   "fast",
+                   "No journal and large transactions (default)"),
+        clEnumValN(DbProfile::Safe,
+                   "safe",
+                   "Journal and synchronous writes, small transactions"),
+        clEnumValN(DbProfile::Memory,
+                   "memory",
+                   "Build the database in memory, write it at exit")),
+    llvm::cl::init(DbProfile::Fast),
+    llvm::cl::cat(MainCategory));
+
 static llvm::cl::opt< analyzer::LogLevel > LogLevel(
     "log",
     llvm::cl::desc("Log level:"),
@@ -142,6 +241,13 @@ static llvm::cl::opt< ColorOpt > Color(
     llvm::cl::init(ColorOpt::Auto),
     llvm::cl::cat(MainCategory));
 
+static llvm::cl::opt< std::string > ServerSocket(
+    "server",
+    llvm::cl::desc("Load the input file, then wait for analysis requests on "
+                   "the given unix socket"),
+    llvm::cl::value_desc("socket"),
+    llvm::cl::cat(MainCategory));
+
 /// @}
 /// \name Analysis options
 /// @{
@@ -204,9 +310,10 @@ static llvm::cl::list< analyzer::CheckerName > Analyses(
                    checker_long_name(analyzer::CheckerName::DoubleFree))),
     llvm::cl::cat(AnalysisCategory));
 
-static llvm::cl::opt< analyzer::MachineIntDomainOption > Domain(
+static llvm::cl::list< analyzer::MachineIntDomainOption > Domains(
     "d",
-    llvm::cl::desc("Available abstract domains:"),
+    llvm::cl::desc("Available abstract domains (several domains are analyzed "
+                   "one after the other, sharing the pre-analyses):"),
     llvm::cl::values(
         clEnumValN(analyzer::MachineIntDomainOption::Interval,
                    machine_int_domain_option_str(
@@ -220,10 +327,19 @@ static llvm::cl::opt< analyzer::MachineIntDomainOption > Domain(
                    machine_int_domain_option_str(
                        analyzer::MachineIntDomainOption::IntervalCongruence),
                    "Reduced product of Interval and Congruence"),
+        clEnumValN(
+            analyzer::MachineIntDomainOption::IntervalCongruenceKnownBits,
+            machine_int_domain_option_str(
+                analyzer::MachineIntDomainOption::IntervalCongruenceKnownBits),
+            "Reduced product of Interval, Congruence and Known Bits"),
         clEnumValN(analyzer::MachineIntDomainOption::DBM,
                    machine_int_domain_option_str(
                        analyzer::MachineIntDomainOption::DBM),
                    "Difference-Bound Matrices domain"),
+        clEnumValN(analyzer::MachineIntDomainOption::SplitDBM,
+                   machine_int_domain_option_str(
+                       analyzer::MachineIntDomainOption::SplitDBM),
+                   "Sparse Difference-Bound Matrices domain"),
         clEnumValN(analyzer::MachineIntDomainOption::VarPackDBM,
                    machine_int_domain_option_str(
                        analyzer::MachineIntDomainOption::VarPackDBM),
@@ -306,7 +422,7 @@ static llvm::cl::opt< analyzer::MachineIntDomainOption > Domain(
                            VarPackApronPkgridPolyhedraLinearCongruences),
                    "APRON Pkgrid Polyhedra and Linear Congruences domain with "
                    "variable packing")),
-    llvm::cl::init(analyzer::MachineIntDomainOption::Interval),
+    llvm::cl::CommaSeparated,
     llvm::cl::cat(AnalysisCategory));
 
 static llvm::cl::list< std::string > EntryPoints(
@@ -333,7 +449,11 @@ static llvm::cl::opt< analyzer::Procedural > Procedural(
                                 "Interprocedural analysis (default)"),
                      clEnumValN(analyzer::Procedural::Intraprocedural,
                                 "intra",
-                                "Intraprocedural analysis")),
+                                "Intraprocedural analysis"),
+                     clEnumValN(analyzer::Procedural::Summary,
+                                "summary",
+                                "Bottom-up analysis using function "
+                                "summaries")),
     llvm::cl::init(analyzer::Procedural::Interprocedural),
     llvm::cl::cat(AnalysisCategory));
 
@@ -342,11 +462,51 @@ static llvm::cl::opt< bool > NoLiveness(
     llvm::cl::desc("Disable the liveness analysis"),
     llvm::cl::cat(AnalysisCategory));
 
+static llvm::cl::opt< bool > SparseScalars(
+    "sparse-scalars",
+    llvm::cl::desc("Propagate the integer variables with a single definition "
+                   "outside of cycles along their def-use chains"),
+    llvm::cl::cat(AnalysisCategory));
+
 static llvm::cl::opt< bool > NoPointer(
     "no-pointer",
     llvm::cl::desc("Disable the pointer analysis"),
     llvm::cl::cat(AnalysisCategory));
 
+static llvm::cl::opt< bool > NoModRef(
+    "no-mod-ref",
+    llvm::cl::desc("Disable the mod/ref analysis"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > PointerWideningThreshold(
+    "pointer-widening-threshold",
+    llvm::cl::desc("Number of updates of a pointer value using a join in the "
+                   "pointer constraint solver, before the widening is applied "
+                   "(default: 50)"),
+    llvm::cl::init(50),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< analyzer::PointerOffsetsOption > PointerOffsets(
+    "pointer-offsets",
+    llvm::cl::desc("Precision of the offsets in the pointer constraint solver"),
+    llvm::cl::values(
+        clEnumValN(analyzer::PointerOffsetsOption::Interval,
+                   "interval",
+                   "Compute an interval of offsets for each pointer (default)"),
+        clEnumValN(analyzer::PointerOffsetsOption::None,
+                   "none",
+                   "Only compute the points-to sets, faster")),
+    llvm::cl::init(analyzer::PointerOffsetsOption::Interval),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< bool > TypeFunctionPointers(
+    "type-function-pointers",
+    llvm::cl::desc("Resolve the indirect calls matching the signature of a "
+                   "single address-taken function before solving the "
+                   "function pointer constraints (the constraints are still "
+                   "solved if pointers are exchanged with external code)"),
+    llvm::cl::cat(AnalysisCategory));
+
 static llvm::cl::opt< bool > NoFixpointProfiles(
     "no-fixpoint-profiles",
     llvm::cl::desc("Disable the fixpoint profiles analysis"),
@@ -384,7 +544,11 @@ static llvm::cl::opt< analyzer::GlobalsInitPolicy > GlobalsInitPolicy(
                    "Initialize all global variables except strings"),
         clEnumValN(analyzer::GlobalsInitPolicy::None,
                    "none",
-                   "Do not initialize any global variable")),
+                   "Do not initialize any global variable"),
+        clEnumValN(analyzer::GlobalsInitPolicy::Lazy,
+                   "lazy",
+                   "Initialize only the global variables used by the code "
+                   "reachable from the entry points")),
     llvm::cl::init(analyzer::GlobalsInitPolicy::SkipBigArrays),
     llvm::cl::cat(AnalysisCategory));
 
@@ -399,7 +563,7 @@ static llvm::cl::list< std::string > HardwareAddresses(
 static llvm::cl::opt< std::string > HardwareAddressesFile(
     "hardware-addresses-file",
     llvm::cl::desc("Specify ranges (x-y) of hardware addresses from a file "
-                   "(one range per line)"),
+                   "(ranges separated by commas or new lines, or binary)"),
     llvm::cl::value_desc("file"),
     llvm::cl::cat(AnalysisCategory));
 
@@ -408,6 +572,255 @@ static llvm::cl::opt< int > Argc("argc",
                                  llvm::cl::init(-1),
                                  llvm::cl::cat(AnalysisCategory));
 
+static llvm::cl::opt< unsigned > Jobs(
+    "jobs",
+    llvm::cl::desc("Number of threads used to analyze entry points and to "
+                   "generate pointer constraints in parallel (default: 1)"),
+    llvm::cl::init(1),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< bool > FusedChecks(
+    "fused-checks",
+    llvm::cl::desc("Run the checks during the fixpoint computation and free "
+                   "the invariants as soon as possible, to reduce the memory "
+                   "usage (-proc=intra only)"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > WtoJobs(
+    "wto-jobs",
+    llvm::cl::desc("Number of threads used to analyze the independent "
+                   "components of a function (experimental, -proc=intra "
+                   "only)"),
+    llvm::cl::init(1),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > DomainJobs(
+    "domain-jobs",
+    llvm::cl::desc("Number of threads used by the variable packing domains "
+                   "to process independent packs in parallel (default: 1)"),
+    llvm::cl::init(1),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > CheckJobs(
+    "check-jobs",
+    llvm::cl::desc("Number of threads used to run the checkers of a function "
+                   "in parallel (-proc=inter only, default: 1)"),
+    llvm::cl::init(1),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< bool > StreamChecks(
+    "stream-checks",
+    llvm::cl::desc("Run the checks of a callee as soon as the fixpoint on its "
+                   "caller is reached, and free its invariants, to reduce the "
+                   "memory usage (-proc=inter only)"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > ContextDepth(
+    "context-depth",
+    llvm::cl::desc("Maximum number of call statements in the call context of "
+                   "a callee, deeper call contexts are merged (-proc=inter "
+                   "only, default: 0, no limit)"),
+    llvm::cl::init(0),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::list< std::string > ContextMerge(
+    "context-merge",
+    llvm::cl::desc("Functions analyzed in a single call context for all "
+                   "their call sites (-proc=inter only)"),
+    llvm::cl::CommaSeparated,
+    llvm::cl::value_desc("function"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > ContextPointerCache(
+    "context-pointer-cache",
+    llvm::cl::desc("Number of (call context, function) pairs for which a "
+                   "context-sensitive pointer information is cached, or 0 to "
+                   "disable the context-sensitive pointer analysis "
+                   "(-proc=inter only, default: 0)"),
+    llvm::cl::init(0),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< int > DynAllocContextDepth(
+    "dyn-alloc-context-depth",
+    llvm::cl::desc("Maximum number of call statements in the call context of "
+                   "a dynamic allocation site, 0 to only distinguish them by "
+                   "their call statement (-proc=inter only, default: no "
+                   "limit)"),
+    llvm::cl::init(-1),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< bool > WarmStartCycles(
+    "warm-start-cycles",
+    llvm::cl::desc("Start the iterations on the cycles of a callee from the "
+                   "invariants of its previous analysis, when the entry "
+                   "invariants are comparable (-proc=inter only)"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > SmashThreshold(
+    "smash-threshold",
+    llvm::cl::desc("Smash the cells of a memory location into a summary cell "
+                   "once it has more than the given number of cells, or 0 to "
+                   "never smash cells (default: 0)"),
+    llvm::cl::init(0),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > ArraySegments(
+    "array-segments",
+    llvm::cl::desc("Maximum number of segments of a summary cell, to keep "
+                   "elements written at a single index precise "
+                   "(default: 1)"),
+    llvm::cl::init(1),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< bool > GcLoopHeads(
+    "gc-loop-heads",
+    llvm::cl::desc("Forget the dynamic allocations that are no longer "
+                   "reachable from any pointer at cycle heads"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > WideningDelay(
+    "widening-delay",
+    llvm::cl::desc("Number of iterations on a cycle performed with a join "
+                   "before the widening is applied (default: 1)"),
+    llvm::cl::init(1),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > NarrowingIterations(
+    "narrowing-iterations",
+    llvm::cl::desc("Maximum number of narrowing iterations on a cycle, or 0 "
+                   "to narrow until convergence (default: 0)"),
+    llvm::cl::init(0),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< std::string > ResultCacheDirectory(
+    "result-cache",
+    llvm::cl::desc("Directory of the persistent cache of analysis results, "
+                   "reused for unchanged functions (-proc=intra only)"),
+    llvm::cl::value_desc("directory"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > FunctionTimeBudget(
+    "function-time-budget",
+    llvm::cl::desc("Treat a callee as an unknown function once its analysis "
+                   "takes more than the given number of seconds "
+                   "(-proc=inter only, default: 0, no limit)"),
+    llvm::cl::init(0),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > FunctionIterationBudget(
+    "function-iteration-budget",
+    llvm::cl::desc("Treat a callee as an unknown function once its analysis "
+                   "takes more than the given number of basic block "
+                   "iterations (-proc=inter only, default: 0, no limit)"),
+    llvm::cl::init(0),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > FunctionInvariantBudget(
+    "function-invariant-budget",
+    llvm::cl::desc("Treat a callee as an unknown function once an invariant "
+                   "at one of its cycle heads has more than the given number "
+                   "of memory cells (-proc=inter only, default: 0, no limit)"),
+    llvm::cl::init(0),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< analyzer::MachineIntDomainOption > AssertRefineDomain(
+    "assert-refine-domain",
+    llvm::cl::desc("Analyze again the functions with unproved assertions using "
+                   "the given relational domain (-proc=intra only)"),
+    llvm::cl::values(
+        clEnumValN(analyzer::MachineIntDomainOption::DBM,
+                   machine_int_domain_option_str(
+                       analyzer::MachineIntDomainOption::DBM),
+                   "Difference-Bound Matrices domain"),
+        clEnumValN(analyzer::MachineIntDomainOption::VarPackDBM,
+                   machine_int_domain_option_str(
+                       analyzer::MachineIntDomainOption::VarPackDBM),
+                   "Difference-Bound Matrices domain with variable packing"),
+        clEnumValN(analyzer::MachineIntDomainOption::ApronOctagon,
+                   machine_int_domain_option_str(
+                       analyzer::MachineIntDomainOption::ApronOctagon),
+                   "APRON Octagon domain"),
+        clEnumValN(analyzer::MachineIntDomainOption::VarPackApronOctagon,
+                   machine_int_domain_option_str(
+                       analyzer::MachineIntDomainOption::VarPackApronOctagon),
+                   "APRON Octagon domain with variable packing")),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< bool > ProfileFunctions(
+    "profile-functions",
+    llvm::cl::desc("Record the time, the number of iterations and the peak "
+                   "invariant size of the analysis of each function, per "
+                   "call context, in the profile table (-proc=inter only)"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< bool > PerfCountersOpt(
+    "perf-counters",
+    llvm::cl::desc("Record the hardware performance counters and the peak "
+                   "memory growth of each pass in the times table"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< std::string > ProgressFilename(
+    "progress-file",
+    llvm::cl::desc("Periodically write the current phase, the stack of "
+                   "functions being analyzed and the current cycle of each "
+                   "thread to the given JSON file"),
+    llvm::cl::value_desc("file"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > ProgressInterval(
+    "progress-interval",
+    llvm::cl::desc("Interval between two writes of the progress file, in "
+                   "seconds (default: 10)"),
+    llvm::cl::init(10),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< std::string > FunctionQueueDirectory(
+    "function-queue",
+    llvm::cl::desc("Share the functions to analyze with the other processes "
+                   "using the same queue directory, each function being "
+                   "analyzed by the first process claiming it (-proc=intra "
+                   "only)"),
+    llvm::cl::value_desc("directory"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< std::string > CheckpointFilename(
+    "checkpoint",
+    llvm::cl::desc("Commit the output database and record the entry point in "
+                   "the given file once the checks of an entry point are "
+                   "written (-proc=inter only)"),
+    llvm::cl::value_desc("file"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< bool > Resume(
+    "resume",
+    llvm::cl::desc("Skip the entry points recorded in the checkpoint file by "
+                   "a previous run (requires -checkpoint)"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< std::string > FixpointTraceFilename(
+    "fixpoint-trace",
+    llvm::cl::desc("Write a trace of the fixpoint iterations (functions, "
+                   "cycles, iterations, widenings and node visits) to the "
+                   "given file, in the Chrome trace event format"),
+    llvm::cl::value_desc("file"),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > FixpointTraceThreshold(
+    "fixpoint-trace-threshold",
+    llvm::cl::desc("Drop the events of the fixpoint trace shorter than the "
+                   "given number of microseconds (default: 100)"),
+    llvm::cl::init(100),
+    llvm::cl::cat(AnalysisCategory));
+
+static llvm::cl::opt< unsigned > MemoryBudgetSize(
+    "memory-budget",
+    llvm::cl::desc("Stop the value analysis once the resident set size "
+                   "exceeds the given number of megabytes, with exit code 10 "
+                   "(default: no budget)"),
+    llvm::cl::value_desc("MB"),
+    llvm::cl::init(0),
+    llvm::cl::cat(AnalysisCategory));
+
 /// @}
 /// \name Import options
 /// @{
@@ -435,6 +848,32 @@ static llvm::cl::opt< bool > AllowDebugInfoMismatch(
     llvm::cl::desc("Allow incorrect debug information in the module"),
     llvm::cl::cat(ImportCategory));
 
+static llvm::cl::opt< std::string > ARCacheFilename(
+    "ar-cache",
+    llvm::cl::desc("Binary file storing the AR after the passes, reused as "
+                   "long as the bitcode and the import options do not change"),
+    llvm::cl::value_desc("file"),
+    llvm::cl::cat(ImportCategory));
+
+static llvm::cl::opt< bool > ARCacheOnly(
+    "ar-cache-only",
+    llvm::cl::desc("Only save the AR in the cache given by -ar-cache, without "
+                   "running the analyses"),
+    llvm::cl::cat(ImportCategory));
+
+static llvm::cl::opt< bool > LazyImport(
+    "lazy-import",
+    llvm::cl::desc("Only translate the bodies of the functions reachable from "
+                   "the entry points (requires -proc=inter)"),
+    llvm::cl::cat(ImportCategory));
+
+static llvm::cl::opt< unsigned > ImportJobs(
+    "import-jobs",
+    llvm::cl::desc("Number of threads used to translate the function bodies "
+                   "from LLVM to AR (default: 1)"),
+    llvm::cl::init(1),
+    llvm::cl::cat(ImportCategory));
+
 /// @}
 /// \name Passes options
 /// @{
@@ -451,9 +890,30 @@ static llvm::cl::opt< bool > NoSimplifyCFG(
     llvm::cl::desc("Do not run the simplify-cfg pass"),
     llvm::cl::cat(PassCategory));
 
+static llvm::cl::opt< bool > ConstantPropagation(
+    "constant-propagation",
+    llvm::cl::desc("Propagate integer constants and remove infeasible "
+                   "branches"),
+    llvm::cl::cat(PassCategory));
+
+static llvm::cl::opt< unsigned > UnrollLoops(
+    "unroll-loops",
+    llvm::cl::desc("Unroll the innermost loops running at most <n> iterations "
+                   "(default: 0, disabled)"),
+    llvm::cl::value_desc("n"),
+    llvm::cl::init(0),
+    llvm::cl::cat(PassCategory));
+
+static llvm::cl::opt< bool > Slice(
+    "slice",
+    llvm::cl::desc("Remove the statements that the selected checkers do not "
+                   "depend on (only with dbz, shc, sio, uio and prover)"),
+    llvm::cl::cat(PassCategory));
+
 static llvm::cl::opt< bool > AddLoopCounters(
     "add-loop-counters",
-    llvm::cl::desc("Add a loop counter in each cycle"),
+    llvm::cl::desc("Add a loop counter in each cycle with an exit depending on "
+                   "an induction variable"),
     llvm::cl::cat(PassCategory));
 
 static llvm::cl::opt< bool > NameValues(
@@ -471,6 +931,13 @@ static llvm::cl::opt< bool > NoSimplifyUpcastComparison(
     llvm::cl::desc("Do not simplify the implicit upcast before a comparison"),
     llvm::cl::cat(PassCategory));
 
+static llvm::cl::opt< unsigned > PassJobs(
+    "pass-jobs",
+    llvm::cl::desc("Number of threads used to verify the AR and run the AR "
+                   "passes on the functions (default: 1)"),
+    llvm::cl::init(1),
+    llvm::cl::cat(PassCategory));
+
 /// @}
 /// \name Debug options
 /// @{
@@ -515,6 +982,20 @@ static llvm::cl::opt< std::string > GenerateDotDirectory(
     llvm::cl::init("."),
     llvm::cl::cat(DebugCategory));
 
+static llvm::cl::opt< std::string > GenerateDotFunctions(
+    "generate-dot-functions",
+    llvm::cl::desc("Only generate .dot files for the functions whose name "
+                   "matches the given regular expression"),
+    llvm::cl::value_desc("regex"),
+    llvm::cl::cat(DebugCategory));
+
+static llvm::cl::opt< unsigned > FormatJobs(
+    "format-jobs",
+    llvm::cl::desc("Number of threads used to format the functions for "
+                   "-display-ar and -generate-dot (default: 1)"),
+    llvm::cl::init(1),
+    llvm::cl::cat(DebugCategory));
+
 static llvm::cl::opt< analyzer::DisplayOption > DisplayInvariants(
     "display-inv",
     llvm::cl::desc("Display computed invariants"),
@@ -578,6 +1059,197 @@ static llvm_to_ar::Importer::ImportOptions make_import_options() {
   return opts;
 }
 
+/// \brief Return true if only the reachable functions should be imported
+static bool use_lazy_import() {
+  return LazyImport && Procedural == analyzer::Procedural::Interprocedural;
+}
+
+/// \brief Build the key of the AR cache from the input file and the command
+/// line arguments affecting the AR
+///
+/// Returns an empty string if the input file cannot be read.
+static std::string make_ar_cache_key() {
+  llvm::ErrorOr< std::unique_ptr< llvm::MemoryBuffer > > input =
+      llvm::MemoryBuffer::getFile(InputFilename);
+  if (!input) {
+    return std::string();
+  }
+
+  llvm::MD5 md5;
+  md5.update((*input)->getBuffer());
+  for (bool flag : {NoLibIkos.getValue(),
+                    NoLibc.getValue(),
+                    NoLibcpp.getValue(),
+                    AllowDebugInfoMismatch.getValue(),
+                    NoSimplifyCFG.getValue(),
+                    ConstantPropagation.getValue(),
+                    AddLoopCounters.getValue(),
+                    NoSimplifyUpcastComparison.getValue(),
+                    NameValues.getValue(),
+                    NoNamePrefix.getValue()}) {
+    md5.update(flag ? "1" : "0");
+  }
+  md5.update(std::to_string(UnrollLoops.getValue()));
+  if (use_lazy_import()) {
+    md5.update("lazy-import");
+    for (const std::string& entry_point : EntryPoints) {
+      md5.update(entry_point);
+      md5.update(",");
+    }
+  }
+
+  llvm::MD5::MD5Result result;
+  md5.final(result);
+  llvm::SmallString< 32 > str;
+  llvm::MD5::stringifyResult(result, str);
+  return str.str().str();
+}
+
+/// \brief Load the AR bundle from the cache
+///
+/// Returns null if there is no cached bundle for the given key.
+static ar::Bundle* load_ar_cache(ar::Context& ctx,
+                                 llvm::Module& module,
+                                 const std::string& key) {
+  boost::filesystem::ifstream input(ARCacheFilename.getValue(),
+                                    std::ios::binary);
+  if (!input.is_open()) {
+    return nullptr;
+  }
+
+  llvm_to_ar::ValueIndex index(module);
+  ar::Bundle* bundle = ar::BinaryReader(&index).read(input, ctx, key);
+  if (bundle != nullptr) {
+    bundle->set_frontend(&module);
+  }
+  return bundle;
+}
+
+/// \brief Store the AR bundle in the cache
+static void save_ar_cache(ar::Bundle* bundle,
+                          llvm::Module& module,
+                          const std::string& key) {
+  boost::filesystem::path path = ARCacheFilename.getValue();
+  boost::filesystem::path tmp_path = path.string() + ".tmp";
+  boost::system::error_code err;
+
+  if (path.has_parent_path()) {
+    boost::filesystem::create_directories(path.parent_path(), err);
+  }
+
+  {
+    boost::filesystem::ofstream output(tmp_path, std::ios::binary);
+    if (!output.is_open()) {
+      analyzer::log::warning(tmp_path.string() + ": " + strerror(errno));
+      return;
+    }
+    llvm_to_ar::ValueIndex index(module);
+    ar::BinaryWriter(&index).write(output, bundle, key);
+  }
+
+  // Rename, so that a concurrent run never reads a partial file
+  boost::filesystem::rename(tmp_path, path, err);
+  if (err) {
+    analyzer::log::warning(path.string() + ": " + err.message());
+  }
+}
+
+/// \brief Build the verification stamp of the input file
+///
+/// The stamp identifies the bitcode and the versions of IKOS and LLVM.
+/// Returns an empty string if the input file cannot be read.
+static std::string make_verify_stamp() {
+  llvm::ErrorOr< std::unique_ptr< llvm::MemoryBuffer > > input =
+      llvm::MemoryBuffer::getFile(InputFilename);
+  if (!input) {
+    return std::string();
+  }
+
+  llvm::MD5 md5;
+  md5.update((*input)->getBuffer());
+
+  llvm::MD5::MD5Result result;
+  md5.final(result);
+  llvm::SmallString< 32 > str;
+  llvm::MD5::stringifyResult(result, str);
+  return str.str().str() + " ikos-" + IKOS_VERSION + " llvm-" +
+         LLVM_VERSION_STRING;
+}
+
+/// \brief Return the path of the verification stamp stored with the AR cache
+static boost::filesystem::path verify_stamp_path() {
+  return ARCacheFilename.getValue() + ".verified";
+}
+
+/// \brief Return true if the bitcode with the given stamp was already
+/// verified
+static bool is_verified(const std::string& stamp) {
+  boost::filesystem::ifstream input(verify_stamp_path());
+  std::string line;
+  return input.is_open() && std::getline(input, line) && line == stamp;
+}
+
+/// \brief Store the verification stamp with the AR cache
+static void save_verify_stamp(const std::string& stamp) {
+  boost::filesystem::path path = verify_stamp_path();
+  boost::filesystem::path tmp_path = path.string() + ".tmp";
+  boost::system::error_code err;
+
+  if (path.has_parent_path()) {
+    boost::filesystem::create_directories(path.parent_path(), err);
+  }
+
+  {
+    boost::filesystem::ofstream output(tmp_path);
+    if (!output.is_open()) {
+      analyzer::log::warning(tmp_path.string() + ": " + strerror(errno));
+      return;
+    }
+    output << stamp << "\n";
+  }
+
+  boost::filesystem::rename(tmp_path, path, err);
+  if (err) {
+    analyzer::log::warning(path.string() + ": " + err.message());
+  }
+}
+
+/// \brief Return the path of the fixpoint profiles stored with the AR cache
+static boost::filesystem::path fixpoint_profiles_cache_path() {
+  return ARCacheFilename.getValue() + ".profiles";
+}
+
+/// \brief Load the fixpoint profiles stored with the AR cache
+static void load_fixpoint_profiles_cache(
+    analyzer::FixpointProfileAnalysis& profiler, const std::string& key) {
+  boost::filesystem::ifstream input(fixpoint_profiles_cache_path());
+  if (input.is_open() && !profiler.load(input, key)) {
+    analyzer::log::debug("Ignoring invalid fixpoint profiles cache");
+  }
+}
+
+/// \brief Store the fixpoint profiles with the AR cache
+static void save_fixpoint_profiles_cache(
+    const analyzer::FixpointProfileAnalysis& profiler, const std::string& key) {
+  boost::filesystem::path path = fixpoint_profiles_cache_path();
+  boost::filesystem::path tmp_path = path.string() + ".tmp";
+  boost::system::error_code err;
+
+  {
+    boost::filesystem::ofstream output(tmp_path);
+    if (!output.is_open()) {
+      analyzer::log::warning(tmp_path.string() + ": " + strerror(errno));
+      return;
+    }
+    profiler.save(output, key);
+  }
+
+  boost::filesystem::rename(tmp_path, path, err);
+  if (err) {
+    analyzer::log::warning(path.string() + ": " + err.message());
+  }
+}
+
 /// \brief Build format options from command line arguments
 static ar::Formatter::FormatOptions make_format_options() {
   ar::Formatter::FormatOptions opts;
@@ -598,7 +1270,86 @@ inline Iterator find_undefined_functions(Iterator begin,
   });
 }
 
+/// \brief Return the list of abstract domains, without duplicates
+static std::vector< analyzer::MachineIntDomainOption > make_domains() {
+  std::vector< analyzer::MachineIntDomainOption > domains;
+  for (analyzer::MachineIntDomainOption domain : Domains) {
+    if (std::find(domains.begin(), domains.end(), domain) == domains.end()) {
+      domains.push_back(domain);
+    }
+  }
+  if (domains.empty()) {
+    domains.push_back(analyzer::MachineIntDomainOption::Interval);
+  }
+  return domains;
+}
+
+/// \brief Return the slicing criterion of the selected checkers
+///
+/// Returns an empty criterion if a selected checker needs the whole program.
+static ar::SlicingPass::Criterion make_slicing_criterion() {
+  bool dbz = false, shc = false, sio = false, uio = false;
+  for (analyzer::CheckerName name : Analyses) {
+    switch (name) {
+      case analyzer::CheckerName::DivisionByZero: {
+        dbz = true;
+      } break;
+      case analyzer::CheckerName::ShiftCount: {
+        shc = true;
+      } break;
+      case analyzer::CheckerName::SignedIntOverflow: {
+        sio = true;
+      } break;
+      case analyzer::CheckerName::UnsignedIntOverflow: {
+        uio = true;
+      } break;
+      case analyzer::CheckerName::AssertProver: {
+        // Assertions are calls, which are always kept
+      } break;
+      default: {
+        return nullptr;
+      }
+    }
+  }
+
+  return [=](ar::Statement* stmt) {
+    auto bin = ar::dyn_cast< ar::BinaryOperation >(stmt);
+    if (bin == nullptr) {
+      return false;
+    }
+
+    switch (bin->op()) {
+      case ar::BinaryOperation::UDiv:
+        return dbz || uio;
+      case ar::BinaryOperation::SDiv:
+      case ar::BinaryOperation::SRem:
+        return dbz || sio;
+      case ar::BinaryOperation::URem:
+        return dbz;
+      case ar::BinaryOperation::SShl:
+      case ar::BinaryOperation::UShl:
+      case ar::BinaryOperation::SLShr:
+      case ar::BinaryOperation::ULShr:
+      case ar::BinaryOperation::SAShr:
+      case ar::BinaryOperation::UAShr:
+        return shc;
+      case ar::BinaryOperation::SAdd:
+      case ar::BinaryOperation::SSub:
+      case ar::BinaryOperation::SMul:
+        return sio;
+      case ar::BinaryOperation::UAdd:
+      case ar::BinaryOperation::USub:
+      case ar::BinaryOperation::UMul:
+        return uio;
+      default:
+        return false;
+    }
+  };
+}
+
 /// \brief Build analysis options from command line arguments
+///
+/// The machine integer domain is the first domain of the command line.
 static analyzer::AnalysisOptions make_analysis_options(ar::Bundle* bundle) {
   auto resolve_function = [=](const auto& name) {
     return bundle->function_or_null(name);
@@ -614,25 +1365,282 @@ static analyzer::AnalysisOptions make_analysis_options(ar::Bundle* bundle) {
                                                          resolve_function),
                           boost::make_transform_iterator(NoInitGlobals.end(),
                                                          resolve_function)},
-      .machine_int_domain = Domain,
+      .machine_int_domain = make_domains().front(),
       .procedural = Procedural,
       .use_liveness = !NoLiveness,
+      .use_sparse_scalars = SparseScalars,
       .use_pointer = !NoPointer,
+      .use_mod_ref = !NoModRef,
+      .pointer_widening_threshold = PointerWideningThreshold,
+      .pointer_offsets = PointerOffsets,
+      .type_function_pointers = TypeFunctionPointers,
       .precision = Precision,
       .globals_init_policy = GlobalsInitPolicy,
       .display_invariants = DisplayInvariants,
       .display_checks = DisplayChecks,
       .hardware_addresses = {bundle, HardwareAddresses, HardwareAddressesFile},
       .argc = ((Argc >= 0) ? boost::optional< int >(Argc) : boost::none),
+      .jobs = std::max(Jobs.getValue(), 1u),
+      .fused_checks = FusedChecks,
+      .wto_jobs = std::max(WtoJobs.getValue(), 1u),
+      .check_jobs = std::max(CheckJobs.getValue(), 1u),
+      .stream_checks = StreamChecks,
+      .context_depth = ContextDepth,
+      .context_merge = {boost::make_transform_iterator(ContextMerge.begin(),
+                                                       resolve_function),
+                        boost::make_transform_iterator(ContextMerge.end(),
+                                                       resolve_function)},
+      .context_pointer_cache = ContextPointerCache,
+      .dyn_alloc_context_depth =
+          ((DynAllocContextDepth >= 0)
+               ? boost::optional< unsigned >(DynAllocContextDepth)
+               : boost::none),
+      .warm_start_cycles = WarmStartCycles,
+      .smash_threshold = SmashThreshold,
+      .array_segments = ArraySegments,
+      .gc_loop_heads = GcLoopHeads,
+      .widening_delay = WideningDelay,
+      .narrowing_iterations = NarrowingIterations,
+      .function_time_budget = FunctionTimeBudget,
+      .function_iteration_budget = FunctionIterationBudget,
+      .function_invariant_budget = FunctionInvariantBudget,
+      .assert_refine_domain =
+          ((AssertRefineDomain.getNumOccurrences() > 0)
+               ? boost::optional< analyzer::MachineIntDomainOption >(
+                     AssertRefineDomain)
+               : boost::none),
   };
 }
 
+/// \brief Run the value analysis and the checks
+///
+/// `timer_suffix` is appended to the names of the timers.
+static void run_value_analysis(analyzer::Context& ctx,
+                               analyzer::OutputDatabase& output_db,
+                               const std::string& timer_suffix) {
+  if (Procedural == analyzer::Procedural::Interprocedural) {
+    if (!ResultCacheDirectory.empty()) {
+      analyzer::log::warning(
+          "-result-cache is not supported with -proc=inter, ignoring it");
+    }
+    if (!FunctionQueueDirectory.empty()) {
+      analyzer::log::warning(
+          "-function-queue is not supported with -proc=inter, ignoring it");
+    }
+    if (ctx.opts.assert_refine_domain) {
+      analyzer::log::warning("-assert-refine-domain is not supported with "
+                             "-proc=inter, ignoring it");
+    }
+    analyzer::InterproceduralValueAnalysis analysis(ctx);
+    analyzer::log::info("Running interprocedural value analysis");
+    analyzer::ScopeTimerDatabase t(output_db.times,
+                                   "ikos-analyzer.value-analysis" +
+                                       timer_suffix);
+    analysis.run();
+  } else if (Procedural == analyzer::Procedural::Intraprocedural) {
+    if (ProfileFunctions) {
+      analyzer::log::warning(
+          "-profile-functions is not supported with -proc=intra, ignoring it");
+    }
+    if (ctx.opts.check_jobs > 1) {
+      analyzer::log::warning(
+          "-check-jobs is not supported with -proc=intra, ignoring it");
+    }
+    if (ctx.opts.stream_checks) {
+      analyzer::log::warning(
+          "-stream-checks is not supported with -proc=intra, ignoring it");
+    }
+    if (ctx.opts.context_depth > 0 || !ctx.opts.context_merge.empty()) {
+      analyzer::log::warning(
+          "-context-depth and -context-merge are not supported with "
+          "-proc=intra, ignoring them");
+    }
+    if (ctx.opts.warm_start_cycles) {
+      analyzer::log::warning(
+          "-warm-start-cycles is not supported with -proc=intra, ignoring it");
+    }
+    if (analyzer::FunctionBudget(ctx.opts).enabled()) {
+      analyzer::log::warning(
+          "-function-*-budget are not supported with -proc=intra, ignoring "
+          "them");
+    }
+    std::unique_ptr< analyzer::ResultCache > result_cache;
+    if (!ResultCacheDirectory.empty()) {
+      result_cache =
+          std::make_unique< analyzer::ResultCache >(ctx,
+                                                    ResultCacheDirectory
+                                                        .getValue());
+      ctx.result_cache = result_cache.get();
+    }
+
+    analyzer::IntraproceduralValueAnalysis analysis(ctx);
+    analyzer::log::info("Running intraprocedural value analysis");
+    {
+      analyzer::ScopeTimerDatabase t(output_db.times,
+                                     "ikos-analyzer.value-analysis" +
+                                         timer_suffix);
+      analysis.run();
+    }
+
+    if (result_cache) {
+      output_db.times.insert("ikos-analyzer.result-cache.hits" + timer_suffix,
+                             static_cast< double >(result_cache->hits()));
+      output_db.times.insert("ikos-analyzer.result-cache.misses" +
+                                 timer_suffix,
+                             static_cast< double >(result_cache->misses()));
+      ctx.result_cache = nullptr;
+    }
+  } else if (Procedural == analyzer::Procedural::Summary) {
+    if (!ResultCacheDirectory.empty()) {
+      analyzer::log::warning(
+          "-result-cache is not supported with -proc=summary, ignoring it");
+    }
+    if (!FunctionQueueDirectory.empty()) {
+      analyzer::log::warning(
+          "-function-queue is not supported with -proc=summary, ignoring it");
+    }
+    if (ProfileFunctions) {
+      analyzer::log::warning(
+          "-profile-functions is not supported with -proc=summary, ignoring "
+          "it");
+    }
+    if (ctx.opts.check_jobs > 1) {
+      analyzer::log::warning(
+          "-check-jobs is not supported with -proc=summary, ignoring it");
+    }
+    if (ctx.opts.stream_checks) {
+      analyzer::log::warning(
+          "-stream-checks is not supported with -proc=summary, ignoring it");
+    }
+    if (ctx.opts.context_depth > 0 || !ctx.opts.context_merge.empty()) {
+      analyzer::log::warning(
+          "-context-depth and -context-merge are not supported with "
+          "-proc=summary, ignoring them");
+    }
+    if (ctx.opts.warm_start_cycles) {
+      analyzer::log::warning(
+          "-warm-start-cycles is not supported with -proc=summary, ignoring it");
+    }
+    if (ctx.opts.fused_checks) {
+      analyzer::log::warning(
+          "-fused-checks is not supported with -proc=summary, ignoring it");
+    }
+    if (ctx.opts.assert_refine_domain) {
+      analyzer::log::warning("-assert-refine-domain is not supported with "
+                             "-proc=summary, ignoring it");
+    }
+    if (ctx.opts.wto_jobs > 1) {
+      analyzer::log::warning(
+          "-wto-jobs is not supported with -proc=summary, ignoring it");
+    }
+    if (analyzer::FunctionBudget(ctx.opts).enabled()) {
+      analyzer::log::warning(
+          "-function-*-budget are not supported with -proc=summary, ignoring "
+          "them");
+    }
+    analyzer::SummaryValueAnalysis analysis(ctx);
+    analyzer::log::info("Running bottom-up summary value analysis");
+    analyzer::ScopeTimerDatabase t(output_db.times,
+                                   "ikos-analyzer.value-analysis" +
+                                       timer_suffix);
+    analysis.run();
+  } else {
+    ikos_unreachable("unreachable");
+  }
+}
+
+/// \brief Save the number of function definitions and statements to analyze
+/// in the times table
+static void save_program_size(ar::Bundle* bundle, analyzer::TimesTable& times) {
+  std::size_t num_functions = 0;
+  std::size_t num_statements = 0;
+  for (auto it = bundle->function_begin(), et = bundle->function_end();
+       it != et;
+       ++it) {
+    ar::Function* fun = *it;
+    if (fun->is_declaration()) {
+      continue;
+    }
+    num_functions++;
+    for (ar::BasicBlock* bb : *fun->body()) {
+      num_statements += bb->num_statements();
+    }
+  }
+  times.insert("ikos-analyzer.ar.functions",
+               static_cast< double >(num_functions));
+  times.insert("ikos-analyzer.ar.statements",
+               static_cast< double >(num_statements));
+}
+
+/// \brief Freeze the control flow graph of each code, see ar::CodeGraph
+static void freeze_graphs(ar::Bundle* bundle) {
+  for (auto it = bundle->global_begin(), et = bundle->global_end(); it != et;
+       ++it) {
+    ar::GlobalVariable* gv = *it;
+    if (gv->is_definition()) {
+      gv->initializer()->freeze_graph();
+    }
+  }
+  for (auto it = bundle->function_begin(), et = bundle->function_end();
+       it != et;
+       ++it) {
+    ar::Function* fun = *it;
+    if (fun->is_definition()) {
+      fun->body()->freeze_graph();
+    }
+  }
+}
+
+/// \brief Configure the output database for the given profile
+static void configure_database(analyzer::sqlite::DbConnection& db,
+                               DbProfile profile) {
+  using namespace analyzer::sqlite;
+
+  // The page size is set before any table is created: the database is written
+  // with its final page size and never needs a VACUUM
+  db.set_page_size(16384);
+
+  switch (profile) {
+    case DbProfile::Fast: {
+      db.set_cache_size(64 * 1024);
+      db.set_journal_mode(JournalMode::Off);
+      db.set_synchronous_flag(SynchronousFlag::Off);
+      db.set_max_rows_per_transaction(65536);
+    } break;
+    case DbProfile::Safe: {
+      db.set_journal_mode(JournalMode::Delete);
+      db.set_synchronous_flag(SynchronousFlag::Full);
+      db.set_max_rows_per_transaction(1024);
+    } break;
+    case DbProfile::Memory: {
+      db.set_cache_size(256 * 1024);
+      db.set_journal_mode(JournalMode::Off);
+      db.set_synchronous_flag(SynchronousFlag::Off);
+      db.set_max_rows_per_transaction(
+          std::numeric_limits< std::size_t >::max());
+    } break;
+  }
+}
+
 /// \brief Generate a .dot file for each function in the given Bundle
 static void generate_dot(ar::Bundle* bundle,
-                         const boost::filesystem::path& directory) {
+                         const boost::filesystem::path& directory,
+                         const std::string& functions,
+                         unsigned jobs) {
   boost::system::error_code err;
   ar::DotFormatter formatter(make_format_options());
 
+  std::regex filter;
+  if (!functions.empty()) {
+    try {
+      filter = std::regex(functions);
+    } catch (const std::regex_error& e) {
+      analyzer::log::error("-generate-dot-functions: " + functions + ": " +
+                           e.what());
+      return;
+    }
+  }
+
   if (!boost::filesystem::exists(directory)) {
     if (!boost::filesystem::create_directories(directory, err)) {
       analyzer::log::error(directory.string() + ": " + err.message());
@@ -644,6 +1652,8 @@ static void generate_dot(ar::Bundle* bundle,
     return;
   }
 
+  // Only the requested functions are formatted
+  std::vector< ar::Function* > selected;
   for (auto it = bundle->function_begin(), et = bundle->function_end();
        it != et;
        ++it) {
@@ -652,19 +1662,181 @@ static void generate_dot(ar::Bundle* bundle,
     if (!fun->is_definition()) {
       continue;
     }
+    if (!functions.empty() && !std::regex_match(fun->name(), filter)) {
+      continue;
+    }
 
-    std::string filename = fun->name() + ".dot";
-    boost::filesystem::path filepath = directory / filename;
-    analyzer::log::debug("Creating " +
-                         ((directory == ".") ? filename : filepath.string()));
-    boost::filesystem::ofstream output(filepath);
+    selected.push_back(fun);
+  }
 
-    if (!output.is_open()) {
-      analyzer::log::error(filepath.string() + ": " + strerror(errno));
+  if (selected.empty()) {
+    if (!functions.empty()) {
+      analyzer::log::warning("No function matches -generate-dot-functions=" +
+                             functions);
+    }
+    return;
+  }
+
+  unsigned num_threads = static_cast< unsigned >(
+      std::min(static_cast< std::size_t >(std::max(jobs, 1u)),
+               selected.size()));
+  analyzer::WorkStealingPool pool(num_threads);
+
+  std::vector< analyzer::WorkStealingPool::Task > tasks;
+  tasks.reserve(selected.size());
+  for (ar::Function* fun : selected) {
+    tasks.emplace_back([&formatter, &directory, &pool, fun]() {
+      std::string filename = fun->name() + ".dot";
+      boost::filesystem::path filepath = directory / filename;
+      analyzer::log::debug(
+          "Creating " + ((directory == ".") ? filename : filepath.string()));
+      boost::filesystem::ofstream output(filepath);
+
+      if (!output.is_open()) {
+        analyzer::log::error(filepath.string() + ": " + strerror(errno));
+        pool.cancel();
+        return;
+      }
+
+      formatter.format(output, fun);
+    });
+  }
+
+  pool.start(std::move(tasks));
+  pool.join();
+}
+
+/// \brief Read a line from a file descriptor, without the newline
+///
+/// Returns false on end of file or error.
+static bool read_line(int fd, std::string& line) {
+  line.clear();
+  char c;
+  while (true) {
+    ssize_t n = ::read(fd, &c, 1);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return !line.empty();
+    }
+    if (c == '\n') {
+      return true;
+    }
+    line.push_back(c);
+  }
+}
+
+/// \brief Write a string on a file descriptor
+static void write_all(int fd, const std::string& str) {
+  const char* data = str.data();
+  std::size_t size = str.size();
+  while (size > 0) {
+    ssize_t n = ::write(fd, data, size);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
       return;
     }
+    data += n;
+    size -= static_cast< std::size_t >(n);
+  }
+}
 
-    formatter.format(output, fun);
+/// \brief Wait for analysis requests on the server socket
+///
+/// A request is a command line of ikos-analyzer, one argument per line,
+/// terminated by an empty line. Each request is analyzed by a child process,
+/// which shares the bundle loaded so far, and writes its output on the
+/// connection. The server then writes `exit-status: <code>` and closes the
+/// connection.
+///
+/// Returns true in the child process, once the options of the request are
+/// parsed. Returns false with `exit_code` set if the server fails.
+static bool serve(const char* argv0, int& exit_code) {
+  const std::string& path = ServerSocket.getValue();
+  exit_code = 1;
+
+  struct sockaddr_un addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(addr.sun_path)) {
+    analyzer::log::error(path + ": socket path is too long");
+    return false;
+  }
+  std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+  int server = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (server < 0) {
+    analyzer::log::error(path + ": " + strerror(errno));
+    return false;
+  }
+  ::unlink(path.c_str());
+  auto sockaddr = reinterpret_cast< struct sockaddr* >(&addr);
+  if (::bind(server, sockaddr, sizeof(addr)) < 0 || ::listen(server, 16) < 0) {
+    analyzer::log::error(path + ": " + strerror(errno));
+    ::close(server);
+    return false;
+  }
+
+  analyzer::log::info("Waiting for analysis requests on " + path);
+  while (true) {
+    int conn = ::accept(server, nullptr, nullptr);
+    if (conn < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      analyzer::log::error(path + ": " + strerror(errno));
+      ::close(server);
+      return false;
+    }
+
+    std::vector< std::string > args;
+    std::string line;
+    while (read_line(conn, line) && !line.empty()) {
+      args.push_back(line);
+    }
+
+    std::cout.flush();
+    std::cerr.flush();
+    llvm::outs().flush();
+    llvm::errs().flush();
+
+    pid_t pid = ::fork();
+    if (pid == 0) {
+      // Child: the output goes to the client
+      ::close(server);
+      ::dup2(conn, STDOUT_FILENO);
+      ::dup2(conn, STDERR_FILENO);
+      ::close(conn);
+
+      std::vector< const char* > argv;
+      argv.push_back(argv0);
+      for (const std::string& arg : args) {
+        argv.push_back(arg.c_str());
+      }
+      llvm::cl::ResetAllOptionOccurrences();
+      llvm::cl::ParseCommandLineOptions(static_cast< int >(argv.size()),
+                                        argv.data());
+      return true;
+    }
+
+    int code = 1;
+    if (pid < 0) {
+      analyzer::log::error(std::string("fork: ") + strerror(errno));
+    } else {
+      int status = 0;
+      while (::waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+      }
+      if (WIFEXITED(status)) {
+        code = WEXITSTATUS(status);
+      } else if (WIFSIGNALED(status)) {
+        code = 128 + WTERMSIG(status);
+      }
+    }
+    write_all(conn, "exit-status: " + std::to_string(code) + "\n");
+    ::close(conn);
   }
 }
 
@@ -673,6 +1845,9 @@ int main(int argc, char** argv) {
   llvm::sys::PrintStackTraceOnErrorSignal(argv[0]);
   llvm::PrettyStackTraceProgram pstp(argc, argv);
 
+  // Allocate the GMP numbers in per-thread pools, before any is created
+  ikos::core::install_gmp_allocator();
+
   // Program name
   std::string progname = boost::filesystem::path(argv[0]).filename().string();
 
@@ -682,8 +1857,8 @@ int main(int argc, char** argv) {
   // Call llvm_shutdown() on exit
   llvm::llvm_shutdown_obj shutdown;
 
-  // LLVM context
-  llvm::LLVMContext llvm_context;
+  // LLVM context, released after the translation into AR
+  auto llvm_context = std::make_unique< llvm::LLVMContext >();
 
   /*
    * Parse parameters
@@ -695,48 +1870,215 @@ int main(int argc, char** argv) {
   // Set log level
   analyzer::log::Level = LogLevel;
 
+  // Enable the performance counters, if asked
+  analyzer::PerfCounters::Enable = PerfCountersOpt;
+
   // Enable colors, if asked
   analyzer::color::Enable =
       (Color == ColorOpt::Yes ||
        (Color == ColorOpt::Auto && analyzer::log::out_isatty()));
 
+  if (ARCacheOnly && ARCacheFilename.empty()) {
+    llvm::errs() << progname << ": error: -ar-cache-only requires -ar-cache\n";
+    return 1;
+  }
+
+  if (!FunctionQueueDirectory.empty() && !ResultCacheDirectory.empty()) {
+    llvm::errs() << progname
+                 << ": error: -function-queue cannot be used with "
+                    "-result-cache\n";
+    return 1;
+  }
+
+  if (Resume && CheckpointFilename.empty()) {
+    llvm::errs() << progname << ": error: -resume requires -checkpoint\n";
+    return 1;
+  }
+
+  if (!CheckpointFilename.empty() &&
+      (Procedural != analyzer::Procedural::Interprocedural ||
+       OutputFormatOpt != OutputFormat::Db ||
+       OutputDbProfile == DbProfile::Memory || CompactChecks ||
+       AggregateChecks)) {
+    llvm::errs() << progname
+                 << ": error: -checkpoint requires -proc=inter and a database "
+                    "written to disk, without -compact-checks and "
+                    "-aggregate-checks\n";
+    return 1;
+  }
+
   try {
 #ifndef NDEBUG
     analyzer::log::warning(
         "ikos was compiled in debug mode, the analysis might be slow");
 #endif
 
-    // Initialize output database
-    // This might throw DbError, see catch()
-    analyzer::log::debug("Creating output database " + OutputFilename);
-    analyzer::sqlite::DbConnection db(OutputFilename);
-    db.set_journal_mode(analyzer::sqlite::JournalMode::Off);
-    db.set_synchronous_flag(analyzer::sqlite::SynchronousFlag::Off);
-    analyzer::OutputDatabase output_db(db);
+    // Outputs of the analysis
+    //
+    // In server mode, they are opened again for each request.
+    std::unique_ptr< analyzer::CheckSink > sink;
+    std::unique_ptr< analyzer::CheckSink > stream;
+    std::unique_ptr< analyzer::sqlite::DbConnection > db;
+    std::unique_ptr< analyzer::OutputDatabase > output_db;
+    std::unique_ptr< analyzer::ProgressReporter > progress;
+    std::unique_ptr< analyzer::Checkpoint > checkpoint;
+    std::unique_ptr< analyzer::FixpointTraceWriter > fixpoint_trace;
+    std::unique_ptr< analyzer::MemoryBudget > memory_budget;
+
+    auto open_outputs = [&]() -> int {
+      // Initialize the check sink, when streaming the results
+      sink.reset();
+      if (OutputFormatOpt == OutputFormat::JsonLines) {
+        sink = std::make_unique< analyzer::JsonLinesCheckSink >(OutputFilename);
+      } else if (OutputFormatOpt == OutputFormat::Sarif) {
+        sink = std::make_unique< analyzer::SarifCheckSink >(OutputFilename);
+      }
+      if (sink && !sink->is_open()) {
+        llvm::errs() << progname << ": " << OutputFilename
+                     << ": error: " << strerror(errno) << "\n";
+        return 1;
+      }
+
+      // Initialize output database
+      // When streaming, the database only lives in memory and is discarded
+      // This might throw DbError, see catch()
+      analyzer::log::debug("Creating output database " + OutputFilename);
+      output_db.reset();
+      db = std::make_unique< analyzer::sqlite::DbConnection >(
+          (sink || OutputDbProfile == DbProfile::Memory)
+              ? std::string(":memory:")
+              : OutputFilename.getValue());
+      configure_database(*db, OutputDbProfile);
+      if (!CheckpointFilename.empty()) {
+        // The committed rows must survive if the process is killed
+        db->set_journal_mode(analyzer::sqlite::JournalMode::Delete);
+      }
+      output_db = std::make_unique< analyzer::OutputDatabase >(*db,
+                                                               sink.get(),
+                                                               CompactChecks,
+                                                               AggregateChecks,
+                                                               CompressDb);
+
+      // Stream the checks as they are found, if asked
+      stream.reset();
+      if (!StreamChecksFilename.empty()) {
+        stream = std::make_unique< analyzer::JsonLinesCheckSink >(
+            StreamChecksFilename, /*flush=*/true);
+        if (!stream->is_open()) {
+          llvm::errs() << progname << ": " << StreamChecksFilename
+                       << ": error: " << strerror(errno) << "\n";
+          return 1;
+        }
+        output_db->checks.set_stream(stream.get());
+      }
+
+      // Report the progress of the analysis, if asked
+      progress.reset();
+      if (!ProgressFilename.empty()) {
+        progress = std::make_unique< analyzer::ProgressReporter >(
+            ProgressFilename, std::chrono::seconds(ProgressInterval));
+      }
+
+      // Record the analyzed entry points, if asked
+      checkpoint.reset();
+      if (!CheckpointFilename.empty()) {
+        checkpoint =
+            std::make_unique< analyzer::Checkpoint >(CheckpointFilename,
+                                                     Resume);
+        if (!checkpoint->is_open()) {
+          llvm::errs() << progname << ": " << CheckpointFilename
+                       << ": error: " << strerror(errno) << "\n";
+          return 1;
+        }
+      }
+
+      // Trace the fixpoint iterations, if asked
+      fixpoint_trace.reset();
+      if (!FixpointTraceFilename.empty()) {
+        fixpoint_trace = std::make_unique< analyzer::FixpointTraceWriter >(
+            FixpointTraceFilename,
+            std::chrono::microseconds(FixpointTraceThreshold));
+        if (!fixpoint_trace->is_open()) {
+          llvm::errs() << progname << ": " << FixpointTraceFilename
+                       << ": error: " << strerror(errno) << "\n";
+          return 1;
+        }
+      }
+
+      // Limit the memory used by the value analysis, if asked
+      memory_budget.reset();
+      if (MemoryBudgetSize > 0) {
+        memory_budget = std::make_unique< analyzer::MemoryBudget >(
+            static_cast< std::size_t >(MemoryBudgetSize) * 1024 * 1024);
+      }
+      return 0;
+    };
+
+    if (int ret = open_outputs()) {
+      return ret;
+    }
+
+    auto set_phase = [&progress](const std::string& phase) {
+      if (progress) {
+        progress->set_phase(phase);
+      }
+    };
 
     // Load the input module
     std::unique_ptr< llvm::Module > module = nullptr;
+
+    // With -lazy-import, the functions reachable from the entry points
+    std::unique_ptr< llvm_to_ar::FunctionSet > reachable = nullptr;
+    auto compute_reachable = [&] {
+      std::vector< std::string > entry_points(EntryPoints.begin(),
+                                              EntryPoints.end());
+      reachable = std::make_unique< llvm_to_ar::FunctionSet >(
+          llvm_to_ar::reachable_functions(*module, entry_points));
+    };
     {
       analyzer::log::debug("Loading LLVM bitcode");
-      analyzer::ScopeTimerDatabase t(output_db.times, "ikos-analyzer.load-bc");
+      set_phase("load-bc");
+      analyzer::ScopeTimerDatabase t(output_db->times, "ikos-analyzer.load-bc");
       llvm::SMDiagnostic err; // Error diagnostic
-      module = llvm::parseIRFile(InputFilename, err, llvm_context);
+      module = llvm::getLazyIRFileModule(InputFilename, err, *llvm_context);
       if (!module) {
         err.print(progname.c_str(), llvm::errs());
         return 2;
       }
+
+      // With -lazy-import, only the bodies of the reachable functions are
+      // read. The AR cache indexes all the values of the module.
+      // This might throw ImportError, see catch()
+      if (use_lazy_import() && ARCacheFilename.empty()) {
+        compute_reachable();
+      } else {
+        llvm_to_ar::materialize_functions(*module);
+      }
     }
 
     // Immediately run the verifier to catch any problems
-    {
+    //
+    // With an AR cache, a stamp records that this bitcode was already
+    // verified by the same versions of IKOS and LLVM.
+    std::string verify_stamp;
+    if (!ARCacheFilename.empty()) {
+      verify_stamp = make_verify_stamp();
+    }
+    if (!verify_stamp.empty() && is_verified(verify_stamp)) {
+      analyzer::log::debug("Skipping verification of LLVM bitcode, already "
+                           "verified");
+    } else {
       analyzer::log::debug("Verifying integrity of LLVM bitcode");
-      analyzer::ScopeTimerDatabase t(output_db.times,
+      analyzer::ScopeTimerDatabase t(output_db->times,
                                      "ikos-analyzer.verify-bc");
       if (verifyModule(*module, &llvm::errs())) {
         llvm::errs() << progname << ": " << InputFilename
                      << ": error: input module is broken!\n";
         return 3;
       }
+      if (!verify_stamp.empty()) {
+        save_verify_stamp(verify_stamp);
+      }
     }
 
     // Check for debug information in LLVM
@@ -752,18 +2094,77 @@ int main(int argc, char** argv) {
     // AR context
     ar::Context ar_context;
 
+    // Load the AR from the cache
+    ar::Bundle* bundle = nullptr;
+    std::string ar_cache_key;
+    if (!ARCacheFilename.empty()) {
+      ar_cache_key = make_ar_cache_key();
+    }
+    if (!ar_cache_key.empty()) {
+      analyzer::log::debug("Loading AR from " + ARCacheFilename);
+      analyzer::ScopeTimerDatabase t(output_db->times,
+                                     "ikos-analyzer.load-ar-cache");
+      bundle = load_ar_cache(ar_context, *module, ar_cache_key);
+    }
+    bool ar_from_cache = (bundle != nullptr);
+
     // Translate LLVM bitcode into AR
     // This might throw ImportError, see catch()
-    ar::Bundle* bundle = nullptr;
-    {
+    if (!ar_from_cache) {
       analyzer::log::info("Translating LLVM bitcode to AR");
-      analyzer::ScopeTimerDatabase t(output_db.times,
-                                     "ikos-analyzer.llvm-to-ar");
-      llvm_to_ar::Importer importer(ar_context);
+      set_phase("llvm-to-ar");
+      analyzer::Timer timer;
+      timer.start();
+      llvm_to_ar::Importer importer(ar_context, ImportJobs);
+      if (use_lazy_import()) {
+        if (reachable == nullptr) {
+          compute_reachable();
+        }
+        importer.set_reachable_functions(std::move(*reachable));
+      } else if (LazyImport) {
+        analyzer::log::warning(
+            "Ignoring -lazy-import: only supported with -proc=inter");
+      }
       bundle = importer.import(*module, make_import_options());
+      timer.stop();
+
+      double elapsed = timer.elapsed().count();
+      output_db->times.insert("ikos-analyzer.llvm-to-ar", elapsed);
+      if (elapsed > 0) {
+        // Import throughput, in constants per second
+        auto num_constants = static_cast< double >(ar_context.num_constants());
+        output_db->times.insert("ikos-analyzer.llvm-to-ar.constants-per-second",
+                               num_constants / elapsed);
+      }
+
+      // Details of the import, to find the expensive phases
+      const llvm_to_ar::ImportStatistics& stats = importer.statistics();
+      std::pair< const char*, double > details[] = {
+          {"declarations", stats.declarations_time},
+          {"initializers", stats.initializers_time},
+          {"bodies", stats.bodies_time},
+          {"types", stats.types_time},
+          {"match-di-types", stats.match_di_types_time},
+          {"constants", stats.constants_time},
+          {"library-functions", stats.library_functions_time},
+          {"types.count", static_cast< double >(stats.types)},
+          {"types.cache-hits", static_cast< double >(stats.type_cache_hits)},
+          {"constants.count", static_cast< double >(stats.constants)},
+          {"constants.cache-hits",
+           static_cast< double >(stats.constant_cache_hits)},
+          {"library-functions.count",
+           static_cast< double >(stats.library_functions)},
+          {"statements.count", static_cast< double >(stats.statements)},
+      };
+      for (const auto& detail : details) {
+        output_db->times.insert(std::string("ikos-analyzer.llvm-to-ar.") +
+                                    detail.first,
+                                detail.second);
+      }
     }
 
-    // Check that EntryPoints and NoInitGlobals have valid function names
+    // Check that EntryPoints, NoInitGlobals and ContextMerge have valid
+    // function names
     {
       auto it = find_undefined_functions(EntryPoints.begin(),
                                          EntryPoints.end(),
@@ -782,101 +2183,246 @@ int main(int argc, char** argv) {
                      << ": error: could not find function '" << *it << "'\n";
         return 6;
       }
-    }
 
-    // Run type checker
-    if (!NoTypeCheck) {
-      analyzer::log::debug("Running type verifier on AR");
-      analyzer::ScopeTimerDatabase t(output_db.times,
-                                     "ikos-analyzer.type-checker");
-      if (!ar::TypeVerifier(/*all = */ true).verify(bundle, std::cerr)) {
+      it = find_undefined_functions(ContextMerge.begin(),
+                                    ContextMerge.end(),
+                                    bundle);
+      if (it != ContextMerge.end()) {
         llvm::errs() << progname << ": " << InputFilename
-                     << ": error: type checker\n";
-        return 7;
+                     << ": error: could not find function '" << *it << "'\n";
+        return 6;
       }
     }
 
-    // Check for debug information in AR
-    if (!ar::FrontendVerifier(/*all = */ true).verify(bundle, std::cerr)) {
-      return 8;
-    }
+    // The cached AR has already been verified and simplified
+    if (!ar_from_cache) {
+      // Run type checker
+      if (!NoTypeCheck) {
+        analyzer::log::debug("Running type verifier on AR");
+        analyzer::ScopeTimerDatabase t(output_db->times,
+                                       "ikos-analyzer.type-checker");
+        if (!ar::TypeVerifier(/*all = */ true)
+                 .verify(bundle, std::cerr, PassJobs)) {
+          llvm::errs() << progname << ": " << InputFilename
+                       << ": error: type checker\n";
+          return 7;
+        }
+      }
 
-    // Simplify the control flow graph
-    if (!NoSimplifyCFG) {
-      analyzer::log::debug("Running simplify-cfg pass on AR");
-      analyzer::ScopeTimerDatabase t(output_db.times,
-                                     "ikos-analyzer.simplify-cfg");
-      ar::SimplifyCFGPass().run(bundle);
-    }
+      // Check for debug information in AR
+      {
+        analyzer::ScopeTimerDatabase t(output_db->times,
+                                       "ikos-analyzer.frontend-verifier");
+        if (!ar::FrontendVerifier(/*all = */ true)
+                 .verify(bundle, std::cerr, PassJobs)) {
+          return 8;
+        }
+      }
 
-    // Add a loop counter in each cycle, for the Gauge domain
-    if (AddLoopCounters) {
-      analyzer::log::debug("Running add-loop-counters pass on AR");
-      analyzer::ScopeTimerDatabase t(output_db.times,
-                                     "ikos-analyzer.add-loop-counters");
-      ar::AddLoopCountersPass().run(bundle);
+      // Run the AR passes
+      //
+      // Consecutive code passes are fused into one traversal per function.
+      {
+        ar::PassManager passes(PassJobs);
+
+        // Propagate constants and remove infeasible branches, before the
+        // control flow graph is simplified
+        if (ConstantPropagation) {
+          passes.add(std::make_unique< ar::ConstantPropagationPass >());
+        }
+
+        // Simplify the control flow graph
+        if (!NoSimplifyCFG) {
+          passes.add(std::make_unique< ar::SimplifyCFGPass >());
+        }
+
+        // Unroll loops with a small constant trip count
+        if (UnrollLoops > 0) {
+          passes.add(std::make_unique< ar::UnrollLoopsPass >(UnrollLoops));
+        }
+
+        // Add a loop counter in each cycle with an induction variable exit,
+        // for the Gauge domain
+        if (AddLoopCounters) {
+          passes.add(std::make_unique< ar::AddLoopCountersPass >());
+        }
+
+        // Simplify upcast comparison loop
+        if (!NoSimplifyUpcastComparison) {
+          passes.add(std::make_unique< ar::SimplifyUpcastComparisonPass >());
+        }
+
+        // Unify all exit nodes
+        passes.add(std::make_unique< ar::UnifyExitNodesPass >());
+
+        // Name variables and basic block, for debugging purpose only
+        if (NameValues) {
+          passes.add(std::make_unique< ar::NameValuesPass >(!NoNamePrefix));
+        }
+
+        analyzer::log::debug("Running passes on AR");
+        analyzer::ScopeTimerDatabase t(output_db->times,
+                                       "ikos-analyzer.ar-passes");
+        set_phase("ar-passes");
+        passes.run(bundle);
+      }
+
+      // Store the AR in the cache
+      if (!ar_cache_key.empty()) {
+        analyzer::log::debug("Saving AR in " + ARCacheFilename);
+        analyzer::ScopeTimerDatabase t(output_db->times,
+                                       "ikos-analyzer.save-ar-cache");
+        save_ar_cache(bundle, *module, ar_cache_key);
+      }
     }
 
-    // Simplify upcast comparison loop
-    if (!NoSimplifyUpcastComparison) {
-      analyzer::log::debug("Running simplify-upcast-comparison pass on AR");
-      analyzer::ScopeTimerDatabase
-          t(output_db.times, "ikos-analyzer.simplify-upcast-comparison");
-      ar::SimplifyUpcastComparisonPass().run(bundle);
+    // The AR cache is ready for later runs
+    if (ARCacheOnly) {
+      return 0;
     }
 
-    // Unify all exit nodes
+    // Copy the source information needed by the analyses and checkers, then
+    // release the LLVM module and context before running the analyses
+    std::unique_ptr< analyzer::FrontendInfo > frontend_info;
     {
-      analyzer::log::debug("Running unify-exit-nodes pass on AR");
-      analyzer::ScopeTimerDatabase t(output_db.times,
-                                     "ikos-analyzer.unify-exit-nodes");
-      ar::UnifyExitNodesPass().run(bundle);
+      analyzer::log::debug("Releasing LLVM bitcode");
+      analyzer::ScopeTimerDatabase t(output_db->times,
+                                     "ikos-analyzer.release-bc");
+      frontend_info = std::make_unique< analyzer::FrontendInfo >(bundle);
+      analyzer::FrontendInfo::set(frontend_info.get());
+      bundle->set_frontend< llvm::Module >(nullptr);
+      module.reset();
+      llvm_context.reset();
     }
 
-    // Name variables and basic block, for debugging purpose only
-    if (NameValues) {
-      analyzer::log::debug("Running name-values pass on AR");
-      analyzer::ScopeTimerDatabase t(output_db.times,
-                                     "ikos-analyzer.name-values");
-      ar::NameValuesPass(!NoNamePrefix).run(bundle);
+    // In server mode, each request continues from here in a child process,
+    // with its own options
+    if (!ServerSocket.empty()) {
+      std::string bundle_key = make_ar_cache_key();
+      boost::filesystem::path input_path = InputFilename.getValue();
+
+      // Threads are not duplicated by fork()
+      progress.reset();
+      fixpoint_trace.reset();
+      output_db.reset();
+      db.reset();
+      stream.reset();
+      sink.reset();
+
+      int exit_code;
+      if (!serve(argv[0], exit_code)) {
+        return exit_code;
+      }
+
+      analyzer::log::Level = LogLevel;
+      analyzer::color::Enable =
+          (Color == ColorOpt::Yes ||
+           (Color == ColorOpt::Auto && analyzer::log::out_isatty()));
+
+      boost::system::error_code err;
+      if (!boost::filesystem::equivalent(InputFilename.getValue(),
+                                         input_path,
+                                         err) ||
+          make_ar_cache_key() != bundle_key) {
+        llvm::errs() << progname << ": " << InputFilename
+                     << ": error: the input file or the import and pass "
+                        "options differ from the ones of the server\n";
+        return 11;
+      }
+
+      if (int ret = open_outputs()) {
+        return ret;
+      }
+    }
+
+    // Slice the program with respect to the selected checkers
+    bool sliced = false;
+    if (Slice) {
+      ar::SlicingPass::Criterion criterion = make_slicing_criterion();
+      if (criterion) {
+        analyzer::log::info("Slicing the program");
+        analyzer::ScopeTimerDatabase t(output_db->times,
+                                       "ikos-analyzer.slicing");
+        set_phase("slicing");
+        ar::PassManager passes(PassJobs);
+        passes.add(std::make_unique< ar::SlicingPass >(
+            std::move(criterion), /*ignore_floating_point = */ true));
+        passes.run(bundle);
+        sliced = true;
+      } else {
+        analyzer::log::warning(
+            "Ignoring -slice: the selected checkers need the whole program");
+      }
     }
 
     // Display the abstract representation
     if (DisplayAR) {
       analyzer::log::info("Printing Abstract Representation");
-      analyzer::ScopeTimerDatabase t(output_db.times,
+      analyzer::ScopeTimerDatabase t(output_db->times,
                                      "ikos-analyzer.display-ar");
       ar::TextFormatter formatter(make_format_options());
-      formatter.format(analyzer::log::out(), bundle);
+      formatter.format(analyzer::log::out(), bundle, FormatJobs);
     }
 
     // Generate .dot files
     if (GenerateDot) {
       analyzer::log::info("Generating .dot files");
-      analyzer::ScopeTimerDatabase t(output_db.times,
+      analyzer::ScopeTimerDatabase t(output_db->times,
                                      "ikos-analyzer.generate-dot");
-      generate_dot(bundle, GenerateDotDirectory.getValue());
+      generate_dot(bundle,
+                   GenerateDotDirectory.getValue(),
+                   GenerateDotFunctions.getValue(),
+                   FormatJobs);
     }
 
+    // The control flow graphs are not modified from now on
+    {
+      analyzer::log::debug("Freezing control flow graphs");
+      analyzer::ScopeTimerDatabase t(output_db->times,
+                                     "ikos-analyzer.freeze-cfg");
+      freeze_graphs(bundle);
+    }
+
+    save_program_size(bundle, output_db->times);
+
     // Save analysis options in the database
     analyzer::AnalysisOptions opts = make_analysis_options(bundle);
-    opts.save(output_db.settings);
+    opts.save(output_db->settings);
 
     // Initialize factories
-    analyzer::MemoryFactory mem_factory;
+    analyzer::CallContextFactory call_context_factory;
+    analyzer::MemoryFactory mem_factory(call_context_factory,
+                                        opts.dyn_alloc_context_depth);
     analyzer::VariableFactory var_factory(bundle);
     analyzer::LiteralFactory lit_factory(var_factory, bundle->data_layout());
-    analyzer::CallContextFactory call_context_factory;
+    analyzer::WtoCache wto_cache;
 
     // Analysis context
     analyzer::Context ctx(bundle,
                           opts,
                           boost::filesystem::current_path(),
-                          output_db,
+                          *output_db,
                           mem_factory,
                           var_factory,
                           lit_factory,
-                          call_context_factory);
+                          call_context_factory,
+                          wto_cache);
+    ctx.progress = progress.get();
+    ctx.checkpoint = checkpoint.get();
+    ctx.fixpoint_trace = fixpoint_trace.get();
+    ctx.memory_budget = memory_budget.get();
+
+    // Compute the allocation sizes of the global variables and functions,
+    // shared by the execution engines and the checkers
+    analyzer::GlobalAllocSizes global_alloc_sizes(ctx);
+    {
+      analyzer::log::debug("Computing global allocation sizes");
+      analyzer::ScopeTimerDatabase t(output_db->times,
+                                     "ikos-analyzer.global-alloc-sizes");
+      set_phase("global-alloc-sizes");
+      global_alloc_sizes.run();
+      ctx.global_alloc_sizes = &global_alloc_sizes;
+    }
 
     // First, run a liveness analysis
     //
@@ -885,8 +2431,9 @@ int main(int argc, char** argv) {
     analyzer::LivenessAnalysis liveness(ctx);
     if (!NoLiveness) {
       analyzer::log::info("Running liveness analysis");
-      analyzer::ScopeTimerDatabase t(output_db.times,
+      analyzer::ScopeTimerDatabase t(output_db->times,
                                      "ikos-analyzer.liveness-analysis");
+      set_phase("liveness-analysis");
       liveness.run();
       ctx.liveness = &liveness;
     }
@@ -894,30 +2441,57 @@ int main(int argc, char** argv) {
       liveness.dump(analyzer::log::out());
     }
 
-    // Run the fixpoint profile analysis
+    // Find the integer variables propagated along their def-use chains
+    analyzer::SparseScalarAnalysis sparse_scalars(ctx);
+    if (SparseScalars) {
+      analyzer::log::info("Running sparse scalar analysis");
+      analyzer::ScopeTimerDatabase t(output_db->times,
+                                     "ikos-analyzer.sparse-scalar-analysis");
+      set_phase("sparse-scalar-analysis");
+      sparse_scalars.run();
+      ctx.sparse_scalars = &sparse_scalars;
+    }
+
+    // Set up the fixpoint profile analysis
     //
-    // This is used to detect widening hints, useful for other analyses
+    // This is used to detect widening hints, useful for other analyses.
+    // Profiles are computed on demand, or loaded with the AR cache.
     analyzer::FixpointProfileAnalysis profiler(ctx);
     if (!NoFixpointProfiles) {
-      analyzer::log::info("Running fixpoint profile analysis");
-      analyzer::ScopeTimerDatabase t(output_db.times,
-                                     "ikos-analyzer.fixpoint-profile-analysis");
-      profiler.run();
+      if (ar_from_cache) {
+        load_fixpoint_profiles_cache(profiler, ar_cache_key);
+      }
+      if (DisplayFixpointProfiles) {
+        analyzer::log::info("Running fixpoint profile analysis");
+        analyzer::ScopeTimerDatabase t(output_db->times,
+                                       "ikos-analyzer.fixpoint-profile-"
+                                       "analysis");
+        set_phase("fixpoint-profile-analysis");
+        profiler.run();
+      }
       ctx.fixpoint_profiler = &profiler;
     }
     if (DisplayFixpointProfiles) {
       profiler.dump(analyzer::log::out());
     }
 
+    // The pointer analyses are used by the intraprocedural and summary value
+    // analyses, and by the context-sensitive pointer analysis
+    bool use_pointer =
+        !NoPointer && (Procedural == analyzer::Procedural::Intraprocedural ||
+                       Procedural == analyzer::Procedural::Summary ||
+                       ContextPointerCache > 0);
+
     // Run a fast intraprocedural function pointer analysis
     //
     // The goal here is to get all function pointers so that we can analyse
     // precisely indirect calls in the following analyses
     analyzer::FunctionPointerAnalysis function_pointer(ctx);
-    if (Procedural == analyzer::Procedural::Intraprocedural && !NoPointer) {
+    if (use_pointer) {
       analyzer::log::info("Running function pointer analysis");
-      analyzer::ScopeTimerDatabase t(output_db.times,
+      analyzer::ScopeTimerDatabase t(output_db->times,
                                      "ikos-analyzer.function-pointer-analysis");
+      set_phase("function-pointer-analysis");
       function_pointer.run();
       ctx.function_pointer = &function_pointer;
     }
@@ -929,10 +2503,11 @@ int main(int argc, char** argv) {
     //
     // That step uses the result of the previous function pointer analysis.
     analyzer::PointerAnalysis pointer(ctx, function_pointer);
-    if (Procedural == analyzer::Procedural::Intraprocedural && !NoPointer) {
+    if (use_pointer) {
       analyzer::log::info("Running pointer analysis");
-      analyzer::ScopeTimerDatabase t(output_db.times,
+      analyzer::ScopeTimerDatabase t(output_db->times,
                                      "ikos-analyzer.pointer-analysis");
+      set_phase("pointer-analysis");
       pointer.run();
       ctx.pointer = &pointer;
     }
@@ -940,21 +2515,214 @@ int main(int argc, char** argv) {
       pointer.dump(analyzer::log::out());
     }
 
-    // Final step, run a value analysis, and check properties on the results
-    if (Procedural == analyzer::Procedural::Interprocedural) {
-      analyzer::InterproceduralValueAnalysis analysis(ctx);
-      analyzer::log::info("Running interprocedural value analysis");
-      analyzer::ScopeTimerDatabase t(output_db.times,
-                                     "ikos-analyzer.value-analysis");
-      analysis.run();
-    } else if (Procedural == analyzer::Procedural::Intraprocedural) {
-      analyzer::IntraproceduralValueAnalysis analysis(ctx);
-      analyzer::log::info("Running intraprocedural value analysis");
-      analyzer::ScopeTimerDatabase t(output_db.times,
-                                     "ikos-analyzer.value-analysis");
-      analysis.run();
-    } else {
-      ikos_unreachable("unreachable");
+    // Compute the call graph and its strongly connected components, used to
+    // detect recursive calls, to schedule the functions and by the mod/ref
+    // analysis
+    analyzer::CallGraph call_graph(ctx);
+    if (Procedural == analyzer::Procedural::Interprocedural ||
+        Procedural == analyzer::Procedural::Summary || !NoModRef) {
+      analyzer::log::info("Computing call graph");
+      analyzer::ScopeTimerDatabase t(output_db->times,
+                                     "ikos-analyzer.call-graph");
+      set_phase("call-graph");
+      call_graph.run();
+      ctx.call_graph = &call_graph;
+    }
+
+    // Compute the memory locations that each function may write, to limit
+    // the memory forgotten at the calls that are not analyzed
+    analyzer::ModRefAnalysis mod_ref(ctx, call_graph);
+    if (!NoModRef) {
+      analyzer::log::info("Running mod/ref analysis");
+      analyzer::ScopeTimerDatabase t(output_db->times,
+                                     "ikos-analyzer.mod-ref-analysis");
+      set_phase("mod-ref-analysis");
+      mod_ref.run();
+      ctx.mod_ref = &mod_ref;
+    }
+
+    // Check whether the program can catch exceptions. If not, the value
+    // analyses do not propagate exception states
+    analyzer::ExceptionAnalysis exception(ctx);
+    {
+      analyzer::log::info("Running exception analysis");
+      analyzer::ScopeTimerDatabase t(output_db->times,
+                                     "ikos-analyzer.exception-analysis");
+      set_phase("exception-analysis");
+      exception.run();
+      ctx.exception = &exception;
+      if (exception.exception_free()) {
+        analyzer::log::debug("No exception handler, exceptions are ignored");
+      }
+    }
+
+    // Process independent parts of abstract values in parallel
+    ikos::core::Parallel::set_jobs(DomainJobs);
+
+    // Group related integer variables into packs for the variable packing
+    // domains, so that their equivalence classes do not have to be merged
+    // during the analysis
+    analyzer::VariablePackingAnalysis var_packing(ctx);
+    {
+      std::vector< analyzer::MachineIntDomainOption > domains = make_domains();
+      if (std::any_of(domains.begin(),
+                      domains.end(),
+                      analyzer::machine_int_domain_option_is_var_pack)) {
+        analyzer::log::info("Running variable packing analysis");
+        analyzer::ScopeTimerDatabase t(output_db->times,
+                                       "ikos-analyzer.variable-packing-analysis");
+        set_phase("variable-packing-analysis");
+        var_packing.run();
+      }
+    }
+
+    // Refine the pointer analysis results for each call context, on demand
+    std::unique_ptr< analyzer::ContextSensitivePointerAnalysis >
+        context_pointer;
+    if (use_pointer && Procedural == analyzer::Procedural::Interprocedural) {
+      context_pointer =
+          std::make_unique< analyzer::ContextSensitivePointerAnalysis >(
+              ctx, pointer, ContextPointerCache);
+      ctx.context_pointer = context_pointer.get();
+    }
+
+    // Final step, run a value analysis for each abstract domain, and check
+    // properties on the results
+    //
+    // The pre-analyses above are shared by all the domains. When several
+    // domains are given, the checks are tagged with the name of the domain.
+    std::vector< analyzer::MachineIntDomainOption > domains = make_domains();
+    if (domains.size() > 1) {
+      analyzer::JsonList json_domains;
+      for (analyzer::MachineIntDomainOption domain : domains) {
+        json_domains.add(machine_int_domain_option_str(domain));
+      }
+      output_db->settings.insert("machine-int-domains", json_domains);
+    }
+    for (analyzer::MachineIntDomainOption domain : domains) {
+      analyzer::AnalysisOptions domain_opts = ctx.opts;
+      domain_opts.machine_int_domain = domain;
+
+      // APRON managers are shared by all the abstract values of a domain and
+      // are not thread-safe
+      bool apron = analyzer::machine_int_domain_option_is_apron(domain);
+      if (apron && (domain_opts.jobs > 1 || domain_opts.wto_jobs > 1 ||
+                    domain_opts.check_jobs > 1 || DomainJobs > 1)) {
+        analyzer::log::warning(
+            "-jobs, -wto-jobs, -check-jobs and -domain-jobs are not supported "
+            "with " +
+            std::string(machine_int_domain_option_str(domain)) +
+            ", analyzing on a single thread");
+        domain_opts.jobs = 1;
+        domain_opts.wto_jobs = 1;
+        domain_opts.check_jobs = 1;
+      }
+      ikos::core::Parallel::set_jobs(apron ? 1 : DomainJobs.getValue());
+      analyzer::Context domain_ctx(bundle,
+                                   std::move(domain_opts),
+                                   ctx.wd,
+                                   *output_db,
+                                   mem_factory,
+                                   var_factory,
+                                   lit_factory,
+                                   call_context_factory,
+                                   wto_cache);
+      domain_ctx.liveness = ctx.liveness;
+      domain_ctx.sparse_scalars = ctx.sparse_scalars;
+      domain_ctx.call_graph = ctx.call_graph;
+      domain_ctx.mod_ref = ctx.mod_ref;
+      domain_ctx.fixpoint_profiler = ctx.fixpoint_profiler;
+      domain_ctx.function_pointer = ctx.function_pointer;
+      domain_ctx.pointer = ctx.pointer;
+      domain_ctx.context_pointer = ctx.context_pointer;
+      domain_ctx.progress = ctx.progress;
+      domain_ctx.checkpoint = ctx.checkpoint;
+      domain_ctx.fixpoint_trace = ctx.fixpoint_trace;
+      domain_ctx.memory_budget = ctx.memory_budget;
+
+      std::string timer_suffix;
+      std::string domain_tag;
+      if (domains.size() > 1) {
+        domain_tag = machine_int_domain_option_str(domain);
+        timer_suffix = "." + domain_tag;
+        output_db->checks.set_domain(domain_tag);
+        analyzer::log::info("Using abstract domain " + domain_tag);
+      }
+
+      std::unique_ptr< analyzer::FunctionProfiler > function_profiler;
+      if (ProfileFunctions) {
+        function_profiler = std::make_unique< analyzer::FunctionProfiler >();
+        domain_ctx.function_profiler = function_profiler.get();
+      }
+
+      // Each domain analyzes all the functions, hence has its own queue
+      std::unique_ptr< analyzer::FunctionQueue > function_queue;
+      if (!FunctionQueueDirectory.empty() &&
+          Procedural == analyzer::Procedural::Intraprocedural) {
+        function_queue = std::make_unique< analyzer::FunctionQueue >(
+            boost::filesystem::path(FunctionQueueDirectory.getValue()) /
+            (domain_tag.empty() ? "default" : domain_tag));
+        domain_ctx.function_queue = function_queue.get();
+      }
+
+      std::unique_ptr< analyzer::BudgetDowngrades > budget_downgrades;
+      if (Procedural == analyzer::Procedural::Interprocedural &&
+          analyzer::FunctionBudget(domain_ctx.opts).enabled()) {
+        budget_downgrades = std::make_unique< analyzer::BudgetDowngrades >();
+        domain_ctx.budget_downgrades = budget_downgrades.get();
+      }
+
+      set_phase("value-analysis" + timer_suffix);
+      run_value_analysis(domain_ctx, *output_db, timer_suffix);
+
+      if (function_profiler) {
+        function_profiler->save(output_db->profile, domain_tag);
+      }
+      if (budget_downgrades && budget_downgrades->size() > 0) {
+        analyzer::log::warning(
+            std::to_string(budget_downgrades->size()) +
+            " function(s) exceeded their budget and were treated as unknown "
+            "functions in some call contexts, their checks are missing");
+        budget_downgrades->save(output_db->downgrades, domain_tag);
+      }
+    }
+
+    if (context_pointer) {
+      output_db->times.insert(
+          "ikos-analyzer.value.context-pointer-cache.hits",
+          static_cast< double >(context_pointer->hits()));
+      output_db->times.insert(
+          "ikos-analyzer.value.context-pointer-cache.misses",
+          static_cast< double >(context_pointer->misses()));
+    }
+
+    {
+      analyzer::log::debug("Creating database indexes");
+      set_phase("create-indexes");
+      analyzer::ScopeTimerDatabase t(output_db->times,
+                                     "ikos-analyzer.create-indexes");
+
+      // The indexes are created on another thread, using -jobs threads to
+      // sort their entries, while the main thread saves the fixpoint profiles
+      std::future< void > finalized =
+          std::async(std::launch::async, [&output_db]() {
+            output_db->finalize(std::max(Jobs.getValue(), 1u));
+          });
+
+      // Store the fixpoint profiles computed so far with the AR cache
+      //
+      // The profiles of a sliced program miss the removed comparisons.
+      if (!NoFixpointProfiles && !ar_cache_key.empty() && !sliced) {
+        save_fixpoint_profiles_cache(profiler, ar_cache_key);
+      }
+
+      finalized.get();
+    }
+
+    if (!sink && OutputDbProfile == DbProfile::Memory) {
+      analyzer::log::debug("Writing output database " + OutputFilename);
+      db->set_commit_policy(analyzer::sqlite::CommitPolicy::Manual);
+      db->save(OutputFilename);
     }
   } catch (analyzer::sqlite::DbError& err) {
     llvm::errs() << progname << ": " << OutputFilename
@@ -964,6 +2732,10 @@ int main(int argc, char** argv) {
     llvm::errs() << progname << ": " << InputFilename
                  << ": error: " << err.what() << "\n";
     return 5;
+  } catch (analyzer::MemoryBudgetError& err) {
+    llvm::errs() << progname << ": " << InputFilename
+                 << ": error: " << err.what() << "\n";
+    return 10;
   } catch (std::exception& err) {
     // catch any std::exception, core::Exception or analyzer::Exception
     llvm::errs() << progname << ": " << InputFilename
@@ -80,11 +80,9 @@ static char hexdigit(unsigned n, bool lower_case = false) {
                    : ((lower_case ? 'a' : 'A') + static_cast< char >(n) - 10);
 }
 
-std::string JsonString::str() const {
-  std::string r;
-  r.reserve(this->_s.size() + 2);
+void json_escape(std::string& r, StringRef s) {
   r.push_back('"');
-  for (const char c : this->_s) {
+  for (const char c : s) {
     if (c == '"' || c == '\\') {
       r.push_back('\\');
       r.push_back(c);
@@ -107,6 +105,11 @@ std::string JsonString::str() const {
     }
   }
   r.push_back('"');
+}
+
+std::string JsonString::str() const {
+  std::string r;
+  json_escape(r, this->_s);
   return r;
 }
 
@@ -114,23 +117,29 @@ std::string JsonString::str() const {
 
 std::string JsonList::str() const {
   std::string r;
-  r.reserve(this->_buf.size() + 2);
-  r.push_back('[');
-  r.append(this->_buf);
-  r.push_back(']');
+  this->write(r);
   return r;
 }
 
+void JsonList::write(std::string& out) const {
+  out.push_back('[');
+  out.append(this->_buf);
+  out.push_back(']');
+}
+
 // JsonDict
 
 std::string JsonDict::str() const {
   std::string r;
-  r.reserve(this->_buf.size() + 2);
-  r.push_back('{');
-  r.append(this->_buf);
-  r.push_back('}');
+  this->write(r);
   return r;
 }
 
+void JsonDict::write(std::string& out) const {
+  out.push_back('{');
+  out.append(this->_buf);
+  out.push_back('}');
+}
+
 } // end namespace analyzer
 } // end namespace ikos
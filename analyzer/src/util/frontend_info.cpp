@@ -0,0 +1,376 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Compact copy of the source information of the LLVM module
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+
+#include <llvm/ADT/SetVector.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/IR/DebugInfoMetadata.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/IntrinsicInst.h>
+#include <llvm/Transforms/Utils/Local.h>
+
+#include <ikos/ar/semantic/code.hpp>
+#include <ikos/ar/semantic/function.hpp>
+#include <ikos/ar/semantic/statement.hpp>
+#include <ikos/ar/semantic/value.hpp>
+
+#include <ikos/frontend/llvm/import/source_location.hpp>
+
+#include <ikos/analyzer/database/table/operands.hpp>
+#include <ikos/analyzer/exception.hpp>
+#include <ikos/analyzer/util/frontend_info.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+const FrontendInfo* FrontendInfo::Current = nullptr;
+
+namespace {
+
+/// \brief Return the debug name of a local variable, or an empty string
+std::string local_debug_name(llvm::Value* value) {
+  // Check for llvm.dbg.declare and llvm.dbg.addr
+  if (auto alloca = llvm::dyn_cast< llvm::AllocaInst >(value)) {
+    llvm::TinyPtrVector< llvm::DbgInfoIntrinsic* > dbg_addrs =
+        llvm::FindDbgAddrUses(alloca);
+    auto dbg_addr =
+        std::find_if(dbg_addrs.begin(),
+                     dbg_addrs.end(),
+                     [](llvm::DbgInfoIntrinsic* dbg) {
+                       return dbg->getExpression()->getNumElements() == 0;
+                     });
+
+    if (dbg_addr != dbg_addrs.end()) {
+      return (*dbg_addr)->getVariable()->getName().str();
+    }
+  }
+
+  // Check for llvm.dbg.value
+  llvm::SmallVector< llvm::DbgValueInst*, 1 > dbg_values;
+  llvm::findDbgValues(dbg_values, value);
+  auto dbg_value =
+      std::find_if(dbg_values.begin(),
+                   dbg_values.end(),
+                   [](llvm::DbgValueInst* dbg) {
+                     return dbg->getExpression()->getNumElements() == 0;
+                   });
+
+  if (dbg_value != dbg_values.end()) {
+    return (*dbg_value)->getVariable()->getName().str();
+  }
+
+  return {};
+}
+
+/// \brief Helper to build the frontend information
+class FrontendInfoBuilder {
+private:
+  /// \brief Interned source file paths
+  std::vector< std::unique_ptr< boost::filesystem::path > >& _files;
+
+  /// \brief Interned source locations
+  std::vector< FrontendInfo::Location >& _locations;
+
+  /// \brief Statements coming from a phi node or a comparison
+  llvm::DenseSet< ar::Statement* >& _phi_or_comparisons;
+
+  /// \brief Functions
+  llvm::DenseMap< ar::Function*, FrontendInfo::FunctionInfo >& _functions;
+
+  /// \brief Variables
+  llvm::DenseMap< ar::Value*, FrontendInfo::VariableInfo >& _variables;
+
+  /// \brief Number of statements
+  std::uint32_t& _num_statements;
+
+  /// \brief Number of variables
+  std::uint32_t& _num_variables;
+
+  /// \brief Number of values
+  std::uint32_t& _num_values;
+
+  /// \brief Constants used as statement operands, indexed after variables
+  llvm::SetVector< ar::Value* > _constants;
+
+  /// \brief Map from llvm::DIFile* to file index
+  llvm::DenseMap< llvm::DIFile*, std::uint32_t > _di_files;
+
+  /// \brief Map from full path to file index
+  ///
+  /// llvm::DIFile* are not unique.
+  llvm::StringMap< std::uint32_t > _paths;
+
+  /// \brief Map from (file, (line, column)) to location index
+  llvm::DenseMap< std::pair< std::uint32_t,
+                             std::pair< std::uint32_t, std::uint32_t > >,
+                  std::uint32_t >
+      _location_map;
+
+public:
+  /// \brief Constructor
+  FrontendInfoBuilder(
+      std::vector< std::unique_ptr< boost::filesystem::path > >& files,
+      std::vector< FrontendInfo::Location >& locations,
+      llvm::DenseSet< ar::Statement* >& phi_or_comparisons,
+      llvm::DenseMap< ar::Function*, FrontendInfo::FunctionInfo >& functions,
+      llvm::DenseMap< ar::Value*, FrontendInfo::VariableInfo >& variables,
+      std::uint32_t& num_statements,
+      std::uint32_t& num_variables,
+      std::uint32_t& num_values)
+      : _files(files),
+        _locations(locations),
+        _phi_or_comparisons(phi_or_comparisons),
+        _functions(functions),
+        _variables(variables),
+        _num_statements(num_statements),
+        _num_variables(num_variables),
+        _num_values(num_values) {}
+
+  /// \brief Copy the source information of the given bundle
+  void build(ar::Bundle* bundle) {
+    for (auto it = bundle->global_begin(), et = bundle->global_end(); it != et;
+         ++it) {
+      this->build(*it);
+    }
+
+    for (auto it = bundle->function_begin(), et = bundle->function_end();
+         it != et;
+         ++it) {
+      this->build(*it);
+    }
+
+    this->_num_values = this->_num_variables;
+    for (ar::Value* cst : this->_constants) {
+      cst->set_index(this->_num_values++);
+    }
+  }
+
+private:
+  /// \brief Return the index of the given file
+  std::uint32_t intern(llvm::DIFile* file) {
+    auto it = this->_di_files.find(file);
+    if (it != this->_di_files.end()) {
+      return it->second;
+    }
+
+    boost::filesystem::path path = frontend::import::source_path(file);
+    auto res = this->_paths.try_emplace(path.string(),
+                                        static_cast< std::uint32_t >(
+                                            this->_files.size()));
+    if (res.second) {
+      this->_files.push_back(
+          std::make_unique< boost::filesystem::path >(std::move(path)));
+    }
+
+    std::uint32_t index = res.first->second;
+    this->_di_files.try_emplace(file, index);
+    return index;
+  }
+
+  /// \brief Return the index of the given source location
+  std::uint32_t intern(const frontend::import::SourceLocation& loc) {
+    std::uint32_t file = this->intern(loc.file());
+    auto res = this->_location_map.try_emplace(
+        {file, {loc.line(), loc.column()}},
+        static_cast< std::uint32_t >(this->_locations.size()));
+    if (res.second) {
+      this->_locations.push_back(
+          FrontendInfo::Location{file, loc.line(), loc.column()});
+    }
+    return res.first->second;
+  }
+
+  /// \brief Copy the source information of a global variable
+  void build(ar::GlobalVariable* gv) {
+    gv->set_index(this->_num_variables++);
+
+    if (gv->has_frontend()) {
+      auto llvm_gv = gv->frontend< llvm::GlobalVariable >();
+      FrontendInfo::VariableInfo info;
+
+      // Check for debug info
+      llvm::SmallVector< llvm::DIGlobalVariableExpression*, 1 > dbgs;
+      llvm_gv->getDebugInfo(dbgs);
+
+      if (!dbgs.empty()) {
+        info.debug_name = dbgs[0]->getVariable()->getName().str();
+      } else if (llvm_gv->isConstant() && llvm_gv->hasInitializer()) {
+        // If it's a constant (e.g, a string)
+        info.repr = OperandsTable::repr(llvm_gv->getInitializer());
+      }
+
+      this->_variables.try_emplace(gv, std::move(info));
+    }
+
+    if (gv->is_definition()) {
+      this->build(gv->initializer());
+    }
+  }
+
+  /// \brief Copy the source information of a function
+  void build(ar::Function* fun) {
+    if (fun->has_frontend()) {
+      auto llvm_fun = fun->frontend< llvm::Function >();
+      FrontendInfo::FunctionInfo info;
+      info.name = llvm_fun->getName().str();
+      info.demangled = demangle(info.name);
+
+      llvm::DISubprogram* dbg = llvm_fun->getSubprogram();
+      if (dbg != nullptr) {
+        std::uint32_t file = this->intern(dbg->getFile());
+        info.location =
+            SourceLocation(this->_files[file].get(), dbg->getLine(), 0);
+      }
+
+      this->_functions.try_emplace(fun, std::move(info));
+    }
+
+    if (fun->is_definition()) {
+      for (auto it = fun->local_variable_begin(),
+                et = fun->local_variable_end();
+           it != et;
+           ++it) {
+        ar::LocalVariable* lv = *it;
+        lv->set_index(this->_num_variables++);
+        if (lv->has_frontend()) {
+          FrontendInfo::VariableInfo info;
+          info.debug_name = local_debug_name(lv->frontend< llvm::Value >());
+          this->_variables.try_emplace(lv, std::move(info));
+        }
+      }
+
+      this->build(fun->body());
+    }
+  }
+
+  /// \brief Copy the source information of a code
+  void build(ar::Code* code) {
+    for (auto it = code->internal_variable_begin(),
+              et = code->internal_variable_end();
+         it != et;
+         ++it) {
+      ar::InternalVariable* iv = *it;
+      iv->set_index(this->_num_variables++);
+      if (iv->has_frontend()) {
+        FrontendInfo::VariableInfo info;
+        try {
+          info.repr = OperandsTable::repr(iv->frontend< llvm::Value >());
+        } catch (const LogicError&) {
+          // Unsupported llvm::Value, fall back to the ar variable name
+        }
+        this->_variables.try_emplace(iv, std::move(info));
+      }
+    }
+
+    for (ar::BasicBlock* bb : *code) {
+      for (ar::Statement* stmt : *bb) {
+        stmt->set_index(this->_num_statements++);
+        for (auto op = stmt->op_begin(), end = stmt->op_end(); op != end;
+             ++op) {
+          if (ar::isa< ar::Constant >(*op)) {
+            this->_constants.insert(*op);
+          }
+        }
+        if (stmt->has_frontend()) {
+          this->build(stmt);
+        }
+      }
+    }
+  }
+
+  /// \brief Copy the source information of a statement
+  void build(ar::Statement* stmt) {
+    frontend::import::SourceLocation loc =
+        frontend::import::source_location(stmt);
+    if (loc) {
+      stmt->set_source_location(this->intern(loc));
+    }
+
+    if (ar::isa< ar::Assignment >(stmt) ||
+        ar::isa< ar::UnaryOperation >(stmt)) {
+      auto value = stmt->frontend< llvm::Value >();
+      if (llvm::isa< llvm::PHINode >(value) ||
+          llvm::isa< llvm::CmpInst >(value)) {
+        this->_phi_or_comparisons.insert(stmt);
+      }
+    }
+  }
+
+}; // end class FrontendInfoBuilder
+
+} // end anonymous namespace
+
+FrontendInfo::FrontendInfo(ar::Bundle* bundle) {
+  FrontendInfoBuilder builder(this->_files,
+                              this->_locations,
+                              this->_phi_or_comparisons,
+                              this->_functions,
+                              this->_variables,
+                              this->_num_statements,
+                              this->_num_variables,
+                              this->_num_values);
+  builder.build(bundle);
+}
+
+FrontendInfo::~FrontendInfo() {
+  if (Current == this) {
+    Current = nullptr;
+  }
+}
+
+const FrontendInfo::FunctionInfo* FrontendInfo::function(
+    ar::Function* fun) const {
+  auto it = this->_functions.find(fun);
+  return it != this->_functions.end() ? &it->second : nullptr;
+}
+
+const FrontendInfo::VariableInfo* FrontendInfo::variable(
+    ar::Value* var) const {
+  auto it = this->_variables.find(var);
+  return it != this->_variables.end() ? &it->second : nullptr;
+}
+
+} // end namespace analyzer
+} // end namespace ikos
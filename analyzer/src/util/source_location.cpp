@@ -41,6 +41,7 @@
  *
  ******************************************************************************/
 
+#include <ikos/analyzer/util/frontend_info.hpp>
 #include <ikos/analyzer/util/source_location.hpp>
 
 namespace ikos {
@@ -72,6 +73,16 @@ static boost::filesystem::path relative_to(const boost::filesystem::path& from,
   return final_path;
 }
 
+SourceLocation source_location(ar::Statement* stmt) {
+  ikos_assert(stmt != nullptr);
+
+  if (!stmt->has_source_location()) {
+    return {}; // null location
+  }
+
+  return FrontendInfo::get().location(stmt->source_location());
+}
+
 std::string source_location_string(ar::Statement* stmt,
                                    const boost::filesystem::path& wd) {
   SourceLocation loc = source_location(stmt);
@@ -41,20 +41,134 @@
  *
  ******************************************************************************/
 
+#include <sys/resource.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include <cstring>
+
 #include <ikos/analyzer/database/output.hpp>
 #include <ikos/analyzer/util/timer.hpp>
 
 namespace ikos {
 namespace analyzer {
 
+bool PerfCounters::Enable = false;
+
+namespace {
+
+/// \brief Return the peak resident set size of the process, in kilobytes
+int64_t max_rss() {
+  struct rusage usage;
+  if (::getrusage(RUSAGE_SELF, &usage) != 0) {
+    return -1;
+  }
+#ifdef __APPLE__
+  return static_cast< int64_t >(usage.ru_maxrss) / 1024;
+#else
+  return static_cast< int64_t >(usage.ru_maxrss);
+#endif
+}
+
+#ifdef __linux__
+
+/// \brief Open a disabled counter for the calling thread and its future
+/// threads, or return -1
+int open_event(uint32_t type, uint64_t config) {
+  struct perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = 1;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return static_cast< int >(
+      ::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+#endif
+
+} // end anonymous namespace
+
+PerfCounters::PerfCounters() : _max_rss(-1) {
+  this->_fds.fill(-1);
+}
+
+PerfCounters::~PerfCounters() {
+  for (int fd : this->_fds) {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+}
+
+void PerfCounters::start() {
+  if (!Enable) {
+    return;
+  }
+  this->_max_rss = max_rss();
+#ifdef __linux__
+  this->_fds = {open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES),
+                open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS),
+                open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES),
+                open_event(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS)};
+  for (int fd : this->_fds) {
+    if (fd >= 0) {
+      ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+#endif
+}
+
+void PerfCounters::stop() {
+  if (!Enable) {
+    return;
+  }
+  std::array< int64_t*, 4 > values = {&this->_values.cycles,
+                                      &this->_values.instructions,
+                                      &this->_values.llc_misses,
+                                      &this->_values.page_faults};
+  for (std::size_t i = 0; i < this->_fds.size(); i++) {
+    int fd = this->_fds[i];
+    if (fd < 0) {
+      continue;
+    }
+#ifdef __linux__
+    ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+    uint64_t count = 0;
+    if (::read(fd, &count, sizeof(count)) == sizeof(count)) {
+      *values[i] = static_cast< int64_t >(count);
+    }
+    ::close(fd);
+    this->_fds[i] = -1;
+  }
+  int64_t rss = max_rss();
+  if (this->_max_rss >= 0 && rss >= 0) {
+    this->_values.max_rss_delta = rss - this->_max_rss;
+  }
+}
+
 ScopeTimerDatabase::ScopeTimerDatabase(TimesTable& table, std::string name)
     : _table(table), _name(std::move(name)) {
+  this->_counters.start();
   this->_timer.start();
 }
 
 ScopeTimerDatabase::~ScopeTimerDatabase() {
   this->_timer.stop();
-  this->_table.insert(this->_name, this->_timer.elapsed().count());
+  this->_counters.stop();
+  this->_table.insert(this->_name,
+                      this->_timer.elapsed().count(),
+                      this->_counters.values());
 }
 
 } // end namespace analyzer
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Work-stealing thread pool
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <ikos/analyzer/support/assert.hpp>
+#include <ikos/analyzer/util/work_stealing.hpp>
+
+namespace ikos {
+namespace analyzer {
+
+WorkStealingPool::WorkStealingPool(unsigned num_threads) : _cancelled(false) {
+  ikos_assert(num_threads > 0);
+  this->_queues.reserve(num_threads);
+  for (unsigned i = 0; i < num_threads; i++) {
+    this->_queues.emplace_back(std::make_unique< Queue >());
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  this->cancel();
+  this->join();
+}
+
+void WorkStealingPool::start(std::vector< Task > tasks) {
+  ikos_assert(this->_threads.empty());
+
+  std::size_t n = this->_queues.size();
+  for (std::size_t i = 0; i < tasks.size(); i++) {
+    this->_queues[i % n]->tasks.push_back(std::move(tasks[i]));
+  }
+
+  this->_threads.reserve(n);
+  for (std::size_t id = 0; id < n; id++) {
+    this->_threads.emplace_back(&WorkStealingPool::work, this, id);
+  }
+}
+
+void WorkStealingPool::join() {
+  for (std::thread& thread : this->_threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+void WorkStealingPool::work(std::size_t id) {
+  Task task;
+  while (!this->_cancelled.load() && this->pop(id, task)) {
+    task();
+  }
+}
+
+bool WorkStealingPool::pop(std::size_t id, Task& task) {
+  // Own queue, from the front
+  {
+    Queue& queue = *this->_queues[id];
+    std::lock_guard< std::mutex > lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      return true;
+    }
+  }
+
+  // Steal from the other queues, from the back
+  std::size_t n = this->_queues.size();
+  for (std::size_t i = 1; i < n; i++) {
+    Queue& queue = *this->_queues[(id + i) % n];
+    std::lock_guard< std::mutex > lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      return true;
+    }
+  }
+
+  // Tasks are never added once started, so there is nothing left to do
+  return false;
+}
+
+} // end namespace analyzer
+} // end namespace ikos
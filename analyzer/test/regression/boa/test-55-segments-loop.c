@@ -0,0 +1,25 @@
+// Strong updates of a summarized array inside a loop
+//
+// With --smash-threshold=2, the cells of `a` are summarized. Each element
+// written after that gets its own segment, while a[0] and a[1] share the
+// first one. With --array-segments=8, the write on a[0] in the loop splits the
+// first segment and is a strong update. With a single segment, it is a weak
+// update and a[0] might still be 100.
+int main() {
+  int a[8];
+  int b[4];
+  int i;
+  a[0] = 100;
+  a[1] = 100;
+  a[2] = 100;
+  a[3] = 100;
+  a[4] = 100;
+  a[5] = 100;
+  a[6] = 100;
+  a[7] = 100;
+  for (i = 0; i < 4; i++) {
+    a[0] = i;
+    b[a[0]] = i;
+  }
+  return 0;
+}
@@ -0,0 +1,28 @@
+extern int __ikos_nondet_int(void);
+
+// Join of two different segmentations of a summarized array
+//
+// With --smash-threshold=2 and --array-segments=8, a[0] and a[1] share the
+// first segment and every other element has its own segment. The first branch
+// splits the first segment, the second branch does not. The join only keeps
+// the common segments: a[3] is still 0 and a[6] is either 0 or 4.
+int main() {
+  int a[8];
+  int b[4];
+  a[0] = 0;
+  a[1] = 0;
+  a[2] = 0;
+  a[3] = 0;
+  a[4] = 0;
+  a[5] = 0;
+  a[6] = 0;
+  a[7] = 0;
+  if (__ikos_nondet_int()) {
+    a[1] = 4;
+  } else {
+    a[6] = 4;
+  }
+  b[a[3]] = 1;
+  b[a[6]] = 1;
+  return 0;
+}
@@ -0,0 +1,28 @@
+// The called function pointer comes from external code
+//
+// set_a() is the only address-taken function with the signature of the call,
+// but `s` can also be a function returned by get_setter(), which may write
+// any pointer into `q`. With --type-function-pointers, the call must not be
+// resolved to set_a() only.
+
+typedef void (*setter_t)(int**);
+
+extern setter_t get_setter(void);
+
+static int a;
+static int b;
+
+static void set_a(int** p) {
+  *p = &a;
+}
+
+int main() {
+  int* q = &b;
+  setter_t s = get_setter();
+  if (s == 0) {
+    s = set_a;
+  }
+  s(&q);
+  *q = 1;
+  return 0;
+}
@@ -0,0 +1,25 @@
+// Collection of unreachable allocations at loop heads
+//
+// With --gc-loop-heads, the buffers allocated and freed in the loop are
+// collected at the loop head. The buffer still pointed to by `keep` must not
+// be collected.
+#include <stdlib.h>
+
+int main() {
+  int* keep = malloc(4 * sizeof(int));
+  if (keep == NULL) {
+    return 1;
+  }
+  for (int i = 0; i < 10; i++) {
+    int* tmp = malloc(8 * sizeof(int));
+    if (tmp == NULL) {
+      break;
+    }
+    tmp[7] = i;
+    free(tmp);
+  }
+  keep[3] = 0;
+  keep[4] = 0;
+  free(keep);
+  return 0;
+}
@@ -0,0 +1,34 @@
+// Functions analyzed in parallel with -jobs=4
+//
+// The checks must be the same, and in the same order, as with a serial
+// analysis.
+int a[10];
+
+void fill(int n) {
+  for (int i = 0; i < n; i++) {
+    a[i] = i;
+  }
+}
+
+void clear(void) {
+  for (int i = 0; i < 10; i++) {
+    a[i] = 0;
+  }
+}
+
+int get(int i) {
+  if (i < 0 || i >= 10) {
+    return -1;
+  }
+  return a[i];
+}
+
+void overflow(void) {
+  a[10] = 1;
+}
+
+int main() {
+  fill(10);
+  clear();
+  return get(3);
+}
@@ -0,0 +1,18 @@
+// DEFINITE UNSAFE
+
+extern int __ikos_nondet_int(void);
+
+int main() {
+  int n = 4;
+  int d = n * 2 - 8;
+  int x = 0;
+  if (d != 0) {
+    x = 100 / d;
+  }
+  if (__ikos_nondet_int()) {
+    x = __ikos_nondet_int() / (n - 3);
+  } else {
+    x = 10 / d;
+  }
+  return x;
+}
@@ -0,0 +1,21 @@
+// UNSAFE
+
+extern int __ikos_nondet_int(void);
+
+int main() {
+  int n = __ikos_nondet_int();
+  int k = __ikos_nondet_int();
+  double f = 1.0;
+  int x = 0;
+  for (int i = 0; i < 10; i++) {
+    f = f * 1.5;
+    if (k > 3) {
+      k = k - 1;
+    }
+  }
+  if (n > 0) {
+    x = 100 / n;
+  }
+  x = x + 10 / (n + 1);
+  return x;
+}
@@ -41,12 +41,15 @@
 ###############################################################################
 import argparse
 import atexit
+import multiprocessing
 import os
 import shutil
 import sqlite3
 import subprocess
 import sys
 import tempfile
+import time
+from multiprocessing.pool import ThreadPool
 
 USE_COLORS = True
 INTERACTIVE = True
@@ -54,6 +57,8 @@ VERBOSE = False
 CLANG = 'clang'
 IKOS_PP = 'ikos-pp'
 IKOS_ANALYZER = 'ikos-analyzer'
+JOBS = 1
+SLOWEST = 10
 
 # available ikos analyses
 ANALYSES = (
@@ -174,6 +179,30 @@ def find_ikos_analyzer():
     return path
 
 
+def run_command(cmd):
+    '''
+    Run a command, discarding its output.
+
+    Return the peak resident memory of the command, in KB.
+    Raise subprocess.CalledProcessError if the command fails.
+    '''
+    with open(os.devnull, 'w') as devnull:
+        proc = subprocess.Popen(cmd, stdout=devnull, stderr=devnull)
+        _, status, rusage = os.wait4(proc.pid, 0)
+
+    if os.WIFSIGNALED(status):
+        proc.returncode = -os.WTERMSIG(status)
+    else:
+        proc.returncode = os.WEXITSTATUS(status)
+
+    if proc.returncode != 0:
+        raise subprocess.CalledProcessError(proc.returncode, cmd)
+
+    if sys.platform == 'darwin':
+        return rusage.ru_maxrss // 1024  # in bytes on macOS
+    return rusage.ru_maxrss
+
+
 def clang_emit_llvm_flags():
     ''' Clang flags to emit llvm bitcode '''
     # see analyzer.clang_emit_llvm_flags()
@@ -200,6 +229,16 @@ def clang_ikos_flags():
     ]
 
 
+def format_memory(kb):
+    ''' Format a memory size given in KB '''
+    if kb >= 1024 * 1024:
+        return '%.1f GB' % (kb / 1024.0 / 1024.0)
+    elif kb >= 1024:
+        return '%.1f MB' % (kb / 1024.0)
+    else:
+        return '%d KB' % kb
+
+
 class Result:
     OK = 0
     WARNING = 1
@@ -227,12 +266,18 @@ class Database:
         self.cursor.execute('SELECT checks.status FROM checks INNER JOIN statements ON checks.statement_id = statements.id WHERE statements.line=%d' % line)
         return [row[0] for row in self.cursor.fetchall()]
 
+    def get_checks(self):
+        self.cursor.execute('SELECT checks.kind, checks.checker, checks.status, statements.line, statements.column, checks.operands, checks.info FROM checks INNER JOIN statements ON checks.statement_id = statements.id ORDER BY checks.id')
+        return self.cursor.fetchall()
+
 
 class TestResult:
     def __init__(self, code, comments=None):
         assert code in ('PASS', 'PASS_IMPROVE', 'FAIL')
         self.code = code
         self.comments = comments or []
+        self.elapsed = 0.0  # wall time, in seconds
+        self.peak_memory = 0  # peak resident memory of a command, in KB
 
     def add_comment(self, comment):
         self.comments.append(comment)
@@ -250,6 +295,7 @@ class Test:
                  entry_points=None,
                  procedural=None,
                  options=None,
+                 compare_options=None,
                  line_checks=None):
         if not isinstance(analyses, list):
             analyses = [analyses]
@@ -268,15 +314,34 @@ class Test:
         self.entry_points = entry_points or ('main',)
         self.procedural = procedural or 'inter'
         self.options = options or []
+        self.compare_options = compare_options
         self.line_checks = line_checks or []
 
-    def run(self, root, output_db):
+    def analyzer_command(self, pp_path, output_db, options):
+        ''' Command to run ikos-analyzer with the given options '''
+        cmd = [find_ikos_analyzer(),
+               '-a=%s' % ','.join(self.analyses),
+               '-d=%s' % self.domain,
+               '-entry-points=%s' % ','.join(self.entry_points),
+               '-proc=%s' % self.procedural]
+        cmd.extend(options)
+        if self.opt_level == 'aggressive':
+            cmd.append('-allow-dbg-mismatch')
+        if 'gauge' in self.domain:
+            cmd.append('-add-loop-counters')
+        cmd += [pp_path, '-o', output_db]
+        return cmd
+
+    def run(self, root):
+        start = time.time()
         fullpath = os.path.join(root, self.filename)
         assert os.path.exists(fullpath)
 
         # create working directory
         wd = tempfile.mkdtemp(prefix='ikos-%s' % self.filename)
         atexit.register(shutil.rmtree, path=wd)
+        output_db = os.path.join(wd, 'output.db')
+        peak_memory = 0
 
         # run clang
         bc_path = os.path.join(wd, '%s.bc' % self.filename)
@@ -286,9 +351,7 @@ class Test:
         cmd += [fullpath, '-o', bc_path]
         if self.filename.endswith('.cpp'):
             cmd.append('-std=c++14')
-        subprocess.check_call(cmd,
-                              stdout=subprocess.PIPE,
-                              stderr=subprocess.PIPE)
+        peak_memory = max(peak_memory, run_command(cmd))
 
         # run ikos preprocessor
         pp_path = os.path.join(wd, '%s.pp.bc' % self.filename)
@@ -297,25 +360,19 @@ class Test:
                '-entry-points=%s' % ','.join(self.entry_points),
                bc_path,
                '-o', pp_path]
-        subprocess.check_call(cmd,
-                              stdout=subprocess.PIPE,
-                              stderr=subprocess.PIPE)
+        peak_memory = max(peak_memory, run_command(cmd))
 
         # run ikos analyzer
-        cmd = [find_ikos_analyzer(),
-               '-a=%s' % ','.join(self.analyses),
-               '-d=%s' % self.domain,
-               '-entry-points=%s' % ','.join(self.entry_points),
-               '-proc=%s' % self.procedural]
-        cmd.extend(self.options)
-        if self.opt_level == 'aggressive':
-            cmd.append('-allow-dbg-mismatch')
-        if 'gauge' in self.domain:
-            cmd.append('-add-loop-counters')
-        cmd += [pp_path, '-o', output_db]
-        subprocess.check_call(cmd,
-                              stdout=subprocess.PIPE,
-                              stderr=subprocess.PIPE)
+        cmd = self.analyzer_command(pp_path, output_db, self.options)
+        peak_memory = max(peak_memory, run_command(cmd))
+
+        # run ikos analyzer again, with the options to compare with
+        if self.compare_options is not None:
+            compare_db = os.path.join(wd, 'compare.db')
+            compare_cmd = self.analyzer_command(pp_path,
+                                                compare_db,
+                                                self.options + self.compare_options)
+            peak_memory = max(peak_memory, run_command(compare_cmd))
 
         with Database(output_db) as db:
             # Get the global result
@@ -379,10 +436,21 @@ class Test:
                                     '(%s) for line %d and not the expected one (%s).'
                                     % (line_result, line_num, line_expected))
 
+            # Same checks, in the same order, with the options to compare with
+            if self.compare_options is not None:
+                with Database(compare_db) as compare:
+                    if db.get_checks() != compare.get_checks():
+                        ret.code = 'FAIL'
+                        ret.add_comment('Got different checks with %s.'
+                                        % ' '.join(self.compare_options))
+                        ret.comments.insert(0, 'Running %r' % compare_cmd)
+
             if ret.code == 'FAIL':
                 ret.comments.insert(0, 'Running %r' % cmd)
 
-            return ret
+        ret.elapsed = time.time() - start
+        ret.peak_memory = peak_memory
+        return ret
 
 
 class TestManager:
@@ -397,9 +465,10 @@ class TestManager:
     def run(self):
         printf(bold('Running tests...\n'))
 
-        # output database
-        _, output_db = tempfile.mkstemp(suffix='.db', prefix='ikos-output-')
-        atexit.register(lambda: os.unlink(output_db))
+        # Tests are run concurrently, results are printed in order
+        pool = ThreadPool(max(JOBS, 1))
+        results = pool.imap(lambda t: t.run(self.root), self.tests)
+        timings = []
 
         for t in self.tests:
             printf('  %s ... ', t.description)
@@ -410,17 +479,20 @@ class TestManager:
                 # Move the cursor right after the '...'
                 printf('\r\033[A\033[%dC' % len('  %s ... ' % t.description))
 
-            result = t.run(self.root, output_db)
+            result = next(results)
             self.results[result.code] += 1
+            timings.append((result.elapsed, result.peak_memory, t))
 
             if result.code == 'FAIL':
-                printf(red(('Failed\n')))
+                printf(red('Failed'))
             elif result.code == 'PASS':
-                printf(green('Passed\n'))
+                printf(green('Passed'))
             elif result.code == 'PASS_IMPROVE':
-                printf(yellow('Passed with improvements!\n'))
+                printf(yellow('Passed with improvements!'))
             else:
                 assert False, 'unknown result'
+            printf(' (%.2fs, %s)\n', result.elapsed,
+                   format_memory(result.peak_memory))
 
             if INTERACTIVE:
                 # Clear everything down the cursor
@@ -430,7 +502,11 @@ class TestManager:
                 for line in result.comments:
                     printf('    %s\n' % line)
 
+        pool.close()
+        pool.join()
+
         self.print_result()
+        self.print_slowest(timings)
         exit(self.results['FAIL'])
 
     def get_num_tests(self):
@@ -451,6 +527,16 @@ class TestManager:
         else:
             printf(red('  %d/%d tests failed.\n' % (self.results['FAIL'], self.get_num_tests())))
 
+    def print_slowest(self, timings):
+        if SLOWEST <= 0 or not timings:
+            return
+
+        timings = sorted(timings, key=lambda timing: timing[0], reverse=True)
+        printf(bold('Slowest tests:\n'))
+        for elapsed, peak_memory, t in timings[:SLOWEST]:
+            printf('  %8.2fs %10s  %s\n',
+                   elapsed, format_memory(peak_memory), t.description)
+
     def print_progress(self):
         percent = 100.0 * self.get_num_done() / self.get_num_tests()
         full_width = 50
@@ -480,13 +566,26 @@ def parse_args(description=None):
     parser.add_argument('--ikos-analyzer', dest='ikos_analyzer',
                         help='ikos-analyzer path',
                         default='ikos-analyzer')
+    parser.add_argument('-j', '--jobs', dest='jobs',
+                        help='Number of tests run in parallel '
+                             '(default: number of CPUs)',
+                        type=int,
+                        default=multiprocessing.cpu_count())
+    parser.add_argument('--slowest', dest='slowest',
+                        help='Number of slowest tests to display '
+                             '(default: 10)',
+                        type=int,
+                        default=10)
 
     args = parser.parse_args()
 
     global VERBOSE, USE_COLORS, INTERACTIVE, CLANG, IKOS_PP, IKOS_ANALYZER
+    global JOBS, SLOWEST
     VERBOSE = args.verbose
     USE_COLORS = False if args.no_colors else os.isatty(sys.stdout.fileno())
     INTERACTIVE = False if args.no_interactive else os.isatty(sys.stdout.fileno())
     CLANG = args.clang
     IKOS_PP = args.ikos_pp
     IKOS_ANALYZER = args.ikos_analyzer
+    JOBS = args.jobs
+    SLOWEST = args.slowest
@@ -0,0 +1,27 @@
+extern void __ikos_assert(int);
+extern int __ikos_nondet_int(void);
+
+/*
+ * five() only uses its local variables: it is analyzed once, and the same
+ * summary is used for all its calls
+ */
+
+static int five(void) {
+  int x = 2;
+  int y = x + 3;
+  __ikos_assert(y == 5);
+  return y;
+}
+
+int main() {
+  int a = five();
+  int b;
+  if (__ikos_nondet_int()) {
+    b = five();
+  } else {
+    b = five() + 1;
+  }
+  __ikos_assert(a == 5);
+  __ikos_assert(b >= 5 && b <= 6);
+  return 0;
+}
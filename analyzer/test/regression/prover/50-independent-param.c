@@ -0,0 +1,17 @@
+extern void __ikos_assert(int);
+
+/*
+ * next() uses its parameter: it must be analyzed in each calling context
+ */
+
+static int next(int x) {
+  return x + 1;
+}
+
+int main() {
+  int a = next(1);
+  int b = next(10);
+  __ikos_assert(a == 2);
+  __ikos_assert(b == 11);
+  return 0;
+}
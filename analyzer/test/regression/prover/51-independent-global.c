@@ -0,0 +1,21 @@
+extern void __ikos_assert(int);
+
+/*
+ * get() reads a global variable: it must be analyzed in each calling context
+ */
+
+int counter = 0;
+
+static int get(void) {
+  return counter;
+}
+
+int main() {
+  counter = 3;
+  int a = get();
+  counter = 7;
+  int b = get();
+  __ikos_assert(a == 3);
+  __ikos_assert(b == 7);
+  return 0;
+}
@@ -0,0 +1,22 @@
+extern void __ikos_assert(int);
+
+/*
+ * ten() contains a loop: it is analyzed in each calling context, where the
+ * fixpoint budgets apply
+ */
+
+static int ten(void) {
+  int i = 0;
+  while (i < 10) {
+    i++;
+  }
+  return i;
+}
+
+int main() {
+  int a = ten();
+  int b = ten();
+  __ikos_assert(a == 10);
+  __ikos_assert(a + b == 20);
+  return 0;
+}
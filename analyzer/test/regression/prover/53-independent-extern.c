@@ -0,0 +1,22 @@
+extern void __ikos_assert(int);
+extern int __ikos_nondet_int(void);
+
+/*
+ * roll() calls an external function: it must be analyzed in each calling
+ * context
+ */
+
+static int roll(void) {
+  int x = __ikos_nondet_int();
+  if (x < 1 || x > 6) {
+    return 1;
+  }
+  return x;
+}
+
+int main() {
+  int a = roll();
+  __ikos_assert(a >= 1 && a <= 6);
+  __ikos_assert(a == 1);
+  return 0;
+}
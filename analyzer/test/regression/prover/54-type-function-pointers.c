@@ -0,0 +1,31 @@
+extern void __ikos_assert(int);
+
+/*
+ * Indirect calls through a table of typed callbacks. With
+ * --type-function-pointers, each call matches the signature of a single
+ * address-taken function, and the program does not exchange pointers with
+ * external code, so the function pointer constraints are not solved.
+ */
+
+struct ops {
+  int (*get)(void);
+  int (*add)(int, int);
+};
+
+static int get_ten(void) {
+  return 10;
+}
+
+static int add(int x, int y) {
+  return x + y;
+}
+
+static struct ops table = {get_ten, add};
+
+int main() {
+  int x = table.get();
+  int y = table.add(x, 1);
+  __ikos_assert(x == 10);
+  __ikos_assert(y == 11);
+  return 0;
+}
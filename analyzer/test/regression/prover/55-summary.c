@@ -0,0 +1,26 @@
+extern void __ikos_assert(int);
+extern int __ikos_nondet_int(void);
+
+/*
+ * With -proc=summary, clamp() is analyzed once with a top entry invariant,
+ * and its summary (0 <= return value <= 100) is applied at each call. The
+ * intraprocedural analysis knows nothing about the returned values.
+ */
+
+static int clamp(int x) {
+  if (x < 0) {
+    return 0;
+  }
+  if (x > 100) {
+    return 100;
+  }
+  return x;
+}
+
+int main() {
+  int a = clamp(__ikos_nondet_int());
+  int b = clamp(-5);
+  __ikos_assert(a >= 0 && a <= 100);
+  __ikos_assert(b >= 0 && b <= 100);
+  return 0;
+}
@@ -0,0 +1,15 @@
+extern void __ikos_assert(int);
+
+/*
+ * With --unroll-loops=8, the loop runs 5 iterations and is peeled, so the
+ * sum is exact. Otherwise, the widening loses the upper bound of the sum.
+ */
+
+int main() {
+  int s = 0;
+  for (int i = 0; i < 5; i++) {
+    s += i;
+  }
+  __ikos_assert(s == 10);
+  return 0;
+}
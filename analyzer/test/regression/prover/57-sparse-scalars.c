@@ -0,0 +1,18 @@
+extern void __ikos_assert(int);
+extern int __ikos_nondet_int(void);
+
+/*
+ * With --sparse-scalars, k has a single definition outside of the loop and
+ * is never compared, so its value goes straight from its definition to its
+ * use in the loop instead of going through the loop invariants.
+ */
+
+int main() {
+  int k = __ikos_nondet_int() & 15;
+  int s = 0;
+  for (int i = 0; i < 10; i++) {
+    s = k + i;
+  }
+  __ikos_assert(s <= 24);
+  return 0;
+}
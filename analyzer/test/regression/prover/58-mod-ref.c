@@ -0,0 +1,21 @@
+extern void __ikos_assert(int);
+
+/*
+ * bump() only writes the global variable counter. In the intraprocedural
+ * analysis, the call only forgets counter, unless the mod/ref analysis is
+ * disabled with --no-mod-ref.
+ */
+
+int counter;
+
+static void bump(void) {
+  counter++;
+}
+
+int main() {
+  int x = 5;
+  int* p = &x;
+  bump();
+  __ikos_assert(*p == 5);
+  return 0;
+}
@@ -0,0 +1,17 @@
+extern int __ikos_nondet_int(void);
+
+/*
+ * The operands of the first operations are only defined by extensions,
+ * masks and remainders, so their overflow checks are discharged without
+ * querying the invariant. The last addition may overflow.
+ */
+
+int main() {
+  unsigned char c = (unsigned char)__ikos_nondet_int();
+  int a = c + c;
+  int b = (__ikos_nondet_int() & 0xff) * 1000;
+  int r = (__ikos_nondet_int() % 100) + 5;
+  int q = 1000 / ((__ikos_nondet_int() & 7) + 1);
+  int w = __ikos_nondet_int() + 1;
+  return a + b + r + q + w;
+}
@@ -0,0 +1,25 @@
+extern void __ikos_assert(int);
+
+// Strong updates of a summarized array inside a loop
+//
+// a[0] is read before being written, so the first segment of the summary of
+// `a` is maybe uninitialized. With --array-segments=8, the write on a[0] in the
+// loop splits that segment and initializes a[0]. With a single segment, it is
+// a weak update and a[0] stays maybe uninitialized.
+int main() {
+  int a[8];
+  int i;
+  __ikos_assert(a[0] >= 0);
+  a[1] = 0;
+  a[2] = 0;
+  a[3] = 0;
+  a[4] = 0;
+  a[5] = 0;
+  a[6] = 0;
+  a[7] = 0;
+  for (i = 0; i < 4; i++) {
+    a[0] = i;
+    __ikos_assert(a[0] >= 0);
+  }
+  return 0;
+}
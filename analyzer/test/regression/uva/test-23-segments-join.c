@@ -0,0 +1,28 @@
+extern void __ikos_assert(int);
+extern int __ikos_nondet_int(void);
+
+// Join of two different segmentations of a summarized array
+//
+// a[0] is read before being written, so the first segment of the summary of
+// `a` is maybe uninitialized. The first branch splits that segment, the second
+// branch does not. With --array-segments=8, the join only keeps the common
+// segments: a[7] is initialized and a[0] is maybe uninitialized.
+int main() {
+  int a[8];
+  __ikos_assert(a[0] >= 0);
+  a[1] = 0;
+  a[2] = 0;
+  a[3] = 0;
+  a[4] = 0;
+  a[5] = 0;
+  a[6] = 0;
+  a[7] = 0;
+  if (__ikos_nondet_int()) {
+    a[0] = 1;
+  } else {
+    a[7] = 1;
+  }
+  __ikos_assert(a[7] >= 0);
+  __ikos_assert(a[0] >= 0);
+  return 0;
+}
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Binary format for the abstract representation
+ *
+ * The binary format stores a whole bundle (types, constants, global
+ * variables, functions and their bodies) so that it can be loaded again
+ * without going through the front-end.
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+#include <ikos/ar/semantic/bundle.hpp>
+#include <ikos/ar/semantic/code.hpp>
+#include <ikos/ar/semantic/context.hpp>
+#include <ikos/ar/semantic/function.hpp>
+#include <ikos/ar/semantic/statement.hpp>
+#include <ikos/ar/semantic/value.hpp>
+
+namespace ikos {
+namespace ar {
+
+/// \brief Map front-end objects to integer identifiers, and back
+///
+/// The binary format cannot store the pointers to front-end objects (see
+/// Traceable). Instead, it stores an identifier for each of them, provided by
+/// the front-end, and asks the front-end to resolve it when loading.
+///
+/// Identifier 0 means there is no front-end object.
+class FrontendIndex {
+public:
+  /// \brief Default constructor
+  FrontendIndex() = default;
+
+  /// \brief Deleted copy constructor
+  FrontendIndex(const FrontendIndex&) = delete;
+
+  /// \brief Deleted move constructor
+  FrontendIndex(FrontendIndex&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  FrontendIndex& operator=(const FrontendIndex&) = delete;
+
+  /// \brief Deleted move assignment operator
+  FrontendIndex& operator=(FrontendIndex&&) = delete;
+
+  /// \brief Virtual destructor
+  virtual ~FrontendIndex();
+
+  /// \brief Get the identifier of the front-end object of a global variable
+  virtual std::uint64_t id(GlobalVariable*) = 0;
+
+  /// \brief Get the identifier of the front-end object of a function
+  virtual std::uint64_t id(Function*) = 0;
+
+  /// \brief Get the identifier of the front-end object of a local or internal
+  /// variable
+  virtual std::uint64_t id(Variable*) = 0;
+
+  /// \brief Get the identifier of the front-end object of a basic block
+  virtual std::uint64_t id(BasicBlock*) = 0;
+
+  /// \brief Get the identifier of the front-end object of a statement
+  virtual std::uint64_t id(Statement*) = 0;
+
+  /// \brief Set the front-end object of a global variable
+  virtual void resolve(GlobalVariable*, std::uint64_t) = 0;
+
+  /// \brief Set the front-end object of a function
+  virtual void resolve(Function*, std::uint64_t) = 0;
+
+  /// \brief Set the front-end object of a local or internal variable
+  virtual void resolve(Variable*, std::uint64_t) = 0;
+
+  /// \brief Set the front-end object of a basic block
+  virtual void resolve(BasicBlock*, std::uint64_t) = 0;
+
+  /// \brief Set the front-end object of a statement
+  virtual void resolve(Statement*, std::uint64_t) = 0;
+
+}; // end class FrontendIndex
+
+/// \brief Binary writer
+class BinaryWriter {
+private:
+  // Front-end index, or null
+  FrontendIndex* _index;
+
+public:
+  /// \brief Public constructor
+  ///
+  /// \param index Front-end index, or null to drop the front-end objects
+  explicit BinaryWriter(FrontendIndex* index = nullptr) : _index(index) {}
+
+  /// \brief Write a bundle in binary format
+  ///
+  /// \param key Arbitrary string that must be given to BinaryReader::read()
+  void write(std::ostream&, Bundle*, const std::string& key) const;
+
+}; // end class BinaryWriter
+
+/// \brief Binary reader
+class BinaryReader {
+private:
+  // Front-end index, or null
+  FrontendIndex* _index;
+
+public:
+  /// \brief Public constructor
+  ///
+  /// \param index Front-end index, or null to ignore the front-end objects
+  explicit BinaryReader(FrontendIndex* index = nullptr) : _index(index) {}
+
+  /// \brief Read a bundle in binary format
+  ///
+  /// Returns null if the input is not a valid bundle written with the same
+  /// version of the format, or if its key is different.
+  Bundle* read(std::istream&, Context&, const std::string& key) const;
+
+}; // end class BinaryReader
+
+} // end namespace ar
+} // end namespace ikos
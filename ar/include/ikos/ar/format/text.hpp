@@ -44,6 +44,7 @@
 #pragma once
 
 #include <iosfwd>
+#include <vector>
 
 #include <ikos/ar/format/formatter.hpp>
 #include <ikos/ar/format/namer.hpp>
@@ -80,7 +81,10 @@ public:
   ~TextFormatter() = default;
 
   /// \brief Format a bundle into text format
-  void format(std::ostream&, Bundle*) const;
+  ///
+  /// \param jobs Number of threads used to format the functions. Functions
+  /// are still written in order.
+  void format(std::ostream&, Bundle*, unsigned jobs = 1) const;
 
   /// \brief Format a global variable into text format
   void format(std::ostream&, GlobalVariable*) const;
@@ -115,6 +119,12 @@ public:
               const Namer&,
               bool show_type = false) const;
 
+private:
+  /// \brief Format the given functions, using `jobs` threads
+  void format(std::ostream&,
+              const std::vector< Function* >& functions,
+              unsigned jobs) const;
+
 }; // end class TextFormatter
 
 } // end namespace ar
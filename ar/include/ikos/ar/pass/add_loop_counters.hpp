@@ -53,7 +53,18 @@ namespace ar {
 /// This pass adds an initialization statement that sets the counter to zero in
 /// all basic blocks before a loop, and then adds a statement that increments
 /// the counter by one within that loop.
+///
+/// Only the loops with an exit guarded by a comparison on an induction
+/// variable (a variable incremented by a constant in the loop) get a counter,
+/// since the gauge domain cannot use the counter of the other loops.
 class AddLoopCountersPass final : public CodePass {
+private:
+  // Intrinsic ar.ikos.counter.init
+  Function* _counter_init = nullptr;
+
+  // Intrinsic ar.ikos.counter.incr
+  Function* _counter_incr = nullptr;
+
 public:
   /// \brief Default constructor
   AddLoopCountersPass() = default;
@@ -65,6 +76,9 @@ public:
   const char* description() const override;
 
 private:
+  /// \brief Create the intrinsics for loop counters
+  void initialize(Bundle*) override;
+
   /// \brief Run the pass on the given Code
   ///
   /// Returns true if the code has been updated
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Pass to propagate integer constants
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <ikos/ar/pass/pass.hpp>
+
+namespace ikos {
+namespace ar {
+
+/// \brief Pass to propagate integer constants
+///
+/// This pass performs a conditional constant propagation on internal integer
+/// variables, in the spirit of Wegman and Zadeck's sparse conditional constant
+/// propagation. Internal variables are not in SSA form, so a variable is
+/// constant only if all its reachable definitions give the same value.
+///
+/// The pass then:
+///   * replaces uses of constant variables by their value;
+///   * removes the definitions of constant variables;
+///   * removes comparisons that are always true;
+///   * removes basic blocks that are unreachable, or that start with a
+///     comparison that is always false.
+///
+/// For instance:
+///
+///         [ ui32 %1 = 4 ]
+///         [ ui32 %2 = %1 umul 2 ]
+///              /    \ 
+///  [ %2 uilt 10 ]  [ %2 uige 10 ]
+///  [ call @f(%2) ] [ call @g(%2) ]
+///
+/// Will become:
+///
+///         [ ]
+///          |
+///  [ call @f(8) ]
+class ConstantPropagationPass final : public CodePass {
+public:
+  /// \brief Default constructor
+  ConstantPropagationPass() = default;
+
+  /// \brief Get the pass name
+  const char* name() const override;
+
+  /// \brief Get the pass description
+  const char* description() const override;
+
+private:
+  /// \brief Run the pass on the given Code
+  ///
+  /// Returns true if the code has been updated
+  bool run_on_code(Code*) override;
+
+}; // end class ConstantPropagationPass
+
+} // end namespace ar
+} // end namespace ikos
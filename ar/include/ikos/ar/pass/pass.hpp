@@ -49,6 +49,9 @@
 namespace ikos {
 namespace ar {
 
+// forward declaration
+class PassManager;
+
 /// \brief Base class for passes
 class Pass {
 public:
@@ -95,11 +98,20 @@ public:
   bool run(Bundle*) override;
 
 private:
+  /// \brief Prepare the pass before it runs on the codes of the given Bundle
+  ///
+  /// This is always called sequentially. Passes should create here everything
+  /// shared between codes (for instance, intrinsic functions), since
+  /// run_on_code() might be called concurrently on different codes.
+  virtual void initialize(Bundle*) {}
+
   /// \brief Run the pass on the given Code
   ///
   /// Returns true if the code has been updated
   virtual bool run_on_code(Code*) = 0;
 
+  friend class PassManager;
+
 }; // end class CodePass
 
 } // end namespace ar
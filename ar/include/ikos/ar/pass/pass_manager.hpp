@@ -0,0 +1,110 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Pass manager, running a sequence of passes on a bundle
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <ikos/ar/pass/pass.hpp>
+
+namespace ikos {
+namespace ar {
+
+/// \brief Run a sequence of passes on a bundle
+///
+/// Consecutive code passes are fused: each code is traversed once by all of
+/// them, in order, while its control flow graph is hot in cache. Different
+/// codes are processed concurrently when several jobs are requested.
+class PassManager {
+private:
+  // Passes, in order
+  std::vector< std::unique_ptr< Pass > > _passes;
+
+  // Number of threads
+  unsigned _jobs;
+
+public:
+  /// \brief Public constructor
+  ///
+  /// \param jobs Number of threads used to run the code passes
+  explicit PassManager(unsigned jobs = 1) : _jobs(jobs) {}
+
+  /// \brief No copy constructor
+  PassManager(const PassManager&) = delete;
+
+  /// \brief Default move constructor
+  PassManager(PassManager&&) noexcept = default;
+
+  /// \brief No copy assignment operator
+  PassManager& operator=(const PassManager&) = delete;
+
+  /// \brief Default move assignment operator
+  PassManager& operator=(PassManager&&) noexcept = default;
+
+  /// \brief Destructor
+  ~PassManager() = default;
+
+  /// \brief Add a pass at the end of the sequence
+  void add(std::unique_ptr< Pass > pass) {
+    this->_passes.push_back(std::move(pass));
+  }
+
+  /// \brief Return true if there is no pass
+  bool empty() const { return this->_passes.empty(); }
+
+  /// \brief Run all the passes on the given Bundle
+  ///
+  /// Returns true if the bundle has been updated
+  bool run(Bundle*);
+
+private:
+  /// \brief Run the given code passes on all the codes of the Bundle
+  ///
+  /// Returns true if the bundle has been updated
+  bool run_code_passes(Bundle*, const std::vector< CodePass* >&);
+
+}; // end class PassManager
+
+} // end namespace ar
+} // end namespace ikos
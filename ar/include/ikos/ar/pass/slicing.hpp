@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Pass to slice the code with respect to a criterion
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <functional>
+
+#include <ikos/ar/pass/pass.hpp>
+
+namespace ikos {
+namespace ar {
+
+/// \brief Pass to slice the code with respect to a criterion
+///
+/// This pass removes the statements that the statements selected by a
+/// slicing criterion do not depend on, either through data or through
+/// control.
+///
+/// Removing a statement that defines a variable leaves the variable
+/// unconstrained, and removing a comparison only adds behaviors. The sliced
+/// code is therefore an over-approximation of the original code.
+///
+/// The following statements are always kept, in addition to the criterion:
+///   * statements with side effects: stores, calls, invokes, landing pads,
+///     resumes, returns and unreachable statements;
+///   * the definitions of the variables used by a kept statement;
+///   * the comparisons on a variable used by a kept statement, since they
+///     guard or refine the kept statements.
+///
+/// Memory is not sliced: all stores and calls are kept, since the pass does
+/// not know which loads they may affect.
+///
+/// If `ignore_floating_point` is true, floating point operands do not
+/// create dependencies. This is only sound for clients that do not reason on
+/// floating point values, such as the value analysis of ikos-analyzer.
+class SlicingPass final : public CodePass {
+public:
+  /// \brief Slicing criterion
+  using Criterion = std::function< bool(Statement*) >;
+
+private:
+  Criterion _criterion;
+  bool _ignore_floating_point;
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param criterion Returns true for the statements to keep
+  /// \param ignore_floating_point Do not follow floating point operands
+  explicit SlicingPass(Criterion criterion, bool ignore_floating_point = false)
+      : _criterion(std::move(criterion)),
+        _ignore_floating_point(ignore_floating_point) {}
+
+  /// \brief Get the pass name
+  const char* name() const override;
+
+  /// \brief Get the pass description
+  const char* description() const override;
+
+private:
+  /// \brief Run the pass on the given Code
+  ///
+  /// Returns true if the code has been updated
+  bool run_on_code(Code*) override;
+
+}; // end class SlicingPass
+
+} // end namespace ar
+} // end namespace ikos
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Pass to unroll loops with a small constant trip count
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+#include <ikos/ar/pass/pass.hpp>
+
+namespace ikos {
+namespace ar {
+
+/// \brief Pass to unroll loops with a small constant trip count
+///
+/// This pass looks for innermost loops with an integer counter initialized
+/// to a constant, incremented or decremented by a constant, and compared
+/// against a constant. If the loop runs at most `max_trip_count` iterations,
+/// its iterations are peeled: the loop body is copied once per iteration,
+/// in front of the original loop.
+///
+/// Peeling preserves the semantics whatever the actual trip count, since the
+/// original loop is kept after the copies. Each copy is analyzed without
+/// widening, so even non-relational domains get precise results, and the
+/// original loop is left with an infeasible guard.
+///
+/// For instance:
+///
+///    [ si32 %i = 0 ]
+///          |
+///    [ ] <------------+
+///     /  \            |
+///   ...  [ %i silt 2 ]|
+///        [ ...        ]
+///        [ si32 %j = %i sadd 1 ]
+///        [ si32 %i = %j ]
+///
+/// Becomes the initialization, two copies of the loop body, then the
+/// original loop.
+class UnrollLoopsPass final : public CodePass {
+private:
+  // Maximum number of peeled iterations
+  std::size_t _max_trip_count;
+
+public:
+  /// \brief Maximum number of statements in all copies of a loop
+  static constexpr std::size_t MaxUnrolledStatements = 4096;
+
+  /// \brief Constructor
+  ///
+  /// \param max_trip_count Maximum number of peeled iterations
+  explicit UnrollLoopsPass(std::size_t max_trip_count)
+      : _max_trip_count(max_trip_count) {}
+
+  /// \brief Get the pass name
+  const char* name() const override;
+
+  /// \brief Get the pass description
+  const char* description() const override;
+
+private:
+  /// \brief Run the pass on the given Code
+  ///
+  /// Returns true if the code has been updated
+  bool run_on_code(Code*) override;
+
+}; // end class UnrollLoopsPass
+
+} // end namespace ar
+} // end namespace ikos
@@ -43,6 +43,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <iosfwd>
 #include <memory>
 #include <string>
@@ -58,6 +59,7 @@
 #include <ikos/ar/semantic/value.hpp>
 #include <ikos/ar/support/assert.hpp>
 #include <ikos/ar/support/iterator.hpp>
+#include <ikos/ar/support/pool.hpp>
 #include <ikos/ar/support/traceable.hpp>
 
 namespace ikos {
@@ -65,12 +67,13 @@ namespace ar {
 
 // forward declaration
 class Code;
+class CodeGraph;
 class Statement;
 
 /// \brief Basic block
 ///
 /// A basic block is a container of statements that execute sequentially.
-class BasicBlock : public Traceable {
+class BasicBlock : public Traceable, public PoolAllocated {
 private:
   // List of statements
   std::vector< std::unique_ptr< Statement > > _statements;
@@ -84,6 +87,9 @@ private:
   // Parent code
   Code* _parent;
 
+  // Index in the parent code
+  std::size_t _index;
+
   // Name (optional)
   std::string _name;
 
@@ -133,6 +139,12 @@ public:
   /// \brief Get the parent code
   Code* code() const { return this->_parent; }
 
+  /// \brief Get the index of the basic block in the parent code
+  ///
+  /// Indices are unique within a code, and lower than
+  /// Code::num_block_indices(). They are not reused after erasing a block.
+  std::size_t index() const { return this->_index; }
+
   /// \brief Get the first statement
   Statement* front() const {
     ikos_assert_msg(!this->_statements.empty(), "basic block is empty");
@@ -267,6 +279,15 @@ public:
   /// \brief Dump the basic block and its content, for debugging purpose
   void full_dump(std::ostream&) const;
 
+private:
+  /// \brief Replace the statements with fresh copies
+  ///
+  /// The previous statements are moved into `old`.
+  void relayout(std::vector< std::unique_ptr< Statement > >& old);
+
+  // friends
+  friend class Code;
+
 }; // end class BasicBlock
 
 /// \brief Code
@@ -302,6 +323,12 @@ private:
   // Parent bundle (non-null)
   Bundle* _bundle;
 
+  // Index of the next created basic block
+  std::size_t _num_block_indices;
+
+  // Frozen control flow graph, or null
+  std::unique_ptr< const CodeGraph > _graph;
+
 public:
   /// \brief Iterator over a list of basic block
   using BasicBlockIterator = boost::transform_iterator<
@@ -336,6 +363,9 @@ public:
   /// \brief Destructor
   ~Code();
 
+  /// \brief Return an upper bound on the basic block indices
+  std::size_t num_block_indices() const { return this->_num_block_indices; }
+
   /// \brief Begin iterator over the list of basic blocks
   BasicBlockIterator begin() const {
     return boost::make_transform_iterator(this->_blocks.cbegin(),
@@ -463,10 +493,36 @@ public:
   /// behaviour
   void erase_basic_block(BasicBlock*);
 
+  /// \brief Build the frozen control flow graph of the code
+  ///
+  /// It is discarded on any later modification of the control flow graph.
+  void freeze_graph();
+
+  /// \brief Is the control flow graph frozen?
+  bool has_graph() const { return this->_graph != nullptr; }
+
+  /// \brief Get the frozen control flow graph
+  const CodeGraph* graph() const {
+    ikos_assert_msg(this->_graph, "control flow graph is not frozen");
+    return this->_graph.get();
+  }
+
+  /// \brief Reallocate the statements in basic block order
+  ///
+  /// Statements are allocated in a pool, in creation order. After passes
+  /// that move statements across basic blocks, this makes the statements of
+  /// each basic block contiguous in memory again.
+  ///
+  /// Pointers to the previous statements are invalidated.
+  void relayout();
+
 private:
   /// \brief Add an internal variable in the code
   void add_internal_variable(std::unique_ptr< InternalVariable >);
 
+  /// \brief Discard the frozen control flow graph, if any
+  void invalidate_graph() { this->_graph.reset(); }
+
   // friends
   friend class Function;
   friend class BasicBlock;
@@ -475,6 +531,94 @@ private:
 
 }; // end class Code
 
+/// \brief Frozen control flow graph of a code
+///
+/// The successors and predecessors of all the basic blocks are stored in
+/// compressed sparse row form: two contiguous arrays, sliced by the basic
+/// block indices. This is the graph used by the fixpoint iterators, the weak
+/// topological orders and the liveness analysis, once the passes are done.
+///
+/// See Code::freeze_graph()
+class CodeGraph {
+public:
+  /// \brief Iterator over a list of basic blocks
+  using BasicBlockIterator = BasicBlock* const*;
+
+private:
+  // Parent code
+  Code* _code;
+
+  // Entry block
+  BasicBlock* _entry;
+
+  // Offsets of the successors of each basic block, by index
+  std::vector< std::uint32_t > _succ_offsets;
+
+  // Successors of all basic blocks
+  std::vector< BasicBlock* > _successors;
+
+  // Offsets of the predecessors of each basic block, by index
+  std::vector< std::uint32_t > _pred_offsets;
+
+  // Predecessors of all basic blocks
+  std::vector< BasicBlock* > _predecessors;
+
+public:
+  /// \brief Build the frozen control flow graph of the given code
+  explicit CodeGraph(Code* code);
+
+  /// \brief Deleted copy constructor
+  CodeGraph(const CodeGraph&) = delete;
+
+  /// \brief Deleted move constructor
+  CodeGraph(CodeGraph&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  CodeGraph& operator=(const CodeGraph&) = delete;
+
+  /// \brief Deleted move assignment operator
+  CodeGraph& operator=(CodeGraph&&) = delete;
+
+  /// \brief Destructor
+  ~CodeGraph();
+
+  /// \brief Get the parent code
+  Code* code() const { return this->_code; }
+
+  /// \brief Get the entry basic block
+  BasicBlock* entry() const { return this->_entry; }
+
+  /// \brief Return an upper bound on the basic block indices
+  std::size_t num_indices() const { return this->_succ_offsets.size() - 1; }
+
+  /// \brief Begin iterator over the list of basic blocks
+  Code::BasicBlockIterator begin() const { return this->_code->begin(); }
+
+  /// \brief End iterator over the list of basic blocks
+  Code::BasicBlockIterator end() const { return this->_code->end(); }
+
+  /// \brief Begin iterator over the successors of the given basic block
+  BasicBlockIterator successor_begin(const BasicBlock* bb) const {
+    return this->_successors.data() + this->_succ_offsets[bb->index()];
+  }
+
+  /// \brief End iterator over the successors of the given basic block
+  BasicBlockIterator successor_end(const BasicBlock* bb) const {
+    return this->_successors.data() + this->_succ_offsets[bb->index() + 1];
+  }
+
+  /// \brief Begin iterator over the predecessors of the given basic block
+  BasicBlockIterator predecessor_begin(const BasicBlock* bb) const {
+    return this->_predecessors.data() + this->_pred_offsets[bb->index()];
+  }
+
+  /// \brief End iterator over the predecessors of the given basic block
+  BasicBlockIterator predecessor_end(const BasicBlock* bb) const {
+    return this->_predecessors.data() + this->_pred_offsets[bb->index() + 1];
+  }
+
+}; // end class CodeGraph
+
 } // end namespace ar
 } // end namespace ikos
 
@@ -505,6 +649,48 @@ struct GraphTraits< ar::Code* > {
   static PredecessorNodeIterator predecessor_end(ar::BasicBlock* bb) {
     return bb->predecessor_end();
   }
+
+  static std::size_t index(ar::BasicBlock* bb) { return bb->index(); }
+
+  static std::size_t num_indices(ar::Code* code) {
+    return code->num_block_indices();
+  }
+};
+
+/// \brief Implement GraphTraits for const ar::CodeGraph*
+///
+/// The frozen graph of a basic block is found through its parent code.
+template <>
+struct GraphTraits< const ar::CodeGraph* > {
+  using NodeRef = ar::BasicBlock*;
+  using SuccessorNodeIterator = ar::CodeGraph::BasicBlockIterator;
+  using PredecessorNodeIterator = ar::CodeGraph::BasicBlockIterator;
+
+  static ar::BasicBlock* entry(const ar::CodeGraph* graph) {
+    return graph->entry();
+  }
+
+  static SuccessorNodeIterator successor_begin(ar::BasicBlock* bb) {
+    return bb->code()->graph()->successor_begin(bb);
+  }
+
+  static SuccessorNodeIterator successor_end(ar::BasicBlock* bb) {
+    return bb->code()->graph()->successor_end(bb);
+  }
+
+  static PredecessorNodeIterator predecessor_begin(ar::BasicBlock* bb) {
+    return bb->code()->graph()->predecessor_begin(bb);
+  }
+
+  static PredecessorNodeIterator predecessor_end(ar::BasicBlock* bb) {
+    return bb->code()->graph()->predecessor_end(bb);
+  }
+
+  static std::size_t index(ar::BasicBlock* bb) { return bb->index(); }
+
+  static std::size_t num_indices(const ar::CodeGraph* graph) {
+    return graph->num_indices();
+  }
 };
 
 } // end namespace core
@@ -43,6 +43,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 namespace ikos {
@@ -82,6 +83,9 @@ public:
   /// \brief Destructor
   ~Context();
 
+  /// \brief Return the number of constants created in this context
+  std::size_t num_constants() const;
+
   // friends
   friend class Bundle;
   friend class Type;
@@ -43,7 +43,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <iosfwd>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -59,13 +61,14 @@
 #include <ikos/ar/semantic/value.hpp>
 #include <ikos/ar/support/assert.hpp>
 #include <ikos/ar/support/number.hpp>
+#include <ikos/ar/support/pool.hpp>
 #include <ikos/ar/support/traceable.hpp>
 
 namespace ikos {
 namespace ar {
 
 /// \brief Base class for statements
-class Statement : public Traceable {
+class Statement : public Traceable, public PoolAllocated {
 public:
   enum StatementKind {
     AssignmentKind,
@@ -95,10 +98,24 @@ public:
   /// \brief Iterator on operands
   using OpIterator = Operands::const_iterator;
 
+  /// \brief Source location index of statements without one
+  static constexpr std::uint32_t NoSourceLocation =
+      std::numeric_limits< std::uint32_t >::max();
+
+  /// \brief Index of statements without one
+  static constexpr std::uint32_t NoIndex =
+      std::numeric_limits< std::uint32_t >::max();
+
 protected:
   // Kind of statement
   StatementKind _kind;
 
+  // Index in the source location table of the frontend
+  std::uint32_t _source_location = NoSourceLocation;
+
+  // Dense index among the statements of the bundle
+  std::uint32_t _index = NoIndex;
+
   // Parent basic block
   BasicBlock* _parent;
 
@@ -190,6 +207,45 @@ public:
     return this->_operands[i];
   }
 
+  /// \brief Set the n-th operand
+  ///
+  /// The new operand must have the same type as the previous one.
+  void set_operand(std::size_t i, Value* value) {
+    ikos_assert_msg(i < this->_operands.size(), "invalid index");
+    ikos_assert_msg(value->type() == this->_operands[i]->type(),
+                    "invalid operand type");
+    this->_operands[i] = value;
+  }
+
+  /// \brief Does it have a source location index?
+  bool has_source_location() const {
+    return this->_source_location != NoSourceLocation;
+  }
+
+  /// \brief Get the index in the source location table of the frontend
+  std::uint32_t source_location() const { return this->_source_location; }
+
+  /// \brief Set the index in the source location table of the frontend
+  ///
+  /// The index is opaque to the AR. It is assigned by the frontend once the
+  /// AR is final, and it is not copied by clone().
+  void set_source_location(std::uint32_t index) {
+    this->_source_location = index;
+  }
+
+  /// \brief Does it have a dense index?
+  bool has_index() const { return this->_index != NoIndex; }
+
+  /// \brief Get the dense index among the statements of the bundle
+  std::uint32_t index() const { return this->_index; }
+
+  /// \brief Set the dense index among the statements of the bundle
+  ///
+  /// The index is opaque to the AR. It is assigned by the frontend once the
+  /// AR is final, so that clients can use side arrays instead of maps keyed
+  /// by statement. It is not copied by clone().
+  void set_index(std::uint32_t index) { this->_index = index; }
+
   /// \brief Dump the statement for debugging purpose
   virtual void dump(std::ostream&) const = 0;
 
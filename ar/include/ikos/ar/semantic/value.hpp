@@ -43,7 +43,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <iosfwd>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -56,6 +58,7 @@
 #include <ikos/ar/support/assert.hpp>
 #include <ikos/ar/support/cast.hpp>
 #include <ikos/ar/support/number.hpp>
+#include <ikos/ar/support/pool.hpp>
 #include <ikos/ar/support/traceable.hpp>
 
 namespace ikos {
@@ -95,10 +98,18 @@ public:
     _EndVariableKind
   };
 
+public:
+  /// \brief Index of values without one
+  static constexpr std::uint32_t NoIndex =
+      std::numeric_limits< std::uint32_t >::max();
+
 protected:
   // Kind of value
   ValueKind _kind;
 
+  // Dense index among the variables of the bundle
+  std::uint32_t _index = NoIndex;
+
   // Type
   Type* _type;
 
@@ -128,6 +139,19 @@ public:
   /// \brief Get the type
   Type* type() const { return this->_type; }
 
+  /// \brief Does it have a dense index?
+  bool has_index() const { return this->_index != NoIndex; }
+
+  /// \brief Get the dense index among the variables of the bundle
+  std::uint32_t index() const { return this->_index; }
+
+  /// \brief Set the dense index among the variables of the bundle
+  ///
+  /// The index is opaque to the AR. It is assigned by the frontend once the
+  /// AR is final, so that clients can use side arrays instead of maps keyed
+  /// by value. Constants are shared and do not have one.
+  void set_index(std::uint32_t index) { this->_index = index; }
+
   /// \brief Dump the value for debugging purpose
   virtual void dump(std::ostream&) const = 0;
 
@@ -758,7 +782,7 @@ public:
 
 }; // end class LocalVariable
 
-class InternalVariable final : public Variable {
+class InternalVariable final : public Variable, public PoolAllocated {
 private:
   // Parent code
   Code* _parent;
@@ -0,0 +1,155 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Arena allocator
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <ikos/ar/support/assert.hpp>
+
+namespace ikos {
+namespace ar {
+
+/// \brief Bump-pointer allocator for objects that live as long as the arena
+///
+/// Memory is allocated in slabs and only released when the arena is
+/// destroyed. Objects registered with own() are destroyed at that time, in
+/// reverse order of registration.
+class Arena {
+private:
+  /// \brief Default size of a slab, in bytes
+  static constexpr std::size_t SlabSize = 64 * 1024;
+
+  /// \brief Destructor of an owned object
+  struct Destructor {
+    void* object;
+    void (*destroy)(void*);
+  };
+
+private:
+  // Allocated slabs
+  std::vector< std::unique_ptr< char[] > > _slabs;
+
+  // Next free byte in the current slab
+  char* _cur = nullptr;
+
+  // End of the current slab
+  char* _end = nullptr;
+
+  // Destructors of the owned objects
+  std::vector< Destructor > _destructors;
+
+public:
+  /// \brief Default constructor
+  Arena() = default;
+
+  /// \brief Deleted copy constructor
+  Arena(const Arena&) = delete;
+
+  /// \brief Deleted move constructor
+  Arena(Arena&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  Arena& operator=(const Arena&) = delete;
+
+  /// \brief Deleted move assignment operator
+  Arena& operator=(Arena&&) = delete;
+
+  /// \brief Destructor
+  ~Arena() {
+    for (auto it = this->_destructors.rbegin(), et = this->_destructors.rend();
+         it != et;
+         ++it) {
+      it->destroy(it->object);
+    }
+  }
+
+  /// \brief Allocate `size` bytes aligned on `align`
+  void* allocate(std::size_t size, std::size_t align) {
+    ikos_assert(align > 0 && (align & (align - 1)) == 0);
+
+    auto cur = reinterpret_cast< std::uintptr_t >(this->_cur);
+    std::uintptr_t aligned = (cur + align - 1) & ~(align - 1);
+
+    if (this->_cur == nullptr ||
+        aligned + size > reinterpret_cast< std::uintptr_t >(this->_end)) {
+      std::size_t slab_size =
+          size + align > SlabSize ? size + align : SlabSize;
+      this->_slabs.emplace_back(new char[slab_size]);
+      this->_cur = this->_slabs.back().get();
+      this->_end = this->_cur + slab_size;
+      cur = reinterpret_cast< std::uintptr_t >(this->_cur);
+      aligned = (cur + align - 1) & ~(align - 1);
+    }
+
+    this->_cur = reinterpret_cast< char* >(aligned + size);
+    return reinterpret_cast< void* >(aligned);
+  }
+
+  /// \brief Allocate uninitialized memory for an object of type T
+  template < typename T >
+  void* allocate() {
+    return this->allocate(sizeof(T), alignof(T));
+  }
+
+  /// \brief Take ownership of an object constructed in the arena memory
+  ///
+  /// The destructor of the object is called when the arena is destroyed.
+  template < typename T >
+  T* own(T* object) {
+    if (!std::is_trivially_destructible< T >::value) {
+      this->_destructors.push_back(
+          Destructor{object, [](void* p) { static_cast< T* >(p)->~T(); }});
+    }
+    return object;
+  }
+
+}; // end class Arena
+
+} // end namespace ar
+} // end namespace ikos
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Pool allocator for small objects
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+#include <ikos/ar/support/arena.hpp>
+
+namespace ikos {
+namespace ar {
+
+/// \brief Thread-safe pool of small memory blocks
+///
+/// Blocks are carved out of an Arena and recycled through one free list per
+/// size class, so objects allocated in sequence are laid out contiguously.
+/// Requests larger than MaxSize are forwarded to the global operator new.
+class ObjectPool {
+private:
+  /// \brief Size class granularity, in bytes
+  static constexpr std::size_t Granularity = alignof(std::max_align_t);
+
+  /// \brief Maximum size of a pooled block, in bytes
+  static constexpr std::size_t MaxSize = 512;
+
+  /// \brief Number of size classes
+  static constexpr std::size_t NumClasses = MaxSize / Granularity;
+
+private:
+  // Mutex protecting the arena and the free lists
+  std::mutex _mutex;
+
+  // Memory of the blocks
+  Arena _arena;
+
+  // Free blocks, per size class, linked through their first word
+  std::array< void*, NumClasses > _free_lists{};
+
+private:
+  /// \brief Return the size class of the given size
+  static std::size_t size_class(std::size_t size) {
+    return (size + Granularity - 1) / Granularity - 1;
+  }
+
+public:
+  /// \brief Default constructor
+  ObjectPool() = default;
+
+  /// \brief Deleted copy constructor
+  ObjectPool(const ObjectPool&) = delete;
+
+  /// \brief Deleted move constructor
+  ObjectPool(ObjectPool&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  ObjectPool& operator=(const ObjectPool&) = delete;
+
+  /// \brief Deleted move assignment operator
+  ObjectPool& operator=(ObjectPool&&) = delete;
+
+  /// \brief Destructor
+  ~ObjectPool() = default;
+
+  /// \brief Allocate a block of `size` bytes
+  void* allocate(std::size_t size) {
+    if (size == 0 || size > MaxSize) {
+      return ::operator new(size);
+    }
+
+    std::size_t n = size_class(size);
+    std::lock_guard< std::mutex > lock(this->_mutex);
+    void* block = this->_free_lists[n];
+    if (block != nullptr) {
+      this->_free_lists[n] = *static_cast< void** >(block);
+      return block;
+    }
+    return this->_arena.allocate((n + 1) * Granularity, Granularity);
+  }
+
+  /// \brief Release a block of `size` bytes returned by allocate()
+  void deallocate(void* block, std::size_t size) {
+    if (size == 0 || size > MaxSize) {
+      ::operator delete(block);
+      return;
+    }
+
+    std::size_t n = size_class(size);
+    std::lock_guard< std::mutex > lock(this->_mutex);
+    *static_cast< void** >(block) = this->_free_lists[n];
+    this->_free_lists[n] = block;
+  }
+
+  /// \brief Return the pool shared by the AR objects
+  ///
+  /// The pool is never destroyed, since objects can be released during the
+  /// destruction of static variables.
+  static ObjectPool& global() {
+    static auto pool = new ObjectPool();
+    return *pool;
+  }
+
+}; // end class ObjectPool
+
+/// \brief Base class for objects allocated in the global ObjectPool
+///
+/// Deleting a derived object through a pointer to a polymorphic base uses
+/// the size of the dynamic type, as long as the base has a virtual destructor.
+class PoolAllocated {
+public:
+  static void* operator new(std::size_t size) {
+    return ObjectPool::global().allocate(size);
+  }
+
+  static void operator delete(void* block, std::size_t size) {
+    ObjectPool::global().deallocate(block, size);
+  }
+
+}; // end class PoolAllocated
+
+} // end namespace ar
+} // end namespace ikos
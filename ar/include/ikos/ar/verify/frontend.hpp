@@ -83,8 +83,12 @@ public:
 
   /// \brief Check the given bundle
   ///
+  /// The global variables and functions are checked by `jobs` threads. The
+  /// errors are reported in the order of the bundle.
+  ///
   /// \param err The output stream for errors
-  bool verify(Bundle* bundle, std::ostream& err) const;
+  /// \param jobs Number of threads
+  bool verify(Bundle* bundle, std::ostream& err, unsigned jobs = 1) const;
 
   /// \brief Check the given global variable
   ///
@@ -0,0 +1,1171 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of the binary format
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include <ikos/ar/format/binary.hpp>
+#include <ikos/ar/semantic/data_layout.hpp>
+#include <ikos/ar/semantic/type.hpp>
+
+namespace ikos {
+namespace ar {
+
+FrontendIndex::~FrontendIndex() = default;
+
+namespace {
+
+/// \brief Magic number at the beginning of a binary bundle
+const char Magic[8] = {'I', 'K', 'O', 'S', '-', 'A', 'R', '\0'};
+
+/// \brief Version of the binary format
+///
+/// Increase it on any change of the format or of the AR semantic.
+const std::uint64_t Version = 1;
+
+/// \brief Tags of value references
+enum ValueTag : std::uint64_t {
+  NullTag = 0,
+  ConstantTag = 1,
+  GlobalVariableTag = 2,
+  LocalVariableTag = 3,
+  InternalVariableTag = 4,
+};
+
+/// \brief Number of bits used by value tags
+const unsigned ValueTagBits = 3;
+
+/// \brief Checksum of the payload (FNV-1a)
+std::uint64_t checksum(const std::string& data) {
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  for (char c : data) {
+    hash ^= static_cast< unsigned char >(c);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+/// \brief Output buffer
+class Output {
+private:
+  std::string _buf;
+
+public:
+  /// \brief Write an unsigned integer, using a variable-length encoding
+  void u64(std::uint64_t n) {
+    while (n >= 0x80) {
+      this->_buf.push_back(static_cast< char >((n & 0x7f) | 0x80));
+      n >>= 7;
+    }
+    this->_buf.push_back(static_cast< char >(n));
+  }
+
+  /// \brief Write a boolean
+  void boolean(bool b) { this->_buf.push_back(b ? '\1' : '\0'); }
+
+  /// \brief Write a string
+  void str(const std::string& s) {
+    this->u64(s.size());
+    this->_buf.append(s);
+  }
+
+  /// \brief Write an unlimited precision integer
+  void z(const ZNumber& n) { this->str(n.str(16)); }
+
+  /// \brief Write a machine integer
+  void machine_int(const MachineInt& n) {
+    this->z(n.to_z_number());
+    this->u64(n.bit_width());
+    this->boolean(n.sign() == Signed);
+  }
+
+  /// \brief Append another buffer
+  void append(const Output& o) { this->_buf.append(o._buf); }
+
+  /// \brief Get the content
+  const std::string& data() const { return this->_buf; }
+};
+
+/// \brief Input buffer
+///
+/// The content has been validated by a checksum, reads past the end only set
+/// an error flag.
+class Input {
+private:
+  const char* _it;
+  const char* _end;
+  bool _error;
+
+public:
+  Input(const char* begin, const char* end)
+      : _it(begin), _end(end), _error(false) {}
+
+  /// \brief Read an unsigned integer
+  std::uint64_t u64() {
+    std::uint64_t n = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+      if (this->_it == this->_end) {
+        this->_error = true;
+        return 0;
+      }
+      auto byte = static_cast< unsigned char >(*this->_it++);
+      n |= static_cast< std::uint64_t >(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        return n;
+      }
+    }
+    this->_error = true;
+    return 0;
+  }
+
+  /// \brief Read a boolean
+  bool boolean() { return this->u64() != 0; }
+
+  /// \brief Read a string
+  std::string str() {
+    std::uint64_t size = this->u64();
+    if (size > static_cast< std::uint64_t >(this->_end - this->_it)) {
+      this->_error = true;
+      return std::string();
+    }
+    std::string s(this->_it, size);
+    this->_it += size;
+    return s;
+  }
+
+  /// \brief Read an unlimited precision integer
+  ZNumber z() {
+    std::string s = this->str();
+    if (s.empty()) {
+      this->_error = true;
+      return ZNumber(0);
+    }
+    return ZNumber::from_string(s, 16);
+  }
+
+  /// \brief Read a machine integer
+  MachineInt machine_int() {
+    ZNumber n = this->z();
+    auto bit_width = static_cast< unsigned >(this->u64());
+    Signedness sign = this->boolean() ? Signed : Unsigned;
+    if (bit_width == 0) {
+      this->_error = true;
+      bit_width = 1;
+    }
+    return MachineInt(n, bit_width, sign);
+  }
+
+  /// \brief Return true if the whole input was read without error
+  bool done() const { return !this->_error && this->_it == this->_end; }
+};
+
+/// \brief Serialize a bundle
+class Writer {
+private:
+  Bundle* _bundle;
+  FrontendIndex* _index;
+
+  // Sections
+  Output _types;
+  Output _decls;
+  Output _constants;
+  Output _codes;
+
+  // Identifiers
+  std::unordered_map< Type*, std::uint64_t > _type_ids;
+  std::vector< StructType* > _structs;
+  std::unordered_map< Value*, std::uint64_t > _constant_ids;
+  std::unordered_map< GlobalVariable*, std::uint64_t > _global_ids;
+  std::unordered_map< Function*, std::uint64_t > _function_ids;
+  std::unordered_map< LocalVariable*, std::uint64_t > _local_ids;
+  std::unordered_map< InternalVariable*, std::uint64_t > _internal_ids;
+  std::unordered_map< BasicBlock*, std::uint64_t > _block_ids;
+
+public:
+  Writer(Bundle* bundle, FrontendIndex* index)
+      : _bundle(bundle), _index(index) {}
+
+  /// \brief Serialize the bundle, returns the payload
+  std::string payload() {
+    // Declarations
+    this->_decls.u64(this->_bundle->num_globals());
+    std::uint64_t id = 0;
+    for (auto it = this->_bundle->global_begin(),
+              et = this->_bundle->global_end();
+         it != et;
+         ++it, ++id) {
+      GlobalVariable* gv = *it;
+      this->_global_ids.emplace(gv, id);
+      this->_decls.str(gv->name());
+      this->_decls.u64(this->type_id(gv->type()));
+      this->_decls.boolean(gv->is_definition());
+      this->_decls.u64(gv->alignment());
+      this->_decls.u64(this->_index != nullptr ? this->_index->id(gv) : 0);
+    }
+
+    this->_decls.u64(this->_bundle->num_functions());
+    id = 0;
+    for (auto it = this->_bundle->function_begin(),
+              et = this->_bundle->function_end();
+         it != et;
+         ++it, ++id) {
+      Function* fun = *it;
+      this->_function_ids.emplace(fun, id);
+      this->_decls.str(fun->name());
+      this->_decls.u64(this->type_id(fun->type()));
+      this->_decls.boolean(fun->is_definition());
+      this->_decls.u64(fun->intrinsic_id());
+      this->_decls.u64(this->_index != nullptr ? this->_index->id(fun) : 0);
+    }
+
+    // Bodies
+    for (auto it = this->_bundle->global_begin(),
+              et = this->_bundle->global_end();
+         it != et;
+         ++it) {
+      GlobalVariable* gv = *it;
+      if (gv->is_definition()) {
+        this->_codes.u64(this->_global_ids.at(gv));
+        this->write_code(gv->initializer(), 0);
+      }
+    }
+    this->_codes.u64(this->_global_ids.size());
+
+    for (auto it = this->_bundle->function_begin(),
+              et = this->_bundle->function_end();
+         it != et;
+         ++it) {
+      Function* fun = *it;
+      if (fun->is_definition()) {
+        this->_codes.u64(this->_function_ids.at(fun));
+        this->write_function_body(fun);
+      }
+    }
+    this->_codes.u64(this->_function_ids.size());
+
+    // Assemble the sections
+    Output out;
+    const DataLayout& dl = this->_bundle->data_layout();
+    out.boolean(dl.is_little_endian());
+    write_data_layout_info(out, dl.pointers);
+    out.u64(dl.integers.size());
+    for (const DataLayoutInfo& info : dl.integers) {
+      write_data_layout_info(out, info);
+    }
+    out.u64(dl.floats.size());
+    for (const DataLayoutInfo& info : dl.floats) {
+      write_data_layout_info(out, info);
+    }
+    out.str(this->_bundle->target_triple());
+
+    out.u64(this->_type_ids.size());
+    out.append(this->_types);
+    for (StructType* type : this->_structs) {
+      out.u64(type->num_fields());
+      for (auto it = type->field_begin(), et = type->field_end(); it != et;
+           ++it) {
+        out.z(it->first);
+        out.u64(this->_type_ids.at(it->second));
+      }
+    }
+
+    out.append(this->_decls);
+    out.u64(this->_constant_ids.size());
+    out.append(this->_constants);
+    out.append(this->_codes);
+    return out.data();
+  }
+
+private:
+  static void write_data_layout_info(Output& out, const DataLayoutInfo& info) {
+    out.u64(info.bit_width);
+    out.u64(info.abi_alignment);
+    out.u64(info.pref_alignment);
+  }
+
+  /// \brief Return the identifier of a type
+  ///
+  /// Types are numbered in the order of their records. A structure gets its
+  /// identifier before its fields, since it can be recursive. Its layout is
+  /// written after all the types.
+  std::uint64_t type_id(Type* type) {
+    auto it = this->_type_ids.find(type);
+    if (it != this->_type_ids.end()) {
+      return it->second;
+    }
+
+    if (auto struct_type = dyn_cast< StructType >(type)) {
+      std::uint64_t id = this->new_type_record(type);
+      this->_types.boolean(struct_type->packed());
+      this->_structs.push_back(struct_type);
+      for (auto f = struct_type->field_begin(), e = struct_type->field_end();
+           f != e;
+           ++f) {
+        this->type_id(f->second);
+      }
+      return id;
+    }
+
+    // Visit the sub-types first
+    std::vector< std::uint64_t > sub_types;
+    if (auto ptr_type = dyn_cast< PointerType >(type)) {
+      sub_types.push_back(this->type_id(ptr_type->pointee()));
+    } else if (auto seq_type = dyn_cast< SequentialType >(type)) {
+      sub_types.push_back(this->type_id(seq_type->element_type()));
+    } else if (auto fun_type = dyn_cast< FunctionType >(type)) {
+      sub_types.push_back(this->type_id(fun_type->return_type()));
+      for (auto p = fun_type->param_begin(), e = fun_type->param_end(); p != e;
+           ++p) {
+        sub_types.push_back(this->type_id(*p));
+      }
+    }
+
+    // The type might have been reached through a recursive structure
+    it = this->_type_ids.find(type);
+    if (it != this->_type_ids.end()) {
+      return it->second;
+    }
+
+    std::uint64_t id = this->new_type_record(type);
+    if (auto int_type = dyn_cast< IntegerType >(type)) {
+      this->_types.u64(int_type->bit_width());
+      this->_types.boolean(int_type->is_signed());
+    } else if (auto float_type = dyn_cast< FloatType >(type)) {
+      this->_types.u64(float_type->float_semantic());
+    } else if (isa< PointerType >(type)) {
+      this->_types.u64(sub_types[0]);
+    } else if (auto seq_type = dyn_cast< SequentialType >(type)) {
+      this->_types.u64(sub_types[0]);
+      this->_types.z(seq_type->num_elements());
+    } else if (isa< OpaqueType >(type)) {
+      this->_types.boolean(
+          type == OpaqueType::libc_file_type(this->_bundle->context()));
+    } else if (auto fun_type = dyn_cast< FunctionType >(type)) {
+      this->_types.u64(sub_types.size());
+      for (std::uint64_t sub_type : sub_types) {
+        this->_types.u64(sub_type);
+      }
+      this->_types.boolean(fun_type->is_var_arg());
+    }
+    return id;
+  }
+
+  std::uint64_t new_type_record(Type* type) {
+    std::uint64_t id = this->_type_ids.size();
+    this->_type_ids.emplace(type, id);
+    this->_types.u64(type->kind());
+    return id;
+  }
+
+  /// \brief Return the identifier of a constant
+  ///
+  /// Constants are numbered in the order of their records, after their
+  /// operands.
+  std::uint64_t constant_id(Constant* cst) {
+    auto it = this->_constant_ids.find(cst);
+    if (it != this->_constant_ids.end()) {
+      return it->second;
+    }
+
+    // Visit the operands first
+    std::vector< std::uint64_t > operands;
+    if (auto struct_cst = dyn_cast< StructConstant >(cst)) {
+      for (auto f = struct_cst->field_begin(), e = struct_cst->field_end();
+           f != e;
+           ++f) {
+        operands.push_back(this->value_ref(f->second));
+      }
+    } else if (auto seq_cst = dyn_cast< SequentialConstant >(cst)) {
+      for (auto e = seq_cst->element_begin(), ee = seq_cst->element_end();
+           e != ee;
+           ++e) {
+        operands.push_back(this->value_ref(*e));
+      }
+    }
+    std::uint64_t type = this->type_id(cst->type());
+
+    std::uint64_t id = this->_constant_ids.size();
+    this->_constant_ids.emplace(cst, id);
+    this->_constants.u64(cst->kind());
+    this->_constants.u64(type);
+
+    if (auto int_cst = dyn_cast< IntegerConstant >(cst)) {
+      this->_constants.z(int_cst->value().to_z_number());
+    } else if (auto float_cst = dyn_cast< FloatConstant >(cst)) {
+      this->_constants.str(float_cst->value());
+    } else if (auto struct_cst = dyn_cast< StructConstant >(cst)) {
+      this->_constants.u64(operands.size());
+      auto op = operands.begin();
+      for (auto f = struct_cst->field_begin(), e = struct_cst->field_end();
+           f != e;
+           ++f, ++op) {
+        this->_constants.z(f->first);
+        this->_constants.u64(*op);
+      }
+    } else if (isa< SequentialConstant >(cst)) {
+      this->_constants.u64(operands.size());
+      for (std::uint64_t op : operands) {
+        this->_constants.u64(op);
+      }
+    } else if (auto fun_cst = dyn_cast< FunctionPointerConstant >(cst)) {
+      this->_constants.u64(this->_function_ids.at(fun_cst->function()));
+    } else if (auto asm_cst = dyn_cast< InlineAssemblyConstant >(cst)) {
+      this->_constants.str(asm_cst->code());
+    }
+    return id;
+  }
+
+  /// \brief Return the reference of a value
+  std::uint64_t value_ref(Value* value) {
+    if (value == nullptr) {
+      return NullTag;
+    } else if (auto cst = dyn_cast< Constant >(value)) {
+      return (this->constant_id(cst) << ValueTagBits) | ConstantTag;
+    } else if (auto gv = dyn_cast< GlobalVariable >(value)) {
+      return (this->_global_ids.at(gv) << ValueTagBits) | GlobalVariableTag;
+    } else if (auto lv = dyn_cast< LocalVariable >(value)) {
+      return (this->_local_ids.at(lv) << ValueTagBits) | LocalVariableTag;
+    } else if (auto iv = dyn_cast< InternalVariable >(value)) {
+      return (this->_internal_ids.at(iv) << ValueTagBits) |
+             InternalVariableTag;
+    } else {
+      ikos_unreachable("unexpected value");
+    }
+  }
+
+  void write_function_body(Function* fun) {
+    this->_local_ids.clear();
+    std::vector< LocalVariable* > locals(fun->local_variable_begin(),
+                                         fun->local_variable_end());
+    this->_codes.u64(locals.size());
+    for (LocalVariable* lv : locals) {
+      this->_local_ids.emplace(lv, this->_local_ids.size());
+      this->_codes.u64(this->type_id(lv->type()));
+      this->_codes.u64(lv->alignment());
+      this->_codes.str(lv->name_or_empty());
+      this->_codes.u64(this->_index != nullptr ? this->_index->id(lv) : 0);
+    }
+
+    this->write_code(fun->body(), fun->num_parameters());
+  }
+
+  void write_code(Code* code, std::size_t num_params) {
+    this->_internal_ids.clear();
+    this->_block_ids.clear();
+
+    std::vector< InternalVariable* > vars(code->internal_variable_begin(),
+                                          code->internal_variable_end());
+    ikos_assert(vars.size() >= num_params);
+    this->_codes.u64(vars.size());
+    for (InternalVariable* iv : vars) {
+      if (this->_internal_ids.size() < num_params) {
+        ikos_assert(iv == code->function()->param(this->_internal_ids.size()));
+      }
+      this->_internal_ids.emplace(iv, this->_internal_ids.size());
+      this->_codes.u64(this->type_id(iv->type()));
+      this->_codes.str(iv->name_or_empty());
+      this->_codes.u64(this->_index != nullptr ? this->_index->id(iv) : 0);
+    }
+
+    std::vector< BasicBlock* > blocks(code->begin(), code->end());
+    this->_codes.u64(blocks.size());
+    for (BasicBlock* bb : blocks) {
+      this->_block_ids.emplace(bb, this->_block_ids.size());
+      this->_codes.str(bb->name_or_empty());
+      this->_codes.u64(this->_index != nullptr ? this->_index->id(bb) : 0);
+    }
+
+    this->_codes.u64(this->block_ref(code->entry_block()));
+    this->_codes.u64(this->block_ref(code->exit_block_or_null()));
+    this->_codes.u64(this->block_ref(code->unreachable_block_or_null()));
+    this->_codes.u64(this->block_ref(code->ehresume_block_or_null()));
+
+    for (BasicBlock* bb : blocks) {
+      this->_codes.u64(bb->num_successors());
+      for (auto it = bb->successor_begin(), et = bb->successor_end(); it != et;
+           ++it) {
+        this->_codes.u64(this->_block_ids.at(*it));
+      }
+    }
+
+    for (BasicBlock* bb : blocks) {
+      this->_codes.u64(bb->num_statements());
+      for (Statement* stmt : *bb) {
+        this->write_statement(stmt);
+      }
+    }
+  }
+
+  /// \brief Return the reference of a basic block (index + 1, or 0 if null)
+  std::uint64_t block_ref(BasicBlock* bb) const {
+    return bb != nullptr ? this->_block_ids.at(bb) + 1 : 0;
+  }
+
+  void write_statement(Statement* stmt) {
+    Output& out = this->_codes;
+    out.u64(stmt->kind());
+    out.u64(this->_index != nullptr ? this->_index->id(stmt) : 0);
+    out.u64(this->value_ref(stmt->result_or_null()));
+
+    switch (stmt->kind()) {
+      case Statement::UnaryOperationKind: {
+        out.u64(cast< UnaryOperation >(stmt)->op());
+      } break;
+      case Statement::BinaryOperationKind: {
+        auto bin = cast< BinaryOperation >(stmt);
+        out.u64(bin->op());
+        out.boolean(bin->has_no_wrap());
+        out.boolean(bin->is_exact());
+      } break;
+      case Statement::ComparisonKind: {
+        out.u64(cast< Comparison >(stmt)->predicate());
+      } break;
+      case Statement::AllocateKind: {
+        out.u64(this->type_id(cast< Allocate >(stmt)->allocated_type()));
+      } break;
+      case Statement::PointerShiftKind: {
+        auto shift = cast< PointerShift >(stmt);
+        out.u64(shift->num_terms());
+        for (auto it = shift->term_begin(), et = shift->term_end(); it != et;
+             ++it) {
+          out.machine_int((*it).first);
+        }
+      } break;
+      case Statement::LoadKind: {
+        auto load = cast< Load >(stmt);
+        out.u64(load->alignment());
+        out.boolean(load->is_volatile());
+      } break;
+      case Statement::StoreKind: {
+        auto store = cast< Store >(stmt);
+        out.u64(store->alignment());
+        out.boolean(store->is_volatile());
+      } break;
+      case Statement::InvokeKind: {
+        auto invoke = cast< Invoke >(stmt);
+        out.u64(this->_block_ids.at(invoke->normal_dest()));
+        out.u64(this->_block_ids.at(invoke->exception_dest()));
+      } break;
+      default:
+        break;
+    }
+
+    out.u64(stmt->num_operands());
+    for (auto it = stmt->op_begin(), et = stmt->op_end(); it != et; ++it) {
+      out.u64(this->value_ref(*it));
+    }
+  }
+
+}; // end class Writer
+
+/// \brief Deserialize a bundle
+class Reader {
+private:
+  Context& _ctx;
+  FrontendIndex* _index;
+  Input& _in;
+  Bundle* _bundle = nullptr;
+
+  std::vector< Type* > _types;
+  std::vector< Value* > _constants;
+  std::vector< GlobalVariable* > _globals;
+  std::vector< Function* > _functions;
+  std::vector< LocalVariable* > _locals;
+  std::vector< InternalVariable* > _internals;
+  std::vector< BasicBlock* > _blocks;
+
+public:
+  Reader(Context& ctx, FrontendIndex* index, Input& in)
+      : _ctx(ctx), _index(index), _in(in) {}
+
+  Bundle* read() {
+    // Data layout
+    Endianness endianness = this->_in.boolean() ? LittleEndian : BigEndian;
+    std::unique_ptr< DataLayout > dl =
+        DataLayout::create(endianness, this->read_data_layout_info());
+    dl->integers.clear();
+    for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+      dl->integers.push_back(this->read_data_layout_info());
+    }
+    dl->floats.clear();
+    for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+      dl->floats.push_back(this->read_data_layout_info());
+    }
+    std::string triple = this->_in.str();
+
+    // Types
+    std::uint64_t num_types = this->_in.u64();
+    std::vector< StructType* > structs;
+    for (std::uint64_t i = 0; i < num_types; i++) {
+      this->_types.push_back(this->read_type(structs));
+    }
+    for (StructType* type : structs) {
+      StructType::Layout layout;
+      for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+        ZNumber offset = this->_in.z();
+        layout.emplace(offset, this->type(this->_in.u64()));
+      }
+      type->set_layout(std::move(layout));
+    }
+
+    this->_bundle = Bundle::create(this->_ctx, std::move(dl), triple);
+
+    // Declarations
+    for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+      std::string name = this->_in.str();
+      auto type = cast< PointerType >(this->type(this->_in.u64()));
+      bool is_definition = this->_in.boolean();
+      auto alignment = static_cast< unsigned >(this->_in.u64());
+      GlobalVariable* gv = GlobalVariable::create(this->_bundle,
+                                                  type,
+                                                  std::move(name),
+                                                  is_definition,
+                                                  alignment);
+      this->resolve(gv, this->_in.u64());
+      this->_globals.push_back(gv);
+    }
+
+    for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+      std::string name = this->_in.str();
+      auto type = cast< FunctionType >(this->type(this->_in.u64()));
+      bool is_definition = this->_in.boolean();
+      auto id = static_cast< Intrinsic::ID >(this->_in.u64());
+      Function* fun = nullptr;
+      if (id != Intrinsic::NotIntrinsic) {
+        fun = this->_bundle->intrinsic_function(id);
+      } else {
+        fun = Function::create(this->_bundle,
+                               type,
+                               std::move(name),
+                               is_definition);
+      }
+      this->resolve(fun, this->_in.u64());
+      this->_functions.push_back(fun);
+    }
+
+    // Constants
+    for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+      this->_constants.push_back(this->read_constant());
+    }
+
+    // Bodies
+    while (true) {
+      std::uint64_t id = this->_in.u64();
+      if (id >= this->_globals.size()) {
+        break;
+      }
+      this->read_code(this->_globals[id]->initializer());
+    }
+
+    while (true) {
+      std::uint64_t id = this->_in.u64();
+      if (id >= this->_functions.size()) {
+        break;
+      }
+      this->read_function_body(this->_functions[id]);
+    }
+
+    return this->_bundle;
+  }
+
+private:
+  DataLayoutInfo read_data_layout_info() {
+    auto bit_width = static_cast< unsigned >(this->_in.u64());
+    auto abi_alignment = static_cast< unsigned >(this->_in.u64());
+    auto pref_alignment = static_cast< unsigned >(this->_in.u64());
+    return DataLayoutInfo(bit_width, abi_alignment, pref_alignment);
+  }
+
+  Type* type(std::uint64_t id) const {
+    ikos_assert_msg(id < this->_types.size(), "invalid type identifier");
+    return this->_types[id];
+  }
+
+  Type* read_type(std::vector< StructType* >& structs) {
+    auto kind = static_cast< Type::TypeKind >(this->_in.u64());
+    switch (kind) {
+      case Type::VoidKind:
+        return VoidType::get(this->_ctx);
+      case Type::IntegerKind: {
+        auto bit_width = static_cast< unsigned >(this->_in.u64());
+        Signedness sign = this->_in.boolean() ? Signed : Unsigned;
+        return IntegerType::get(this->_ctx, bit_width, sign);
+      }
+      case Type::FloatKind:
+        return FloatType::get(this->_ctx,
+                              static_cast< FloatSemantic >(this->_in.u64()));
+      case Type::PointerKind:
+        return PointerType::get(this->_ctx, this->type(this->_in.u64()));
+      case Type::StructKind: {
+        StructType* type = StructType::create(this->_ctx, this->_in.boolean());
+        structs.push_back(type);
+        return type;
+      }
+      case Type::ArrayKind: {
+        Type* element_type = this->type(this->_in.u64());
+        return ArrayType::get(this->_ctx, element_type, this->_in.z());
+      }
+      case Type::VectorKind: {
+        Type* element_type = this->type(this->_in.u64());
+        return VectorType::get(this->_ctx, element_type, this->_in.z());
+      }
+      case Type::OpaqueKind: {
+        if (this->_in.boolean()) {
+          return OpaqueType::libc_file_type(this->_ctx);
+        } else {
+          return OpaqueType::create(this->_ctx);
+        }
+      }
+      case Type::FunctionKind: {
+        std::uint64_t n = this->_in.u64();
+        ikos_assert_msg(n > 0, "invalid function type");
+        Type* return_type = this->type(this->_in.u64());
+        FunctionType::ParamTypes params;
+        for (n--; n > 0; n--) {
+          params.push_back(this->type(this->_in.u64()));
+        }
+        bool is_var_arg = this->_in.boolean();
+        return FunctionType::get(this->_ctx, return_type, params, is_var_arg);
+      }
+      default:
+        ikos_unreachable("unexpected type kind");
+    }
+  }
+
+  Value* read_constant() {
+    auto kind = static_cast< Value::ValueKind >(this->_in.u64());
+    Type* type = this->type(this->_in.u64());
+    switch (kind) {
+      case Value::UndefinedConstantKind:
+        return UndefinedConstant::get(this->_ctx, type);
+      case Value::IntegerConstantKind: {
+        auto int_type = cast< IntegerType >(type);
+        return IntegerConstant::get(this->_ctx,
+                                    int_type,
+                                    MachineInt(this->_in.z(),
+                                               int_type->bit_width(),
+                                               int_type->sign()));
+      }
+      case Value::FloatConstantKind:
+        return FloatConstant::get(this->_ctx,
+                                  cast< FloatType >(type),
+                                  this->_in.str());
+      case Value::NullConstantKind:
+        return NullConstant::get(this->_ctx, cast< PointerType >(type));
+      case Value::StructConstantKind: {
+        StructConstant::Values values;
+        for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+          ZNumber offset = this->_in.z();
+          values.emplace(offset, this->value(this->_in.u64()));
+        }
+        return StructConstant::get(this->_ctx,
+                                   cast< StructType >(type),
+                                   values);
+      }
+      case Value::ArrayConstantKind:
+        return ArrayConstant::get(this->_ctx,
+                                  cast< ArrayType >(type),
+                                  this->read_values());
+      case Value::VectorConstantKind:
+        return VectorConstant::get(this->_ctx,
+                                   cast< VectorType >(type),
+                                   this->read_values());
+      case Value::AggregateZeroConstantKind:
+        return AggregateZeroConstant::get(this->_ctx,
+                                          cast< AggregateType >(type));
+      case Value::FunctionPointerConstantKind: {
+        std::uint64_t id = this->_in.u64();
+        ikos_assert_msg(id < this->_functions.size(), "invalid function");
+        return FunctionPointerConstant::get(this->_ctx, this->_functions[id]);
+      }
+      case Value::InlineAssemblyConstantKind:
+        return InlineAssemblyConstant::get(this->_ctx,
+                                           cast< PointerType >(type),
+                                           this->_in.str());
+      default:
+        ikos_unreachable("unexpected constant kind");
+    }
+  }
+
+  std::vector< Value* > read_values() {
+    std::vector< Value* > values;
+    for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+      values.push_back(this->value(this->_in.u64()));
+    }
+    return values;
+  }
+
+  /// \brief Resolve a value reference
+  Value* value(std::uint64_t ref) const {
+    std::uint64_t id = ref >> ValueTagBits;
+    switch (ref & ((1U << ValueTagBits) - 1)) {
+      case NullTag:
+        return nullptr;
+      case ConstantTag:
+        ikos_assert_msg(id < this->_constants.size(), "invalid constant");
+        return this->_constants[id];
+      case GlobalVariableTag:
+        ikos_assert_msg(id < this->_globals.size(), "invalid global variable");
+        return this->_globals[id];
+      case LocalVariableTag:
+        ikos_assert_msg(id < this->_locals.size(), "invalid local variable");
+        return this->_locals[id];
+      case InternalVariableTag:
+        ikos_assert_msg(id < this->_internals.size(),
+                        "invalid internal variable");
+        return this->_internals[id];
+      default:
+        ikos_unreachable("invalid value reference");
+    }
+  }
+
+  template < typename T >
+  T* value_as(std::uint64_t ref) const {
+    return cast_or_null< T >(this->value(ref));
+  }
+
+  BasicBlock* block(std::uint64_t id) const {
+    ikos_assert_msg(id < this->_blocks.size(), "invalid basic block");
+    return this->_blocks[id];
+  }
+
+  BasicBlock* block_ref(std::uint64_t ref) const {
+    return ref > 0 ? this->block(ref - 1) : nullptr;
+  }
+
+  template < typename T >
+  void resolve(T* object, std::uint64_t id) const {
+    if (this->_index != nullptr && id != 0) {
+      this->_index->resolve(object, id);
+    }
+  }
+
+  void read_function_body(Function* fun) {
+    this->_locals.clear();
+    for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+      auto type = cast< PointerType >(this->type(this->_in.u64()));
+      auto alignment = static_cast< unsigned >(this->_in.u64());
+      LocalVariable* lv = LocalVariable::create(fun, type, alignment);
+      std::string name = this->_in.str();
+      if (!name.empty()) {
+        lv->set_name(std::move(name));
+      }
+      this->resolve(static_cast< Variable* >(lv), this->_in.u64());
+      this->_locals.push_back(lv);
+    }
+
+    this->read_code(fun->body());
+  }
+
+  void read_code(Code* code) {
+    this->_internals.clear();
+    this->_blocks.clear();
+
+    // The parameters are created with the function
+    std::vector< InternalVariable* > existing(code->internal_variable_begin(),
+                                              code->internal_variable_end());
+    std::uint64_t num_vars = this->_in.u64();
+    for (std::uint64_t i = 0; i < num_vars; i++) {
+      Type* type = this->type(this->_in.u64());
+      InternalVariable* iv = nullptr;
+      if (i < existing.size()) {
+        iv = existing[i];
+      } else {
+        iv = InternalVariable::create(code, type);
+      }
+      std::string name = this->_in.str();
+      if (!name.empty()) {
+        iv->set_name(std::move(name));
+      }
+      this->resolve(static_cast< Variable* >(iv), this->_in.u64());
+      this->_internals.push_back(iv);
+    }
+
+    for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+      BasicBlock* bb = BasicBlock::create(code);
+      std::string name = this->_in.str();
+      if (!name.empty()) {
+        bb->set_name(std::move(name));
+      }
+      this->resolve(bb, this->_in.u64());
+      this->_blocks.push_back(bb);
+    }
+
+    code->set_entry_block(this->block_ref(this->_in.u64()));
+    code->set_exit_block(this->block_ref(this->_in.u64()));
+    code->set_unreachable_block(this->block_ref(this->_in.u64()));
+    code->set_ehresume_block(this->block_ref(this->_in.u64()));
+
+    for (BasicBlock* bb : this->_blocks) {
+      for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+        bb->add_successor(this->block(this->_in.u64()));
+      }
+    }
+
+    for (BasicBlock* bb : this->_blocks) {
+      for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+        bb->push_back(this->read_statement());
+      }
+    }
+  }
+
+  std::unique_ptr< Statement > read_statement() {
+    auto kind = static_cast< Statement::StatementKind >(this->_in.u64());
+    std::uint64_t frontend_id = this->_in.u64();
+    std::uint64_t result = this->_in.u64();
+
+    // Attributes
+    std::uint64_t op = 0;
+    bool flag1 = false;
+    bool flag2 = false;
+    Type* allocated_type = nullptr;
+    std::vector< MachineInt > factors;
+    BasicBlock* normal_dest = nullptr;
+    BasicBlock* exception_dest = nullptr;
+
+    switch (kind) {
+      case Statement::UnaryOperationKind:
+      case Statement::ComparisonKind: {
+        op = this->_in.u64();
+      } break;
+      case Statement::BinaryOperationKind: {
+        op = this->_in.u64();
+        flag1 = this->_in.boolean();
+        flag2 = this->_in.boolean();
+      } break;
+      case Statement::AllocateKind: {
+        allocated_type = this->type(this->_in.u64());
+      } break;
+      case Statement::PointerShiftKind: {
+        for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+          factors.push_back(this->_in.machine_int());
+        }
+      } break;
+      case Statement::LoadKind:
+      case Statement::StoreKind: {
+        op = this->_in.u64();
+        flag1 = this->_in.boolean();
+      } break;
+      case Statement::InvokeKind: {
+        normal_dest = this->block(this->_in.u64());
+        exception_dest = this->block(this->_in.u64());
+      } break;
+      default:
+        break;
+    }
+
+    // Operands
+    std::vector< Value* > ops;
+    for (std::uint64_t n = this->_in.u64(); n > 0; n--) {
+      ops.push_back(this->value(this->_in.u64()));
+    }
+    auto operand = [&ops](std::size_t i) -> Value* {
+      ikos_assert_msg(i < ops.size(), "invalid number of operands");
+      return ops[i];
+    };
+
+    std::unique_ptr< Statement > stmt;
+    switch (kind) {
+      case Statement::AssignmentKind: {
+        stmt = Assignment::create(this->value_as< InternalVariable >(result),
+                                  operand(0));
+      } break;
+      case Statement::UnaryOperationKind: {
+        stmt = UnaryOperation::
+            create(static_cast< UnaryOperation::Operator >(op),
+                   this->value_as< InternalVariable >(result),
+                   operand(0));
+      } break;
+      case Statement::BinaryOperationKind: {
+        stmt = BinaryOperation::
+            create(static_cast< BinaryOperation::Operator >(op),
+                   this->value_as< InternalVariable >(result),
+                   operand(0),
+                   operand(1),
+                   flag1,
+                   flag2);
+      } break;
+      case Statement::ComparisonKind: {
+        stmt = Comparison::create(static_cast< Comparison::Predicate >(op),
+                                  operand(0),
+                                  operand(1));
+      } break;
+      case Statement::ReturnValueKind: {
+        stmt = ReturnValue::create(ops.empty() ? nullptr : operand(0));
+      } break;
+      case Statement::UnreachableKind: {
+        stmt = Unreachable::create();
+      } break;
+      case Statement::AllocateKind: {
+        stmt = Allocate::create(this->value_as< LocalVariable >(result),
+                                allocated_type,
+                                operand(0));
+      } break;
+      case Statement::PointerShiftKind: {
+        ikos_assert_msg(ops.size() == factors.size() + 1,
+                        "invalid number of operands");
+        std::vector< PointerShift::Term > terms;
+        terms.reserve(factors.size());
+        for (std::size_t i = 0; i < factors.size(); i++) {
+          terms.emplace_back(factors[i], operand(i + 1));
+        }
+        stmt = PointerShift::create(this->value_as< InternalVariable >(result),
+                                    operand(0),
+                                    terms);
+      } break;
+      case Statement::LoadKind: {
+        stmt = Load::create(this->value_as< InternalVariable >(result),
+                            operand(0),
+                            static_cast< unsigned >(op),
+                            flag1);
+      } break;
+      case Statement::StoreKind: {
+        stmt = Store::create(operand(0),
+                             operand(1),
+                             static_cast< unsigned >(op),
+                             flag1);
+      } break;
+      case Statement::ExtractElementKind: {
+        stmt = ExtractElement::create(this->value_as< InternalVariable >(
+                                          result),
+                                      operand(0),
+                                      operand(1));
+      } break;
+      case Statement::InsertElementKind: {
+        stmt = InsertElement::create(this->value_as< InternalVariable >(result),
+                                     operand(0),
+                                     operand(1),
+                                     operand(2));
+      } break;
+      case Statement::CallKind: {
+        std::vector< Value* > arguments(ops.begin() + 1, ops.end());
+        stmt = Call::create(this->value_as< InternalVariable >(result),
+                            operand(0),
+                            arguments);
+      } break;
+      case Statement::InvokeKind: {
+        std::vector< Value* > arguments(ops.begin() + 1, ops.end());
+        stmt = Invoke::create(this->value_as< InternalVariable >(result),
+                              operand(0),
+                              arguments,
+                              normal_dest,
+                              exception_dest);
+      } break;
+      case Statement::LandingPadKind: {
+        stmt = LandingPad::create(this->value_as< InternalVariable >(result));
+      } break;
+      case Statement::ResumeKind: {
+        stmt = Resume::create(cast< InternalVariable >(operand(0)));
+      } break;
+      default:
+        ikos_unreachable("unexpected statement kind");
+    }
+
+    this->resolve(stmt.get(), frontend_id);
+    return stmt;
+  }
+
+}; // end class Reader
+
+} // end anonymous namespace
+
+// BinaryWriter
+
+void BinaryWriter::write(std::ostream& o,
+                         Bundle* bundle,
+                         const std::string& key) const {
+  std::string payload = Writer(bundle, this->_index).payload();
+
+  Output header;
+  header.u64(Version);
+  header.str(key);
+  header.u64(payload.size());
+  header.u64(checksum(payload));
+
+  o.write(Magic, sizeof(Magic));
+  o.write(header.data().data(),
+          static_cast< std::streamsize >(header.data().size()));
+  o.write(payload.data(), static_cast< std::streamsize >(payload.size()));
+}
+
+// BinaryReader
+
+Bundle* BinaryReader::read(std::istream& i,
+                           Context& ctx,
+                           const std::string& key) const {
+  std::string data((std::istreambuf_iterator< char >(i)),
+                   std::istreambuf_iterator< char >());
+
+  if (data.size() < sizeof(Magic) ||
+      std::memcmp(data.data(), Magic, sizeof(Magic)) != 0) {
+    return nullptr;
+  }
+
+  Input header(data.data() + sizeof(Magic), data.data() + data.size());
+  if (header.u64() != Version || header.str() != key) {
+    return nullptr;
+  }
+  std::uint64_t size = header.u64();
+  std::uint64_t expected_checksum = header.u64();
+  if (size > data.size()) {
+    return nullptr;
+  }
+
+  std::string payload = data.substr(data.size() - size);
+  if (checksum(payload) != expected_checksum) {
+    return nullptr;
+  }
+
+  Input in(payload.data(), payload.data() + payload.size());
+  Bundle* bundle = Reader(ctx, this->_index, in).read();
+  ikos_assert_msg(in.done(), "invalid binary bundle");
+  return bundle;
+}
+
+} // end namespace ar
+} // end namespace ikos
@@ -41,6 +41,14 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
 #include <boost/container/flat_set.hpp>
 
 #include <ikos/ar/format/text.hpp>
@@ -52,7 +60,9 @@
 namespace ikos {
 namespace ar {
 
-void TextFormatter::format(std::ostream& o, Bundle* bundle) const {
+void TextFormatter::format(std::ostream& o,
+                           Bundle* bundle,
+                           unsigned jobs) const {
   o << "// Bundle\n";
 
   // data layout
@@ -72,28 +82,13 @@ void TextFormatter::format(std::ostream& o, Bundle* bundle) const {
   // target triple
   o << "target-triple = " << bundle->target_triple() << "\n";
 
-  if (!this->order_globals()) {
-    // global variables
-    for (auto it = bundle->global_begin(), et = bundle->global_end(); it != et;
-         ++it) {
-      o << "\n";
-      this->format(o, *it);
-    }
+  std::vector< GlobalVariable* > globals(bundle->global_begin(),
+                                         bundle->global_end());
+  std::vector< Function* > functions(bundle->function_begin(),
+                                     bundle->function_end());
 
-    // functions
-    for (auto it = bundle->function_begin(), et = bundle->function_end();
-         it != et;
-         ++it) {
-      o << "\n";
-      this->format(o, *it);
-    }
-  } else {
+  if (this->order_globals()) {
     // sort global variables and functions by name, before formatting
-    std::vector< GlobalVariable* > globals(bundle->global_begin(),
-                                           bundle->global_end());
-    std::vector< Function* > functions(bundle->function_begin(),
-                                       bundle->function_end());
-
     std::sort(globals.begin(),
               globals.end(),
               [](GlobalVariable* a, GlobalVariable* b) {
@@ -102,16 +97,88 @@ void TextFormatter::format(std::ostream& o, Bundle* bundle) const {
     std::sort(functions.begin(), functions.end(), [](Function* a, Function* b) {
       return a->name() < b->name();
     });
+  }
 
-    // format globals and functions
-    for (GlobalVariable* gv : globals) {
-      o << "\n";
-      this->format(o, gv);
-    }
+  // global variables
+  for (GlobalVariable* gv : globals) {
+    o << "\n";
+    this->format(o, gv);
+  }
+
+  // functions
+  this->format(o, functions, jobs);
+}
+
+void TextFormatter::format(std::ostream& o,
+                           const std::vector< Function* >& functions,
+                           unsigned jobs) const {
+  std::size_t n = functions.size();
+  std::size_t num_threads = std::min(static_cast< std::size_t >(jobs), n);
+
+  if (num_threads <= 1) {
     for (Function* fun : functions) {
       o << "\n";
       this->format(o, fun);
     }
+    return;
+  }
+
+  // Each function is formatted into its own buffer. Buffers are written in
+  // order as soon as they are ready, and released right after.
+  std::vector< std::string > buffers(n);
+  std::vector< bool > ready(n, false);
+  std::atomic< std::size_t > next(0);
+  std::exception_ptr error = nullptr;
+  std::mutex mutex;
+  std::condition_variable buffer_ready;
+
+  auto worker = [&]() {
+    while (true) {
+      std::size_t i = next++;
+      if (i >= n) {
+        return;
+      }
+      try {
+        std::ostringstream buffer;
+        this->format(buffer, functions[i]);
+        buffers[i] = buffer.str();
+        std::lock_guard< std::mutex > lock(mutex);
+        ready[i] = true;
+      } catch (...) {
+        std::lock_guard< std::mutex > lock(mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        next = n;
+      }
+      buffer_ready.notify_all();
+    }
+  };
+
+  std::vector< std::thread > threads;
+  threads.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; i++) {
+    threads.emplace_back(worker);
+  }
+
+  for (std::size_t i = 0; i < n; i++) {
+    {
+      std::unique_lock< std::mutex > lock(mutex);
+      buffer_ready.wait(lock, [&]() { return ready[i] || error; });
+      if (!ready[i]) {
+        break;
+      }
+    }
+    o << "\n" << buffers[i];
+    std::string().swap(buffers[i]);
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
   }
 }
 
@@ -47,6 +47,10 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
 #include <ikos/core/fixpoint/wto.hpp>
 
 #include <ikos/ar/pass/add_loop_counters.hpp>
@@ -77,11 +81,20 @@ private:
   // Code
   Code* _code;
 
+  // Intrinsic ar.ikos.counter.init
+  Function* _counter_init;
+
+  // Intrinsic ar.ikos.counter.incr
+  Function* _counter_incr;
+
   // List of basic blocks in the current cycle
   std::vector< BasicBlock* > _blocks;
 
 public:
-  explicit LoopIterator(Code* code) : _code(code) {}
+  LoopIterator(Code* code, Function* counter_init, Function* counter_incr)
+      : _code(code),
+        _counter_init(counter_init),
+        _counter_incr(counter_incr) {}
 
   void visit(const WtoVertexT& vertex) override {
     this->_blocks.push_back(vertex.node());
@@ -98,7 +111,9 @@ public:
       it->accept(*this);
     }
 
-    this->add_loop_counter(cycle, this->_blocks);
+    if (has_induction_exit(this->_blocks)) {
+      this->add_loop_counter(cycle, this->_blocks);
+    }
 
     // Update _blocks
     this->_blocks.insert(this->_blocks.end(),
@@ -106,17 +121,119 @@ public:
                          current_blocks.end());
   }
 
+  /// \brief Return true if an exit of the given cycle is guarded by a
+  /// comparison on an induction variable
+  ///
+  /// The gauge domain can only bound the variables incremented by a constant
+  /// at each iteration, so a counter is useless for the other cycles.
+  static bool has_induction_exit(const std::vector< BasicBlock* >& blocks) {
+    std::unordered_set< BasicBlock* > cycle(blocks.begin(), blocks.end());
+    std::unordered_set< Value* > induction = induction_variables(blocks);
+
+    for (BasicBlock* bb : blocks) {
+      bool exiting = std::any_of(bb->successor_begin(),
+                                 bb->successor_end(),
+                                 [&cycle](BasicBlock* succ) {
+                                   return cycle.count(succ) == 0;
+                                 });
+      if (!exiting) {
+        continue;
+      }
+
+      // Branches are translated into comparisons at the beginning of the
+      // successors
+      for (auto it = bb->successor_begin(), et = bb->successor_end(); it != et;
+           ++it) {
+        BasicBlock* succ = *it;
+        if (succ->empty() || !isa< Comparison >(succ->front())) {
+          continue;
+        }
+        auto cmp = cast< Comparison >(succ->front());
+        if (cmp->is_integer_predicate() &&
+            (induction.count(cmp->left()) != 0 ||
+             induction.count(cmp->right()) != 0)) {
+          return true;
+        }
+      }
+    }
+
+    return false;
+  }
+
+  /// \brief Return the variables of the given cycle that are incremented or
+  /// decremented by a constant, or copies and casts of such variables
+  static std::unordered_set< Value* > induction_variables(
+      const std::vector< BasicBlock* >& blocks) {
+    std::unordered_set< Value* > induction;
+
+    // Steps `%x = %y + cst` and `%x = %y - cst`
+    for (BasicBlock* bb : blocks) {
+      for (Statement* stmt : *bb) {
+        auto bin = dyn_cast< BinaryOperation >(stmt);
+        if (bin == nullptr) {
+          continue;
+        }
+        switch (bin->op()) {
+          case BinaryOperation::UAdd:
+          case BinaryOperation::SAdd:
+          case BinaryOperation::USub:
+          case BinaryOperation::SSub: {
+            Value* var = bin->left();
+            if (isa< IntegerConstant >(var)) {
+              var = bin->right();
+            } else if (!isa< IntegerConstant >(bin->right())) {
+              continue;
+            }
+            if (isa< InternalVariable >(var)) {
+              induction.insert(bin->result());
+              induction.insert(var);
+            }
+          } break;
+          default:
+            break;
+        }
+      }
+    }
+
+    // Propagate through the assignments and the integer casts
+    bool change = !induction.empty();
+    while (change) {
+      change = false;
+      for (BasicBlock* bb : blocks) {
+        for (Statement* stmt : *bb) {
+          Value* operand = nullptr;
+          if (auto assign = dyn_cast< Assignment >(stmt)) {
+            operand = assign->operand();
+          } else if (auto unary = dyn_cast< UnaryOperation >(stmt)) {
+            if (unary->op() == UnaryOperation::UTrunc ||
+                unary->op() == UnaryOperation::STrunc ||
+                unary->op() == UnaryOperation::ZExt ||
+                unary->op() == UnaryOperation::SExt) {
+              operand = unary->operand();
+            }
+          }
+          if (operand == nullptr || !isa< InternalVariable >(operand)) {
+            continue;
+          }
+          Value* result = stmt->result();
+          if (induction.count(operand) != 0) {
+            change |= induction.insert(result).second;
+          } else if (induction.count(result) != 0 && isa< Assignment >(stmt)) {
+            change |= induction.insert(operand).second;
+          }
+        }
+      }
+    }
+
+    return induction;
+  }
+
   /// \brief Add a loop counter in the given cycle
   void add_loop_counter(const WtoCycleT& cycle,
                         const std::vector< BasicBlock* >& blocks) {
-    Bundle* bundle = this->_code->bundle();
-    Context& ctx = bundle->context();
-
-    // Get the intrinsics for loop counters
-    Function* counter_init =
-        bundle->intrinsic_function(Intrinsic::IkosCounterInit);
-    Function* counter_incr =
-        bundle->intrinsic_function(Intrinsic::IkosCounterIncr);
+    Context& ctx = this->_code->context();
+    Function* counter_init = this->_counter_init;
+    Function* counter_incr = this->_counter_incr;
 
     // Create the loop counter variable
     IntegerType* size_ty = IntegerType::size_type(this->_code->bundle());
@@ -173,12 +290,18 @@ public:
 
 } // end anonymous namespace
 
+void AddLoopCountersPass::initialize(Bundle* bundle) {
+  // Get the intrinsics for loop counters
+  this->_counter_init = bundle->intrinsic_function(Intrinsic::IkosCounterInit);
+  this->_counter_incr = bundle->intrinsic_function(Intrinsic::IkosCounterIncr);
+}
+
 bool AddLoopCountersPass::run_on_code(Code* code) {
   // Compute the weak topological order
   core::Wto< Code* > wto(code);
 
   // Add a loop counter in each cycle
-  LoopIterator it(code);
+  LoopIterator it(code, this->_counter_init, this->_counter_incr);
   wto.accept(it);
 
   return true;
@@ -0,0 +1,573 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of ConstantPropagationPass
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <ikos/ar/pass/constant_propagation.hpp>
+#include <ikos/ar/semantic/code.hpp>
+#include <ikos/ar/semantic/statement.hpp>
+#include <ikos/ar/semantic/value.hpp>
+
+namespace ikos {
+namespace ar {
+
+const char* ConstantPropagationPass::name() const {
+  return "constant-propagation";
+}
+
+const char* ConstantPropagationPass::description() const {
+  return "Propagate integer constants";
+}
+
+namespace {
+
+/// \brief Lattice value of an internal integer variable
+class LatticeValue {
+public:
+  enum Kind {
+    /// \brief No reachable definition has been evaluated yet
+    Undefined,
+
+    /// \brief All reachable definitions give the same constant
+    Constant,
+
+    /// \brief The variable is not a constant
+    Overdefined,
+  };
+
+private:
+  Kind _kind;
+  IntegerConstant* _constant;
+
+private:
+  LatticeValue(Kind kind, IntegerConstant* constant)
+      : _kind(kind), _constant(constant) {}
+
+public:
+  /// \brief Create the undefined lattice value
+  static LatticeValue undefined() { return LatticeValue(Undefined, nullptr); }
+
+  /// \brief Create a constant lattice value
+  static LatticeValue constant(IntegerConstant* cst) {
+    return LatticeValue(Constant, cst);
+  }
+
+  /// \brief Create the overdefined lattice value
+  static LatticeValue overdefined() {
+    return LatticeValue(Overdefined, nullptr);
+  }
+
+  /// \brief Return true if no definition has been evaluated yet
+  bool is_undefined() const { return this->_kind == Undefined; }
+
+  /// \brief Return true if the value is a constant
+  bool is_constant() const { return this->_kind == Constant; }
+
+  /// \brief Return true if the value is not a constant
+  bool is_overdefined() const { return this->_kind == Overdefined; }
+
+  /// \brief Return the constant
+  IntegerConstant* constant() const {
+    ikos_assert(this->_kind == Constant);
+    return this->_constant;
+  }
+
+  /// \brief Join with the given lattice value
+  ///
+  /// Returns true if the lattice value has changed
+  bool join_with(LatticeValue other) {
+    if (other.is_undefined() || this->is_overdefined()) {
+      return false;
+    } else if (this->is_undefined()) {
+      *this = other;
+      return true;
+    } else if (other.is_constant() && this->_constant == other._constant) {
+      // Integer constants are uniqued in the context
+      return false;
+    } else {
+      *this = overdefined();
+      return true;
+    }
+  }
+
+}; // end class LatticeValue
+
+/// \brief Return true if the given value is an internal integer variable
+bool is_integer_variable(Value* value) {
+  return isa< InternalVariable >(value) && value->type()->is_integer();
+}
+
+/// \brief Fold an integer binary operation on constants
+///
+/// Returns boost::none if the operation is an undefined behavior or traps
+boost::optional< MachineInt > fold(BinaryOperation* stmt,
+                                   const MachineInt& left,
+                                   const MachineInt& right) {
+  bool overflow = false;
+  bool exact = true;
+
+  switch (stmt->op()) {
+    case BinaryOperation::UAdd:
+    case BinaryOperation::SAdd: {
+      MachineInt r = add(left, right, overflow);
+      if (stmt->has_no_wrap() && overflow) {
+        return boost::none;
+      }
+      return r;
+    }
+    case BinaryOperation::USub:
+    case BinaryOperation::SSub: {
+      MachineInt r = sub(left, right, overflow);
+      if (stmt->has_no_wrap() && overflow) {
+        return boost::none;
+      }
+      return r;
+    }
+    case BinaryOperation::UMul:
+    case BinaryOperation::SMul: {
+      MachineInt r = mul(left, right, overflow);
+      if (stmt->has_no_wrap() && overflow) {
+        return boost::none;
+      }
+      return r;
+    }
+    case BinaryOperation::UDiv:
+    case BinaryOperation::SDiv: {
+      if (right.is_zero()) {
+        return boost::none;
+      }
+      MachineInt r = div(left, right, overflow, exact);
+      if (overflow || (stmt->is_exact() && !exact)) {
+        return boost::none;
+      }
+      return r;
+    }
+    case BinaryOperation::URem:
+    case BinaryOperation::SRem: {
+      if (right.is_zero() ||
+          (left.is_signed() && left.is_min() && right.all_ones())) {
+        return boost::none;
+      }
+      return rem(left, right);
+    }
+    case BinaryOperation::UShl:
+    case BinaryOperation::SShl:
+    case BinaryOperation::ULShr:
+    case BinaryOperation::SLShr:
+    case BinaryOperation::UAShr:
+    case BinaryOperation::SAShr: {
+      if (right.is_negative() || right.to_z_number() >= left.bit_width()) {
+        return boost::none;
+      }
+      MachineInt r = left;
+      if (stmt->op() == BinaryOperation::UShl ||
+          stmt->op() == BinaryOperation::SShl) {
+        r = shl(left, right, overflow);
+      } else if (stmt->op() == BinaryOperation::ULShr ||
+                 stmt->op() == BinaryOperation::SLShr) {
+        r = lshr(left, right, exact);
+      } else {
+        r = ashr(left, right, exact);
+      }
+      if ((stmt->has_no_wrap() && overflow) || (stmt->is_exact() && !exact)) {
+        return boost::none;
+      }
+      return r;
+    }
+    case BinaryOperation::UAnd:
+    case BinaryOperation::SAnd:
+      return and_(left, right);
+    case BinaryOperation::UOr:
+    case BinaryOperation::SOr:
+      return or_(left, right);
+    case BinaryOperation::UXor:
+    case BinaryOperation::SXor:
+      return xor_(left, right);
+    default:
+      return boost::none;
+  }
+}
+
+/// \brief Evaluate an integer comparison on constants
+bool evaluate_predicate(Comparison::Predicate pred,
+                        const MachineInt& left,
+                        const MachineInt& right) {
+  switch (pred) {
+    case Comparison::UIEQ:
+    case Comparison::SIEQ:
+      return left == right;
+    case Comparison::UINE:
+    case Comparison::SINE:
+      return left != right;
+    case Comparison::UIGT:
+    case Comparison::SIGT:
+      return left > right;
+    case Comparison::UIGE:
+    case Comparison::SIGE:
+      return left >= right;
+    case Comparison::UILT:
+    case Comparison::SILT:
+      return left < right;
+    case Comparison::UILE:
+    case Comparison::SILE:
+      return left <= right;
+    default:
+      ikos_unreachable("unexpected predicate");
+  }
+}
+
+/// \brief Conditional constant propagation on a code
+class ConstantPropagation {
+private:
+  // Code
+  Code* _code;
+
+  // Lattice value of internal integer variables
+  std::unordered_map< InternalVariable*, LatticeValue > _values;
+
+  // Basic blocks using each internal integer variable
+  std::unordered_map< InternalVariable*, std::vector< BasicBlock* > > _users;
+
+  // Basic blocks reachable from the entry block
+  std::unordered_set< BasicBlock* > _executable;
+
+  // Executable basic blocks with a comparison that is always false
+  std::unordered_set< BasicBlock* > _infeasible;
+
+  // Basic blocks to (re)visit
+  std::vector< BasicBlock* > _worklist;
+
+public:
+  /// \brief Constructor
+  explicit ConstantPropagation(Code* code) : _code(code) {}
+
+  /// \brief Compute the lattice values and the executable basic blocks
+  void run() {
+    for (BasicBlock* bb : *this->_code) {
+      for (Statement* stmt : *bb) {
+        for (auto it = stmt->op_begin(), et = stmt->op_end(); it != et; ++it) {
+          if (is_integer_variable(*it)) {
+            this->_users[cast< InternalVariable >(*it)].push_back(bb);
+          }
+        }
+      }
+    }
+
+    // Parameters are never defined by a statement
+    if (this->_code->is_function_body()) {
+      Function* fun = this->_code->function();
+      for (auto it = fun->param_begin(), et = fun->param_end(); it != et;
+           ++it) {
+        this->set_overdefined(*it);
+      }
+    }
+
+    this->mark_executable(this->_code->entry_block());
+
+    while (!this->_worklist.empty()) {
+      BasicBlock* bb = this->_worklist.back();
+      this->_worklist.pop_back();
+      this->visit(bb);
+    }
+  }
+
+  /// \brief Rewrite the code using the computed lattice values
+  ///
+  /// Returns true if the code has been updated
+  bool transform() {
+    bool change = false;
+    std::vector< BasicBlock* > to_remove;
+
+    for (BasicBlock* bb : *this->_code) {
+      if (this->is_special_block(bb)) {
+        continue;
+      }
+      if (this->_executable.count(bb) == 0) {
+        to_remove.push_back(bb);
+      } else if (this->_infeasible.count(bb) != 0) {
+        if (bb != this->_code->entry_block() &&
+            this->is_false_comparison(bb->front())) {
+          to_remove.push_back(bb);
+        } else {
+          this->truncate_after_false_comparison(bb);
+          change = true;
+        }
+      }
+    }
+
+    for (BasicBlock* bb : to_remove) {
+      this->_code->erase_basic_block(bb);
+      change = true;
+    }
+
+    for (BasicBlock* bb : *this->_code) {
+      for (auto it = bb->begin(); it != bb->end();) {
+        Statement* stmt = *it;
+        this->replace_operands(stmt, change);
+        if (this->is_constant_definition(stmt) ||
+            this->is_true_comparison(stmt)) {
+          it = this->remove(bb, it);
+          change = true;
+        } else {
+          ++it;
+        }
+      }
+    }
+
+    return change;
+  }
+
+private:
+  /// \brief Return the lattice value of the given value
+  LatticeValue value(Value* v) const {
+    if (auto cst = dyn_cast< IntegerConstant >(v)) {
+      return LatticeValue::constant(cst);
+    } else if (is_integer_variable(v)) {
+      auto it = this->_values.find(cast< InternalVariable >(v));
+      if (it == this->_values.end()) {
+        return LatticeValue::undefined();
+      }
+      return it->second;
+    } else {
+      return LatticeValue::overdefined();
+    }
+  }
+
+  /// \brief Join the given lattice value into the given variable
+  void update(InternalVariable* var, LatticeValue v) {
+    if (!var->type()->is_integer()) {
+      return;
+    }
+    auto res = this->_values.emplace(var, LatticeValue::undefined());
+    if (res.first->second.join_with(v)) {
+      auto it = this->_users.find(var);
+      if (it != this->_users.end()) {
+        for (BasicBlock* bb : it->second) {
+          if (this->_executable.count(bb) != 0) {
+            this->_worklist.push_back(bb);
+          }
+        }
+      }
+    }
+  }
+
+  /// \brief Mark the given variable as not constant
+  void set_overdefined(InternalVariable* var) {
+    this->update(var, LatticeValue::overdefined());
+  }
+
+  /// \brief Mark the given basic block as executable
+  void mark_executable(BasicBlock* bb) {
+    if (this->_executable.insert(bb).second) {
+      this->_worklist.push_back(bb);
+    }
+  }
+
+  /// \brief Evaluate the statements of the given basic block
+  void visit(BasicBlock* bb) {
+    for (Statement* stmt : *bb) {
+      if (auto assign = dyn_cast< Assignment >(stmt)) {
+        this->update(assign->result(), this->value(assign->operand()));
+      } else if (auto unary = dyn_cast< UnaryOperation >(stmt)) {
+        this->update(unary->result(), this->evaluate(unary));
+      } else if (auto binary = dyn_cast< BinaryOperation >(stmt)) {
+        this->update(binary->result(), this->evaluate(binary));
+      } else if (auto cmp = dyn_cast< Comparison >(stmt)) {
+        if (this->is_false_comparison(cmp)) {
+          this->_infeasible.insert(bb);
+          return;
+        }
+      } else if (stmt->has_result() &&
+                 isa< InternalVariable >(stmt->result())) {
+        this->set_overdefined(cast< InternalVariable >(stmt->result()));
+      }
+    }
+
+    for (auto it = bb->successor_begin(), et = bb->successor_end(); it != et;
+         ++it) {
+      this->mark_executable(*it);
+    }
+  }
+
+  /// \brief Evaluate an integer cast
+  LatticeValue evaluate(UnaryOperation* stmt) const {
+    Type* type = stmt->result()->type();
+    if (!type->is_integer() || !stmt->operand()->type()->is_integer()) {
+      return LatticeValue::overdefined();
+    }
+    LatticeValue v = this->value(stmt->operand());
+    if (!v.is_constant()) {
+      return v;
+    }
+    auto int_type = cast< IntegerType >(type);
+    return LatticeValue::constant(IntegerConstant::get(
+        this->_code->context(),
+        int_type,
+        v.constant()->value().cast(int_type->bit_width(), int_type->sign())));
+  }
+
+  /// \brief Evaluate an integer binary operation
+  LatticeValue evaluate(BinaryOperation* stmt) const {
+    if (!stmt->is_integer_op()) {
+      return LatticeValue::overdefined();
+    }
+    LatticeValue left = this->value(stmt->left());
+    LatticeValue right = this->value(stmt->right());
+    if (left.is_overdefined() || right.is_overdefined()) {
+      return LatticeValue::overdefined();
+    } else if (left.is_undefined() || right.is_undefined()) {
+      return LatticeValue::undefined();
+    }
+    boost::optional< MachineInt > r =
+        fold(stmt, left.constant()->value(), right.constant()->value());
+    if (!r) {
+      return LatticeValue::overdefined();
+    }
+    return LatticeValue::constant(
+        IntegerConstant::get(this->_code->context(),
+                             cast< IntegerType >(stmt->result()->type()),
+                             *r));
+  }
+
+  /// \brief Evaluate an integer comparison, if all operands are constants
+  boost::optional< bool > evaluate(Comparison* cmp) const {
+    if (!cmp->is_integer_predicate()) {
+      return boost::none;
+    }
+    LatticeValue left = this->value(cmp->left());
+    LatticeValue right = this->value(cmp->right());
+    if (!left.is_constant() || !right.is_constant()) {
+      return boost::none;
+    }
+    return evaluate_predicate(cmp->predicate(),
+                              left.constant()->value(),
+                              right.constant()->value());
+  }
+
+  /// \brief Return true if the statement is a comparison always false
+  bool is_false_comparison(Statement* stmt) const {
+    if (auto cmp = dyn_cast< Comparison >(stmt)) {
+      boost::optional< bool > r = this->evaluate(cmp);
+      return r && !*r;
+    }
+    return false;
+  }
+
+  /// \brief Return true if the statement is a comparison always true
+  bool is_true_comparison(Statement* stmt) const {
+    if (auto cmp = dyn_cast< Comparison >(stmt)) {
+      boost::optional< bool > r = this->evaluate(cmp);
+      return r && *r;
+    }
+    return false;
+  }
+
+  /// \brief Return true if the statement defines a constant variable
+  bool is_constant_definition(Statement* stmt) const {
+    return (isa< Assignment >(stmt) || isa< UnaryOperation >(stmt) ||
+            isa< BinaryOperation >(stmt)) &&
+           this->value(stmt->result()).is_constant();
+  }
+
+  /// \brief Return true if the basic block cannot be removed
+  bool is_special_block(BasicBlock* bb) const {
+    return bb == this->_code->entry_block() ||
+           bb == this->_code->exit_block_or_null() ||
+           bb == this->_code->unreachable_block_or_null() ||
+           bb == this->_code->ehresume_block_or_null();
+  }
+
+  /// \brief Replace the constant variables in the operands of a statement
+  void replace_operands(Statement* stmt, bool& change) const {
+    for (std::size_t i = 0; i < stmt->num_operands(); i++) {
+      LatticeValue v = this->value(stmt->operand(i));
+      if (v.is_constant() && stmt->operand(i) != v.constant()) {
+        stmt->set_operand(i, v.constant());
+        change = true;
+      }
+    }
+  }
+
+  /// \brief Remove the statements following the first false comparison of
+  /// the given basic block, and its successors
+  void truncate_after_false_comparison(BasicBlock* bb) const {
+    auto it = std::find_if(bb->begin(), bb->end(), [this](Statement* stmt) {
+      return this->is_false_comparison(stmt);
+    });
+    ikos_assert(it != bb->end());
+    Statement* cmp = *it;
+    while (bb->back() != cmp) {
+      bb->pop_back();
+    }
+    bb->clear_successors();
+  }
+
+  /// \brief Remove the statement at the given position
+  ///
+  /// Returns an iterator on the next statement
+  BasicBlock::StatementIterator remove(BasicBlock* bb,
+                                       BasicBlock::StatementIterator it) const {
+    auto pos = std::distance(bb->begin(), it);
+    bb->remove(it);
+    return std::next(bb->begin(), pos);
+  }
+
+}; // end class ConstantPropagation
+
+} // end anonymous namespace
+
+bool ConstantPropagationPass::run_on_code(Code* code) {
+  ConstantPropagation cp(code);
+  cp.run();
+  return cp.transform();
+}
+
+} // end namespace ar
+} // end namespace ikos
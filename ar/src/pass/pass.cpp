@@ -51,6 +51,8 @@ namespace ar {
 bool CodePass::run(Bundle* bundle) {
   bool change = false;
 
+  this->initialize(bundle);
+
   for (auto it = bundle->global_begin(), et = bundle->global_end(); it != et;
        ++it) {
     GlobalVariable* gv = *it;
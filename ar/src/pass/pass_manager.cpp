@@ -0,0 +1,164 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of the pass manager
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include <ikos/ar/pass/pass_manager.hpp>
+
+namespace ikos {
+namespace ar {
+
+bool PassManager::run(Bundle* bundle) {
+  bool change = false;
+  std::vector< CodePass* > code_passes;
+
+  for (const auto& pass : this->_passes) {
+    if (auto code_pass = dynamic_cast< CodePass* >(pass.get())) {
+      code_passes.push_back(code_pass);
+    } else {
+      change = this->run_code_passes(bundle, code_passes) || change;
+      code_passes.clear();
+      change = pass->run(bundle) || change;
+    }
+  }
+
+  change = this->run_code_passes(bundle, code_passes) || change;
+  return change;
+}
+
+bool PassManager::run_code_passes(Bundle* bundle,
+                                  const std::vector< CodePass* >& passes) {
+  if (passes.empty()) {
+    return false;
+  }
+
+  for (CodePass* pass : passes) {
+    pass->initialize(bundle);
+  }
+
+  // Collect all the codes
+  std::vector< Code* > codes;
+  for (auto it = bundle->global_begin(), et = bundle->global_end(); it != et;
+       ++it) {
+    GlobalVariable* gv = *it;
+    if (gv->is_definition()) {
+      codes.push_back(gv->initializer());
+    }
+  }
+  for (auto it = bundle->function_begin(), et = bundle->function_end();
+       it != et;
+       ++it) {
+    Function* fun = *it;
+    if (fun->is_definition()) {
+      codes.push_back(fun->body());
+    }
+  }
+
+  // Run all the passes on one code
+  auto run_on_code = [&passes](Code* code) {
+    bool change = false;
+    for (CodePass* pass : passes) {
+      change = pass->run_on_code(code) || change;
+    }
+    return change;
+  };
+
+  auto jobs = std::min(static_cast< std::size_t >(this->_jobs), codes.size());
+
+  if (jobs <= 1) {
+    bool change = false;
+    for (Code* code : codes) {
+      change = run_on_code(code) || change;
+    }
+    return change;
+  }
+
+  std::atomic< std::size_t > next(0);
+  std::atomic< bool > change(false);
+  std::exception_ptr error = nullptr;
+  std::mutex error_mutex;
+
+  auto worker = [&]() {
+    while (true) {
+      std::size_t i = next++;
+      if (i >= codes.size()) {
+        return;
+      }
+      try {
+        if (run_on_code(codes[i])) {
+          change = true;
+        }
+      } catch (...) {
+        std::lock_guard< std::mutex > lock(error_mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        next = codes.size();
+        return;
+      }
+    }
+  };
+
+  std::vector< std::thread > threads;
+  threads.reserve(jobs);
+  for (std::size_t i = 0; i < jobs; i++) {
+    threads.emplace_back(worker);
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  return change;
+}
+
+} // end namespace ar
+} // end namespace ikos
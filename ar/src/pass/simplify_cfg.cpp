@@ -149,6 +149,9 @@ const char* SimplifyCFGPass::description() const {
 bool SimplifyCFGPass::run_on_code(Code* code) {
   bool change = merge_single_blocks(code);
   remove_unreachable_blocks(code);
+  if (change) {
+    code->relayout();
+  }
   return change;
 }
 
@@ -0,0 +1,222 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of SlicingPass
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <ikos/ar/pass/slicing.hpp>
+#include <ikos/ar/semantic/code.hpp>
+#include <ikos/ar/semantic/statement.hpp>
+#include <ikos/ar/semantic/value.hpp>
+
+namespace ikos {
+namespace ar {
+
+const char* SlicingPass::name() const {
+  return "slicing";
+}
+
+const char* SlicingPass::description() const {
+  return "Remove statements the slicing criterion does not depend on";
+}
+
+namespace {
+
+/// \brief Return true if the given type holds floating point values only
+bool is_floating_point(Type* type) {
+  if (type->is_float()) {
+    return true;
+  } else if (type->is_vector()) {
+    return cast< VectorType >(type)->element_type()->is_float();
+  } else {
+    return false;
+  }
+}
+
+/// \brief Return true if the statement has side effects
+bool has_side_effects(Statement* stmt) {
+  return isa< Store >(stmt) || isa< CallBase >(stmt) ||
+         isa< LandingPad >(stmt) || isa< Resume >(stmt) ||
+         isa< ReturnValue >(stmt) || isa< Unreachable >(stmt);
+}
+
+/// \brief Slicing of a code
+class Slicing {
+private:
+  const SlicingPass::Criterion& _criterion;
+  bool _ignore_floating_point;
+
+  /// \brief Map from a variable to the statements defining it
+  std::unordered_map< Variable*, std::vector< Statement* > > _defs;
+
+  /// \brief Map from a variable to the comparisons using it
+  std::unordered_map< Variable*, std::vector< Statement* > > _comparisons;
+
+  /// \brief Statements in the slice
+  std::unordered_set< Statement* > _kept;
+
+  /// \brief Variables the slice depends on
+  std::unordered_set< Variable* > _needed;
+
+  /// \brief Statements in the slice whose operands are not processed yet
+  std::vector< Statement* > _worklist;
+
+public:
+  /// \brief Constructor
+  Slicing(const SlicingPass::Criterion& criterion, bool ignore_floating_point)
+      : _criterion(criterion), _ignore_floating_point(ignore_floating_point) {}
+
+  /// \brief Slice the given code
+  ///
+  /// Returns true if the code has been updated
+  bool run(Code* code) {
+    for (BasicBlock* bb : *code) {
+      for (Statement* stmt : *bb) {
+        if (stmt->has_result()) {
+          this->_defs[stmt->result()].push_back(stmt);
+        }
+        if (isa< Comparison >(stmt)) {
+          for (auto it = stmt->op_begin(), et = stmt->op_end(); it != et;
+               ++it) {
+            if (auto var = this->dependency(*it)) {
+              this->_comparisons[var].push_back(stmt);
+            }
+          }
+        }
+        if (has_side_effects(stmt) || this->_criterion(stmt)) {
+          this->keep(stmt);
+        }
+      }
+    }
+
+    while (!this->_worklist.empty()) {
+      Statement* stmt = this->_worklist.back();
+      this->_worklist.pop_back();
+
+      for (auto it = stmt->op_begin(), et = stmt->op_end(); it != et; ++it) {
+        if (auto var = this->dependency(*it)) {
+          this->need(var);
+        }
+      }
+    }
+
+    bool change = false;
+    for (BasicBlock* bb : *code) {
+      for (auto it = bb->begin(); it != bb->end();) {
+        if (this->_kept.count(*it) == 0) {
+          it = this->remove(bb, it);
+          change = true;
+        } else {
+          ++it;
+        }
+      }
+    }
+    return change;
+  }
+
+private:
+  /// \brief Return the variable an operand depends on, or null
+  Variable* dependency(Value* value) const {
+    auto var = dyn_cast< Variable >(value);
+    if (var == nullptr || isa< GlobalVariable >(var)) {
+      // Constants and global variables have no definition in the code
+      return nullptr;
+    }
+    if (this->_ignore_floating_point && is_floating_point(var->type())) {
+      return nullptr;
+    }
+    return var;
+  }
+
+  /// \brief Add the given statement to the slice
+  void keep(Statement* stmt) {
+    if (this->_kept.insert(stmt).second) {
+      this->_worklist.push_back(stmt);
+    }
+  }
+
+  /// \brief Add the definitions and comparisons of a variable to the slice
+  void need(Variable* var) {
+    if (!this->_needed.insert(var).second) {
+      return;
+    }
+
+    auto defs = this->_defs.find(var);
+    if (defs != this->_defs.end()) {
+      for (Statement* stmt : defs->second) {
+        this->keep(stmt);
+      }
+    }
+
+    auto comparisons = this->_comparisons.find(var);
+    if (comparisons != this->_comparisons.end()) {
+      for (Statement* stmt : comparisons->second) {
+        this->keep(stmt);
+      }
+    }
+  }
+
+  /// \brief Remove the statement at the given position
+  ///
+  /// Returns an iterator on the next statement
+  BasicBlock::StatementIterator remove(BasicBlock* bb,
+                                       BasicBlock::StatementIterator it) const {
+    auto pos = std::distance(bb->begin(), it);
+    bb->remove(it);
+    return std::next(bb->begin(), pos);
+  }
+
+}; // end class Slicing
+
+} // end anonymous namespace
+
+bool SlicingPass::run_on_code(Code* code) {
+  Slicing slicing(this->_criterion, this->_ignore_floating_point);
+  return slicing.run(code);
+}
+
+} // end namespace ar
+} // end namespace ikos
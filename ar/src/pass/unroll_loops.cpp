@@ -0,0 +1,541 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of UnrollLoopsPass
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <ikos/core/fixpoint/wto.hpp>
+
+#include <ikos/ar/pass/unroll_loops.hpp>
+#include <ikos/ar/semantic/code.hpp>
+#include <ikos/ar/semantic/statement.hpp>
+#include <ikos/ar/semantic/value.hpp>
+
+namespace ikos {
+namespace ar {
+
+const char* UnrollLoopsPass::name() const {
+  return "unroll-loops";
+}
+
+const char* UnrollLoopsPass::description() const {
+  return "Unroll loops with a small constant trip count";
+}
+
+namespace {
+
+/// \brief Return the predicate with swapped operands
+Comparison::Predicate mirror_predicate(Comparison::Predicate pred) {
+  switch (pred) {
+    case Comparison::UIGT:
+      return Comparison::UILT;
+    case Comparison::UIGE:
+      return Comparison::UILE;
+    case Comparison::UILT:
+      return Comparison::UIGT;
+    case Comparison::UILE:
+      return Comparison::UIGE;
+    case Comparison::SIGT:
+      return Comparison::SILT;
+    case Comparison::SIGE:
+      return Comparison::SILE;
+    case Comparison::SILT:
+      return Comparison::SIGT;
+    case Comparison::SILE:
+      return Comparison::SIGE;
+    default:
+      return pred;
+  }
+}
+
+/// \brief Evaluate an integer predicate on constants
+bool evaluate_predicate(Comparison::Predicate pred,
+                        const MachineInt& left,
+                        const MachineInt& right) {
+  switch (pred) {
+    case Comparison::UIEQ:
+    case Comparison::SIEQ:
+      return left == right;
+    case Comparison::UINE:
+    case Comparison::SINE:
+      return left != right;
+    case Comparison::UIGT:
+    case Comparison::SIGT:
+      return left > right;
+    case Comparison::UIGE:
+    case Comparison::SIGE:
+      return left >= right;
+    case Comparison::UILT:
+    case Comparison::SILT:
+      return left < right;
+    case Comparison::UILE:
+    case Comparison::SILE:
+      return left <= right;
+    default:
+      ikos_unreachable("unexpected predicate");
+  }
+}
+
+/// \brief Loop counter `%i = init; ...; %j = %i + step; %i = %j`
+struct LoopCounter {
+  // Counter, assigned before the loop and in the loop
+  InternalVariable* var;
+
+  // Initial value
+  MachineInt init;
+
+  // Value added at each iteration
+  MachineInt step;
+
+  // Variable holding the next value, or null
+  InternalVariable* next;
+};
+
+/// \brief Innermost loop
+struct Loop {
+  // Loop header
+  BasicBlock* head;
+
+  // Basic blocks of the loop, including the header
+  std::vector< BasicBlock* > blocks;
+};
+
+/// \brief Collect the innermost cycles of the control flow graph
+class InnermostLoopCollector : public core::WtoComponentVisitor< Code* > {
+private:
+  using WtoVertexT = core::WtoVertex< Code* >;
+  using WtoCycleT = core::WtoCycle< Code* >;
+
+private:
+  // Innermost loops
+  std::vector< Loop >& _loops;
+
+  // Basic blocks of the current cycle
+  std::vector< BasicBlock* > _blocks;
+
+  // True if the current cycle contains a cycle
+  bool _nested = false;
+
+public:
+  explicit InnermostLoopCollector(std::vector< Loop >& loops)
+      : _loops(loops) {}
+
+  void visit(const WtoVertexT& vertex) override {
+    this->_blocks.push_back(vertex.node());
+  }
+
+  void visit(const WtoCycleT& cycle) override {
+    std::vector< BasicBlock* > parent_blocks = std::move(this->_blocks);
+    this->_blocks.clear();
+    this->_blocks.push_back(cycle.head());
+    this->_nested = false;
+
+    for (auto it = cycle.begin(), et = cycle.end(); it != et; ++it) {
+      it->accept(*this);
+    }
+
+    if (!this->_nested) {
+      this->_loops.push_back(Loop{cycle.head(), this->_blocks});
+    }
+
+    // The enclosing cycle is not an innermost cycle
+    this->_blocks.insert(this->_blocks.end(),
+                         parent_blocks.begin(),
+                         parent_blocks.end());
+    this->_nested = true;
+  }
+
+}; // end class InnermostLoopCollector
+
+/// \brief Unroll an innermost loop
+class LoopUnroller {
+private:
+  // Code
+  Code* _code;
+
+  // Loop
+  const Loop& _loop;
+
+  // Basic blocks of the loop
+  std::unordered_set< BasicBlock* > _blocks;
+
+public:
+  LoopUnroller(Code* code, const Loop& loop)
+      : _code(code),
+        _loop(loop),
+        _blocks(loop.blocks.begin(), loop.blocks.end()) {}
+
+  /// \brief Return true if the loop can be copied
+  bool is_supported() const {
+    if (this->_loop.head == this->_code->entry_block() ||
+        (this->_code->has_exit_block() &&
+         this->_blocks.count(this->_code->exit_block()) != 0) ||
+        (this->_code->has_unreachable_block() &&
+         this->_blocks.count(this->_code->unreachable_block()) != 0) ||
+        (this->_code->has_ehresume_block() &&
+         this->_blocks.count(this->_code->ehresume_block()) != 0)) {
+      return false;
+    }
+
+    for (BasicBlock* bb : this->_loop.blocks) {
+      // The header must be the only entry of the loop
+      if (bb != this->_loop.head) {
+        for (auto it = bb->predecessor_begin(), et = bb->predecessor_end();
+             it != et;
+             ++it) {
+          if (!this->contains(*it)) {
+            return false;
+          }
+        }
+      }
+
+      // Invoke statements refer to basic blocks
+      for (Statement* stmt : *bb) {
+        if (isa< Invoke >(stmt)) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  /// \brief Return the number of statements in the loop
+  std::size_t num_statements() const {
+    std::size_t n = 0;
+    for (BasicBlock* bb : this->_loop.blocks) {
+      n += bb->num_statements();
+    }
+    return n;
+  }
+
+  /// \brief Return an upper bound of the trip count, if it is at most `max`
+  boost::optional< std::size_t > trip_count(std::size_t max) const {
+    for (BasicBlock* bb : this->_loop.blocks) {
+      if (bb == this->_loop.head || bb->empty() ||
+          !isa< Comparison >(bb->front()) || !this->is_guard(bb)) {
+        continue;
+      }
+
+      auto cmp = cast< Comparison >(bb->front());
+      if (!cmp->is_integer_predicate()) {
+        continue;
+      }
+
+      // Normalize to `%x pred cst`
+      Comparison::Predicate pred = cmp->predicate();
+      Value* left = cmp->left();
+      Value* right = cmp->right();
+      if (isa< IntegerConstant >(left)) {
+        std::swap(left, right);
+        pred = mirror_predicate(pred);
+      }
+      auto var = dyn_cast< InternalVariable >(left);
+      auto bound = dyn_cast< IntegerConstant >(right);
+      if (var == nullptr || bound == nullptr) {
+        continue;
+      }
+
+      boost::optional< LoopCounter > counter = this->counter(var);
+      if (!counter) {
+        continue;
+      }
+
+      // Simulate the counter until the guard fails
+      MachineInt value = counter->init;
+      if (counter->next == var) {
+        value = add(value, counter->step);
+      }
+      for (std::size_t n = 0; n < max; n++) {
+        if (!evaluate_predicate(pred, value, bound->value())) {
+          // One more copy, in case the guard is checked after the body
+          return n + 1;
+        }
+        value = add(value, counter->step);
+      }
+    }
+
+    return boost::none;
+  }
+
+  /// \brief Peel `n` iterations of the loop
+  void peel(std::size_t n) {
+    BasicBlock* head = this->_loop.head;
+
+    // Edges entering the next copy of the loop
+    std::vector< BasicBlock* > entries;
+    for (auto it = head->predecessor_begin(), et = head->predecessor_end();
+         it != et;
+         ++it) {
+      if (!this->contains(*it)) {
+        entries.push_back(*it);
+      }
+    }
+
+    for (std::size_t i = 0; i < n; i++) {
+      std::unordered_map< BasicBlock*, BasicBlock* > copies;
+      for (BasicBlock* bb : this->_loop.blocks) {
+        BasicBlock* copy = BasicBlock::create(this->_code);
+        for (Statement* stmt : *bb) {
+          copy->push_back(stmt->clone());
+        }
+        copies.emplace(bb, copy);
+      }
+
+      std::vector< BasicBlock* > latches;
+      for (BasicBlock* bb : this->_loop.blocks) {
+        BasicBlock* copy = copies.at(bb);
+        for (auto it = bb->successor_begin(), et = bb->successor_end();
+             it != et;
+             ++it) {
+          BasicBlock* succ = *it;
+          if (succ == head) {
+            // Back edge, enters the next copy
+            copy->add_successor(head);
+            latches.push_back(copy);
+          } else if (this->contains(succ)) {
+            copy->add_successor(copies.at(succ));
+          } else {
+            copy->add_successor(succ);
+          }
+        }
+      }
+
+      for (BasicBlock* entry : entries) {
+        entry->remove_successor(head);
+        entry->add_successor(copies.at(head));
+      }
+      entries = std::move(latches);
+    }
+  }
+
+private:
+  /// \brief Return true if the loop contains the given basic block
+  bool contains(BasicBlock* bb) const { return this->_blocks.count(bb) != 0; }
+
+  /// \brief Return true if the basic block is the guard of an exit edge
+  bool is_guard(BasicBlock* bb) const {
+    for (auto it = bb->predecessor_begin(), et = bb->predecessor_end();
+         it != et;
+         ++it) {
+      BasicBlock* pred = *it;
+      if (this->contains(pred) &&
+          std::any_of(pred->successor_begin(),
+                      pred->successor_end(),
+                      [this](BasicBlock* succ) {
+                        return !this->contains(succ);
+                      })) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// \brief Return the constant assigned to `var` by the last assignment of
+  /// `var` in the given basic block
+  boost::optional< MachineInt > last_constant_assignment(
+      BasicBlock* bb, InternalVariable* var) const {
+    for (auto it = bb->rbegin(), et = bb->rend(); it != et; ++it) {
+      Statement* stmt = *it;
+      if (stmt->result_or_null() != var) {
+        continue;
+      }
+      if (auto assign = dyn_cast< Assignment >(stmt)) {
+        if (auto cst = dyn_cast< IntegerConstant >(assign->operand())) {
+          return cst->value();
+        }
+      }
+      return boost::none;
+    }
+    return boost::none;
+  }
+
+  /// \brief Return the definitions of `var` in the loop
+  std::vector< Statement* > definitions(InternalVariable* var) const {
+    std::vector< Statement* > defs;
+    for (BasicBlock* bb : this->_loop.blocks) {
+      for (Statement* stmt : *bb) {
+        if (stmt->result_or_null() == var) {
+          defs.push_back(stmt);
+        }
+      }
+    }
+    return defs;
+  }
+
+  /// \brief Match `%var = %i + cst` or `%var = %i - cst`
+  ///
+  /// Returns the variable `%i` and the step
+  boost::optional< std::pair< InternalVariable*, MachineInt > > match_step(
+      Statement* stmt) const {
+    auto bin = dyn_cast< BinaryOperation >(stmt);
+    if (bin == nullptr) {
+      return boost::none;
+    }
+    auto var = dyn_cast< InternalVariable >(bin->left());
+    auto cst = dyn_cast< IntegerConstant >(bin->right());
+    if (var == nullptr || cst == nullptr) {
+      return boost::none;
+    }
+
+    switch (bin->op()) {
+      case BinaryOperation::UAdd:
+      case BinaryOperation::SAdd:
+        return std::make_pair(var, cst->value());
+      case BinaryOperation::USub:
+      case BinaryOperation::SSub:
+        return std::make_pair(var, -cst->value());
+      default:
+        return boost::none;
+    }
+  }
+
+  /// \brief Return the loop counter compared in the guard `%x pred cst`
+  ///
+  /// `%x` is either the counter itself or its next value.
+  boost::optional< LoopCounter > counter(InternalVariable* x) const {
+    std::vector< Statement* > defs = this->definitions(x);
+    if (defs.size() != 1) {
+      return boost::none;
+    }
+
+    InternalVariable* var = nullptr;
+    InternalVariable* next = nullptr;
+    boost::optional< std::pair< InternalVariable*, MachineInt > > step;
+
+    if (auto assign = dyn_cast< Assignment >(defs[0])) {
+      // %x = %next, %next = %x + cst
+      var = x;
+      next = dyn_cast_or_null< InternalVariable >(assign->operand());
+      if (next == nullptr) {
+        return boost::none;
+      }
+      std::vector< Statement* > next_defs = this->definitions(next);
+      if (next_defs.size() != 1) {
+        return boost::none;
+      }
+      step = this->match_step(next_defs[0]);
+    } else if ((step = this->match_step(defs[0]))) {
+      if (step->first == x) {
+        // %x = %x + cst
+        var = x;
+      } else {
+        // %x = %i + cst, %i = %x
+        var = step->first;
+        next = x;
+        std::vector< Statement* > var_defs = this->definitions(var);
+        if (var_defs.size() != 1 || !isa< Assignment >(var_defs[0]) ||
+            cast< Assignment >(var_defs[0])->operand() != next) {
+          return boost::none;
+        }
+      }
+    }
+
+    if (var == nullptr || !step || step->first != var) {
+      return boost::none;
+    }
+
+    // The counter has the same constant value on all entries of the loop
+    boost::optional< MachineInt > init;
+    BasicBlock* head = this->_loop.head;
+    for (auto it = head->predecessor_begin(), et = head->predecessor_end();
+         it != et;
+         ++it) {
+      if (this->contains(*it)) {
+        continue;
+      }
+      boost::optional< MachineInt > value =
+          this->last_constant_assignment(*it, var);
+      if (!value || (init && *init != *value)) {
+        return boost::none;
+      }
+      init = value;
+    }
+
+    if (!init) {
+      return boost::none;
+    }
+    return LoopCounter{var, *init, step->second, next};
+  }
+
+}; // end class LoopUnroller
+
+} // end anonymous namespace
+
+bool UnrollLoopsPass::run_on_code(Code* code) {
+  if (this->_max_trip_count == 0) {
+    return false;
+  }
+
+  std::vector< Loop > loops;
+  {
+    core::Wto< Code* > wto(code);
+    InnermostLoopCollector collector(loops);
+    wto.accept(collector);
+  }
+
+  bool change = false;
+  for (const Loop& loop : loops) {
+    LoopUnroller unroller(code, loop);
+    if (!unroller.is_supported()) {
+      continue;
+    }
+
+    boost::optional< std::size_t > n =
+        unroller.trip_count(this->_max_trip_count);
+    if (!n || *n * unroller.num_statements() > MaxUnrolledStatements) {
+      continue;
+    }
+
+    unroller.peel(*n);
+    change = true;
+  }
+  return change;
+}
+
+} // end namespace ar
+} // end namespace ikos
@@ -41,6 +41,9 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
+#include <limits>
+
 #include <ikos/ar/semantic/bundle.hpp>
 #include <ikos/ar/semantic/code.hpp>
 #include <ikos/ar/semantic/function.hpp>
@@ -53,7 +56,9 @@ namespace ar {
 // BasicBlock
 
 BasicBlock::BasicBlock(Code* code) : _parent(code) {
+  code->invalidate_graph();
   ikos_assert_msg(code, "code is null");
+  this->_index = code->_num_block_indices++;
 }
 
 BasicBlock::~BasicBlock() = default;
@@ -112,6 +117,15 @@ void BasicBlock::clear_statements() {
   this->_statements.clear();
 }
 
+void BasicBlock::relayout(std::vector< std::unique_ptr< Statement > >& old) {
+  for (std::unique_ptr< Statement >& stmt : this->_statements) {
+    std::unique_ptr< Statement > copy = stmt->clone();
+    copy->set_parent(this);
+    old.emplace_back(std::move(stmt));
+    stmt = std::move(copy);
+  }
+}
+
 bool BasicBlock::is_successor(BasicBlock* bb) const {
   return std::find(this->_successors.begin(), this->_successors.end(), bb) !=
          this->_successors.end();
@@ -124,6 +138,7 @@ bool BasicBlock::is_predecessor(BasicBlock* bb) const {
 }
 
 void BasicBlock::add_successor(BasicBlock* bb) {
+  this->_parent->invalidate_graph();
   if (!this->is_successor(bb)) {
     this->_successors.push_back(bb);
     bb->_predecessors.push_back(this);
@@ -131,6 +146,7 @@ void BasicBlock::add_successor(BasicBlock* bb) {
 }
 
 void BasicBlock::add_predecessor(BasicBlock* bb) {
+  this->_parent->invalidate_graph();
   if (!this->is_predecessor(bb)) {
     this->_predecessors.push_back(bb);
     bb->_successors.push_back(this);
@@ -138,6 +154,7 @@ void BasicBlock::add_predecessor(BasicBlock* bb) {
 }
 
 void BasicBlock::remove_successor(BasicBlock* bb) {
+  this->_parent->invalidate_graph();
   if (this->is_successor(bb)) {
     this->_successors.erase(std::remove(this->_successors.begin(),
                                         this->_successors.end(),
@@ -151,6 +168,7 @@ void BasicBlock::remove_successor(BasicBlock* bb) {
 }
 
 void BasicBlock::clear_successors() {
+  this->_parent->invalidate_graph();
   // Remove this from predecessors of our successors
   for (BasicBlock* succ : this->_successors) {
     succ->_predecessors.erase(std::remove(succ->_predecessors.begin(),
@@ -163,6 +181,7 @@ void BasicBlock::clear_successors() {
 }
 
 void BasicBlock::remove_predecessor(BasicBlock* bb) {
+  this->_parent->invalidate_graph();
   if (this->is_predecessor(bb)) {
     this->_predecessors.erase(std::remove(this->_predecessors.begin(),
                                           this->_predecessors.end(),
@@ -176,6 +195,7 @@ void BasicBlock::remove_predecessor(BasicBlock* bb) {
 }
 
 void BasicBlock::clear_predecessors() {
+  this->_parent->invalidate_graph();
   // Remove this from successors of our predecessors
   for (BasicBlock* pred : this->_predecessors) {
     pred->_successors.erase(std::remove(pred->_successors.begin(),
@@ -250,7 +270,8 @@ Code::Code(Function* function)
       _ehresume_block(nullptr),
       _function(function),
       _global_var(nullptr),
-      _bundle(function->bundle()) {
+      _bundle(function->bundle()),
+      _num_block_indices(0) {
   ikos_assert_msg(function, "function is null");
 }
 
@@ -261,7 +282,8 @@ Code::Code(GlobalVariable* gv)
       _ehresume_block(nullptr),
       _function(nullptr),
       _global_var(gv),
-      _bundle(gv->bundle()) {
+      _bundle(gv->bundle()),
+      _num_block_indices(0) {
   ikos_assert_msg(gv, "gv is null");
 }
 
@@ -307,9 +329,61 @@ void Code::erase_basic_block(BasicBlock* bb) {
                       this->_blocks.end());
 }
 
+void Code::freeze_graph() {
+  this->_graph = std::make_unique< const CodeGraph >(this);
+}
+
+void Code::relayout() {
+  // Keep the previous statements alive until all the copies are allocated,
+  // so that the copies do not reuse their scattered memory
+  std::vector< std::unique_ptr< Statement > > old;
+  for (const std::unique_ptr< BasicBlock >& bb : this->_blocks) {
+    bb->relayout(old);
+  }
+}
+
 void Code::add_internal_variable(std::unique_ptr< InternalVariable > iv) {
   this->_internal_vars.emplace_back(std::move(iv));
 }
 
+// CodeGraph
+
+CodeGraph::CodeGraph(Code* code)
+    : _code(code), _entry(code->entry_block()) {
+  std::size_t num_indices = code->num_block_indices();
+  this->_succ_offsets.assign(num_indices + 1, 0);
+  this->_pred_offsets.assign(num_indices + 1, 0);
+
+  // Count the edges of each basic block
+  std::size_t num_edges = 0;
+  for (BasicBlock* bb : *code) {
+    this->_succ_offsets[bb->index() + 1] =
+        static_cast< std::uint32_t >(bb->num_successors());
+    this->_pred_offsets[bb->index() + 1] =
+        static_cast< std::uint32_t >(bb->num_predecessors());
+    num_edges += bb->num_successors();
+  }
+  ikos_assert_msg(num_edges <= std::numeric_limits< std::uint32_t >::max(),
+                  "too many edges");
+  for (std::size_t i = 0; i < num_indices; i++) {
+    this->_succ_offsets[i + 1] += this->_succ_offsets[i];
+    this->_pred_offsets[i + 1] += this->_pred_offsets[i];
+  }
+
+  // Copy the edges, in the same order as the basic blocks
+  this->_successors.resize(num_edges);
+  this->_predecessors.resize(num_edges);
+  for (BasicBlock* bb : *code) {
+    std::copy(bb->successor_begin(),
+              bb->successor_end(),
+              this->_successors.begin() + this->_succ_offsets[bb->index()]);
+    std::copy(bb->predecessor_begin(),
+              bb->predecessor_end(),
+              this->_predecessors.begin() + this->_pred_offsets[bb->index()]);
+  }
+}
+
+CodeGraph::~CodeGraph() = default;
+
 } // end namespace ar
 } // end namespace ikos
@@ -52,5 +52,9 @@ Context::Context() : _impl(std::make_unique< ContextImpl >()) {}
 
 Context::~Context() = default;
 
+std::size_t Context::num_constants() const {
+  return this->_impl->num_constants();
+}
+
 } // end namespace ar
 } // end namespace ikos
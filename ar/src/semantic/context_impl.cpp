@@ -76,6 +76,7 @@ void ContextImpl::add_bundle(std::unique_ptr< Bundle > bundle) {
 }
 
 IntegerType* ContextImpl::integer_type(unsigned bit_width, Signedness sign) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_integer_types.find(std::make_pair(bit_width, sign));
   if (it == this->_integer_types.end()) {
     auto type = new IntegerType(bit_width, sign);
@@ -88,6 +89,7 @@ IntegerType* ContextImpl::integer_type(unsigned bit_width, Signedness sign) {
 }
 
 PointerType* ContextImpl::pointer_type(Type* pointee) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_pointer_types.find(pointee);
   if (it == this->_pointer_types.end()) {
     auto type = new PointerType(pointee);
@@ -99,6 +101,7 @@ PointerType* ContextImpl::pointer_type(Type* pointee) {
 }
 
 ArrayType* ContextImpl::array_type(Type* element_type, ZNumber num_element) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_array_types.find(std::make_pair(element_type, num_element));
   if (it == this->_array_types.end()) {
     auto type = new ArrayType(element_type, num_element);
@@ -111,6 +114,7 @@ ArrayType* ContextImpl::array_type(Type* element_type, ZNumber num_element) {
 }
 
 VectorType* ContextImpl::vector_type(Type* element_type, ZNumber num_element) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_vector_types.find(std::make_pair(element_type, num_element));
   if (it == this->_vector_types.end()) {
     auto type = new VectorType(element_type, num_element);
@@ -126,6 +130,7 @@ FunctionType* ContextImpl::function_type(
     Type* return_type,
     const FunctionType::ParamTypes& param_types,
     bool is_var_arg) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_function_types.find(
       std::make_tuple(return_type, param_types, is_var_arg));
   if (it == this->_function_types.end()) {
@@ -141,136 +146,142 @@ FunctionType* ContextImpl::function_type(
 }
 
 void ContextImpl::add_type(std::unique_ptr< Type > type) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   this->_types.emplace_back(std::move(type));
 }
 
 UndefinedConstant* ContextImpl::undefined_cst(Type* type) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_undefined_constants.find(type);
   if (it == this->_undefined_constants.end()) {
-    auto cst = new UndefinedConstant(type);
-    this->_undefined_constants.emplace(type,
-                                       std::unique_ptr< UndefinedConstant >(
-                                           cst));
+    auto cst = this->new_constant< UndefinedConstant >(type);
+    this->_undefined_constants.emplace(type, cst);
     return cst;
   } else {
-    return it->second.get();
+    return it->second;
   }
 }
 
 IntegerConstant* ContextImpl::integer_cst(IntegerType* type, MachineInt value) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_integer_constants.find(std::make_pair(type, value));
   if (it == this->_integer_constants.end()) {
-    auto cst = new IntegerConstant(type, value);
-    this->_integer_constants.emplace(std::make_pair(type, value),
-                                     std::unique_ptr< IntegerConstant >(cst));
+    auto cst = this->new_constant< IntegerConstant >(type, value);
+    this->_integer_constants.emplace(std::make_pair(type, value), cst);
     return cst;
   } else {
-    return it->second.get();
+    return it->second;
   }
 }
 
 FloatConstant* ContextImpl::float_cst(FloatType* type,
                                       const std::string& value) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_float_constants.find(std::make_pair(type, value));
   if (it == this->_float_constants.end()) {
-    auto cst = new FloatConstant(type, value);
-    this->_float_constants.emplace(std::make_pair(type, value),
-                                   std::unique_ptr< FloatConstant >(cst));
+    auto cst = this->new_constant< FloatConstant >(type, value);
+    this->_float_constants.emplace(std::make_pair(type, value), cst);
     return cst;
   } else {
-    return it->second.get();
+    return it->second;
   }
 }
 
 NullConstant* ContextImpl::null_cst(PointerType* type) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_null_constants.find(type);
   if (it == this->_null_constants.end()) {
-    auto cst = new NullConstant(type);
-    this->_null_constants.emplace(type, std::unique_ptr< NullConstant >(cst));
+    auto cst = this->new_constant< NullConstant >(type);
+    this->_null_constants.emplace(type, cst);
     return cst;
   } else {
-    return it->second.get();
+    return it->second;
   }
 }
 
 StructConstant* ContextImpl::struct_cst(StructType* type,
                                         const StructConstant::Values& values) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_struct_constants.find(std::make_pair(type, values));
   if (it == this->_struct_constants.end()) {
-    auto cst = new StructConstant(type, values);
-    this->_struct_constants.emplace(std::make_pair(type, values),
-                                    std::unique_ptr< StructConstant >(cst));
+    auto cst = this->new_constant< StructConstant >(type, values);
+    this->_struct_constants.emplace(std::make_pair(type, values), cst);
     return cst;
   } else {
-    return it->second.get();
+    return it->second;
   }
 }
 
 ArrayConstant* ContextImpl::array_cst(ArrayType* type,
                                       const ArrayConstant::Values& values) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_array_constants.find(std::make_pair(type, values));
   if (it == this->_array_constants.end()) {
-    auto cst = new ArrayConstant(type, values);
-    this->_array_constants.emplace(std::make_pair(type, values),
-                                   std::unique_ptr< ArrayConstant >(cst));
+    auto cst = this->new_constant< ArrayConstant >(type, values);
+    this->_array_constants.emplace(std::make_pair(type, values), cst);
     return cst;
   } else {
-    return it->second.get();
+    return it->second;
   }
 }
 
 VectorConstant* ContextImpl::vector_cst(VectorType* type,
                                         const VectorConstant::Values& values) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_vector_constants.find(std::make_pair(type, values));
   if (it == this->_vector_constants.end()) {
-    auto cst = new VectorConstant(type, values);
-    this->_vector_constants.emplace(std::make_pair(type, values),
-                                    std::unique_ptr< VectorConstant >(cst));
+    auto cst = this->new_constant< VectorConstant >(type, values);
+    this->_vector_constants.emplace(std::make_pair(type, values), cst);
     return cst;
   } else {
-    return it->second.get();
+    return it->second;
   }
 }
 
 AggregateZeroConstant* ContextImpl::aggregate_zero_cst(AggregateType* type) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_aggregate_zero_constants.find(type);
   if (it == this->_aggregate_zero_constants.end()) {
-    auto cst = new AggregateZeroConstant(type);
-    this->_aggregate_zero_constants
-        .emplace(type, std::unique_ptr< AggregateZeroConstant >(cst));
+    auto cst = this->new_constant< AggregateZeroConstant >(type);
+    this->_aggregate_zero_constants.emplace(type, cst);
     return cst;
   } else {
-    return it->second.get();
+    return it->second;
   }
 }
 
 FunctionPointerConstant* ContextImpl::function_pointer_cst(Function* function) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_function_pointer_constants.find(function);
   if (it == this->_function_pointer_constants.end()) {
     ikos_assert_msg(function, "function is null");
     PointerType* fun_ptr_type = this->pointer_type(function->type());
-    auto cst = new FunctionPointerConstant(fun_ptr_type, function);
-    this->_function_pointer_constants
-        .emplace(function, std::unique_ptr< FunctionPointerConstant >(cst));
+    auto cst =
+        this->new_constant< FunctionPointerConstant >(fun_ptr_type, function);
+    this->_function_pointer_constants.emplace(function, cst);
     return cst;
   } else {
-    return it->second.get();
+    return it->second;
   }
 }
 
 InlineAssemblyConstant* ContextImpl::inline_assembly_cst(
     PointerType* type, const std::string& code) {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
   auto it = this->_inline_assembly_constants.find(std::make_pair(type, code));
   if (it == this->_inline_assembly_constants.end()) {
-    auto cst = new InlineAssemblyConstant(type, code);
-    this->_inline_assembly_constants
-        .emplace(std::make_pair(type, code),
-                 std::unique_ptr< InlineAssemblyConstant >(cst));
+    auto cst = this->new_constant< InlineAssemblyConstant >(type, code);
+    this->_inline_assembly_constants.emplace(std::make_pair(type, code), cst);
     return cst;
   } else {
-    return it->second.get();
+    return it->second;
   }
 }
 
+std::size_t ContextImpl::num_constants() {
+  std::lock_guard< std::recursive_mutex > lock(this->_mutex);
+  return this->_num_constants;
+}
+
 } // end namespace ar
 } // end namespace ikos
@@ -44,21 +44,45 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
-#include <boost/container/flat_map.hpp>
+#include <boost/functional/hash.hpp>
 
 #include <ikos/ar/semantic/bundle.hpp>
 #include <ikos/ar/semantic/type.hpp>
 #include <ikos/ar/semantic/value.hpp>
+#include <ikos/ar/support/arena.hpp>
 
 namespace ikos {
 namespace ar {
 
 class ContextImpl {
 private:
+  /// \brief Hash function for the keys of the uniquing tables
+  struct KeyHash {
+    template < typename T >
+    std::size_t operator()(const T& key) const {
+      return boost::hash< T >()(key);
+    }
+
+    std::size_t operator()(
+        const std::pair< StructType*, StructConstant::Values >& key) const {
+      std::size_t hash = boost::hash_value(key.first);
+      boost::hash_range(hash, key.second.begin(), key.second.end());
+      return hash;
+    }
+  };
+
+private:
+  // Mutex protecting the get-or-create operations
+  //
+  // This allows several analysis threads to create types and constants
+  std::recursive_mutex _mutex;
+
   // List of owned bundles
   std::vector< std::unique_ptr< Bundle > > _bundles;
 
@@ -91,81 +115,101 @@ private:
   OpaqueType _libc_file_ty;
 
   // Integer types
-  boost::container::flat_map< std::pair< unsigned, Signedness >,
-                              std::unique_ptr< IntegerType > >
+  std::unordered_map< std::pair< unsigned, Signedness >,
+                      std::unique_ptr< IntegerType >,
+                      KeyHash >
       _integer_types;
 
   // Pointer types
-  boost::container::flat_map< Type*, std::unique_ptr< PointerType > >
-      _pointer_types;
+  std::unordered_map< Type*, std::unique_ptr< PointerType > > _pointer_types;
 
   // Array types
-  boost::container::flat_map< std::pair< Type*, ZNumber >,
-                              std::unique_ptr< ArrayType > >
+  std::unordered_map< std::pair< Type*, ZNumber >,
+                      std::unique_ptr< ArrayType >,
+                      KeyHash >
       _array_types;
 
   // Vector types
-  boost::container::flat_map< std::pair< Type*, ZNumber >,
-                              std::unique_ptr< VectorType > >
+  std::unordered_map< std::pair< Type*, ZNumber >,
+                      std::unique_ptr< VectorType >,
+                      KeyHash >
       _vector_types;
 
   // Function types
-  boost::container::flat_map<
-      std::tuple< Type*, FunctionType::ParamTypes, bool >,
-      std::unique_ptr< FunctionType > >
+  std::unordered_map< std::tuple< Type*, FunctionType::ParamTypes, bool >,
+                      std::unique_ptr< FunctionType >,
+                      KeyHash >
       _function_types;
 
   // Other types (struct and opaque)
   std::vector< std::unique_ptr< Type > > _types;
 
+  // Memory of the constants
+  Arena _constants_arena;
+
+  // Number of constants
+  std::size_t _num_constants = 0;
+
   // Undefined constants
-  boost::container::flat_map< Type*, std::unique_ptr< UndefinedConstant > >
-      _undefined_constants;
+  std::unordered_map< Type*, UndefinedConstant* > _undefined_constants;
 
   // Integer constants
-  boost::container::flat_map< std::pair< IntegerType*, MachineInt >,
-                              std::unique_ptr< IntegerConstant > >
+  std::unordered_map< std::pair< IntegerType*, MachineInt >,
+                      IntegerConstant*,
+                      KeyHash >
       _integer_constants;
 
   // Float constants
-  boost::container::flat_map< std::pair< FloatType*, std::string >,
-                              std::unique_ptr< FloatConstant > >
+  std::unordered_map< std::pair< FloatType*, std::string >,
+                      FloatConstant*,
+                      KeyHash >
       _float_constants;
 
   // Null constants
-  boost::container::flat_map< PointerType*, std::unique_ptr< NullConstant > >
-      _null_constants;
+  std::unordered_map< PointerType*, NullConstant* > _null_constants;
 
   // Structure constants
-  boost::container::flat_map< std::pair< StructType*, StructConstant::Values >,
-                              std::unique_ptr< StructConstant > >
+  std::unordered_map< std::pair< StructType*, StructConstant::Values >,
+                      StructConstant*,
+                      KeyHash >
       _struct_constants;
 
   // Array constants
-  boost::container::flat_map< std::pair< ArrayType*, ArrayConstant::Values >,
-                              std::unique_ptr< ArrayConstant > >
+  std::unordered_map< std::pair< ArrayType*, ArrayConstant::Values >,
+                      ArrayConstant*,
+                      KeyHash >
       _array_constants;
 
   // Vector constants
-  boost::container::flat_map< std::pair< VectorType*, VectorConstant::Values >,
-                              std::unique_ptr< VectorConstant > >
+  std::unordered_map< std::pair< VectorType*, VectorConstant::Values >,
+                      VectorConstant*,
+                      KeyHash >
       _vector_constants;
 
   // Aggregate zero constants
-  boost::container::flat_map< AggregateType*,
-                              std::unique_ptr< AggregateZeroConstant > >
+  std::unordered_map< AggregateType*, AggregateZeroConstant* >
       _aggregate_zero_constants;
 
   // Function pointer constants
-  boost::container::flat_map< Function*,
-                              std::unique_ptr< FunctionPointerConstant > >
+  std::unordered_map< Function*, FunctionPointerConstant* >
       _function_pointer_constants;
 
   // Inline assembly constants
-  boost::container::flat_map< std::pair< PointerType*, std::string >,
-                              std::unique_ptr< InlineAssemblyConstant > >
+  std::unordered_map< std::pair< PointerType*, std::string >,
+                      InlineAssemblyConstant*,
+                      KeyHash >
       _inline_assembly_constants;
 
+private:
+  /// \brief Allocate a constant in the arena
+  template < typename T, typename... Args >
+  T* new_constant(Args&&... args) {
+    void* ptr = this->_constants_arena.allocate< T >();
+    this->_num_constants++;
+    return this->_constants_arena.own(new (ptr)
+                                          T(std::forward< Args >(args)...));
+  }
+
 public:
   /// \brief Default constructor
   ContextImpl();
@@ -270,6 +314,9 @@ public:
   InlineAssemblyConstant* inline_assembly_cst(PointerType* type,
                                               const std::string& code);
 
+  /// \brief Return the number of constants
+  std::size_t num_constants();
+
 }; // end class ContextImpl
 
 } // end namespace ar
@@ -45,6 +45,8 @@
 #include <ikos/ar/semantic/statement.hpp>
 #include <ikos/ar/verify/frontend.hpp>
 
+#include "parallel.hpp"
+
 namespace ikos {
 namespace ar {
 
@@ -57,7 +59,13 @@ namespace ar {
 // and with the second pattern, the compiler will remove the call to f() if
 // valid is false because of short-circuiting.
 
-bool FrontendVerifier::verify(Bundle* bundle, std::ostream& err) const {
+bool FrontendVerifier::verify(Bundle* bundle,
+                              std::ostream& err,
+                              unsigned jobs) const {
+  if (jobs > 1) {
+    return verify_parallel(*this, bundle, err, this->_all, jobs);
+  }
+
   bool valid = true;
   for (auto it = bundle->global_begin(), et = bundle->global_end();
        it != et && (this->_all || valid);
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Run a verifier on the functions of a bundle in parallel
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ikos/ar/semantic/bundle.hpp>
+#include <ikos/ar/semantic/function.hpp>
+#include <ikos/ar/semantic/value.hpp>
+
+namespace ikos {
+namespace ar {
+
+/// \brief Run a verifier on all the global variables and functions of a
+/// bundle, using `jobs` threads
+///
+/// The errors of each global variable and function are buffered, and written
+/// to `err` in the order of the bundle, so that the output does not depend on
+/// the number of threads.
+///
+/// \param verifier The verifier, with `verify(GlobalVariable*, std::ostream&)`
+/// and `verify(Function*, std::ostream&)` methods
+/// \param all Find all errors, do not stop at the first one
+template < typename Verifier >
+bool verify_parallel(const Verifier& verifier,
+                     Bundle* bundle,
+                     std::ostream& err,
+                     bool all,
+                     unsigned jobs) {
+  std::vector< GlobalVariable* > globals(bundle->global_begin(),
+                                         bundle->global_end());
+  std::vector< Function* > functions(bundle->function_begin(),
+                                     bundle->function_end());
+  std::size_t size = globals.size() + functions.size();
+
+  // Result of each global variable, then each function. The validity is
+  // stored as a char, since std::vector< bool > cannot be written
+  // concurrently.
+  std::vector< std::string > errors(size);
+  std::vector< char > valid(size, 1);
+
+  std::atomic< std::size_t > next(0);
+  std::atomic< bool > failed(false);
+  std::exception_ptr error = nullptr;
+  std::mutex error_mutex;
+
+  auto worker = [&]() {
+    while (all || !failed) {
+      std::size_t i = next++;
+      if (i >= size) {
+        return;
+      }
+      try {
+        std::ostringstream buf;
+        if (i < globals.size()) {
+          valid[i] = verifier.verify(globals[i], buf);
+        } else {
+          valid[i] = verifier.verify(functions[i - globals.size()], buf);
+        }
+        errors[i] = buf.str();
+        if (!valid[i]) {
+          failed = true;
+        }
+      } catch (...) {
+        std::lock_guard< std::mutex > lock(error_mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        next = size;
+        return;
+      }
+    }
+  };
+
+  auto n = std::max(std::min(static_cast< std::size_t >(jobs), size),
+                    static_cast< std::size_t >(1));
+  std::vector< std::thread > threads;
+  threads.reserve(n);
+  for (std::size_t i = 0; i < n; i++) {
+    threads.emplace_back(worker);
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  // Report the errors in order. Without `all`, only the first invalid item
+  // is reported, as in a sequential run.
+  bool result = true;
+  std::size_t done = std::min(next.load(), size);
+  for (std::size_t i = 0; i < done; i++) {
+    err << errors[i];
+    result = valid[i] && result;
+    if (!all && !result) {
+      break;
+    }
+  }
+  return result;
+}
+
+} // end namespace ar
+} // end namespace ikos
@@ -0,0 +1,741 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Map with dense indexes, stored in copy-on-write chunks
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <ikos/core/semantic/dumpable.hpp>
+#include <ikos/core/semantic/indexable.hpp>
+#include <ikos/core/support/assert.hpp>
+#include <ikos/core/support/compiler.hpp>
+
+namespace ikos {
+namespace core {
+
+namespace dense_map_impl {
+
+template < typename Key >
+inline Index dense_index(const Key& key, std::true_type /*dense*/) {
+  return DenseIndexableTraits< Key >::dense_index(key);
+}
+
+template < typename Key >
+inline Index dense_index(const Key& /*key*/, std::false_type /*dense*/) {
+  ikos_unreachable("Key must implement DenseIndexableTraits");
+}
+
+/// \brief Return a new chunk identifier, never 0
+inline std::uint64_t new_chunk_id() {
+  static std::atomic< std::uint64_t > next(1);
+  return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // end namespace dense_map_impl
+
+/// \brief Map from keys with dense indexes to values
+///
+/// Elements are stored in arrays of ChunkSize slots, indexed by the dense
+/// index of the key (see DenseIndexableTraits). Chunks are shared between
+/// copies of a map, and copied on the first write. Binary operations skip
+/// the chunks shared by both sides.
+///
+/// A chunk copied on write remembers the chunk it was copied from (its base)
+/// and the slots written since (its dirty slots). When both sides of a binary
+/// operation derive from the same base, only the dirty slots are visited: at a
+/// loop head, the widening and the inclusion test of two successive
+/// invariants only look at the keys written by the loop body. Binary
+/// operations assume that `combine(v, v) == v` and `cmp(v, v)` hold.
+///
+/// This is only efficient when the dense indexes of the keys are close to each
+/// other. If Key does not implement DenseIndexableTraits, `enabled` is false
+/// and the map cannot hold elements.
+///
+/// Requirements:
+///
+/// Key must implement bool Key::operator==(const Key&) const
+/// Value must implement bool Value::operator==(const Value&) const
+template < typename Key, typename Value >
+class DenseMap final {
+public:
+  /// \brief True if the map can hold elements
+  static constexpr bool enabled = IsDenseIndexable< Key >::value;
+
+  /// \brief Number of bits of the index of a slot within a chunk
+  static constexpr Index ChunkBits = 5;
+
+  /// \brief Number of slots of a chunk
+  static constexpr Index ChunkSize = Index(1) << ChunkBits;
+
+private:
+  using Slot = boost::optional< std::pair< Key, Value > >;
+
+  /// \brief Set of slots of a chunk, as a bit mask
+  using SlotMask = std::uint32_t;
+
+  static_assert(ChunkSize <= 32, "SlotMask is too small");
+
+  /// \brief Mask with all the slots
+  static constexpr SlotMask AllSlots =
+      SlotMask(~SlotMask(0) >> (32 - ChunkSize));
+
+  struct Chunk {
+    /// \brief Slots, indexed by the low bits of the dense index
+    std::array< Slot, ChunkSize > slots;
+
+    /// \brief Number of non-empty slots
+    std::size_t size = 0;
+
+    /// \brief Unique identifier
+    ///
+    /// A new identifier is taken when the chunk is written in place after
+    /// another chunk was copied from it.
+    std::uint64_t id = dense_map_impl::new_chunk_id();
+
+    /// \brief Identifier of the base chunk, or 0
+    std::uint64_t base = 0;
+
+    /// \brief Slots that may differ from the base chunk
+    SlotMask dirty = AllSlots;
+
+    /// \brief True if a chunk was copied from this one
+    ///
+    /// This is set on shared chunks, hence atomic.
+    mutable std::atomic< bool > derived{false};
+
+    /// \brief Create an empty chunk
+    Chunk() = default;
+
+    /// \brief Create a copy of the chunk `other`, with `other` as base
+    ///
+    /// If `other` has a base, the copy keeps it so that it can still be
+    /// compared cheaply with the other copies of that base.
+    Chunk(const Chunk& other)
+        : slots(other.slots), size(other.size) {
+      if (other.base != 0 && other.dirty != AllSlots) {
+        this->base = other.base;
+        this->dirty = other.dirty;
+      } else {
+        this->base = other.id;
+        this->dirty = 0;
+        other.derived.store(true, std::memory_order_relaxed);
+      }
+    }
+
+    Chunk& operator=(const Chunk&) = delete;
+  };
+
+  using ChunkPtr = std::shared_ptr< const Chunk >;
+
+public:
+  class Iterator;
+
+private:
+  /// \brief Chunk number of the first chunk
+  Index _offset = 0;
+
+  /// \brief Chunks, or nullptr for empty chunks
+  ///
+  /// The first and last chunks are never empty.
+  std::vector< ChunkPtr > _chunks;
+
+  /// \brief Number of elements
+  std::size_t _size = 0;
+
+public:
+  /// \brief Create an empty map
+  DenseMap() = default;
+
+  /// \brief Copy constructor
+  DenseMap(const DenseMap&) = default;
+
+  /// \brief Move constructor
+  DenseMap(DenseMap&&) noexcept = default;
+
+  /// \brief Copy assignment operator
+  DenseMap& operator=(const DenseMap&) = default;
+
+  /// \brief Move assignment operator
+  DenseMap& operator=(DenseMap&&) noexcept = default;
+
+  /// \brief Destructor
+  ~DenseMap() = default;
+
+  /// \brief Return true if the map is empty
+  bool empty() const { return this->_size == 0; }
+
+  /// \brief Return the number of elements in the map
+  std::size_t size() const { return this->_size; }
+
+  /// \brief Return the number of slots between the first and last elements,
+  /// rounded up to whole chunks
+  std::size_t span() const { return this->_chunks.size() * ChunkSize; }
+
+  /// \brief Return an estimate of the memory allocated for the chunks, in
+  /// bytes
+  ///
+  /// Chunks shared with other maps are counted, and the memory owned by the
+  /// keys and the values is not.
+  std::size_t size_in_bytes() const {
+    std::size_t n = this->_chunks.capacity() * sizeof(ChunkPtr);
+    for (const ChunkPtr& chunk : this->_chunks) {
+      if (chunk != nullptr) {
+        n += sizeof(Chunk);
+      }
+    }
+    return n;
+  }
+
+  /// \brief Clear the content of the map
+  void clear() {
+    this->_offset = 0;
+    this->_chunks.clear();
+    this->_size = 0;
+  }
+
+  /// \brief Find the value associated with the given key
+  boost::optional< const Value& > at(const Key& key) const {
+    Index i = index(key);
+    const Chunk* chunk = this->chunk_at(i >> ChunkBits);
+    if (chunk == nullptr) {
+      return boost::none;
+    }
+    const Slot& slot = chunk->slots[i & (ChunkSize - 1)];
+    if (!slot) {
+      return boost::none;
+    }
+    return slot->second;
+  }
+
+  /// \brief Return the begin iterator over the elements of the map
+  Iterator begin() const { return Iterator(this, 0); }
+
+  /// \brief Return the end iterator over the elements of the map
+  Iterator end() const { return Iterator(this, this->span()); }
+
+  /// \brief Lower or equal comparison
+  ///
+  /// Returns true if all the keys of `other` are bound in `this`, with values
+  /// such that cmp(this_value, other_value) is true.
+  ///
+  /// The comparison function needs to be a callable of type:
+  ///   bool(const Value& left, const Value& right)
+  template < typename Compare >
+  bool leq(const DenseMap& other, const Compare& cmp) const {
+    if (this->_size < other._size) {
+      return false;
+    }
+    for (std::size_t i = 0; i < other._chunks.size(); i++) {
+      const ChunkPtr& o = other._chunks[i];
+      const Chunk* t = this->chunk_at(other._offset + i);
+      if (o == nullptr || o.get() == t) {
+        continue;
+      }
+      if (t == nullptr) {
+        return false;
+      }
+      for (SlotMask m = dirty_slots(*t, *o); m != 0; m &= m - 1) {
+        Index j = lowest_slot(m);
+        if (o->slots[j] &&
+            (!t->slots[j] || !cmp(t->slots[j]->second, o->slots[j]->second))) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /// \brief Equality comparison
+  ///
+  /// The comparison function should be a callable of type:
+  ///   bool(const Value& left, const Value& right)
+  template < typename Compare >
+  bool equals(const DenseMap& other, const Compare& cmp) const {
+    if (this->_size != other._size) {
+      return false;
+    }
+    if (this->_size == 0) {
+      return true;
+    }
+    if (this->_offset != other._offset ||
+        this->_chunks.size() != other._chunks.size()) {
+      return false;
+    }
+    for (std::size_t i = 0; i < this->_chunks.size(); i++) {
+      const ChunkPtr& t = this->_chunks[i];
+      const ChunkPtr& o = other._chunks[i];
+      if (t == o) {
+        continue;
+      }
+      if (t == nullptr || o == nullptr || t->size != o->size) {
+        return false;
+      }
+      for (SlotMask m = dirty_slots(*t, *o); m != 0; m &= m - 1) {
+        Index j = lowest_slot(m);
+        if (bool(t->slots[j]) != bool(o->slots[j]) ||
+            (t->slots[j] &&
+             !cmp(t->slots[j]->second, o->slots[j]->second))) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /// \brief Insert an element or assign a new value for the given `key`
+  ///
+  /// Assigning the value already bound to `key` leaves a shared chunk shared,
+  /// so that later binary operations can still skip it.
+  void insert_or_assign(const Key& key, const Value& value) {
+    Index i = index(key);
+    const Chunk* shared = this->chunk_at(i >> ChunkBits);
+    if (shared != nullptr) {
+      const Slot& old = shared->slots[i & (ChunkSize - 1)];
+      if (old && old->second == value) {
+        return;
+      }
+    }
+    Chunk& chunk = this->mutable_chunk(i);
+    Slot& slot = chunk.slots[i & (ChunkSize - 1)];
+    if (!slot) {
+      chunk.size++;
+      this->_size++;
+    }
+    slot = std::make_pair(key, value);
+  }
+
+  /// \brief Find the value corresponding to `key` and replace its bound value
+  /// with `combine(old_value, value)`.
+  ///
+  /// If the key is not found, insert (`key`, `value`). If the combining
+  /// function returns boost::none, remove the element.
+  ///
+  /// The combining function should be a callable of type:
+  ///   boost::optional< Value >(const Value& old, const Value& new)
+  template < typename CombiningFunction >
+  void update_or_insert(const CombiningFunction& combine,
+                        const Key& key,
+                        const Value& value) {
+    boost::optional< const Value& > old_value = this->at(key);
+    if (!old_value) {
+      this->insert_or_assign(key, value);
+      return;
+    }
+    boost::optional< Value > new_value = combine(*old_value, value);
+    if (!new_value) {
+      this->erase(key);
+    } else if (!(*new_value == *old_value)) {
+      this->insert_or_assign(key, *new_value);
+    }
+  }
+
+  /// \brief Remove an element from the map, if present
+  void erase(const Key& key) {
+    if (!this->at(key)) {
+      return;
+    }
+    Index i = index(key);
+    Chunk& chunk = this->mutable_chunk(i);
+    chunk.slots[i & (ChunkSize - 1)] = boost::none;
+    chunk.size--;
+    this->_size--;
+    if (chunk.size == 0) {
+      this->_chunks[(i >> ChunkBits) - this->_offset] = nullptr;
+      this->trim();
+    }
+  }
+
+  /// \brief Perform the union of two maps
+  ///
+  /// Keys bound on both sides are bound to `combine(left, right)`, or removed
+  /// if the combining function returns boost::none.
+  ///
+  /// The combining function should be a callable of type:
+  ///   boost::optional< Value >(const Value& left, const Value& right)
+  template < typename CombiningFunction >
+  void join_with(const DenseMap& other, const CombiningFunction& combine) {
+    if (other._size == 0) {
+      return;
+    }
+    this->reserve(other._offset, other._offset + other._chunks.size());
+    for (std::size_t i = 0; i < other._chunks.size(); i++) {
+      const ChunkPtr& o = other._chunks[i];
+      ChunkPtr& t = this->_chunks[other._offset + i - this->_offset];
+      if (o == nullptr || o == t) {
+        continue;
+      }
+      if (t == nullptr) {
+        t = o;
+        this->_size += o->size;
+        continue;
+      }
+      this->combine_chunk(t, *o, combine, /*is_union=*/true);
+    }
+    this->trim();
+  }
+
+  /// \brief Perform the intersection of two maps
+  ///
+  /// Keys bound on both sides are bound to `combine(left, right)`, or removed
+  /// if the combining function returns boost::none. Other keys are removed.
+  ///
+  /// The combining function should be a callable of type:
+  ///   boost::optional< Value >(const Value& left, const Value& right)
+  template < typename CombiningFunction >
+  void intersect_with(const DenseMap& other,
+                      const CombiningFunction& combine) {
+    for (std::size_t i = 0; i < this->_chunks.size(); i++) {
+      ChunkPtr& t = this->_chunks[i];
+      const Chunk* o = other.chunk_at(this->_offset + i);
+      if (t == nullptr || t.get() == o) {
+        continue;
+      }
+      if (o == nullptr) {
+        this->_size -= t->size;
+        t = nullptr;
+        continue;
+      }
+      this->combine_chunk(t, *o, combine, /*is_union=*/false);
+    }
+    this->trim();
+  }
+
+  /// \brief Dump the map, for debugging purpose
+  void dump(std::ostream& o) const {
+    static_assert(IsDumpable< Key >::value,
+                  "Key must implement DumpableTraits");
+    static_assert(IsDumpable< Value >::value,
+                  "Value must implement DumpableTraits");
+    o << "{";
+    for (auto it = this->begin(), et = this->end(); it != et;) {
+      DumpableTraits< Key >::dump(o, it->first);
+      o << " -> ";
+      DumpableTraits< Value >::dump(o, it->second);
+      ++it;
+      if (it != et) {
+        o << "; ";
+      }
+    }
+    o << "}";
+  }
+
+private:
+  /// \brief Return the dense index of the given key
+  static Index index(const Key& key) {
+    return dense_map_impl::dense_index(key, IsDenseIndexable< Key >());
+  }
+
+  /// \brief Return the chunk with the given number, or nullptr
+  const Chunk* chunk_at(Index c) const {
+    if (c < this->_offset || c - this->_offset >= this->_chunks.size()) {
+      return nullptr;
+    }
+    return this->_chunks[c - this->_offset].get();
+  }
+
+  /// \brief Extend the vector of chunks to hold the chunk numbers [first,
+  /// last)
+  void reserve(Index first, Index last) {
+    if (this->_chunks.empty()) {
+      this->_offset = first;
+      this->_chunks.resize(last - first);
+      return;
+    }
+    if (first < this->_offset) {
+      this->_chunks.insert(this->_chunks.begin(),
+                           this->_offset - first,
+                           nullptr);
+      this->_offset = first;
+    }
+    if (last > this->_offset + this->_chunks.size()) {
+      this->_chunks.resize(last - this->_offset);
+    }
+  }
+
+  /// \brief Remove the empty chunks at the beginning and the end
+  void trim() {
+    while (!this->_chunks.empty() && this->_chunks.back() == nullptr) {
+      this->_chunks.pop_back();
+    }
+    std::size_t n = 0;
+    while (n < this->_chunks.size() && this->_chunks[n] == nullptr) {
+      n++;
+    }
+    if (n > 0) {
+      this->_chunks.erase(this->_chunks.begin(), this->_chunks.begin() + n);
+      this->_offset += n;
+    }
+    if (this->_chunks.empty()) {
+      this->_offset = 0;
+    }
+  }
+
+  /// \brief Return a writable chunk holding the slot with the given dense
+  /// index, and mark the slot as dirty
+  ///
+  /// The chunk is created if it does not exist, and copied if it is shared.
+  Chunk& mutable_chunk(Index i) {
+    Index c = i >> ChunkBits;
+    this->reserve(c, c + 1);
+    ChunkPtr& ptr = this->_chunks[c - this->_offset];
+    if (ptr == nullptr) {
+      ptr = std::make_shared< Chunk >();
+    } else if (!unique(ptr)) {
+      ptr = std::make_shared< Chunk >(*ptr);
+    }
+    // Chunks are always allocated as non-const
+    auto& chunk = const_cast< Chunk& >(*ptr);
+    if (chunk.derived.load(std::memory_order_relaxed)) {
+      // Copies of this chunk now differ from it on unknown slots
+      chunk.id = dense_map_impl::new_chunk_id();
+      chunk.derived.store(false, std::memory_order_relaxed);
+    }
+    chunk.dirty |= SlotMask(1) << (i & (ChunkSize - 1));
+    return chunk;
+  }
+
+  /// \brief Return the slots that may differ between the chunks `a` and `b`
+  static SlotMask dirty_slots(const Chunk& a, const Chunk& b) {
+    if (a.base == b.id) {
+      return a.dirty;
+    } else if (b.base == a.id) {
+      return b.dirty;
+    } else if (a.base != 0 && a.base == b.base) {
+      return a.dirty | b.dirty;
+    } else {
+      return AllSlots;
+    }
+  }
+
+  /// \brief Return the index of the lowest slot of a non-empty mask
+  static Index lowest_slot(SlotMask m) {
+    ikos_assert(m != 0);
+#if __has_builtin(__builtin_ctz) || IKOS_GNUC_PREREQ(4, 0, 0)
+    return static_cast< Index >(__builtin_ctz(m));
+#else
+    Index j = 0;
+    for (; (m & 1) == 0; m >>= 1) {
+      j++;
+    }
+    return j;
+#endif
+  }
+
+  /// \brief Return true if the given chunk is not shared
+  static bool unique(const ChunkPtr& chunk) {
+    if (chunk.use_count() != 1) {
+      return false;
+    }
+    // Synchronize with the release of other owners, in other threads
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+  }
+
+  /// \brief Combine the slots of the chunk `t` with `o`
+  ///
+  /// Slots bound on both sides are combined. Slots bound on one side are kept
+  /// if `is_union` is true, otherwise they are removed. Only the slots that may
+  /// differ are visited, and the chunk is only copied if a slot changes.
+  template < typename CombiningFunction >
+  void combine_chunk(ChunkPtr& t,
+                     const Chunk& o,
+                     const CombiningFunction& combine,
+                     bool is_union) {
+    std::shared_ptr< Chunk > result;
+    for (SlotMask m = dirty_slots(*t, o); m != 0; m &= m - 1) {
+      Index j = lowest_slot(m);
+      const Slot& left = t->slots[j];
+      const Slot& right = o.slots[j];
+      if (!left) {
+        if (!right || !is_union) {
+          continue;
+        }
+        if (result == nullptr) {
+          result = std::make_shared< Chunk >(*t);
+        }
+        result->slots[j] = right;
+        result->dirty |= SlotMask(1) << j;
+        result->size++;
+        this->_size++;
+        continue;
+      }
+      boost::optional< Value > value;
+      if (right) {
+        value = combine(left->second, right->second);
+      } else if (is_union) {
+        continue;
+      }
+      if (value && *value == left->second) {
+        continue;
+      }
+      if (result == nullptr) {
+        result = std::make_shared< Chunk >(*t);
+      }
+      result->dirty |= SlotMask(1) << j;
+      if (value) {
+        result->slots[j]->second = std::move(*value);
+      } else {
+        result->slots[j] = boost::none;
+        result->size--;
+        this->_size--;
+      }
+    }
+    if (result != nullptr) {
+      if (result->size == 0) {
+        t = nullptr;
+      } else {
+        t = std::move(result);
+      }
+    }
+  }
+
+public:
+  /// \brief Iterator over the elements of a dense map, in the order of the
+  /// dense indexes
+  class Iterator final {
+  public:
+    // Required types for iterators
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = const std::pair< Key, Value >;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::pair< Key, Value >*;
+    using reference = const std::pair< Key, Value >&;
+
+  private:
+    const DenseMap* _map = nullptr;
+
+    /// \brief Position of the slot, relative to the first chunk
+    std::size_t _pos = 0;
+
+  public:
+    /// \brief Create an end iterator
+    Iterator() = default;
+
+    /// \brief Create an iterator on the first non-empty slot from `pos`
+    Iterator(const DenseMap* map, std::size_t pos) : _map(map), _pos(pos) {
+      this->skip_empty_slots();
+    }
+
+    /// \brief Pre-increment the iterator
+    Iterator& operator++() {
+      ikos_assert(this->_pos < this->_map->span());
+      this->_pos++;
+      this->skip_empty_slots();
+      return *this;
+    }
+
+    /// \brief Post-increment the iterator
+    const Iterator operator++(int) {
+      Iterator r = *this;
+      ++(*this);
+      return r;
+    }
+
+    /// \brief Compare two iterators
+    bool operator==(const Iterator& other) const {
+      return this->_pos == other._pos;
+    }
+
+    /// \brief Compare two iterators
+    bool operator!=(const Iterator& other) const {
+      return this->_pos != other._pos;
+    }
+
+    /// \brief Dereference the iterator
+    reference operator*() const { return *this->slot(); }
+
+    /// \brief Dereference the iterator
+    pointer operator->() const { return &*this->slot(); }
+
+  private:
+    /// \brief Return the current slot
+    const Slot& slot() const {
+      return this->_map->_chunks[this->_pos >> ChunkBits]
+          ->slots[this->_pos & (ChunkSize - 1)];
+    }
+
+    /// \brief Move to the next non-empty slot
+    void skip_empty_slots() {
+      std::size_t span = this->_map->span();
+      while (this->_pos < span) {
+        const ChunkPtr& chunk = this->_map->_chunks[this->_pos >> ChunkBits];
+        if (chunk == nullptr) {
+          this->_pos = ((this->_pos >> ChunkBits) + 1) << ChunkBits;
+        } else if (!chunk->slots[this->_pos & (ChunkSize - 1)]) {
+          this->_pos++;
+        } else {
+          return;
+        }
+      }
+    }
+
+  }; // end class Iterator
+
+}; // end class DenseMap
+
+template < typename Key, typename Value >
+constexpr bool DenseMap< Key, Value >::enabled;
+
+template < typename Key, typename Value >
+constexpr Index DenseMap< Key, Value >::ChunkBits;
+
+template < typename Key, typename Value >
+constexpr Index DenseMap< Key, Value >::ChunkSize;
+
+template < typename Key, typename Value >
+constexpr typename DenseMap< Key, Value >::SlotMask
+    DenseMap< Key, Value >::AllSlots;
+
+} // end namespace core
+} // end namespace ikos
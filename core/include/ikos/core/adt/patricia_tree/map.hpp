@@ -49,14 +49,18 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 #include <memory>
 #include <stack>
+#include <type_traits>
 
+#include <boost/functional/hash.hpp>
 #include <boost/optional.hpp>
 
 #include <ikos/core/adt/patricia_tree/utils.hpp>
+#include <ikos/core/adt/pool_allocator.hpp>
 #include <ikos/core/semantic/dumpable.hpp>
 #include <ikos/core/semantic/indexable.hpp>
 #include <ikos/core/support/assert.hpp>
@@ -72,6 +76,12 @@ using namespace patricia_tree_utils;
 template < typename Key, typename Value >
 class PatriciaTree;
 
+template < typename Key, typename Value >
+class PatriciaTreeNode;
+
+template < typename Key, typename Value >
+class PatriciaTreeLeaf;
+
 template < typename Key, typename Value >
 class PatriciaTreeIterator;
 
@@ -140,12 +150,22 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > intersect(
     const std::shared_ptr< const PatriciaTree< Key, Value > >& t,
     const CombiningFunction& combine);
 
+template < typename Key, typename Value, typename CombiningFunction >
+inline std::shared_ptr< const PatriciaTree< Key, Value > > difference(
+    const std::shared_ptr< const PatriciaTree< Key, Value > >& s,
+    const std::shared_ptr< const PatriciaTree< Key, Value > >& t,
+    const CombiningFunction& combine);
+
 template < typename Key, typename Value, typename BinaryOp >
 inline typename BinaryOp::ResultType binary_operation(
     const std::shared_ptr< const PatriciaTree< Key, Value > >& s,
     const std::shared_ptr< const PatriciaTree< Key, Value > >& t,
     const BinaryOp& op);
 
+template < typename Key, typename Value, typename RandomAccessIterator >
+inline std::shared_ptr< const PatriciaTree< Key, Value > > build_sorted(
+    RandomAccessIterator first, RandomAccessIterator last);
+
 } // end namespace patricia_tree_map_impl
 
 /// \brief An implementation of the patricia tree map data structure
@@ -194,12 +214,43 @@ public:
   /// \brief Destructor
   ~PatriciaTreeMap() = default;
 
+  /// \brief Create a patricia tree map with the content of the sorted range
+  /// [first, last) of (key, value) pairs, in linear time
+  ///
+  /// The keys must be distinct and sorted in the order of the tree, i.e the
+  /// iteration order of a patricia tree map, according to
+  /// patricia_tree_utils::tree_order_less() on their indexes.
+  template < typename RandomAccessIterator >
+  static PatriciaTreeMap from_sorted_range(RandomAccessIterator first,
+                                           RandomAccessIterator last) {
+    return PatriciaTreeMap(
+        patricia_tree_map_impl::build_sorted< Key, Value >(first, last));
+  }
+
   /// \brief Return true if the map is empty
   bool empty() const { return patricia_tree_map_impl::empty(this->_tree); }
 
   /// \brief Return the number of elements in the map
   std::size_t size() const { return patricia_tree_map_impl::size(this->_tree); }
 
+  /// \brief Return the number of nodes of the tree, including the leaves
+  std::size_t num_nodes() const {
+    std::size_t n = this->size();
+    return n == 0 ? 0 : 2 * n - 1;
+  }
+
+  /// \brief Return an estimate of the memory allocated for the nodes of the
+  /// tree, in bytes
+  ///
+  /// Subtrees shared with other maps are counted, and the memory owned by the
+  /// keys and the values is not.
+  std::size_t size_in_bytes() const {
+    std::size_t n = this->size();
+    return n * sizeof(patricia_tree_map_impl::PatriciaTreeLeaf< Key, Value >) +
+           (n == 0 ? 0 : n - 1) *
+               sizeof(patricia_tree_map_impl::PatriciaTreeNode< Key, Value >);
+  }
+
   /// \brief Clear the content of the map
   void clear() { this->_tree.reset(); }
 
@@ -232,6 +283,14 @@ public:
     return patricia_tree_map_impl::equals(this->_tree, other._tree, cmp);
   }
 
+  /// \brief Return true if both maps share the same underlying tree
+  ///
+  /// This is a constant time check. It implies equality, but two equal maps
+  /// built separately do not necessarily share their tree.
+  bool shares_tree(const PatriciaTreeMap& other) const {
+    return this->_tree == other._tree;
+  }
+
   /// \brief Insert an element or assign a new value for the given `key`
   void insert_or_assign(const Key& key, const Value& value) {
     this->_tree =
@@ -330,6 +389,32 @@ public:
         patricia_tree_map_impl::intersect(this->_tree, other._tree, combine));
   }
 
+  /// \brief Perform the difference of two patricia tree maps
+  ///
+  /// The elements of `other` are removed, unless the combining function
+  /// returns a value for the key. The elements bound only in `other` are
+  /// ignored.
+  ///
+  /// The combining function should be a callable of type:
+  ///   boost::optional< Value >(const Value& left, const Value& right)
+  template < typename CombiningFunction >
+  void difference_with(const PatriciaTreeMap& other,
+                       const CombiningFunction& combine) {
+    this->_tree =
+        patricia_tree_map_impl::difference(this->_tree, other._tree, combine);
+  }
+
+  /// \brief Perform the difference of two patricia tree maps
+  ///
+  /// The combining function should be a callable of type:
+  ///   boost::optional< Value >(const Value& left, const Value& right)
+  template < typename CombiningFunction >
+  PatriciaTreeMap difference(const PatriciaTreeMap& other,
+                             const CombiningFunction& combine) const {
+    return PatriciaTreeMap(
+        patricia_tree_map_impl::difference(this->_tree, other._tree, combine));
+  }
+
   /// \brief Perform a generic binary operation
   ///
   /// Example of binary operator:
@@ -635,6 +720,97 @@ inline bool equals(const std::shared_ptr< const PatriciaTree< Key, Value > >& s,
          equals(s_node->right_tree(), t_node->right_tree(), cmp);
 }
 
+/// \brief Create a leaf, without hash-consing
+template < typename Key, typename Value >
+inline std::shared_ptr< const PatriciaTreeLeaf< Key, Value > > create_leaf(
+    const Key& key, const Value& value, std::false_type /*hash_consing*/) {
+  return make_pooled_shared< const PatriciaTreeLeaf< Key, Value > >(key, value);
+}
+
+/// \brief Create a leaf, with hash-consing
+template < typename Key, typename Value >
+inline std::shared_ptr< const PatriciaTreeLeaf< Key, Value > > create_leaf(
+    const Key& key, const Value& value, std::true_type /*hash_consing*/) {
+  using Leaf = PatriciaTreeLeaf< Key, Value >;
+  std::size_t hash = 0;
+  boost::hash_combine(hash, IndexableTraits< Key >::index(key));
+  boost::hash_combine(hash,
+                      PatriciaTreeHashConsing< Key, Value >::hash(value));
+  return InterningTable< Leaf >::get().intern(
+      hash,
+      [&](const Leaf& leaf) {
+        return leaf.key() == key && leaf.value() == value;
+      },
+      [&] { return make_pooled_shared< const Leaf >(key, value); });
+}
+
+/// \brief Create a leaf
+template < typename Key, typename Value >
+inline std::shared_ptr< const PatriciaTreeLeaf< Key, Value > > create_leaf(
+    const Key& key, const Value& value) {
+  return create_leaf(key, value, HashConsingTag< Key, Value >());
+}
+
+/// \brief Create a node with two non-null children, without hash-consing
+template < typename Key, typename Value >
+inline std::shared_ptr< const PatriciaTreeNode< Key, Value > > create_node(
+    Index prefix,
+    Index branching_bit,
+    const std::shared_ptr< const PatriciaTree< Key, Value > >& left_tree,
+    const std::shared_ptr< const PatriciaTree< Key, Value > >& right_tree,
+    std::false_type /*hash_consing*/) {
+  return make_pooled_shared<
+      const PatriciaTreeNode< Key, Value > >(prefix,
+                                             branching_bit,
+                                             left_tree,
+                                             right_tree);
+}
+
+/// \brief Create a node with two non-null children, with hash-consing
+///
+/// Children are interned, thus nodes are compared with pointer equality.
+template < typename Key, typename Value >
+inline std::shared_ptr< const PatriciaTreeNode< Key, Value > > create_node(
+    Index prefix,
+    Index branching_bit,
+    const std::shared_ptr< const PatriciaTree< Key, Value > >& left_tree,
+    const std::shared_ptr< const PatriciaTree< Key, Value > >& right_tree,
+    std::true_type /*hash_consing*/) {
+  using Node = PatriciaTreeNode< Key, Value >;
+  std::size_t hash = 0;
+  boost::hash_combine(hash, prefix);
+  boost::hash_combine(hash, branching_bit);
+  boost::hash_combine(hash, left_tree.get());
+  boost::hash_combine(hash, right_tree.get());
+  return InterningTable< Node >::get().intern(
+      hash,
+      [&](const Node& node) {
+        return node.prefix() == prefix &&
+               node.branching_bit() == branching_bit &&
+               node.left_tree() == left_tree && node.right_tree() == right_tree;
+      },
+      [&] {
+        return make_pooled_shared< const Node >(prefix,
+                                                branching_bit,
+                                                left_tree,
+                                                right_tree);
+      });
+}
+
+/// \brief Create a node with two non-null children
+template < typename Key, typename Value >
+inline std::shared_ptr< const PatriciaTreeNode< Key, Value > > create_node(
+    Index prefix,
+    Index branching_bit,
+    const std::shared_ptr< const PatriciaTree< Key, Value > >& left_tree,
+    const std::shared_ptr< const PatriciaTree< Key, Value > >& right_tree) {
+  return create_node(prefix,
+                     branching_bit,
+                     left_tree,
+                     right_tree,
+                     HashConsingTag< Key, Value >());
+}
+
 /// \brief Create a node
 ///
 /// Prevent the creation of a node with only one child.
@@ -650,10 +826,10 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > make_node(
   if (right_tree == nullptr) {
     return left_tree;
   }
-  return std::make_shared< const PatriciaTreeNode< Key, Value > >(prefix,
-                                                                  branching_bit,
-                                                                  left_tree,
-                                                                  right_tree);
+  return create_node< Key, Value >(prefix,
+                                   branching_bit,
+                                   left_tree,
+                                   right_tree);
 }
 
 /// \brief Join non-null patricia trees
@@ -668,11 +844,9 @@ inline std::shared_ptr< const PatriciaTreeNode< Key, Value > > join_trees(
   Index m = branching_bit(prefix_s, prefix_t);
 
   if (is_zero_bit(prefix_s, m)) {
-    return std::make_shared<
-        const PatriciaTreeNode< Key, Value > >(mask(prefix_s, m), m, s, t);
+    return create_node< Key, Value >(mask(prefix_s, m), m, s, t);
   } else {
-    return std::make_shared<
-        const PatriciaTreeNode< Key, Value > >(mask(prefix_s, m), m, t, s);
+    return create_node< Key, Value >(mask(prefix_s, m), m, t, s);
   }
 }
 
@@ -682,7 +856,7 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > insert_or_assign(
     const Key& key,
     const Value& value) {
   if (tree == nullptr) {
-    return std::make_shared< const PatriciaTreeLeaf< Key, Value > >(key, value);
+    return create_leaf< Key, Value >(key, value);
   }
   if (tree->is_leaf()) {
     auto leaf =
@@ -691,12 +865,10 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > insert_or_assign(
       if (leaf->value() == value) {
         return tree;
       } else {
-        return std::make_shared< const PatriciaTreeLeaf< Key, Value > >(key,
-                                                                        value);
+        return create_leaf< Key, Value >(key, value);
       }
     }
-    auto new_leaf =
-        std::make_shared< const PatriciaTreeLeaf< Key, Value > >(key, value);
+    auto new_leaf = create_leaf< Key, Value >(key, value);
     return join_trees< Key, Value >(IndexableTraits< Key >::index(key),
                                     new_leaf,
                                     IndexableTraits< Key >::index(leaf->key()),
@@ -728,8 +900,7 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > insert_or_assign(
                        new_right_tree);
     }
   }
-  auto new_leaf =
-      std::make_shared< const PatriciaTreeLeaf< Key, Value > >(key, value);
+  auto new_leaf = create_leaf< Key, Value >(key, value);
   return join_trees< Key, Value >(IndexableTraits< Key >::index(key),
                                   new_leaf,
                                   node->prefix(),
@@ -743,7 +914,7 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > update_or_insert(
     const Key& key,
     const Value& value) {
   if (tree == nullptr) {
-    return std::make_shared< const PatriciaTreeLeaf< Key, Value > >(key, value);
+    return create_leaf< Key, Value >(key, value);
   }
   if (tree->is_leaf()) {
     auto leaf =
@@ -754,14 +925,12 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > update_or_insert(
         if (leaf->value() == *new_value) {
           return tree;
         } else {
-          return std::make_shared<
-              const PatriciaTreeLeaf< Key, Value > >(key, *new_value);
+          return create_leaf< Key, Value >(key, *new_value);
         }
       }
       return nullptr;
     }
-    auto new_leaf =
-        std::make_shared< const PatriciaTreeLeaf< Key, Value > >(key, value);
+    auto new_leaf = create_leaf< Key, Value >(key, value);
     return join_trees< Key, Value >(IndexableTraits< Key >::index(key),
                                     new_leaf,
                                     IndexableTraits< Key >::index(leaf->key()),
@@ -795,8 +964,7 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > update_or_insert(
                        new_right_tree);
     }
   }
-  auto new_leaf =
-      std::make_shared< const PatriciaTreeLeaf< Key, Value > >(key, value);
+  auto new_leaf = create_leaf< Key, Value >(key, value);
   return join_trees< Key, Value >(IndexableTraits< Key >::index(key),
                                   new_leaf,
                                   node->prefix(),
@@ -821,8 +989,7 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > update_or_ignore(
         if (leaf->value() == *new_value) {
           return tree;
         } else {
-          return std::make_shared<
-              const PatriciaTreeLeaf< Key, Value > >(key, *new_value);
+          return create_leaf< Key, Value >(key, *new_value);
         }
       }
       return nullptr;
@@ -885,8 +1052,7 @@ update_or_insert_leaf(
         } else if (t_leaf->value() == *new_value) {
           return t_leaf;
         } else {
-          return std::make_shared<
-              const PatriciaTreeLeaf< Key, Value > >(s_leaf->key(), *new_value);
+          return create_leaf< Key, Value >(s_leaf->key(), *new_value);
         }
       }
       return nullptr;
@@ -992,8 +1158,7 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > transform(
       if (leaf->value() == *new_value) {
         return tree;
       } else {
-        return std::make_shared<
-            const PatriciaTreeLeaf< Key, Value > >(leaf->key(), *new_value);
+        return create_leaf< Key, Value >(leaf->key(), *new_value);
       }
     }
     return nullptr;
@@ -1123,8 +1288,7 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > intersect(
         } else if (t_leaf->value() == *new_value) {
           return std::move(t_leaf);
         } else {
-          return std::make_shared<
-              const PatriciaTreeLeaf< Key, Value > >(s_leaf->key(), *new_value);
+          return create_leaf< Key, Value >(s_leaf->key(), *new_value);
         }
       }
     }
@@ -1143,8 +1307,7 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > intersect(
         } else if (t_leaf->value() == *new_value) {
           return std::move(t_leaf);
         } else {
-          return std::make_shared<
-              const PatriciaTreeLeaf< Key, Value > >(t_leaf->key(), *new_value);
+          return create_leaf< Key, Value >(t_leaf->key(), *new_value);
         }
       }
     }
@@ -1192,6 +1355,111 @@ inline std::shared_ptr< const PatriciaTree< Key, Value > > intersect(
   return nullptr;
 }
 
+template < typename Key, typename Value, typename CombiningFunction >
+inline std::shared_ptr< const PatriciaTree< Key, Value > > difference(
+    const std::shared_ptr< const PatriciaTree< Key, Value > >& s,
+    const std::shared_ptr< const PatriciaTree< Key, Value > >& t,
+    const CombiningFunction& combine) {
+  if (s == nullptr || t == nullptr) {
+    return s;
+  }
+  if (s->is_leaf()) {
+    auto s_leaf =
+        std::static_pointer_cast< const PatriciaTreeLeaf< Key, Value > >(s);
+    auto t_leaf = find_leaf(t, s_leaf->key());
+    if (!t_leaf) {
+      return s;
+    }
+    boost::optional< Value > new_value =
+        combine(s_leaf->value(), t_leaf->value());
+    if (new_value) {
+      if (s_leaf->value() == *new_value) {
+        return s;
+      } else {
+        return create_leaf< Key, Value >(s_leaf->key(), *new_value);
+      }
+    }
+    return nullptr;
+  }
+  if (t->is_leaf()) {
+    auto t_leaf =
+        std::static_pointer_cast< const PatriciaTreeLeaf< Key, Value > >(t);
+    return update_or_ignore(s, combine, t_leaf->key(), t_leaf->value());
+  }
+  auto s_node =
+      std::static_pointer_cast< const PatriciaTreeNode< Key, Value > >(s);
+  auto t_node =
+      std::static_pointer_cast< const PatriciaTreeNode< Key, Value > >(t);
+  Index m = s_node->branching_bit();
+  Index n = t_node->branching_bit();
+  Index p = s_node->prefix();
+  Index q = t_node->prefix();
+  if (m == n && p == q) {
+    // The two trees have the same prefix
+    auto new_left =
+        difference(s_node->left_tree(), t_node->left_tree(), combine);
+    auto new_right =
+        difference(s_node->right_tree(), t_node->right_tree(), combine);
+    if (new_left == s_node->left_tree() && new_right == s_node->right_tree()) {
+      return s;
+    }
+    return make_node(p, m, new_left, new_right);
+  }
+  if (m < n && match_prefix(q, p, m)) {
+    // q contains p, diff t with a subtree of s
+    if (is_zero_bit(q, m)) {
+      auto new_left = difference(s_node->left_tree(), t, combine);
+      if (s_node->left_tree() == new_left) {
+        return s;
+      }
+      return make_node(p, m, new_left, s_node->right_tree());
+    } else {
+      auto new_right = difference(s_node->right_tree(), t, combine);
+      if (s_node->right_tree() == new_right) {
+        return s;
+      }
+      return make_node(p, m, s_node->left_tree(), new_right);
+    }
+  }
+  if (m > n && match_prefix(p, q, n)) {
+    // p contains q, diff s with a subtree of t
+    if (is_zero_bit(p, n)) {
+      return difference(s, t_node->left_tree(), combine);
+    } else {
+      return difference(s, t_node->right_tree(), combine);
+    }
+  }
+  // The prefixes disagree
+  return s;
+}
+
+/// \brief Build a patricia tree from a range of (key, value) pairs with
+/// distinct keys sorted in the order of the tree
+template < typename Key, typename Value, typename RandomAccessIterator >
+inline std::shared_ptr< const PatriciaTree< Key, Value > > build_sorted(
+    RandomAccessIterator first, RandomAccessIterator last) {
+  if (first == last) {
+    return nullptr;
+  }
+  if (std::next(first) == last) {
+    return create_leaf< Key, Value >(first->first, first->second);
+  }
+
+  // The first and last keys differ on the branching bit of the whole range
+  Index p = IndexableTraits< Key >::index(first->first);
+  Index m =
+      branching_bit(p, IndexableTraits< Key >::index(std::prev(last)->first));
+  ikos_assert(is_zero_bit(p, m));
+
+  auto middle = std::partition_point(first, last, [m](const auto& entry) {
+    return is_zero_bit(IndexableTraits< Key >::index(entry.first), m);
+  });
+  return create_node< Key, Value >(mask(p, m),
+                                   m,
+                                   build_sorted< Key, Value >(first, middle),
+                                   build_sorted< Key, Value >(middle, last));
+}
+
 template < typename Key, typename Value, typename BinaryOp >
 inline typename BinaryOp::ResultType binary_operation(
     const std::shared_ptr< const PatriciaTree< Key, Value > >& s,
@@ -49,12 +49,18 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 #include <memory>
 #include <stack>
+#include <type_traits>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
 
 #include <ikos/core/adt/patricia_tree/utils.hpp>
+#include <ikos/core/adt/pool_allocator.hpp>
 #include <ikos/core/semantic/dumpable.hpp>
 #include <ikos/core/semantic/indexable.hpp>
 #include <ikos/core/support/assert.hpp>
@@ -70,6 +76,12 @@ using namespace patricia_tree_utils;
 template < typename Key >
 class PatriciaTree;
 
+template < typename Key >
+class PatriciaTreeNode;
+
+template < typename Key >
+class PatriciaTreeLeaf;
+
 template < typename Key >
 class PatriciaTreeIterator;
 
@@ -120,6 +132,14 @@ inline std::shared_ptr< const PatriciaTree< Key > > difference(
     const std::shared_ptr< const PatriciaTree< Key > >& s,
     const std::shared_ptr< const PatriciaTree< Key > >& t);
 
+template < typename Key, typename RandomAccessIterator >
+inline std::shared_ptr< const PatriciaTree< Key > > build_sorted(
+    RandomAccessIterator first, RandomAccessIterator last);
+
+template < typename Key, typename RandomAccessIterator >
+inline std::shared_ptr< const PatriciaTree< Key > > join_many(
+    RandomAccessIterator first, RandomAccessIterator last);
+
 } // end namespace patricia_tree_set_impl
 
 /// \brief An implementation of the patricia tree set data structure
@@ -153,19 +173,28 @@ public:
   PatriciaTreeSet() = default;
 
   /// \brief Create a patricia tree set with the given elements
-  PatriciaTreeSet(std::initializer_list< Key > elements) {
-    for (const Key& e : elements) {
-      this->insert(e);
-    }
-  }
+  PatriciaTreeSet(std::initializer_list< Key > elements)
+      : PatriciaTreeSet(elements.begin(), elements.end()) {}
 
-  /// \brief Create a patricia tree set with the content of the range [firt,
+  /// \brief Create a patricia tree set with the content of the range [first,
   /// last)
+  ///
+  /// The elements are sorted in the order of the tree, and the tree is built
+  /// bottom-up, instead of inserting the elements one by one.
   template < typename InputIterator >
   PatriciaTreeSet(InputIterator first, InputIterator last) {
-    for (auto it = first; it != last; ++it) {
-      this->insert(*it);
-    }
+    std::vector< Key > keys(first, last);
+    std::sort(keys.begin(), keys.end(), [](const Key& a, const Key& b) {
+      return patricia_tree_utils::tree_order_less(index(a), index(b));
+    });
+    keys.erase(std::unique(keys.begin(),
+                           keys.end(),
+                           [](const Key& a, const Key& b) {
+                             return index(a) == index(b);
+                           }),
+               keys.end());
+    this->_tree =
+        patricia_tree_set_impl::build_sorted< Key >(keys.begin(), keys.end());
   }
 
   /// \brief Copy constructor
@@ -183,12 +212,43 @@ public:
   /// \brief Destructor
   ~PatriciaTreeSet() = default;
 
+  /// \brief Create a patricia tree set with the content of the sorted range
+  /// [first, last), in linear time
+  ///
+  /// The elements must be distinct and sorted in the order of the tree, i.e
+  /// the iteration order of a patricia tree set, according to
+  /// patricia_tree_utils::tree_order_less() on their indexes.
+  template < typename RandomAccessIterator >
+  static PatriciaTreeSet from_sorted_range(RandomAccessIterator first,
+                                           RandomAccessIterator last) {
+    return PatriciaTreeSet(
+        patricia_tree_set_impl::build_sorted< Key >(first, last));
+  }
+
   /// \brief Return true if the set is empty
   bool empty() const { return patricia_tree_set_impl::empty(this->_tree); }
 
   /// \brief Return the number of elements in the set
   std::size_t size() const { return patricia_tree_set_impl::size(this->_tree); }
 
+  /// \brief Return the number of nodes of the tree, including the leaves
+  std::size_t num_nodes() const {
+    std::size_t n = this->size();
+    return n == 0 ? 0 : 2 * n - 1;
+  }
+
+  /// \brief Return an estimate of the memory allocated for the nodes of the
+  /// tree, in bytes
+  ///
+  /// Subtrees shared with other sets are counted, and the memory owned by the
+  /// keys is not.
+  std::size_t size_in_bytes() const {
+    std::size_t n = this->size();
+    return n * sizeof(patricia_tree_set_impl::PatriciaTreeLeaf< Key >) +
+           (n == 0 ? 0 : n - 1) *
+               sizeof(patricia_tree_set_impl::PatriciaTreeNode< Key >);
+  }
+
   /// \brief Clear the content of the set
   void clear() { this->_tree.reset(); }
 
@@ -245,6 +305,22 @@ public:
         patricia_tree_set_impl::join(this->_tree, other._tree));
   }
 
+  /// \brief Perform the union with all the patricia tree sets of the range
+  /// [first, last)
+  ///
+  /// The sets are joined pairwise, in a balanced way, so that each element is
+  /// visited a logarithmic number of times.
+  template < typename InputIterator >
+  void join_with_many(InputIterator first, InputIterator last) {
+    std::vector< std::shared_ptr< const PatriciaTree > > trees;
+    trees.push_back(this->_tree);
+    for (auto it = first; it != last; ++it) {
+      trees.push_back(it->_tree);
+    }
+    this->_tree =
+        patricia_tree_set_impl::join_many< Key >(trees.begin(), trees.end());
+  }
+
   /// \brief Perform the intersection of two patricia tree sets
   void intersect_with(const PatriciaTreeSet& other) {
     this->_tree = patricia_tree_set_impl::intersect(this->_tree, other._tree);
@@ -282,6 +358,12 @@ public:
     o << "}";
   }
 
+private:
+  /// \brief Return the index of the given key
+  static Index index(const Key& key) {
+    return IndexableTraits< Key >::index(key);
+  }
+
 }; // end class PatriciaTreeSet
 
 /// \brief Write a patricia tree set on a stream
@@ -471,6 +553,92 @@ inline bool equals(const std::shared_ptr< const PatriciaTree< Key > >& s,
          equals(s_node->right_tree(), t_node->right_tree());
 }
 
+/// \brief Create a leaf, without hash-consing
+template < typename Key >
+inline std::shared_ptr< const PatriciaTreeLeaf< Key > > create_leaf(
+    const Key& key, std::false_type /*hash_consing*/) {
+  return make_pooled_shared< const PatriciaTreeLeaf< Key > >(key);
+}
+
+/// \brief Create a leaf, with hash-consing
+template < typename Key >
+inline std::shared_ptr< const PatriciaTreeLeaf< Key > > create_leaf(
+    const Key& key, std::true_type /*hash_consing*/) {
+  using Leaf = PatriciaTreeLeaf< Key >;
+  std::size_t hash = 0;
+  boost::hash_combine(hash, IndexableTraits< Key >::index(key));
+  return InterningTable< Leaf >::get().intern(
+      hash,
+      [&](const Leaf& leaf) { return leaf.key() == key; },
+      [&] { return make_pooled_shared< const Leaf >(key); });
+}
+
+/// \brief Create a leaf
+template < typename Key >
+inline std::shared_ptr< const PatriciaTreeLeaf< Key > > create_leaf(
+    const Key& key) {
+  return create_leaf(key, HashConsingTag< Key >());
+}
+
+/// \brief Create a node with two non-null children, without hash-consing
+template < typename Key >
+inline std::shared_ptr< const PatriciaTreeNode< Key > > create_node(
+    Index prefix,
+    Index branching_bit,
+    const std::shared_ptr< const PatriciaTree< Key > >& left_tree,
+    const std::shared_ptr< const PatriciaTree< Key > >& right_tree,
+    std::false_type /*hash_consing*/) {
+  return make_pooled_shared< const PatriciaTreeNode< Key > >(prefix,
+                                                             branching_bit,
+                                                             left_tree,
+                                                             right_tree);
+}
+
+/// \brief Create a node with two non-null children, with hash-consing
+///
+/// Children are interned, thus nodes are compared with pointer equality.
+template < typename Key >
+inline std::shared_ptr< const PatriciaTreeNode< Key > > create_node(
+    Index prefix,
+    Index branching_bit,
+    const std::shared_ptr< const PatriciaTree< Key > >& left_tree,
+    const std::shared_ptr< const PatriciaTree< Key > >& right_tree,
+    std::true_type /*hash_consing*/) {
+  using Node = PatriciaTreeNode< Key >;
+  std::size_t hash = 0;
+  boost::hash_combine(hash, prefix);
+  boost::hash_combine(hash, branching_bit);
+  boost::hash_combine(hash, left_tree.get());
+  boost::hash_combine(hash, right_tree.get());
+  return InterningTable< Node >::get().intern(
+      hash,
+      [&](const Node& node) {
+        return node.prefix() == prefix &&
+               node.branching_bit() == branching_bit &&
+               node.left_tree() == left_tree && node.right_tree() == right_tree;
+      },
+      [&] {
+        return make_pooled_shared< const Node >(prefix,
+                                                branching_bit,
+                                                left_tree,
+                                                right_tree);
+      });
+}
+
+/// \brief Create a node with two non-null children
+template < typename Key >
+inline std::shared_ptr< const PatriciaTreeNode< Key > > create_node(
+    Index prefix,
+    Index branching_bit,
+    const std::shared_ptr< const PatriciaTree< Key > >& left_tree,
+    const std::shared_ptr< const PatriciaTree< Key > >& right_tree) {
+  return create_node(prefix,
+                     branching_bit,
+                     left_tree,
+                     right_tree,
+                     HashConsingTag< Key >());
+}
+
 /// \brief Create a node
 ///
 /// Prevent the creation of a node with only one child.
@@ -486,10 +654,7 @@ inline std::shared_ptr< const PatriciaTree< Key > > make_node(
   if (right_tree == nullptr) {
     return left_tree;
   }
-  return std::make_shared< const PatriciaTreeNode< Key > >(prefix,
-                                                           branching_bit,
-                                                           left_tree,
-                                                           right_tree);
+  return create_node< Key >(prefix, branching_bit, left_tree, right_tree);
 }
 
 /// \brief Join non-null patricia trees
@@ -504,15 +669,9 @@ inline std::shared_ptr< const PatriciaTreeNode< Key > > join_trees(
   Index m = branching_bit(prefix_s, prefix_t);
 
   if (is_zero_bit(prefix_s, m)) {
-    return std::make_shared< const PatriciaTreeNode< Key > >(mask(prefix_s, m),
-                                                             m,
-                                                             s,
-                                                             t);
+    return create_node< Key >(mask(prefix_s, m), m, s, t);
   } else {
-    return std::make_shared< const PatriciaTreeNode< Key > >(mask(prefix_s, m),
-                                                             m,
-                                                             t,
-                                                             s);
+    return create_node< Key >(mask(prefix_s, m), m, t, s);
   }
 }
 
@@ -520,14 +679,14 @@ template < typename Key >
 inline std::shared_ptr< const PatriciaTree< Key > > insert(
     const std::shared_ptr< const PatriciaTree< Key > >& tree, const Key& key) {
   if (tree == nullptr) {
-    return std::make_shared< const PatriciaTreeLeaf< Key > >(key);
+    return create_leaf< Key >(key);
   }
   if (tree->is_leaf()) {
     auto leaf = std::static_pointer_cast< const PatriciaTreeLeaf< Key > >(tree);
     if (leaf->key() == key) {
       return tree;
     }
-    auto new_leaf = std::make_shared< const PatriciaTreeLeaf< Key > >(key);
+    auto new_leaf = create_leaf< Key >(key);
     return join_trees< Key >(IndexableTraits< Key >::index(key),
                              new_leaf,
                              IndexableTraits< Key >::index(leaf->key()),
@@ -558,7 +717,7 @@ inline std::shared_ptr< const PatriciaTree< Key > > insert(
                        new_right_tree);
     }
   }
-  auto new_leaf = std::make_shared< const PatriciaTreeLeaf< Key > >(key);
+  auto new_leaf = create_leaf< Key >(key);
   return join_trees< Key >(IndexableTraits< Key >::index(key),
                            new_leaf,
                            node->prefix(),
@@ -898,6 +1057,44 @@ inline std::shared_ptr< const PatriciaTree< Key > > difference(
   return s;
 }
 
+/// \brief Build a patricia tree from a range of distinct keys sorted in the
+/// order of the tree
+template < typename Key, typename RandomAccessIterator >
+inline std::shared_ptr< const PatriciaTree< Key > > build_sorted(
+    RandomAccessIterator first, RandomAccessIterator last) {
+  if (first == last) {
+    return nullptr;
+  }
+  if (std::next(first) == last) {
+    return create_leaf< Key >(*first);
+  }
+
+  // The first and last keys differ on the branching bit of the whole range
+  Index p = IndexableTraits< Key >::index(*first);
+  Index m = branching_bit(p, IndexableTraits< Key >::index(*std::prev(last)));
+  ikos_assert(is_zero_bit(p, m));
+
+  auto middle = std::partition_point(first, last, [m](const Key& key) {
+    return is_zero_bit(IndexableTraits< Key >::index(key), m);
+  });
+  return create_node< Key >(mask(p, m),
+                            m,
+                            build_sorted< Key >(first, middle),
+                            build_sorted< Key >(middle, last));
+}
+
+/// \brief Join a non-empty range of patricia trees, pairwise
+template < typename Key, typename RandomAccessIterator >
+inline std::shared_ptr< const PatriciaTree< Key > > join_many(
+    RandomAccessIterator first, RandomAccessIterator last) {
+  ikos_assert(first != last);
+  if (std::next(first) == last) {
+    return *first;
+  }
+  auto middle = first + (last - first) / 2;
+  return join(join_many< Key >(first, middle), join_many< Key >(middle, last));
+}
+
 template < typename Key >
 class PatriciaTreeIterator final {
 public:
@@ -0,0 +1,461 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Patricia tree set with inline storage for small sets
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include <ikos/core/adt/patricia_tree/set.hpp>
+#include <ikos/core/semantic/dumpable.hpp>
+#include <ikos/core/semantic/indexable.hpp>
+#include <ikos/core/support/assert.hpp>
+
+namespace ikos {
+namespace core {
+
+/// \brief Set that stores up to N elements inline, and uses a patricia tree
+/// set above that
+///
+/// Small sets do not require any heap allocation. Elements are kept in the
+/// order of the patricia tree, so the iteration order does not depend on the
+/// representation.
+///
+/// Requirements:
+///
+/// Key must implement IndexableTraits
+/// Key must implement bool Key::operator==(const Key&) const
+/// Key must be default constructible
+template < typename Key, std::size_t N = 4 >
+class SmallPatriciaTreeSet final {
+public:
+  static_assert(N > 0, "N must be strictly positive");
+
+private:
+  using PatriciaTreeSetT = PatriciaTreeSet< Key >;
+
+public:
+  class Iterator;
+
+private:
+  /// \brief Inline elements, used if the set has at most N elements
+  std::array< Key, N > _elements;
+
+  /// \brief Number of inline elements
+  std::size_t _size = 0;
+
+  /// \brief Patricia tree, used if the set has more than N elements
+  PatriciaTreeSetT _tree;
+
+public:
+  /// \brief Create an empty set
+  SmallPatriciaTreeSet() = default;
+
+  /// \brief Create a set with the given elements
+  SmallPatriciaTreeSet(std::initializer_list< Key > elements)
+      : SmallPatriciaTreeSet(elements.begin(), elements.end()) {}
+
+  /// \brief Create a set with the content of the range [first, last)
+  template < typename InputIterator >
+  SmallPatriciaTreeSet(InputIterator first, InputIterator last) {
+    for (auto it = first; it != last; ++it) {
+      this->insert(*it);
+    }
+  }
+
+  /// \brief Copy constructor
+  SmallPatriciaTreeSet(const SmallPatriciaTreeSet&) = default;
+
+  /// \brief Move constructor
+  SmallPatriciaTreeSet(SmallPatriciaTreeSet&&) noexcept = default;
+
+  /// \brief Copy assignment operator
+  SmallPatriciaTreeSet& operator=(const SmallPatriciaTreeSet&) = default;
+
+  /// \brief Move assignment operator
+  SmallPatriciaTreeSet& operator=(SmallPatriciaTreeSet&&) noexcept = default;
+
+  /// \brief Destructor
+  ~SmallPatriciaTreeSet() = default;
+
+  /// \brief Return true if the set is empty
+  bool empty() const { return this->size() == 0; }
+
+  /// \brief Return the number of elements in the set
+  std::size_t size() const {
+    return this->is_inline() ? this->_size : this->_tree.size();
+  }
+
+  /// \brief Return true if the elements are stored inline
+  bool is_inline() const { return this->_tree.empty(); }
+
+  /// \brief Return an estimate of the memory allocated on the heap, in bytes
+  std::size_t size_in_bytes() const { return this->_tree.size_in_bytes(); }
+
+  /// \brief Clear the content of the set
+  void clear() {
+    this->_size = 0;
+    this->_tree.clear();
+  }
+
+  /// \brief Return true if the set contains the given key
+  bool contains(const Key& key) const {
+    if (this->is_inline()) {
+      return this->find(key) != this->inline_end();
+    } else {
+      return this->_tree.contains(key);
+    }
+  }
+
+  /// \brief Return true if the set is a subset of `other`
+  bool is_subset_of(const SmallPatriciaTreeSet& other) const {
+    if (this->size() > other.size()) {
+      return false;
+    } else if (this->is_inline()) {
+      return std::all_of(this->inline_begin(),
+                         this->inline_end(),
+                         [&other](const Key& key) {
+                           return other.contains(key);
+                         });
+    } else {
+      return this->_tree.is_subset_of(other._tree);
+    }
+  }
+
+  /// \brief Return true if the sets are equal
+  bool equals(const SmallPatriciaTreeSet& other) const {
+    if (this->is_inline() != other.is_inline()) {
+      return false;
+    } else if (this->is_inline()) {
+      return std::equal(this->inline_begin(),
+                        this->inline_end(),
+                        other.inline_begin(),
+                        other.inline_end());
+    } else {
+      return this->_tree.equals(other._tree);
+    }
+  }
+
+  /// \brief Return true if the sets are equal
+  bool operator==(const SmallPatriciaTreeSet& other) const {
+    return this->equals(other);
+  }
+
+  /// \brief Return the begin iterator over the elements of the set
+  Iterator begin() const {
+    if (this->is_inline()) {
+      return Iterator(this->inline_begin());
+    } else {
+      return Iterator(this->_tree.begin());
+    }
+  }
+
+  /// \brief Return the end iterator over the elements of the set
+  Iterator end() const {
+    if (this->is_inline()) {
+      return Iterator(this->inline_end());
+    } else {
+      return Iterator(this->_tree.end());
+    }
+  }
+
+  /// \brief Insert an element in the set
+  void insert(const Key& key) {
+    if (!this->is_inline()) {
+      this->_tree.insert(key);
+      return;
+    }
+    Key* it = this->lower_bound(key);
+    if (it != this->inline_end() && *it == key) {
+      return;
+    }
+    if (this->_size < N) {
+      std::move_backward(it, this->inline_end(), this->inline_end() + 1);
+      *it = key;
+      this->_size++;
+    } else {
+      std::vector< Key > keys;
+      keys.reserve(N + 1);
+      keys.insert(keys.end(), this->inline_begin(), it);
+      keys.push_back(key);
+      keys.insert(keys.end(), it, this->inline_end());
+      this->_tree = PatriciaTreeSetT::from_sorted_range(keys.begin(),
+                                                        keys.end());
+      this->_size = 0;
+    }
+  }
+
+  /// \brief Remove an element from the set
+  void erase(const Key& key) {
+    if (this->is_inline()) {
+      Key* it = this->find(key);
+      if (it != this->inline_end()) {
+        std::move(it + 1, this->inline_end(), it);
+        this->_size--;
+      }
+    } else {
+      this->_tree.erase(key);
+      this->shrink();
+    }
+  }
+
+  /// \brief Remove the elements for which predicate(e) returns false
+  template < typename Predicate >
+  void filter(const Predicate& pred) {
+    if (this->is_inline()) {
+      Key* last = std::remove_if(this->inline_begin(),
+                                 this->inline_end(),
+                                 [&pred](const Key& key) {
+                                   return !pred(key);
+                                 });
+      this->_size = static_cast< std::size_t >(last - this->inline_begin());
+    } else {
+      this->_tree.filter(pred);
+      this->shrink();
+    }
+  }
+
+  /// \brief Perform the union of two sets
+  void join_with(const SmallPatriciaTreeSet& other) {
+    if (!this->is_inline() && !other.is_inline()) {
+      this->_tree.join_with(other._tree);
+    } else if (other.is_inline()) {
+      for (const Key& key : other) {
+        this->insert(key);
+      }
+    } else {
+      SmallPatriciaTreeSet result = other;
+      for (const Key& key : *this) {
+        result._tree.insert(key);
+      }
+      *this = std::move(result);
+    }
+  }
+
+  /// \brief Perform the union of two sets
+  SmallPatriciaTreeSet join(const SmallPatriciaTreeSet& other) const {
+    SmallPatriciaTreeSet tmp(*this);
+    tmp.join_with(other);
+    return tmp;
+  }
+
+  /// \brief Perform the intersection of two sets
+  void intersect_with(const SmallPatriciaTreeSet& other) {
+    if (!this->is_inline() && !other.is_inline()) {
+      this->_tree.intersect_with(other._tree);
+      this->shrink();
+    } else if (this->is_inline()) {
+      this->filter([&other](const Key& key) { return other.contains(key); });
+    } else {
+      SmallPatriciaTreeSet result = other;
+      result.filter([this](const Key& key) { return this->contains(key); });
+      *this = std::move(result);
+    }
+  }
+
+  /// \brief Perform the intersection of two sets
+  SmallPatriciaTreeSet intersect(const SmallPatriciaTreeSet& other) const {
+    SmallPatriciaTreeSet tmp(*this);
+    tmp.intersect_with(other);
+    return tmp;
+  }
+
+  /// \brief Perform the difference of two sets
+  void difference_with(const SmallPatriciaTreeSet& other) {
+    if (!this->is_inline() && !other.is_inline()) {
+      this->_tree.difference_with(other._tree);
+      this->shrink();
+    } else if (other.is_inline()) {
+      for (const Key& key : other) {
+        this->erase(key);
+      }
+    } else {
+      this->filter([&other](const Key& key) { return !other.contains(key); });
+    }
+  }
+
+  /// \brief Perform the difference of two sets
+  SmallPatriciaTreeSet difference(const SmallPatriciaTreeSet& other) const {
+    SmallPatriciaTreeSet tmp(*this);
+    tmp.difference_with(other);
+    return tmp;
+  }
+
+  /// \brief Dump the set, for debugging purpose
+  void dump(std::ostream& o) const {
+    static_assert(IsDumpable< Key >::value,
+                  "Key must implement DumpableTraits");
+    o << "{";
+    for (auto it = this->begin(), et = this->end(); it != et;) {
+      DumpableTraits< Key >::dump(o, *it);
+      ++it;
+      if (it != et) {
+        o << "; ";
+      }
+    }
+    o << "}";
+  }
+
+private:
+  /// \brief Begin of the inline elements
+  Key* inline_begin() { return this->_elements.data(); }
+
+  /// \brief Begin of the inline elements
+  const Key* inline_begin() const { return this->_elements.data(); }
+
+  /// \brief End of the inline elements
+  Key* inline_end() { return this->_elements.data() + this->_size; }
+
+  /// \brief End of the inline elements
+  const Key* inline_end() const {
+    return this->_elements.data() + this->_size;
+  }
+
+  /// \brief Return true if `a` comes before `b` in the order of the tree
+  static bool less(const Key& a, const Key& b) {
+    using IndexableTraitsT = IndexableTraits< Key >;
+    return patricia_tree_utils::tree_order_less(IndexableTraitsT::index(a),
+                                                IndexableTraitsT::index(b));
+  }
+
+  /// \brief Return the first inline element not before `key`
+  Key* lower_bound(const Key& key) {
+    return std::lower_bound(this->inline_begin(),
+                            this->inline_end(),
+                            key,
+                            less);
+  }
+
+  /// \brief Return the inline element equal to `key`, or inline_end()
+  Key* find(const Key& key) {
+    return std::find(this->inline_begin(), this->inline_end(), key);
+  }
+
+  /// \brief Return the inline element equal to `key`, or inline_end()
+  const Key* find(const Key& key) const {
+    return std::find(this->inline_begin(), this->inline_end(), key);
+  }
+
+  /// \brief Move the elements of the tree inline, if there are at most N
+  void shrink() {
+    if (this->_tree.empty() || this->_tree.size() > N) {
+      return;
+    }
+    std::copy(this->_tree.begin(), this->_tree.end(), this->inline_begin());
+    this->_size = this->_tree.size();
+    this->_tree.clear();
+  }
+
+public:
+  /// \brief Iterator over the elements of a small set
+  class Iterator final {
+  public:
+    // Required types for iterators
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = const Key&;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Key*;
+    using reference = const Key&;
+
+  private:
+    /// \brief Current inline element, or nullptr if iterating on the tree
+    const Key* _ptr = nullptr;
+
+    typename PatriciaTreeSetT::Iterator _it;
+
+  public:
+    /// \brief Create an end iterator
+    Iterator() = default;
+
+    /// \brief Create an iterator on inline elements
+    explicit Iterator(const Key* ptr) : _ptr(ptr) {}
+
+    /// \brief Create an iterator on a patricia tree
+    explicit Iterator(typename PatriciaTreeSetT::Iterator it)
+        : _it(std::move(it)) {}
+
+    /// \brief Pre-increment the iterator
+    Iterator& operator++() {
+      if (this->_ptr != nullptr) {
+        ++this->_ptr;
+      } else {
+        ++this->_it;
+      }
+      return *this;
+    }
+
+    /// \brief Post-increment the iterator
+    const Iterator operator++(int) {
+      Iterator r = *this;
+      ++(*this);
+      return r;
+    }
+
+    /// \brief Compare two iterators
+    bool operator==(const Iterator& other) const {
+      return this->_ptr == other._ptr && this->_it == other._it;
+    }
+
+    /// \brief Compare two iterators
+    bool operator!=(const Iterator& other) const {
+      return !this->operator==(other);
+    }
+
+    /// \brief Dereference the iterator
+    reference operator*() const {
+      return this->_ptr != nullptr ? *this->_ptr : *this->_it;
+    }
+
+    /// \brief Dereference the iterator
+    pointer operator->() const { return &this->operator*(); }
+
+  }; // end class Iterator
+
+}; // end class SmallPatriciaTreeSet
+
+} // end namespace core
+} // end namespace ikos
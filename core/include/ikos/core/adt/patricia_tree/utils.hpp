@@ -45,12 +45,120 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+
 #include <ikos/core/semantic/indexable.hpp>
 
 namespace ikos {
 namespace core {
+
+/// \brief Hash-consing of patricia trees
+///
+/// With hash-consing, the nodes and leaves of patricia trees are interned:
+/// structurally equal trees built by the same thread share the same pointer.
+/// This makes the pointer equality short-circuits of the tree operations
+/// (e.g, leq, equals, join, meet) apply to independently built subtrees, at
+/// the cost of a hash table lookup for each created node.
+///
+/// Hash-consing is disabled by default. To enable it for
+/// PatriciaTreeSet< Key >, specialize PatriciaTreeHashConsing< Key > with:
+///
+/// \code{.cpp}
+/// static constexpr bool enabled = true;
+/// \endcode
+///
+/// To enable it for PatriciaTreeMap< Key, Value >, specialize
+/// PatriciaTreeHashConsing< Key, Value > with:
+///
+/// \code{.cpp}
+/// static constexpr bool enabled = true;
+/// static std::size_t hash(const Value&);
+/// \endcode
+template < typename Key, typename Value = void >
+struct PatriciaTreeHashConsing {
+  static constexpr bool enabled = false;
+};
+
 namespace patricia_tree_utils {
 
+/// \brief Tag to dispatch on PatriciaTreeHashConsing
+template < typename Key, typename Value = void >
+using HashConsingTag =
+    std::integral_constant< bool,
+                            PatriciaTreeHashConsing< Key, Value >::enabled >;
+
+/// \brief Table of interned trees of the current thread, for hash-consing
+///
+/// Trees are stored as weak pointers, and expired entries are removed
+/// lazily. There is one table per thread, thus pointer equality still implies
+/// structural equality, but equal trees built by different threads might not
+/// share the same pointer.
+template < typename Tree >
+class InterningTable {
+private:
+  using Map =
+      std::unordered_multimap< std::size_t, std::weak_ptr< const Tree > >;
+
+  /// \brief Minimum number of entries before removing expired entries
+  static constexpr std::size_t MinSweepThreshold = 1024;
+
+private:
+  Map _map;
+  std::size_t _sweep_threshold = MinSweepThreshold;
+
+public:
+  /// \brief Return the table of the current thread
+  static InterningTable& get() {
+    static thread_local InterningTable table;
+    return table;
+  }
+
+  /// \brief Return the interned tree with the given hash satisfying `match`,
+  /// or intern the tree returned by `make`
+  template < typename Match, typename Make >
+  std::shared_ptr< const Tree > intern(std::size_t hash,
+                                       Match match,
+                                       Make make) {
+    auto range = this->_map.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      std::shared_ptr< const Tree > tree = it->second.lock();
+      if (tree != nullptr && match(*tree)) {
+        return tree;
+      }
+    }
+
+    if (this->_map.size() >= this->_sweep_threshold) {
+      this->sweep();
+    }
+
+    std::shared_ptr< const Tree > tree = make();
+    this->_map.emplace(hash, tree);
+    return tree;
+  }
+
+private:
+  /// \brief Remove the expired entries
+  void sweep() {
+    for (auto it = this->_map.begin(); it != this->_map.end();) {
+      if (it->second.expired()) {
+        it = this->_map.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    this->_sweep_threshold =
+        std::max(MinSweepThreshold, 2 * this->_map.size());
+  }
+
+}; // end class InterningTable
+
+template < typename Tree >
+constexpr std::size_t InterningTable< Tree >::MinSweepThreshold;
+
 // Requirements on the Index type defined in indexable.hpp
 static_assert(std::is_unsigned< Index >::value, "Index must be unsigned");
 static_assert(sizeof(Index) >= sizeof(std::intptr_t),
@@ -76,6 +184,14 @@ inline Index branching_bit(Index prefix0, Index prefix1) {
   return lowest_bit(prefix0 ^ prefix1);
 }
 
+/// \brief Return true if the index `a` comes before `b` in a patricia tree
+///
+/// Patricia trees branch on the lowest differing bit, with the zero bit on the
+/// left. This is the lexicographical order of the reversed bits.
+inline bool tree_order_less(Index a, Index b) {
+  return a != b && is_zero_bit(a, branching_bit(a, b));
+}
+
 } // end namespace patricia_tree_utils
 } // end namespace core
 } // end namespace ikos
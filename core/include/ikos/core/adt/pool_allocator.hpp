@@ -0,0 +1,428 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Allocator using per-thread pools of fixed-size blocks
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <ikos/core/support/compiler.hpp>
+
+namespace ikos {
+namespace core {
+
+namespace pool_allocator_impl {
+
+/// \brief Free block, with a pointer to the next free block
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+/// \brief Registry of the trim functions of the block pools
+class TrimRegistry {
+public:
+  using TrimFunction = std::size_t (*)();
+
+private:
+  std::mutex _mutex;
+  std::vector< TrimFunction > _functions;
+
+public:
+  /// \brief Return the registry
+  static TrimRegistry& get() {
+    // Never destroyed, like the free lists
+    static TrimRegistry* registry = new TrimRegistry();
+    return *registry;
+  }
+
+  /// \brief Register the trim function of a block pool
+  bool add(TrimFunction f) {
+    std::lock_guard< std::mutex > lock(this->_mutex);
+    this->_functions.push_back(f);
+    return true;
+  }
+
+  /// \brief Call all the trim functions, return the number of bytes released
+  std::size_t trim() {
+    std::vector< TrimFunction > functions;
+    {
+      std::lock_guard< std::mutex > lock(this->_mutex);
+      functions = this->_functions;
+    }
+    std::size_t released = 0;
+    for (TrimFunction f : functions) {
+      released += f();
+    }
+    return released;
+  }
+
+}; // end class TrimRegistry
+
+/// \brief Pool of blocks of a given size
+///
+/// Each thread has its own free list, thus allocations and deallocations do
+/// not require any synchronization. Blocks are allocated by chunks, and only
+/// returned to the system by trim(). When a thread exits, its free blocks are
+/// moved to a global free list, to be reused by other threads.
+template < std::size_t BlockSize >
+class BlockPool {
+private:
+  static_assert(BlockSize >= sizeof(FreeBlock), "BlockSize is too small");
+
+  /// \brief Number of blocks per chunk
+  static constexpr std::size_t ChunkBlocks = 64;
+
+  /// \brief Size of a chunk, in bytes
+  static constexpr std::size_t ChunkSize = BlockSize * ChunkBlocks;
+
+  /// \brief Free list shared by all threads
+  struct GlobalFreeList {
+    std::mutex mutex;
+    FreeBlock* head = nullptr;
+    FreeBlock* tail = nullptr;
+
+    /// \brief Chunks allocated by the pool, sorted by address
+    std::vector< char* > chunks;
+  };
+
+  /// \brief Free list of a thread
+  ///
+  /// This is trivially destructible, so that it can still be used during the
+  /// destruction of static objects.
+  struct LocalFreeList {
+    FreeBlock* head;
+    FreeBlock* tail;
+    bool released;
+  };
+
+  /// \brief Move the thread free list to the global free list on thread exit
+  struct LocalFreeListReleaser {
+    ~LocalFreeListReleaser() {
+      LocalFreeList& local = local_free_list();
+      release(local.head, local.tail);
+      local.head = nullptr;
+      local.tail = nullptr;
+      local.released = true;
+    }
+  };
+
+private:
+  /// \brief Return the global free list
+  static GlobalFreeList& global_free_list() {
+    // Never destroyed, blocks might be freed during the static destruction
+    static GlobalFreeList* list = new GlobalFreeList();
+    return *list;
+  }
+
+  /// \brief Return the free list of the current thread
+  static LocalFreeList& local_free_list() {
+    static thread_local LocalFreeList list = {nullptr, nullptr, false};
+    return list;
+  }
+
+  /// \brief Move the list of blocks from `head` to `tail` to the global free
+  /// list
+  static void release(FreeBlock* head, FreeBlock* tail) {
+    if (head == nullptr) {
+      return;
+    }
+    GlobalFreeList& global = global_free_list();
+    std::lock_guard< std::mutex > lock(global.mutex);
+    tail->next = global.head;
+    if (global.head == nullptr) {
+      global.tail = tail;
+    }
+    global.head = head;
+  }
+
+  /// \brief Fill the empty free list of the current thread
+  static void refill(LocalFreeList& local) {
+    GlobalFreeList& global = global_free_list();
+    {
+      std::lock_guard< std::mutex > lock(global.mutex);
+      if (global.head != nullptr) {
+        local.head = global.head;
+        local.tail = global.tail;
+        global.head = nullptr;
+        global.tail = nullptr;
+        return;
+      }
+    }
+
+    static bool registered = TrimRegistry::get().add(&BlockPool::trim);
+    ikos_ignore(registered);
+
+    auto chunk = static_cast< char* >(::operator new(ChunkSize));
+    FreeBlock* head = nullptr;
+    for (std::size_t i = ChunkBlocks; i > 0; i--) {
+      auto block = reinterpret_cast< FreeBlock* >(chunk + (i - 1) * BlockSize);
+      block->next = head;
+      head = block;
+    }
+    local.head = head;
+    local.tail = reinterpret_cast< FreeBlock* >(chunk + ChunkSize - BlockSize);
+
+    std::lock_guard< std::mutex > lock(global.mutex);
+    global.chunks.insert(std::upper_bound(global.chunks.begin(),
+                                          global.chunks.end(),
+                                          chunk),
+                         chunk);
+  }
+
+public:
+  /// \brief Allocate a block
+  static void* allocate() {
+    LocalFreeList& local = local_free_list();
+    if (ikos_unlikely(local.released)) {
+      // The thread is exiting
+      return ::operator new(BlockSize);
+    }
+    if (ikos_unlikely(local.head == nullptr)) {
+      static thread_local LocalFreeListReleaser releaser;
+      ikos_ignore(releaser);
+      refill(local);
+    }
+    FreeBlock* block = local.head;
+    local.head = block->next;
+    if (local.head == nullptr) {
+      local.tail = nullptr;
+    }
+    return block;
+  }
+
+  /// \brief Deallocate a block
+  static void deallocate(void* p) {
+    auto block = static_cast< FreeBlock* >(p);
+    LocalFreeList& local = local_free_list();
+    if (ikos_unlikely(local.released)) {
+      // The thread is exiting
+      release(block, block);
+      return;
+    }
+    block->next = local.head;
+    if (local.head == nullptr) {
+      local.tail = block;
+    }
+    local.head = block;
+  }
+
+  /// \brief Return the chunks whose blocks are all free to the system
+  ///
+  /// Only the blocks in the global free list and in the free list of the
+  /// calling thread are considered free. The free lists of the other threads
+  /// are left untouched.
+  ///
+  /// Returns the number of bytes released.
+  static std::size_t trim() {
+    LocalFreeList& local = local_free_list();
+    GlobalFreeList& global = global_free_list();
+    std::lock_guard< std::mutex > lock(global.mutex);
+
+    // Take all the free blocks
+    std::vector< FreeBlock* > blocks;
+    for (FreeBlock* b = global.head; b != nullptr; b = b->next) {
+      blocks.push_back(b);
+    }
+    for (FreeBlock* b = local.head; b != nullptr; b = b->next) {
+      blocks.push_back(b);
+    }
+    global.head = nullptr;
+    global.tail = nullptr;
+    local.head = nullptr;
+    local.tail = nullptr;
+
+    // Count the free blocks of each chunk
+    std::vector< std::size_t > counts(global.chunks.size(), 0);
+    std::vector< std::size_t > owners(blocks.size(), global.chunks.size());
+    for (std::size_t k = 0; k < blocks.size(); k++) {
+      auto p = reinterpret_cast< char* >(blocks[k]);
+      auto it =
+          std::upper_bound(global.chunks.begin(), global.chunks.end(), p);
+      if (it != global.chunks.begin() && p < *std::prev(it) + ChunkSize) {
+        owners[k] = static_cast< std::size_t >(
+            std::distance(global.chunks.begin(), std::prev(it)));
+        counts[owners[k]]++;
+      }
+    }
+
+    // Put back the blocks of the chunks still in use, and the blocks
+    // allocated by exiting threads, which do not belong to a chunk
+    for (std::size_t k = 0; k < blocks.size(); k++) {
+      if (owners[k] == global.chunks.size() ||
+          counts[owners[k]] != ChunkBlocks) {
+        blocks[k]->next = global.head;
+        if (global.head == nullptr) {
+          global.tail = blocks[k];
+        }
+        global.head = blocks[k];
+      }
+    }
+
+    // Release the chunks whose blocks are all free
+    std::size_t released = 0;
+    std::vector< char* > chunks;
+    for (std::size_t i = 0; i < global.chunks.size(); i++) {
+      if (counts[i] == ChunkBlocks) {
+        ::operator delete(global.chunks[i]);
+        released += ChunkSize;
+      } else {
+        chunks.push_back(global.chunks[i]);
+      }
+    }
+    global.chunks.swap(chunks);
+    return released;
+  }
+
+}; // end class BlockPool
+
+template < std::size_t BlockSize >
+constexpr std::size_t BlockPool< BlockSize >::ChunkBlocks;
+
+template < std::size_t BlockSize >
+constexpr std::size_t BlockPool< BlockSize >::ChunkSize;
+
+/// \brief Round up the given size to a valid block size
+constexpr std::size_t block_size(std::size_t size) {
+  return ((size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t)) *
+         alignof(std::max_align_t);
+}
+
+} // end namespace pool_allocator_impl
+
+/// \brief Return the free memory of the block pools to the system
+///
+/// This only releases the chunks of blocks that are all free, and ignores the
+/// free blocks cached by threads other than the calling one. It is meant to
+/// be called before giving up on a memory budget.
+///
+/// Returns the number of bytes released.
+inline std::size_t trim_pool_allocators() {
+  return pool_allocator_impl::TrimRegistry::get().trim();
+}
+
+/// \brief Allocator using per-thread pools of fixed-size blocks
+///
+/// This is intended for small objects that are allocated and freed very
+/// often, e.g, the nodes of patricia trees. Single object allocations never
+/// lock, and memory is reused instead of being returned to the system, unless
+/// trim_pool_allocators() is called.
+///
+/// It can be disabled by defining IKOS_DISABLE_POOL_ALLOCATOR, in which case
+/// it uses the global operator new (e.g, for memory sanitizers).
+template < typename T >
+class PoolAllocator {
+public:
+  using value_type = T;
+
+  template < typename U >
+  struct rebind {
+    using other = PoolAllocator< U >;
+  };
+
+private:
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "PoolAllocator does not support over-aligned types");
+
+  using BlockPool =
+      pool_allocator_impl::BlockPool< pool_allocator_impl::block_size(
+          sizeof(T)) >;
+
+public:
+  /// \brief Constructor
+  PoolAllocator() noexcept = default;
+
+  /// \brief Converting constructor
+  template < typename U >
+  PoolAllocator(const PoolAllocator< U >&) noexcept {}
+
+  /// \brief Allocate memory for `n` objects
+  T* allocate(std::size_t n) {
+#ifndef IKOS_DISABLE_POOL_ALLOCATOR
+    if (ikos_likely(n == 1)) {
+      return static_cast< T* >(BlockPool::allocate());
+    }
+#endif
+    return static_cast< T* >(::operator new(n * sizeof(T)));
+  }
+
+  /// \brief Deallocate memory for `n` objects
+  void deallocate(T* p, std::size_t n) noexcept {
+#ifndef IKOS_DISABLE_POOL_ALLOCATOR
+    if (ikos_likely(n == 1)) {
+      BlockPool::deallocate(p);
+      return;
+    }
+#endif
+    ::operator delete(p);
+  }
+
+}; // end class PoolAllocator
+
+template < typename T, typename U >
+inline bool operator==(const PoolAllocator< T >&, const PoolAllocator< U >&) {
+  return true;
+}
+
+template < typename T, typename U >
+inline bool operator!=(const PoolAllocator< T >&, const PoolAllocator< U >&) {
+  return false;
+}
+
+/// \brief Create a std::shared_ptr using PoolAllocator
+///
+/// The object and its reference counts are allocated in a single block.
+template < typename T, typename... Args >
+inline std::shared_ptr< T > make_pooled_shared(Args&&... args) {
+  return std::allocate_shared< T >(PoolAllocator< std::remove_cv_t< T > >(),
+                                   std::forward< Args >(args)...);
+}
+
+} // end namespace core
+} // end namespace ikos
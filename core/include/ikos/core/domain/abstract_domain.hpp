@@ -43,6 +43,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <iosfwd>
 #include <string>
 #include <type_traits>
@@ -158,6 +159,12 @@ public:
   /// define a narrowing operator and can simply use the meet instead.
   virtual void narrow_with(const Derived& other) = 0;
 
+  /// \brief Normalize the abstract value
+  ///
+  /// Some abstract domains normalize their abstract values lazily, in const
+  /// methods. By default, this does nothing.
+  virtual void normalize() const {}
+
   /// \brief Perform the union of two abstract values
   virtual Derived join(const Derived& other) const {
     Derived tmp(static_cast< const Derived& >(*this));
@@ -201,6 +208,13 @@ public:
     return tmp;
   }
 
+  /// \brief Return an estimate of the memory used by the abstract value, in
+  /// bytes
+  ///
+  /// This is used to find which abstract domain is growing. By default, it
+  /// only counts the object itself.
+  virtual std::size_t size_in_bytes() const { return sizeof(Derived); }
+
   /// \brief Dump the abstract value, for debugging purpose
   virtual void dump(std::ostream&) const = 0;
 
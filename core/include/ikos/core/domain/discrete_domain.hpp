@@ -47,7 +47,7 @@
 
 #include <boost/optional.hpp>
 
-#include <ikos/core/adt/patricia_tree/set.hpp>
+#include <ikos/core/adt/patricia_tree/small_set.hpp>
 #include <ikos/core/domain/abstract_domain.hpp>
 
 namespace ikos {
@@ -55,18 +55,19 @@ namespace core {
 
 /// \brief Discrete abstract domain
 ///
-/// The implementation is based on patricia trees.
+/// The implementation is based on patricia trees, with inline storage for
+/// small sets.
 template < typename Element >
 class DiscreteDomain final
     : public AbstractDomain< DiscreteDomain< Element > > {
 private:
-  using PatriciaTreeSetT = PatriciaTreeSet< Element >;
+  using SetT = SmallPatriciaTreeSet< Element >;
 
 public:
-  using Iterator = typename PatriciaTreeSetT::Iterator;
+  using Iterator = typename SetT::Iterator;
 
 private:
-  PatriciaTreeSetT _set;
+  SetT _set;
   bool _top;
 
 private:
@@ -241,6 +242,10 @@ public:
     return this->is_top() || this->_set.contains(e);
   }
 
+  std::size_t size_in_bytes() const override {
+    return sizeof(DiscreteDomain) + this->_set.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     if (this->is_top()) {
       o << "⊤";
@@ -67,19 +67,33 @@ private:
   Domain2 _second;
   bool _is_bottom;
 
+  /// \brief True if the first abstract value might have been modified since
+  /// the last normalization
+  bool _first_changed;
+
+  /// \brief True if the second abstract value might have been modified since
+  /// the last normalization
+  bool _second_changed;
+
 private:
   struct TopTag {};
   struct BottomTag {};
 
   /// \brief Create the top abstract value
   explicit DomainProduct2(TopTag)
-      : _first(Domain1::top()), _second(Domain2::top()), _is_bottom(false) {}
+      : _first(Domain1::top()),
+        _second(Domain2::top()),
+        _is_bottom(false),
+        _first_changed(false),
+        _second_changed(false) {}
 
   /// \brief Create the bottom abstract value
   explicit DomainProduct2(BottomTag)
       : _first(Domain1::bottom()),
         _second(Domain2::bottom()),
-        _is_bottom(true) {}
+        _is_bottom(true),
+        _first_changed(false),
+        _second_changed(false) {}
 
 public:
   /// \brief Create the top abstract value
@@ -89,7 +103,9 @@ public:
   DomainProduct2(Domain1 first, Domain2 second)
       : _first(std::move(first)),
         _second(std::move(second)),
-        _is_bottom(false) {
+        _is_bottom(false),
+        _first_changed(true),
+        _second_changed(true) {
     this->normalize();
   }
 
@@ -115,19 +131,35 @@ public:
   static DomainProduct2 bottom() { return DomainProduct2(BottomTag{}); }
 
   /// \brief Normalize the abstract value
-  void normalize() const {
+  ///
+  /// Only the abstract values modified since the last normalization are
+  /// checked for bottom.
+  void normalize() const override {
+    if (!this->_first_changed && !this->_second_changed) {
+      return;
+    }
+    auto self = const_cast< DomainProduct2* >(this);
     if (!this->_is_bottom) {
-      auto self = const_cast< DomainProduct2* >(this);
-      if (this->_first.is_bottom()) {
+      if (this->_first_changed && this->_first.is_bottom()) {
         self->_second.set_to_bottom();
         self->_is_bottom = true;
-      } else if (this->_second.is_bottom()) {
+      } else if (this->_second_changed && this->_second.is_bottom()) {
         self->_first.set_to_bottom();
         self->_is_bottom = true;
       }
     }
+    self->_first_changed = false;
+    self->_second_changed = false;
   }
 
+  /// \brief Return true if the first abstract value might have been modified
+  /// since the last normalization
+  bool first_changed() const { return this->_first_changed; }
+
+  /// \brief Return true if the second abstract value might have been modified
+  /// since the last normalization
+  bool second_changed() const { return this->_second_changed; }
+
   /// \brief Return the first abstract value
   ///
   /// Note: does not normalize.
@@ -136,7 +168,10 @@ public:
   /// \brief Return the first abstract value
   ///
   /// Note: does not normalize.
-  Domain1& first() { return this->_first; }
+  Domain1& first() {
+    this->_first_changed = true;
+    return this->_first;
+  }
 
   /// \brief Return the second abstract value
   ///
@@ -146,7 +181,10 @@ public:
   /// \brief Return the second abstract value
   ///
   /// Note: does not normalize.
-  Domain2& second() { return this->_second; }
+  Domain2& second() {
+    this->_second_changed = true;
+    return this->_second;
+  }
 
   bool is_bottom() const override {
     this->normalize();
@@ -161,12 +199,16 @@ public:
     this->_first.set_to_bottom();
     this->_second.set_to_bottom();
     this->_is_bottom = true;
+    this->_first_changed = false;
+    this->_second_changed = false;
   }
 
   void set_to_top() override {
     this->_first.set_to_top();
     this->_second.set_to_top();
     this->_is_bottom = false;
+    this->_first_changed = false;
+    this->_second_changed = false;
   }
 
   bool leq(const DomainProduct2& other) const override {
@@ -198,6 +240,8 @@ public:
     } else {
       this->_first.join_with(other._first);
       this->_second.join_with(other._second);
+      this->_first_changed = true;
+      this->_second_changed = true;
     }
   }
 
@@ -209,6 +253,8 @@ public:
     } else {
       this->_first.join_loop_with(other._first);
       this->_second.join_loop_with(other._second);
+      this->_first_changed = true;
+      this->_second_changed = true;
     }
   }
 
@@ -220,6 +266,8 @@ public:
     } else {
       this->_first.join_iter_with(other._first);
       this->_second.join_iter_with(other._second);
+      this->_first_changed = true;
+      this->_second_changed = true;
     }
   }
 
@@ -231,6 +279,8 @@ public:
     } else {
       this->_first.widen_with(other._first);
       this->_second.widen_with(other._second);
+      this->_first_changed = true;
+      this->_second_changed = true;
     }
   }
 
@@ -242,6 +292,8 @@ public:
     } else {
       this->_first.meet_with(other._first);
       this->_second.meet_with(other._second);
+      this->_first_changed = true;
+      this->_second_changed = true;
     }
   }
 
@@ -253,9 +305,15 @@ public:
     } else {
       this->_first.narrow_with(other._first);
       this->_second.narrow_with(other._second);
+      this->_first_changed = true;
+      this->_second_changed = true;
     }
   }
 
+  std::size_t size_in_bytes() const override {
+    return this->_first.size_in_bytes() + this->_second.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     if (this->is_bottom()) {
       o << "⊥";
@@ -330,7 +388,7 @@ public:
   }
 
   /// \brief Normalize the abstract value
-  void normalize() const { this->_product.normalize(); }
+  void normalize() const override { this->_product.normalize(); }
 
   /// \brief Return the first abstract value
   ///
@@ -402,6 +460,10 @@ public:
     this->_product.narrow_with(other._product);
   }
 
+  std::size_t size_in_bytes() const override {
+    return this->_product.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     if (this->is_bottom()) {
       o << "⊥";
@@ -95,7 +95,7 @@ public:
   virtual const UnderlyingDomain& caught_exceptions() const = 0;
 
   /// \brief Provide access to the state of all propagated exceptions
-  virtual UnderlyingDomain propagated_exceptions() = 0;
+  virtual UnderlyingDomain& propagated_exceptions() = 0;
 
   /// \brief Provide access to the state of all propagated exceptions
   virtual const UnderlyingDomain& propagated_exceptions() const = 0;
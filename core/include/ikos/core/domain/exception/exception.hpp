@@ -221,6 +221,12 @@ public:
     this->_propagated_exceptions.narrow_with(other._propagated_exceptions);
   }
 
+  void normalize() const override {
+    this->_normal.normalize();
+    this->_caught_exceptions.normalize();
+    this->_propagated_exceptions.normalize();
+  }
+
   /*
    * Implement exception::AbstractDomain
    */
@@ -237,7 +243,7 @@ public:
     return this->_caught_exceptions;
   }
 
-  UnderlyingDomain propagated_exceptions() override {
+  UnderlyingDomain& propagated_exceptions() override {
     return this->_propagated_exceptions;
   }
 
@@ -320,6 +326,12 @@ public:
     this->_normal.set_to_bottom();
   }
 
+  std::size_t size_in_bytes() const override {
+    return this->_normal.size_in_bytes() +
+           this->_caught_exceptions.size_in_bytes() +
+           this->_propagated_exceptions.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     o << "(normal=";
     this->_normal.dump(o);
@@ -44,6 +44,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <ikos/core/domain/abstract_domain.hpp>
 #include <ikos/core/semantic/memory_location.hpp>
 #include <ikos/core/value/lifetime.hpp>
@@ -92,6 +94,12 @@ public:
   /// \brief Get the lifetime value for the given memory location
   virtual Lifetime get(MemoryLocationRef x) const = 0;
 
+  /// \brief Return the memory locations known to be deallocated
+  virtual std::vector< MemoryLocationRef > deallocated() const = 0;
+
+  /// \brief Return the memory locations with a known lifetime
+  virtual std::vector< MemoryLocationRef > locations() const = 0;
+
 }; // end class AbstractDomain
 
 /// \brief Check if a type is a lifetime abstract domain
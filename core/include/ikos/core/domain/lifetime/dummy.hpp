@@ -159,6 +159,10 @@ public:
     }
   }
 
+  std::vector< MemoryLocationRef > deallocated() const override { return {}; }
+
+  std::vector< MemoryLocationRef > locations() const override { return {}; }
+
   void dump(std::ostream& o) const override {
     if (this->_is_bottom) {
       o << "⊥";
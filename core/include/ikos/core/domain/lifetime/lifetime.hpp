@@ -175,6 +175,34 @@ public:
 
   Lifetime get(MemoryLocationRef x) const override { return this->_inv.get(x); }
 
+  std::vector< MemoryLocationRef > deallocated() const override {
+    std::vector< MemoryLocationRef > locs;
+    if (this->is_bottom()) {
+      return locs;
+    }
+    for (auto it = this->_inv.begin(), et = this->_inv.end(); it != et; ++it) {
+      if (it->second.is_deallocated()) {
+        locs.push_back(it->first);
+      }
+    }
+    return locs;
+  }
+
+  std::vector< MemoryLocationRef > locations() const override {
+    std::vector< MemoryLocationRef > locs;
+    if (this->is_bottom()) {
+      return locs;
+    }
+    for (auto it = this->_inv.begin(), et = this->_inv.end(); it != et; ++it) {
+      locs.push_back(it->first);
+    }
+    return locs;
+  }
+
+  std::size_t size_in_bytes() const override {
+    return this->_inv.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override { return this->_inv.dump(o); }
 
   static std::string name() { return "lifetime domain"; }
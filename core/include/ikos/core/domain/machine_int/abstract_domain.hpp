@@ -43,6 +43,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <ikos/core/domain/abstract_domain.hpp>
 #include <ikos/core/domain/machine_int/operator.hpp>
 #include <ikos/core/linear_expression.hpp>
@@ -83,6 +85,22 @@ public:
     return tmp;
   }
 
+  /// \brief Perform the widening of two abstract values with a set of
+  /// thresholds
+  ///
+  /// An unstable bound is set to the closest threshold that includes it.
+  virtual void widen_threshold_with(
+      const Derived& other, const std::vector< MachineInt >& thresholds) = 0;
+
+  /// \brief Perform the widening of two abstract values with a set of
+  /// thresholds
+  virtual Derived widening_threshold(
+      const Derived& other, const std::vector< MachineInt >& thresholds) const {
+    Derived tmp(static_cast< const Derived& >(*this));
+    tmp.widen_threshold_with(other, thresholds);
+    return tmp;
+  }
+
   /// \brief Assign `x = n`
   virtual void assign(VariableRef x, const MachineInt& n) = 0;
 
@@ -250,6 +268,14 @@ template < typename T, typename VariableRef >
 struct IsAbstractDomain
     : std::is_base_of< machine_int::AbstractDomain< VariableRef, T >, T > {};
 
+/// \brief Check if a machine integer abstract domain is persistent
+///
+/// The abstract values of a persistent domain are handles on immutable data
+/// structures (e.g, Patricia trees): a copy does not allocate memory, and the
+/// const methods do not update a state shared with the copies.
+template < typename T >
+struct IsPersistentDomain : std::false_type {};
+
 } // end namespace machine_int
 } // end namespace core
 } // end namespace ikos
@@ -137,6 +137,12 @@ public:
     this->_inv.widen_threshold_with(other._inv, threshold);
   }
 
+  void widen_threshold_with(
+      const CongruenceDomain& other,
+      const std::vector< MachineInt >& thresholds) override {
+    this->_inv.widen_threshold_with(other._inv, thresholds);
+  }
+
   void meet_with(const CongruenceDomain& other) override {
     this->_inv.meet_with(other._inv);
   }
@@ -332,12 +338,21 @@ public:
     return IntervalCongruence(this->_inv.project(e));
   }
 
+  std::size_t size_in_bytes() const override {
+    return this->_inv.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override { return this->_inv.dump(o); }
 
   static std::string name() { return "congruence domain"; }
 
 }; // end class CongruenceDomain
 
+/// \brief The CongruenceDomain is a Patricia tree
+template < typename VariableRef >
+struct IsPersistentDomain< CongruenceDomain< VariableRef > >
+    : std::true_type {};
+
 } // end namespace machine_int
 } // end namespace core
 } // end namespace ikos
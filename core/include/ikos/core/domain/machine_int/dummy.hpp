@@ -120,6 +120,12 @@ public:
     return this->join_with(other);
   }
 
+  void widen_threshold_with(
+      const DummyDomain& other,
+      const std::vector< MachineInt >& /*thresholds*/) override {
+    return this->join_with(other);
+  }
+
   void meet_with(const DummyDomain& other) override {
     this->_is_bottom = (this->_is_bottom || other._is_bottom);
   }
@@ -154,6 +154,12 @@ public:
     this->_inv.widen_threshold_with(other._inv, threshold);
   }
 
+  void widen_threshold_with(
+      const IntervalDomain& other,
+      const std::vector< MachineInt >& thresholds) override {
+    this->_inv.widen_threshold_with(other._inv, thresholds);
+  }
+
   void meet_with(const IntervalDomain& other) override {
     this->_inv.meet_with(other._inv);
   }
@@ -394,12 +400,20 @@ public:
     return r;
   }
 
+  std::size_t size_in_bytes() const override {
+    return this->_inv.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override { return this->_inv.dump(o); }
 
   static std::string name() { return "interval domain"; }
 
 }; // end class IntervalDomain
 
+/// \brief The IntervalDomain is a Patricia tree
+template < typename VariableRef >
+struct IsPersistentDomain< IntervalDomain< VariableRef > > : std::true_type {};
+
 } // end namespace machine_int
 } // end namespace core
 } // end namespace ikos
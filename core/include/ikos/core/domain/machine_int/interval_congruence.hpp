@@ -148,6 +148,12 @@ public:
     this->_inv.widen_threshold_with(other._inv, threshold);
   }
 
+  void widen_threshold_with(
+      const IntervalCongruenceDomain& other,
+      const std::vector< MachineInt >& thresholds) override {
+    this->_inv.widen_threshold_with(other._inv, thresholds);
+  }
+
   void meet_with(const IntervalCongruenceDomain& other) override {
     this->_inv.meet_with(other._inv);
   }
@@ -347,12 +353,21 @@ public:
     return this->_inv.project(e);
   }
 
+  std::size_t size_in_bytes() const override {
+    return this->_inv.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override { return this->_inv.dump(o); }
 
   static std::string name() { return "interval congruence domain"; }
 
 }; // end class IntervalCongruenceDomain
 
+/// \brief The IntervalCongruenceDomain is a Patricia tree
+template < typename VariableRef >
+struct IsPersistentDomain< IntervalCongruenceDomain< VariableRef > >
+    : std::true_type {};
+
 } // end namespace machine_int
 } // end namespace core
 } // end namespace ikos
@@ -0,0 +1,423 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Reduced product of interval-congruences and known bits on machine
+ * integers
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <ikos/core/domain/machine_int/abstract_domain.hpp>
+#include <ikos/core/domain/machine_int/interval_congruence.hpp>
+#include <ikos/core/domain/machine_int/separate_domain.hpp>
+#include <ikos/core/value/machine_int/known_bits.hpp>
+
+namespace ikos {
+namespace core {
+namespace machine_int {
+
+/// \brief Reduced product of interval-congruences and known bits on machine
+/// integers
+///
+/// The known bits are precise on bitwise operations (and, or, xor, shifts),
+/// where intervals and congruences lose most of the information.
+///
+/// Both components are reduced against each other after each operation on a
+/// variable.
+template < typename VariableRef >
+class IntervalCongruenceKnownBitsDomain final
+    : public machine_int::AbstractDomain<
+          VariableRef,
+          IntervalCongruenceKnownBitsDomain< VariableRef > > {
+private:
+  using Parent = machine_int::AbstractDomain<
+      VariableRef,
+      IntervalCongruenceKnownBitsDomain< VariableRef > >;
+  using IntervalCongruenceDomainT = IntervalCongruenceDomain< VariableRef >;
+  using KnownBitsDomainT = SeparateDomain< VariableRef, KnownBits >;
+
+public:
+  using LinearExpressionT = LinearExpression< MachineInt, VariableRef >;
+
+private:
+  IntervalCongruenceDomainT _ic;
+  KnownBitsDomainT _kb;
+
+  /* Invariant: _ic.is_bottom() <=> _kb.is_bottom() */
+
+private:
+  /// \brief Private constructor
+  IntervalCongruenceKnownBitsDomain(IntervalCongruenceDomainT ic,
+                                    KnownBitsDomainT kb)
+      : _ic(std::move(ic)), _kb(std::move(kb)) {}
+
+  /// \brief Reduce the interval-congruence and the known bits of `x`
+  void reduce(VariableRef x) {
+    if (this->is_bottom()) {
+      return;
+    }
+
+    IntervalCongruence ic = this->_ic.to_interval_congruence(x);
+    KnownBits kb = this->_kb.get(x);
+
+    ic.meet_with(IntervalCongruence(kb.to_interval(), kb.to_congruence()));
+    if (ic.is_bottom()) {
+      this->set_to_bottom();
+      return;
+    }
+
+    kb.meet_with(KnownBits::from_interval(ic.interval()));
+    kb.meet_with(KnownBits::from_congruence(ic.congruence()));
+    if (kb.is_bottom()) {
+      this->set_to_bottom();
+      return;
+    }
+
+    this->_ic.set(x, ic);
+    this->_kb.set(x, kb);
+  }
+
+  /// \brief Set both components to bottom if one of them is bottom
+  void normalize_bottom() {
+    if (this->_ic.is_bottom() || this->_kb.is_bottom()) {
+      this->set_to_bottom();
+    }
+  }
+
+  /// \brief Refine the interval-congruence with the given known bits
+  static IntervalCongruence meet_known_bits(IntervalCongruence ic,
+                                            const KnownBits& kb) {
+    ic.meet_with(IntervalCongruence(kb.to_interval(), kb.to_congruence()));
+    return ic;
+  }
+
+public:
+  /// \brief Create the top abstract value
+  IntervalCongruenceKnownBitsDomain()
+      : _ic(IntervalCongruenceDomainT::top()), _kb(KnownBitsDomainT::top()) {}
+
+  /// \brief Copy constructor
+  IntervalCongruenceKnownBitsDomain(const IntervalCongruenceKnownBitsDomain&) =
+      default;
+
+  /// \brief Move constructor
+  IntervalCongruenceKnownBitsDomain(IntervalCongruenceKnownBitsDomain&&) =
+      default;
+
+  /// \brief Copy assignment operator
+  IntervalCongruenceKnownBitsDomain& operator=(
+      const IntervalCongruenceKnownBitsDomain&) = default;
+
+  /// \brief Move assignment operator
+  IntervalCongruenceKnownBitsDomain& operator=(
+      IntervalCongruenceKnownBitsDomain&&) = default;
+
+  /// \brief Destructor
+  ~IntervalCongruenceKnownBitsDomain() override = default;
+
+  /// \brief Create the top abstract value
+  static IntervalCongruenceKnownBitsDomain top() {
+    return IntervalCongruenceKnownBitsDomain(IntervalCongruenceDomainT::top(),
+                                             KnownBitsDomainT::top());
+  }
+
+  /// \brief Create the bottom abstract value
+  static IntervalCongruenceKnownBitsDomain bottom() {
+    return IntervalCongruenceKnownBitsDomain(IntervalCongruenceDomainT::
+                                                 bottom(),
+                                             KnownBitsDomainT::bottom());
+  }
+
+  bool is_bottom() const override { return this->_ic.is_bottom(); }
+
+  bool is_top() const override {
+    return this->_ic.is_top() && this->_kb.is_top();
+  }
+
+  void set_to_bottom() override {
+    this->_ic.set_to_bottom();
+    this->_kb.set_to_bottom();
+  }
+
+  void set_to_top() override {
+    this->_ic.set_to_top();
+    this->_kb.set_to_top();
+  }
+
+  bool leq(const IntervalCongruenceKnownBitsDomain& other) const override {
+    if (this->is_bottom()) {
+      return true;
+    } else if (other.is_bottom()) {
+      return false;
+    } else {
+      return this->_ic.leq(other._ic) && this->_kb.leq(other._kb);
+    }
+  }
+
+  bool equals(const IntervalCongruenceKnownBitsDomain& other) const override {
+    if (this->is_bottom()) {
+      return other.is_bottom();
+    } else if (other.is_bottom()) {
+      return false;
+    } else {
+      return this->_ic.equals(other._ic) && this->_kb.equals(other._kb);
+    }
+  }
+
+  void join_with(const IntervalCongruenceKnownBitsDomain& other) override {
+    this->_ic.join_with(other._ic);
+    this->_kb.join_with(other._kb);
+  }
+
+  void widen_with(const IntervalCongruenceKnownBitsDomain& other) override {
+    this->_ic.widen_with(other._ic);
+    this->_kb.widen_with(other._kb);
+  }
+
+  void widen_threshold_with(const IntervalCongruenceKnownBitsDomain& other,
+                            const MachineInt& threshold) override {
+    this->_ic.widen_threshold_with(other._ic, threshold);
+    this->_kb.widen_threshold_with(other._kb, threshold);
+  }
+
+  void widen_threshold_with(
+      const IntervalCongruenceKnownBitsDomain& other,
+      const std::vector< MachineInt >& thresholds) override {
+    this->_ic.widen_threshold_with(other._ic, thresholds);
+    this->_kb.widen_threshold_with(other._kb, thresholds);
+  }
+
+  void meet_with(const IntervalCongruenceKnownBitsDomain& other) override {
+    this->_ic.meet_with(other._ic);
+    this->_kb.meet_with(other._kb);
+    this->normalize_bottom();
+  }
+
+  void narrow_with(const IntervalCongruenceKnownBitsDomain& other) override {
+    this->_ic.narrow_with(other._ic);
+    this->_kb.narrow_with(other._kb);
+    this->normalize_bottom();
+  }
+
+  void assign(VariableRef x, const MachineInt& n) override {
+    this->_ic.assign(x, n);
+    this->_kb.assign(x, n);
+  }
+
+  void assign(VariableRef x, VariableRef y) override {
+    this->_ic.assign(x, y);
+    this->_kb.assign(x, y);
+  }
+
+  void assign(VariableRef x, const LinearExpressionT& e) override {
+    this->_ic.assign(x, e);
+    this->_kb.assign(x, e);
+    this->normalize_bottom();
+    this->reduce(x);
+  }
+
+  void apply(UnaryOperator op, VariableRef x, VariableRef y) override {
+    this->_ic.apply(op, x, y);
+    this->_kb.apply(op, x, y);
+    this->normalize_bottom();
+    this->reduce(x);
+  }
+
+  void apply(BinaryOperator op,
+             VariableRef x,
+             VariableRef y,
+             VariableRef z) override {
+    this->_ic.apply(op, x, y, z);
+    this->_kb.apply(op, x, y, z);
+    this->normalize_bottom();
+    this->reduce(x);
+  }
+
+  void apply(BinaryOperator op,
+             VariableRef x,
+             VariableRef y,
+             const MachineInt& z) override {
+    this->_ic.apply(op, x, y, z);
+    this->_kb.apply(op, x, y, z);
+    this->normalize_bottom();
+    this->reduce(x);
+  }
+
+  void apply(BinaryOperator op,
+             VariableRef x,
+             const MachineInt& y,
+             VariableRef z) override {
+    this->_ic.apply(op, x, y, z);
+    this->_kb.apply(op, x, y, z);
+    this->normalize_bottom();
+    this->reduce(x);
+  }
+
+  void add(Predicate pred, VariableRef x, VariableRef y) override {
+    this->_ic.add(pred, x, y);
+    if (pred == Predicate::EQ) {
+      KnownBits kb = this->_kb.get(x).meet(this->_kb.get(y));
+      this->_kb.set(x, kb);
+      this->_kb.set(y, kb);
+    }
+    this->normalize_bottom();
+    this->reduce(x);
+    this->reduce(y);
+  }
+
+  void add(Predicate pred, VariableRef x, const MachineInt& y) override {
+    this->_ic.add(pred, x, y);
+    if (pred == Predicate::EQ) {
+      this->_kb.refine(x, KnownBits(y));
+    }
+    this->normalize_bottom();
+    this->reduce(x);
+  }
+
+  void add(Predicate pred, const MachineInt& x, VariableRef y) override {
+    Parent::add(pred, x, y);
+  }
+
+  void set(VariableRef x, const Interval& value) override {
+    this->_ic.set(x, value);
+    this->_kb.forget(x);
+    this->normalize_bottom();
+    this->reduce(x);
+  }
+
+  void set(VariableRef x, const Congruence& value) override {
+    this->_ic.set(x, value);
+    this->_kb.forget(x);
+    this->normalize_bottom();
+    this->reduce(x);
+  }
+
+  void set(VariableRef x, const IntervalCongruence& value) override {
+    this->_ic.set(x, value);
+    this->_kb.forget(x);
+    this->normalize_bottom();
+    this->reduce(x);
+  }
+
+  void refine(VariableRef x, const Interval& value) override {
+    this->_ic.refine(x, value);
+    this->normalize_bottom();
+    this->reduce(x);
+  }
+
+  void refine(VariableRef x, const Congruence& value) override {
+    this->_ic.refine(x, value);
+    this->normalize_bottom();
+    this->reduce(x);
+  }
+
+  void refine(VariableRef x, const IntervalCongruence& value) override {
+    this->_ic.refine(x, value);
+    this->normalize_bottom();
+    this->reduce(x);
+  }
+
+  void forget(VariableRef x) override {
+    this->_ic.forget(x);
+    this->_kb.forget(x);
+  }
+
+  void normalize() const override {}
+
+  Interval to_interval(VariableRef x) const override {
+    return this->to_interval_congruence(x).interval();
+  }
+
+  Interval to_interval(const LinearExpressionT& e) const override {
+    return this->to_interval_congruence(e).interval();
+  }
+
+  Congruence to_congruence(VariableRef x) const override {
+    return this->to_interval_congruence(x).congruence();
+  }
+
+  Congruence to_congruence(const LinearExpressionT& e) const override {
+    return this->to_interval_congruence(e).congruence();
+  }
+
+  IntervalCongruence to_interval_congruence(VariableRef x) const override {
+    return meet_known_bits(this->_ic.to_interval_congruence(x),
+                           this->_kb.get(x));
+  }
+
+  IntervalCongruence to_interval_congruence(
+      const LinearExpressionT& e) const override {
+    return meet_known_bits(this->_ic.to_interval_congruence(e),
+                           this->_kb.project(e));
+  }
+
+  /// \brief Return the known bits of the given variable
+  KnownBits to_known_bits(VariableRef x) const { return this->_kb.get(x); }
+
+  std::size_t size_in_bytes() const override {
+    return this->_ic.size_in_bytes() + this->_kb.size_in_bytes();
+  }
+
+  void dump(std::ostream& o) const override {
+    if (this->is_bottom()) {
+      o << "⊥";
+    } else {
+      o << "(";
+      this->_ic.dump(o);
+      o << ", ";
+      this->_kb.dump(o);
+      o << ")";
+    }
+  }
+
+  static std::string name() {
+    return "interval congruence known bits domain";
+  }
+
+}; // end class IntervalCongruenceKnownBitsDomain
+
+/// \brief The IntervalCongruenceKnownBitsDomain is a pair of Patricia trees
+template < typename VariableRef >
+struct IsPersistentDomain< IntervalCongruenceKnownBitsDomain< VariableRef > >
+    : std::true_type {};
+
+} // end namespace machine_int
+} // end namespace core
+} // end namespace ikos
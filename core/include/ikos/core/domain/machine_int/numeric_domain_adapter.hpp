@@ -165,6 +165,22 @@ public:
     this->_inv.widen_threshold_with(other._inv, threshold.to_z_number());
   }
 
+  void widen_threshold_with(
+      const NumericDomainAdapter& other,
+      const std::vector< MachineInt >& thresholds) override {
+    if (thresholds.empty()) {
+      this->_inv.widen_with(other._inv);
+      return;
+    }
+
+    // Numeric domains only support a single threshold, use the largest one
+    ZNumber threshold = thresholds.front().to_z_number();
+    for (const MachineInt& n : thresholds) {
+      threshold = max(threshold, n.to_z_number());
+    }
+    this->_inv.widen_threshold_with(other._inv, threshold);
+  }
+
   void meet_with(const NumericDomainAdapter& other) override {
     this->_inv.meet_with(other._inv);
   }
@@ -622,22 +638,22 @@ public:
   void add(MachIntPredicate pred, VariableRef x, VariableRef y) override {
     switch (pred) {
       case MachIntPredicate::EQ: {
-        this->_inv.add(ZVariableExpression(x) == ZVariableExpression(y));
+        this->_inv.add_eq(x, y, ZNumber(0));
       } break;
       case MachIntPredicate::NE: {
         this->_inv.add(ZVariableExpression(x) != ZVariableExpression(y));
       } break;
       case MachIntPredicate::GT: {
-        this->_inv.add(ZVariableExpression(x) >= ZVariableExpression(y) + 1);
+        this->_inv.add_le(y, x, ZNumber(-1));
       } break;
       case MachIntPredicate::GE: {
-        this->_inv.add(ZVariableExpression(x) >= ZVariableExpression(y));
+        this->_inv.add_le(y, x, ZNumber(0));
       } break;
       case MachIntPredicate::LT: {
-        this->_inv.add(ZVariableExpression(x) <= ZVariableExpression(y) - 1);
+        this->_inv.add_le(x, y, ZNumber(-1));
       } break;
       case MachIntPredicate::LE: {
-        this->_inv.add(ZVariableExpression(x) <= ZVariableExpression(y));
+        this->_inv.add_le(x, y, ZNumber(0));
       } break;
       default: {
         ikos_unreachable("unreachable");
@@ -648,22 +664,22 @@ public:
   void add(MachIntPredicate pred, VariableRef x, const MachineInt& y) override {
     switch (pred) {
       case MachIntPredicate::EQ: {
-        this->_inv.add(ZVariableExpression(x) == y.to_z_number());
+        this->_inv.add_eq(x, y.to_z_number());
       } break;
       case MachIntPredicate::NE: {
         this->_inv.add(ZVariableExpression(x) != y.to_z_number());
       } break;
       case MachIntPredicate::GT: {
-        this->_inv.add(ZVariableExpression(x) >= y.to_z_number() + 1);
+        this->_inv.add_ge(x, y.to_z_number() + 1);
       } break;
       case MachIntPredicate::GE: {
-        this->_inv.add(ZVariableExpression(x) >= y.to_z_number());
+        this->_inv.add_ge(x, y.to_z_number());
       } break;
       case MachIntPredicate::LT: {
-        this->_inv.add(ZVariableExpression(x) <= y.to_z_number() - 1);
+        this->_inv.add_le(x, y.to_z_number() - 1);
       } break;
       case MachIntPredicate::LE: {
-        this->_inv.add(ZVariableExpression(x) <= y.to_z_number());
+        this->_inv.add_le(x, y.to_z_number());
       } break;
       default: {
         ikos_unreachable("unreachable");
@@ -772,6 +788,10 @@ public:
 
   /// @}
 
+  std::size_t size_in_bytes() const override {
+    return this->_inv.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override { return this->_inv.dump(o); }
 
   static std::string name() { return "adapter of " + NumDomain::name(); }
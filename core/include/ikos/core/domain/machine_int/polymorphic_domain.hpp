@@ -47,11 +47,19 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <ikos/core/domain/machine_int/abstract_domain.hpp>
 #include <ikos/core/support/assert.hpp>
 #include <ikos/core/support/mpl.hpp>
+#include <ikos/core/support/parallel.hpp>
 
 namespace ikos {
 namespace core {
@@ -62,6 +70,19 @@ namespace machine_int {
 /// The PolymorphicDomain is a machine integer abstract domain whose behavior
 /// depends on the abstract domain it is constructed with. It allows the use of
 /// different abstract domains at runtime.
+///
+/// The abstract values of persistent domains (see IsPersistentDomain) are
+/// stored in place, and copied without any allocation: the copies share the
+/// underlying Patricia trees. The other abstract values are allocated on the
+/// heap, and the copies share them until one of them is updated
+/// (copy-on-write), so that snapshots of an invariant are cheap.
+///
+/// Abstract domains can normalize lazily in their const methods. While
+/// several threads may read the same abstract values (see ConcurrentReads),
+/// all the reads of a heap allocated value are serialized by its mutex. A
+/// value referenced by a single domain is locked as well, since another thread
+/// can copy that domain during the read. Outside of such a scope, a domain and
+/// its copies must only be used by one thread.
 template < typename VariableRef >
 class PolymorphicDomain final
     : public machine_int::AbstractDomain< VariableRef,
@@ -99,6 +120,12 @@ private:
     /// \brief Clone the abstract value
     virtual std::unique_ptr< PolymorphicBase > clone() const = 0;
 
+    /// \brief Copy the abstract value into the given in-place storage
+    virtual PolymorphicBase* copy_to(void* storage) const = 0;
+
+    /// \brief Move the abstract value into the given in-place storage
+    virtual PolymorphicBase* move_to(void* storage) noexcept = 0;
+
     /// \brief Check if the abstract value is bottom
     virtual bool is_bottom() const = 0;
 
@@ -134,6 +161,12 @@ private:
     virtual void widen_threshold_with(const PolymorphicBase& other,
                                       const MachineInt& threshold) = 0;
 
+    /// \brief Perform the widening of two abstract values with a set of
+    /// thresholds
+    virtual void widen_threshold_with(
+        const PolymorphicBase& other,
+        const std::vector< MachineInt >& thresholds) = 0;
+
     /// \brief Perform the intersection of two abstract values
     virtual void meet_with(const PolymorphicBase& other) = 0;
 
@@ -238,9 +271,19 @@ private:
     /// \brief Forget a non-negative loop counter
     virtual void forget_counter(VariableRef x) = 0;
 
+    /// \brief Return an estimate of the memory used, in bytes
+    virtual std::size_t size_in_bytes() const = 0;
+
     /// \brief Dump the abstract value, for debugging purpose
     virtual void dump(std::ostream&) const = 0;
 
+    /// \brief Return the mutex serializing the accesses to a shared value
+    std::mutex& mutex() const { return this->_mutex; }
+
+  private:
+    /// \brief Mutex serializing the accesses to a shared value
+    mutable std::mutex _mutex;
+
   }; // end class PolymorphicBase
 
 private:
@@ -269,6 +312,16 @@ private:
       return std::make_unique< PolymorphicDerivedT >(this->_inv);
     }
 
+    /// \brief Copy the abstract value into the given in-place storage
+    PolymorphicBase* copy_to(void* storage) const override {
+      return new (storage) PolymorphicDerivedT(this->_inv);
+    }
+
+    /// \brief Move the abstract value into the given in-place storage
+    PolymorphicBase* move_to(void* storage) noexcept override {
+      return new (storage) PolymorphicDerivedT(std::move(this->_inv));
+    }
+
     /// \brief Check if the abstract value is bottom
     bool is_bottom() const override { return this->_inv.is_bottom(); }
 
@@ -346,6 +399,18 @@ private:
                                       threshold);
     }
 
+    /// \brief Perform the widening of two abstract values with a set of
+    /// thresholds
+    void widen_threshold_with(
+        const PolymorphicBase& other,
+        const std::vector< MachineInt >& thresholds) override {
+      this->assert_compatible(other);
+      this->_inv.widen_threshold_with(static_cast< const PolymorphicDerivedT& >(
+                                          other)
+                                          ._inv,
+                                      thresholds);
+    }
+
     /// \brief Perform the intersection of two abstract values
     void meet_with(const PolymorphicBase& other) override {
       this->assert_compatible(other);
@@ -510,20 +575,161 @@ private:
       this->_inv.forget_counter(x);
     }
 
+    /// \brief Return an estimate of the memory used, in bytes
+    std::size_t size_in_bytes() const override {
+      return this->_inv.size_in_bytes();
+    }
+
     /// \brief Dump the abstract value, for debugging purpose
     void dump(std::ostream& o) const override { this->_inv.dump(o); }
 
   }; // end class PolymorphicDerived
 
 private:
-  /// \brief Pointer on the polymorphic base class, or nullptr (for bottom)
-  std::unique_ptr< PolymorphicBase > _ptr;
+  /// \brief Size of the in-place storage, in bytes
+  static constexpr std::size_t InPlaceSize = 16 * sizeof(void*);
+
+  /// \brief In-place storage
+  using Storage =
+      std::aligned_storage_t< InPlaceSize, alignof(std::max_align_t) >;
+
+  /// \brief Check if the abstract values of the given domain are stored in
+  /// place
+  template < typename RuntimeDomain >
+  struct IsInPlace
+      : std::integral_constant<
+            bool,
+            IsPersistentDomain< RuntimeDomain >::value &&
+                std::is_nothrow_copy_constructible< RuntimeDomain >::value &&
+                std::is_nothrow_move_constructible< RuntimeDomain >::value &&
+                sizeof(PolymorphicDerived< RuntimeDomain >) <= InPlaceSize &&
+                alignof(PolymorphicDerived< RuntimeDomain >) <=
+                    alignof(Storage) > {};
+
+private:
+  /// \brief In-place storage of the abstract value of a persistent domain
+  Storage _storage;
+
+  /// \brief Pointer on the abstract value in `_storage`, or nullptr
+  PolymorphicBase* _in_place = nullptr;
+
+  /// \brief Pointer on the heap allocated abstract value, or nullptr
+  ///
+  /// The abstract value is shared between the copies of the domain, and it is
+  /// copied on the first update. Reads are serialized with its mutex while
+  /// ConcurrentReads is active.
+  ///
+  /// Both pointers are null for bottom.
+  std::shared_ptr< PolymorphicBase > _ptr;
 
 private:
   struct BottomTag {};
 
+  /// \brief Return the abstract value, or nullptr (for bottom)
+  PolymorphicBase* get() const {
+    if (this->_in_place != nullptr) {
+      return this->_in_place;
+    } else {
+      return this->_ptr.get();
+    }
+  }
+
+  /// \brief Destroy the abstract value
+  void reset() noexcept {
+    if (this->_in_place != nullptr) {
+      this->_in_place->~PolymorphicBase();
+      this->_in_place = nullptr;
+    }
+    this->_ptr.reset();
+  }
+
+  /// \brief Store the given abstract value in place
+  template < typename RuntimeDomain, typename Arg >
+  void emplace(Arg&& inv, std::true_type /*in_place*/) {
+    this->_in_place = new (&this->_storage)
+        PolymorphicDerived< RuntimeDomain >(std::forward< Arg >(inv));
+  }
+
+  /// \brief Allocate the given abstract value on the heap
+  template < typename RuntimeDomain, typename Arg >
+  void emplace(Arg&& inv, std::false_type /*in_place*/) {
+    this->_ptr = std::make_shared< PolymorphicDerived< RuntimeDomain > >(
+        std::forward< Arg >(inv));
+  }
+
+  using Lock = std::unique_lock< std::mutex >;
+
+  /// \brief Return true if the abstract value is shared with another domain
+  bool is_shared() const {
+    if (this->_in_place != nullptr) {
+      return false;
+    }
+    if (this->_ptr.use_count() > 1) {
+      return true;
+    }
+    // Synchronize with the release of the references of other threads
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return false;
+  }
+
+  /// \brief Return true if the reads of the abstract value must be locked
+  bool is_read_locked() const {
+    return this->_ptr != nullptr && ConcurrentReads::active();
+  }
+
+  /// \brief Lock the abstract value for a read, if several threads may read it
+  Lock lock() const {
+    if (this->is_read_locked()) {
+      return Lock(this->_ptr->mutex());
+    } else {
+      return Lock();
+    }
+  }
+
+  /// \brief Lock the abstract values of two domains for a read, if several
+  /// threads may read them
+  static std::pair< Lock, Lock > lock(const PolymorphicDomain& a,
+                                      const PolymorphicDomain& b) {
+    if (a.get() == b.get()) {
+      return {a.lock(), Lock()};
+    }
+    Lock la, lb;
+    if (a.is_read_locked()) {
+      la = Lock(a._ptr->mutex(), std::defer_lock);
+    }
+    if (b.is_read_locked()) {
+      lb = Lock(b._ptr->mutex(), std::defer_lock);
+    }
+    if (la.mutex() != nullptr && lb.mutex() != nullptr) {
+      std::lock(la, lb);
+    } else if (la.mutex() != nullptr) {
+      la.lock();
+    } else if (lb.mutex() != nullptr) {
+      lb.lock();
+    }
+    return {std::move(la), std::move(lb)};
+  }
+
+  /// \brief Return the abstract value for an update, copying it first if it
+  /// is shared with another domain
+  PolymorphicBase& unshare() {
+    ikos_assert(this->get() != nullptr);
+    if (this->_in_place != nullptr) {
+      return *this->_in_place;
+    }
+    if (this->is_shared()) {
+      std::unique_ptr< PolymorphicBase > copy;
+      {
+        Lock lock = this->lock();
+        copy = this->_ptr->clone();
+      }
+      this->_ptr = std::move(copy);
+    }
+    return *this->_ptr;
+  }
+
   /// \brief Create the bottom abstract value
-  explicit PolymorphicDomain(BottomTag) : _ptr(nullptr) {}
+  explicit PolymorphicDomain(BottomTag) {}
 
 public:
   /// \brief Create the top abstract value
@@ -533,33 +739,65 @@ public:
 
   /// \brief Create a polymorphic domain with the given abstract value
   template < typename RuntimeDomain >
-  explicit PolymorphicDomain(RuntimeDomain&& inv)
-      : _ptr(std::make_unique<
-             PolymorphicDerived< remove_cvref_t< RuntimeDomain > > >(
-            std::forward< RuntimeDomain >(inv))) {}
+  explicit PolymorphicDomain(RuntimeDomain&& inv) {
+    using RuntimeDomainT = remove_cvref_t< RuntimeDomain >;
+    this->emplace< RuntimeDomainT >(std::forward< RuntimeDomain >(inv),
+                                    IsInPlace< RuntimeDomainT >{});
+  }
 
   /// \brief Copy constructor
-  PolymorphicDomain(const PolymorphicDomain& other)
-      : _ptr((other._ptr != nullptr) ? other._ptr->clone() : nullptr) {}
+  ///
+  /// A heap allocated abstract value is shared until one of the domains is
+  /// updated.
+  PolymorphicDomain(const PolymorphicDomain& other) : _ptr(other._ptr) {
+    if (other._in_place != nullptr) {
+      this->_in_place = other._in_place->copy_to(&this->_storage);
+    }
+  }
 
   /// \brief Move constructor
-  PolymorphicDomain(PolymorphicDomain&&) noexcept = default;
+  ///
+  /// The moved domain is left to bottom.
+  PolymorphicDomain(PolymorphicDomain&& other) noexcept
+      : _ptr(std::move(other._ptr)) {
+    if (other._in_place != nullptr) {
+      this->_in_place = other._in_place->move_to(&this->_storage);
+      other.reset();
+    }
+  }
 
   /// \brief Copy assignment operator
+  ///
+  /// A heap allocated abstract value is shared until one of the domains is
+  /// updated.
   PolymorphicDomain& operator=(const PolymorphicDomain& other) {
-    if (other._ptr != nullptr) {
-      this->_ptr = other._ptr->clone();
-    } else {
-      this->_ptr = nullptr;
+    if (this != &other) {
+      this->reset();
+      this->_ptr = other._ptr;
+      if (other._in_place != nullptr) {
+        this->_in_place = other._in_place->copy_to(&this->_storage);
+      }
     }
     return *this;
   }
 
   /// \brief Move assignment operator
-  PolymorphicDomain& operator=(PolymorphicDomain&&) noexcept = default;
+  ///
+  /// The moved domain is left to bottom.
+  PolymorphicDomain& operator=(PolymorphicDomain&& other) noexcept {
+    if (this != &other) {
+      this->reset();
+      this->_ptr = std::move(other._ptr);
+      if (other._in_place != nullptr) {
+        this->_in_place = other._in_place->move_to(&this->_storage);
+        other.reset();
+      }
+    }
+    return *this;
+  }
 
   /// \brief Destructor
-  ~PolymorphicDomain() override = default;
+  ~PolymorphicDomain() override { this->reset(); }
 
   /// \brief Create the top abstract value
   static PolymorphicDomain top() {
@@ -570,125 +808,157 @@ public:
   static PolymorphicDomain bottom() { return PolymorphicDomain(BottomTag{}); }
 
   bool is_bottom() const override {
-    if (this->_ptr != nullptr) {
-      return this->_ptr->is_bottom();
+    if (this->get() != nullptr) {
+      Lock lock = this->lock();
+      return this->get()->is_bottom();
     } else {
       return true;
     }
   }
 
   bool is_top() const override {
-    if (this->_ptr != nullptr) {
-      return this->_ptr->is_top();
+    if (this->get() != nullptr) {
+      Lock lock = this->lock();
+      return this->get()->is_top();
     } else {
       return false;
     }
   }
 
   void set_to_bottom() override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->set_to_bottom();
+    if (this->get() != nullptr) {
+      this->unshare().set_to_bottom();
     } else {
       // no-op
     }
   }
 
   void set_to_top() override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->set_to_top();
+    if (this->get() != nullptr) {
+      this->unshare().set_to_top();
     } else {
       ikos_unreachable("cannot set bottom to top for PolymorphicDomain");
     }
   }
 
   bool leq(const PolymorphicDomain& other) const override {
-    if (this->_ptr == nullptr) {
+    if (this->get() == nullptr) {
       return true;
-    } else if (other._ptr == nullptr) {
-      return this->_ptr->is_bottom();
+    } else if (other.get() == nullptr) {
+      return this->is_bottom();
     } else {
-      return this->_ptr->leq(*other._ptr);
+      auto locks = lock(*this, other);
+      return this->get()->leq(*other.get());
     }
   }
 
   bool equals(const PolymorphicDomain& other) const override {
-    if (this->_ptr == nullptr) {
+    if (this->get() == nullptr) {
       return other.is_bottom();
-    } else if (other._ptr == nullptr) {
+    } else if (other.get() == nullptr) {
       return this->is_bottom();
     } else {
-      return this->_ptr->equals(*other._ptr);
+      auto locks = lock(*this, other);
+      return this->get()->equals(*other.get());
     }
   }
 
   void join_with(const PolymorphicDomain& other) override {
-    if (other._ptr == nullptr) {
+    if (other.get() == nullptr) {
       return;
-    } else if (this->_ptr == nullptr) {
+    } else if (this->get() == nullptr) {
       this->operator=(other);
     } else {
-      this->_ptr->join_with(*other._ptr);
+      PolymorphicBase& self = this->unshare();
+      Lock lock = other.lock();
+      self.join_with(*other.get());
     }
   }
 
   void join_loop_with(const PolymorphicDomain& other) override {
-    if (other._ptr == nullptr) {
+    if (other.get() == nullptr) {
       return;
-    } else if (this->_ptr == nullptr) {
+    } else if (this->get() == nullptr) {
       this->operator=(other);
     } else {
-      this->_ptr->join_loop_with(*other._ptr);
+      PolymorphicBase& self = this->unshare();
+      Lock lock = other.lock();
+      self.join_loop_with(*other.get());
     }
   }
 
   void join_iter_with(const PolymorphicDomain& other) override {
-    if (other._ptr == nullptr) {
+    if (other.get() == nullptr) {
       return;
-    } else if (this->_ptr == nullptr) {
+    } else if (this->get() == nullptr) {
       this->operator=(other);
     } else {
-      this->_ptr->join_iter_with(*other._ptr);
+      PolymorphicBase& self = this->unshare();
+      Lock lock = other.lock();
+      self.join_iter_with(*other.get());
     }
   }
 
   void widen_with(const PolymorphicDomain& other) override {
-    if (other._ptr == nullptr) {
+    if (other.get() == nullptr) {
       return;
-    } else if (this->_ptr == nullptr) {
+    } else if (this->get() == nullptr) {
       this->operator=(other);
     } else {
-      this->_ptr->widen_with(*other._ptr);
+      PolymorphicBase& self = this->unshare();
+      Lock lock = other.lock();
+      self.widen_with(*other.get());
     }
   }
 
   void widen_threshold_with(const PolymorphicDomain& other,
                             const MachineInt& threshold) override {
-    if (other._ptr == nullptr) {
+    if (other.get() == nullptr) {
       return;
-    } else if (this->_ptr == nullptr) {
+    } else if (this->get() == nullptr) {
       this->operator=(other);
     } else {
-      this->_ptr->widen_threshold_with(*other._ptr, threshold);
+      PolymorphicBase& self = this->unshare();
+      Lock lock = other.lock();
+      self.widen_threshold_with(*other.get(), threshold);
+    }
+  }
+
+  void widen_threshold_with(
+      const PolymorphicDomain& other,
+      const std::vector< MachineInt >& thresholds) override {
+    if (other.get() == nullptr) {
+      return;
+    } else if (this->get() == nullptr) {
+      this->operator=(other);
+    } else {
+      PolymorphicBase& self = this->unshare();
+      Lock lock = other.lock();
+      self.widen_threshold_with(*other.get(), thresholds);
     }
   }
 
   void meet_with(const PolymorphicDomain& other) override {
-    if (this->_ptr == nullptr) {
+    if (this->get() == nullptr) {
       return;
-    } else if (other._ptr == nullptr) {
-      this->_ptr->set_to_bottom();
+    } else if (other.get() == nullptr) {
+      this->unshare().set_to_bottom();
     } else {
-      this->_ptr->meet_with(*other._ptr);
+      PolymorphicBase& self = this->unshare();
+      Lock lock = other.lock();
+      self.meet_with(*other.get());
     }
   }
 
   void narrow_with(const PolymorphicDomain& other) override {
-    if (this->_ptr == nullptr) {
+    if (this->get() == nullptr) {
       return;
-    } else if (other._ptr == nullptr) {
-      this->_ptr->set_to_bottom();
+    } else if (other.get() == nullptr) {
+      this->unshare().set_to_bottom();
     } else {
-      this->_ptr->narrow_with(*other._ptr);
+      PolymorphicBase& self = this->unshare();
+      Lock lock = other.lock();
+      self.narrow_with(*other.get());
     }
   }
 
@@ -696,26 +966,26 @@ public:
   /// @{
 
   void assign(VariableRef x, const MachineInt& n) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->assign(x, n);
+    if (this->get() != nullptr) {
+      this->unshare().assign(x, n);
     }
   }
 
   void assign(VariableRef x, VariableRef y) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->assign(x, y);
+    if (this->get() != nullptr) {
+      this->unshare().assign(x, y);
     }
   }
 
   void assign(VariableRef x, const LinearExpressionT& e) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->assign(x, e);
+    if (this->get() != nullptr) {
+      this->unshare().assign(x, e);
     }
   }
 
   void apply(UnaryOperator op, VariableRef x, VariableRef y) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->apply(op, x, y);
+    if (this->get() != nullptr) {
+      this->unshare().apply(op, x, y);
     }
   }
 
@@ -723,8 +993,8 @@ public:
              VariableRef x,
              VariableRef y,
              VariableRef z) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->apply(op, x, y, z);
+    if (this->get() != nullptr) {
+      this->unshare().apply(op, x, y, z);
     }
   }
 
@@ -732,8 +1002,8 @@ public:
              VariableRef x,
              VariableRef y,
              const MachineInt& z) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->apply(op, x, y, z);
+    if (this->get() != nullptr) {
+      this->unshare().apply(op, x, y, z);
     }
   }
 
@@ -741,80 +1011,82 @@ public:
              VariableRef x,
              const MachineInt& y,
              VariableRef z) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->apply(op, x, y, z);
+    if (this->get() != nullptr) {
+      this->unshare().apply(op, x, y, z);
     }
   }
 
   void add(Predicate pred, VariableRef x, VariableRef y) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->add(pred, x, y);
+    if (this->get() != nullptr) {
+      this->unshare().add(pred, x, y);
     }
   }
 
   void add(Predicate pred, VariableRef x, const MachineInt& y) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->add(pred, x, y);
+    if (this->get() != nullptr) {
+      this->unshare().add(pred, x, y);
     }
   }
 
   void add(Predicate pred, const MachineInt& x, VariableRef y) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->add(pred, x, y);
+    if (this->get() != nullptr) {
+      this->unshare().add(pred, x, y);
     }
   }
 
   void set(VariableRef x, const Interval& value) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->set(x, value);
+    if (this->get() != nullptr) {
+      this->unshare().set(x, value);
     }
   }
 
   void set(VariableRef x, const Congruence& value) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->set(x, value);
+    if (this->get() != nullptr) {
+      this->unshare().set(x, value);
     }
   }
 
   void set(VariableRef x, const IntervalCongruence& value) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->set(x, value);
+    if (this->get() != nullptr) {
+      this->unshare().set(x, value);
     }
   }
 
   void refine(VariableRef x, const Interval& value) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->refine(x, value);
+    if (this->get() != nullptr) {
+      this->unshare().refine(x, value);
     }
   }
 
   void refine(VariableRef x, const Congruence& value) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->refine(x, value);
+    if (this->get() != nullptr) {
+      this->unshare().refine(x, value);
     }
   }
 
   void refine(VariableRef x, const IntervalCongruence& value) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->refine(x, value);
+    if (this->get() != nullptr) {
+      this->unshare().refine(x, value);
     }
   }
 
   void forget(VariableRef x) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->forget(x);
+    if (this->get() != nullptr) {
+      this->unshare().forget(x);
     }
   }
 
   void normalize() const override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->normalize();
+    if (this->get() != nullptr) {
+      Lock lock = this->lock();
+      this->get()->normalize();
     }
   }
 
   Interval to_interval(VariableRef x) const override {
-    if (this->_ptr != nullptr) {
-      return this->_ptr->to_interval(x);
+    if (this->get() != nullptr) {
+      Lock lock = this->lock();
+      return this->get()->to_interval(x);
     } else {
       return Interval::bottom(VariableTrait::bit_width(x),
                               VariableTrait::sign(x));
@@ -822,16 +1094,18 @@ public:
   }
 
   Interval to_interval(const LinearExpressionT& e) const override {
-    if (this->_ptr != nullptr) {
-      return this->_ptr->to_interval(e);
+    if (this->get() != nullptr) {
+      Lock lock = this->lock();
+      return this->get()->to_interval(e);
     } else {
       return Interval::bottom(e.constant().bit_width(), e.constant().sign());
     }
   }
 
   Congruence to_congruence(VariableRef x) const override {
-    if (this->_ptr != nullptr) {
-      return this->_ptr->to_congruence(x);
+    if (this->get() != nullptr) {
+      Lock lock = this->lock();
+      return this->get()->to_congruence(x);
     } else {
       return Congruence::bottom(VariableTrait::bit_width(x),
                                 VariableTrait::sign(x));
@@ -839,16 +1113,18 @@ public:
   }
 
   Congruence to_congruence(const LinearExpressionT& e) const override {
-    if (this->_ptr != nullptr) {
-      return this->_ptr->to_congruence(e);
+    if (this->get() != nullptr) {
+      Lock lock = this->lock();
+      return this->get()->to_congruence(e);
     } else {
       return Congruence::bottom(e.constant().bit_width(), e.constant().sign());
     }
   }
 
   IntervalCongruence to_interval_congruence(VariableRef x) const override {
-    if (this->_ptr != nullptr) {
-      return this->_ptr->to_interval_congruence(x);
+    if (this->get() != nullptr) {
+      Lock lock = this->lock();
+      return this->get()->to_interval_congruence(x);
     } else {
       return IntervalCongruence::bottom(VariableTrait::bit_width(x),
                                         VariableTrait::sign(x));
@@ -857,8 +1133,9 @@ public:
 
   IntervalCongruence to_interval_congruence(
       const LinearExpressionT& e) const override {
-    if (this->_ptr != nullptr) {
-      return this->_ptr->to_interval_congruence(e);
+    if (this->get() != nullptr) {
+      Lock lock = this->lock();
+      return this->get()->to_interval_congruence(e);
     } else {
       return IntervalCongruence::bottom(e.constant().bit_width(),
                                         e.constant().sign());
@@ -870,40 +1147,50 @@ public:
   /// @{
 
   void mark_counter(VariableRef x) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->mark_counter(x);
+    if (this->get() != nullptr) {
+      this->unshare().mark_counter(x);
     }
   }
 
   void unmark_counter(VariableRef x) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->unmark_counter(x);
+    if (this->get() != nullptr) {
+      this->unshare().unmark_counter(x);
     }
   }
 
   void init_counter(VariableRef x, const MachineInt& c) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->init_counter(x, c);
+    if (this->get() != nullptr) {
+      this->unshare().init_counter(x, c);
     }
   }
 
   void incr_counter(VariableRef x, const MachineInt& k) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->incr_counter(x, k);
+    if (this->get() != nullptr) {
+      this->unshare().incr_counter(x, k);
     }
   }
 
   void forget_counter(VariableRef x) override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->forget_counter(x);
+    if (this->get() != nullptr) {
+      this->unshare().forget_counter(x);
     }
   }
 
   /// @}
 
+  std::size_t size_in_bytes() const override {
+    if (this->get() != nullptr) {
+      Lock lock = this->lock();
+      return sizeof(PolymorphicDomain) + this->get()->size_in_bytes();
+    } else {
+      return sizeof(PolymorphicDomain);
+    }
+  }
+
   void dump(std::ostream& o) const override {
-    if (this->_ptr != nullptr) {
-      this->_ptr->dump(o);
+    if (this->get() != nullptr) {
+      Lock lock = this->lock();
+      this->get()->dump(o);
     } else {
       o << "⊥";
     }
@@ -43,6 +43,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <ikos/core/adt/patricia_tree/map.hpp>
 #include <ikos/core/domain/abstract_domain.hpp>
 #include <ikos/core/domain/machine_int/operator.hpp>
@@ -260,6 +262,26 @@ public:
     }
   }
 
+  void widen_threshold_with(const SeparateDomain& other,
+                            const std::vector< MachineInt >& thresholds) {
+    if (other.is_bottom()) {
+      return;
+    } else if (this->is_bottom()) {
+      this->operator=(other);
+    } else {
+      this->_tree.intersect_with(other._tree,
+                                 [&thresholds](const Value& x, const Value& y) {
+                                   Value z =
+                                       x.widening_threshold(y, thresholds);
+                                   if (z.is_top()) {
+                                     return boost::optional< Value >(
+                                         boost::none);
+                                   }
+                                   return boost::optional< Value >(z);
+                                 });
+    }
+  }
+
   void meet_with(const SeparateDomain& other) override {
     if (this->is_bottom()) {
       return;
@@ -431,6 +453,10 @@ public:
     this->set(x, apply_bin_operator(op, Value(y), this->get(z)));
   }
 
+  std::size_t size_in_bytes() const override {
+    return sizeof(SeparateDomain) + this->_tree.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     if (this->is_bottom()) {
       o << "⊥";
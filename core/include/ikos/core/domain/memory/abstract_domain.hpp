@@ -43,6 +43,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <ikos/core/domain/abstract_domain.hpp>
 #include <ikos/core/domain/lifetime/abstract_domain.hpp>
 #include <ikos/core/domain/machine_int/abstract_domain.hpp>
@@ -150,6 +152,22 @@ public:
     return tmp;
   }
 
+  /// \brief Perform the widening of two abstract values with a set of
+  /// thresholds
+  ///
+  /// An unstable bound is set to the closest threshold that includes it.
+  virtual void widen_threshold_with(
+      const Derived& other, const std::vector< MachineInt >& thresholds) = 0;
+
+  /// \brief Perform the widening of two abstract values with a set of
+  /// thresholds
+  virtual Derived widening_threshold(
+      const Derived& other, const std::vector< MachineInt >& thresholds) const {
+    Derived tmp(static_cast< const Derived& >(*this));
+    tmp.widen_threshold_with(other, thresholds);
+    return tmp;
+  }
+
   /// \brief Perform the memory write `*p = v`
   ///
   /// \param vfac The variable factory
@@ -234,6 +252,13 @@ public:
   /// \brief Forget the memory contents accessible through pointer `p`
   virtual void forget_reachable_mem(VariableRef p) = 0;
 
+  /// \brief Forget the deallocated memory locations that no pointer refers to
+  ///
+  /// Drops the cells, the pointer set and the lifetime of every memory
+  /// location whose lifetime is deallocated and that is not in the points-to
+  /// set of any pointer or memory cell.
+  virtual void forget_unreachable_mem() = 0;
+
   /// \brief Forget the memory contents in range [p, p + size - 1]
   ///
   /// Forget all memory contents that can be accessible through pointer p
@@ -250,6 +250,20 @@ public:
     }
   }
 
+  void widen_threshold_with(
+      const DummyDomain& other,
+      const std::vector< MachineInt >& thresholds) override {
+    if (this->is_bottom()) {
+      this->operator=(other);
+    } else if (other.is_bottom()) {
+      return;
+    } else {
+      this->_pointer.widen_threshold_with(other._pointer, thresholds);
+      this->_uninitialized.widen_with(other._uninitialized);
+      this->_lifetime.widen_with(other._lifetime);
+    }
+  }
+
   void meet_with(const DummyDomain& other) override {
     if (this->is_bottom()) {
       return;
@@ -350,6 +364,8 @@ public:
 
   void forget_reachable_mem(VariableRef, const MachineInt&) override {}
 
+  void forget_unreachable_mem() override {}
+
   void abstract_reachable_mem(VariableRef, const MachineInt&) override {}
 
   void zero_reachable_mem(VariableRef) override {}
@@ -51,6 +51,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <ikos/core/adt/patricia_tree/map.hpp>
 #include <ikos/core/domain/memory/abstract_domain.hpp>
 #include <ikos/core/domain/memory/value/cell_set.hpp>
 #include <ikos/core/domain/memory/value/mem_loc_to_cell_set.hpp>
@@ -70,6 +76,13 @@ namespace memory {
 ///                         const MachineInt& offset,
 ///                         const MachineInt& size)
 ///   Get or create the cell with the given base address, offset and size
+///
+/// static boost::optional< VariableRef > lookup_cell(VariableFactory& vfac,
+///                                                   MemoryLocationRef base,
+///                                                   const MachineInt& offset,
+///                                                   const MachineInt& size)
+///   Return the cell with the given base address, offset and size if it was
+///   already created, or boost::none. This should not allocate.
 template < typename VariableRef,
            typename MemoryLocationRef,
            typename VariableFactory >
@@ -96,6 +109,18 @@ struct CellFactoryTraits {};
 /// `memory::CellVariableTraits`. The variable doesn't have a fixed type. It is
 /// either a signed machine integer of 8*size bits, a floating points of 8*size
 /// bits or a pointer.
+///
+/// Memory locations with a large number of cells (e.g, big arrays) can be
+/// summarized: once a memory location would have more than a given number of
+/// cells, all its cells are smashed into a single summary cell `(base, 0,
+/// size)`, representing the elements of `size` bytes within a range of
+/// offsets.
+///
+/// The range of a summary can be split into a bounded number of segments of
+/// contiguous elements, each one with its own summary cell. A strong write on
+/// a single element isolates it in its own segment, so that arrays indexed by
+/// loop counters keep per-index precision. Summary cells of segments with
+/// several elements are only updated with weak updates.
 template < typename VariableRef,
            typename MemoryLocationRef,
            typename VariableFactory,
@@ -144,12 +169,11 @@ private:
       CellFactoryTraits< VariableRef, MemoryLocationRef, VariableFactory >;
 
   /// \brief Set of cells
-  using CellSetT = CellSet< VariableRef >;
+  using CellSetT = CellSet< VariableRef, MemoryLocationRef >;
 
   /// \brief Map from base addresses to set of synthetic cells
   ///
-  /// TODO(jnavas): it should be a map from pointer offsets to set of
-  /// overlapping cells to make operations faster.
+  /// Cell sets are indexed by offset, for fast overlap queries.
   using MemLocToCellSetT = MemLocToCellSet< MemoryLocationRef, VariableRef >;
 
   /// \brief Points-to set
@@ -173,6 +197,30 @@ private:
   /// \brief Machine integer interval-congruence
   using IntervalCongruence = machine_int::IntervalCongruence;
 
+  /// \brief Summary of the cells of a memory location
+  struct Summary {
+    /// \brief Summary cells, one per segment, sorted by offset
+    ///
+    /// The first cell is `(base, 0, size)` and represents the first segment.
+    /// Any other cell `(base, o, size)` represents the segment starting at
+    /// offset `o`, up to the start of the next segment or the end of the
+    /// range. All cells have the same size.
+    std::vector< VariableRef > cells;
+
+    /// \brief Offsets of the elements represented by the summary cells
+    ///
+    /// Elements are `size` bytes wide and start at offsets `range.lb() + k *
+    /// size`. This is bottom if the summary cells represent nothing.
+    Interval range;
+
+    bool operator==(const Summary& other) const {
+      return this->cells == other.cells && this->range.equals(other.range);
+    }
+  };
+
+  /// \brief Map from base addresses to summaries
+  using SummaryMapT = PatriciaTreeMap< MemoryLocationRef, Summary >;
+
 private:
   MemLocToCellSetT _cells;
   MemLocToPointerSetT _pointer_sets;
@@ -180,6 +228,18 @@ private:
   UninitializedDomain _uninitialized;
   LifetimeDomain _lifetime;
 
+  /// \brief Summarized memory locations
+  ///
+  /// A summarized memory location has no cell in `_cells`.
+  SummaryMapT _summaries;
+
+  /// \brief Maximum number of cells of a memory location before it gets
+  /// summarized, or 0 to disable summarization
+  std::size_t _smash_threshold = 0;
+
+  /// \brief Maximum number of segments of a summary
+  std::size_t _max_segments = 1;
+
 private:
   struct TopTag {};
   struct BottomTag {};
@@ -208,14 +268,22 @@ public:
   ///
   /// \param pointer The pointer abstract value
   /// \param uninitialized The uninitialized abstract value
+  /// \param lifetime The lifetime abstract value
+  /// \param smash_threshold Maximum number of cells of a memory location
+  ///   before it gets summarized, or 0 to disable summarization
+  /// \param max_segments Maximum number of segments of a summary
   explicit ValueDomain(PointerDomain pointer,
                        UninitializedDomain uninitialized,
-                       LifetimeDomain lifetime)
+                       LifetimeDomain lifetime,
+                       std::size_t smash_threshold = 0,
+                       std::size_t max_segments = 1)
       : _cells(MemLocToCellSetT::top()),
         _pointer_sets(MemLocToPointerSetT::top()),
         _pointer(std::move(pointer)),
         _uninitialized(std::move(uninitialized)),
-        _lifetime(lifetime) {
+        _lifetime(lifetime),
+        _smash_threshold(smash_threshold),
+        _max_segments(std::max(max_segments, std::size_t(1))) {
     this->normalize();
   }
 
@@ -261,6 +329,7 @@ public:
     this->_pointer.set_to_bottom();
     this->_uninitialized.set_to_bottom();
     this->_lifetime.set_to_bottom();
+    this->_summaries.clear();
   }
 
   void set_to_top() override {
@@ -269,6 +338,7 @@ public:
     this->_pointer.set_to_top();
     this->_uninitialized.set_to_top();
     this->_lifetime.set_to_top();
+    this->_summaries.clear();
   }
 
   bool leq(const ValueDomain& other) const override {
@@ -276,6 +346,11 @@ public:
       return true;
     } else if (other.is_bottom()) {
       return false;
+    } else if (!this->summaries_leq(other)) {
+      return false;
+    } else if (boost::optional< ValueDomain > copy =
+                   this->resegment_summaries(other)) {
+      return copy->leq(other);
     } else {
       return this->_cells.leq(other._cells) &&
              this->_pointer_sets.leq(other._pointer_sets) &&
@@ -295,7 +370,8 @@ public:
              this->_pointer_sets.equals(other._pointer_sets) &&
              this->_pointer.equals(other._pointer) &&
              this->_uninitialized.equals(other._uninitialized) &&
-             this->_lifetime.equals(other._lifetime);
+             this->_lifetime.equals(other._lifetime) &&
+             this->summaries_equals(other);
     }
   }
 
@@ -305,11 +381,16 @@ public:
     } else if (other.is_bottom()) {
       return;
     } else {
-      this->_cells.join_with(other._cells);
-      this->_pointer_sets.join_with(other._pointer_sets);
-      this->_pointer.join_with(other._pointer);
-      this->_uninitialized.join_with(other._uninitialized);
-      this->_lifetime.join_with(other._lifetime);
+      boost::optional< ValueDomain > copy;
+      std::vector< VariableRef > forgotten =
+          this->merge_summaries(other, copy);
+      const ValueDomain& right = copy ? *copy : other;
+      this->_cells.join_with(right._cells);
+      this->_pointer_sets.join_with(right._pointer_sets);
+      this->_pointer.join_with(right._pointer);
+      this->_uninitialized.join_with(right._uninitialized);
+      this->_lifetime.join_with(right._lifetime);
+      this->forget_surface_cells(forgotten);
     }
   }
 
@@ -319,11 +400,16 @@ public:
     } else if (other.is_bottom()) {
       return;
     } else {
-      this->_cells.join_loop_with(other._cells);
-      this->_pointer_sets.join_loop_with(other._pointer_sets);
-      this->_pointer.join_loop_with(other._pointer);
-      this->_uninitialized.join_loop_with(other._uninitialized);
-      this->_lifetime.join_loop_with(other._lifetime);
+      boost::optional< ValueDomain > copy;
+      std::vector< VariableRef > forgotten =
+          this->merge_summaries(other, copy);
+      const ValueDomain& right = copy ? *copy : other;
+      this->_cells.join_loop_with(right._cells);
+      this->_pointer_sets.join_loop_with(right._pointer_sets);
+      this->_pointer.join_loop_with(right._pointer);
+      this->_uninitialized.join_loop_with(right._uninitialized);
+      this->_lifetime.join_loop_with(right._lifetime);
+      this->forget_surface_cells(forgotten);
     }
   }
 
@@ -333,11 +419,16 @@ public:
     } else if (other.is_bottom()) {
       return;
     } else {
-      this->_cells.join_iter_with(other._cells);
-      this->_pointer_sets.join_iter_with(other._pointer_sets);
-      this->_pointer.join_iter_with(other._pointer);
-      this->_uninitialized.join_iter_with(other._uninitialized);
-      this->_lifetime.join_iter_with(other._lifetime);
+      boost::optional< ValueDomain > copy;
+      std::vector< VariableRef > forgotten =
+          this->merge_summaries(other, copy);
+      const ValueDomain& right = copy ? *copy : other;
+      this->_cells.join_iter_with(right._cells);
+      this->_pointer_sets.join_iter_with(right._pointer_sets);
+      this->_pointer.join_iter_with(right._pointer);
+      this->_uninitialized.join_iter_with(right._uninitialized);
+      this->_lifetime.join_iter_with(right._lifetime);
+      this->forget_surface_cells(forgotten);
     }
   }
 
@@ -347,11 +438,16 @@ public:
     } else if (other.is_bottom()) {
       return;
     } else {
-      this->_cells.widen_with(other._cells);
-      this->_pointer_sets.widen_with(other._pointer_sets);
-      this->_pointer.widen_with(other._pointer);
-      this->_uninitialized.widen_with(other._uninitialized);
-      this->_lifetime.widen_with(other._lifetime);
+      boost::optional< ValueDomain > copy;
+      std::vector< VariableRef > forgotten =
+          this->merge_summaries(other, copy);
+      const ValueDomain& right = copy ? *copy : other;
+      this->_cells.widen_with(right._cells);
+      this->_pointer_sets.widen_with(right._pointer_sets);
+      this->_pointer.widen_with(right._pointer);
+      this->_uninitialized.widen_with(right._uninitialized);
+      this->_lifetime.widen_with(right._lifetime);
+      this->forget_surface_cells(forgotten);
     }
   }
 
@@ -362,11 +458,37 @@ public:
     } else if (other.is_bottom()) {
       return;
     } else {
-      this->_cells.widen_with(other._cells);
-      this->_pointer_sets.join_with(other._pointer_sets);
-      this->_pointer.widen_threshold_with(other._pointer, threshold);
-      this->_uninitialized.widen_with(other._uninitialized);
-      this->_lifetime.widen_with(other._lifetime);
+      boost::optional< ValueDomain > copy;
+      std::vector< VariableRef > forgotten =
+          this->merge_summaries(other, copy);
+      const ValueDomain& right = copy ? *copy : other;
+      this->_cells.widen_with(right._cells);
+      this->_pointer_sets.join_with(right._pointer_sets);
+      this->_pointer.widen_threshold_with(right._pointer, threshold);
+      this->_uninitialized.widen_with(right._uninitialized);
+      this->_lifetime.widen_with(right._lifetime);
+      this->forget_surface_cells(forgotten);
+    }
+  }
+
+  void widen_threshold_with(
+      const ValueDomain& other,
+      const std::vector< MachineInt >& thresholds) override {
+    if (this->is_bottom()) {
+      this->operator=(other);
+    } else if (other.is_bottom()) {
+      return;
+    } else {
+      boost::optional< ValueDomain > copy;
+      std::vector< VariableRef > forgotten =
+          this->merge_summaries(other, copy);
+      const ValueDomain& right = copy ? *copy : other;
+      this->_cells.widen_with(right._cells);
+      this->_pointer_sets.join_with(right._pointer_sets);
+      this->_pointer.widen_threshold_with(right._pointer, thresholds);
+      this->_uninitialized.widen_with(right._uninitialized);
+      this->_lifetime.widen_with(right._lifetime);
+      this->forget_surface_cells(forgotten);
     }
   }
 
@@ -376,11 +498,16 @@ public:
     } else if (other.is_bottom()) {
       this->set_to_bottom();
     } else {
-      this->_cells.meet_with(other._cells);
-      this->_pointer_sets.meet_with(other._pointer_sets);
-      this->_pointer.meet_with(other._pointer);
-      this->_uninitialized.meet_with(other._uninitialized);
-      this->_lifetime.meet_with(other._lifetime);
+      boost::optional< ValueDomain > copy;
+      std::vector< VariableRef > forgotten =
+          this->merge_summaries(other, copy, /*meet=*/true);
+      const ValueDomain& right = copy ? *copy : other;
+      this->_cells.meet_with(right._cells);
+      this->_pointer_sets.meet_with(right._pointer_sets);
+      this->_pointer.meet_with(right._pointer);
+      this->_uninitialized.meet_with(right._uninitialized);
+      this->_lifetime.meet_with(right._lifetime);
+      this->forget_surface_cells(forgotten);
     }
   }
 
@@ -390,11 +517,16 @@ public:
     } else if (other.is_bottom()) {
       this->set_to_bottom();
     } else {
-      this->_cells.narrow_with(other._cells);
-      this->_pointer_sets.narrow_with(other._pointer_sets);
-      this->_pointer.narrow_with(other._pointer);
-      this->_uninitialized.narrow_with(other._uninitialized);
-      this->_lifetime.narrow_with(other._lifetime);
+      boost::optional< ValueDomain > copy;
+      std::vector< VariableRef > forgotten =
+          this->merge_summaries(other, copy);
+      const ValueDomain& right = copy ? *copy : other;
+      this->_cells.narrow_with(right._cells);
+      this->_pointer_sets.narrow_with(right._pointer_sets);
+      this->_pointer.narrow_with(right._pointer);
+      this->_uninitialized.narrow_with(right._uninitialized);
+      this->_lifetime.narrow_with(right._lifetime);
+      this->forget_surface_cells(forgotten);
     }
   }
 
@@ -442,17 +574,6 @@ private:
     return Interval(offset, offset + size - one);
   }
 
-  /// \brief Return true if the given cell overlaps with the given byte range
-  bool cell_overlap(VariableRef cell, const Interval& range) {
-    Interval meet = this->cell_range(cell).meet(range);
-    return !meet.is_bottom();
-  }
-
-  /// \brief Return true if the given cells overlap
-  bool cell_overlap(VariableRef a, VariableRef b) {
-    return this->cell_overlap(a, this->cell_range(b));
-  }
-
   /// \brief Return true if the memory write at `offset` of size `size`
   /// can update the given cell. Return false if the number of overlaps between
   /// the cell and the memory write is not exactly 1.
@@ -527,19 +648,20 @@ private:
     }
 
     CellSetT new_cells = cells;
-    bool found = false;
 
     // remove overlapping cells
-    for (VariableRef cell : cells) {
-      if (cell == new_cell) {
-        found = true;
-      } else if (this->cell_overlap(cell, new_cell)) {
+    std::vector< VariableRef > removed_cells;
+    for (VariableRef cell : cells.overlapping(this->cell_range(new_cell))) {
+      if (cell != new_cell) {
         this->forget_surface_cell(cell);
-        new_cells.remove(cell);
+        removed_cells.push_back(cell);
       }
     }
 
-    if (!found) {
+    if (!removed_cells.empty()) {
+      new_cells.remove(CellSetT(removed_cells.begin(), removed_cells.end()));
+    }
+    if (!cells.contains(new_cell)) {
       new_cells.add(new_cell);
     }
     this->_cells.set(base, new_cells);
@@ -565,22 +687,24 @@ private:
       return {};
     }
 
-    CellSetT new_cells = cells;
+    std::vector< VariableRef > removed_cells;
     std::vector< VariableRef > updated_cells;
 
-    for (VariableRef cell : cells) {
-      if (this->cell_overlap(cell, range)) {
-        if (this->cell_realizes_once(cell, offset, size)) {
-          // that cell has only one way to be affected by the write statement
-          updated_cells.push_back(cell);
-        } else {
-          this->forget_surface_cell(cell);
-          new_cells.remove(cell);
-        }
+    for (VariableRef cell : cells.overlapping(range)) {
+      if (this->cell_realizes_once(cell, offset, size)) {
+        // that cell has only one way to be affected by the write statement
+        updated_cells.push_back(cell);
+      } else {
+        this->forget_surface_cell(cell);
+        removed_cells.push_back(cell);
       }
     }
 
-    this->_cells.set(base, new_cells);
+    if (!removed_cells.empty()) {
+      CellSetT new_cells = cells;
+      new_cells.remove(CellSetT(removed_cells.begin(), removed_cells.end()));
+      this->_cells.set(base, new_cells);
+    }
     return updated_cells;
   }
 
@@ -598,6 +722,704 @@ private:
     return new_cell;
   }
 
+  /// \brief Return true if `a` and `b` are congruent modulo `size`
+  static bool congruent(const MachineInt& a,
+                        const MachineInt& b,
+                        const MachineInt& size) {
+    ZNumber n = size.to_z_number();
+    return mod(a.to_z_number(), n) == mod(b.to_z_number(), n);
+  }
+
+  /// \brief Return true if the memory location `base` is summarized
+  bool is_summarized(MemoryLocationRef base) const {
+    return this->_summaries.at(base) != boost::none;
+  }
+
+  /// \brief Return the size of the elements of a summary
+  static const MachineInt& summary_size(const Summary& summary) {
+    return CellVariableTrait::size(summary.cells.front());
+  }
+
+  /// \brief Return the offset of the first element of the i-th segment of a
+  /// summary
+  static MachineInt segment_lb(const Summary& summary, std::size_t i) {
+    return i == 0 ? summary.range.lb()
+                  : CellVariableTrait::offset(summary.cells[i]);
+  }
+
+  /// \brief Return the offset of the last element of the i-th segment of a
+  /// summary
+  static MachineInt segment_ub(const Summary& summary, std::size_t i) {
+    return i + 1 == summary.cells.size()
+               ? summary.range.ub()
+               : CellVariableTrait::offset(summary.cells[i + 1]) -
+                     summary_size(summary);
+  }
+
+  /// \brief Return the offsets of the elements of the i-th segment of a
+  /// summary
+  static Interval segment_range(const Summary& summary, std::size_t i) {
+    return Interval(segment_lb(summary, i), segment_ub(summary, i));
+  }
+
+  /// \brief Return the byte range of the elements of a summary
+  static Interval summary_range(const Summary& summary) {
+    if (summary.range.is_bottom()) {
+      return summary.range;
+    }
+    const MachineInt& size = summary_size(summary);
+    MachineInt one(1, size.bit_width(), Unsigned);
+    bool overflow = false;
+    MachineInt ub = add(summary.range.ub(), size - one, overflow);
+    if (overflow) {
+      ub.set_max();
+    }
+    return Interval(summary.range.lb(), ub);
+  }
+
+  /// \brief Return true if all the possible values of `offset` are offsets of
+  /// elements of the given summary
+  bool summary_aligned(const Summary& summary,
+                       const IntervalCongruence& offset) const {
+    ikos_assert(!summary.range.is_bottom());
+
+    if (offset.is_bottom()) {
+      return false;
+    }
+
+    ZNumber size = summary_size(summary).to_z_number();
+    machine_int::Congruence c = offset.congruence();
+    return mod(c.modulus(), size) == 0 &&
+           mod(c.residue(), size) ==
+               mod(summary.range.lb().to_z_number(), size);
+  }
+
+  /// \brief Return true if the memory location `base` is summarized
+  ///
+  /// If the memory location is not summarized yet and realizing the cell
+  /// `(base, offset, size)` would exceed the threshold, its cells are smashed.
+  bool summarize(VariableFactory& vfac,
+                 MemoryLocationRef base,
+                 const MachineInt& offset,
+                 const MachineInt& size) {
+    if (this->is_summarized(base)) {
+      return true;
+    }
+    if (this->_smash_threshold == 0) {
+      return false;
+    }
+
+    const CellSetT& cells = this->_cells.get(base);
+
+    if (cells.size() < this->_smash_threshold) {
+      return false;
+    }
+
+    // A cell that was never created cannot be in the set
+    boost::optional< VariableRef > c =
+        CellFactoryTrait::lookup_cell(vfac, base, offset, size);
+    if (c && cells.contains(*c)) {
+      return false;
+    }
+
+    this->smash(vfac, base, size);
+    return true;
+  }
+
+  /// \brief Smash all the cells of the memory location `base` into a summary
+  /// cell
+  ///
+  /// If the cells are not contiguous elements of the same size, the summary
+  /// cell represents nothing and new elements will have the given size.
+  void smash(VariableFactory& vfac,
+             MemoryLocationRef base,
+             const MachineInt& size) {
+    const CellSetT& cell_set = this->_cells.get(base);
+    std::vector< VariableRef > cells(cell_set.begin(), cell_set.end());
+    std::sort(cells.begin(), cells.end(), [](VariableRef a, VariableRef b) {
+      return CellVariableTrait::offset(a) < CellVariableTrait::offset(b);
+    });
+
+    // Check that the cells are contiguous elements of the same size
+    bool contiguous = !cells.empty();
+    for (std::size_t i = 1; contiguous && i < cells.size(); i++) {
+      const MachineInt& prev_size = CellVariableTrait::size(cells[i - 1]);
+      bool overflow = false;
+      MachineInt next =
+          add(CellVariableTrait::offset(cells[i - 1]), prev_size, overflow);
+      contiguous = !overflow &&
+                   CellVariableTrait::size(cells[i]) == prev_size &&
+                   CellVariableTrait::offset(cells[i]) == next;
+    }
+
+    MachineInt zero = MachineInt::zero(size.bit_width(), Unsigned);
+    MachineInt elem_size =
+        contiguous ? CellVariableTrait::size(cells.front()) : size;
+    VariableRef summary_cell = this->cell(vfac, base, zero, elem_size);
+    Summary summary{{summary_cell},
+                    Interval::bottom(size.bit_width(), Unsigned)};
+
+    if (contiguous) {
+      // The summary cell is the join of all cells
+      Interval value = this->integers().to_interval(cells.front());
+      PointerAbsValueT pointer = this->_pointer.get(cells.front());
+      Uninitialized uninitialized = this->_uninitialized.get(cells.front());
+
+      for (auto it = std::next(cells.begin()); it != cells.end(); ++it) {
+        value.join_with(this->integers().to_interval(*it));
+        pointer.join_with(this->_pointer.get(*it));
+        uninitialized.join_with(this->_uninitialized.get(*it));
+      }
+
+      for (VariableRef cell : cells) {
+        this->forget_surface_cell(cell);
+      }
+
+      this->integers().set(summary_cell, value);
+      this->_pointer.refine(summary_cell, pointer);
+      this->_uninitialized.set(summary_cell, uninitialized);
+      summary.range = Interval(CellVariableTrait::offset(cells.front()),
+                               CellVariableTrait::offset(cells.back()));
+    } else {
+      for (VariableRef cell : cells) {
+        this->forget_surface_cell(cell);
+      }
+      this->forget_surface_cell(summary_cell);
+    }
+
+    this->_cells.forget(base);
+    this->_summaries.insert_or_assign(base, summary);
+  }
+
+  /// \brief Perform a write on the summarized memory location `base`
+  ///
+  /// `strong` is true if the write is known to happen at a single offset.
+  void summary_write(VariableFactory& vfac,
+                     MemoryLocationRef base,
+                     VariableRef offset,
+                     const MachineInt& size,
+                     const LiteralT& rhs,
+                     bool strong) {
+    Summary summary = *this->_summaries.at(base);
+    IntervalCongruence offset_ic =
+        this->integers().to_interval_congruence(offset);
+    Interval offset_intv = offset_ic.interval();
+    boost::optional< MachineInt > offset_value = offset_intv.singleton();
+    strong = strong && offset_value;
+
+    if (summary.range.is_bottom()) {
+      if (strong) {
+        // Start a new summary with that element
+        this->forget_surface_cells(summary.cells);
+        summary.cells = {
+            this->cell(vfac,
+                       base,
+                       MachineInt::zero(size.bit_width(), Unsigned),
+                       size)};
+        summary.range = offset_intv;
+        this->strong_update(summary.cells.front(), rhs);
+        this->_summaries.insert_or_assign(base, summary);
+      }
+      return;
+    }
+
+    if (size != summary_size(summary) ||
+        !this->summary_aligned(summary, offset_ic)) {
+      // The write does not match the elements
+      MachineInt one(1, size.bit_width(), Unsigned);
+      this->forget_cells(base,
+                         add(offset_intv,
+                             Interval(MachineInt::zero(size.bit_width(),
+                                                       Unsigned),
+                                      size - one)));
+      return;
+    }
+
+    if (strong) {
+      this->summary_strong_write(vfac, base, summary, *offset_value, rhs);
+      return;
+    }
+
+    for (std::size_t i = 0; i < summary.cells.size(); i++) {
+      if (!segment_range(summary, i).meet(offset_intv).is_bottom()) {
+        this->weak_update(summary.cells[i], rhs);
+      }
+    }
+  }
+
+  /// \brief Perform a write on the element at `offset` of the summarized
+  /// memory location `base`
+  ///
+  /// The element gets its own segment if the number of segments allows it.
+  void summary_strong_write(VariableFactory& vfac,
+                            MemoryLocationRef base,
+                            Summary summary,
+                            const MachineInt& offset,
+                            const LiteralT& rhs) {
+    MachineInt elem_size = summary_size(summary);
+    MachineInt lb = summary.range.lb();
+    MachineInt ub = summary.range.ub();
+    bool room = summary.cells.size() < this->_max_segments;
+
+    if (lb <= offset && offset <= ub) {
+      std::size_t i = summary.cells.size() - 1;
+      while (segment_lb(summary, i) > offset) {
+        i--;
+      }
+      MachineInt seg_lb = segment_lb(summary, i);
+      MachineInt seg_ub = segment_ub(summary, i);
+
+      if (seg_lb == seg_ub) {
+        // The segment represents only that element
+        this->strong_update(summary.cells[i], rhs);
+        return;
+      }
+
+      std::size_t n = summary.cells.size() + (seg_lb < offset ? 1 : 0) +
+                      (offset < seg_ub ? 1 : 0);
+      if (n > this->_max_segments) {
+        this->weak_update(summary.cells[i], rhs);
+        return;
+      }
+
+      // Split the segment around the element
+      if (offset < seg_ub) {
+        VariableRef tail =
+            this->cell(vfac, base, offset + elem_size, elem_size);
+        this->join_cells(tail, {summary.cells[i]});
+        summary.cells.insert(summary.cells.begin() + i + 1, tail);
+      }
+      if (seg_lb < offset) {
+        VariableRef elem = this->cell(vfac, base, offset, elem_size);
+        summary.cells.insert(summary.cells.begin() + i + 1, elem);
+        this->strong_update(elem, rhs);
+      } else {
+        this->strong_update(summary.cells[i], rhs);
+      }
+    } else {
+      // Check if the write appends an element
+      bool overflow = false;
+      MachineInt next = add(ub, elem_size, overflow);
+      if (!overflow && offset == next) {
+        if (room) {
+          VariableRef elem = this->cell(vfac, base, offset, elem_size);
+          summary.cells.push_back(elem);
+          this->strong_update(elem, rhs);
+        } else {
+          this->weak_update(summary.cells.back(), rhs);
+        }
+        summary.range = Interval(lb, offset);
+      } else if (lb >= elem_size && offset == lb - elem_size) {
+        if (room) {
+          // The first summary cell always represents the first segment
+          VariableRef second = this->cell(vfac, base, lb, elem_size);
+          this->join_cells(second, {summary.cells.front()});
+          summary.cells.insert(std::next(summary.cells.begin()), second);
+          this->strong_update(summary.cells.front(), rhs);
+        } else {
+          this->weak_update(summary.cells.front(), rhs);
+        }
+        summary.range = Interval(offset, ub);
+      } else {
+        // The write does not touch the elements of the summary
+        return;
+      }
+    }
+
+    this->_summaries.insert_or_assign(base, summary);
+  }
+
+  /// \brief Add the summary cells to read on the summarized memory location
+  /// `base` to `cells`
+  ///
+  /// Returns false if the elements read are unknown. Sets `summarized` to
+  /// true if a summary cell read represents several elements.
+  bool summary_read(MemoryLocationRef base,
+                    VariableRef offset,
+                    const MachineInt& size,
+                    std::vector< VariableRef >& cells,
+                    bool& summarized) const {
+    const Summary& summary = *this->_summaries.at(base);
+
+    if (summary.range.is_bottom() || size != summary_size(summary)) {
+      return false;
+    }
+
+    IntervalCongruence offset_ic =
+        this->integers().to_interval_congruence(offset);
+
+    if (!offset_ic.interval().leq(summary.range) ||
+        !this->summary_aligned(summary, offset_ic)) {
+      return false;
+    }
+
+    for (std::size_t i = 0; i < summary.cells.size(); i++) {
+      Interval segment = segment_range(summary, i);
+      if (!segment.meet(offset_ic.interval()).is_bottom()) {
+        cells.push_back(summary.cells[i]);
+        summarized = summarized || !segment.singleton();
+      }
+    }
+    return true;
+  }
+
+  /// \brief Set the summary cell `dest` to the join of the cells `srcs`
+  ///
+  /// The relations with the source cells are dropped, since they represent
+  /// other elements.
+  void join_cells(VariableRef dest, const std::vector< VariableRef >& srcs) {
+    ikos_assert(!srcs.empty());
+
+    if (srcs.size() == 1 && srcs.front() == dest) {
+      return;
+    }
+
+    Interval value = this->integers().to_interval(srcs.front());
+    PointerAbsValueT pointer = this->_pointer.get(srcs.front());
+    Uninitialized uninitialized = this->_uninitialized.get(srcs.front());
+
+    for (auto it = std::next(srcs.begin()); it != srcs.end(); ++it) {
+      value.join_with(this->integers().to_interval(*it));
+      pointer.join_with(this->_pointer.get(*it));
+      uninitialized.join_with(this->_uninitialized.get(*it));
+    }
+
+    this->forget_surface_cell(dest);
+    this->integers().set(dest, value);
+    this->_pointer.refine(dest, pointer);
+    this->_uninitialized.set(dest, uninitialized);
+  }
+
+  /// \brief Perform a read `lhs = cells` on the given cells
+  ///
+  /// If `summarized` is true, the relations between `lhs` and the cells are
+  /// dropped, since summary cells represent several elements.
+  void read_cells(const LiteralT& lhs,
+                  const std::vector< VariableRef >& cells,
+                  bool summarized) {
+    ikos_assert(!cells.empty());
+    bool first = true;
+
+    for (VariableRef cell : cells) {
+      if (first) {
+        this->strong_update(lhs, cell);
+        first = false;
+      } else {
+        this->weak_update(lhs, cell);
+      }
+    }
+
+    if (!summarized) {
+      return;
+    }
+
+    this->_pointer.normalize();
+
+    if (lhs.is_machine_int_var()) {
+      this->integers().set(lhs.var(), this->integers().to_interval(lhs.var()));
+    } else if (lhs.is_pointer_var()) {
+      PointerAbsValueT value = this->_pointer.get(lhs.var());
+      this->_pointer.forget(lhs.var());
+      this->_pointer.refine(lhs.var(), value);
+    }
+  }
+
+  /// \brief Copy the cells of `src_addr` within `src_range` into `dest_addr`,
+  /// shifted from `src_offset` to `dest_offset`
+  ///
+  /// The destination cells are added at once.
+  void copy_cells(VariableFactory& vfac,
+                  MemoryLocationRef src_addr,
+                  const Interval& src_range,
+                  MemoryLocationRef dest_addr,
+                  const MachineInt& src_offset,
+                  const MachineInt& dest_offset) {
+    const CellSetT& src_cells = this->_cells.get(src_addr);
+
+    if (src_cells.is_empty() || this->is_summarized(dest_addr)) {
+      return;
+    }
+
+    std::vector< VariableRef > new_cells;
+
+    for (VariableRef cell : src_cells.overlapping(src_range)) {
+      if (this->cell_range(cell).leq(src_range)) {
+        VariableRef new_cell =
+            this->cell(vfac,
+                       dest_addr,
+                       dest_offset + CellVariableTrait::offset(cell) -
+                           src_offset,
+                       CellVariableTrait::size(cell));
+        new_cells.push_back(new_cell);
+        this->integers().assign(new_cell, cell);
+        this->pointers().assign(new_cell, cell);
+        this->uninitialized().assign(new_cell, cell);
+      }
+    }
+
+    if (!new_cells.empty()) {
+      CellSetT dest_cells = this->_cells.get(dest_addr);
+      dest_cells.add(CellSetT(new_cells.begin(), new_cells.end()));
+      this->_cells.set(dest_addr, dest_cells);
+    }
+  }
+
+  /// \brief Return the summary of the elements represented by both `left`
+  /// and `right`, or boost::none if there is none
+  ///
+  /// The result only keeps the segment boundaries of both sides.
+  static boost::optional< Summary > common_summary(const Summary& left,
+                                                   const Summary& right) {
+    if (left.cells.front() != right.cells.front()) {
+      return boost::none;
+    }
+
+    Interval range = left.range.meet(right.range);
+
+    if (range.is_bottom() || !congruent(left.range.lb(),
+                                        right.range.lb(),
+                                        summary_size(left))) {
+      return boost::none;
+    }
+
+    Summary summary{{left.cells.front()}, range};
+    for (auto it = std::next(left.cells.begin()); it != left.cells.end();
+         ++it) {
+      const MachineInt& offset = CellVariableTrait::offset(*it);
+      if (range.lb() < offset && offset <= range.ub() &&
+          std::find(std::next(right.cells.begin()), right.cells.end(), *it) !=
+              right.cells.end()) {
+        summary.cells.push_back(*it);
+      }
+    }
+    return summary;
+  }
+
+  /// \brief Return true if the segments of `summary` within the range of
+  /// `target` are the segments of `target`
+  static bool same_segments(const Summary& summary, const Summary& target) {
+    std::size_t n = 1;
+    while (n < summary.cells.size() &&
+           CellVariableTrait::offset(summary.cells[n]) <= target.range.ub()) {
+      n++;
+    }
+    return n == target.cells.size() &&
+           std::equal(target.cells.begin(),
+                      target.cells.end(),
+                      summary.cells.begin());
+  }
+
+  /// \brief Rewrite the summary cells of `summary` into the segments of
+  /// `target`
+  ///
+  /// The segment boundaries of `target` must be segment boundaries of
+  /// `summary`, and the range of `target` must be included in the range of
+  /// `summary`. The other cells of `summary` are left unchanged.
+  void resegment(const Summary& summary, const Summary& target) {
+    for (std::size_t k = 0; k < target.cells.size(); k++) {
+      Interval segment = segment_range(target, k);
+      std::vector< VariableRef > cells;
+      for (std::size_t i = 0; i < summary.cells.size(); i++) {
+        if (!segment_range(summary, i).meet(segment).is_bottom()) {
+          cells.push_back(summary.cells[i]);
+        }
+      }
+      this->join_cells(target.cells[k], cells);
+    }
+  }
+
+  /// \brief Merge the summaries of `other` into `this`, before a join, meet,
+  /// widening or narrowing
+  ///
+  /// Only the memory locations summarized on both sides with the same element
+  /// size keep elements, namely the elements represented on both sides. Only
+  /// the segment boundaries of both sides are kept, which ensures the
+  /// termination of widenings. The segments of `this` are rewritten in place,
+  /// while the segments of `other` are rewritten in `copy` if needed, in which
+  /// case the underlying domains must be merged with `copy`.
+  ///
+  /// For a meet, a memory location summarized on one side only keeps its
+  /// summary if the other side has no cell for it.
+  ///
+  /// Returns the summary cells to forget once the underlying domains are
+  /// merged.
+  std::vector< VariableRef > merge_summaries(
+      const ValueDomain& other,
+      boost::optional< ValueDomain >& copy,
+      bool meet = false) {
+    this->_smash_threshold =
+        std::max(this->_smash_threshold, other._smash_threshold);
+    this->_max_segments = std::max(this->_max_segments, other._max_segments);
+
+    std::vector< VariableRef > forgotten;
+
+    if (this->_summaries.shares_tree(other._summaries)) {
+      return forgotten; // identical summaries, including both empty
+    }
+
+    // Forget the cells of `summary` that are not in `target`
+    auto forget_others = [&forgotten](const Summary& summary,
+                                      const Summary& target) {
+      for (VariableRef cell : summary.cells) {
+        if (std::find(target.cells.begin(), target.cells.end(), cell) ==
+            target.cells.end()) {
+          forgotten.push_back(cell);
+        }
+      }
+    };
+
+    SummaryMapT summaries;
+
+    // Memory locations summarized on one side only
+    for (auto it = this->_summaries.begin(), et = this->_summaries.end();
+         it != et;
+         ++it) {
+      if (other.is_summarized(it->first)) {
+        continue;
+      }
+      if (meet && other._cells.get(it->first).is_empty()) {
+        summaries.insert_or_assign(it->first, it->second);
+      } else {
+        forgotten.insert(forgotten.end(),
+                         it->second.cells.begin(),
+                         it->second.cells.end());
+      }
+    }
+    for (auto it = other._summaries.begin(), et = other._summaries.end();
+         it != et;
+         ++it) {
+      if (this->is_summarized(it->first)) {
+        continue;
+      }
+      if (meet && this->_cells.get(it->first).is_empty()) {
+        summaries.insert_or_assign(it->first, it->second);
+      } else {
+        forgotten.insert(forgotten.end(),
+                         it->second.cells.begin(),
+                         it->second.cells.end());
+      }
+    }
+
+    for (auto it = this->_summaries.begin(), et = this->_summaries.end();
+         it != et;
+         ++it) {
+      auto right = other._summaries.at(it->first);
+      if (!right) {
+        continue;
+      }
+
+      const Summary& left = it->second;
+      boost::optional< Summary > target = common_summary(left, *right);
+
+      if (!target) {
+        target = Summary{{left.cells.front()},
+                         Interval::bottom(left.range.bit_width(), Unsigned)};
+        forgotten.insert(forgotten.end(), left.cells.begin(), left.cells.end());
+        forgotten.insert(forgotten.end(),
+                         right->cells.begin(),
+                         right->cells.end());
+      } else {
+        if (!same_segments(left, *target)) {
+          this->resegment(left, *target);
+        }
+        if (!same_segments(*right, *target)) {
+          if (!copy) {
+            copy = other;
+          }
+          copy->resegment(*right, *target);
+        }
+        forget_others(left, *target);
+        forget_others(*right, *target);
+      }
+
+      summaries.insert_or_assign(it->first, *target);
+    }
+
+    this->_summaries = std::move(summaries);
+    return forgotten;
+  }
+
+  /// \brief Return true if the summaries of `this` are more precise than the
+  /// summaries of `other`, up to the segment boundaries of `this` that are
+  /// not in `other`
+  bool summaries_leq(const ValueDomain& other) const {
+    if (this->_summaries.shares_tree(other._summaries)) {
+      return true;
+    }
+
+    for (auto it = other._summaries.begin(), et = other._summaries.end();
+         it != et;
+         ++it) {
+      const Summary& right = it->second;
+
+      if (right.range.is_bottom()) {
+        continue;
+      }
+
+      auto left = this->_summaries.at(it->first);
+
+      if (!left || left->cells.front() != right.cells.front() ||
+          !right.range.leq(left->range) ||
+          !congruent(left->range.lb(), right.range.lb(), summary_size(right))) {
+        return false;
+      }
+
+      // The segment boundaries of `other` must be boundaries of `this`
+      for (auto c = std::next(right.cells.begin()); c != right.cells.end();
+           ++c) {
+        if (std::find(left->cells.begin(), left->cells.end(), *c) ==
+            left->cells.end()) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /// \brief Return a copy of `this` where the summaries are rewritten into the
+  /// segments of the summaries of `other`, or boost::none if the segments
+  /// already match
+  ///
+  /// Requires `this->summaries_leq(other)`.
+  boost::optional< ValueDomain > resegment_summaries(
+      const ValueDomain& other) const {
+    boost::optional< ValueDomain > copy;
+
+    if (this->_summaries.shares_tree(other._summaries)) {
+      return copy;
+    }
+
+    for (auto it = other._summaries.begin(), et = other._summaries.end();
+         it != et;
+         ++it) {
+      const Summary& right = it->second;
+
+      if (right.range.is_bottom()) {
+        continue;
+      }
+
+      const Summary& left = *this->_summaries.at(it->first);
+
+      if (!same_segments(left, right)) {
+        if (!copy) {
+          copy = *this;
+        }
+        copy->resegment(left, right);
+        copy->_summaries.insert_or_assign(it->first, right);
+      }
+    }
+    return copy;
+  }
+
+  /// \brief Return true if the summaries of `this` and `other` are equal
+  bool summaries_equals(const ValueDomain& other) const {
+    return this->_summaries.equals(other._summaries,
+                                   [](const Summary& left,
+                                      const Summary& right) {
+                                     return left == right;
+                                   });
+  }
+
   /// \brief Assignment `var = literal`
   class LiteralWriter : public LiteralT::template Visitor<> {
   private:
@@ -838,6 +1660,16 @@ public:
       MachineInt offset = *offset_intv.singleton();
 
       for (MemoryLocationRef addr : addrs) {
+        if (this->summarize(vfac, addr, offset, size)) {
+          this->summary_write(vfac,
+                              addr,
+                              this->offset_var(ptr),
+                              size,
+                              rhs,
+                              addrs.size() == 1);
+          continue;
+        }
+
         VariableRef cell =
             this->write_realize_single_cell(vfac, addr, offset, size);
 
@@ -866,6 +1698,16 @@ public:
       // update.
 
       for (MemoryLocationRef addr : addrs) {
+        if (this->is_summarized(addr)) {
+          this->summary_write(vfac,
+                              addr,
+                              this->offset_var(ptr),
+                              size,
+                              rhs,
+                              /*strong=*/false);
+          continue;
+        }
+
         std::vector< VariableRef > cells =
             this->write_realize_range_cells(addr, this->offset_var(ptr), size);
         for (VariableRef cell : cells) {
@@ -942,19 +1784,28 @@ public:
       //
       // We can perform the usual reduction and update.
       MachineInt offset = *offset_intv.singleton();
-      bool first = true;
+      std::vector< VariableRef > cells;
+      bool summarized = false;
+      bool known = true;
 
       for (MemoryLocationRef addr : addrs) {
-        VariableRef cell =
-            this->read_realize_single_cell(vfac, addr, offset, size);
-
-        if (first) {
-          this->strong_update(lhs, cell);
-          first = false;
+        if (this->summarize(vfac, addr, offset, size)) {
+          known = known && this->summary_read(addr,
+                                              this->offset_var(ptr),
+                                              size,
+                                              cells,
+                                              summarized);
         } else {
-          this->weak_update(lhs, cell);
+          cells.push_back(
+              this->read_realize_single_cell(vfac, addr, offset, size));
         }
       }
+
+      if (known) {
+        this->read_cells(lhs, cells, summarized);
+      } else {
+        this->forget_surface(lhs.var());
+      }
     } else {
       // The offset is a range.
       //
@@ -963,16 +1814,30 @@ public:
       // summarized cells that's why if we read a summarized cell
       // the only sound result we can return is top.
       //
-      // TODO(jnavas): note that we could have a bounded array for which we
-      // have the complete set of cells and thus we could be more
-      // precise in that case.
-      //
-      // To deal with this situation in a more systematic way
-      // we should combine anyway the value domain with some
-      // summarization array-based domain (e.g.,some array domain
-      // such as a trivial array smashing or something more
-      // expressive like Cousot&Logozzo's POPL'11).
-      this->forget_surface(lhs.var());
+      // Memory locations smashed into summary cells are the exception: if
+      // all the elements read are represented by summary cells, we can
+      // return their value.
+      std::vector< VariableRef > cells;
+      bool summarized = false;
+      bool known = true;
+
+      for (MemoryLocationRef addr : addrs) {
+        if (!this->is_summarized(addr) ||
+            !this->summary_read(addr,
+                                this->offset_var(ptr),
+                                size,
+                                cells,
+                                summarized)) {
+          known = false;
+          break;
+        }
+      }
+
+      if (known) {
+        this->read_cells(lhs, cells, summarized);
+      } else {
+        this->forget_surface(lhs.var());
+      }
     }
 
     // Handle pointer sets
@@ -1058,40 +1923,25 @@ public:
       MachineInt one(1, dest_intv.bit_width(), Unsigned);
       Interval src_range(src_offset, src_offset + (size_lb - one));
 
-      ValueDomain prev(*this);
-      bool first = true;
-
-      for (MemoryLocationRef src_addr : src_addrs) {
-        // copy from src_addr/src_offset to dest_addr/dest_offset
-        ValueDomain inv(prev);
-        const CellSetT& src_cells = inv._cells.get(src_addr);
-
-        if (!src_cells.is_empty()) {
-          CellSetT dest_cells = inv._cells.get(dest_addr);
-
-          for (VariableRef cell : src_cells) {
-            if (this->cell_range(cell).leq(src_range)) {
-              VariableRef new_cell =
-                  this->cell(vfac,
-                             dest_addr,
-                             dest_offset + CellVariableTrait::offset(cell) -
-                                 src_offset,
-                             CellVariableTrait::size(cell));
-              dest_cells.add(new_cell);
-              inv.integers().assign(new_cell, cell);
-              inv.pointers().assign(new_cell, cell);
-              inv.uninitialized().assign(new_cell, cell);
-            }
+      if (auto src_addr = src_addrs.singleton()) {
+        // copy in place, no need to join copies of the abstract value
+        this->copy_cells(
+            vfac, *src_addr, src_range, dest_addr, src_offset, dest_offset);
+      } else {
+        ValueDomain prev(*this);
+        bool first = true;
+
+        for (MemoryLocationRef src_addr : src_addrs) {
+          ValueDomain inv(prev);
+          inv.copy_cells(
+              vfac, src_addr, src_range, dest_addr, src_offset, dest_offset);
+
+          if (first) {
+            this->operator=(std::move(inv));
+            first = false;
+          } else {
+            this->join_with(inv);
           }
-
-          inv._cells.set(dest_addr, dest_cells);
-        }
-
-        if (first) {
-          this->operator=(std::move(inv));
-          first = false;
-        } else {
-          this->join_with(inv);
         }
       }
     }
@@ -1192,12 +2042,17 @@ public:
           add(dest_intv, Interval(zero, size_intv.ub() - one));
 
       for (MemoryLocationRef addr : addrs) {
+        if (this->is_summarized(addr)) {
+          this->forget_cells(addr, unsafe_range);
+          continue;
+        }
+
         const CellSetT& cells = this->_cells.get(addr);
 
         if (!cells.is_empty()) {
-          CellSetT new_cells = cells;
+          std::vector< VariableRef > removed_cells;
 
-          for (VariableRef cell : cells) {
+          for (VariableRef cell : cells.overlapping(unsafe_range)) {
             Interval range = this->cell_range(cell);
 
             if (range.leq(safe_range)) {
@@ -1210,11 +2065,16 @@ public:
               }
             } else if (range.leq(unsafe_range)) {
               this->forget_surface_cell(cell);
-              new_cells.remove(cell);
+              removed_cells.push_back(cell);
             }
           }
 
-          this->_cells.set(addr, new_cells);
+          if (!removed_cells.empty()) {
+            CellSetT new_cells = cells;
+            new_cells.remove(
+                CellSetT(removed_cells.begin(), removed_cells.end()));
+            this->_cells.set(addr, new_cells);
+          }
         }
       }
     } else {
@@ -1252,6 +2112,13 @@ private:
     this->uninitialized().forget(x);
   }
 
+  /// \brief Forget the given cell variables
+  void forget_surface_cells(const std::vector< VariableRef >& cells) {
+    for (VariableRef cell : cells) {
+      this->forget_surface_cell(cell);
+    }
+  }
+
   /// \brief Forget all synthetic cells
   void forget_cells() {
     if (this->_cells.is_bottom()) {
@@ -1272,10 +2139,24 @@ private:
     }
 
     this->_cells.set_to_top();
+
+    for (auto it = this->_summaries.begin(), et = this->_summaries.end();
+         it != et;
+         ++it) {
+      this->forget_surface_cells(it->second.cells);
+    }
+
+    this->_summaries.clear();
   }
 
   /// \brief Forget the synthetic cells for the given memory location
   void forget_cells(MemoryLocationRef addr) {
+    if (auto summary = this->_summaries.at(addr)) {
+      this->forget_surface_cells(summary->cells);
+      this->_summaries.erase(addr);
+      return;
+    }
+
     const CellSetT& cells = this->_cells.get(addr);
 
     if (cells.is_bottom()) {
@@ -1316,21 +2197,38 @@ private:
   void forget_cells(MemoryLocationRef addr, const Interval& range) {
     ikos_assert(!range.is_bottom());
 
+    if (auto summary = this->_summaries.at(addr)) {
+      if (!summary_range(*summary).meet(range).is_bottom()) {
+        // The elements of the summary cells are now unknown
+        VariableRef summary_cell = summary->cells.front();
+        this->forget_surface_cells(summary->cells);
+        this->_summaries.insert_or_assign(addr,
+                                          Summary{{summary_cell},
+                                                  Interval::bottom(
+                                                      range.bit_width(),
+                                                      Unsigned)});
+      }
+      return;
+    }
+
     const CellSetT& cells = this->_cells.get(addr);
-    CellSetT new_cells = cells;
 
     if (cells.is_empty()) {
       return;
     }
 
-    for (VariableRef cell : cells) {
-      if (cell_overlap(cell, range)) {
-        this->forget_surface_cell(cell);
-        new_cells.remove(cell);
-      }
+    std::vector< VariableRef > removed_cells;
+
+    for (VariableRef cell : cells.overlapping(range)) {
+      this->forget_surface_cell(cell);
+      removed_cells.push_back(cell);
     }
 
-    this->_cells.set(addr, new_cells);
+    if (!removed_cells.empty()) {
+      CellSetT new_cells = cells;
+      new_cells.remove(CellSetT(removed_cells.begin(), removed_cells.end()));
+      this->_cells.set(addr, new_cells);
+    }
   }
 
   /// \brief Forget all pointer sets
@@ -1386,6 +2284,161 @@ public:
     }
   }
 
+  void forget_unreachable_mem() override {
+    if (this->is_bottom()) {
+      return;
+    }
+
+    std::vector< MemoryLocationRef > addrs = this->_lifetime.deallocated();
+
+    if (addrs.empty()) {
+      return;
+    }
+
+    // Memory locations referenced by pointer variables and pointer cells
+    PointsToSetT referenced = this->_pointer.referenced_locations();
+
+    if (referenced.is_top()) {
+      return;
+    }
+
+    // Memory locations referenced by pointer sets
+    for (auto it = this->_pointer_sets.begin(), et = this->_pointer_sets.end();
+         it != et;
+         ++it) {
+      referenced.join_with(it->second.points_to());
+    }
+
+    for (MemoryLocationRef addr : addrs) {
+      if (!referenced.contains(addr)) {
+        this->forget_mem(addr);
+        this->_lifetime.forget(addr);
+      }
+    }
+  }
+
+  /// \brief Forget the memory locations that are no longer reachable
+  ///
+  /// The roots are the memory locations referenced by pointer variables that
+  /// are not cells, and the memory locations that are neither deallocated nor
+  /// collectable according to `is_collectable`. The locations in the
+  /// points-to sets of the cells, the summary cells and the pointer set of a
+  /// reachable memory location are reachable. Pointers with an unknown
+  /// points-to set are ignored.
+  ///
+  /// Drops the cells, the pointer set and the lifetime of every unreachable
+  /// memory location, and returns these locations.
+  template < typename IsCollectable >
+  std::vector< MemoryLocationRef > forget_unreachable_mem(
+      const IsCollectable& is_collectable) {
+    std::vector< MemoryLocationRef > collected;
+
+    if (this->is_bottom()) {
+      return collected;
+    }
+
+    PointsToSetT reachable = this->_pointer.root_locations();
+
+    if (reachable.is_top()) {
+      return collected;
+    }
+
+    // Memory locations with an abstract state
+    PointsToSetT known = PointsToSetT::empty();
+    for (auto it = this->_cells.begin(), et = this->_cells.end(); it != et;
+         ++it) {
+      known.add(it->first);
+    }
+    for (auto it = this->_summaries.begin(), et = this->_summaries.end();
+         it != et;
+         ++it) {
+      known.add(it->first);
+    }
+    for (auto it = this->_pointer_sets.begin(), et = this->_pointer_sets.end();
+         it != et;
+         ++it) {
+      known.add(it->first);
+    }
+    for (MemoryLocationRef addr : this->_lifetime.locations()) {
+      known.add(addr);
+    }
+
+    for (MemoryLocationRef addr : known) {
+      if (!this->_lifetime.is_deallocated(addr) && !is_collectable(addr)) {
+        reachable.add(addr);
+      }
+    }
+
+    std::vector< MemoryLocationRef > worklist(reachable.begin(),
+                                              reachable.end());
+
+    // Add the memory locations referenced by `ptr` to the worklist
+    auto visit = [&](VariableRef ptr) {
+      if (!MemVariableTrait::is_pointer(ptr)) {
+        return;
+      }
+      PointsToSetT addrs = this->_pointer.points_to(ptr);
+      if (!addrs.is_set()) {
+        return;
+      }
+      for (MemoryLocationRef addr : addrs) {
+        if (!reachable.contains(addr)) {
+          reachable.add(addr);
+          worklist.push_back(addr);
+        }
+      }
+    };
+
+    do {
+      while (!worklist.empty()) {
+        MemoryLocationRef addr = worklist.back();
+        worklist.pop_back();
+
+        if (auto summary = this->_summaries.at(addr)) {
+          for (VariableRef cell : summary->cells) {
+            visit(cell);
+          }
+        } else {
+          const CellSetT& cells = this->_cells.get(addr);
+          if (!cells.is_bottom()) {
+            for (VariableRef cell : cells) {
+              visit(cell);
+            }
+          }
+        }
+      }
+
+      for (auto it = this->_pointer_sets.begin(),
+                et = this->_pointer_sets.end();
+           it != et;
+           ++it) {
+        if (!reachable.contains(it->first)) {
+          continue;
+        }
+        const PointsToSetT& addrs = it->second.points_to();
+        if (addrs.is_top()) {
+          return collected;
+        }
+        for (MemoryLocationRef addr : addrs) {
+          if (!reachable.contains(addr)) {
+            reachable.add(addr);
+            worklist.push_back(addr);
+          }
+        }
+      }
+    } while (!worklist.empty());
+
+    for (MemoryLocationRef addr : known) {
+      if (!reachable.contains(addr)) {
+        this->forget_mem(addr);
+        this->_lifetime.forget(addr);
+        collected.push_back(addr);
+      }
+    }
+
+    return collected;
+  }
+
   void forget_reachable_mem(VariableRef p, const MachineInt& size) override {
     if (this->is_bottom()) {
       return;
@@ -1461,6 +2514,48 @@ public:
     }
   }
 
+  /// \brief Return the number of cells, including summary cells
+  ///
+  /// This is a measure of the size of the abstract value.
+  std::size_t num_cells() const {
+    if (this->is_bottom()) {
+      return 0;
+    }
+
+    std::size_t n = 0;
+    for (auto it = this->_cells.begin(), et = this->_cells.end(); it != et;
+         ++it) {
+      n += it->second.size();
+    }
+    for (auto it = this->_summaries.begin(), et = this->_summaries.end();
+         it != et;
+         ++it) {
+      n += it->second.cells.size();
+    }
+    return n;
+  }
+
+  std::size_t size_in_bytes() const override {
+    std::size_t size = this->_cells.size_in_bytes() +
+                       this->_pointer_sets.size_in_bytes() +
+                       this->_pointer.size_in_bytes() +
+                       this->_uninitialized.size_in_bytes() +
+                       this->_lifetime.size_in_bytes() +
+                       this->_summaries.size_in_bytes();
+
+    // The separate domain does not count the trees of the cell sets
+    for (auto it = this->_cells.begin(), et = this->_cells.end(); it != et;
+         ++it) {
+      size += it->second.size_in_bytes();
+    }
+    for (auto it = this->_summaries.begin(), et = this->_summaries.end();
+         it != et;
+         ++it) {
+      size += it->second.cells.capacity() * sizeof(VariableRef);
+    }
+    return size;
+  }
+
   void normalize() const override {
     // is_bottom() will normalize
     if (this->_cells.is_bottom() || this->_pointer_sets.is_bottom() ||
@@ -1478,6 +2573,22 @@ public:
     } else {
       o << "(";
       this->_cells.dump(o);
+      for (auto it = this->_summaries.begin(), et = this->_summaries.end();
+           it != et;
+           ++it) {
+        o << ", ";
+        DumpableTraits< MemoryLocationRef >::dump(o, it->first);
+        o << " -> ";
+        for (auto c = it->second.cells.begin(); c != it->second.cells.end();
+             ++c) {
+          if (c != it->second.cells.begin()) {
+            o << " | ";
+          }
+          DumpableTraits< VariableRef >::dump(o, *c);
+        }
+        o << " on ";
+        it->second.range.dump(o);
+      }
       o << ", ";
       this->_pointer_sets.dump(o);
       o << ", ";
@@ -43,10 +43,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include <boost/optional.hpp>
 
+#include <ikos/core/adt/patricia_tree/map.hpp>
 #include <ikos/core/adt/patricia_tree/set.hpp>
 #include <ikos/core/domain/abstract_domain.hpp>
+#include <ikos/core/semantic/indexable.hpp>
+#include <ikos/core/semantic/memory/cell.hpp>
+#include <ikos/core/value/machine_int/interval.hpp>
 
 namespace ikos {
 namespace core {
@@ -60,10 +68,23 @@ namespace memory {
 /// The bottom value is represented as top.
 ///
 /// Note that this is not a lattice.
-template < typename VariableRef >
-class CellSet final : public core::AbstractDomain< CellSet< VariableRef > > {
+///
+/// Cells are also indexed by offset, so that looking for the cells overlapping
+/// a byte range does not require to go through the whole set.
+template < typename VariableRef, typename MemoryLocationRef >
+class CellSet final
+    : public core::AbstractDomain< CellSet< VariableRef, MemoryLocationRef > > {
 private:
   using PatriciaTreeSetT = PatriciaTreeSet< VariableRef >;
+  using CellVariableTrait =
+      CellVariableTraits< VariableRef, MemoryLocationRef >;
+  using Interval = machine_int::Interval;
+
+  /// \brief Map from offset buckets to the cells starting in the bucket
+  using OffsetIndexT = PatriciaTreeMap< Index, PatriciaTreeSetT >;
+
+  /// \brief Number of offset bits covered by a bucket (16 bytes)
+  static constexpr unsigned BucketBits = 4;
 
 public:
   using Iterator = typename PatriciaTreeSetT::Iterator;
@@ -71,6 +92,12 @@ public:
 private:
   PatriciaTreeSetT _set;
 
+  /// \brief Cells indexed by offset bucket
+  OffsetIndexT _index;
+
+  /// \brief Upper bound of the size of the cells, in bytes
+  Index _max_size = 0;
+
 private:
   struct EmptyTag {};
 
@@ -82,7 +109,44 @@ public:
   CellSet() : CellSet(EmptyTag{}) {}
 
   /// \brief Create the cell set with the given cells
-  CellSet(std::initializer_list< VariableRef > cells) : _set(cells) {}
+  CellSet(std::initializer_list< VariableRef > cells)
+      : CellSet(cells.begin(), cells.end()) {}
+
+  /// \brief Create the cell set with the cells of the range [first, last)
+  ///
+  /// The set and the offset index are built bottom-up, instead of inserting
+  /// the cells one by one.
+  template < typename InputIterator >
+  CellSet(InputIterator first, InputIterator last) : _set(first, last) {
+    // Cells of the set, in the order of the tree, grouped by bucket
+    std::vector< std::pair< Index, VariableRef > > cells;
+    for (VariableRef cell : this->_set) {
+      cells.emplace_back(cell_bucket(cell), cell);
+      this->_max_size = std::max(this->_max_size, cell_size(cell));
+    }
+    std::stable_sort(cells.begin(),
+                     cells.end(),
+                     [](const auto& a, const auto& b) {
+                       return patricia_tree_utils::tree_order_less(a.first,
+                                                                   b.first);
+                     });
+
+    std::vector< VariableRef > bucket_cells;
+    std::vector< std::pair< Index, PatriciaTreeSetT > > buckets;
+    for (auto it = cells.begin(), et = cells.end(); it != et;) {
+      Index bucket = it->first;
+      bucket_cells.clear();
+      for (; it != et && it->first == bucket; ++it) {
+        bucket_cells.push_back(it->second);
+      }
+      buckets.emplace_back(
+          bucket,
+          PatriciaTreeSetT::from_sorted_range(bucket_cells.begin(),
+                                              bucket_cells.end()));
+    }
+    this->_index = OffsetIndexT::from_sorted_range(buckets.begin(),
+                                                   buckets.end());
+  }
 
   /// \brief Copy constructor
   CellSet(const CellSet&) = default;
@@ -121,9 +185,9 @@ public:
   /// \brief Return true if the set is empty
   bool is_empty() const { return this->_set.empty(); }
 
-  void set_to_bottom() override { this->_set.clear(); }
+  void set_to_bottom() override { this->clear(); }
 
-  void set_to_top() override { this->_set.clear(); }
+  void set_to_top() override { this->clear(); }
 
   bool leq(const CellSet& other) const override {
     if (other.is_top()) {
@@ -148,21 +212,30 @@ public:
   void join_with(const CellSet& other) override {
     // only keep cells present on both sides
     this->_set.intersect_with(other._set);
+    this->_index.intersect_with(
+        other._index,
+        [](const PatriciaTreeSetT& left, const PatriciaTreeSetT& right)
+            -> boost::optional< PatriciaTreeSetT > {
+          PatriciaTreeSetT cells = left.intersect(right);
+          if (cells.empty()) {
+            return boost::none;
+          }
+          return cells;
+        });
+    this->_max_size = std::max(this->_max_size, other._max_size);
   }
 
   void widen_with(const CellSet& other) override { this->join_with(other); }
 
   void meet_with(const CellSet& other) override {
     // keep all the cells
-    this->_set.join_with(other._set);
+    this->add(other);
   }
 
   void narrow_with(const CellSet& other) override { this->meet_with(other); }
 
   /// \brief Perform the set difference
-  void difference_with(const CellSet& other) {
-    this->_set.difference_with(other._set);
-  }
+  void difference_with(const CellSet& other) { this->remove(other); }
 
   /// \brief Perform the set difference
   CellSet difference(const CellSet& other) const {
@@ -172,10 +245,66 @@ public:
   }
 
   /// \brief Add a cell in the set
-  void add(VariableRef cell) { this->_set.insert(cell); }
+  void add(VariableRef cell) {
+    this->_set.insert(cell);
+    this->_index.update_or_insert(
+        [](const PatriciaTreeSetT& cells, const PatriciaTreeSetT& new_cells)
+            -> boost::optional< PatriciaTreeSetT > {
+          return cells.join(new_cells);
+        },
+        cell_bucket(cell),
+        PatriciaTreeSetT{cell});
+    this->_max_size = std::max(this->_max_size, cell_size(cell));
+  }
 
   /// \brief Remove a cell from the set
-  void remove(VariableRef cell) { this->_set.erase(cell); }
+  void remove(VariableRef cell) {
+    this->_set.erase(cell);
+    this->_index.update_or_ignore(
+        [cell](const PatriciaTreeSetT& cells, const PatriciaTreeSetT&)
+            -> boost::optional< PatriciaTreeSetT > {
+          PatriciaTreeSetT new_cells = cells;
+          new_cells.erase(cell);
+          if (new_cells.empty()) {
+            return boost::none;
+          }
+          return new_cells;
+        },
+        cell_bucket(cell),
+        PatriciaTreeSetT{});
+  }
+
+  /// \brief Add all the cells of the given cell set
+  ///
+  /// This merges the underlying patricia trees, instead of inserting the cells
+  /// one by one.
+  void add(const CellSet& cells) {
+    this->_set.join_with(cells._set);
+    this->_index.join_with(
+        cells._index,
+        [](const PatriciaTreeSetT& left, const PatriciaTreeSetT& right)
+            -> boost::optional< PatriciaTreeSetT > {
+          return left.join(right);
+        });
+    this->_max_size = std::max(this->_max_size, cells._max_size);
+  }
+
+  /// \brief Remove all the cells of the given cell set
+  ///
+  /// Only the offset buckets of the given cell set are visited.
+  void remove(const CellSet& cells) {
+    this->_set.difference_with(cells._set);
+    this->_index.difference_with(
+        cells._index,
+        [](const PatriciaTreeSetT& left, const PatriciaTreeSetT& right)
+            -> boost::optional< PatriciaTreeSetT > {
+          PatriciaTreeSetT new_cells = left.difference(right);
+          if (new_cells.empty()) {
+            return boost::none;
+          }
+          return new_cells;
+        });
+  }
 
   /// \brief If the cell set is a singleton {c}, return c, otherwise return
   /// boost::none
@@ -192,6 +321,53 @@ public:
     return this->is_top() || this->_set.contains(cell);
   }
 
+  /// \brief Return the cells overlapping with the given byte range
+  ///
+  /// Only the offset buckets that can contain such cells are visited, unless
+  /// the range spans more buckets than the set holds.
+  std::vector< VariableRef > overlapping(const Interval& range) const {
+    std::vector< VariableRef > cells;
+    if (this->_set.empty() || range.is_bottom()) {
+      return cells;
+    }
+
+    Index lb = range.lb().template to< Index >();
+    Index ub = range.ub().template to< Index >();
+
+    // A cell starting before `lb - max_size + 1` cannot reach `lb`
+    Index first = (lb >= this->_max_size ? lb - this->_max_size + 1 : 0) >>
+                  BucketBits;
+    Index last = ub >> BucketBits;
+
+    if (last - first >= this->_index.size()) {
+      for (VariableRef cell : this->_set) {
+        if (cell_overlap(cell, range)) {
+          cells.push_back(cell);
+        }
+      }
+    } else {
+      for (Index b = first;; b++) {
+        if (auto bucket_cells = this->_index.at(b)) {
+          for (VariableRef cell : *bucket_cells) {
+            if (cell_overlap(cell, range)) {
+              cells.push_back(cell);
+            }
+          }
+        }
+        if (b == last) {
+          break;
+        }
+      }
+    }
+
+    return cells;
+  }
+
+  std::size_t size_in_bytes() const override {
+    return sizeof(CellSet) + this->_set.size_in_bytes() +
+           this->_index.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     if (this->is_top()) {
       o << "⊤";
@@ -202,6 +378,33 @@ public:
 
   static std::string name() { return "cell set domain"; }
 
+private:
+  /// \brief Remove all the cells
+  void clear() {
+    this->_set.clear();
+    this->_index.clear();
+    this->_max_size = 0;
+  }
+
+  /// \brief Return the offset bucket of the given cell
+  static Index cell_bucket(VariableRef cell) {
+    return CellVariableTrait::offset(cell).template to< Index >() >>
+           BucketBits;
+  }
+
+  /// \brief Return the size of the given cell, in bytes
+  static Index cell_size(VariableRef cell) {
+    return CellVariableTrait::size(cell).template to< Index >();
+  }
+
+  /// \brief Return true if the given cell overlaps with the given byte range
+  static bool cell_overlap(VariableRef cell, const Interval& range) {
+    const MachineInt& offset = CellVariableTrait::offset(cell);
+    const MachineInt& size = CellVariableTrait::size(cell);
+    MachineInt one(1, offset.bit_width(), Unsigned);
+    return !Interval(offset, offset + size - one).meet(range).is_bottom();
+  }
+
 }; // end class CellSet
 
 } // end namespace memory
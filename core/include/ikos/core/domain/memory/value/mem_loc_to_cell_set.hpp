@@ -53,7 +53,8 @@ namespace memory {
 /// \brief Map from memory locations to set of synthetic cells
 template < typename MemoryLocationRef, typename VariableRef >
 using MemLocToCellSet =
-    SeparateDomain< MemoryLocationRef, CellSet< VariableRef > >;
+    SeparateDomain< MemoryLocationRef,
+                    CellSet< VariableRef, MemoryLocationRef > >;
 
 } // end namespace memory
 } // end namespace core
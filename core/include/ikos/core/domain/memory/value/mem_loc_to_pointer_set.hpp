@@ -364,6 +364,10 @@ public:
     this->_tree.erase(addr);
   }
 
+  std::size_t size_in_bytes() const override {
+    return sizeof(MemLocToPointerSet) + this->_tree.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     if (this->is_bottom()) {
       o << "⊥";
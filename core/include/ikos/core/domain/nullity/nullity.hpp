@@ -220,6 +220,10 @@ public:
 
   Nullity get(VariableRef x) const override { return this->_inv.get(x); }
 
+  std::size_t size_in_bytes() const override {
+    return this->_inv.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override { return this->_inv.dump(o); }
 
   static std::string name() { return "nullity domain"; }
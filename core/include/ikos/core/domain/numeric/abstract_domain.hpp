@@ -121,6 +121,35 @@ public:
   /// \brief Add a linear constraint system
   virtual void add(const LinearConstraintSystemT& csts) = 0;
 
+  /// \brief Add the constraint `x <= y + c`
+  ///
+  /// Equivalent to `add(x - y <= c)`, without building the linear constraint.
+  virtual void add_le(VariableRef x, VariableRef y, const Number& c) {
+    this->add(LinearExpressionT(x) - LinearExpressionT(y) <= c);
+  }
+
+  /// \brief Add the constraint `x == y + c`
+  ///
+  /// Equivalent to `add(x - y == c)`, without building the linear constraint.
+  virtual void add_eq(VariableRef x, VariableRef y, const Number& c) {
+    this->add(LinearExpressionT(x) - LinearExpressionT(y) == c);
+  }
+
+  /// \brief Add the constraint `x <= c`
+  virtual void add_le(VariableRef x, const Number& c) {
+    this->add(LinearExpressionT(x) <= c);
+  }
+
+  /// \brief Add the constraint `x >= c`
+  virtual void add_ge(VariableRef x, const Number& c) {
+    this->add(LinearExpressionT(x) >= c);
+  }
+
+  /// \brief Add the constraint `x == c`
+  virtual void add_eq(VariableRef x, const Number& c) {
+    this->add(LinearExpressionT(x) == c);
+  }
+
   /// \brief Set the interval value of a variable
   virtual void set(VariableRef x, const IntervalT& value) = 0;
 
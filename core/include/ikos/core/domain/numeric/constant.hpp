@@ -433,6 +433,10 @@ public:
     return csts;
   }
 
+  std::size_t size_in_bytes() const override {
+    return this->_inv.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override { this->_inv.dump(o); }
 
   static std::string name() { return "constant domain"; }
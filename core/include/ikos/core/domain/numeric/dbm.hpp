@@ -46,6 +46,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <boost/container/flat_map.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 
 #include <ikos/core/domain/numeric/abstract_domain.hpp>
@@ -96,8 +103,13 @@ private:
 
   class Matrix {
   private:
+    // Elements are stored row by row, with a row length of `_stride`. Rows
+    // and columns in [_num_vars, _stride) are reserved for new variables and
+    // only contain +oo, so adding a variable usually does not move any
+    // element.
     std::vector< BoundT > _matrix;
     MatrixIndex _num_vars = 0; // size of the matrix
+    MatrixIndex _stride = 0;   // allocated size of the matrix
 
   public:
     /// \brief Create an empty matrix
@@ -121,29 +133,36 @@ private:
     /// \brief Return the number of variables in the matrix
     MatrixIndex num_vars() const { return this->_num_vars; }
 
+    /// \brief Return the memory allocated for the matrix, in bytes
+    std::size_t size_in_bytes() const {
+      return this->_matrix.capacity() * sizeof(BoundT);
+    }
+
     /// \brief Return the element (i, j)
     const BoundT& operator()(MatrixIndex i, MatrixIndex j) const {
       ikos_assert_msg(i < this->_num_vars && j < this->_num_vars,
                       "ouf of bounds matrix access");
-      return this->_matrix[this->_num_vars * i + j];
+      return this->_matrix[this->_stride * i + j];
     }
 
     /// \brief Return the element (i, j)
     BoundT& operator()(MatrixIndex i, MatrixIndex j) {
       ikos_assert_msg(i < this->_num_vars && j < this->_num_vars,
                       "ouf of bounds matrix access");
-      return this->_matrix[this->_num_vars * i + j];
+      return this->_matrix[this->_stride * i + j];
     }
 
     /// \brief Clear the matrix
     void clear() {
       this->_num_vars = 0;
+      this->_stride = 0;
       this->_matrix.clear();
     }
 
     /// \brief Clear and resize the matrix
     void clear_resize(MatrixIndex num_vars) {
       this->_num_vars = num_vars;
+      this->_stride = num_vars;
       this->_matrix.clear();
       this->_matrix.resize(num_vars * num_vars, BoundT::plus_infinity());
     }
@@ -152,48 +171,191 @@ private:
     ///
     /// \returns the index of the new variable
     MatrixIndex add_variable() {
-      if (this->_num_vars == 0) {
-        this->_num_vars = 2;
-        this->_matrix.resize(this->_num_vars * this->_num_vars,
-                             BoundT::plus_infinity());
-      } else {
-        std::vector< BoundT > new_matrix((this->_num_vars + 1) *
-                                             (this->_num_vars + 1),
+      MatrixIndex num_vars = (this->_num_vars == 0) ? 2 : this->_num_vars + 1;
+
+      if (num_vars > this->_stride) {
+        // Grow geometrically, so that the cost of moving the elements is
+        // amortized over the next variables
+        MatrixIndex stride =
+            std::max(num_vars, this->_stride + this->_stride / 2);
+        std::vector< BoundT > new_matrix(std::size_t(stride) * stride,
                                          BoundT::plus_infinity());
 
         for (MatrixIndex i = 0; i < this->_num_vars; i++) {
           for (MatrixIndex j = 0; j < this->_num_vars; j++) {
-            new_matrix[(this->_num_vars + 1) * i + j] =
-                std::move(this->_matrix[this->_num_vars * i + j]);
+            new_matrix[stride * i + j] =
+                std::move(this->_matrix[this->_stride * i + j]);
           }
         }
 
         std::swap(this->_matrix, new_matrix);
-        this->_num_vars++;
+        this->_stride = stride;
       }
 
+      this->_num_vars = num_vars;
       return this->_num_vars - 1;
     }
 
+    /// \brief Compact the matrix, keeping only the given indexes
+    ///
+    /// `indexes[k]` is the current index of the variable that gets the new
+    /// index `k + 1`. The special variable 0 is kept at index 0.
+    void compact(const std::vector< MatrixIndex >& indexes) {
+      const auto num_vars = static_cast< MatrixIndex >(indexes.size() + 1);
+      std::vector< BoundT > new_matrix(std::size_t(num_vars) * num_vars,
+                                       BoundT::plus_infinity());
+
+      for (MatrixIndex i = 0; i < num_vars; i++) {
+        MatrixIndex old_i = (i == 0) ? 0 : indexes[i - 1];
+        for (MatrixIndex j = 0; j < num_vars; j++) {
+          MatrixIndex old_j = (j == 0) ? 0 : indexes[j - 1];
+          new_matrix[num_vars * i + j] =
+              std::move(this->_matrix[this->_stride * old_i + old_j]);
+        }
+      }
+
+      std::swap(this->_matrix, new_matrix);
+      this->_num_vars = num_vars;
+      this->_stride = num_vars;
+    }
+
     /// \brief Apply Floyd-Warshall algorithm to normalize the matrix
     void normalize() {
       const MatrixIndex n = this->_num_vars;
+      const MatrixIndex s = this->_stride;
 
       for (MatrixIndex i = 0; i < n; i++) {
-        this->_matrix[n * i + i] = BoundT(0);
+        this->_matrix[s * i + i] = BoundT(0);
+      }
+
+      if (this->normalize_int64(std::is_same< Number, ZNumber >{})) {
+        return;
       }
 
       for (MatrixIndex k = 0; k < n; k++) {
+        this->pivot(k);
+      }
+    }
+
+    /// \brief Apply Floyd-Warshall algorithm, only on the given pivots
+    ///
+    /// This normalizes the matrix if it was normalized before constraints
+    /// between the given pivots were added, in O(k * n^2).
+    void normalize(const std::vector< MatrixIndex >& pivots) {
+      const MatrixIndex n = this->_num_vars;
+      const MatrixIndex s = this->_stride;
+
+      for (MatrixIndex i = 0; i < n; i++) {
+        this->_matrix[s * i + i] = BoundT(0);
+      }
+
+      for (MatrixIndex k : pivots) {
+        this->pivot(k);
+      }
+    }
+
+  private:
+    /// \brief Tighten all constraints using paths through k
+    void pivot(MatrixIndex k) {
+      const MatrixIndex n = this->_num_vars;
+      const MatrixIndex s = this->_stride;
+
+      for (MatrixIndex i = 0; i < n; i++) {
+        if (this->_matrix[s * i + k].is_plus_infinity()) {
+          continue;
+        }
+        for (MatrixIndex j = 0; j < n; j++) {
+          this->_matrix[s * i + j] =
+              min(this->_matrix[s * i + j],
+                  this->_matrix[s * i + k] + this->_matrix[s * k + j]);
+        }
+      }
+    }
+
+    /// \brief Floyd-Warshall on machine integers, for non-integer numbers
+    bool normalize_int64(std::false_type) { return false; }
+
+    /// \brief Floyd-Warshall on machine integers
+    ///
+    /// The matrix is copied into a dense array of int64_t, where +oo is
+    /// represented by `Infinity`, and the closure runs with plain integer
+    /// arithmetic. The inner loop is a branch-free min-plus over contiguous
+    /// rows, which the compiler can vectorize.
+    ///
+    /// Finite entries are bounded by `n * max|M[i, j]|` as long as there is no
+    /// negative cycle, and the closure stops as soon as a negative cycle is
+    /// found, so no operation can overflow if all finite entries are smaller
+    /// than `FiniteLimit / (2 * n)`. Otherwise, returns false and the caller
+    /// falls back to the generic algorithm.
+    bool normalize_int64(std::true_type) {
+      const MatrixIndex n = this->_num_vars;
+      const int64_t Infinity = int64_t(1) << 62;
+      const int64_t FiniteLimit = int64_t(1) << 60;
+      const int64_t InfinityThreshold = int64_t(1) << 61;
+
+      if (n == 0) {
+        return true;
+      }
+
+      const ZNumber max_abs(FiniteLimit / (2 * int64_t(n)));
+      std::vector< int64_t > m(std::size_t(n) * n);
+      for (MatrixIndex i = 0; i < n; i++) {
+        for (MatrixIndex j = 0; j < n; j++) {
+          const BoundT& b = this->operator()(i, j);
+          const std::size_t p = std::size_t(n) * i + j;
+          if (b.is_plus_infinity()) {
+            m[p] = Infinity;
+          } else if (b.is_minus_infinity()) {
+            return false;
+          } else {
+            ZNumber v = *b.number();
+            if (v > max_abs || v < -max_abs) {
+              return false;
+            }
+            m[p] = v.to< int64_t >();
+          }
+        }
+      }
+
+      // Values never increase, hence they stay below `Infinity`. A sum with
+      // an infinite operand stays above `InfinityThreshold`.
+      for (MatrixIndex k = 0; k < n; k++) {
+        const int64_t* row_k = &m[std::size_t(n) * k];
         for (MatrixIndex i = 0; i < n; i++) {
+          int64_t* row_i = &m[std::size_t(n) * i];
+          const int64_t m_ik = row_i[k];
+          if (m_ik >= InfinityThreshold) {
+            continue;
+          }
           for (MatrixIndex j = 0; j < n; j++) {
-            this->_matrix[n * i + j] =
-                min(this->_matrix[n * i + j],
-                    this->_matrix[n * i + k] + this->_matrix[n * k + j]);
+            const int64_t s = m_ik + row_k[j];
+            row_i[j] = (s < row_i[j]) ? s : row_i[j];
+          }
+        }
+
+        bool negative_cycle = false;
+        for (MatrixIndex i = 0; i < n; i++) {
+          negative_cycle = negative_cycle || m[std::size_t(n) * i + i] < 0;
+        }
+        if (negative_cycle) {
+          break;
+        }
+      }
+
+      for (MatrixIndex i = 0; i < n; i++) {
+        for (MatrixIndex j = 0; j < n; j++) {
+          const int64_t v = m[std::size_t(n) * i + j];
+          if (v >= InfinityThreshold) {
+            this->operator()(i, j) = BoundT::plus_infinity();
+          } else {
+            this->operator()(i, j) = BoundT(Number(v));
           }
         }
       }
+      return true;
     }
 
+  public:
     /// \brief Return true if the matrix has a negative cycle
     bool has_negative_cycle() const {
       for (MatrixIndex i = 0; i < this->_num_vars; i++) {
@@ -251,6 +413,19 @@ private:
   Matrix _matrix;
   VarIndexMap _var_index_map;
 
+  /// \brief Indexes of forgotten variables, available for new variables
+  ///
+  /// The rows and columns of these indexes only contain +oo, and 0 on the
+  /// diagonal.
+  std::vector< MatrixIndex > _free_indexes;
+
+  /// \brief Pivots required to normalize the matrix
+  ///
+  /// If the matrix is not normalized and this is not empty, the matrix was
+  /// normalized before constraints between these indexes were added.
+  /// Otherwise, a full normalization is required.
+  std::vector< MatrixIndex > _pending_pivots;
+
 private:
   struct TopTag {};
   struct BottomTag {};
@@ -300,7 +475,13 @@ public:
     }
 
     // Floyd-Warshall algorithm
-    self->_matrix.normalize();
+    if (!this->_pending_pivots.empty() &&
+        4 * this->_pending_pivots.size() < this->_matrix.num_vars()) {
+      self->_matrix.normalize(this->_pending_pivots);
+    } else {
+      self->_matrix.normalize();
+    }
+    self->_pending_pivots.clear();
 
     // Check for negative cycle
     if (this->_matrix.has_negative_cycle()) {
@@ -332,6 +513,7 @@ public:
     this->_is_normalized = true;
     this->_matrix.clear();
     this->_var_index_map.clear();
+    this->_free_indexes.clear();
   }
 
   void set_to_top() override {
@@ -339,6 +521,7 @@ public:
     this->_is_normalized = true;
     this->_matrix.clear();
     this->_var_index_map.clear();
+    this->_free_indexes.clear();
   }
 
   bool leq(const DBM& other) const override {
@@ -679,37 +862,68 @@ private:
 
     auto it = this->_var_index_map.find(x);
     if (it == this->_var_index_map.end()) {
-      // look for an unused index in _matrix
-      std::vector< bool > is_used(this->_matrix.num_vars(), false);
-
-      is_used[0] = true;
-      for (const auto& p : this->_var_index_map) {
-        is_used[p.second] = true;
-      }
-
-      auto unused_index = std::find(is_used.begin(), is_used.end(), false);
-      if (unused_index == is_used.end()) {
-        // no unused index found, we resize the matrix
-        MatrixIndex i = this->_matrix.add_variable();
-        this->_var_index_map.emplace(x, i);
-        return i;
+      MatrixIndex i;
+      if (this->_free_indexes.empty()) {
+        // no unused index, add a variable to the matrix
+        i = this->_matrix.add_variable();
       } else {
-        MatrixIndex i = static_cast< MatrixIndex >(
-            std::distance(is_used.begin(), unused_index));
-        this->_var_index_map.emplace(x, i);
-        return i;
+        // reuse the index of a forgotten variable, in place
+        i = this->_free_indexes.back();
+        this->_free_indexes.pop_back();
       }
+      this->_var_index_map.emplace(x, i);
+      return i;
     } else {
       return it->second;
     }
   }
 
+  /// \brief Remove the unused indexes from the matrix
+  ///
+  /// This is called once enough variables have been forgotten, so that the
+  /// quadratic cost is amortized over the calls to forget().
+  void compact() {
+    std::vector< MatrixIndex > indexes;
+    indexes.reserve(this->_var_index_map.size());
+
+    for (auto& p : this->_var_index_map) {
+      indexes.push_back(p.second);
+      p.second = static_cast< MatrixIndex >(indexes.size());
+    }
+
+    this->_matrix.compact(indexes);
+    this->_free_indexes.clear();
+
+    // Pending pivots refer to the previous indexes
+    if (!this->_is_normalized) {
+      this->_pending_pivots.clear();
+    }
+  }
+
   /// \brief Add constraint v_i - v_j <= c
   void add_constraint(MatrixIndex i, MatrixIndex j, const BoundT& c) {
     const BoundT& w = this->_matrix(j, i);
     if (c < w) {
       this->_matrix(j, i) = c;
-      this->_is_normalized = false;
+
+      if (this->_is_normalized) {
+        this->_is_normalized = false;
+        this->_pending_pivots.clear();
+        this->add_pending_pivot(i);
+        this->add_pending_pivot(j);
+      } else if (!this->_pending_pivots.empty()) {
+        this->add_pending_pivot(i);
+        this->add_pending_pivot(j);
+      }
+    }
+  }
+
+  /// \brief Add a pivot for the incremental normalization
+  void add_pending_pivot(MatrixIndex i) {
+    if (std::find(this->_pending_pivots.begin(),
+                  this->_pending_pivots.end(),
+                  i) == this->_pending_pivots.end()) {
+      this->_pending_pivots.push_back(i);
     }
   }
 
@@ -736,7 +950,7 @@ private:
       }
     }
 
-    this->_is_normalized = false;
+    // Shifting a variable preserves the normalization
   }
 
   /// \brief Apply v_i = v_i + c
@@ -1101,6 +1315,65 @@ public:
     }
   }
 
+  void add_le(VariableRef x, VariableRef y, const Number& c) override {
+    // Does not require normalization
+
+    if (this->_is_bottom) {
+      return;
+    } else if (x == y) {
+      if (c < 0) {
+        this->set_to_bottom();
+      }
+      return;
+    }
+
+    this->add_constraint(this->var_index(x), this->var_index(y), c);
+  }
+
+  void add_eq(VariableRef x, VariableRef y, const Number& c) override {
+    // Does not require normalization
+
+    if (this->_is_bottom) {
+      return;
+    } else if (x == y) {
+      if (c != 0) {
+        this->set_to_bottom();
+      }
+      return;
+    }
+
+    MatrixIndex i = this->var_index(x);
+    MatrixIndex j = this->var_index(y);
+    this->add_constraint(i, j, c);
+    this->add_constraint(j, i, -c);
+  }
+
+  void add_le(VariableRef x, const Number& c) override {
+    if (this->_is_bottom) {
+      return;
+    }
+
+    this->add_constraint(this->var_index(x), 0, c);
+  }
+
+  void add_ge(VariableRef x, const Number& c) override {
+    if (this->_is_bottom) {
+      return;
+    }
+
+    this->add_constraint(0, this->var_index(x), -c);
+  }
+
+  void add_eq(VariableRef x, const Number& c) override {
+    if (this->_is_bottom) {
+      return;
+    }
+
+    MatrixIndex i = this->var_index(x);
+    this->add_constraint(i, 0, c);
+    this->add_constraint(0, i, -c);
+  }
+
   void add(const LinearConstraintSystemT& csts) override {
     if (this->_is_bottom) {
       return;
@@ -1236,6 +1509,7 @@ private:
   void forget(MatrixIndex k) {
     // Use informations about k to improve all constraints
     // Not necessary if already normalized
+    bool was_normalized = this->_is_normalized;
     if (!this->_is_normalized) {
       for (MatrixIndex i = 0; i < this->_matrix.num_vars(); i++) {
         const BoundT& w_i_k = this->_matrix(i, k);
@@ -1260,7 +1534,14 @@ private:
     }
     this->_matrix(k, k) = BoundT(0);
 
-    this->_is_normalized = false;
+    // Removing a variable from a normalized matrix keeps it normalized, and
+    // the pivot on k is a no-op if k is not a pending pivot.
+    if (!was_normalized &&
+        std::find(this->_pending_pivots.begin(),
+                  this->_pending_pivots.end(),
+                  k) != this->_pending_pivots.end()) {
+      this->_pending_pivots.clear();
+    }
   }
 
 public:
@@ -1272,7 +1553,15 @@ public:
     auto it = this->_var_index_map.find(x);
     if (it != this->_var_index_map.end()) {
       this->forget(it->second);
+      if (!this->_is_bottom) {
+        this->_free_indexes.push_back(it->second);
+      }
       this->_var_index_map.erase(it);
+
+      if (this->_free_indexes.size() >= 8 &&
+          2 * this->_free_indexes.size() >= this->_matrix.num_vars()) {
+        this->compact();
+      }
     }
   }
 
@@ -1376,6 +1665,13 @@ public:
     return csts;
   }
 
+  std::size_t size_in_bytes() const override {
+    return sizeof(DBM) + this->_matrix.size_in_bytes() +
+           this->_var_index_map.capacity() *
+               sizeof(typename VarIndexMap::value_type) +
+           this->_pending_pivots.capacity() * sizeof(MatrixIndex);
+  }
+
   void dump(std::ostream& o) const override {
     this->to_linear_constraint_system().dump(o);
   }
@@ -120,8 +120,12 @@ public:
 
   /// \brief Normalize the abstract value
   void normalize() const override {
-    this->_product.first().normalize();
-    this->_product.second().normalize();
+    if (this->_product.first_changed()) {
+      this->_product.first().normalize();
+    }
+    if (this->_product.second_changed()) {
+      this->_product.second().normalize();
+    }
     this->_product.normalize();
   }
 
@@ -366,6 +370,10 @@ public:
 
   /// @}
 
+  std::size_t size_in_bytes() const override {
+    return this->_product.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override { this->_product.dump(o); }
 
   static std::string name() {
@@ -644,6 +652,10 @@ public:
 
   /// @}
 
+  std::size_t size_in_bytes() const override {
+    return this->_product.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     if (this->is_bottom()) {
       o << "⊥";
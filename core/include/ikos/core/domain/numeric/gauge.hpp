@@ -77,13 +77,22 @@ public:
 
 private:
   using PatriciaTreeMapT = PatriciaTreeMap< VariableRef, GaugeT >;
+  using IncrementMapT = PatriciaTreeMap< VariableRef, Number >;
 
 private:
   PatriciaTreeMapT _tree;
+
+  // Pending counter increments, not yet applied on the gauges of `_tree`
+  //
+  // This makes incr_counter() cheap. The increments are applied lazily, before
+  // any other operation on the gauges (e.g, at joins).
+  IncrementMapT _increments;
+
   bool _is_bottom;
 
   /* Invariants:
-   * _is_bottom => _tree.empty()
+   * _is_bottom => _tree.empty() && _increments.empty()
+   * _tree.empty() => _increments.empty()
    * for v in _tree: _tree.at(v) != GaugeT::top()
    * for v in _tree: _tree.at(v) != GaugeT::bottom()
    */
@@ -133,19 +142,49 @@ public:
   void set_to_bottom() override {
     this->_is_bottom = true;
     this->_tree.clear();
+    this->_increments.clear();
   }
 
   void set_to_top() override {
     this->_is_bottom = false;
     this->_tree.clear();
+    this->_increments.clear();
+  }
+
+private:
+  /// \brief Apply the pending counter increments on the gauges
+  void apply_increments() const {
+    if (this->_increments.empty()) {
+      return;
+    }
+
+    auto self = const_cast< GaugeSemiLattice* >(this);
+    for (auto it = this->_increments.begin(), et = this->_increments.end();
+         it != et;
+         ++it) {
+      VariableRef v = it->first;
+      const Number& k = it->second;
+      self->_tree.transform([v, &k](VariableRef, const GaugeT& x) {
+        GaugeT y = x.incr_counter(v, k);
+        if (y.is_top()) {
+          return boost::optional< GaugeT >(boost::none);
+        } else {
+          return boost::optional< GaugeT >(y);
+        }
+      });
+    }
+    self->_increments.clear();
   }
 
+public:
   bool leq(const GaugeSemiLattice& other) const override {
     if (this->is_bottom()) {
       return true;
     } else if (other.is_bottom()) {
       return false;
     } else {
+      this->apply_increments();
+      other.apply_increments();
       return this->_tree.leq(other._tree, [](const GaugeT& x, const GaugeT& y) {
         return x.leq(y);
       });
@@ -158,6 +197,8 @@ public:
     } else if (other.is_bottom()) {
       return false;
     } else {
+      this->apply_increments();
+      other.apply_increments();
       return this->_tree.equals(other._tree,
                                 [](const GaugeT& x, const GaugeT& y) {
                                   return x.equals(y);
@@ -171,6 +212,8 @@ public:
     } else if (this->is_bottom()) {
       this->operator=(other);
     } else {
+      this->apply_increments();
+      other.apply_increments();
       this->_tree.intersect_with(other._tree,
                                  [](const GaugeT& x, const GaugeT& y) {
                                    GaugeT z = x.join(y);
@@ -189,6 +232,8 @@ public:
     } else if (other.is_bottom()) {
       this->set_to_bottom();
     } else {
+      this->apply_increments();
+      other.apply_increments();
       try {
         this->_tree.join_with(other._tree,
                               [](const GaugeT& x, const GaugeT& y) {
@@ -211,6 +256,8 @@ public:
     } else if (this->is_bottom()) {
       this->operator=(other);
     } else {
+      this->apply_increments();
+      other.apply_increments();
       this->_tree.intersect_with(other._tree,
                                  [](const GaugeT& x, const GaugeT& y) {
                                    GaugeT z = x.widening_interval(y);
@@ -231,6 +278,8 @@ public:
     } else if (this->is_bottom()) {
       this->operator=(other);
     } else {
+      this->apply_increments();
+      other.apply_increments();
       this->_tree.intersect_with(other._tree,
                                  [threshold](const GaugeT& x, const GaugeT& y) {
                                    GaugeT z =
@@ -255,6 +304,8 @@ public:
     } else if (this->is_bottom()) {
       this->operator=(other);
     } else {
+      this->apply_increments();
+      other.apply_increments();
       this->_tree.intersect_with(other._tree,
                                  [k, u, v](const GaugeT& x, const GaugeT& y) {
                                    GaugeT z = x.widening_interpol(y, k, u, v);
@@ -277,6 +328,8 @@ public:
     } else if (other.is_bottom()) {
       this->set_to_bottom();
     } else {
+      this->apply_increments();
+      other.apply_increments();
       try {
         this->_tree.join_with(other._tree,
                               [](const GaugeT& x, const GaugeT& y) {
@@ -294,18 +347,16 @@ public:
 
   /// \brief Increment counter `v` by `k`
   void incr_counter(VariableRef v, const Number& k) {
-    if (this->is_bottom()) {
+    if (this->is_bottom() || this->_tree.empty()) {
       return;
     }
 
-    this->_tree.transform([v, k](VariableRef, const GaugeT& x) {
-      GaugeT y = x.incr_counter(v, k);
-      if (y.is_top()) {
-        return boost::optional< GaugeT >(boost::none);
-      } else {
-        return boost::optional< GaugeT >(y);
-      }
-    });
+    boost::optional< const Number& > pending = this->_increments.at(v);
+    if (pending) {
+      this->_increments.insert_or_assign(v, *pending + k);
+    } else {
+      this->_increments.insert_or_assign(v, k);
+    }
   }
 
   /// \brief Forget counter `v`
@@ -320,6 +371,8 @@ public:
     ikos_assert(!value.is_bottom());
     ikos_assert(value.lb().is_finite());
 
+    this->apply_increments();
+
     Number l = *value.lb().number();
     const BoundT& u = value.ub();
     this->_tree.transform([v, l, u](VariableRef, const GaugeT& x) {
@@ -338,6 +391,9 @@ public:
       return;
     }
     this->_tree.erase(v);
+    if (this->_tree.empty()) {
+      this->_increments.clear();
+    }
   }
 
   /// \brief Set the gauge for the given variable
@@ -348,7 +404,11 @@ public:
       this->set_to_bottom();
     } else if (g.is_top()) {
       this->_tree.erase(v);
+      if (this->_tree.empty()) {
+        this->_increments.clear();
+      }
     } else {
+      this->apply_increments();
       this->_tree.insert_or_assign(v, g);
     }
   }
@@ -362,6 +422,7 @@ public:
     } else if (g.is_top()) {
       return;
     } else {
+      this->apply_increments();
       try {
         this->_tree.update_or_insert(
             [](const GaugeT& x, const GaugeT& y) {
@@ -385,11 +446,18 @@ public:
       return GaugeT::bottom();
     } else {
       boost::optional< const GaugeT& > g = this->_tree.at(v);
-      if (g) {
-        return *g;
-      } else {
+      if (!g) {
         return GaugeT::top();
       }
+
+      // Only apply the pending increments on the requested gauge
+      GaugeT r = *g;
+      for (auto it = this->_increments.begin(), et = this->_increments.end();
+           it != et;
+           ++it) {
+        r = r.incr_counter(it->first, it->second);
+      }
+      return r;
     }
   }
 
@@ -398,6 +466,8 @@ public:
       return LinearConstraintSystemT(LinearConstraintT::contradiction());
     }
 
+    this->apply_increments();
+
     LinearConstraintSystemT csts;
     for (auto it = this->_tree.begin(); it != this->_tree.end(); ++it) {
       const GaugeBoundT& lb = it->second.lb();
@@ -413,10 +483,16 @@ public:
     return csts;
   }
 
+  std::size_t size_in_bytes() const override {
+    return sizeof(GaugeSemiLattice) + this->_tree.size_in_bytes() +
+           this->_increments.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     if (this->is_bottom()) {
       o << "⊥";
     } else {
+      this->apply_increments();
       this->_tree.dump(o);
     }
   }
@@ -600,8 +676,8 @@ public:
         this->_counters.intersect_with(other._counters);
         this->_intervals.join_with(other._intervals);
       } else {
-        GaugeSemiLatticeT gauges = this->_gauges;
-
+        // Update the gauges in place, `this->_sections` is only replaced once
+        // all the counters are processed
         for (auto it = this->_sections.begin(), et = this->_sections.end();
              it != et;
              ++it) {
@@ -610,12 +686,14 @@ public:
           ConstantT v = other._sections.to_constant(k);
           if (u != v) {
             ikos_assert(u.is_number());
-            gauges.widen_interpol_with(other._gauges, k, *u.number(), v);
+            this->_gauges.widen_interpol_with(other._gauges,
+                                              k,
+                                              *u.number(),
+                                              v);
           }
         }
 
-        this->_sections = sections;
-        this->_gauges = gauges;
+        this->_sections = std::move(sections);
         this->_counters.intersect_with(other._counters);
         this->_intervals.join_with(other._intervals);
       }
@@ -643,8 +721,8 @@ public:
         this->_counters.intersect_with(other._counters);
         this->_intervals.widen_with(other._intervals);
       } else {
-        GaugeSemiLatticeT gauges = this->_gauges;
-
+        // Update the gauges in place, `this->_sections` is only replaced once
+        // all the counters are processed
         for (auto it = this->_sections.begin(), et = this->_sections.end();
              it != et;
              ++it) {
@@ -653,12 +731,14 @@ public:
           ConstantT v = other._sections.to_constant(k);
           if (u != v) {
             ikos_assert(u.is_number());
-            gauges.widen_interpol_with(other._gauges, k, *u.number(), v);
+            this->_gauges.widen_interpol_with(other._gauges,
+                                              k,
+                                              *u.number(),
+                                              v);
           }
         }
 
-        this->_sections = sections;
-        this->_gauges = gauges;
+        this->_sections = std::move(sections);
         this->_counters.intersect_with(other._counters);
         this->_intervals.widen_with(other._intervals);
       }
@@ -683,8 +763,8 @@ public:
         this->_counters.intersect_with(other._counters);
         this->_intervals.widen_threshold_with(other._intervals, threshold);
       } else {
-        GaugeSemiLatticeT gauges = this->_gauges;
-
+        // Update the gauges in place, `this->_sections` is only replaced once
+        // all the counters are processed
         for (auto it = this->_sections.begin(), et = this->_sections.end();
              it != et;
              ++it) {
@@ -693,12 +773,14 @@ public:
           ConstantT v = other._sections.to_constant(k);
           if (u != v) {
             ikos_assert(u.is_number());
-            gauges.widen_interpol_with(other._gauges, k, *u.number(), v);
+            this->_gauges.widen_interpol_with(other._gauges,
+                                              k,
+                                              *u.number(),
+                                              v);
           }
         }
 
-        this->_sections = sections;
-        this->_gauges = gauges;
+        this->_sections = std::move(sections);
         this->_counters.intersect_with(other._counters);
         this->_intervals.widen_threshold_with(other._intervals, threshold);
       }
@@ -1258,6 +1340,11 @@ public:
 
   /// @}
 
+  std::size_t size_in_bytes() const override {
+    return this->_sections.size_in_bytes() + this->_gauges.size_in_bytes() +
+           this->_counters.size_in_bytes() + this->_intervals.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     if (this->is_bottom()) {
       o << "⊥";
@@ -43,6 +43,7 @@
 
 #pragma once
 
+#include <ikos/core/adt/patricia_tree/set.hpp>
 #include <ikos/core/domain/numeric/abstract_domain.hpp>
 #include <ikos/core/domain/numeric/congruence.hpp>
 #include <ikos/core/domain/numeric/domain_product.hpp>
@@ -86,9 +87,17 @@ private:
                                                  IntervalDomainT,
                                                  CongruenceDomainT >;
 
+  using VariableSetT = PatriciaTreeSet< VariableRef >;
+
 private:
   DomainProduct _product;
 
+  /// \brief Variables written since their last reduction
+  ///
+  /// The reduction of a variable is deferred until it is read, or until the
+  /// whole abstract value is queried (see `normalize()`).
+  VariableSetT _pending;
+
 private:
   /// \brief Private constructor
   explicit GaugeIntervalCongruenceDomain(DomainProduct product)
@@ -96,7 +105,7 @@ private:
 
   /// \brief Reduce the information on variable `v`
   void reduce_variable(VariableRef v) {
-    if (this->is_bottom()) {
+    if (this->_product.is_bottom()) {
       return;
     }
 
@@ -117,6 +126,36 @@ private:
     }
   }
 
+  /// \brief Defer the reduction of variable `v`
+  void mark_pending(VariableRef v) { this->_pending.insert(v); }
+
+  /// \brief Drop the pending reduction of variable `v`, about to be overwritten
+  ///
+  /// This is sound: a reduction only refines the value of `v`.
+  void drop_pending(VariableRef v) { this->_pending.erase(v); }
+
+  /// \brief Perform the pending reduction of variable `v`, about to be read
+  void reduce_pending(VariableRef v) {
+    if (this->_pending.contains(v)) {
+      this->_pending.erase(v);
+      this->reduce_variable(v);
+    }
+  }
+
+  /// \brief Perform the pending reductions of the variables in `e`
+  void reduce_pending(const LinearExpressionT& e) {
+    for (const auto& term : e) {
+      this->reduce_pending(term.first);
+    }
+  }
+
+  /// \brief Perform the pending reductions of the variables in `cst`
+  void reduce_pending(const LinearConstraintT& cst) {
+    for (const auto& term : cst) {
+      this->reduce_pending(term.first);
+    }
+  }
+
 public:
   /// \brief Create the top abstract value
   GaugeIntervalCongruenceDomain() = default;
@@ -178,105 +217,150 @@ public:
   /// Note: does not normalize.
   CongruenceDomainT& third() { return this->_product.third(); }
 
-  bool is_bottom() const override { return this->_product.is_bottom(); }
+  bool is_bottom() const override {
+    this->normalize();
+    return this->_product.is_bottom();
+  }
 
-  bool is_top() const override { return this->_product.is_top(); }
+  bool is_top() const override {
+    this->normalize();
+    return this->_product.is_top();
+  }
 
-  void set_to_bottom() override { this->_product.set_to_bottom(); }
+  void set_to_bottom() override {
+    this->_product.set_to_bottom();
+    this->_pending.clear();
+  }
 
-  void set_to_top() override { this->_product.set_to_top(); }
+  void set_to_top() override {
+    this->_product.set_to_top();
+    this->_pending.clear();
+  }
 
   bool leq(const GaugeIntervalCongruenceDomain& other) const override {
+    this->normalize();
+    other.normalize();
     return this->_product.leq(other._product);
   }
 
   bool equals(const GaugeIntervalCongruenceDomain& other) const override {
+    this->normalize();
+    other.normalize();
     return this->_product.equals(other._product);
   }
 
   void join_with(const GaugeIntervalCongruenceDomain& other) override {
+    this->normalize();
+    other.normalize();
     this->_product.join_with(other._product);
   }
 
   void join_loop_with(const GaugeIntervalCongruenceDomain& other) override {
+    this->normalize();
+    other.normalize();
     this->_product.join_loop_with(other._product);
   }
 
   void join_iter_with(const GaugeIntervalCongruenceDomain& other) override {
+    this->normalize();
+    other.normalize();
     this->_product.join_iter_with(other._product);
   }
 
   void widen_with(const GaugeIntervalCongruenceDomain& other) override {
+    this->normalize();
+    other.normalize();
     this->_product.widen_with(other._product);
   }
 
   void widen_threshold_with(const GaugeIntervalCongruenceDomain& other,
                             const Number& threshold) override {
+    this->normalize();
+    other.normalize();
     this->_product.widen_threshold_with(other._product, threshold);
   }
 
   void meet_with(const GaugeIntervalCongruenceDomain& other) override {
+    this->normalize();
+    other.normalize();
     this->_product.meet_with(other._product);
   }
 
   void narrow_with(const GaugeIntervalCongruenceDomain& other) override {
+    this->normalize();
+    other.normalize();
     this->_product.narrow_with(other._product);
   }
 
-  void assign(VariableRef x, int n) override { this->_product.assign(x, n); }
+  void assign(VariableRef x, int n) override {
+    this->drop_pending(x);
+    this->_product.assign(x, n);
+  }
 
   void assign(VariableRef x, const Number& n) override {
+    this->drop_pending(x);
     this->_product.assign(x, n);
   }
 
   void assign(VariableRef x, VariableRef y) override {
+    this->reduce_pending(y);
     this->_product.assign(x, y);
-    this->reduce_variable(x);
+    this->mark_pending(x);
   }
 
   void assign(VariableRef x, const LinearExpressionT& e) override {
+    this->reduce_pending(e);
     this->_product.assign(x, e);
-    this->reduce_variable(x);
+    this->mark_pending(x);
   }
 
   void apply(BinaryOperator op,
              VariableRef x,
              VariableRef y,
              VariableRef z) override {
+    this->reduce_pending(y);
+    this->reduce_pending(z);
     this->_product.apply(op, x, y, z);
-    this->reduce_variable(x);
+    this->mark_pending(x);
   }
 
   void apply(BinaryOperator op,
              VariableRef x,
              VariableRef y,
              const Number& z) override {
+    this->reduce_pending(y);
     this->_product.apply(op, x, y, z);
-    this->reduce_variable(x);
+    this->mark_pending(x);
   }
 
   void apply(BinaryOperator op,
              VariableRef x,
              const Number& y,
              VariableRef z) override {
+    this->reduce_pending(z);
     this->_product.apply(op, x, y, z);
-    this->reduce_variable(x);
+    this->mark_pending(x);
   }
 
   void add(const LinearConstraintT& cst) override {
+    this->reduce_pending(cst);
     this->_product.add(cst);
 
     for (const auto& term : cst) {
-      this->reduce_variable(term.first);
+      this->mark_pending(term.first);
     }
   }
 
   void add(const LinearConstraintSystemT& csts) override {
+    for (const LinearConstraintT& cst : csts) {
+      this->reduce_pending(cst);
+    }
+
     this->_product.add(csts);
 
     for (const LinearConstraintT& cst : csts) {
       for (const auto& term : cst) {
-        this->reduce_variable(term.first);
+        this->mark_pending(term.first);
       }
     }
   }
@@ -290,11 +374,12 @@ public:
   }
 
   void set(VariableRef x, const IntervalCongruenceT& value) override {
-    if (this->is_bottom()) {
+    if (this->_product.is_bottom()) {
       return;
     } else if (value.is_bottom()) {
       this->set_to_bottom();
     } else {
+      this->drop_pending(x);
       this->_product.first().set(x, value.interval());
       this->_product.second().set(x, value.interval());
       this->_product.third().set(x, value.congruence());
@@ -310,26 +395,42 @@ public:
   }
 
   void refine(VariableRef x, const IntervalCongruenceT& value) override {
-    if (this->is_bottom()) {
+    if (this->_product.is_bottom()) {
       return;
     } else if (value.is_bottom()) {
       this->set_to_bottom();
     } else {
       this->_product.second().refine(x, value.interval());
       this->_product.third().refine(x, value.congruence());
-      this->reduce_variable(x);
+      this->mark_pending(x);
     }
   }
 
-  void forget(VariableRef x) override { this->_product.forget(x); }
+  void forget(VariableRef x) override {
+    this->drop_pending(x);
+    this->_product.forget(x);
+  }
 
-  void normalize() const override { this->_product.normalize(); }
+  /// \brief Perform all the pending reductions
+  void normalize() const override {
+    if (!this->_pending.empty()) {
+      auto self = const_cast< GaugeIntervalCongruenceDomain* >(this);
+      VariableSetT pending = std::move(self->_pending);
+      self->_pending.clear();
+      for (VariableRef v : pending) {
+        self->reduce_variable(v);
+      }
+    }
+    this->_product.normalize();
+  }
 
   GaugeT to_gauge(VariableRef x) const {
+    this->normalize();
     return this->_product.first().to_gauge(x);
   }
 
   GaugeT to_gauge(const LinearExpressionT& e) const {
+    this->normalize();
     return this->_product.first().to_gauge(e);
   }
 
@@ -373,33 +474,48 @@ public:
   }
 
   LinearConstraintSystemT to_linear_constraint_system() const override {
+    this->normalize();
     return this->_product.to_linear_constraint_system();
   }
 
   /// \name Non-negative loop counter abstract domain methods
   /// @{
 
-  void mark_counter(VariableRef x) override { this->_product.mark_counter(x); }
+  void mark_counter(VariableRef x) override {
+    this->normalize();
+    this->_product.mark_counter(x);
+  }
 
   void unmark_counter(VariableRef x) override {
+    this->normalize();
     this->_product.unmark_counter(x);
   }
 
   void init_counter(VariableRef x, const Number& c) override {
+    this->normalize();
     this->_product.init_counter(x, c);
   }
 
   void incr_counter(VariableRef x, const Number& k) override {
+    this->normalize();
     this->_product.incr_counter(x, k);
   }
 
   void forget_counter(VariableRef x) override {
+    this->normalize();
     this->_product.forget_counter(x);
   }
 
   /// @}
 
-  void dump(std::ostream& o) const override { this->_product.dump(o); }
+  std::size_t size_in_bytes() const override {
+    return this->_product.size_in_bytes() + this->_pending.size_in_bytes();
+  }
+
+  void dump(std::ostream& o) const override {
+    this->normalize();
+    this->_product.dump(o);
+  }
 
   static std::string name() { return "gauge + interval + congruence domain"; }
 
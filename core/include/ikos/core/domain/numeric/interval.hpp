@@ -77,6 +77,7 @@ public:
   using LinearConstraintSystemT = LinearConstraintSystem< Number, VariableRef >;
 
 private:
+  using BoundT = Bound< Number >;
   using SeparateDomainT = SeparateDomain< Number, VariableRef, IntervalT >;
   using LinearIntervalSolverT =
       LinearIntervalSolver< Number, VariableRef, IntervalDomain >;
@@ -225,6 +226,54 @@ public:
     solver.run(*this);
   }
 
+  void add_le(VariableRef x, VariableRef y, const Number& c) override {
+    if (this->is_bottom()) {
+      return;
+    } else if (x == y) {
+      if (c < 0) {
+        this->set_to_bottom();
+      }
+      return;
+    }
+
+    IntervalT x_value = this->_inv.get(x);
+    IntervalT y_value = this->_inv.get(y);
+    this->_inv.refine(x,
+                      IntervalT(BoundT::minus_infinity(),
+                                y_value.ub() + BoundT(c)));
+    this->_inv.refine(y,
+                      IntervalT(x_value.lb() - BoundT(c),
+                                BoundT::plus_infinity()));
+  }
+
+  void add_eq(VariableRef x, VariableRef y, const Number& c) override {
+    if (this->is_bottom()) {
+      return;
+    } else if (x == y) {
+      if (c != 0) {
+        this->set_to_bottom();
+      }
+      return;
+    }
+
+    IntervalT x_value = this->_inv.get(x);
+    IntervalT y_value = this->_inv.get(y);
+    this->_inv.refine(x, y_value + IntervalT(c));
+    this->_inv.refine(y, x_value - IntervalT(c));
+  }
+
+  void add_le(VariableRef x, const Number& c) override {
+    this->_inv.refine(x, IntervalT(BoundT::minus_infinity(), BoundT(c)));
+  }
+
+  void add_ge(VariableRef x, const Number& c) override {
+    this->_inv.refine(x, IntervalT(BoundT(c), BoundT::plus_infinity()));
+  }
+
+  void add_eq(VariableRef x, const Number& c) override {
+    this->_inv.refine(x, IntervalT(c));
+  }
+
   void set(VariableRef x, const IntervalT& value) override {
     this->_inv.set(x, value);
   }
@@ -326,6 +375,10 @@ public:
     return csts;
   }
 
+  std::size_t size_in_bytes() const override {
+    return this->_inv.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override { this->_inv.dump(o); }
 
   static std::string name() { return "interval domain"; }
@@ -53,13 +53,16 @@
 #pragma once
 
 #include <functional>
+#include <queue>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
-#include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
 
 #include <ikos/core/linear_constraint.hpp>
 #include <ikos/core/linear_expression.hpp>
+#include <ikos/core/semantic/indexable.hpp>
 #include <ikos/core/value/numeric/interval.hpp>
 
 namespace ikos {
@@ -95,6 +98,14 @@ private:
   /// \brief Cost of one propagation cycle for a dense 3x3 system of constraints
   static const std::size_t _large_system_op_threshold = 27;
 
+  /// \brief Minimum fraction of the remaining width that a refinement has to
+  /// remove for the constraints on the variable to be propagated again
+  ///
+  /// Slowly converging systems (e.g, `x <= y - 1 and y <= x - 1`) only shave
+  /// one unit per cycle, and would otherwise run until the operation budget
+  /// is exhausted.
+  static const std::size_t _convergence_ratio = 16;
+
 private:
   using BoundT = Bound< Number >;
   using IntervalT = Interval< Number >;
@@ -107,9 +118,21 @@ private:
 
 private:
   using ConstraintSet = std::vector< LinearConstraintRef >;
-  using TriggerTable = boost::container::flat_map< VariableRef, ConstraintSet >;
+
+  /// \brief Map from a variable index to the positions of the constraints
+  /// using it
+  using TriggerTable = std::unordered_map< Index, std::vector< std::size_t > >;
+
   using VariableSet = boost::container::flat_set< VariableRef >;
 
+  /// \brief Queue entry, ordered by number of terms, then by position
+  using QueueEntry = std::pair< std::size_t, std::size_t >;
+
+  /// \brief Refinement queue, smallest constraints first
+  using RefinementQueue = std::priority_queue< QueueEntry,
+                                               std::vector< QueueEntry >,
+                                               std::greater< QueueEntry > >;
+
 private:
   std::size_t _max_cycles;
   std::size_t _op_per_cycle = 0;
@@ -119,11 +142,33 @@ private:
   bool _is_large_system = false;
   ConstraintSet _csts;
   TriggerTable _trigger_table;
+  std::size_t _num_indexed_csts = 0;
   VariableSet _refined_variables;
 
 private:
   struct BottomFound {};
 
+  /// \brief Return true if the refinement from `old_i` to `new_i` is large
+  /// enough to be propagated
+  static bool is_significant(const IntervalT& old_i, const IntervalT& new_i) {
+    if (new_i.singleton()) {
+      return true;
+    }
+    if ((old_i.lb() != new_i.lb() && old_i.lb().is_infinite()) ||
+        (old_i.ub() != new_i.ub() && old_i.ub().is_infinite())) {
+      // A bound became finite
+      return true;
+    }
+
+    BoundT width = new_i.ub() - new_i.lb();
+    if (width.is_infinite()) {
+      return true;
+    }
+
+    BoundT shrink = (new_i.lb() - old_i.lb()) + (old_i.ub() - new_i.ub());
+    return shrink * BoundT(Number(_convergence_ratio)) >= width;
+  }
+
   /// \brief Refine the abstract value for the given variable v
   void refine(VariableRef v, const IntervalT& i, NumAbstractDomain& inv) {
     IntervalT old_i = inv.to_interval(v);
@@ -133,7 +178,9 @@ private:
     }
     if (old_i != new_i) {
       inv.refine(v, new_i);
-      this->_refined_variables.insert(v);
+      if (is_significant(old_i, new_i)) {
+        this->_refined_variables.insert(v);
+      }
       ++this->_op_count;
     }
   }
@@ -185,32 +232,53 @@ private:
     }
   }
 
+  /// \brief Index the constraints added since the last call
   void build_trigger_table() {
-    // Build the trigger table
-    for (LinearConstraintRef cst : this->_csts) {
-      for (const auto& term : cst.get()) {
-        this->_trigger_table[term.first].push_back(cst);
+    for (std::size_t n = this->_num_indexed_csts; n < this->_csts.size(); n++) {
+      for (const auto& term : this->_csts[n].get()) {
+        this->_trigger_table[IndexableTraits< VariableRef >::index(term.first)]
+            .push_back(n);
       }
     }
+    this->_num_indexed_csts = this->_csts.size();
   }
 
   /// \brief Slove a large linear constraint system
+  ///
+  /// Constraints are processed from a queue, smallest first, and are only
+  /// queued again when one of their variables was significantly refined.
   void solve_large_system(NumAbstractDomain& inv) {
     this->_op_count = 0;
     this->_refined_variables.clear();
-    for (const LinearConstraintT& cst : this->_csts) {
-      this->propagate(cst, inv);
+
+    RefinementQueue queue;
+    std::vector< bool > queued(this->_csts.size(), true);
+    for (std::size_t n = 0; n < this->_csts.size(); n++) {
+      queue.emplace(this->_csts[n].get().num_terms(), n);
     }
-    do {
-      VariableSet vars_to_process(this->_refined_variables);
-      this->_refined_variables.clear();
-      for (VariableRef var : vars_to_process) {
-        for (const LinearConstraintT& cst : this->_trigger_table[var]) {
-          this->propagate(cst, inv);
+
+    while (!queue.empty() && this->_op_count <= this->_max_op) {
+      std::size_t n = queue.top().second;
+      queue.pop();
+      queued[n] = false;
+
+      this->propagate(this->_csts[n].get(), inv);
+
+      for (VariableRef var : this->_refined_variables) {
+        auto it = this->_trigger_table.find(
+            IndexableTraits< VariableRef >::index(var));
+        if (it == this->_trigger_table.end()) {
+          continue;
+        }
+        for (std::size_t m : it->second) {
+          if (!queued[m]) {
+            queued[m] = true;
+            queue.emplace(this->_csts[m].get().num_terms(), m);
+          }
         }
       }
-    } while (!this->_refined_variables.empty() &&
-             this->_op_count <= this->_max_op);
+      this->_refined_variables.clear();
+    }
   }
 
   /// \brief Slove a small linear constraint system
@@ -101,14 +101,35 @@ private:
 private:
   class Matrix {
   private:
-    // Matrix represented as single vector for performance.
-    // Using a standard vector< vector<> > results in significant
-    // degradation of performance.
+    // Half-matrix representation, see "The Octagon Abstract Domain",
+    // Antoine Miné, HOSC 2006.
+    //
+    // By coherence, m[i, j] = m[bar(j), bar(i)], where bar(2k - 1) = 2k and
+    // bar(2k) = 2k - 1. Only the elements with (zero-based) j <= (i | 1) are
+    // stored, row by row. This layout does not depend on the number of
+    // variables, hence adding variables does not move any element.
 
   private:
     std::vector< BoundT > _matrix;
     MatrixIndex _num_var = 0; // size of the matrix
 
+  private:
+    /// \brief Number of stored elements for the given number of variables
+    static std::size_t num_elements(MatrixIndex num_var) {
+      return 2 * num_var * (num_var + 1);
+    }
+
+    /// \brief Position of the element m[i, j], with zero-based indexes
+    static std::size_t position(MatrixIndex i, MatrixIndex j) {
+      if (j > (i | 1)) {
+        // Use the coherent element m[bar(j), bar(i)]
+        MatrixIndex tmp = i;
+        i = j ^ 1;
+        j = tmp ^ 1;
+      }
+      return j + ((i + 1) * (i + 1)) / 2;
+    }
+
   public:
     /// \brief Create an empty matrix
     Matrix() = default;
@@ -131,6 +152,11 @@ private:
     /// \brief Return the number of variables
     MatrixIndex size() const { return this->_num_var; }
 
+    /// \brief Return the memory allocated for the matrix, in bytes
+    std::size_t size_in_bytes() const {
+      return this->_matrix.capacity() * sizeof(BoundT);
+    }
+
     /// \brief Resize the matrix
     ///
     /// \param new_size number of contained variables
@@ -140,61 +166,32 @@ private:
         return;
       }
 
-      this->_matrix.resize(4 * new_size * new_size, BoundT::plus_infinity());
-
-      for (MatrixIndex j = 2 * this->_num_var; j > 0; --j) {
-        for (MatrixIndex i = 2 * this->_num_var; i > 0; --i) {
-          std::swap(this->_matrix[2 * new_size * (j - 1) + (i - 1)],
-                    this->_matrix[2 * _num_var * (j - 1) + (i - 1)]);
-        }
-      }
-
+      this->_matrix.resize(num_elements(new_size), BoundT::plus_infinity());
       this->_num_var = new_size;
     }
 
-    /// \brief Downsize the matrix
-    void operator-=(MatrixIndex k) {
-      ikos_assert_msg(k >= 1 && k <= this->_num_var,
-                      "invalid valuewrong value");
-
-      if (this->_num_var == 0) {
-        return;
-      }
-
-      MatrixIndex new_size = this->_num_var - 1;
+    /// \brief Downsize the matrix, keeping only the given variables
+    ///
+    /// `indexes[k]` is the current (one-based) index of the variable that
+    /// gets the new index `k + 1`.
+    void compact(const std::vector< MatrixIndex >& indexes) {
+      const auto new_size = static_cast< MatrixIndex >(indexes.size());
       std::vector< BoundT > new_matrix;
-      new_matrix.resize(4 * new_size * new_size, BoundT::plus_infinity());
-
-      for (MatrixIndex j = 2 * this->_num_var; j > 0; --j) {
-        if (j == 2 * k || j == 2 * k - 1) {
-          continue;
-        }
+      new_matrix.reserve(num_elements(new_size));
 
-        for (MatrixIndex i = 2 * this->_num_var; i > 0; --i) {
-          if (i == 2 * k || i == 2 * k - 1) {
-            continue;
-          }
+      // Zero-based index in the current matrix of the zero-based index i
+      auto old_index = [&indexes](MatrixIndex i) {
+        return 2 * (indexes[i / 2] - 1) + (i & 1);
+      };
 
-          if (i > 2 * k) {
-            if (j > 2 * k) {
-              std::swap(new_matrix[2 * new_size * (j - 3) + (i - 3)],
-                        this->_matrix[2 * _num_var * (j - 1) + (i - 1)]);
-            } else { // j < 2*k-1
-              std::swap(new_matrix[2 * new_size * (j - 1) + (i - 3)],
-                        this->_matrix[2 * _num_var * (j - 1) + (i - 1)]);
-            }
-          } else { // i < 2*k-1
-            if (j > 2 * k) {
-              std::swap(new_matrix[2 * new_size * (j - 3) + (i - 1)],
-                        this->_matrix[2 * _num_var * (j - 1) + (i - 1)]);
-            } else { // j < 2*k-1
-              std::swap(new_matrix[2 * new_size * (j - 1) + (i - 1)],
-                        this->_matrix[2 * _num_var * (j - 1) + (i - 1)]);
-            }
-          }
+      for (MatrixIndex i = 0; i < 2 * new_size; ++i) {
+        for (MatrixIndex j = 0; j <= (i | 1); ++j) {
+          new_matrix.push_back(
+              std::move(this->_matrix[position(old_index(i), old_index(j))]));
         }
       }
 
+      ikos_assert(new_matrix.size() == num_elements(new_size));
       std::swap(this->_matrix, new_matrix);
       this->_num_var = new_size;
     }
@@ -205,22 +202,32 @@ private:
       this->_matrix.clear();
     }
 
+    /// \brief Return the bound m[i, j]
+    ///
+    /// Accesses the matrix as one-based so as to match DBM representations.
+    /// Note that m[i, j] and m[bar(j), bar(i)] share the same storage.
     BoundT& operator()(MatrixIndex i, MatrixIndex j) {
-      // Accesses the matrix as one-based and in column-major order
-      // so as to match DBM representations.
       ikos_assert_msg(i >= 1 && j >= 1 && i <= 2 * this->_num_var &&
                           j <= 2 * this->_num_var,
                       "out of bounds matrix access");
-      return this->_matrix[2 * this->_num_var * (j - 1) + (i - 1)];
+      return this->_matrix[position(i - 1, j - 1)];
     }
 
+    /// \brief Return the bound m[i, j]
+    ///
+    /// Accesses the matrix as one-based so as to match DBM representations.
     const BoundT& operator()(MatrixIndex i, MatrixIndex j) const {
-      // Accesses the matrix as one-based and in column-major order
-      // so as to match DBM representations.
       ikos_assert_msg(i >= 1 && j >= 1 && i <= 2 * this->_num_var &&
                           j <= 2 * this->_num_var,
                       "out of bounds matrix access");
-      return this->_matrix[2 * this->_num_var * (j - 1) + (i - 1)];
+      return this->_matrix[position(i - 1, j - 1)];
+    }
+
+    /// \brief Return the last (one-based) column stored for row `i`
+    ///
+    /// The other elements of the row are coherent with stored elements.
+    static MatrixIndex last_stored_column(MatrixIndex i) {
+      return ((i - 1) | 1) + 1;
     }
 
     /// \brief Print the matrix, for debugging purpose
@@ -245,6 +252,11 @@ private:
   // IMPORTANT: Treat this as a vector of booleans.
   std::vector< unsigned char > _norm_vector;
 
+  /// \brief Indexes of forgotten variables, available for new variables
+  ///
+  /// These variables are unconstrained in the matrix.
+  std::vector< MatrixIndex > _free_indexes;
+
 private:
   struct TopTag {};
   struct BottomTag {};
@@ -302,7 +314,51 @@ private:
   /// \brief Resize the octagon
   void resize() {
     this->_matrix.resize(this->_var_index_map.size());
-    this->_norm_vector.resize(this->_var_index_map.size(), 0);
+    this->_norm_vector.resize(this->_matrix.size(), 0);
+  }
+
+  /// \brief Get the index of variable x in the matrix
+  ///
+  /// Create a new one if not found, reusing the index of a forgotten variable
+  /// if possible.
+  MatrixIndex var_index(VariableRef x) {
+    auto it = this->_var_index_map.find(x);
+    if (it != this->_var_index_map.end()) {
+      return it->second;
+    }
+
+    MatrixIndex i;
+    if (this->_free_indexes.empty()) {
+      i = this->_matrix.size() + 1;
+      this->_matrix.resize(i);
+      this->_norm_vector.resize(i, 0);
+    } else {
+      i = this->_free_indexes.back();
+      this->_free_indexes.pop_back();
+    }
+    this->_var_index_map.emplace(x, i);
+    return i;
+  }
+
+  /// \brief Remove the indexes of forgotten variables from the matrix
+  ///
+  /// This is called once enough variables have been forgotten, so that the
+  /// quadratic cost is amortized over the calls to forget().
+  void compact() {
+    std::vector< MatrixIndex > indexes;
+    std::vector< unsigned char > norm_vector;
+    indexes.reserve(this->_var_index_map.size());
+    norm_vector.reserve(this->_var_index_map.size());
+
+    for (auto& p : this->_var_index_map) {
+      indexes.push_back(p.second);
+      norm_vector.push_back(this->_norm_vector[p.second - 1]);
+      p.second = static_cast< MatrixIndex >(indexes.size());
+    }
+
+    this->_matrix.compact(indexes);
+    std::swap(this->_norm_vector, norm_vector);
+    this->_free_indexes.clear();
   }
 
 public:
@@ -321,13 +377,23 @@ public:
 
     const MatrixIndex num_var = this->_matrix.size();
 
+    // The matrix is closed, except for constraints between variables with a
+    // null entry in _norm_vector. Pivoting on these variables only is enough
+    // to close it, since any shortest path alternates between closed segments
+    // and such constraints.
+    bool did_pivot = false;
     for (MatrixIndex k = 1; k <= num_var; ++k) {
       if (this->_norm_vector[k - 1]) {
         continue;
       }
 
+      did_pivot = true;
+
+      // Only the stored half of the matrix is updated, the other half is
+      // coherent with it
       for (MatrixIndex i = 1; i <= 2 * num_var; ++i) {
-        for (MatrixIndex j = 1; j <= 2 * num_var; ++j) {
+        const MatrixIndex last_j = Matrix::last_stored_column(i);
+        for (MatrixIndex j = 1; j <= last_j; ++j) {
           // to ensure the "closed" property
           self->_matrix(i, j) =
               C(this->_matrix(i, j),
@@ -340,17 +406,22 @@ public:
         }
       }
 
+      self->_norm_vector[k - 1] = 1;
+    }
+
+    // Strengthening a closed matrix gives a strongly closed matrix, hence it
+    // is only done once, after all the pivots.
+    if (did_pivot) {
       // to ensure for all i,j: m_ij <= (m_i+i- + m_j-j+)/2
       for (MatrixIndex i = 1; i <= 2 * num_var; ++i) {
-        for (MatrixIndex j = 1; j <= 2 * num_var; ++j) {
+        const MatrixIndex last_j = Matrix::last_stored_column(i);
+        for (MatrixIndex j = 1; j <= last_j; ++j) {
           self->_matrix(i, j) = min(this->_matrix(i, j),
                                     (this->_matrix(i, i + 2 * (i % 2) - 1) +
                                      this->_matrix(j + 2 * (j % 2) - 1, j)) /
                                         BoundT(2));
         }
       }
-
-      self->_norm_vector[k - 1] = 1;
     }
 
     // Check for negative cycle
@@ -382,6 +453,7 @@ public:
     this->_matrix.clear();
     this->_var_index_map.clear();
     this->_norm_vector.clear();
+    this->_free_indexes.clear();
   }
 
   void set_to_top() override {
@@ -390,6 +462,7 @@ public:
     this->_matrix.clear();
     this->_var_index_map.clear();
     this->_norm_vector.clear();
+    this->_free_indexes.clear();
   }
 
   bool leq(const Octagon& other) const override {
@@ -983,6 +1056,13 @@ private:
 
   void apply_constraint(MatrixIndex var, bool is_positive, BoundT constraint) {
     // Application of single variable octagonal constraints.
+    if (this->_is_bottom) {
+      return;
+    }
+
+    // Only the constraints on var need to be closed
+    this->_norm_vector[var - 1] = 0;
+
     constraint *= BoundT(2);
     if (is_positive) { // 2*v1 <= constraint
       this->_matrix(2 * var, 2 * var - 1) =
@@ -1004,6 +1084,14 @@ private:
                         bool is2_positive,
                         const BoundT& constraint) {
     // Application of double variable octagonal constraints.
+    if (this->_is_bottom) {
+      return;
+    }
+
+    // Only the constraints on i and j need to be closed
+    this->_norm_vector[i - 1] = 0;
+    this->_norm_vector[j - 1] = 0;
+
     if (is1_positive && is2_positive) { // v1 + v2 <= constraint
       this->_matrix(2 * j, 2 * i - 1) =
           min(this->_matrix(2 * j, 2 * i - 1), constraint);
@@ -1056,15 +1144,7 @@ public:
     }
 
     // add x in the matrix if not found
-    auto it = this->_var_index_map.find(x);
-    MatrixIndex i;
-    if (it == this->_var_index_map.end()) {
-      i = this->_var_index_map.emplace(x, this->_var_index_map.size() + 1)
-              .first->second;
-      this->resize();
-    } else {
-      i = it->second;
-    }
+    MatrixIndex i = this->var_index(x);
 
     this->abstract(x); // call normalize()
 
@@ -1109,6 +1189,8 @@ private:
     }
 
     if (op_eq) {
+      // Updating the rows also updates the coherent columns m[i, 2j] and
+      // m[i, 2j-1], since they share the same storage
       for (MatrixIndex j_idx = 1; j_idx <= 2 * this->_matrix.size(); ++j_idx) {
         if (j_idx != 2 * j && j_idx != 2 * j - 1) {
           this->_matrix(2 * j - 1, j_idx) -= lb;
@@ -1116,13 +1198,6 @@ private:
         }
       }
 
-      for (MatrixIndex i_idx = 1; i_idx <= 2 * _matrix.size(); ++i_idx) {
-        if (i_idx != 2 * j && i_idx != 2 * j - 1) {
-          this->_matrix(i_idx, 2 * j) -= lb;
-          this->_matrix(i_idx, 2 * j - 1) += ub;
-        }
-      }
-
       this->_matrix(2 * j - 1, 2 * j) -= BoundT(2) * lb;
       this->_matrix(2 * j, 2 * j - 1) += BoundT(2) * ub;
     } else {
@@ -1225,10 +1300,7 @@ private:
     // Requires normalization.
 
     // add x in the DBM if not found
-    if (this->_var_index_map.find(x) == this->_var_index_map.end()) {
-      this->_var_index_map.emplace(x, this->_var_index_map.size() + 1);
-      this->resize();
-    }
+    this->var_index(x);
 
     if (this->_var_index_map.find(y) == this->_var_index_map.end()) {
       this->abstract(x);
@@ -1372,8 +1444,7 @@ public:
               "0, and 1).");
         }
 
-        i = this->_var_index_map.emplace(term.first, _var_index_map.size() + 1)
-                .first->second;
+        i = this->var_index(term.first);
         v1 = true;
       } else if (!v2) {
         // Calculates and loads information for the second variable,
@@ -1388,8 +1459,7 @@ public:
               "0, and 1).");
         }
 
-        j = this->_var_index_map.emplace(term.first, _var_index_map.size() + 1)
-                .first->second;
+        j = this->var_index(term.first);
         v2 = true;
       } else {
         ikos_unreachable("constraint is not an octagon constraint");
@@ -1401,7 +1471,6 @@ public:
       }
       return;
     }
-    this->resize();
     BoundT constant(cst.constant()), neg_constant(-cst.constant());
 
     if (cst.is_inequality()) { // Applies inequality constraints in the form of
@@ -1450,15 +1519,7 @@ public:
       return;
     }
     // add x in the matrix if not found
-    auto it = this->_var_index_map.find(x);
-    MatrixIndex idx;
-    if (it == this->_var_index_map.end()) {
-      idx = this->_var_index_map.emplace(x, this->_var_index_map.size() + 1)
-                .first->second;
-      this->resize();
-    } else {
-      idx = it->second;
-    }
+    MatrixIndex idx = this->var_index(x);
     this->abstract(x);                               // normalize
     this->apply_constraint(idx, true, value.ub());   // x <= ub
     this->apply_constraint(idx, false, -value.lb()); // -x <= -lb
@@ -1499,19 +1560,16 @@ public:
   void forget(VariableRef x) override {
     if (boost::optional< typename VarIndexMap::iterator > it =
             this->abstract(x)) {
-      MatrixIndex n = (*it)->second;
-      this->_matrix -= n;
-      this->_var_index_map.erase(*it);
-      // update the values in _var_index_map
-      for (auto itz = this->_var_index_map.begin();
-           itz != this->_var_index_map.end();
-           ++itz) {
-        if (itz->second > n) {
-          this->_var_index_map[itz->first]--;
-        }
+      if (!this->_is_bottom) {
+        this->_free_indexes.push_back((*it)->second);
       }
-      this->_norm_vector.resize(this->_var_index_map.size(), 0);
+      this->_var_index_map.erase(*it);
       this->_is_normalized = false;
+
+      if (this->_free_indexes.size() >= 8 &&
+          2 * this->_free_indexes.size() >= this->_matrix.size()) {
+        this->compact();
+      }
     }
   }
 
@@ -1590,6 +1648,13 @@ public:
     return csts;
   }
 
+  std::size_t size_in_bytes() const override {
+    return sizeof(Octagon) + this->_matrix.size_in_bytes() +
+           this->_var_index_map.capacity() *
+               sizeof(typename VarIndexMap::value_type) +
+           this->_norm_vector.capacity();
+  }
+
   void dump(std::ostream& o) const override {
 #ifdef VERBOSE
     /// For debugging purposes
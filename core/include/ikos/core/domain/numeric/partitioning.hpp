@@ -0,0 +1,748 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Trace partitioning numerical abstract domain
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/container/flat_set.hpp>
+#include <boost/optional.hpp>
+
+#include <ikos/core/domain/numeric/abstract_domain.hpp>
+#include <ikos/core/support/assert.hpp>
+#include <ikos/core/value/numeric/congruence.hpp>
+#include <ikos/core/value/numeric/interval.hpp>
+
+namespace ikos {
+namespace core {
+namespace numeric {
+
+/// \brief Trace partitioning abstract domain
+///
+/// Keeps a disjunction of up to `MaxDisjuncts` abstract values of the
+/// underlying numeric domain, partitioned on the constant value of a set of
+/// selected variables (typically boolean flags or enums, selected with
+/// `partition_on()`).
+///
+/// Disjuncts that agree on the value of all partitioning variables are always
+/// joined. When there are more than `MaxDisjuncts` disjuncts, the two
+/// disjuncts whose keys agree on the most partitioning variables are joined.
+template < typename Number,
+           typename VariableRef,
+           typename NumericDomain,
+           std::size_t MaxDisjuncts >
+class PartitioningDomain final
+    : public numeric::AbstractDomain< Number,
+                                      VariableRef,
+                                      PartitioningDomain< Number,
+                                                          VariableRef,
+                                                          NumericDomain,
+                                                          MaxDisjuncts > > {
+public:
+  static_assert(MaxDisjuncts >= 1, "MaxDisjuncts must be at least 1");
+
+public:
+  using IntervalT = Interval< Number >;
+  using CongruenceT = Congruence< Number >;
+  using IntervalCongruenceT = IntervalCongruence< Number >;
+  using LinearExpressionT = LinearExpression< Number, VariableRef >;
+  using LinearConstraintT = LinearConstraint< Number, VariableRef >;
+  using LinearConstraintSystemT = LinearConstraintSystem< Number, VariableRef >;
+
+private:
+  using VariableSet = boost::container::flat_set< VariableRef >;
+
+  /// \brief Constant values of the partitioning variables, or boost::none
+  using Key = std::vector< boost::optional< Number > >;
+
+  struct Disjunct {
+    Key key;
+    NumericDomain value;
+  };
+
+  using DisjunctVector = std::vector< Disjunct >;
+
+private:
+  /// \brief Partitioning variables
+  VariableSet _vars;
+
+  /// \brief Disjuncts, none of them is bottom
+  ///
+  /// The abstract value is bottom if and only if the vector is empty.
+  DisjunctVector _disjuncts;
+
+private:
+  struct TopTag {};
+  struct BottomTag {};
+
+  /// \brief Create the top abstract value
+  explicit PartitioningDomain(TopTag) {
+    this->_disjuncts.push_back(Disjunct{Key{}, NumericDomain::top()});
+  }
+
+  /// \brief Create the bottom abstract value
+  explicit PartitioningDomain(BottomTag) {}
+
+public:
+  /// \brief Create the top abstract value
+  PartitioningDomain() : PartitioningDomain(TopTag{}) {}
+
+  /// \brief Copy constructor
+  PartitioningDomain(const PartitioningDomain&) = default;
+
+  /// \brief Move constructor
+  PartitioningDomain(PartitioningDomain&&) = default;
+
+  /// \brief Copy assignment operator
+  PartitioningDomain& operator=(const PartitioningDomain&) = default;
+
+  /// \brief Move assignment operator
+  PartitioningDomain& operator=(PartitioningDomain&&) = default;
+
+  /// \brief Destructor
+  ~PartitioningDomain() override = default;
+
+  /// \brief Create the top abstract value
+  static PartitioningDomain top() { return PartitioningDomain(TopTag{}); }
+
+  /// \brief Create the bottom abstract value
+  static PartitioningDomain bottom() {
+    return PartitioningDomain(BottomTag{});
+  }
+
+private:
+  /// \brief Compute the key of the given abstract value
+  Key key(const NumericDomain& inv) const {
+    Key k;
+    k.reserve(this->_vars.size());
+    for (VariableRef v : this->_vars) {
+      k.push_back(inv.to_interval(v).singleton());
+    }
+    return k;
+  }
+
+  /// \brief Return the number of partitioning variables on which the given
+  /// keys agree
+  static std::size_t similarity(const Key& a, const Key& b) {
+    ikos_assert(a.size() == b.size());
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < a.size(); i++) {
+      if (a[i] && b[i] && *a[i] == *b[i]) {
+        n++;
+      }
+    }
+    return n;
+  }
+
+  /// \brief Add a disjunct, joining it with the disjunct of the same key
+  void insert(NumericDomain inv) {
+    if (inv.is_bottom()) {
+      return;
+    }
+
+    Key k = this->key(inv);
+    for (Disjunct& d : this->_disjuncts) {
+      if (d.key == k) {
+        d.value.join_with(inv);
+        return;
+      }
+    }
+    this->_disjuncts.push_back(Disjunct{std::move(k), std::move(inv)});
+  }
+
+  /// \brief Join the most similar disjuncts until there are at most
+  /// MaxDisjuncts disjuncts
+  void reduce() {
+    while (this->_disjuncts.size() > MaxDisjuncts) {
+      std::size_t best_i = 0;
+      std::size_t best_j = 1;
+      std::size_t best_similarity = 0;
+      bool found = false;
+
+      for (std::size_t i = 0; i < this->_disjuncts.size(); i++) {
+        for (std::size_t j = i + 1; j < this->_disjuncts.size(); j++) {
+          std::size_t s = similarity(this->_disjuncts[i].key,
+                                     this->_disjuncts[j].key);
+          if (!found || s > best_similarity) {
+            best_i = i;
+            best_j = j;
+            best_similarity = s;
+            found = true;
+          }
+        }
+      }
+
+      NumericDomain inv = this->_disjuncts[best_i].value.join(
+          this->_disjuncts[best_j].value);
+      this->_disjuncts.erase(this->_disjuncts.begin() +
+                             static_cast< std::ptrdiff_t >(best_j));
+      this->_disjuncts.erase(this->_disjuncts.begin() +
+                             static_cast< std::ptrdiff_t >(best_i));
+      this->insert(std::move(inv));
+    }
+  }
+
+  /// \brief Rebuild the partition from the given abstract values
+  void rebuild(std::vector< NumericDomain > values) {
+    this->_disjuncts.clear();
+    for (NumericDomain& inv : values) {
+      this->insert(std::move(inv));
+    }
+    this->reduce();
+  }
+
+  /// \brief Apply the given operation on each disjunct
+  template < typename UnaryOp >
+  void transform(const UnaryOp& op) {
+    std::vector< NumericDomain > values;
+    values.reserve(this->_disjuncts.size());
+    for (Disjunct& d : this->_disjuncts) {
+      op(d.value);
+      values.push_back(std::move(d.value));
+    }
+    this->rebuild(std::move(values));
+  }
+
+  /// \brief Return the abstract values of all disjuncts
+  std::vector< NumericDomain > values() const {
+    std::vector< NumericDomain > values;
+    values.reserve(this->_disjuncts.size());
+    for (const Disjunct& d : this->_disjuncts) {
+      values.push_back(d.value);
+    }
+    return values;
+  }
+
+  /// \brief Return the join of all disjuncts
+  NumericDomain merge() const {
+    NumericDomain inv = NumericDomain::bottom();
+    for (const Disjunct& d : this->_disjuncts) {
+      inv.join_with(d.value);
+    }
+    return inv;
+  }
+
+  /// \brief Return the disjunct with the given key, or nullptr
+  const Disjunct* find(const Key& k) const {
+    for (const Disjunct& d : this->_disjuncts) {
+      if (d.key == k) {
+        return &d;
+      }
+    }
+    return nullptr;
+  }
+
+  /// \brief Return true if both abstract values have the same keys
+  bool same_keys(const PartitioningDomain& other) const {
+    if (this->_disjuncts.size() != other._disjuncts.size()) {
+      return false;
+    }
+    for (const Disjunct& d : other._disjuncts) {
+      if (this->find(d.key) == nullptr) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// \brief Return true if every key of `other` is a key of `this`
+  bool includes_keys(const PartitioningDomain& other) const {
+    for (const Disjunct& d : other._disjuncts) {
+      if (this->find(d.key) == nullptr) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// \brief Use the union of the partitioning variables of both abstract
+  /// values, and recompute the keys if needed
+  static void unify_variables(PartitioningDomain& a, PartitioningDomain& b) {
+    if (a._vars == b._vars) {
+      return;
+    }
+    VariableSet vars = a._vars;
+    vars.insert(b._vars.begin(), b._vars.end());
+    a.set_variables(vars);
+    b.set_variables(vars);
+  }
+
+  /// \brief Set the partitioning variables and recompute the keys
+  void set_variables(const VariableSet& vars) {
+    if (this->_vars == vars) {
+      return;
+    }
+    this->_vars = vars;
+    this->rebuild(this->values());
+  }
+
+public:
+  /// \brief Partition on the value of the given variable
+  void partition_on(VariableRef x) {
+    if (this->_vars.count(x) != 0) {
+      return;
+    }
+    VariableSet vars = this->_vars;
+    vars.insert(x);
+    this->set_variables(vars);
+  }
+
+  /// \brief Return the number of disjuncts
+  std::size_t num_disjuncts() const { return this->_disjuncts.size(); }
+
+  bool is_bottom() const override { return this->_disjuncts.empty(); }
+
+  bool is_top() const override {
+    return std::any_of(this->_disjuncts.begin(),
+                       this->_disjuncts.end(),
+                       [](const Disjunct& d) { return d.value.is_top(); });
+  }
+
+  void set_to_bottom() override { this->_disjuncts.clear(); }
+
+  void set_to_top() override {
+    this->_disjuncts.clear();
+    this->_disjuncts.push_back(
+        Disjunct{Key(this->_vars.size()), NumericDomain::top()});
+  }
+
+  bool leq(const PartitioningDomain& other) const override {
+    if (this->is_bottom()) {
+      return true;
+    } else if (other.is_bottom()) {
+      return false;
+    } else {
+      PartitioningDomain left = *this;
+      PartitioningDomain right = other;
+      unify_variables(left, right);
+      for (const Disjunct& d : left._disjuncts) {
+        const Disjunct* o = right.find(d.key);
+        if (o != nullptr && d.value.leq(o->value)) {
+          continue;
+        }
+        if (!std::any_of(right._disjuncts.begin(),
+                         right._disjuncts.end(),
+                         [&](const Disjunct& e) {
+                           return d.value.leq(e.value);
+                         })) {
+          return false;
+        }
+      }
+      return true;
+    }
+  }
+
+  bool equals(const PartitioningDomain& other) const override {
+    return this->leq(other) && other.leq(*this);
+  }
+
+  PartitioningDomain join(const PartitioningDomain& other) const override {
+    if (this->is_bottom()) {
+      return other;
+    } else if (other.is_bottom()) {
+      return *this;
+    } else {
+      PartitioningDomain left = *this;
+      PartitioningDomain right = other;
+      unify_variables(left, right);
+      for (Disjunct& d : right._disjuncts) {
+        left.insert(std::move(d.value));
+      }
+      left.reduce();
+      return left;
+    }
+  }
+
+  void join_with(const PartitioningDomain& other) override {
+    this->operator=(this->join(other));
+  }
+
+  void join_loop_with(const PartitioningDomain& other) override {
+    this->join_with(other);
+  }
+
+  void join_iter_with(const PartitioningDomain& other) override {
+    this->join_with(other);
+  }
+
+private:
+  /// \brief Apply a widening-like operator
+  ///
+  /// If every partition of `other` already exists in `this`, the operator is
+  /// applied partition per partition. Otherwise, the partitions are collapsed
+  /// into one disjunct, to ensure termination.
+  template < typename BinaryOp >
+  PartitioningDomain extrapolate(const PartitioningDomain& other,
+                                 const BinaryOp& op) const {
+    PartitioningDomain left = *this;
+    PartitioningDomain right = other;
+    unify_variables(left, right);
+
+    if (left.includes_keys(right)) {
+      std::vector< NumericDomain > values;
+      values.reserve(left._disjuncts.size());
+      for (const Disjunct& d : left._disjuncts) {
+        const Disjunct* o = right.find(d.key);
+        if (o != nullptr) {
+          values.push_back(op(d.value, o->value));
+        } else {
+          values.push_back(d.value);
+        }
+      }
+      left.rebuild(std::move(values));
+    } else {
+      std::vector< NumericDomain > values;
+      values.push_back(op(left.merge(), right.merge()));
+      left.rebuild(std::move(values));
+    }
+    return left;
+  }
+
+public:
+  PartitioningDomain widening(const PartitioningDomain& other) const override {
+    if (this->is_bottom()) {
+      return other;
+    } else if (other.is_bottom()) {
+      return *this;
+    } else {
+      return this->extrapolate(other,
+                               [](const NumericDomain& a,
+                                  const NumericDomain& b) {
+                                 return a.widening(b);
+                               });
+    }
+  }
+
+  void widen_with(const PartitioningDomain& other) override {
+    this->operator=(this->widening(other));
+  }
+
+  PartitioningDomain widening_threshold(
+      const PartitioningDomain& other, const Number& threshold) const override {
+    if (this->is_bottom()) {
+      return other;
+    } else if (other.is_bottom()) {
+      return *this;
+    } else {
+      return this->extrapolate(other,
+                               [&](const NumericDomain& a,
+                                   const NumericDomain& b) {
+                                 return a.widening_threshold(b, threshold);
+                               });
+    }
+  }
+
+  void widen_threshold_with(const PartitioningDomain& other,
+                            const Number& threshold) override {
+    this->operator=(this->widening_threshold(other, threshold));
+  }
+
+  PartitioningDomain meet(const PartitioningDomain& other) const override {
+    if (this->is_bottom() || other.is_bottom()) {
+      return bottom();
+    } else {
+      PartitioningDomain left = *this;
+      PartitioningDomain right = other;
+      unify_variables(left, right);
+      std::vector< NumericDomain > values;
+      for (const Disjunct& d : left._disjuncts) {
+        for (const Disjunct& e : right._disjuncts) {
+          values.push_back(d.value.meet(e.value));
+        }
+      }
+      left.rebuild(std::move(values));
+      return left;
+    }
+  }
+
+  void meet_with(const PartitioningDomain& other) override {
+    this->operator=(this->meet(other));
+  }
+
+  PartitioningDomain narrowing(const PartitioningDomain& other) const override {
+    if (this->is_bottom() || other.is_bottom()) {
+      return bottom();
+    } else {
+      PartitioningDomain left = *this;
+      PartitioningDomain right = other;
+      unify_variables(left, right);
+
+      std::vector< NumericDomain > values;
+      if (left.same_keys(right)) {
+        for (const Disjunct& d : left._disjuncts) {
+          values.push_back(d.value.narrowing(right.find(d.key)->value));
+        }
+      } else {
+        values.push_back(left.merge().narrowing(right.merge()));
+      }
+      left.rebuild(std::move(values));
+      return left;
+    }
+  }
+
+  void narrow_with(const PartitioningDomain& other) override {
+    this->operator=(this->narrowing(other));
+  }
+
+  void assign(VariableRef x, int n) override {
+    this->transform([&](NumericDomain& inv) { inv.assign(x, n); });
+  }
+
+  void assign(VariableRef x, const Number& n) override {
+    this->transform([&](NumericDomain& inv) { inv.assign(x, n); });
+  }
+
+  void assign(VariableRef x, VariableRef y) override {
+    this->transform([&](NumericDomain& inv) { inv.assign(x, y); });
+  }
+
+  void assign(VariableRef x, const LinearExpressionT& e) override {
+    this->transform([&](NumericDomain& inv) { inv.assign(x, e); });
+  }
+
+  void apply(BinaryOperator op,
+             VariableRef x,
+             VariableRef y,
+             VariableRef z) override {
+    this->transform([&](NumericDomain& inv) { inv.apply(op, x, y, z); });
+  }
+
+  void apply(BinaryOperator op,
+             VariableRef x,
+             VariableRef y,
+             const Number& z) override {
+    this->transform([&](NumericDomain& inv) { inv.apply(op, x, y, z); });
+  }
+
+  void apply(BinaryOperator op,
+             VariableRef x,
+             const Number& y,
+             VariableRef z) override {
+    this->transform([&](NumericDomain& inv) { inv.apply(op, x, y, z); });
+  }
+
+  void add(const LinearConstraintT& cst) override {
+    this->transform([&](NumericDomain& inv) { inv.add(cst); });
+  }
+
+  void add(const LinearConstraintSystemT& csts) override {
+    this->transform([&](NumericDomain& inv) { inv.add(csts); });
+  }
+
+  void set(VariableRef x, const IntervalT& value) override {
+    if (this->is_bottom()) {
+      return;
+    } else if (value.is_bottom()) {
+      this->set_to_bottom();
+    } else {
+      this->transform([&](NumericDomain& inv) { inv.set(x, value); });
+    }
+  }
+
+  void set(VariableRef x, const CongruenceT& value) override {
+    if (this->is_bottom()) {
+      return;
+    } else if (value.is_bottom()) {
+      this->set_to_bottom();
+    } else {
+      this->transform([&](NumericDomain& inv) { inv.set(x, value); });
+    }
+  }
+
+  void set(VariableRef x, const IntervalCongruenceT& value) override {
+    if (this->is_bottom()) {
+      return;
+    } else if (value.is_bottom()) {
+      this->set_to_bottom();
+    } else {
+      this->transform([&](NumericDomain& inv) { inv.set(x, value); });
+    }
+  }
+
+  void refine(VariableRef x, const IntervalT& value) override {
+    if (this->is_bottom()) {
+      return;
+    } else if (value.is_bottom()) {
+      this->set_to_bottom();
+    } else {
+      this->transform([&](NumericDomain& inv) { inv.refine(x, value); });
+    }
+  }
+
+  void refine(VariableRef x, const CongruenceT& value) override {
+    if (this->is_bottom()) {
+      return;
+    } else if (value.is_bottom()) {
+      this->set_to_bottom();
+    } else {
+      this->transform([&](NumericDomain& inv) { inv.refine(x, value); });
+    }
+  }
+
+  void refine(VariableRef x, const IntervalCongruenceT& value) override {
+    if (this->is_bottom()) {
+      return;
+    } else if (value.is_bottom()) {
+      this->set_to_bottom();
+    } else {
+      this->transform([&](NumericDomain& inv) { inv.refine(x, value); });
+    }
+  }
+
+  void forget(VariableRef x) override {
+    this->transform([&](NumericDomain& inv) { inv.forget(x); });
+  }
+
+  void normalize() const override {
+    for (const Disjunct& d : this->_disjuncts) {
+      d.value.normalize();
+    }
+  }
+
+  IntervalT to_interval(VariableRef x) const override {
+    IntervalT r = IntervalT::bottom();
+    for (const Disjunct& d : this->_disjuncts) {
+      r.join_with(d.value.to_interval(x));
+    }
+    return r;
+  }
+
+  IntervalT to_interval(const LinearExpressionT& e) const override {
+    IntervalT r = IntervalT::bottom();
+    for (const Disjunct& d : this->_disjuncts) {
+      r.join_with(d.value.to_interval(e));
+    }
+    return r;
+  }
+
+  CongruenceT to_congruence(VariableRef x) const override {
+    CongruenceT r = CongruenceT::bottom();
+    for (const Disjunct& d : this->_disjuncts) {
+      r.join_with(d.value.to_congruence(x));
+    }
+    return r;
+  }
+
+  CongruenceT to_congruence(const LinearExpressionT& e) const override {
+    CongruenceT r = CongruenceT::bottom();
+    for (const Disjunct& d : this->_disjuncts) {
+      r.join_with(d.value.to_congruence(e));
+    }
+    return r;
+  }
+
+  IntervalCongruenceT to_interval_congruence(VariableRef x) const override {
+    IntervalCongruenceT r = IntervalCongruenceT::bottom();
+    for (const Disjunct& d : this->_disjuncts) {
+      r.join_with(d.value.to_interval_congruence(x));
+    }
+    return r;
+  }
+
+  IntervalCongruenceT to_interval_congruence(
+      const LinearExpressionT& e) const override {
+    IntervalCongruenceT r = IntervalCongruenceT::bottom();
+    for (const Disjunct& d : this->_disjuncts) {
+      r.join_with(d.value.to_interval_congruence(e));
+    }
+    return r;
+  }
+
+  LinearConstraintSystemT to_linear_constraint_system() const override {
+    if (this->is_bottom()) {
+      return LinearConstraintSystemT(LinearConstraintT::contradiction());
+    }
+
+    return this->merge().to_linear_constraint_system();
+  }
+
+  /// \name Non-negative loop counter abstract domain methods
+  /// @{
+
+  void mark_counter(VariableRef x) override {
+    this->transform([&](NumericDomain& inv) { inv.mark_counter(x); });
+  }
+
+  void unmark_counter(VariableRef x) override {
+    this->transform([&](NumericDomain& inv) { inv.unmark_counter(x); });
+  }
+
+  void init_counter(VariableRef x, const Number& c) override {
+    this->transform([&](NumericDomain& inv) { inv.init_counter(x, c); });
+  }
+
+  void incr_counter(VariableRef x, const Number& k) override {
+    this->transform([&](NumericDomain& inv) { inv.incr_counter(x, k); });
+  }
+
+  void forget_counter(VariableRef x) override {
+    this->transform([&](NumericDomain& inv) { inv.forget_counter(x); });
+  }
+
+  /// @}
+
+  void dump(std::ostream& o) const override {
+    if (this->is_bottom()) {
+      o << "⊥";
+    } else {
+      bool first = true;
+      for (const Disjunct& d : this->_disjuncts) {
+        if (!first) {
+          o << " ∨ ";
+        }
+        first = false;
+        d.value.dump(o);
+      }
+    }
+  }
+
+  static std::string name() {
+    return "partitioning of " + NumericDomain::name();
+  }
+
+}; // end class PartitioningDomain
+
+} // end namespace numeric
+} // end namespace core
+} // end namespace ikos
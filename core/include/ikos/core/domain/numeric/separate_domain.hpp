@@ -402,6 +402,10 @@ public:
     this->set(x, apply_bin_operator(op, Value(y), this->get(z)));
   }
 
+  std::size_t size_in_bytes() const override {
+    return sizeof(SeparateDomain) + this->_tree.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     if (this->is_bottom()) {
       o << "⊥";
@@ -0,0 +1,1573 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Sparse domain of Difference-Bound Matrices, in split normal form
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Based on the paper: Exploiting Sparsity in Difference-Bound Matrices,
+ * by Graeme Gange, Jorge A. Navas, Peter Schachte, Harald Sondergaard and
+ * Peter J. Stuckey, in SAS, 189-211, 2016.
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <boost/container/flat_map.hpp>
+#include <boost/optional.hpp>
+
+#include <ikos/core/domain/numeric/abstract_domain.hpp>
+#include <ikos/core/domain/numeric/linear_interval_solver.hpp>
+#include <ikos/core/number/bound.hpp>
+#include <ikos/core/support/assert.hpp>
+#include <ikos/core/value/numeric/congruence.hpp>
+#include <ikos/core/value/numeric/interval.hpp>
+#include <ikos/core/value/numeric/interval_congruence.hpp>
+
+namespace ikos {
+namespace core {
+namespace numeric {
+
+/// \brief Split Difference-Bound Matrices abstract domain
+///
+/// Sparse representation of difference-bound matrices, as a weighted graph
+/// where an edge i -> j of weight c represents the constraint v_j - v_i <= c,
+/// and the vertex 0 represents the constant 0. Missing edges are +oo.
+///
+/// The graph is kept in split normal form: the edges between variables are
+/// closed, the bounds of the variables (i.e, the edges from and to the vertex
+/// 0) are closed with respect to them, but the edges implied by the bounds
+/// are not stored. Hence, unrelated variables do not require any edge.
+///
+/// The domain also holds a potential function, that is, a solution of all the
+/// constraints. It allows to run Dijkstra's algorithm on non-negative reduced
+/// costs when the graph needs to be closed, and to update the closure
+/// incrementally when a constraint is added.
+///
+/// Note that this abstract domain is not thread-safe.
+template < typename Number,
+           typename VariableRef,
+           std::size_t MaxReductionCycles = 10 >
+class SplitDBM final
+    : public numeric::AbstractDomain<
+          Number,
+          VariableRef,
+          SplitDBM< Number, VariableRef, MaxReductionCycles > > {
+public:
+  using BoundT = Bound< Number >;
+  using IntervalT = Interval< Number >;
+  using CongruenceT = Congruence< Number >;
+  using IntervalCongruenceT = IntervalCongruence< Number >;
+  using VariableExprT = VariableExpression< Number, VariableRef >;
+  using LinearExpressionT = LinearExpression< Number, VariableRef >;
+  using LinearConstraintT = LinearConstraint< Number, VariableRef >;
+  using LinearConstraintSystemT = LinearConstraintSystem< Number, VariableRef >;
+
+private:
+  /// \brief Index of a vertex in the graph
+  using VertexIndex = unsigned;
+
+  // \brief Map from variable to vertex
+  using VarIndexMap = boost::container::flat_map< VariableRef, VertexIndex >;
+
+  /// \brief Solver
+  using LinearIntervalSolverT =
+      LinearIntervalSolver< Number, VariableRef, SplitDBM >;
+
+  /// \brief Parent
+  using Parent = numeric::AbstractDomain< Number, VariableRef, SplitDBM >;
+
+  class Graph {
+  public:
+    /// \brief Map from a vertex to the weight of the edge
+    using EdgeMap = boost::container::flat_map< VertexIndex, Number >;
+
+  private:
+    std::vector< EdgeMap > _succs;
+    std::vector< EdgeMap > _preds;
+    std::vector< VertexIndex > _free_vertices;
+
+  public:
+    /// \brief Create a graph with only the vertex 0
+    Graph() : _succs(1), _preds(1) {}
+
+    /// \brief Copy constructor
+    Graph(const Graph&) = default;
+
+    /// \brief Move constructor
+    Graph(Graph&&) = default;
+
+    /// \brief Copy assignment operator
+    Graph& operator=(const Graph&) = default;
+
+    /// \brief Move assignment operator
+    Graph& operator=(Graph&&) = default;
+
+    /// \brief Destructor
+    ~Graph() = default;
+
+    /// \brief Return the number of vertices, including unused ones
+    VertexIndex num_vertices() const {
+      return static_cast< VertexIndex >(this->_succs.size());
+    }
+
+    /// \brief Return the edges i -> j, for all j
+    const EdgeMap& succs(VertexIndex i) const {
+      ikos_assert_msg(i < this->num_vertices(), "out of bounds vertex");
+      return this->_succs[i];
+    }
+
+    /// \brief Return the edges j -> i, for all j
+    const EdgeMap& preds(VertexIndex i) const {
+      ikos_assert_msg(i < this->num_vertices(), "out of bounds vertex");
+      return this->_preds[i];
+    }
+
+    /// \brief Return true if the graph has no edge
+    bool has_no_edge() const {
+      for (const EdgeMap& edges : this->_succs) {
+        if (!edges.empty()) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /// \brief Return true if the vertex i has no edge
+    bool is_isolated(VertexIndex i) const {
+      return this->succs(i).empty() && this->preds(i).empty();
+    }
+
+    /// \brief Return the weight of the edge i -> j, or +oo
+    BoundT weight(VertexIndex i, VertexIndex j) const {
+      const EdgeMap& edges = this->succs(i);
+      auto it = edges.find(j);
+      if (it == edges.end()) {
+        return BoundT::plus_infinity();
+      } else {
+        return BoundT(it->second);
+      }
+    }
+
+    /// \brief Set the weight of the edge i -> j
+    void set_edge(VertexIndex i, VertexIndex j, const Number& w) {
+      ikos_assert(i != j);
+      this->_succs[i][j] = w;
+      this->_preds[j][i] = w;
+    }
+
+    /// \brief Set the weight of the edge i -> j to min(weight(i, j), w)
+    void update_edge(VertexIndex i, VertexIndex j, const Number& w) {
+      ikos_assert(i != j);
+      auto it = this->_succs[i].find(j);
+      if (it == this->_succs[i].end()) {
+        this->set_edge(i, j, w);
+      } else if (w < it->second) {
+        it->second = w;
+        this->_preds[j][i] = w;
+      }
+    }
+
+    /// \brief Remove the edge i -> j
+    void remove_edge(VertexIndex i, VertexIndex j) {
+      this->_succs[i].erase(j);
+      this->_preds[j].erase(i);
+    }
+
+    /// \brief Remove all the edges from and to the vertex i
+    void remove_edges(VertexIndex i) {
+      for (const auto& edge : this->_succs[i]) {
+        this->_preds[edge.first].erase(i);
+      }
+      for (const auto& edge : this->_preds[i]) {
+        this->_succs[edge.first].erase(i);
+      }
+      this->_succs[i].clear();
+      this->_preds[i].clear();
+    }
+
+    /// \brief Add a vertex, without any edge
+    ///
+    /// \returns the index of the new vertex
+    VertexIndex add_vertex() {
+      if (!this->_free_vertices.empty()) {
+        VertexIndex i = this->_free_vertices.back();
+        this->_free_vertices.pop_back();
+        return i;
+      }
+
+      this->_succs.emplace_back();
+      this->_preds.emplace_back();
+      return this->num_vertices() - 1;
+    }
+
+    /// \brief Remove the vertex i
+    void remove_vertex(VertexIndex i) {
+      ikos_assert(i != 0);
+      this->remove_edges(i);
+      this->_free_vertices.push_back(i);
+    }
+
+    /// \brief Remove all vertices, except the vertex 0
+    void clear() {
+      this->_succs.assign(1, EdgeMap());
+      this->_preds.assign(1, EdgeMap());
+      this->_free_vertices.clear();
+    }
+
+  }; // end class Graph
+
+private:
+  bool _is_bottom;
+  bool _is_normalized;
+  Graph _graph;
+  VarIndexMap _var_index_map;
+
+  /// \brief Potential function: a solution of all the constraints
+  ///
+  /// The value of a variable is `_potential[i] - _potential[0]`, hence for
+  /// every edge i -> j of weight w, `_potential[i] + w - _potential[j] >= 0`.
+  std::vector< Number > _potential;
+
+private:
+  struct TopTag {};
+  struct BottomTag {};
+
+  /// \brief Create the top abstract value
+  explicit SplitDBM(TopTag)
+      : _is_bottom(false), _is_normalized(true), _potential(1, Number(0)) {}
+
+  /// \brief Create the bottom abstract value
+  explicit SplitDBM(BottomTag)
+      : _is_bottom(true), _is_normalized(true), _potential(1, Number(0)) {}
+
+public:
+  /// \brief Create the top abstract value
+  SplitDBM() : SplitDBM(TopTag{}) {}
+
+  /// \brief Copy constructor
+  SplitDBM(const SplitDBM&) = default;
+
+  /// \brief Move constructor
+  SplitDBM(SplitDBM&&) = default;
+
+  /// \brief Copy assignment operator
+  SplitDBM& operator=(const SplitDBM&) = default;
+
+  /// \brief Move assignment operator
+  SplitDBM& operator=(SplitDBM&&) = default;
+
+  /// \brief Destructor
+  ~SplitDBM() override = default;
+
+  /// \brief Create the top abstract value
+  static SplitDBM top() { return SplitDBM(TopTag{}); }
+
+  /// \brief Create the bottom abstract value
+  static SplitDBM bottom() { return SplitDBM(BottomTag{}); }
+
+private:
+  /// \brief Return the weight of the shortest path i -> j, or +oo
+  ///
+  /// Requires normalization.
+  BoundT path_weight(VertexIndex i, VertexIndex j) const {
+    if (i == j) {
+      return BoundT(0);
+    } else if (i == 0 || j == 0) {
+      return this->_graph.weight(i, j);
+    } else {
+      return min(this->_graph.weight(i, j),
+                 this->_graph.weight(i, 0) + this->_graph.weight(0, j));
+    }
+  }
+
+  /// \brief Return true if the edge i -> j of weight w is implied by the
+  /// bounds of i and j
+  bool is_implied_by_bounds(VertexIndex i,
+                            VertexIndex j,
+                            const Number& w) const {
+    return this->_graph.weight(i, 0) + this->_graph.weight(0, j) <= BoundT(w);
+  }
+
+  /// \brief Compute the closure of the graph
+  ///
+  /// The edges between variables are closed using Dijkstra's algorithm from
+  /// each vertex, on the reduced costs given by the potential function. This
+  /// is O(n * m * log(n)) for n vertices and m edges, instead of O(n^3).
+  /// Paths through the vertex 0 are only used to close the bounds.
+  void close() {
+    using Item = std::pair< Number, VertexIndex >;
+
+    const VertexIndex n = this->_graph.num_vertices();
+    const std::vector< Number >& pi = this->_potential;
+
+    // 0 if not reached, 1 if reached, 2 if the distance is final
+    std::vector< unsigned char > state(n, 0);
+    std::vector< VertexIndex > reached;
+    std::vector< std::pair< VertexIndex, Number > > paths;
+
+    for (VertexIndex s = 1; s < n; s++) {
+      if (this->_graph.succs(s).empty()) {
+        continue;
+      }
+
+      std::priority_queue< Item, std::vector< Item >, std::greater< Item > >
+          queue;
+      queue.emplace(Number(0), s);
+      state[s] = 1;
+      reached.push_back(s);
+
+      while (!queue.empty()) {
+        Item item = queue.top();
+        queue.pop();
+        const Number& dist = item.first;
+        VertexIndex u = item.second;
+
+        if (state[u] == 2) {
+          continue;
+        }
+        state[u] = 2;
+
+        if (u != s) {
+          // Convert the reduced distance back into a path weight
+          paths.emplace_back(u, dist - pi[s] + pi[u]);
+        }
+
+        for (const auto& edge : this->_graph.succs(u)) {
+          VertexIndex v = edge.first;
+          if (v == 0 || state[v] == 2) {
+            continue;
+          }
+          if (state[v] == 0) {
+            state[v] = 1;
+            reached.push_back(v);
+          }
+          queue.emplace(dist + edge.second + pi[u] - pi[v], v);
+        }
+      }
+
+      for (VertexIndex v : reached) {
+        state[v] = 0;
+      }
+      reached.clear();
+
+      for (const auto& path : paths) {
+        if (!this->is_implied_by_bounds(s, path.first, path.second)) {
+          this->_graph.update_edge(s, path.first, path.second);
+        }
+      }
+      paths.clear();
+    }
+
+    // Close the bounds. Since the edges between variables are closed, one
+    // pass is enough.
+    for (VertexIndex u = 1; u < n; u++) {
+      BoundT ub = this->_graph.weight(0, u);
+      if (!ub.is_plus_infinity()) {
+        for (const auto& edge : this->_graph.succs(u)) {
+          if (edge.first != 0) {
+            this->_graph.update_edge(0, edge.first, *ub.number() + edge.second);
+          }
+        }
+      }
+
+      BoundT lb = this->_graph.weight(u, 0);
+      if (!lb.is_plus_infinity()) {
+        for (const auto& edge : this->_graph.preds(u)) {
+          if (edge.first != 0) {
+            this->_graph.update_edge(edge.first, 0, edge.second + *lb.number());
+          }
+        }
+      }
+    }
+  }
+
+public:
+  /// \brief Normalize the graph
+  void normalize() const override {
+    if (this->_is_normalized) {
+      return;
+    }
+
+    auto self = const_cast< SplitDBM* >(this);
+
+    if (!this->_is_bottom) {
+      // The potential function is always valid, so there is no negative cycle
+      self->close();
+    }
+
+    self->_is_normalized = true;
+  }
+
+  bool is_bottom() const override {
+    // Does not require normalization, negative cycles are detected eagerly
+    return this->_is_bottom;
+  }
+
+  bool is_top() const override {
+    // Does not require normalization
+    return !this->_is_bottom && this->_graph.has_no_edge();
+  }
+
+  void set_to_bottom() override {
+    this->_is_bottom = true;
+    this->_is_normalized = true;
+    this->_graph.clear();
+    this->_var_index_map.clear();
+    this->_potential.assign(1, Number(0));
+  }
+
+  void set_to_top() override {
+    this->_is_bottom = false;
+    this->_is_normalized = true;
+    this->_graph.clear();
+    this->_var_index_map.clear();
+    this->_potential.assign(1, Number(0));
+  }
+
+private:
+  /// \brief Marker for an invalid vertex
+  static constexpr VertexIndex none() {
+    return std::numeric_limits< VertexIndex >::max();
+  }
+
+  /// \brief Return the mapping from the vertices of `other` to the vertices
+  /// of `this`, or none()
+  std::vector< VertexIndex > vertex_map(const SplitDBM& other) const {
+    std::vector< VertexIndex > map(other._graph.num_vertices(), none());
+    map[0] = 0;
+
+    for (auto l = this->_var_index_map.begin(),
+              r = other._var_index_map.begin();
+         l != this->_var_index_map.end() && r != other._var_index_map.end();) {
+      if (l->first < r->first) {
+        ++l;
+      } else if (r->first < l->first) {
+        ++r;
+      } else {
+        map[r->second] = l->second;
+        ++l;
+        ++r;
+      }
+    }
+
+    return map;
+  }
+
+public:
+  bool leq(const SplitDBM& other) const override {
+    // Requires normalization
+    this->normalize();
+    other.normalize();
+
+    if (this->_is_bottom) {
+      return true;
+    } else if (other._is_bottom) {
+      return false;
+    }
+
+    // Edges of `other` implied by its bounds are implied by the bounds of
+    // `this`, if the bounds are included. Hence, it is enough to check the
+    // explicit edges of `other`.
+    std::vector< VertexIndex > map = this->vertex_map(other);
+
+    for (VertexIndex r = 0; r < other._graph.num_vertices(); r++) {
+      for (const auto& edge : other._graph.succs(r)) {
+        VertexIndex i = map[r];
+        VertexIndex j = map[edge.first];
+
+        if (i == none() || j == none() ||
+            !(this->path_weight(i, j) <= BoundT(edge.second))) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  bool equals(const SplitDBM& other) const override {
+    return this->leq(other) && other.leq(*this);
+  }
+
+private:
+  /// \brief Pair of vertices in `this` and `other` for each common variable
+  ///
+  /// The result vertex of the variable at index k is k + 1.
+  using VertexPairs = std::vector< std::pair< VertexIndex, VertexIndex > >;
+
+  /// \brief Create a value with a vertex for each variable both in `this`
+  /// and `other`, and return the pairs of vertices
+  SplitDBM common_vertices(const SplitDBM& other, VertexPairs& vertices) const {
+    SplitDBM result;
+    vertices.clear();
+    vertices.emplace_back(0, 0);
+
+    for (auto l = this->_var_index_map.begin(),
+              r = other._var_index_map.begin();
+         l != this->_var_index_map.end() && r != other._var_index_map.end();) {
+      if (l->first < r->first) {
+        ++l;
+      } else if (r->first < l->first) {
+        ++r;
+      } else {
+        VertexIndex k = result._graph.add_vertex();
+        ikos_assert(k == vertices.size());
+        result._var_index_map.emplace_hint(result._var_index_map.end(),
+                                           l->first,
+                                           k);
+        vertices.emplace_back(l->second, r->second);
+        ++l;
+        ++r;
+      }
+    }
+
+    // The potential of `this` satisfies all the constraints of `this`, hence
+    // all the constraints of a result weaker than `this`.
+    result._potential.clear();
+    result._potential.reserve(vertices.size());
+    for (const auto& p : vertices) {
+      result._potential.push_back(this->_potential[p.first]);
+    }
+
+    return result;
+  }
+
+  /// \brief Apply a binary operator on the weights of the edges of `this`
+  ///
+  /// For each edge i -> j of `this`, between common variables, `op` is called
+  /// with the weight of the edge and the weight of the shortest path in
+  /// `other`, and returns the new weight. Other edges are removed.
+  ///
+  /// The result is not normalized.
+  template < typename BinaryOperator >
+  SplitDBM left_binary_op(const SplitDBM& other,
+                          const BinaryOperator& op) const {
+    VertexPairs vertices;
+    SplitDBM result = this->common_vertices(other, vertices);
+
+    std::vector< VertexIndex > map(this->_graph.num_vertices(), none());
+    for (VertexIndex k = 0; k < vertices.size(); k++) {
+      map[vertices[k].first] = k;
+    }
+
+    for (VertexIndex k = 0; k < vertices.size(); k++) {
+      for (const auto& edge : this->_graph.succs(vertices[k].first)) {
+        VertexIndex l = map[edge.first];
+        if (l == none()) {
+          continue;
+        }
+
+        BoundT w = op(BoundT(edge.second),
+                      other.path_weight(vertices[k].second,
+                                        vertices[l].second));
+        if (!w.is_plus_infinity()) {
+          result._graph.set_edge(k, l, *w.number());
+        }
+      }
+    }
+
+    result._is_normalized = false;
+    return result;
+  }
+
+  struct WideningOperator {
+    BoundT operator()(const BoundT& x, const BoundT& y) const {
+      if (y <= x) {
+        return x;
+      } else {
+        return BoundT::plus_infinity();
+      }
+    }
+  };
+
+  struct WideningThresholdOperator {
+    BoundT threshold;
+
+    explicit WideningThresholdOperator(const Number& threshold_)
+        : threshold(threshold_) {}
+
+    BoundT operator()(const BoundT& x, const BoundT& y) const {
+      if (y <= x) {
+        return x;
+      } else if (threshold >= y) {
+        return threshold;
+      } else {
+        return BoundT::plus_infinity();
+      }
+    }
+  };
+
+public:
+  SplitDBM join(const SplitDBM& other) const override {
+    // Requires normalization
+    this->normalize();
+    other.normalize();
+
+    if (this->_is_bottom) {
+      return other;
+    } else if (other._is_bottom) {
+      return *this;
+    }
+
+    VertexPairs vertices;
+    SplitDBM result = this->common_vertices(other, vertices);
+
+    std::vector< VertexIndex > this_map(this->_graph.num_vertices(), none());
+    std::vector< VertexIndex > other_map(other._graph.num_vertices(), none());
+    for (VertexIndex k = 0; k < vertices.size(); k++) {
+      this_map[vertices[k].first] = k;
+      other_map[vertices[k].second] = k;
+    }
+
+    // An edge of the result is the maximum of the shortest paths. It is only
+    // finite if there is an explicit edge on one side, or both bounds on
+    // both sides. In the latter case, the edge is mostly implied by the new
+    // bounds, and it is ignored.
+    auto join_edge = [&](VertexIndex k, VertexIndex l) {
+      BoundT w = max(this->path_weight(vertices[k].first, vertices[l].first),
+                     other.path_weight(vertices[k].second, vertices[l].second));
+      if (!w.is_plus_infinity()) {
+        result._graph.set_edge(k, l, *w.number());
+      }
+    };
+
+    for (VertexIndex k = 0; k < vertices.size(); k++) {
+      for (const auto& edge : this->_graph.succs(vertices[k].first)) {
+        VertexIndex l = this_map[edge.first];
+        if (l != none()) {
+          join_edge(k, l);
+        }
+      }
+      for (const auto& edge : other._graph.succs(vertices[k].second)) {
+        VertexIndex l = other_map[edge.first];
+        if (l != none() && result._graph.weight(k, l).is_plus_infinity()) {
+          join_edge(k, l);
+        }
+      }
+    }
+
+    // Remove edges implied by the new bounds
+    for (VertexIndex k = 1; k < vertices.size(); k++) {
+      std::vector< VertexIndex > implied;
+      for (const auto& edge : result._graph.succs(k)) {
+        if (edge.first != 0 &&
+            result.is_implied_by_bounds(k, edge.first, edge.second)) {
+          implied.push_back(edge.first);
+        }
+      }
+      for (VertexIndex l : implied) {
+        result._graph.remove_edge(k, l);
+      }
+    }
+
+    // The join of closed graphs is closed, but an edge implied by the bounds
+    // on both sides might be tighter than the new bounds.
+    result._is_normalized = false;
+    return result;
+  }
+
+  void join_with(const SplitDBM& other) override {
+    this->operator=(this->join(other));
+  }
+
+  SplitDBM widening(const SplitDBM& other) const override {
+    // Requires the normalization of the right operand.
+    // The left operand (this) should not be normalized.
+    other.normalize();
+
+    if (this->_is_bottom) {
+      return other;
+    } else if (other._is_bottom) {
+      return *this;
+    } else {
+      return this->left_binary_op(other, WideningOperator{});
+    }
+  }
+
+  void widen_with(const SplitDBM& other) override {
+    this->operator=(this->widening(other));
+  }
+
+  SplitDBM widening_threshold(const SplitDBM& other,
+                              const Number& threshold) const override {
+    // Requires the normalization of the right operand.
+    // The left operand (this) should not be normalized.
+    other.normalize();
+
+    if (this->_is_bottom) {
+      return other;
+    } else if (other._is_bottom) {
+      return *this;
+    } else {
+      return this->left_binary_op(other,
+                                  WideningThresholdOperator{threshold});
+    }
+  }
+
+  void widen_threshold_with(const SplitDBM& other,
+                            const Number& threshold) override {
+    this->operator=(this->widening_threshold(other, threshold));
+  }
+
+private:
+  /// \brief Add the edges of `other` into `this`
+  ///
+  /// If `only_unbounded` is true, only add an edge if the shortest path is
+  /// +oo in `this`.
+  void add_edges(const SplitDBM& other, bool only_unbounded) {
+    std::vector< VertexIndex > map(other._graph.num_vertices(), none());
+    map[0] = 0;
+    for (const auto& p : other._var_index_map) {
+      map[p.second] = this->var_index(p.first);
+    }
+
+    for (VertexIndex r = 0; r < other._graph.num_vertices(); r++) {
+      for (const auto& edge : other._graph.succs(r)) {
+        VertexIndex i = map[r];
+        VertexIndex j = map[edge.first];
+
+        if (!only_unbounded || this->path_weight(i, j).is_plus_infinity()) {
+          this->add_edge(i, j, edge.second);
+        }
+
+        if (this->_is_bottom) {
+          return;
+        }
+      }
+    }
+  }
+
+public:
+  SplitDBM meet(const SplitDBM& other) const override {
+    // Requires normalization
+    this->normalize();
+    other.normalize();
+
+    if (this->_is_bottom || other._is_bottom) {
+      return bottom();
+    } else {
+      SplitDBM result(*this);
+      result.add_edges(other, /*only_unbounded=*/false);
+      return result;
+    }
+  }
+
+  void meet_with(const SplitDBM& other) override {
+    this->operator=(this->meet(other));
+  }
+
+  SplitDBM narrowing(const SplitDBM& other) const override {
+    // Requires normalization
+    this->normalize();
+    other.normalize();
+
+    if (this->_is_bottom || other._is_bottom) {
+      return bottom();
+    } else {
+      SplitDBM result(*this);
+      result.add_edges(other, /*only_unbounded=*/true);
+      return result;
+    }
+  }
+
+  void narrow_with(const SplitDBM& other) override {
+    this->operator=(this->narrowing(other));
+  }
+
+private:
+  /// \brief Get the vertex of variable x
+  ///
+  /// Create a new one if not found
+  VertexIndex var_index(VariableRef x) {
+    auto it = this->_var_index_map.find(x);
+    if (it != this->_var_index_map.end()) {
+      return it->second;
+    }
+
+    VertexIndex i = this->_graph.add_vertex();
+    if (i >= this->_potential.size()) {
+      this->_potential.resize(i + 1);
+    }
+    this->_potential[i] = this->_potential[0];
+    this->_var_index_map.emplace(x, i);
+    return i;
+  }
+
+  /// \brief Update the potential function after adding v_j - v_i <= c
+  ///
+  /// The new potential of a vertex k is min(pi(k), pi(i) + c + d(j, k)),
+  /// where d(j, k) is the shortest path from j to k. This requires no
+  /// negative cycle through the new edge.
+  void update_potential(VertexIndex i, VertexIndex j, const Number& c) {
+    if (this->_potential[j] - this->_potential[i] <= c) {
+      return;
+    }
+
+    const Number base = this->_potential[i] + c;
+    this->_potential[j] = base;
+
+    if (!this->_graph.weight(j, 0).is_plus_infinity()) {
+      // Any vertex might be reachable through the vertex 0
+      for (VertexIndex k = 0; k < this->_graph.num_vertices(); k++) {
+        BoundT w = this->path_weight(j, k);
+        if (k != j && !w.is_plus_infinity()) {
+          Number p = base + *w.number();
+          if (p < this->_potential[k]) {
+            this->_potential[k] = p;
+          }
+        }
+      }
+    } else {
+      for (const auto& edge : this->_graph.succs(j)) {
+        Number p = base + edge.second;
+        if (p < this->_potential[edge.first]) {
+          this->_potential[edge.first] = p;
+        }
+      }
+    }
+  }
+
+  /// \brief Add the constraint v_j - v_i <= c, i.e the edge i -> j
+  ///
+  /// Requires normalization, and keeps the graph normalized. This is
+  /// O(|preds(i)| * |succs(j)|), instead of a full closure.
+  void add_edge(VertexIndex i, VertexIndex j, const Number& c) {
+    ikos_assert(this->_is_normalized);
+
+    if (this->_is_bottom) {
+      return;
+    }
+
+    if (i == j) {
+      if (c < Number(0)) {
+        this->set_to_bottom();
+      }
+      return;
+    }
+
+    if (this->path_weight(i, j) <= BoundT(c)) {
+      return; // Already implied
+    }
+
+    // Check for a negative cycle. Since the graph is closed, the shortest
+    // path from j to i is known.
+    if (BoundT(c) + this->path_weight(j, i) < BoundT(0)) {
+      this->set_to_bottom();
+      return;
+    }
+
+    this->update_potential(i, j, c);
+
+    // Any new shortest path is k -> i -> j -> l, where k -> i and j -> l are
+    // explicit edges, or paths through the vertex 0.
+    std::vector< std::pair< VertexIndex, Number > > srcs;
+    std::vector< std::pair< VertexIndex, Number > > dsts;
+    if (i != 0) {
+      srcs.emplace_back(i, Number(0));
+      for (const auto& edge : this->_graph.preds(i)) {
+        if (edge.first != 0) {
+          srcs.push_back(edge);
+        }
+      }
+    }
+    if (j != 0) {
+      dsts.emplace_back(j, Number(0));
+      for (const auto& edge : this->_graph.succs(j)) {
+        if (edge.first != 0) {
+          dsts.push_back(edge);
+        }
+      }
+    }
+
+    // Update the bounds first
+    BoundT ub_i = this->path_weight(0, i);
+    if (!ub_i.is_plus_infinity()) {
+      Number w = *ub_i.number() + c;
+      for (const auto& dst : dsts) {
+        this->_graph.update_edge(0, dst.first, w + dst.second);
+      }
+    }
+    BoundT lb_j = this->path_weight(j, 0);
+    if (!lb_j.is_plus_infinity()) {
+      Number w = c + *lb_j.number();
+      for (const auto& src : srcs) {
+        this->_graph.update_edge(src.first, 0, src.second + w);
+      }
+    }
+
+    // Then the edges between variables, unless implied by the bounds
+    for (const auto& src : srcs) {
+      for (const auto& dst : dsts) {
+        if (src.first != dst.first) {
+          Number w = src.second + c + dst.second;
+          if (!this->is_implied_by_bounds(src.first, dst.first, w)) {
+            this->_graph.update_edge(src.first, dst.first, w);
+          }
+        }
+      }
+    }
+  }
+
+  /// \brief Add the constraint v_i - v_j <= c
+  void add_constraint(VertexIndex i, VertexIndex j, const BoundT& c) {
+    if (c.is_plus_infinity()) {
+      return;
+    } else if (c.is_minus_infinity()) {
+      this->set_to_bottom();
+      return;
+    }
+
+    this->normalize();
+    this->add_edge(j, i, *c.number());
+  }
+
+  /// \brief Add the constraint v_i - v_j <= c
+  void add_constraint(VertexIndex i, VertexIndex j, const Number& c) {
+    this->normalize();
+    this->add_edge(j, i, c);
+  }
+
+  /// \brief Add the constraint v_i - v_j <= c
+  void add_constraint(VertexIndex i, VertexIndex j, int c) {
+    this->add_constraint(i, j, Number(c));
+  }
+
+  /// \brief Forget all informations about the vertex i
+  void forget_vertex(VertexIndex i) {
+    // Removing a vertex from a closed graph keeps it closed
+    this->normalize();
+    this->_graph.remove_edges(i);
+  }
+
+  /// \brief Apply v_i = v_j + c, for i != j
+  void assign_shift(VertexIndex i, VertexIndex j, const Number& c) {
+    this->forget_vertex(i);
+
+    if (this->_is_bottom) {
+      return;
+    }
+
+    // v_i gets the constraints of v_j, shifted by c, which keeps the graph
+    // closed. Edges k -> i and i -> k implied by the bounds are still
+    // implied, since the bounds are shifted as well.
+    std::vector< std::pair< VertexIndex, Number > > succs(
+        this->_graph.succs(j).begin(), this->_graph.succs(j).end());
+    std::vector< std::pair< VertexIndex, Number > > preds(
+        this->_graph.preds(j).begin(), this->_graph.preds(j).end());
+
+    for (const auto& edge : succs) {
+      this->_graph.set_edge(i, edge.first, edge.second - c);
+    }
+    for (const auto& edge : preds) {
+      this->_graph.set_edge(edge.first, i, edge.second + c);
+    }
+    if (!this->is_implied_by_bounds(j, i, c)) {
+      this->_graph.set_edge(j, i, c);
+    }
+    if (!this->is_implied_by_bounds(i, j, -c)) {
+      this->_graph.set_edge(i, j, -c);
+    }
+    this->_potential[i] = this->_potential[j] + c;
+  }
+
+  /// \brief Apply v_i = v_i + c
+  void increment(VertexIndex i, const Number& c) {
+    if (c == Number(0)) {
+      return;
+    }
+
+    // Shifting a variable preserves the normalization
+    std::vector< std::pair< VertexIndex, Number > > succs(
+        this->_graph.succs(i).begin(), this->_graph.succs(i).end());
+    std::vector< std::pair< VertexIndex, Number > > preds(
+        this->_graph.preds(i).begin(), this->_graph.preds(i).end());
+
+    for (const auto& edge : succs) {
+      this->_graph.set_edge(i, edge.first, edge.second - c);
+    }
+    for (const auto& edge : preds) {
+      this->_graph.set_edge(edge.first, i, edge.second + c);
+    }
+    this->_potential[i] += c;
+  }
+
+  /// \brief Apply v_i = [lb, ub], after forgetting v_i
+  void set_bounds(VertexIndex i, const IntervalT& value) {
+    ikos_assert(!value.is_bottom());
+    ikos_assert(this->_graph.is_isolated(i));
+
+    if (!value.ub().is_plus_infinity()) {
+      this->_graph.set_edge(0, i, *value.ub().number());
+    }
+    if (!value.lb().is_minus_infinity()) {
+      this->_graph.set_edge(i, 0, -*value.lb().number());
+    }
+
+    if (!value.lb().is_minus_infinity()) {
+      this->_potential[i] = this->_potential[0] + *value.lb().number();
+    } else if (!value.ub().is_plus_infinity()) {
+      this->_potential[i] = this->_potential[0] + *value.ub().number();
+    } else {
+      this->_potential[i] = this->_potential[0];
+    }
+  }
+
+public:
+  void assign(VariableRef x, int n) override { this->assign(x, Number(n)); }
+
+  void assign(VariableRef x, const Number& n) override {
+    if (this->_is_bottom) {
+      return;
+    }
+
+    VertexIndex i = this->var_index(x);
+    this->forget_vertex(i);
+    this->set_bounds(i, IntervalT(n));
+  }
+
+  void assign(VariableRef x, VariableRef y) override {
+    if (this->_is_bottom) {
+      return;
+    }
+
+    if (x == y) {
+      return;
+    }
+
+    VertexIndex i = this->var_index(x);
+    VertexIndex j = this->var_index(y);
+    this->assign_shift(i, j, Number(0));
+  }
+
+  void assign(VariableRef x, const LinearExpressionT& e) override {
+    if (this->_is_bottom) {
+      return;
+    }
+
+    if (e.is_constant()) { // x = c
+      this->assign(x, e.constant());
+      return;
+    }
+
+    if (e.num_terms() == 1 && e.begin()->second == 1) { // x = y + c
+      VertexIndex i = this->var_index(x);
+      VariableRef y = e.begin()->first;
+      const Number& c = e.constant();
+
+      if (x == y) { // x = x + c
+        this->increment(i, c);
+      } else {
+        VertexIndex j = this->var_index(y);
+        this->assign_shift(i, j, c);
+      }
+      return;
+    }
+
+    // Projection using intervals, requires normalization
+    this->normalize();
+
+    if (this->_is_bottom) {
+      return;
+    }
+
+    this->set(x, this->to_interval(e));
+  }
+
+  void apply(BinaryOperator op,
+             VariableRef x,
+             VariableRef y,
+             VariableRef z) override {
+    // Requires normalization
+    this->normalize();
+
+    if (this->_is_bottom) {
+      return;
+    }
+
+    IntervalT v_y = this->to_interval(y);
+    IntervalT v_z = this->to_interval(z);
+
+    if (v_z.singleton()) {
+      this->apply(op, x, y, *v_z.singleton());
+    } else if (v_y.singleton()) {
+      this->apply(op, x, *v_y.singleton(), z);
+    } else {
+      this->set(x, apply_bin_operator(op, v_y, v_z));
+    }
+  }
+
+  void apply(BinaryOperator op,
+             VariableRef x,
+             VariableRef y,
+             const Number& z) override {
+    if (this->_is_bottom) {
+      return;
+    }
+
+    switch (op) {
+      case BinaryOperator::Add: {
+        VertexIndex i = this->var_index(x);
+        if (x == y) { // x = x + z
+          this->increment(i, z);
+        } else { // x = y + z
+          VertexIndex j = this->var_index(y);
+          this->assign_shift(i, j, z);
+        }
+      } break;
+      case BinaryOperator::Sub: {
+        VertexIndex i = this->var_index(x);
+        if (x == y) { // x = x - z
+          this->increment(i, -z);
+        } else { // x = y - z
+          VertexIndex j = this->var_index(y);
+          this->assign_shift(i, j, -z);
+        }
+      } break;
+      case BinaryOperator::Mul: {
+        if (z == 1) { // x = y
+          this->assign(x, y);
+        } else {
+          // Requires normalization
+          this->normalize();
+
+          if (this->_is_bottom) {
+            return;
+          }
+
+          this->set(x, this->to_interval(y) * IntervalT(z));
+        }
+      } break;
+      case BinaryOperator::Div: {
+        if (z == 1) { // x = y
+          this->assign(x, y);
+        } else {
+          // Requires normalization
+          this->normalize();
+
+          if (this->_is_bottom) {
+            return;
+          }
+
+          this->set(x, this->to_interval(y) / IntervalT(z));
+        }
+      } break;
+      case BinaryOperator::Mod: {
+        if (z == 0) {
+          this->set_to_bottom();
+          return;
+        }
+
+        // Requires normalization
+        this->normalize();
+
+        if (this->_is_bottom) {
+          return;
+        }
+
+        IntervalT v_y = this->to_interval(y);
+        boost::optional< Number > n = v_y.mod_to_sub(z);
+
+        if (n) {
+          // Equivalent to x = y - n
+          VertexIndex i = this->var_index(x);
+          if (x == y) { // x = x - n
+            this->increment(i, -(*n));
+          } else { // x = y - n
+            VertexIndex j = this->var_index(y);
+            this->assign_shift(i, j, -(*n));
+          }
+        } else {
+          this->set(x, IntervalT(BoundT(0), BoundT(abs(z) - 1)));
+        }
+      } break;
+      case BinaryOperator::Rem:
+      case BinaryOperator::Shl:
+      case BinaryOperator::Shr:
+      case BinaryOperator::And:
+      case BinaryOperator::Or:
+      case BinaryOperator::Xor: {
+        // Requires normalization
+        this->normalize();
+
+        if (this->_is_bottom) {
+          return;
+        }
+
+        this->set(x,
+                  apply_bin_operator(op, this->to_interval(y), IntervalT(z)));
+      } break;
+    }
+  }
+
+  void apply(BinaryOperator op,
+             VariableRef x,
+             const Number& y,
+             VariableRef z) override {
+    if (this->_is_bottom) {
+      return;
+    }
+
+    switch (op) {
+      case BinaryOperator::Add: {
+        VertexIndex i = this->var_index(x);
+        if (x == z) { // x = y + x
+          this->increment(i, y);
+        } else { // x = y + z
+          VertexIndex j = this->var_index(z);
+          this->assign_shift(i, j, y);
+        }
+      } break;
+      case BinaryOperator::Sub: {
+        // Requires normalization
+        this->normalize();
+
+        if (this->_is_bottom) {
+          return;
+        }
+
+        this->set(x, IntervalT(y) - this->to_interval(z));
+      } break;
+      case BinaryOperator::Mul: {
+        if (y == 1) { // x = z
+          this->assign(x, z);
+        } else {
+          // Requires normalization
+          this->normalize();
+
+          if (this->_is_bottom) {
+            return;
+          }
+
+          this->set(x, IntervalT(y) * this->to_interval(z));
+        }
+      } break;
+      case BinaryOperator::Div:
+      case BinaryOperator::Rem:
+      case BinaryOperator::Mod:
+      case BinaryOperator::Shl:
+      case BinaryOperator::Shr:
+      case BinaryOperator::And:
+      case BinaryOperator::Or:
+      case BinaryOperator::Xor: {
+        // Requires normalization
+        this->normalize();
+
+        if (this->_is_bottom) {
+          return;
+        }
+
+        this->set(x,
+                  apply_bin_operator(op, IntervalT(y), this->to_interval(z)));
+      } break;
+    }
+  }
+
+private:
+  /// \brief Return the vertices (i, j) if the constraint is v_i - v_j <= c
+  boost::optional< std::pair< VertexIndex, VertexIndex > > difference(
+      const LinearConstraintT& cst) {
+    auto it = cst.begin();
+    auto it2 = ++cst.begin();
+
+    if (cst.num_terms() == 1 && it->second == 1) {
+      return std::make_pair(this->var_index(it->first), VertexIndex(0));
+    } else if (cst.num_terms() == 1 && it->second == -1) {
+      return std::make_pair(VertexIndex(0), this->var_index(it->first));
+    } else if (cst.num_terms() == 2 && it->second == 1 && it2->second == -1) {
+      return std::make_pair(this->var_index(it->first),
+                            this->var_index(it2->first));
+    } else if (cst.num_terms() == 2 && it->second == -1 && it2->second == 1) {
+      return std::make_pair(this->var_index(it2->first),
+                            this->var_index(it->first));
+    } else {
+      return boost::none;
+    }
+  }
+
+public:
+  void add(const LinearConstraintT& cst) override {
+    if (this->_is_bottom) {
+      return;
+    }
+
+    if (cst.num_terms() == 0) {
+      if (cst.is_contradiction()) {
+        this->set_to_bottom();
+      }
+      return;
+    }
+
+    if (cst.is_inequality() || cst.is_equality()) {
+      if (auto ij = this->difference(cst)) {
+        const Number& c = cst.constant();
+        this->add_constraint(ij->first, ij->second, c);
+        if (cst.is_equality()) {
+          this->add_constraint(ij->second, ij->first, -c);
+        }
+        return;
+      }
+    }
+
+    // use the linear interval solver
+    this->normalize();
+
+    if (this->_is_bottom) {
+      return;
+    }
+
+    LinearIntervalSolverT solver(MaxReductionCycles);
+    solver.add(cst);
+    solver.run(*this);
+  }
+
+  void add(const LinearConstraintSystemT& csts) override {
+    if (this->_is_bottom) {
+      return;
+    }
+
+    LinearIntervalSolverT solver(MaxReductionCycles);
+
+    for (const LinearConstraintT& cst : csts) {
+      // process each constraint
+      if (cst.num_terms() == 0) {
+        if (cst.is_contradiction()) {
+          this->set_to_bottom();
+          return;
+        }
+      } else if (cst.is_inequality() || cst.is_equality()) {
+        if (auto ij = this->difference(cst)) {
+          const Number& c = cst.constant();
+          this->add_constraint(ij->first, ij->second, c);
+          if (cst.is_equality()) {
+            this->add_constraint(ij->second, ij->first, -c);
+          }
+        } else {
+          solver.add(cst);
+        }
+      } else {
+        solver.add(cst);
+      }
+    }
+
+    if (!solver.empty()) {
+      // use the linear interval solver
+      this->normalize();
+
+      if (this->_is_bottom) {
+        return;
+      }
+
+      solver.run(*this);
+    }
+  }
+
+  void set(VariableRef x, const IntervalT& value) override {
+    if (this->_is_bottom) {
+      return;
+    } else if (value.is_bottom()) {
+      this->set_to_bottom();
+    } else {
+      VertexIndex i = this->var_index(x);
+      this->forget_vertex(i);
+      this->set_bounds(i, value);
+    }
+  }
+
+  void set(VariableRef x, const CongruenceT& value) override {
+    if (this->_is_bottom) {
+      return;
+    } else if (value.is_bottom()) {
+      this->set_to_bottom();
+    } else {
+      VertexIndex i = this->var_index(x);
+      this->forget_vertex(i);
+      boost::optional< Number > n = value.singleton();
+      if (n) {
+        this->set_bounds(i, IntervalT(*n));
+      }
+    }
+  }
+
+  void set(VariableRef x, const IntervalCongruenceT& value) override {
+    this->set(x, value.interval());
+  }
+
+  void refine(VariableRef x, const IntervalT& value) override {
+    if (this->_is_bottom) {
+      return;
+    } else if (value.is_bottom()) {
+      this->set_to_bottom();
+    } else {
+      VertexIndex i = this->var_index(x);
+      this->add_constraint(i, 0, value.ub());
+      this->add_constraint(0, i, -value.lb());
+    }
+  }
+
+  void refine(VariableRef x, const CongruenceT& value) override {
+    if (this->_is_bottom) {
+      return;
+    } else if (value.is_bottom()) {
+      this->set_to_bottom();
+    } else {
+      IntervalCongruenceT iv(this->to_interval(x), value);
+      this->refine(x, iv.interval());
+    }
+  }
+
+  void refine(VariableRef x, const IntervalCongruenceT& value) override {
+    if (this->_is_bottom) {
+      return;
+    } else if (value.is_bottom()) {
+      this->set_to_bottom();
+    } else {
+      IntervalCongruenceT iv(this->to_interval(x));
+      iv.meet_with(value);
+      this->refine(x, iv.interval());
+    }
+  }
+
+  void forget(VariableRef x) override {
+    if (this->_is_bottom) {
+      return;
+    }
+
+    auto it = this->_var_index_map.find(x);
+    if (it != this->_var_index_map.end()) {
+      this->forget_vertex(it->second);
+      this->_graph.remove_vertex(it->second);
+      this->_var_index_map.erase(it);
+    }
+  }
+
+  IntervalT to_interval(VariableRef x) const override {
+    if (this->_is_bottom) {
+      return IntervalT::bottom();
+    }
+
+    auto it = this->_var_index_map.find(x);
+    if (it == this->_var_index_map.end()) {
+      return IntervalT::top();
+    }
+
+    // Requires normalization
+    this->normalize();
+    return IntervalT(-this->_graph.weight(it->second, 0),
+                     this->_graph.weight(0, it->second));
+  }
+
+  IntervalT to_interval(const LinearExpressionT& e) const override {
+    // TODO(marthaud): provide a better result for e = x - y
+    return Parent::to_interval(e);
+  }
+
+  CongruenceT to_congruence(VariableRef x) const override {
+    if (this->_is_bottom) {
+      return CongruenceT::bottom();
+    } else {
+      boost::optional< Number > n = this->to_interval(x).singleton();
+      if (n) {
+        return CongruenceT(*n);
+      } else {
+        return CongruenceT::top();
+      }
+    }
+  }
+
+  CongruenceT to_congruence(const LinearExpressionT& e) const override {
+    return Parent::to_congruence(e);
+  }
+
+  IntervalCongruenceT to_interval_congruence(VariableRef x) const override {
+    return IntervalCongruenceT(this->to_interval(x));
+  }
+
+  IntervalCongruenceT to_interval_congruence(
+      const LinearExpressionT& e) const override {
+    // TODO(marthaud): provide a better result for e = x - y
+    return Parent::to_interval_congruence(e);
+  }
+
+  LinearConstraintSystemT to_linear_constraint_system() const override {
+    this->normalize();
+
+    if (this->_is_bottom) {
+      return LinearConstraintSystemT(LinearConstraintT::contradiction());
+    }
+
+    std::vector< boost::optional< VariableRef > > vars(
+        this->_graph.num_vertices());
+    for (const auto& p : this->_var_index_map) {
+      vars[p.second] = p.first;
+    }
+
+    LinearConstraintSystemT csts;
+    for (const auto& p : this->_var_index_map) {
+      csts.add(within_interval(p.first,
+                               IntervalT(-this->_graph.weight(p.second, 0),
+                                         this->_graph.weight(0, p.second))));
+    }
+    for (const auto& p : this->_var_index_map) {
+      for (const auto& edge : this->_graph.succs(p.second)) {
+        if (edge.first != 0) {
+          csts.add(VariableExprT(*vars[edge.first]) - VariableExprT(p.first) <=
+                   edge.second);
+        }
+      }
+    }
+
+    return csts;
+  }
+
+  void dump(std::ostream& o) const override {
+    this->to_linear_constraint_system().dump(o);
+  }
+
+  static std::string name() { return "split-dbm"; }
+
+}; // end class SplitDBM
+
+} // end namespace numeric
+} // end namespace core
+} // end namespace ikos
@@ -386,6 +386,10 @@ public:
     return this->_inv.to_linear_constraint_system();
   }
 
+  std::size_t size_in_bytes() const override {
+    return this->_inv.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override { this->_inv.dump(o); }
 
   static std::string name() { return "DBM with variable packing"; }
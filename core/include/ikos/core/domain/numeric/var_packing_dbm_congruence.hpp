@@ -174,8 +174,15 @@ private:
 
     auto& equiv_relation = this->_product.first()._inv._equiv_relation;
 
+    // Collect the roots first, since writing in a shared equivalence relation
+    // copies it
+    std::vector< VariableRef > roots;
     for (const auto& equiv_class : equiv_relation) {
-      this->reduce_equivalence_class(equiv_class.first);
+      roots.push_back(equiv_class.first);
+    }
+
+    for (VariableRef root : roots) {
+      this->reduce_equivalence_class(root);
 
       if (this->_product.first()._inv._is_bottom) {
         // iterators are invalidated, exit
@@ -449,6 +456,10 @@ public:
     return this->_product.to_linear_constraint_system();
   }
 
+  std::size_t size_in_bytes() const override {
+    return this->_product.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override { this->_product.dump(o); }
 
   static std::string name() {
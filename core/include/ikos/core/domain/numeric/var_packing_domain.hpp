@@ -53,16 +53,21 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
+#include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 #include <boost/optional.hpp>
 
 #include <ikos/core/domain/numeric/abstract_domain.hpp>
 #include <ikos/core/semantic/indexable.hpp>
+#include <ikos/core/semantic/numeric/packing.hpp>
 #include <ikos/core/support/assert.hpp>
+#include <ikos/core/support/parallel.hpp>
 #include <ikos/core/value/numeric/congruence.hpp>
 #include <ikos/core/value/numeric/interval.hpp>
 
@@ -131,10 +136,33 @@ private:
   using Parent =
       numeric::AbstractDomain< Number, VariableRef, VarPackingDomain >;
 
+  /// \brief Minimum number of equivalence classes to process them in
+  /// parallel, see Parallel
+  ///
+  /// The join of a pack of two variables takes about 1.2us, so 32 packs take
+  /// about 40us, far above the cost of dispatching the calls to the thread
+  /// pool, below 1us (see test/benchmark/support/parallel.cpp).
+  static const std::size_t ParallelThreshold = 32;
+
   /*
    * Implementation of Union-Find
    */
 
+  /// \brief Return true if `ptr` is the only owner of its object
+  ///
+  /// Only the owner of `ptr` can share the object further, by copying `ptr`.
+  /// Once this returns true, no other thread accesses the object, and it can
+  /// be written in place.
+  template < typename T >
+  static bool unique(const std::shared_ptr< T >& ptr) {
+    if (ptr.use_count() != 1) {
+      return false;
+    }
+    // Synchronize with the release of other owners, in other threads
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+  }
+
   // forward declaration
   class EquivalenceRelation;
 
@@ -174,8 +202,7 @@ private:
 
     /// \brief Copy before a write
     void copy_domain() {
-      // XXX(marthaud): This is not thread safe.
-      if (this->domain.use_count() == 1) {
+      if (unique(this->domain)) {
         return; // copy is unnecessary
       }
       this->domain = std::make_shared< Domain >(*this->domain);
@@ -193,19 +220,44 @@ private:
     using ClassMap =
         std::unordered_map< VariableRef, EquivalenceClass, VariableRefHash >;
 
-  private:
-    // Map from variable to parent
-    ParentMap _parents;
+    /// \brief Parents and classes, shared between copies until written
+    struct Data {
+      // Map from variable to parent
+      ParentMap parents;
+
+      // Map from root variable to equivalence class
+      ClassMap classes;
+    };
 
-    // Map from root variable to equivalence class
-    ClassMap _classes;
+  private:
+    // Copy-on-write storage, null means empty (e.g, after a move)
+    std::shared_ptr< Data > _data;
 
     // Note: We are using at(key) instead of operator[](key) because VariableRef
     // may not have a default constructor
 
+  private:
+    /// \brief Return the storage, for reading
+    const Data& cdata() const {
+      static const Data empty;
+      return this->_data ? *this->_data : empty;
+    }
+
+    /// \brief Return the storage, for writing
+    ///
+    /// Copy the storage first if it is shared with another relation.
+    Data& data() {
+      if (!this->_data) {
+        this->_data = std::make_shared< Data >();
+      } else if (!unique(this->_data)) {
+        this->_data = std::make_shared< Data >(*this->_data);
+      }
+      return *this->_data;
+    }
+
   public:
     /// \brief Create an empty equivalence relation
-    explicit EquivalenceRelation() = default;
+    explicit EquivalenceRelation() : _data(std::make_shared< Data >()) {}
 
     /// \brief Copy constructor
     EquivalenceRelation(const EquivalenceRelation&) = default;
@@ -224,7 +276,8 @@ private:
 
     /// \brief Return true if the equivalence relation contains `v`
     bool contains(VariableRef v) const {
-      return this->_parents.find(v) != this->_parents.end();
+      const ParentMap& parents = this->cdata().parents;
+      return parents.find(v) != parents.end();
     }
 
     /// \brief Create an equivalence class containing the given variable
@@ -232,8 +285,9 @@ private:
     /// Precondition: `v` is not already present in the relation
     void add_equiv_class(VariableRef v) {
       ikos_assert_msg(!this->contains(v), "variable already present");
-      this->_parents.emplace(v, v);
-      this->_classes.emplace(v, EquivalenceClass());
+      Data& data = this->data();
+      data.parents.emplace(v, v);
+      data.classes.emplace(v, EquivalenceClass());
     }
 
     /// \brief Add a variable in an equivalence class
@@ -244,29 +298,46 @@ private:
       ikos_assert_msg(!this->contains(v), "variable already present");
       ikos_assert_msg(this->contains(parent), "variable missing");
 
+      Data& data = this->data();
       VariableRef parent_root = this->find_root_var(parent);
-      EquivalenceClass& parent_class = this->_classes[parent_root];
+      EquivalenceClass& parent_class = data.classes.at(parent_root);
 
       if (parent_class.rank == 0) {
         parent_class.rank++;
       }
-      this->_parents.emplace(v, parent_root);
+      data.parents.emplace(v, parent_root);
     }
 
     /// \brief Find the root of the equivalence class containing `v`
+    ///
+    /// Compress the path, unless the storage is shared. Other relations may
+    /// read a shared storage concurrently, so it is never written.
     VariableRef find_root_var(VariableRef v) {
-      VariableRef& parent = this->_parents.at(v);
+      if (!unique(this->_data)) {
+        // Do not copy the storage for a lookup
+        return this->cfind_root_var(v);
+      }
+
+      return compress_path(this->_data->parents, v);
+    }
+
+  private:
+    /// \brief Find the root of `v` and make it the parent of the variables on
+    /// the path
+    static VariableRef compress_path(ParentMap& parents, VariableRef v) {
+      VariableRef& parent = parents.at(v);
 
       if (parent == v) {
         return v;
       } else {
-        return parent = this->find_root_var(parent);
+        return parent = compress_path(parents, parent);
       }
     }
 
+  public:
     /// \brief Find the root of the equivalence class containing `v`
     VariableRef cfind_root_var(VariableRef v) const {
-      VariableRef parent = this->_parents.at(v);
+      VariableRef parent = this->cdata().parents.at(v);
 
       if (parent == v) {
         return v;
@@ -277,12 +348,13 @@ private:
 
     /// \brief Find the equivalence class containing `v`
     EquivalenceClass& find_equiv_class(VariableRef v) {
-      return this->_classes[this->find_root_var(v)];
+      Data& data = this->data();
+      return data.classes.at(this->find_root_var(v));
     }
 
     /// \brief Find the equivalence class containing `v`
     const EquivalenceClass& cfind_equiv_class(VariableRef v) const {
-      return this->_classes.at(this->cfind_root_var(v));
+      return this->cdata().classes.at(this->cfind_root_var(v));
     }
 
     /// \brief Find the abstract domain containing `v`
@@ -306,8 +378,9 @@ private:
         return false;
       }
 
-      EquivalenceClass& x_class = this->_classes[x_root];
-      EquivalenceClass& y_class = this->_classes[y_root];
+      Data& data = this->data();
+      EquivalenceClass& x_class = data.classes.at(x_root);
+      EquivalenceClass& y_class = data.classes.at(y_root);
 
       // Merge the domains
       DomainPtr merge_domain = std::make_shared< Domain >();
@@ -316,19 +389,19 @@ private:
       *merge_domain = (*x_class.domain).meet(*y_class.domain);
 
       if (x_class.rank > y_class.rank) {
-        this->_parents.at(y_root) = x_root;
+        data.parents.at(y_root) = x_root;
 
         x_class.domain.swap(merge_domain);
-        this->_classes.erase(y_root);
+        data.classes.erase(y_root);
       } else {
-        this->_parents.at(x_root) = y_root;
+        data.parents.at(x_root) = y_root;
 
         if (x_class.rank == y_class.rank) {
           y_class.rank++;
         }
 
         y_class.domain.swap(merge_domain);
-        this->_classes.erase(x_root);
+        data.classes.erase(x_root);
       }
 
       return true;
@@ -345,19 +418,21 @@ private:
   public:
     /// \brief Begin iterator on the variables
     auto var_begin() const {
-      return boost::make_transform_iterator(this->_parents.cbegin(), GetVar());
+      return boost::make_transform_iterator(this->cdata().parents.cbegin(),
+                                            GetVar());
     }
 
     /// \brief End iterator on the variables
     auto var_end() const {
-      return boost::make_transform_iterator(this->_parents.cend(), GetVar());
+      return boost::make_transform_iterator(this->cdata().parents.cend(),
+                                            GetVar());
     }
 
     /// \brief Begin iterator on the equivalence classes
-    auto begin() const { return this->_classes.cbegin(); }
+    auto begin() const { return this->cdata().classes.cbegin(); }
 
     /// \brief End iterator on the equivalence classes
-    auto end() const { return this->_classes.cend(); }
+    auto end() const { return this->cdata().classes.cend(); }
 
     /// \brief Return the list of variables
     std::vector< VariableRef > variables() const {
@@ -365,38 +440,69 @@ private:
     }
 
     /// \brief Clear the equivalence relation
-    void clear() {
-      this->_parents.clear();
-      this->_classes.clear();
+    void clear() { this->_data = std::make_shared< Data >(); }
+
+    /// \brief Return true if both relations share the same storage
+    ///
+    /// This is a constant time check. Shared storage implies the same
+    /// partition and the same packs.
+    bool shares_storage(const EquivalenceRelation& other) const {
+      return this->_data == other._data;
+    }
+
+    /// \brief Return true if `this` and `other` have the same equivalence
+    /// classes, with the same root variables
+    bool same_partition(const EquivalenceRelation& other) const {
+      if (this->shares_storage(other)) {
+        return true;
+      }
+
+      const Data& data = this->cdata();
+      const Data& other_data = other.cdata();
+
+      if (data.parents.size() != other_data.parents.size() ||
+          data.classes.size() != other_data.classes.size()) {
+        return false;
+      }
+
+      for (const auto& p : data.parents) {
+        if (!other.contains(p.first) ||
+            this->cfind_root_var(p.first) != other.cfind_root_var(p.first)) {
+          return false;
+        }
+      }
+
+      return true;
     }
 
     /// \brief Forget the given variable
     void forget(VariableRef v) {
-      auto it = this->_parents.find(v);
-
-      if (it == this->_parents.end()) {
+      if (!this->contains(v)) {
         return;
       }
 
+      Data& data = this->data();
+      auto it = data.parents.find(v);
+
       if (it->second != v) {
         // v is not the root of the equivalence class
         VariableRef root = this->find_root_var(v);
 
         // update parents
-        for (auto& p : this->_parents) {
+        for (auto& p : data.parents) {
           if (p.second == v) {
             p.second = root;
           }
         }
 
-        EquivalenceClass& equiv_class = this->_classes[root];
+        EquivalenceClass& equiv_class = data.classes.at(root);
         equiv_class.copy_domain();
         equiv_class.domain->forget(v);
       } else {
         // v is the root of the equivalence class
         boost::optional< VariableRef > new_root;
 
-        for (auto& p : this->_parents) {
+        for (auto& p : data.parents) {
           if (p.second == v && p.first != v) {
             if (!new_root) {
               new_root = p.first;
@@ -406,16 +512,16 @@ private:
         }
 
         if (new_root) {
-          EquivalenceClass equiv_class = std::move(this->_classes[v]);
+          EquivalenceClass equiv_class = std::move(data.classes.at(v));
           equiv_class.copy_domain();
           equiv_class.domain->forget(v);
-          this->_classes.emplace(*new_root, std::move(equiv_class));
+          data.classes.emplace(*new_root, std::move(equiv_class));
         }
 
-        this->_classes.erase(v);
+        data.classes.erase(v);
       }
 
-      this->_parents.erase(v);
+      data.parents.erase(v);
     }
 
     /// \brief Forget the equivalence class containing the given variable
@@ -424,33 +530,47 @@ private:
         return;
       }
 
+      Data& data = this->data();
       VariableRef root = this->find_root_var(v);
 
-      for (auto it = this->_parents.begin(); it != this->_parents.end();) {
+      for (auto it = data.parents.begin(); it != data.parents.end();) {
         if (this->find_root_var(it->second) == root) {
-          it = _parents.erase(it);
+          it = data.parents.erase(it);
         } else {
           ++it;
         }
       }
 
-      this->_classes.erase(root);
+      data.classes.erase(root);
     }
 
     /// \brief Return a map from root variables to the list of variables in the
     /// equivalence class
     RootVariablesMap root_to_vars() const {
       RootVariablesMap roots;
-      for (const auto& p : this->_parents) {
+      for (const auto& p : this->cdata().parents) {
         roots[this->cfind_root_var(p.second)].push_back(p.first);
       }
       return roots;
     }
 
+    /// \brief Return an estimate of the memory used by the relation and the
+    /// domains of the classes, in bytes
+    std::size_t size_in_bytes() const {
+      const Data& data = this->cdata();
+      std::size_t size =
+          data.parents.size() * sizeof(typename ParentMap::value_type) +
+          data.classes.size() * sizeof(typename ClassMap::value_type);
+      for (const auto& p : data.classes) {
+        size += p.second.domain->size_in_bytes();
+      }
+      return size;
+    }
+
     void dump(std::ostream& o) const {
       o << "({";
-      for (auto it = this->_parents.begin(), et = this->_parents.end();
-           it != et;) {
+      const Data& data = this->cdata();
+      for (auto it = data.parents.begin(), et = data.parents.end(); it != et;) {
         DumpableTraits< VariableRef >::dump(o, it->first);
         o << " -> ";
         DumpableTraits< VariableRef >::dump(o, it->second);
@@ -460,8 +580,7 @@ private:
         }
       }
       o << "}, {";
-      for (auto it = this->_classes.begin(), et = this->_classes.end();
-           it != et;) {
+      for (auto it = data.classes.begin(), et = data.classes.end(); it != et;) {
         DumpableTraits< VariableRef >::dump(o, it->first);
         o << " -> ";
         it->second.domain->dump(o);
@@ -529,6 +648,17 @@ public:
       return;
     }
 
+    if (Parallel::jobs() > 1) {
+      // Equivalence classes are independent
+      std::vector< const Domain* > domains;
+      for (const auto& equiv_class : this->_equiv_relation) {
+        domains.push_back(equiv_class.second.domain.get());
+      }
+      Parallel::for_each_index(domains.size(),
+                               ParallelThreshold,
+                               [&](std::size_t i) { domains[i]->normalize(); });
+    }
+
     for (const auto& equiv_class : this->_equiv_relation) {
       equiv_class.second.domain->normalize();
 
@@ -583,6 +713,18 @@ public:
       return true;
     } else if (other.is_bottom()) {
       return false;
+    } else if (this->_equiv_relation.shares_storage(other._equiv_relation)) {
+      return true;
+    } else if (this->_equiv_relation.same_partition(other._equiv_relation)) {
+      for (const auto& equiv_class : this->_equiv_relation) {
+        const DomainPtr& domain = equiv_class.second.domain;
+        const DomainPtr& other_domain =
+            other._equiv_relation.cfind_domain(equiv_class.first);
+        if (domain != other_domain && !((*domain).leq(*other_domain))) {
+          return false;
+        }
+      }
+      return true;
     } else {
       RootVariablesMap other_roots = other._equiv_relation.root_to_vars();
 
@@ -676,15 +818,85 @@ private:
     if (root) {
       this->_equiv_relation.add_var_to_equiv_class(v, *root);
     } else {
-      root = v;
-      this->_equiv_relation.add_equiv_class(v);
+      root = this->add_packed_var(v);
     }
   }
 
+  /// \brief Add `v` in the equivalence class of a variable of its static pack,
+  /// or create a new equivalence class
+  ///
+  /// Returns a variable of the equivalence class.
+  ///
+  /// Precondition: `v` is not already present in the relation
+  VariableRef add_packed_var(VariableRef v) {
+    const std::vector< VariableRef >* pack =
+        PackingTraits< VariableRef >::pack(v);
+    if (pack != nullptr) {
+      for (VariableRef w : *pack) {
+        if (w != v && this->_equiv_relation.contains(w)) {
+          this->_equiv_relation.add_var_to_equiv_class(v, w);
+          return w;
+        }
+      }
+    }
+    this->_equiv_relation.add_equiv_class(v);
+    return v;
+  }
+
+  /// \brief Apply a binary operation on two abstract values with the same
+  /// partition
+  ///
+  /// Packs that are shared by both operands are left untouched.
+  template < typename BinaryOperator >
+  VarPackingDomain same_partition_binary_op(const VarPackingDomain& other,
+                                            const BinaryOperator& op) const {
+    if (this->_equiv_relation.shares_storage(other._equiv_relation)) {
+      return *this; // all packs are shared
+    }
+
+    VarPackingDomain result(*this);
+
+    // Collect first, find_equiv_class() might copy the storage
+    std::vector< VariableRef > roots;
+    for (const auto& equiv_class : this->_equiv_relation) {
+      if (equiv_class.second.domain !=
+          other._equiv_relation.cfind_domain(equiv_class.first)) {
+        roots.push_back(equiv_class.first);
+      }
+    }
+
+    std::vector< EquivalenceClass* > classes;
+    classes.reserve(roots.size());
+    for (VariableRef root : roots) {
+      classes.push_back(&result._equiv_relation.find_equiv_class(root));
+    }
+
+    // Equivalence classes are independent
+    Parallel::for_each_index(roots.size(),
+                             ParallelThreshold,
+                             [&](std::size_t i) {
+                               const DomainPtr& other_domain =
+                                   other._equiv_relation.cfind_domain(roots[i]);
+                               DomainPtr merge_domain =
+                                   std::make_shared< Domain >();
+                               op(*merge_domain,
+                                  *classes[i]->domain,
+                                  *other_domain);
+                               classes[i]->domain = merge_domain;
+                             });
+
+    result._is_normalized = this->_is_normalized && roots.empty();
+    return result;
+  }
+
   /// \brief Apply a binary operation using a union semantic (join, widening)
   template < typename BinaryOperator >
   VarPackingDomain union_binary_op(VarPackingDomain other,
                                    const BinaryOperator& op) const {
+    if (this->_equiv_relation.same_partition(other._equiv_relation)) {
+      return this->same_partition_binary_op(other, op);
+    }
+
     // `other` is a copy, thus we can update it
     /// TODO(marthaud): try to implement this without copying `other`
     VarPackingDomain result(*this);
@@ -722,12 +934,12 @@ private:
 
     {
       // Iterator on equivalence classes in `other`, merge the variables in
-      // `results` and compute the binary operation
+      // `results`
+      std::vector< VariableRef > roots;
+      std::vector< DomainPtr > other_domains;
       RootVariablesMap other_roots = other._equiv_relation.root_to_vars();
       for (const auto& other_class : other_roots) {
         const VariableRef& other_root = other_class.first;
-        const DomainPtr& other_domain =
-            other._equiv_relation.find_domain(other_root);
 
         boost::optional< VariableRef > root;
         for (VariableRef v : other_class.second) {
@@ -735,17 +947,36 @@ private:
         }
 
         if (root) {
-          EquivalenceClass& equiv_class =
-              result._equiv_relation.find_equiv_class(*root);
-          if (equiv_class.domain == other_domain) {
-            // nothing to do, left and right packs are the same
-          } else {
-            DomainPtr merge_domain = std::make_shared< Domain >();
-            op(*merge_domain, *equiv_class.domain, *other_domain);
-            equiv_class.domain = merge_domain;
-          }
+          roots.push_back(*root);
+          other_domains.push_back(
+              other._equiv_relation.find_domain(other_root));
         }
       }
+
+      // Now that both partitions are the same, compute the binary operation
+      // on each equivalence class. Equivalence classes are independent.
+      std::vector< EquivalenceClass* > classes;
+      classes.reserve(roots.size());
+      for (VariableRef root : roots) {
+        classes.push_back(&result._equiv_relation.find_equiv_class(root));
+      }
+
+      Parallel::for_each_index(roots.size(),
+                               ParallelThreshold,
+                               [&](std::size_t i) {
+                                 EquivalenceClass& equiv_class = *classes[i];
+                                 if (equiv_class.domain == other_domains[i]) {
+                                   // nothing to do, left and right packs are
+                                   // the same
+                                   return;
+                                 }
+                                 DomainPtr merge_domain =
+                                     std::make_shared< Domain >();
+                                 op(*merge_domain,
+                                    *equiv_class.domain,
+                                    *other_domains[i]);
+                                 equiv_class.domain = merge_domain;
+                               });
     }
 
     result._is_normalized = false;
@@ -756,6 +987,10 @@ private:
   template < typename BinaryOperator >
   VarPackingDomain meet_binary_op(const VarPackingDomain& other,
                                   BinaryOperator op) const {
+    if (this->_equiv_relation.same_partition(other._equiv_relation)) {
+      return this->same_partition_binary_op(other, op);
+    }
+
     VarPackingDomain result(*this);
 
     RootVariablesMap other_roots = other._equiv_relation.root_to_vars();
@@ -930,8 +1165,11 @@ public:
     }
 
     this->forget(x);
-    this->_equiv_relation.add_equiv_class(x);
-    this->_equiv_relation.find_domain(x)->assign(x, n);
+    VariableRef root = this->add_packed_var(x);
+    EquivalenceClass& equiv_class =
+        this->_equiv_relation.find_equiv_class(root);
+    equiv_class.copy_domain();
+    equiv_class.domain->assign(x, n);
     this->_is_normalized = false;
   }
 
@@ -945,7 +1183,7 @@ public:
     }
 
     if (!this->_equiv_relation.contains(y)) {
-      this->_equiv_relation.add_equiv_class(y);
+      this->add_packed_var(y);
     }
 
     this->forget(x);
@@ -1015,7 +1253,7 @@ private:
   /// \brief Add a relation x = f(y)
   const DomainPtr& add_relation(VariableRef x, VariableRef y) {
     if (!this->_equiv_relation.contains(y)) {
-      this->_equiv_relation.add_equiv_class(y);
+      this->add_packed_var(y);
     }
 
     if (x != y) {
@@ -1094,9 +1332,47 @@ public:
   }
 
   void add(const LinearConstraintSystemT& csts) override {
+    if (this->_is_bottom) {
+      return;
+    }
+
+    // Merge the equivalence classes first, so that each pack receives all its
+    // constraints at once
+    for (const LinearConstraintT& cst : csts) {
+      if (cst.num_terms() == 0) {
+        if (cst.is_contradiction()) {
+          this->set_to_bottom();
+          return;
+        }
+        continue;
+      }
+
+      boost::optional< VariableRef > root;
+      for (const auto& term : cst) {
+        this->merge_existing_equiv_classes(root, term.first);
+      }
+
+      for (const auto& term : cst) {
+        this->merge_unexisting_equiv_classes(root, term.first);
+      }
+    }
+
+    // Group the constraints by equivalence class
+    boost::container::flat_map< VariableRef, LinearConstraintSystemT > packs;
     for (const LinearConstraintT& cst : csts) {
-      this->add(cst);
+      if (cst.num_terms() != 0) {
+        packs[this->_equiv_relation.find_root_var(cst.begin()->first)].add(cst);
+      }
+    }
+
+    for (const auto& pack : packs) {
+      EquivalenceClass& equiv_class =
+          this->_equiv_relation.find_equiv_class(pack.first);
+      equiv_class.copy_domain();
+      equiv_class.domain->add(pack.second);
     }
+
+    this->_is_normalized = false;
   }
 
   void set(VariableRef x, const IntervalT& value) override {
@@ -1311,6 +1587,10 @@ public:
     return csts;
   }
 
+  std::size_t size_in_bytes() const override {
+    return sizeof(VarPackingDomain) + this->_equiv_relation.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
 #if 1
     this->to_linear_constraint_system().dump(o);
@@ -43,6 +43,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <ikos/core/domain/abstract_domain.hpp>
 #include <ikos/core/domain/machine_int/abstract_domain.hpp>
 #include <ikos/core/domain/nullity/abstract_domain.hpp>
@@ -116,6 +118,22 @@ public:
     return tmp;
   }
 
+  /// \brief Perform the widening of two abstract values with a set of
+  /// thresholds
+  ///
+  /// An unstable bound is set to the closest threshold that includes it.
+  virtual void widen_threshold_with(
+      const Derived& other, const std::vector< MachineInt >& thresholds) = 0;
+
+  /// \brief Perform the widening of two abstract values with a set of
+  /// thresholds
+  virtual Derived widening_threshold(
+      const Derived& other, const std::vector< MachineInt >& thresholds) const {
+    Derived tmp(static_cast< const Derived& >(*this));
+    tmp.widen_threshold_with(other, thresholds);
+    return tmp;
+  }
+
   /// \brief Assign `p` to an address (i.e, memory location)
   ///
   /// This is equivalent to `p = &x` or `p = malloc()`
@@ -173,6 +191,20 @@ public:
   /// \brief Return the points-to set of `p`
   virtual PointsToSetT points_to(VariableRef p) const = 0;
 
+  /// \brief Return the union of the points-to sets of all pointers
+  ///
+  /// Pointers with an unknown points-to set are ignored. Returns top if the
+  /// domain cannot enumerate its pointers.
+  virtual PointsToSetT referenced_locations() const = 0;
+
+  /// \brief Return the union of the points-to sets of the pointers that are
+  /// not memory cells
+  ///
+  /// These are the roots of the memory reachability. Pointers with an unknown
+  /// points-to set are ignored. Returns top if the domain cannot enumerate its
+  /// pointers.
+  virtual PointsToSetT root_locations() const = 0;
+
   /// \brief Return the offset variable associated to `p`
   VariableRef offset_var(VariableRef p) const {
     return pointer::VariableTraits< VariableRef >::offset_var(p);
@@ -212,6 +212,19 @@ public:
     }
   }
 
+  void widen_threshold_with(
+      const DummyDomain& other,
+      const std::vector< MachineInt >& thresholds) override {
+    if (this->is_bottom()) {
+      this->operator=(other);
+    } else if (other.is_bottom()) {
+      return;
+    } else {
+      this->_machine_int.widen_threshold_with(other._machine_int, thresholds);
+      this->_nullity.widen_with(other._nullity);
+    }
+  }
+
   void meet_with(const DummyDomain& other) override {
     if (this->is_bottom()) {
       return;
@@ -300,6 +313,18 @@ public:
     }
   }
 
+  PointsToSetT referenced_locations() const override {
+    if (this->is_bottom()) {
+      return PointsToSetT::bottom();
+    } else {
+      return PointsToSetT::top();
+    }
+  }
+
+  PointsToSetT root_locations() const override {
+    return this->referenced_locations();
+  }
+
   PointerAbsValueT get(VariableRef p) const override {
     VariableRef var = this->offset_var(p);
     auto bit_width = machine_int::VariableTraits< VariableRef >::bit_width(var);
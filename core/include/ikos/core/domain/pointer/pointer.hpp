@@ -48,6 +48,7 @@
 #include <ikos/core/domain/machine_int/abstract_domain.hpp>
 #include <ikos/core/domain/pointer/abstract_domain.hpp>
 #include <ikos/core/domain/separate_domain.hpp>
+#include <ikos/core/semantic/memory/variable.hpp>
 
 namespace ikos {
 namespace core {
@@ -98,6 +99,7 @@ public:
 private:
   using PointsToMap = SeparateDomain< VariableRef, PointsToSetT >;
   using IntVariableTrait = machine_int::VariableTraits< VariableRef >;
+  using MemVariableTrait = memory::VariableTraits< VariableRef >;
 
 private:
   /// \brief Map pointer variables to set of addresses
@@ -278,6 +280,20 @@ public:
     }
   }
 
+  void widen_threshold_with(
+      const PointerDomain& other,
+      const std::vector< MachineInt >& thresholds) override {
+    if (this->is_bottom()) {
+      this->operator=(other);
+    } else if (other.is_bottom()) {
+      return;
+    } else {
+      this->_points_to_map.widen_with(other._points_to_map);
+      this->_nullity.widen_with(other._nullity);
+      this->_inv.widen_threshold_with(other._inv, thresholds);
+    }
+  }
+
   void meet_with(const PointerDomain& other) override {
     if (this->is_bottom()) {
       return;
@@ -615,6 +631,38 @@ public:
     return this->_points_to_map.get(p);
   }
 
+  PointsToSetT referenced_locations() const override {
+    if (this->is_bottom()) {
+      return PointsToSetT::bottom();
+    }
+
+    PointsToSetT referenced = PointsToSetT::empty();
+    for (auto it = this->_points_to_map.begin(),
+              et = this->_points_to_map.end();
+         it != et;
+         ++it) {
+      referenced.join_with(it->second);
+    }
+    return referenced;
+  }
+
+  PointsToSetT root_locations() const override {
+    if (this->is_bottom()) {
+      return PointsToSetT::bottom();
+    }
+
+    PointsToSetT roots = PointsToSetT::empty();
+    for (auto it = this->_points_to_map.begin(),
+              et = this->_points_to_map.end();
+         it != et;
+         ++it) {
+      if (!MemVariableTrait::is_cell(it->first)) {
+        roots.join_with(it->second);
+      }
+    }
+    return roots;
+  }
+
   PointerAbsValueT get(VariableRef p) const override {
     return PointerAbsValueT(this->_points_to_map.get(p),
                             this->_inv.to_interval(this->offset_var(p)),
@@ -636,6 +684,11 @@ public:
     }
   }
 
+  std::size_t size_in_bytes() const override {
+    return this->_points_to_map.size_in_bytes() +
+           this->_nullity.size_in_bytes() + this->_inv.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     if (this->is_bottom()) {
       o << "⊥";
@@ -55,11 +55,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <deque>
 #include <iosfwd>
+#include <limits>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include <boost/iterator/transform_iterator.hpp>
+
 #include <ikos/core/semantic/dumpable.hpp>
 #include <ikos/core/semantic/indexable.hpp>
 #include <ikos/core/semantic/memory_location.hpp>
@@ -376,6 +382,10 @@ public:
 }; // end class LoadConstraint
 
 /// \brief System of pointer constraints
+///
+/// Pointer variables and memory locations are numbered densely when the
+/// system is solved. The solver state is stored in flat vectors indexed by
+/// these numbers.
 template < typename VariableRef, typename MemoryLocationRef >
 class ConstraintSystem {
 public:
@@ -412,26 +422,88 @@ private:
   using PointerAbsValueT = PointerAbsValue< MemoryLocationRef >;
   using PointsToSetT = PointsToSet< MemoryLocationRef >;
   using ConstraintVector = std::vector< std::unique_ptr< ConstraintT > >;
-  using PointerMap =
-      std::unordered_map< VariableRef, PointerAbsValueT, VariableHash >;
-  using MemoryMap = std::
-      unordered_map< MemoryLocationRef, PointerAbsValueT, MemoryLocationHash >;
+
+  /// \brief Dense number of a pointer variable or a memory location
+  using Id = std::size_t;
+
+  using PointerEntry = std::pair< VariableRef, PointerAbsValueT >;
+  using MemoryEntry = std::pair< MemoryLocationRef, PointerAbsValueT >;
+
+  /// \brief Function object returning the entry with the given number
+  template < typename Entry >
+  struct EntryAt {
+    const std::vector< Entry >* entries;
+
+    const Entry& operator()(Id id) const { return (*this->entries)[id]; }
+  };
+
+  /// \brief Dense numbers of the operands of a constraint
+  struct ConstraintOperands {
+    // Result variable (assign, load) or pointer variable (store)
+    Id target;
+
+    // Operand variable or address
+    Id operand;
+  };
+
+  /// \brief State of a constraint, for difference propagation
+  ///
+  /// Memory values only grow during the resolution, so a store only needs to
+  /// write to the memory locations it has not seen yet, unless its operand
+  /// changed, and a load only needs to read the memory locations it has not
+  /// seen yet or that were updated since its last processing.
+  struct ConstraintState {
+    // Memory locations already processed
+    PointsToSetT seen;
+
+    // Memory locations updated since the last processing (load only)
+    PointsToSetT dirty;
+
+    // Operand value written on the last processing (store only)
+    PointerAbsValueT value;
+  };
 
 public:
-  using PointerIterator = typename PointerMap::const_iterator;
-  using MemoryIterator = typename MemoryMap::const_iterator;
+  using PointerIterator =
+      boost::transform_iterator< EntryAt< PointerEntry >,
+                                 std::vector< Id >::const_iterator >;
+  using MemoryIterator =
+      boost::transform_iterator< EntryAt< MemoryEntry >,
+                                 std::vector< Id >::const_iterator >;
 
 private:
   // List of pointer constraints
   ConstraintVector _csts;
 
-  // Map from pointer variables to pointer abstract values
-  PointerMap _pointers;
+  // Dense numbers of the operands of each constraint
+  std::vector< ConstraintOperands > _operands;
+
+  // Map from pointer variables to dense numbers
+  std::unordered_map< VariableRef, Id, VariableHash > _pointer_ids;
+
+  // Map from memory locations to dense numbers
+  std::unordered_map< MemoryLocationRef, Id, MemoryLocationHash > _memory_ids;
 
-  // Map from memory locations to pointer abstract values
+  // Pointer variables and their pointer abstract values, by number
+  std::vector< PointerEntry > _pointers;
+
+  // Memory locations and their pointer abstract values, by number
   //
-  // `_memory[m]` contains the abstract union of all the pointers stored at `m`
-  MemoryMap _memory;
+  // `_memory[m].second` contains the abstract union of all the pointers
+  // stored at `m`
+  std::vector< MemoryEntry > _memory;
+
+  // Whether each pointer variable has a value
+  std::vector< bool > _pointer_defined;
+
+  // Whether each memory location has a value
+  std::vector< bool > _memory_defined;
+
+  // Pointer variables with a value, in order of definition
+  std::vector< Id > _defined_pointers;
+
+  // Memory locations with a value, in order of definition
+  std::vector< Id > _defined_memory;
 
   // Bit-width of pointer offsets (e.g, 32 or 64)
   unsigned _offsets_bit_width;
@@ -439,11 +511,35 @@ private:
   // Signedness of pointer offsets (usually Unsigned)
   Signedness _offsets_sign;
 
-  // Number of iterations
-  std::size_t _iteration = 0;
+  // Whether the offsets are computed, or only the points-to sets
+  bool _track_offsets = true;
+
+  // Representative of each pointer variable in a cycle of copies
+  //
+  // Variables in a cycle of assignments `p = q + 0` have the same abstract
+  // value, thus only the representative of the cycle is solved.
+  std::vector< Id > _representatives;
+
+  // Constraints reading each pointer variable (representatives only)
+  std::vector< std::vector< std::size_t > > _pointer_users;
 
-  // Change seen during iteration
-  bool _change_seen = false;
+  // Load constraints reading each memory location
+  std::vector< std::vector< std::size_t > > _memory_users;
+
+  // Number of updates of each pointer variable, used to trigger widening
+  std::vector< std::size_t > _pointer_updates;
+
+  // Number of updates of each memory location, used to trigger widening
+  std::vector< std::size_t > _memory_updates;
+
+  // State of each constraint, for difference propagation
+  std::vector< ConstraintState > _states;
+
+  // Worklist of constraints to process
+  std::deque< std::size_t > _worklist;
+
+  // Whether each constraint is in the worklist
+  std::vector< bool > _pending;
 
 public:
   /// \brief Default constructor
@@ -470,7 +566,113 @@ public:
     this->_csts.emplace_back(std::move(cst));
   }
 
+  /// \brief Move the constraints of `other` at the end of this system
+  void merge(ConstraintSystem& other) {
+    ikos_assert_msg(other._operands.empty(),
+                    "trying to merge a solved constraint system");
+    this->_csts.reserve(this->_csts.size() + other._csts.size());
+    for (auto& cst : other._csts) {
+      this->_csts.emplace_back(std::move(cst));
+    }
+    other._csts.clear();
+  }
+
+  /// \brief Move the constraints out of this system, leaving it empty
+  ConstraintVector release() {
+    ikos_assert_msg(this->_operands.empty(),
+                    "trying to release a solved constraint system");
+    ConstraintVector csts;
+    csts.swap(this->_csts);
+    return csts;
+  }
+
 private:
+  /// \brief Number the operands of the constraints added since the last call
+  void number_operands() {
+    this->_operands.reserve(this->_csts.size());
+    for (std::size_t i = this->_operands.size(); i < this->_csts.size(); i++) {
+      const ConstraintT* cst = this->_csts[i].get();
+      ConstraintOperands ids{0, 0};
+      switch (cst->kind()) {
+        case ConstraintT::AssignKind: {
+          auto assign = static_cast< const AssignConstraintT* >(cst);
+          ids.target = this->pointer_id(assign->result());
+          ids.operand = this->operand_id(assign->operand());
+        } break;
+        case ConstraintT::StoreKind: {
+          auto store = static_cast< const StoreConstraintT* >(cst);
+          ids.target = this->pointer_id(store->pointer());
+          ids.operand = this->operand_id(store->operand());
+        } break;
+        case ConstraintT::LoadKind: {
+          auto load = static_cast< const LoadConstraintT* >(cst);
+          ids.target = this->pointer_id(load->result());
+          ids.operand = this->operand_id(load->operand());
+        } break;
+        default: {
+          ikos_unreachable("unexpected kind");
+        }
+      }
+      this->_operands.push_back(ids);
+    }
+  }
+
+  /// \brief Return the bottom pointer abstract value
+  PointerAbsValueT bottom() const {
+    return PointerAbsValueT::bottom(this->_offsets_bit_width,
+                                    this->_offsets_sign);
+  }
+
+  /// \brief Return the dense number of the given pointer variable
+  Id pointer_id(VariableRef p) {
+    auto res = this->_pointer_ids.emplace(p, this->_pointers.size());
+    if (res.second) {
+      this->_pointers.emplace_back(p, this->bottom());
+      this->_pointer_defined.push_back(false);
+      this->_representatives.push_back(res.first->second);
+    }
+    return res.first->second;
+  }
+
+  /// \brief Return the dense number of the given memory location
+  Id memory_id(MemoryLocationRef m) {
+    auto res = this->_memory_ids.emplace(m, this->_memory.size());
+    if (res.second) {
+      this->_memory.emplace_back(m, this->bottom());
+      this->_memory_defined.push_back(false);
+    }
+    return res.first->second;
+  }
+
+  /// \brief Return the dense number of a memory location seen in a constraint
+  Id existing_memory_id(MemoryLocationRef m) const {
+    auto it = this->_memory_ids.find(m);
+    ikos_assert_msg(it != this->_memory_ids.end(), "unexpected address");
+    return it->second;
+  }
+
+  /// \brief Return the dense number of the variable or address of an operand
+  Id operand_id(const OperandT* op) {
+    switch (op->kind()) {
+      case OperandT::VariableKind: {
+        return this->pointer_id(
+            static_cast< const VariableOperandT* >(op)->var());
+      }
+      case OperandT::AddressKind: {
+        return this->memory_id(
+            static_cast< const AddressOperandT* >(op)->address());
+      }
+      default: {
+        ikos_unreachable("unexpected kind");
+      }
+    }
+  }
+
+  /// \brief Return the current abstract value of the given pointer variable
+  const PointerAbsValueT& pointer_value(Id p) const {
+    return this->_pointers[this->_representatives[p]].second;
+  }
+
   class BinaryOp {
   public:
     virtual bool convergence_achieved(const PointerAbsValueT& before,
@@ -534,46 +736,201 @@ private:
     }
   };
 
-  /// \brief Perform a step of the fixpoint convergence using the given operator
+
+  /// \brief Return true if the operand is a variable operand `q + 0`
+  static bool is_copy_operand(const OperandT* op) {
+    return op->kind() == OperandT::VariableKind &&
+           static_cast< const VariableOperandT* >(op)->offset().is_zero();
+  }
+
+  /// \brief Collapse the cycles of assignments `p = q + 0`
   ///
-  /// It processes all the constraints once.
-  void step(const BinaryOp& op) {
-    for (auto it = this->_csts.begin(), et = this->_csts.end(); it != et;
-         ++it) {
-      this->process_constraint(it->get(), op);
+  /// This runs Tarjan's algorithm on the graph with an edge `q -> p` for each
+  /// assignment `p = q + 0`. Every strongly connected component is merged
+  /// into its root.
+  void collapse_cycles() {
+    const std::size_t n = this->_pointers.size();
+    const std::size_t unvisited = std::numeric_limits< std::size_t >::max();
+
+    std::vector< std::vector< Id > > succs(n);
+    for (std::size_t i = 0; i < this->_csts.size(); i++) {
+      const ConstraintT* cst = this->_csts[i].get();
+      if (cst->kind() == ConstraintT::AssignKind &&
+          is_copy_operand(
+              static_cast< const AssignConstraintT* >(cst)->operand())) {
+        succs[this->_operands[i].operand].push_back(this->_operands[i].target);
+      }
+    }
+
+    std::vector< std::size_t > index(n, unvisited);
+    std::vector< std::size_t > lowlink(n, unvisited);
+    std::vector< bool > on_stack(n, false);
+    std::vector< Id > stack;
+    std::vector< std::pair< Id, std::size_t > > dfs;
+    std::size_t next_index = 0;
+
+    auto visit = [&](Id v) {
+      index[v] = lowlink[v] = next_index++;
+      on_stack[v] = true;
+      stack.push_back(v);
+      dfs.emplace_back(v, 0);
+    };
+
+    for (Id root = 0; root < n; root++) {
+      if (succs[root].empty() || index[root] != unvisited) {
+        continue;
+      }
+
+      visit(root);
+      while (!dfs.empty()) {
+        Id v = dfs.back().first;
+
+        if (dfs.back().second < succs[v].size()) {
+          Id w = succs[v][dfs.back().second++];
+          if (index[w] == unvisited) {
+            visit(w);
+          } else if (on_stack[w]) {
+            lowlink[v] = std::min(lowlink[v], index[w]);
+          }
+          continue;
+        }
+
+        dfs.pop_back();
+
+        if (lowlink[v] == index[v]) {
+          Id w = v;
+          do {
+            w = stack.back();
+            stack.pop_back();
+            on_stack[w] = false;
+            this->_representatives[w] = v;
+          } while (w != v);
+        }
+
+        if (!dfs.empty()) {
+          Id parent = dfs.back().first;
+          lowlink[parent] = std::min(lowlink[parent], lowlink[v]);
+        }
+      }
+    }
+  }
+
+  /// \brief Build the dependency graph between constraints
+  void build_dependencies() {
+    this->_pointer_users.assign(this->_pointers.size(), {});
+    this->_memory_users.assign(this->_memory.size(), {});
+
+    for (std::size_t i = 0; i < this->_csts.size(); i++) {
+      const ConstraintT* cst = this->_csts[i].get();
+      const ConstraintOperands& ids = this->_operands[i];
+      switch (cst->kind()) {
+        case ConstraintT::AssignKind: {
+          auto assign = static_cast< const AssignConstraintT* >(cst);
+          if (assign->operand()->kind() == OperandT::VariableKind) {
+            this->_pointer_users[this->_representatives[ids.operand]]
+                .push_back(i);
+          }
+        } break;
+        case ConstraintT::StoreKind: {
+          auto store = static_cast< const StoreConstraintT* >(cst);
+          this->_pointer_users[this->_representatives[ids.target]].push_back(
+              i);
+          if (store->operand()->kind() == OperandT::VariableKind) {
+            this->_pointer_users[this->_representatives[ids.operand]]
+                .push_back(i);
+          }
+        } break;
+        case ConstraintT::LoadKind: {
+          auto load = static_cast< const LoadConstraintT* >(cst);
+          if (load->operand()->kind() == OperandT::VariableKind) {
+            this->_pointer_users[this->_representatives[ids.operand]]
+                .push_back(i);
+          }
+          // Memory locations are added during the resolution
+        } break;
+        default: {
+          ikos_unreachable("unexpected kind");
+        }
+      }
+    }
+  }
+
+  /// \brief Add the given constraint in the worklist
+  void schedule(std::size_t i) {
+    if (!this->_pending[i]) {
+      this->_pending[i] = true;
+      this->_worklist.push_back(i);
     }
   }
 
   /// \brief Process the given constraint
   ///
-  /// It updates this->_pointers and this->_memory
-  void process_constraint(const ConstraintT* cst, const BinaryOp& op) {
+  /// It updates this->_pointers and this->_memory, and schedules the
+  /// constraints depending on the updated values.
+  void process_constraint(std::size_t i, const BinaryOp& op) {
+    const ConstraintT* cst = this->_csts[i].get();
+    const ConstraintOperands& ids = this->_operands[i];
+    ConstraintState& state = this->_states[i];
+
     switch (cst->kind()) {
       case ConstraintT::AssignKind: {
         auto assign = static_cast< const AssignConstraintT* >(cst);
-        PointerAbsValueT op_value = this->process_operand(assign->operand());
-        this->add_pointer(assign->result(), op_value, op);
+        if (is_copy_operand(assign->operand()) &&
+            this->_representatives[ids.operand] ==
+                this->_representatives[ids.target]) {
+          // Collapsed cycle
+          this->define_pointer(this->_representatives[ids.target]);
+          return;
+        }
+        PointerAbsValueT op_value =
+            this->process_operand(assign->operand(), ids.operand);
+        this->add_pointer(ids.target, op_value, op);
       } break;
       case ConstraintT::StoreKind: {
         auto store = static_cast< const StoreConstraintT* >(cst);
-        PointerAbsValueT ptr_value = this->get_pointer(store->pointer());
-        PointerAbsValueT op_value = this->process_operand(store->operand());
-        if (ptr_value.is_bottom()) {
+        PointsToSetT ptr_points_to = this->pointer_value(ids.target).points_to();
+        if (ptr_points_to.is_bottom()) {
           return;
         }
-        for (MemoryLocationRef addr : ptr_value.points_to()) {
-          this->add_memory(addr, op_value, op);
+        PointerAbsValueT op_value =
+            this->process_operand(store->operand(), ids.operand);
+        PointsToSetT addrs = ptr_points_to;
+        if (op_value.equals(state.value)) {
+          // Only write to the new memory locations
+          addrs.difference_with(state.seen);
+        } else {
+          state.value = op_value;
+        }
+        state.seen = ptr_points_to;
+        for (MemoryLocationRef addr : addrs) {
+          this->add_memory(this->existing_memory_id(addr), op_value, op);
         }
       } break;
       case ConstraintT::LoadKind: {
         auto load = static_cast< const LoadConstraintT* >(cst);
-        PointerAbsValueT op_value = this->process_operand(load->operand());
+        PointerAbsValueT op_value =
+            this->process_operand(load->operand(), ids.operand);
         if (op_value.is_bottom()) {
           return;
         }
+        // Join the values read, to update the result only once
+        PointerAbsValueT loaded = this->bottom();
+        bool read = false;
         for (MemoryLocationRef addr : op_value.points_to()) {
-          this->add_pointer(load->result(), this->get_memory(addr), op);
+          Id m = this->existing_memory_id(addr);
+          if (!state.seen.contains(addr)) {
+            this->_memory_users[m].push_back(i);
+          } else if (!state.dirty.contains(addr)) {
+            continue;
+          }
+          loaded.join_with(this->_memory[m].second);
+          read = true;
+        }
+        if (read) {
+          this->add_pointer(ids.target, loaded, op);
         }
+        state.seen = op_value.points_to();
+        state.dirty.set_to_empty();
       } break;
       default: {
         ikos_unreachable("unexpected kind");
@@ -582,18 +939,24 @@ private:
   }
 
   /// \brief Return the abstract value for the given operand
-  PointerAbsValueT process_operand(const OperandT* op) {
+  PointerAbsValueT process_operand(const OperandT* op, Id id) {
     switch (op->kind()) {
       case OperandT::VariableKind: {
         auto variable_op = static_cast< const VariableOperandT* >(op);
-        PointerAbsValueT value = this->get_pointer(variable_op->var());
-        value.add_offset(variable_op->offset());
+        PointerAbsValueT value = this->pointer_value(id);
+        if (this->_track_offsets) {
+          value.add_offset(variable_op->offset());
+        }
         return value;
       }
       case OperandT::AddressKind: {
         auto address_op = static_cast< const AddressOperandT* >(op);
         return PointerAbsValueT(PointsToSetT{address_op->address()},
-                                address_op->offset(),
+                                this->_track_offsets
+                                    ? address_op->offset()
+                                    : machine_int::Interval::top(
+                                          this->_offsets_bit_width,
+                                          this->_offsets_sign),
                                 Nullity::top(),
                                 Uninitialized::top());
       }
@@ -605,98 +968,167 @@ private:
 
 public:
   /// \brief Return the abstract value for the given pointer
-  PointerAbsValueT get_pointer(VariableRef p) {
-    auto it = this->_pointers.find(p);
-    if (it == this->_pointers.end()) {
-      return PointerAbsValueT::bottom(this->_offsets_bit_width,
-                                      this->_offsets_sign);
+  PointerAbsValueT get_pointer(VariableRef p) const {
+    auto it = this->_pointer_ids.find(p);
+    if (it == this->_pointer_ids.end()) {
+      return this->bottom();
     } else {
-      return it->second;
+      return this->pointer_value(it->second);
     }
   }
 
   /// \brief Begin iterator over the pairs (pointer, abstract value)
-  PointerIterator pointer_begin() const { return this->_pointers.cbegin(); }
+  PointerIterator pointer_begin() const {
+    return PointerIterator(this->_defined_pointers.cbegin(),
+                           EntryAt< PointerEntry >{&this->_pointers});
+  }
 
   /// \brief End iterator over the pairs (pointer, abstract value)
-  PointerIterator pointer_end() const { return this->_pointers.cend(); }
+  PointerIterator pointer_end() const {
+    return PointerIterator(this->_defined_pointers.cend(),
+                           EntryAt< PointerEntry >{&this->_pointers});
+  }
 
   /// \brief Return the abstract value for pointers stored at the given memory
   /// location
-  PointerAbsValueT get_memory(MemoryLocationRef m) {
-    auto it = this->_memory.find(m);
-    if (it == this->_memory.end()) {
-      return PointerAbsValueT::bottom(this->_offsets_bit_width,
-                                      this->_offsets_sign);
+  PointerAbsValueT get_memory(MemoryLocationRef m) const {
+    auto it = this->_memory_ids.find(m);
+    if (it == this->_memory_ids.end()) {
+      return this->bottom();
     } else {
-      return it->second;
+      return this->_memory[it->second].second;
     }
   }
 
   /// \brief Begin iterator over the pairs (memory location, abstract value)
-  MemoryIterator memory_begin() const { return this->_memory.cbegin(); }
+  MemoryIterator memory_begin() const {
+    return MemoryIterator(this->_defined_memory.cbegin(),
+                          EntryAt< MemoryEntry >{&this->_memory});
+  }
 
   /// \brief End iterator over the pairs (memory location, abstract value)
-  MemoryIterator memory_end() const { return this->_memory.cend(); }
+  MemoryIterator memory_end() const {
+    return MemoryIterator(this->_defined_memory.cend(),
+                          EntryAt< MemoryEntry >{&this->_memory});
+  }
 
 private:
+  /// \brief Record that the given pointer variable has a value
+  void define_pointer(Id p) {
+    if (!this->_pointer_defined[p]) {
+      this->_pointer_defined[p] = true;
+      this->_defined_pointers.push_back(p);
+    }
+  }
+
   /// \brief Add a pointer abstraction for the given pointer
-  void add_pointer(VariableRef p,
-                   const PointerAbsValueT& value,
-                   const BinaryOp& op) {
-    // Get a reference on the current value
-    auto it = this->_pointers.find(p);
-    if (it == this->_pointers.end()) {
-      // add default value
-      auto res = this->_pointers
-                     .emplace(p,
-                              PointerAbsValueT::bottom(this->_offsets_bit_width,
-                                                       this->_offsets_sign));
-      it = res.first;
+  void add_pointer(Id p, const PointerAbsValueT& value, const BinaryOp& op) {
+    p = this->_representatives[p];
+
+    this->define_pointer(p);
+    if (!this->add_apply(this->_pointers[p].second,
+                         value,
+                         op,
+                         this->_pointer_updates[p])) {
+      return;
+    }
+
+    for (std::size_t i : this->_pointer_users[p]) {
+      this->schedule(i);
     }
-    this->add_apply(it->second, value, op);
   }
 
   /// \brief Add a pointer abstraction for the given memory location
-  void add_memory(MemoryLocationRef m,
-                  const PointerAbsValueT& value,
-                  const BinaryOp& op) {
-    // Get a reference on the current value
-    auto it = this->_memory.find(m);
-    if (it == this->_memory.end()) {
-      // add default value
-      auto res = this->_memory
-                     .emplace(m,
-                              PointerAbsValueT::bottom(this->_offsets_bit_width,
-                                                       this->_offsets_sign));
-      it = res.first;
+  void add_memory(Id m, const PointerAbsValueT& value, const BinaryOp& op) {
+    if (!this->_memory_defined[m]) {
+      this->_memory_defined[m] = true;
+      this->_defined_memory.push_back(m);
+    }
+    if (!this->add_apply(this->_memory[m].second,
+                         value,
+                         op,
+                         this->_memory_updates[m])) {
+      return;
+    }
+
+    for (std::size_t i : this->_memory_users[m]) {
+      this->_states[i].dirty.add(this->_memory[m].first);
+      this->schedule(i);
     }
-    this->add_apply(it->second, value, op);
   }
 
   /// \brief Add `after` in `before`, applying the given binary operator `op`
-  void add_apply(PointerAbsValueT& before,
+  ///
+  /// Returns true if `before` was updated.
+  bool add_apply(PointerAbsValueT& before,
                  const PointerAbsValueT& after,
-                 const BinaryOp& op) {
-    if (!op.convergence_achieved(before, after)) {
-      this->_change_seen = true;
-      op.apply(before, after, this->_iteration);
+                 const BinaryOp& op,
+                 std::size_t& updates) {
+    if (op.convergence_achieved(before, after)) {
+      return false;
     }
+    op.apply(before, after, updates++);
+    return true;
   }
 
 public:
   /// \brief Solve the constraint system
-  void solve(std::size_t widening_threshold = 50,
-             std::size_t /*narrowing_threshold*/ = 1) {
-    this->_iteration = 0;
+  ///
+  /// Constraints are processed with a worklist: a constraint is only
+  /// processed again when one of the values it reads is updated.
+  ///
+  /// \param widening_threshold Number of updates of a value using a join,
+  ///   before the widening is applied
+  /// \param track_offsets If false, all offsets are top and only the points-to
+  ///   sets are computed. This converges without any widening, and is enough
+  ///   when the offsets are recomputed later, e.g by the value analysis.
+  void solve(std::size_t widening_threshold = 50, bool track_offsets = true) {
     Extrapolate widening_op(widening_threshold);
-    do {
-      this->_iteration++;
-      this->_change_seen = false;
-      this->step(widening_op);
-    } while (this->_change_seen);
+    this->_track_offsets = track_offsets;
+
+    this->number_operands();
+    this->collapse_cycles();
+    this->build_dependencies();
+
+    this->_pointer_updates.assign(this->_pointers.size(), 0);
+    this->_memory_updates.assign(this->_memory.size(), 0);
+    this->_states.clear();
+    this->_states.reserve(this->_csts.size());
+    for (std::size_t i = 0; i < this->_csts.size(); i++) {
+      this->_states.push_back(ConstraintState{PointsToSetT::empty(),
+                                              PointsToSetT::empty(),
+                                              this->bottom()});
+    }
+    this->_pending.assign(this->_csts.size(), false);
+    for (std::size_t i = 0; i < this->_csts.size(); i++) {
+      this->schedule(i);
+    }
+
+    while (!this->_worklist.empty()) {
+      std::size_t i = this->_worklist.front();
+      this->_worklist.pop_front();
+      this->_pending[i] = false;
+      this->process_constraint(i, widening_op);
+    }
+
+    // Copy the value of each representative to the collapsed variables
+    for (Id p = 0; p < this->_pointers.size(); p++) {
+      Id rep = this->_representatives[p];
+      if (rep != p && this->_pointer_defined[rep]) {
+        this->_pointers[p].second = this->_pointers[rep].second;
+        this->define_pointer(p);
+      }
+    }
 
-    // TODO(marthaud): commented out because this is unsound.
+    // Release the memory used by the resolution
+    std::vector< std::vector< std::size_t > >().swap(this->_pointer_users);
+    std::vector< std::vector< std::size_t > >().swap(this->_memory_users);
+    std::vector< std::size_t >().swap(this->_pointer_updates);
+    std::vector< std::size_t >().swap(this->_memory_updates);
+    std::vector< ConstraintState >().swap(this->_states);
+    std::vector< bool >().swap(this->_pending);
+
+    // TODO(marthaud): The narrowing step is disabled because it is unsound.
     //
     // The algorithm here does not compute a proper fixpoint, because the
     // widening and narrowing operations should be applied between two
@@ -704,15 +1136,7 @@ public:
     // same pointer, thus calling the widening/narrowing several times on the
     // same iteration. This is unsound.
     //
-    // As a short fix, the narrowing step is disabled.
-    //
     // See https://babelfish.arc.nasa.gov/jira/projects/IKOS/issues/IKOS-71
-
-    // Refine narrowing_op;
-    // this->_iteration = 0;
-    // for (; this->_iteration < narrowing_threshold; ++this->_iteration) {
-    //  this->step(narrowing_op);
-    // }
   }
 
   /// \brief Dump the constraint system, for debugging purpose
@@ -45,6 +45,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <ikos/core/adt/dense_map.hpp>
 #include <ikos/core/adt/patricia_tree/map.hpp>
 #include <ikos/core/domain/abstract_domain.hpp>
 
@@ -52,6 +57,11 @@ namespace ikos {
 namespace core {
 
 /// \brief Generic implementation of non-relational domains
+///
+/// The abstract values are stored in a patricia tree, indexed by
+/// IndexableTraits. If Key implements DenseIndexableTraits, the domain
+/// switches to a dense map when the dense indexes of the bound keys are close
+/// to each other (see DenseMinSize, DenseEnterRatio and DenseLeaveRatio).
 template < typename Key, typename Value >
 class SeparateDomain final
     : public AbstractDomain< SeparateDomain< Key, Value > > {
@@ -61,12 +71,26 @@ public:
 
 private:
   using PatriciaTreeMapT = PatriciaTreeMap< Key, Value >;
+  using DenseMapT = DenseMap< Key, Value >;
+
+  /// \brief Minimum number of elements to use the dense map
+  static constexpr std::size_t DenseMinSize = 32;
+
+  /// \brief Switch to the dense map when the elements use at least
+  /// 1/DenseEnterRatio of the slots
+  static constexpr std::size_t DenseEnterRatio = 4;
+
+  /// \brief Switch back to the patricia tree when the elements use less than
+  /// 1/DenseLeaveRatio of the slots
+  static constexpr std::size_t DenseLeaveRatio = 8;
 
 public:
-  using Iterator = typename PatriciaTreeMapT::Iterator;
+  class Iterator;
 
 private:
   PatriciaTreeMapT _tree;
+  DenseMapT _dense;
+  bool _is_dense = false;
   bool _is_bottom;
 
 private:
@@ -108,29 +132,40 @@ public:
   /// \brief Begin iterator over the pairs (key, value)
   Iterator begin() const {
     ikos_assert(!this->is_bottom());
-    return this->_tree.begin();
+    if (this->_is_dense) {
+      return Iterator(this->_dense.begin());
+    } else {
+      return Iterator(this->_tree.begin());
+    }
   }
 
   /// \brief End iterator over the pairs (key, value)
   Iterator end() const {
     ikos_assert(!this->is_bottom());
-    return this->_tree.end();
+    if (this->_is_dense) {
+      return Iterator(this->_dense.end());
+    } else {
+      return Iterator(this->_tree.end());
+    }
   }
 
+  /// \brief Return true if the abstract values are stored in a dense map
+  bool is_dense() const { return this->_is_dense; }
+
   bool is_bottom() const override { return this->_is_bottom; }
 
   bool is_top() const override {
-    return !this->is_bottom() && this->_tree.empty();
+    return !this->is_bottom() && this->size() == 0;
   }
 
   void set_to_bottom() override {
     this->_is_bottom = true;
-    this->_tree.clear();
+    this->clear();
   }
 
   void set_to_top() override {
     this->_is_bottom = false;
-    this->_tree.clear();
+    this->clear();
   }
 
   bool leq(const SeparateDomain& other) const override {
@@ -139,8 +174,10 @@ public:
     } else if (other.is_bottom()) {
       return false;
     } else {
-      return this->_tree.leq(other._tree, [](const Value& x, const Value& y) {
-        return x.leq(y);
+      return this->compare(other, [](const auto& left, const auto& right) {
+        return left.leq(right, [](const Value& x, const Value& y) {
+          return x.leq(y);
+        });
       });
     }
   }
@@ -151,10 +188,11 @@ public:
     } else if (other.is_bottom()) {
       return false;
     } else {
-      return this->_tree.equals(other._tree,
-                                [](const Value& x, const Value& y) {
-                                  return x.equals(y);
-                                });
+      return this->compare(other, [](const auto& left, const auto& right) {
+        return left.equals(right, [](const Value& x, const Value& y) {
+          return x.equals(y);
+        });
+      });
     }
   }
 
@@ -164,15 +202,9 @@ public:
     } else if (this->is_bottom()) {
       this->operator=(other);
     } else {
-      this->_tree.intersect_with(other._tree,
-                                 [](const Value& x, const Value& y) {
-                                   Value z = x.join(y);
-                                   if (z.is_top()) {
-                                     return boost::optional< Value >(
-                                         boost::none);
-                                   }
-                                   return boost::optional< Value >(z);
-                                 });
+      this->intersect_with(other, [](const Value& x, const Value& y) {
+        return x.join(y);
+      });
     }
   }
 
@@ -182,15 +214,9 @@ public:
     } else if (this->is_bottom()) {
       this->operator=(other);
     } else {
-      this->_tree.intersect_with(other._tree,
-                                 [](const Value& x, const Value& y) {
-                                   Value z = x.join_loop(y);
-                                   if (z.is_top()) {
-                                     return boost::optional< Value >(
-                                         boost::none);
-                                   }
-                                   return boost::optional< Value >(z);
-                                 });
+      this->intersect_with(other, [](const Value& x, const Value& y) {
+        return x.join_loop(y);
+      });
     }
   }
 
@@ -200,15 +226,9 @@ public:
     } else if (this->is_bottom()) {
       this->operator=(other);
     } else {
-      this->_tree.intersect_with(other._tree,
-                                 [](const Value& x, const Value& y) {
-                                   Value z = x.join_loop(y);
-                                   if (z.is_top()) {
-                                     return boost::optional< Value >(
-                                         boost::none);
-                                   }
-                                   return boost::optional< Value >(z);
-                                 });
+      this->intersect_with(other, [](const Value& x, const Value& y) {
+        return x.join_loop(y);
+      });
     }
   }
 
@@ -218,15 +238,9 @@ public:
     } else if (this->is_bottom()) {
       this->operator=(other);
     } else {
-      this->_tree.intersect_with(other._tree,
-                                 [](const Value& x, const Value& y) {
-                                   Value z = x.widening(y);
-                                   if (z.is_top()) {
-                                     return boost::optional< Value >(
-                                         boost::none);
-                                   }
-                                   return boost::optional< Value >(z);
-                                 });
+      this->intersect_with(other, [](const Value& x, const Value& y) {
+        return x.widening(y);
+      });
     }
   }
 
@@ -236,17 +250,9 @@ public:
     } else if (other.is_bottom()) {
       this->set_to_bottom();
     } else {
-      try {
-        this->_tree.join_with(other._tree, [](const Value& x, const Value& y) {
-          Value z = x.meet(y);
-          if (z.is_bottom()) {
-            throw BottomFound();
-          }
-          return boost::optional< Value >(z);
-        });
-      } catch (BottomFound&) {
-        this->set_to_bottom();
-      }
+      this->union_with(other, [](const Value& x, const Value& y) {
+        return x.meet(y);
+      });
     }
   }
 
@@ -256,17 +262,9 @@ public:
     } else if (other.is_bottom()) {
       this->set_to_bottom();
     } else {
-      try {
-        this->_tree.join_with(other._tree, [](const Value& x, const Value& y) {
-          Value z = x.narrowing(y);
-          if (z.is_bottom()) {
-            throw BottomFound();
-          }
-          return boost::optional< Value >(z);
-        });
-      } catch (BottomFound&) {
-        this->set_to_bottom();
-      }
+      this->union_with(other, [](const Value& x, const Value& y) {
+        return x.narrowing(y);
+      });
     }
   }
 
@@ -277,9 +275,15 @@ public:
     } else if (value.is_bottom()) {
       this->set_to_bottom();
     } else if (value.is_top()) {
-      this->_tree.erase(key);
+      this->forget(key);
     } else {
-      this->_tree.insert_or_assign(key, value);
+      std::size_t old_size = this->size();
+      if (this->_is_dense) {
+        this->_dense.insert_or_assign(key, value);
+      } else {
+        this->_tree.insert_or_assign(key, value);
+      }
+      this->update_representation(old_size);
     }
   }
 
@@ -292,17 +296,21 @@ public:
     } else if (value.is_top()) {
       return;
     } else {
+      auto meet = [](const Value& x, const Value& y) {
+        Value z = x.meet(y);
+        if (z.is_bottom()) {
+          throw BottomFound();
+        }
+        return boost::optional< Value >(z);
+      };
+      std::size_t old_size = this->size();
       try {
-        this->_tree.update_or_insert(
-            [](const Value& x, const Value& y) {
-              Value z = x.meet(y);
-              if (z.is_bottom()) {
-                throw BottomFound();
-              }
-              return boost::optional< Value >(z);
-            },
-            key,
-            value);
+        if (this->_is_dense) {
+          this->_dense.update_or_insert(meet, key, value);
+        } else {
+          this->_tree.update_or_insert(meet, key, value);
+        }
+        this->update_representation(old_size);
       } catch (BottomFound&) {
         this->set_to_bottom();
       }
@@ -314,7 +322,12 @@ public:
     if (this->is_bottom()) {
       return;
     }
-    this->_tree.erase(key);
+    if (this->_is_dense) {
+      this->_dense.erase(key);
+      this->update_representation(this->size() + 1);
+    } else {
+      this->_tree.erase(key);
+    }
   }
 
   /// \brief Get the abstract value for the given key
@@ -322,7 +335,8 @@ public:
     if (this->is_bottom()) {
       return Value::bottom();
     } else {
-      boost::optional< const Value& > v = this->_tree.at(key);
+      boost::optional< const Value& > v =
+          this->_is_dense ? this->_dense.at(key) : this->_tree.at(key);
       if (v) {
         return *v;
       } else {
@@ -331,9 +345,16 @@ public:
     }
   }
 
+  std::size_t size_in_bytes() const override {
+    return sizeof(SeparateDomain) + this->_tree.size_in_bytes() +
+           this->_dense.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override {
     if (this->is_bottom()) {
       o << "⊥";
+    } else if (this->_is_dense) {
+      this->_dense.dump(o);
     } else {
       this->_tree.dump(o);
     }
@@ -341,7 +362,219 @@ public:
 
   static std::string name() { return "separate domain of " + Value::name(); }
 
+private:
+  /// \brief Return the number of bound keys
+  std::size_t size() const {
+    return this->_is_dense ? this->_dense.size() : this->_tree.size();
+  }
+
+  /// \brief Remove all the bound keys
+  void clear() {
+    this->_tree.clear();
+    this->_dense.clear();
+    this->_is_dense = false;
+  }
+
+  /// \brief Compare with `other`, given a comparison on the underlying maps
+  template < typename Compare >
+  bool compare(const SeparateDomain& other, const Compare& cmp) const {
+    if (this->_is_dense == other._is_dense) {
+      return this->_is_dense ? cmp(this->_dense, other._dense)
+                             : cmp(this->_tree, other._tree);
+    } else if (this->_is_dense) {
+      return cmp(this->_dense, to_dense(other._tree));
+    } else {
+      return cmp(this->_tree, to_tree(other._dense));
+    }
+  }
+
+  /// \brief Only keep the keys bound on both sides, to `op(left, right)`,
+  /// unless it is top
+  template < typename BinaryOp >
+  void intersect_with(const SeparateDomain& other, const BinaryOp& op) {
+    auto combine = [&op](const Value& x, const Value& y) {
+      Value z = op(x, y);
+      if (z.is_top()) {
+        return boost::optional< Value >(boost::none);
+      }
+      return boost::optional< Value >(z);
+    };
+    std::size_t old_size = this->size();
+    if (this->_is_dense == other._is_dense) {
+      if (this->_is_dense) {
+        this->_dense.intersect_with(other._dense, combine);
+      } else {
+        this->_tree.intersect_with(other._tree, combine);
+      }
+    } else if (this->_is_dense) {
+      this->_dense.intersect_with(to_dense(other._tree), combine);
+    } else {
+      this->_tree.intersect_with(to_tree(other._dense), combine);
+    }
+    this->update_representation(old_size);
+  }
+
+  /// \brief Keep the keys bound on either side, with `op(left, right)` for
+  /// the keys bound on both sides, or set to bottom if it is bottom
+  template < typename BinaryOp >
+  void union_with(const SeparateDomain& other, const BinaryOp& op) {
+    auto combine = [&op](const Value& x, const Value& y) {
+      Value z = op(x, y);
+      if (z.is_bottom()) {
+        throw BottomFound();
+      }
+      return boost::optional< Value >(z);
+    };
+    std::size_t old_size = this->size();
+    try {
+      if (this->_is_dense == other._is_dense) {
+        if (this->_is_dense) {
+          this->_dense.join_with(other._dense, combine);
+        } else {
+          this->_tree.join_with(other._tree, combine);
+        }
+      } else if (this->_is_dense) {
+        this->_dense.join_with(to_dense(other._tree), combine);
+      } else {
+        this->_tree.join_with(to_tree(other._dense), combine);
+      }
+      this->update_representation(old_size);
+    } catch (BottomFound&) {
+      this->set_to_bottom();
+    }
+  }
+
+  /// \brief Return the dense map with the elements of the given tree
+  static DenseMapT to_dense(const PatriciaTreeMapT& tree) {
+    DenseMapT dense;
+    for (const auto& entry : tree) {
+      dense.insert_or_assign(entry.first, entry.second);
+    }
+    return dense;
+  }
+
+  /// \brief Return the patricia tree with the elements of the given dense map
+  static PatriciaTreeMapT to_tree(const DenseMapT& dense) {
+    std::vector< std::pair< Key, Value > > entries(dense.begin(), dense.end());
+    std::sort(entries.begin(),
+              entries.end(),
+              [](const auto& a, const auto& b) {
+                return patricia_tree_utils::tree_order_less(
+                    IndexableTraits< Key >::index(a.first),
+                    IndexableTraits< Key >::index(b.first));
+              });
+    return PatriciaTreeMapT::from_sorted_range(entries.begin(), entries.end());
+  }
+
+  /// \brief Switch between the patricia tree and the dense map, depending on
+  /// the density of the dense indexes of the keys
+  ///
+  /// The density of a patricia tree is only computed when its size grows past
+  /// a power of 2 (since `old_size`), so that the cost is amortized over the
+  /// insertions.
+  void update_representation(std::size_t old_size) {
+    if (!DenseMapT::enabled || this->_is_bottom) {
+      return;
+    }
+    if (this->_is_dense) {
+      std::size_t size = this->_dense.size();
+      if (size < DenseMinSize / 2 ||
+          size * DenseLeaveRatio < this->_dense.span()) {
+        this->_tree = to_tree(this->_dense);
+        this->_dense.clear();
+        this->_is_dense = false;
+      }
+      return;
+    }
+    std::size_t size = this->_tree.size();
+    if (size < DenseMinSize || size <= old_size ||
+        (size ^ old_size) <= old_size) {
+      return;
+    }
+    DenseMapT dense = to_dense(this->_tree);
+    if (size * DenseEnterRatio >= dense.span()) {
+      this->_dense = std::move(dense);
+      this->_tree.clear();
+      this->_is_dense = true;
+    }
+  }
+
+public:
+  /// \brief Iterator over the pairs (key, value) of a separate domain
+  class Iterator final {
+  public:
+    // Required types for iterators
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = const std::pair< Key, Value >;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::pair< Key, Value >*;
+    using reference = const std::pair< Key, Value >&;
+
+  private:
+    typename PatriciaTreeMapT::Iterator _tree_it;
+    typename DenseMapT::Iterator _dense_it;
+    bool _is_dense = false;
+
+  public:
+    /// \brief Create an end iterator
+    Iterator() = default;
+
+    /// \brief Create an iterator on a patricia tree
+    explicit Iterator(typename PatriciaTreeMapT::Iterator it)
+        : _tree_it(std::move(it)) {}
+
+    /// \brief Create an iterator on a dense map
+    explicit Iterator(typename DenseMapT::Iterator it)
+        : _dense_it(it), _is_dense(true) {}
+
+    /// \brief Pre-increment the iterator
+    Iterator& operator++() {
+      if (this->_is_dense) {
+        ++this->_dense_it;
+      } else {
+        ++this->_tree_it;
+      }
+      return *this;
+    }
+
+    /// \brief Post-increment the iterator
+    const Iterator operator++(int) {
+      Iterator r = *this;
+      ++(*this);
+      return r;
+    }
+
+    /// \brief Compare two iterators
+    bool operator==(const Iterator& other) const {
+      return this->_is_dense ? this->_dense_it == other._dense_it
+                             : this->_tree_it == other._tree_it;
+    }
+
+    /// \brief Compare two iterators
+    bool operator!=(const Iterator& other) const {
+      return !this->operator==(other);
+    }
+
+    /// \brief Dereference the iterator
+    reference operator*() const {
+      return this->_is_dense ? *this->_dense_it : *this->_tree_it;
+    }
+
+    /// \brief Dereference the iterator
+    pointer operator->() const { return &this->operator*(); }
+
+  }; // end class Iterator
+
 }; // end class SeparateDomain
 
+template < typename Key, typename Value >
+constexpr std::size_t SeparateDomain< Key, Value >::DenseMinSize;
+
+template < typename Key, typename Value >
+constexpr std::size_t SeparateDomain< Key, Value >::DenseEnterRatio;
+
+template < typename Key, typename Value >
+constexpr std::size_t SeparateDomain< Key, Value >::DenseLeaveRatio;
+
 } // end namespace core
 } // end namespace ikos
@@ -206,6 +206,10 @@ public:
 
   Uninitialized get(VariableRef x) const override { return this->_inv.get(x); }
 
+  std::size_t size_in_bytes() const override {
+    return this->_inv.size_in_bytes();
+  }
+
   void dump(std::ostream& o) const override { return this->_inv.dump(o); }
 
   static std::string name() { return "uninitialized domain"; }
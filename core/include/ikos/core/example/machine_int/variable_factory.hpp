@@ -184,6 +184,17 @@ struct IndexableTraits< example::machine_int::VariableFactory::VariableRef > {
   }
 };
 
+/// \brief Implement DenseIndexableTraits for
+/// example::machine_int::VariableFactory::VariableRef
+template <>
+struct DenseIndexableTraits<
+    example::machine_int::VariableFactory::VariableRef > {
+  static Index dense_index(
+      const example::machine_int::VariableFactory::VariableRef& var) {
+    return var->index();
+  }
+};
+
 /// \brief Implement DumpableTraits for
 /// example::machine_int::VariableFactory::VariableRef
 template <>
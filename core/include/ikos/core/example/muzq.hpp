@@ -426,6 +426,9 @@ private:
   // Name
   std::string _name;
 
+  // Index in the control flow graph
+  std::size_t _index;
+
   // List of statements
   std::vector< std::unique_ptr< StatementT > > _statements;
 
@@ -437,7 +440,8 @@ private:
 
 private:
   /// \brief Private constructor
-  explicit BasicBlock(std::string name) : _name(std::move(name)) {}
+  BasicBlock(std::string name, std::size_t index)
+      : _name(std::move(name)), _index(index) {}
 
 public:
   /// \brief Deleted copy constructor
@@ -458,6 +462,9 @@ public:
   /// \brief Return the name
   const std::string& name() const { return this->_name; }
 
+  /// \brief Return the index in the control flow graph
+  std::size_t index() const { return this->_index; }
+
   /// \brief Begin iterator over the statements
   StatementIterator begin() const {
     return boost::make_transform_iterator(this->_statements.cbegin(),
@@ -571,6 +578,9 @@ public:
   /// \brief Return the entry point
   BasicBlockT* entry() const { return this->_entry; }
 
+  /// \brief Return the number of basic blocks
+  std::size_t size() const { return this->_blocks.size(); }
+
   /// \brief Begin iterator over the basic blocks
   BasicBlockIterator begin() const {
     return boost::make_transform_iterator(this->_blocks.cbegin(),
@@ -593,7 +603,7 @@ public:
     if (it != this->_blocks.end()) {
       return it->second.get();
     } else {
-      auto bb = new BasicBlockT(name);
+      auto bb = new BasicBlockT(name, this->_blocks.size());
       this->_blocks.emplace(name, std::unique_ptr< BasicBlockT >(bb));
       return bb;
     }
@@ -685,6 +695,10 @@ struct GraphTraits< muzq::ControlFlowGraph< VariableRef >* > {
   static PredecessorNodeIterator predecessor_end(NodeRef bb) {
     return bb->predecessor_end();
   }
+
+  static std::size_t index(NodeRef bb) { return bb->index(); }
+
+  static std::size_t num_indices(GraphRef cfg) { return cfg->size(); }
 };
 
 } // end namespace core
@@ -167,6 +167,15 @@ struct IndexableTraits< example::VariableFactory::VariableRef > {
   }
 };
 
+/// \brief Implement DenseIndexableTraits for
+/// example::VariableFactory::VariableRef
+template <>
+struct DenseIndexableTraits< example::VariableFactory::VariableRef > {
+  static Index dense_index(const example::VariableFactory::VariableRef& var) {
+    return var->index();
+  }
+};
+
 /// \brief Implement DumpableTraits for example::VariableFactory::VariableRef
 template <>
 struct DumpableTraits< example::VariableFactory::VariableRef > {
@@ -0,0 +1,155 @@
+/*******************************************************************************
+ *
+ * \brief Tracing hooks for fixpoint iterators
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+namespace ikos {
+namespace core {
+
+/// \brief Kind of event traced during a fixpoint computation
+enum class FixpointEvent {
+  /// \brief Analysis of a node, including the head of a cycle
+  Node,
+
+  /// \brief Stabilization of a cycle of the weak topological order
+  Cycle,
+
+  /// \brief Increasing iteration over a cycle
+  IncreasingIteration,
+
+  /// \brief Decreasing iteration over a cycle
+  DecreasingIteration,
+
+  /// \brief Extrapolation (widening) step on the head of a cycle
+  Extrapolate,
+
+  /// \brief Refinement (narrowing) step on the head of a cycle
+  Refine,
+};
+
+/// \brief Tracing hooks for fixpoint iterators
+///
+/// A fixpoint iterator with a tracer calls begin() and end() around each
+/// event, with properly nested events on a given thread. Without a tracer,
+/// the only cost is a null pointer check per event.
+template < typename NodeRef >
+class FixpointTracer {
+public:
+  /// \brief Default constructor
+  FixpointTracer() = default;
+
+  /// \brief Copy constructor
+  FixpointTracer(const FixpointTracer&) = default;
+
+  /// \brief Move constructor
+  FixpointTracer(FixpointTracer&&) = default;
+
+  /// \brief Copy assignment operator
+  FixpointTracer& operator=(const FixpointTracer&) = default;
+
+  /// \brief Move assignment operator
+  FixpointTracer& operator=(FixpointTracer&&) = default;
+
+  /// \brief Called at the beginning of an event
+  ///
+  /// \param event Kind of event
+  /// \param node Analyzed node, or head of the cycle
+  /// \param iteration Iteration number, or 0 for Node and Cycle events
+  virtual void begin(FixpointEvent event, NodeRef node, unsigned iteration) = 0;
+
+  /// \brief Called at the end of an event
+  ///
+  /// \param event Kind of event
+  /// \param node Analyzed node, or head of the cycle
+  /// \param iteration Iteration number, or 0 for Node and Cycle events
+  virtual void end(FixpointEvent event, NodeRef node, unsigned iteration) = 0;
+
+  /// \brief Destructor
+  virtual ~FixpointTracer() = default;
+
+}; // end class FixpointTracer
+
+/// \brief Trace an event for the lifetime of the object, if the given tracer
+/// is not null
+template < typename NodeRef >
+class FixpointTraceScope {
+private:
+  FixpointTracer< NodeRef >* _tracer;
+  FixpointEvent _event;
+  NodeRef _node;
+  unsigned _iteration;
+
+public:
+  /// \brief Begin the event
+  FixpointTraceScope(FixpointTracer< NodeRef >* tracer,
+                     FixpointEvent event,
+                     NodeRef node,
+                     unsigned iteration = 0)
+      : _tracer(tracer), _event(event), _node(node), _iteration(iteration) {
+    if (this->_tracer != nullptr) {
+      this->_tracer->begin(this->_event, this->_node, this->_iteration);
+    }
+  }
+
+  /// \brief Deleted copy constructor
+  FixpointTraceScope(const FixpointTraceScope&) = delete;
+
+  /// \brief Deleted move constructor
+  FixpointTraceScope(FixpointTraceScope&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  FixpointTraceScope& operator=(const FixpointTraceScope&) = delete;
+
+  /// \brief Deleted move assignment operator
+  FixpointTraceScope& operator=(FixpointTraceScope&&) = delete;
+
+  /// \brief End the event
+  ~FixpointTraceScope() {
+    if (this->_tracer != nullptr) {
+      this->_tracer->end(this->_event, this->_node, this->_iteration);
+    }
+  }
+
+}; // end class FixpointTraceScope
+
+} // end namespace core
+} // end namespace ikos
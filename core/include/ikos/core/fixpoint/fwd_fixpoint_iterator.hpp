@@ -47,11 +47,21 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <ikos/core/fixpoint/fixpoint_iterator.hpp>
+#include <ikos/core/fixpoint/fixpoint_tracer.hpp>
+#include <ikos/core/fixpoint/invariant_table.hpp>
 #include <ikos/core/fixpoint/wto.hpp>
 
 namespace ikos {
@@ -65,6 +75,9 @@ class WtoIterator;
 template < typename GraphRef, typename AbstractValue, typename GraphTrait >
 class WtoProcessor;
 
+template < typename GraphRef, typename GraphTrait >
+class WtoNodeCollector;
+
 } // end namespace interleaved_fwd_fixpoint_iterator_impl
 
 template < typename GraphRef,
@@ -75,28 +88,52 @@ class InterleavedFwdFixpointIterator
   friend class interleaved_fwd_fixpoint_iterator_impl::
       WtoIterator< GraphRef, AbstractValue, GraphTrait >;
 
+public:
+  using WtoT = Wto< GraphRef, GraphTrait >;
+
 private:
   using NodeRef = typename GraphTrait::NodeRef;
-  using InvariantTable = std::unordered_map< NodeRef, AbstractValue >;
+  using TracerT = FixpointTracer< NodeRef >;
+  using InvariantTable = typename InvariantTableTraits< GraphRef,
+                                                        AbstractValue,
+                                                        GraphTrait >::Table;
   using InvariantTablePtr = std::shared_ptr< InvariantTable >;
-  using WtoT = Wto< GraphRef, GraphTrait >;
+  using WtoComponentT = WtoComponent< GraphRef, GraphTrait >;
   using WtoIterator = interleaved_fwd_fixpoint_iterator_impl::
       WtoIterator< GraphRef, AbstractValue, GraphTrait >;
   using WtoProcessor = interleaved_fwd_fixpoint_iterator_impl::
       WtoProcessor< GraphRef, AbstractValue, GraphTrait >;
+  using WtoNodeCollector = interleaved_fwd_fixpoint_iterator_impl::
+      WtoNodeCollector< GraphRef, GraphTrait >;
 
 private:
   GraphRef _cfg;
   WtoT _wto;
   InvariantTablePtr _pre, _post;
 
+  /// \brief Mutex protecting the invariant tables, during run_concurrent()
+  std::mutex* _table_mutex = nullptr;
+
+  /// \brief Tracer, or null
+  TracerT* _tracer = nullptr;
+
 public:
   /// \brief Create an interleaved forward fixpoint iterator
   explicit InterleavedFwdFixpointIterator(GraphRef cfg)
       : _cfg(cfg),
         _wto(cfg),
-        _pre(std::make_shared< InvariantTable >()),
-        _post(std::make_shared< InvariantTable >()) {}
+        _pre(std::make_shared< InvariantTable >(cfg)),
+        _post(std::make_shared< InvariantTable >(cfg)) {}
+
+  /// \brief Create an interleaved forward fixpoint iterator, using a
+  /// precomputed weak topological order of the graph
+  ///
+  /// The weak topological order is shared and never modified.
+  InterleavedFwdFixpointIterator(GraphRef cfg, WtoT wto)
+      : _cfg(cfg),
+        _wto(std::move(wto)),
+        _pre(std::make_shared< InvariantTable >(cfg)),
+        _post(std::make_shared< InvariantTable >(cfg)) {}
 
   /// \brief Copy constructor
   InterleavedFwdFixpointIterator(const InterleavedFwdFixpointIterator&) =
@@ -119,50 +156,94 @@ public:
   /// \brief Get the weak topological order of the graph
   const WtoT& wto() const { return this->_wto; }
 
-private:
-  /// \brief Set the invariant for the given node
-  static void set(const InvariantTablePtr& table,
-                  NodeRef node,
-                  AbstractValue inv) {
-    auto it = table->find(node);
-    if (it != table->end()) {
-      it->second = std::move(inv);
-    } else {
-      table->emplace(node, std::move(inv));
-    }
-  }
+  /// \brief Set the tracer, or null to disable tracing
+  ///
+  /// The tracer is called from several threads in run_concurrent().
+  void set_tracer(TracerT* tracer) { this->_tracer = tracer; }
+
+  /// \brief Get the tracer, or null
+  TracerT* tracer() const { return this->_tracer; }
 
+private:
   /// \brief Set the pre invariant for the given node
   void set_pre(NodeRef node, AbstractValue inv) {
-    this->set(this->_pre, node, std::move(inv));
+    auto lock = this->lock_tables();
+    this->_pre->set(node, std::move(inv));
   }
 
   /// \brief Set the post invariant for the given node
   void set_post(NodeRef node, AbstractValue inv) {
-    this->set(this->_post, node, std::move(inv));
+    auto lock = this->lock_tables();
+    this->_post->set(node, std::move(inv));
+  }
+
+  /// \brief Return a copy of the pre invariant for the given node
+  ///
+  /// Unlike pre(), this can be called while run_concurrent() is running.
+  AbstractValue copy_pre(NodeRef node) const {
+    auto lock = this->lock_tables();
+    return this->_pre->get(node);
+  }
+
+  /// \brief Return a copy of the post invariant for the given node
+  ///
+  /// Unlike post(), this can be called while run_concurrent() is running.
+  AbstractValue copy_post(NodeRef node) const {
+    auto lock = this->lock_tables();
+    return this->_post->get(node);
   }
 
-  /// \brief Get the invariant for the given node
-  static const AbstractValue& get(const InvariantTablePtr& table,
-                                  NodeRef node) {
-    auto it = table->find(node);
-    if (it != table->end()) {
-      return it->second;
+  /// \brief Lock the invariant tables, if several threads are running
+  std::unique_lock< std::mutex > lock_tables() const {
+    if (this->_table_mutex != nullptr) {
+      return std::unique_lock< std::mutex >(*this->_table_mutex);
     } else {
-      auto res = table->emplace(node, AbstractValue::bottom());
-      return res.first->second;
+      return std::unique_lock< std::mutex >();
     }
   }
 
 public:
+  /// \brief Start from the invariants of another iterator on the same graph,
+  /// see run_incremental()
+  ///
+  /// The invariant tables are shared, as with the copy constructor.
+  void reuse_invariants(const InterleavedFwdFixpointIterator& previous) {
+    this->_pre = previous._pre;
+    this->_post = previous._post;
+  }
+
   /// \brief Get the pre invariant for the given node
+  ///
+  /// This must not be called while run_concurrent() is running.
   const AbstractValue& pre(NodeRef node) const {
-    return this->get(this->_pre, node);
+    ikos_assert(this->_table_mutex == nullptr);
+    return this->_pre->get(node);
   }
 
   /// \brief Get the post invariant for the given node
+  ///
+  /// This must not be called while run_concurrent() is running.
   const AbstractValue& post(NodeRef node) const {
-    return this->get(this->_post, node);
+    ikos_assert(this->_table_mutex == nullptr);
+    return this->_post->get(node);
+  }
+
+  /// \brief Return the abstract value at the head of a cycle for its first
+  /// iteration
+  ///
+  /// This is called each time a cycle is entered, with the join of the
+  /// abstract values coming from outside the cycle. By default, it returns it
+  /// unchanged.
+  ///
+  /// Returning a greater abstract value is sound, since the iterations still
+  /// stop on a post fixpoint. This can be used to start the iterations from a
+  /// previous fixpoint on the same cycle.
+  ///
+  /// \param head Head of the cycle
+  /// \param pre Abstract value from the edges entering the cycle
+  virtual AbstractValue initial_cycle_value(NodeRef head, AbstractValue pre) {
+    ikos_ignore(head);
+    return pre;
   }
 
   /// \brief Extrapolate the new state after an increasing iteration
@@ -234,7 +315,14 @@ public:
   }
 
   /// \brief Compute the fixpoint with the given initial abstract value
+  ///
+  /// If the graph is acyclic, this is a single pass in topological order (see
+  /// run_acyclic()).
   void run(AbstractValue init) {
+    if (this->_wto.acyclic()) {
+      this->run_acyclic(std::move(init), /* drop = */ false);
+      return;
+    }
     this->set_pre(GraphTrait::entry(this->_cfg), std::move(init));
     WtoIterator iterator(*this);
     this->_wto.accept(iterator);
@@ -242,10 +330,378 @@ public:
     this->_wto.accept(processor);
   }
 
+  /// \brief Compute the fixpoint with the given initial abstract value, and
+  /// process the invariants as soon as possible
+  ///
+  /// Unlike run(), the invariants of each top-level component of the weak
+  /// topological order are processed (see process_pre() and process_post())
+  /// as soon as the component is stable. They are then dropped, except for
+  /// the post invariants still needed by the following components.
+  ///
+  /// This bounds the memory used to the invariants of the current component,
+  /// plus the ones flowing into the next components. After this call, pre()
+  /// and post() return bottom.
+  void run_and_process(AbstractValue init) {
+    if (this->_wto.acyclic()) {
+      this->run_acyclic(std::move(init), /* drop = */ true);
+      return;
+    }
+    this->set_pre(GraphTrait::entry(this->_cfg), std::move(init));
+    WtoIterator iterator(*this);
+    WtoProcessor processor(*this);
+    std::unordered_set< NodeRef > processed;
+    std::vector< NodeRef > nodes;
+
+    for (auto it = this->_wto.begin(), et = this->_wto.end(); it != et; ++it) {
+      it->accept(iterator);
+      it->accept(processor);
+
+      // Collect the nodes of the component
+      nodes.clear();
+      WtoNodeCollector collector(nodes);
+      it->accept(collector);
+      processed.insert(nodes.begin(), nodes.end());
+
+      // Pre invariants are not needed anymore
+      for (NodeRef node : nodes) {
+        this->_pre->erase(node);
+      }
+
+      // Post invariants are needed until all successors are processed
+      auto drop_post_if_done = [&](NodeRef node) {
+        if (processed.count(node) == 0) {
+          return;
+        }
+        for (auto s = GraphTrait::successor_begin(node),
+                  e = GraphTrait::successor_end(node);
+             s != e;
+             ++s) {
+          if (processed.count(*s) == 0) {
+            return;
+          }
+        }
+        this->_post->erase(node);
+      };
+
+      for (NodeRef node : nodes) {
+        drop_post_if_done(node);
+        for (auto p = GraphTrait::predecessor_begin(node),
+                  e = GraphTrait::predecessor_end(node);
+             p != e;
+             ++p) {
+          drop_post_if_done(*p);
+        }
+      }
+    }
+
+    this->clear();
+  }
+
+private:
+  /// \brief Compute the invariants of an acyclic graph in a single pass
+  ///
+  /// The nodes are analyzed once, in topological order, and their invariants
+  /// are final as soon as they are computed. Each node is thus processed
+  /// (see process_pre() and process_post()) right after its analysis, without
+  /// a second traversal of the weak topological order.
+  ///
+  /// \param init Initial abstract value
+  /// \param drop True to drop the invariants as soon as they are not needed
+  /// anymore, as in run_and_process()
+  void run_acyclic(AbstractValue init, bool drop) {
+    this->set_pre(GraphTrait::entry(this->_cfg), std::move(init));
+    WtoIterator iterator(*this);
+    WtoProcessor processor(*this);
+    std::vector< NodeRef > nodes;
+
+    // Number of successors not analyzed yet, for each analyzed node
+    std::unordered_map< NodeRef, std::size_t > pending;
+
+    for (auto it = this->_wto.begin(), et = this->_wto.end(); it != et; ++it) {
+      it->accept(iterator);
+      it->accept(processor);
+
+      if (!drop) {
+        continue;
+      }
+
+      nodes.clear();
+      WtoNodeCollector collector(nodes);
+      it->accept(collector);
+      NodeRef node = nodes.front();
+
+      // Pre invariants are not needed anymore
+      this->_pre->erase(node);
+
+      // Post invariants are needed until all successors are analyzed
+      std::size_t num_succs = 0;
+      for (auto s = GraphTrait::successor_begin(node),
+                e = GraphTrait::successor_end(node);
+           s != e;
+           ++s) {
+        num_succs++;
+      }
+      if (num_succs == 0) {
+        this->_post->erase(node);
+      } else {
+        pending[node] = num_succs;
+      }
+
+      for (auto p = GraphTrait::predecessor_begin(node),
+                e = GraphTrait::predecessor_end(node);
+           p != e;
+           ++p) {
+        auto pending_it = pending.find(*p);
+        if (pending_it != pending.end() && --pending_it->second == 0) {
+          this->_post->erase(*p);
+          pending.erase(pending_it);
+        }
+      }
+    }
+
+    if (drop) {
+      this->clear();
+    }
+  }
+
+public:
+  /// \brief Compute the fixpoint with the given initial abstract value, using
+  /// several threads (experimental)
+  ///
+  /// The top-level components of the weak topological order only depend on
+  /// the components with an edge into them. Independent components (e.g, the
+  /// branches of a large switch) are analyzed concurrently, each with its own
+  /// abstract values, and the invariants are joined at the merge points, as
+  /// in run(). The resulting invariants are the same as the ones of run().
+  ///
+  /// analyze_node(), analyze_edge(), extrapolate(), refine() and the fixpoint
+  /// checks are called from several threads and need to be thread-safe. They
+  /// must not call pre() or post(). process_pre() and process_post() are
+  /// called by the calling thread, after convergence.
+  ///
+  /// Abstract values normalized lazily are not safe to read from several
+  /// threads. The initial abstract value and the post invariants of each
+  /// component are thus normalized before any other thread reads them.
+  ///
+  /// \param init Initial abstract value
+  /// \param jobs Number of threads, including the calling thread
+  void run_concurrent(AbstractValue init, unsigned jobs) {
+    if (jobs <= 1) {
+      this->run(std::move(init));
+      return;
+    }
+
+    init.normalize();
+    this->set_pre(GraphTrait::entry(this->_cfg), std::move(init));
+
+    // Collect the top-level components and their nodes
+    std::vector< const WtoComponentT* > components;
+    std::vector< std::vector< NodeRef > > component_nodes;
+    std::unordered_map< NodeRef, std::size_t > component_of;
+
+    for (auto it = this->_wto.begin(), et = this->_wto.end(); it != et; ++it) {
+      std::vector< NodeRef > nodes;
+      WtoNodeCollector collector(nodes);
+      it->accept(collector);
+      for (NodeRef node : nodes) {
+        component_of.emplace(node, components.size());
+      }
+      components.push_back(&*it);
+      component_nodes.push_back(std::move(nodes));
+    }
+
+    // Build the dependency graph between components
+    //
+    // Edges between top-level components always go forward in the weak
+    // topological order, thus the graph is acyclic.
+    std::size_t num_components = components.size();
+    std::vector< std::vector< std::size_t > > dependents(num_components);
+    std::vector< std::size_t > num_dependencies(num_components, 0);
+
+    for (std::size_t i = 0; i < num_components; i++) {
+      std::unordered_set< std::size_t > dependencies;
+      for (NodeRef node : component_nodes[i]) {
+        for (auto p = GraphTrait::predecessor_begin(node),
+                  e = GraphTrait::predecessor_end(node);
+             p != e;
+             ++p) {
+          auto it = component_of.find(*p);
+          // Unreachable predecessors are not part of the weak topological
+          // order and always have a bottom post invariant
+          if (it != component_of.end() && it->second != i) {
+            ikos_assert(it->second < i);
+            dependencies.insert(it->second);
+          }
+        }
+      }
+      num_dependencies[i] = dependencies.size();
+      for (std::size_t j : dependencies) {
+        dependents[j].push_back(i);
+      }
+    }
+
+    // Analyze the components as soon as their dependencies are stable
+    std::mutex mutex; // protects the variables below
+    std::condition_variable cv;
+    std::deque< std::size_t > ready;
+    std::size_t remaining = num_components;
+    std::exception_ptr error;
+
+    for (std::size_t i = 0; i < num_components; i++) {
+      if (num_dependencies[i] == 0) {
+        ready.push_back(i);
+      }
+    }
+
+    auto worker = [&]() {
+      WtoIterator iterator(*this);
+      std::unique_lock< std::mutex > lock(mutex);
+      while (true) {
+        cv.wait(lock, [&] {
+          return !ready.empty() || remaining == 0 || error != nullptr;
+        });
+        if (remaining == 0 || error != nullptr) {
+          return;
+        }
+
+        std::size_t i = ready.front();
+        ready.pop_front();
+        lock.unlock();
+
+        try {
+          components[i]->accept(iterator);
+        } catch (...) {
+          lock.lock();
+          if (error == nullptr) {
+            error = std::current_exception();
+          }
+          cv.notify_all();
+          return;
+        }
+
+        // The post invariants are read by the dependents
+        {
+          auto table_lock = this->lock_tables();
+          for (NodeRef node : component_nodes[i]) {
+            this->_post->get(node).normalize();
+          }
+        }
+
+        lock.lock();
+        remaining--;
+        for (std::size_t j : dependents[i]) {
+          if (--num_dependencies[j] == 0) {
+            ready.push_back(j);
+          }
+        }
+        cv.notify_all();
+      }
+    };
+
+    std::mutex table_mutex;
+    this->_table_mutex = &table_mutex;
+
+    std::vector< std::thread > threads;
+    threads.reserve(jobs - 1);
+    for (unsigned k = 1; k < jobs; k++) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    this->_table_mutex = nullptr;
+
+    if (error != nullptr) {
+      std::rethrow_exception(error);
+    }
+
+    WtoProcessor processor(*this);
+    this->_wto.accept(processor);
+  }
+
+  /// \brief Compute the fixpoint again after a change of some nodes, reusing
+  /// the current invariants
+  ///
+  /// The invariants must come from run() or run_concurrent(), on this
+  /// iterator or on the one given to reuse_invariants(). `dirty` holds the
+  /// nodes whose semantics or incoming edges changed since then.
+  ///
+  /// Only the top-level components of the weak topological order containing a
+  /// dirty node, or reached by an invariant that changed, are analyzed again.
+  /// The other invariants are kept. Since the analysis is deterministic, the
+  /// result is the same as with run(). All the invariants are then processed.
+  ///
+  /// Returns true if the post invariant of a node without successors changed,
+  /// i.e if the result for the callers changed.
+  bool run_incremental(AbstractValue init,
+                       const std::unordered_set< NodeRef >& dirty) {
+    NodeRef entry = GraphTrait::entry(this->_cfg);
+    bool entry_changed = !this->pre(entry).equals(init);
+    this->set_pre(entry, std::move(init));
+
+    WtoIterator iterator(*this);
+    std::unordered_set< NodeRef > changed;
+    std::vector< NodeRef > nodes;
+    std::vector< AbstractValue > old_post;
+    bool exit_changed = false;
+
+    for (auto it = this->_wto.begin(), et = this->_wto.end(); it != et; ++it) {
+      nodes.clear();
+      WtoNodeCollector collector(nodes);
+      it->accept(collector);
+
+      // Skip the component if its nodes and its inputs are unchanged
+      bool stable = true;
+      for (NodeRef node : nodes) {
+        if ((node == entry && entry_changed) || dirty.count(node) != 0) {
+          stable = false;
+          break;
+        }
+        for (auto p = GraphTrait::predecessor_begin(node),
+                  ep = GraphTrait::predecessor_end(node);
+             p != ep && stable;
+             ++p) {
+          stable = changed.count(*p) == 0;
+        }
+        if (!stable) {
+          break;
+        }
+      }
+      if (stable) {
+        continue;
+      }
+
+      old_post.clear();
+      for (NodeRef node : nodes) {
+        old_post.push_back(this->post(node));
+      }
+
+      it->accept(iterator);
+
+      for (std::size_t i = 0; i < nodes.size(); i++) {
+        NodeRef node = nodes[i];
+        if (this->post(node).equals(old_post[i])) {
+          continue;
+        }
+        changed.insert(node);
+        if (GraphTrait::successor_begin(node) ==
+            GraphTrait::successor_end(node)) {
+          exit_changed = true;
+        }
+      }
+    }
+
+    WtoProcessor processor(*this);
+    this->_wto.accept(processor);
+    return exit_changed;
+  }
+
   /// \brief Clear the current fixpoint
   void clear() {
-    this->_pre = std::make_shared< InvariantTable >();
-    this->_post = std::make_shared< InvariantTable >();
+    this->_pre = std::make_shared< InvariantTable >(this->_cfg);
+    this->_post = std::make_shared< InvariantTable >(this->_cfg);
   }
 
   /// \brief Destructor
@@ -265,6 +721,7 @@ public:
   using WtoCycleT = WtoCycle< GraphRef, GraphTrait >;
   using WtoT = Wto< GraphRef, GraphTrait >;
   using WtoNestingT = typename WtoT::WtoNestingT;
+  using TraceScopeT = FixpointTraceScope< NodeRef >;
 
 private:
   enum IterationKind { Increasing, Decreasing };
@@ -275,13 +732,22 @@ private:
 public:
   explicit WtoIterator(InterleavedIterator& iterator) : _iterator(iterator) {}
 
+private:
+  /// \brief Analyze the given node and set its post invariant
+  void analyze_node(NodeRef node, const AbstractValue& pre) {
+    TraceScopeT scope(this->_iterator.tracer(), FixpointEvent::Node, node);
+    this->_iterator.set_post(node, this->_iterator.analyze_node(node, pre));
+  }
+
+public:
+
   void visit(const WtoVertexT& vertex) override {
     NodeRef node = vertex.node();
     AbstractValue pre = AbstractValue::bottom();
 
     // Use the invariant for the entry point
     if (node == GraphTrait::entry(this->_iterator.cfg())) {
-      pre = this->_iterator.pre(node);
+      pre = this->_iterator.copy_pre(node);
     }
 
     // Collect invariants from incoming edges
@@ -291,17 +757,22 @@ public:
          ++it) {
       NodeRef pred = *it;
       pre.join_with(
-          this->_iterator.analyze_edge(pred, node, this->_iterator.post(pred)));
+          this->_iterator.analyze_edge(pred,
+                                       node,
+                                       this->_iterator.copy_post(pred)));
     }
 
     this->_iterator.set_pre(node, pre);
-    this->_iterator.set_post(node, this->_iterator.analyze_node(node, pre));
+    this->analyze_node(node, pre);
   }
 
   void visit(const WtoCycleT& cycle) override {
     NodeRef head = cycle.head();
     WtoNestingT cycle_nesting = this->_iterator.wto().nesting(head);
     AbstractValue pre = AbstractValue::bottom();
+    TraceScopeT cycle_scope(this->_iterator.tracer(),
+                            FixpointEvent::Cycle,
+                            head);
 
     // Collect invariants from incoming edges
     for (auto it = GraphTrait::predecessor_begin(head),
@@ -310,17 +781,26 @@ public:
          ++it) {
       NodeRef pred = *it;
       if (!(this->_iterator.wto().nesting(pred) > cycle_nesting)) {
-        pre.join_with(this->_iterator.analyze_edge(pred,
-                                                   head,
-                                                   this->_iterator.post(pred)));
+        pre.join_with(
+            this->_iterator.analyze_edge(pred,
+                                         head,
+                                         this->_iterator.copy_post(pred)));
       }
     }
 
+    pre = this->_iterator.initial_cycle_value(head, std::move(pre));
+
     // Fixpoint iterations
     IterationKind kind = Increasing;
     for (unsigned iteration = 1;; ++iteration) {
+      TraceScopeT iteration_scope(this->_iterator.tracer(),
+                                  kind == Increasing
+                                      ? FixpointEvent::IncreasingIteration
+                                      : FixpointEvent::DecreasingIteration,
+                                  head,
+                                  iteration);
       this->_iterator.set_pre(head, pre);
-      this->_iterator.set_post(head, this->_iterator.analyze_node(head, pre));
+      this->analyze_node(head, pre);
 
       for (auto it = cycle.begin(), et = cycle.end(); it != et; ++it) {
         it->accept(*this);
@@ -338,7 +818,7 @@ public:
           new_pre_in.join_with(
               this->_iterator.analyze_edge(pred,
                                            head,
-                                           this->_iterator.post(pred)));
+                                           this->_iterator.copy_post(pred)));
         }
       }
 
@@ -354,7 +834,7 @@ public:
           new_pre_back.join_with(
               this->_iterator.analyze_edge(pred,
                                            head,
-                                           this->_iterator.post(pred)));
+                                           this->_iterator.copy_post(pred)));
         }
       }
 
@@ -369,6 +849,10 @@ public:
           kind = Decreasing;
           iteration = 1;
         } else {
+          TraceScopeT scope(this->_iterator.tracer(),
+                            FixpointEvent::Extrapolate,
+                            head,
+                            iteration);
           pre = this->_iterator.extrapolate(head,
                                             iteration,
                                             std::move(pre),
@@ -378,8 +862,14 @@ public:
 
       if (kind == Decreasing) {
         // Decreasing iteration with narrowing
-        new_pre =
-            this->_iterator.refine(head, iteration, pre, std::move(new_pre));
+        {
+          TraceScopeT scope(this->_iterator.tracer(),
+                            FixpointEvent::Refine,
+                            head,
+                            iteration);
+          new_pre =
+              this->_iterator.refine(head, iteration, pre, std::move(new_pre));
+        }
         if (this->_iterator.is_decreasing_iterations_fixpoint(pre, new_pre)) {
           // No more refinement possible
           this->_iterator.set_pre(head, std::move(new_pre));
@@ -426,6 +916,33 @@ public:
 
 }; // end class WtoProcessor
 
+/// \brief Collect all the nodes of a component
+template < typename GraphRef, typename GraphTrait >
+class WtoNodeCollector : public WtoComponentVisitor< GraphRef, GraphTrait > {
+public:
+  using NodeRef = typename GraphTrait::NodeRef;
+  using WtoVertexT = WtoVertex< GraphRef, GraphTrait >;
+  using WtoCycleT = WtoCycle< GraphRef, GraphTrait >;
+
+private:
+  std::vector< NodeRef >& _nodes;
+
+public:
+  explicit WtoNodeCollector(std::vector< NodeRef >& nodes) : _nodes(nodes) {}
+
+  void visit(const WtoVertexT& vertex) override {
+    this->_nodes.push_back(vertex.node());
+  }
+
+  void visit(const WtoCycleT& cycle) override {
+    this->_nodes.push_back(cycle.head());
+    for (auto it = cycle.begin(), et = cycle.end(); it != et; ++it) {
+      it->accept(*this);
+    }
+  }
+
+}; // end class WtoNodeCollector
+
 } // end namespace interleaved_fwd_fixpoint_iterator_impl
 
 } // end namespace core
@@ -0,0 +1,180 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Tables of invariants used by fixpoint iterators
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <ikos/core/semantic/graph.hpp>
+#include <ikos/core/support/assert.hpp>
+
+namespace ikos {
+namespace core {
+
+/// \brief Table of invariants, using a hash map
+///
+/// This works on any graph.
+template < typename GraphRef,
+           typename AbstractValue,
+           typename GraphTrait = GraphTraits< GraphRef > >
+class HashInvariantTable {
+private:
+  using NodeRef = typename GraphTrait::NodeRef;
+  using Map = std::unordered_map< NodeRef, AbstractValue >;
+
+private:
+  mutable Map _map;
+
+public:
+  /// \brief Create an empty table for the given graph
+  explicit HashInvariantTable(GraphRef /*cfg*/) {}
+
+  /// \brief Set the invariant for the given node
+  void set(NodeRef node, AbstractValue inv) {
+    auto it = this->_map.find(node);
+    if (it != this->_map.end()) {
+      it->second = std::move(inv);
+    } else {
+      this->_map.emplace(node, std::move(inv));
+    }
+  }
+
+  /// \brief Get the invariant for the given node
+  ///
+  /// Returns bottom if the invariant was never set.
+  const AbstractValue& get(NodeRef node) const {
+    auto it = this->_map.find(node);
+    if (it != this->_map.end()) {
+      return it->second;
+    } else {
+      auto res = this->_map.emplace(node, AbstractValue::bottom());
+      return res.first->second;
+    }
+  }
+
+  /// \brief Remove the invariant for the given node
+  void erase(NodeRef node) { this->_map.erase(node); }
+
+}; // end class HashInvariantTable
+
+/// \brief Table of invariants, using a vector indexed by node indices
+///
+/// This requires a graph implementing IsIndexableGraph. The table is sized on
+/// construction, thus nodes should not be added to the graph afterwards.
+template < typename GraphRef,
+           typename AbstractValue,
+           typename GraphTrait = GraphTraits< GraphRef > >
+class DenseInvariantTable {
+private:
+  static_assert(IsIndexableGraph< GraphRef, GraphTrait >::value,
+                "GraphRef does not implement node indices");
+
+private:
+  using NodeRef = typename GraphTrait::NodeRef;
+
+private:
+  mutable std::vector< boost::optional< AbstractValue > > _invariants;
+
+public:
+  /// \brief Create an empty table for the given graph
+  explicit DenseInvariantTable(GraphRef cfg)
+      : _invariants(GraphTrait::num_indices(cfg)) {}
+
+  /// \brief Set the invariant for the given node
+  void set(NodeRef node, AbstractValue inv) {
+    std::size_t index = GraphTrait::index(node);
+    ikos_assert(index < this->_invariants.size());
+    this->_invariants[index] = std::move(inv);
+  }
+
+  /// \brief Get the invariant for the given node
+  ///
+  /// Returns bottom if the invariant was never set.
+  const AbstractValue& get(NodeRef node) const {
+    std::size_t index = GraphTrait::index(node);
+    ikos_assert(index < this->_invariants.size());
+    boost::optional< AbstractValue >& inv = this->_invariants[index];
+    if (!inv) {
+      inv = AbstractValue::bottom();
+    }
+    return *inv;
+  }
+
+  /// \brief Remove the invariant for the given node
+  void erase(NodeRef node) {
+    std::size_t index = GraphTrait::index(node);
+    ikos_assert(index < this->_invariants.size());
+    this->_invariants[index] = boost::none;
+  }
+
+}; // end class DenseInvariantTable
+
+/// \brief Traits to select the invariant table of a graph
+///
+/// Graphs implementing node indices use DenseInvariantTable, others use
+/// HashInvariantTable. This can be specialized for a specific graph.
+template < typename GraphRef,
+           typename AbstractValue,
+           typename GraphTrait = GraphTraits< GraphRef >,
+           typename = void >
+struct InvariantTableTraits {
+  using Table = HashInvariantTable< GraphRef, AbstractValue, GraphTrait >;
+};
+
+template < typename GraphRef, typename AbstractValue, typename GraphTrait >
+struct InvariantTableTraits<
+    GraphRef,
+    AbstractValue,
+    GraphTrait,
+    std::enable_if_t< IsIndexableGraph< GraphRef, GraphTrait >::value > > {
+  using Table = DenseInvariantTable< GraphRef, AbstractValue, GraphTrait >;
+};
+
+} // end namespace core
+} // end namespace ikos
@@ -47,9 +47,11 @@
 
 #pragma once
 
-#include <deque>
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <sstream>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -57,13 +59,70 @@
 #include <boost/container/slist.hpp>
 #include <boost/iterator/iterator_facade.hpp>
 
-#include <ikos/core/number/bound.hpp>
 #include <ikos/core/semantic/dumpable.hpp>
 #include <ikos/core/semantic/graph.hpp>
+#include <ikos/core/support/assert.hpp>
 
 namespace ikos {
 namespace core {
 
+namespace wto_impl {
+
+/// \brief Depth-first numbers of the nodes, using a hash map
+///
+/// This works on any graph. Nodes that were never numbered have the number 0.
+template < typename GraphRef, typename GraphTrait, typename = void >
+class DfnTable {
+private:
+  using NodeRef = typename GraphTrait::NodeRef;
+
+private:
+  std::unordered_map< NodeRef, std::size_t > _map;
+
+public:
+  explicit DfnTable(GraphRef /*cfg*/) {}
+
+  std::size_t get(NodeRef n) const {
+    auto it = this->_map.find(n);
+    return (it != this->_map.end()) ? it->second : 0;
+  }
+
+  void set(NodeRef n, std::size_t dfn) { this->_map[n] = dfn; }
+
+}; // end class DfnTable
+
+/// \brief Depth-first numbers of the nodes, using a vector indexed by node
+/// indices
+template < typename GraphRef, typename GraphTrait >
+class DfnTable<
+    GraphRef,
+    GraphTrait,
+    std::enable_if_t< IsIndexableGraph< GraphRef, GraphTrait >::value > > {
+private:
+  using NodeRef = typename GraphTrait::NodeRef;
+
+private:
+  std::vector< std::size_t > _dfns;
+
+public:
+  explicit DfnTable(GraphRef cfg) : _dfns(GraphTrait::num_indices(cfg), 0) {}
+
+  std::size_t get(NodeRef n) const {
+    std::size_t index = GraphTrait::index(n);
+    ikos_assert(index < this->_dfns.size());
+    return this->_dfns[index];
+  }
+
+  void set(NodeRef n, std::size_t dfn) {
+    std::size_t index = GraphTrait::index(n);
+    ikos_assert(index < this->_dfns.size());
+    this->_dfns[index] = dfn;
+  }
+
+}; // end class DfnTable
+
+} // end namespace wto_impl
+
 template < typename GraphRef, typename GraphTrait >
 class Wto;
 
@@ -388,20 +447,51 @@ private:
   using WtoCyclePtr = std::shared_ptr< WtoCycleT >;
   using WtoComponentList = boost::container::slist< WtoComponentPtr >;
   using WtoComponentListPtr = std::shared_ptr< WtoComponentList >;
-  using Dfn = Bound< ZNumber >;
-  using DfnTable = std::unordered_map< NodeRef, Dfn >;
-  using DfnTablePtr = std::shared_ptr< DfnTable >;
-  using Stack = std::deque< NodeRef >;
-  using StackPtr = std::shared_ptr< Stack >;
+  using SuccessorNodeIterator = typename GraphTrait::SuccessorNodeIterator;
+  using Dfn = std::size_t;
+  using DfnTable = wto_impl::DfnTable< GraphRef, GraphTrait >;
   using NestingTable = std::unordered_map< NodeRef, WtoNestingT >;
   using NestingTablePtr = std::shared_ptr< NestingTable >;
 
+  /// \brief Depth-first number of nodes with a component
+  static constexpr Dfn DfnInfinity = std::numeric_limits< Dfn >::max();
+
+  /// \brief Frame of the explicit call stack of Bourdoncle's algorithm
+  ///
+  /// A visit frame computes the head of `vertex`. A component frame visits
+  /// the successors of the head `vertex` of a cycle, building its partition.
+  struct Frame {
+    /// \brief True for a component frame, false for a visit frame
+    bool is_component;
+
+    /// \brief Visited node
+    NodeRef vertex;
+
+    /// \brief Next successor to process
+    SuccessorNodeIterator it;
+
+    /// \brief End of the successors
+    SuccessorNodeIterator et;
+
+    /// \brief Smallest depth-first number reachable from `vertex`
+    Dfn head;
+
+    /// \brief True if `vertex` is in a cycle
+    bool loop;
+
+    /// \brief Partition receiving the visited components
+    ///
+    /// For a component frame, this is the partition of the cycle.
+    WtoComponentListPtr partition;
+
+    /// \brief Partition receiving the cycle, for a component frame
+    WtoComponentListPtr outer;
+  };
+
 private:
   WtoComponentListPtr _components;
-  DfnTablePtr _dfn_table;
-  Dfn _num;
-  StackPtr _stack;
   NestingTablePtr _nesting_table;
+  bool _acyclic;
 
 private:
   class NestingBuilder final
@@ -413,13 +503,17 @@ private:
   private:
     WtoNestingT _nesting;
     NestingTablePtr _nesting_table;
+    bool _acyclic = true;
 
   public:
     explicit NestingBuilder(NestingTablePtr nesting_table)
         : _nesting_table(std::move(nesting_table)) {}
 
+    bool acyclic() const { return this->_acyclic; }
+
     void visit(const WtoCycleT& cycle) override {
       NodeRef head = cycle.head();
+      this->_acyclic = false;
       WtoNestingT previous_nesting = this->_nesting;
       this->_nesting_table->insert(std::make_pair(head, this->_nesting));
       this->_nesting += head;
@@ -437,94 +531,129 @@ private:
   }; // end class NestingBuilder
 
 private:
-  Dfn dfn(NodeRef n) const {
-    auto it = this->_dfn_table->find(n);
-    if (it == this->_dfn_table->end()) {
-      return Dfn(0);
-    } else {
-      return it->second;
-    }
+  /// \brief Start the visit of `vertex`, adding its component to `partition`
+  static void start_visit(DfnTable& dfns,
+                          std::vector< NodeRef >& stack,
+                          std::vector< Frame >& frames,
+                          Dfn& num,
+                          NodeRef vertex,
+                          const WtoComponentListPtr& partition) {
+    stack.push_back(vertex);
+    num++;
+    dfns.set(vertex, num);
+    frames.push_back(Frame{false,
+                           vertex,
+                           GraphTrait::successor_begin(vertex),
+                           GraphTrait::successor_end(vertex),
+                           num,
+                           false,
+                           partition,
+                           nullptr});
   }
 
-  void set_dfn(NodeRef n, const Dfn& dfn) {
-    std::pair< typename DfnTable::iterator, bool > res =
-        this->_dfn_table->insert(std::make_pair(n, dfn));
-    if (!res.second) {
-      (res.first)->second = dfn;
+  /// \brief Return the head `min` of a successor to the frame on top of the
+  /// call stack
+  static void return_head(std::vector< Frame >& frames, Dfn min) {
+    if (frames.empty() || frames.back().is_component) {
+      return;
     }
-  }
-
-  NodeRef pop() {
-    ikos_assert_msg(!this->_stack->empty(), "empty stack");
-    NodeRef top = this->_stack->back();
-    this->_stack->pop_back();
-    return top;
-  }
-
-  void push(NodeRef n) { this->_stack->push_back(n); }
-
-  WtoCyclePtr component(GraphRef cfg, NodeRef vertex) {
-    WtoComponentListPtr partition = std::make_shared< WtoComponentList >();
-    for (auto it = GraphTrait::successor_begin(vertex),
-              et = GraphTrait::successor_end(vertex);
-         it != et;
-         ++it) {
-      NodeRef succ = *it;
-      if (this->dfn(succ) == Dfn(0)) {
-        this->visit(cfg, succ, partition);
-      }
+    Frame& frame = frames.back();
+    if (min <= frame.head) {
+      frame.head = min;
+      frame.loop = true;
     }
-    return std::make_shared< WtoCycleT >(vertex,
-                                         partition,
-                                         typename WtoCycleT::PrivateCtor());
+    ++frame.it;
   }
 
-  Dfn visit(GraphRef cfg,
-            NodeRef vertex,
-            const WtoComponentListPtr& partition) {
-    Dfn head(0), min(0);
-    bool loop;
+  /// \brief Compute the components of the graph with Bourdoncle's algorithm
+  ///
+  /// The recursion of the original algorithm is replaced by an explicit call
+  /// stack, so that large graphs do not overflow the stack.
+  void build(GraphRef cfg) {
+    DfnTable dfns(cfg);
+    std::vector< NodeRef > stack;
+    std::vector< Frame > frames;
+    Dfn num = 0;
+
+    start_visit(dfns,
+                stack,
+                frames,
+                num,
+                GraphTrait::entry(cfg),
+                this->_components);
+
+    while (!frames.empty()) {
+      Frame& frame = frames.back();
+
+      if (!frame.is_component) {
+        if (frame.it != frame.et) {
+          NodeRef succ = *frame.it;
+          Dfn succ_dfn = dfns.get(succ);
+          if (succ_dfn == 0) {
+            start_visit(dfns, stack, frames, num, succ, frame.partition);
+          } else {
+            return_head(frames, succ_dfn);
+          }
+          continue;
+        }
 
-    this->push(vertex);
-    this->_num += Dfn(1);
-    head = this->_num;
-    this->set_dfn(vertex, head);
-    loop = false;
-    for (auto it = GraphTrait::successor_begin(vertex),
-              et = GraphTrait::successor_end(vertex);
-         it != et;
-         ++it) {
-      NodeRef succ = *it;
-      Dfn succ_dfn = this->dfn(succ);
-      if (succ_dfn == Dfn(0)) {
-        min = this->visit(cfg, succ, partition);
+        // All successors are visited
+        NodeRef vertex = frame.vertex;
+        Dfn head = frame.head;
+        if (head == dfns.get(vertex)) {
+          dfns.set(vertex, DfnInfinity);
+          ikos_assert_msg(!stack.empty(), "empty stack");
+          NodeRef element = stack.back();
+          stack.pop_back();
+          if (frame.loop) {
+            while (element != vertex) {
+              dfns.set(element, 0);
+              ikos_assert_msg(!stack.empty(), "empty stack");
+              element = stack.back();
+              stack.pop_back();
+            }
+
+            // Visit the cycle, then return the head
+            frame.is_component = true;
+            frame.it = GraphTrait::successor_begin(vertex);
+            frame.et = GraphTrait::successor_end(vertex);
+            frame.outer = std::move(frame.partition);
+            frame.partition = std::make_shared< WtoComponentList >();
+            continue;
+          }
+
+          frame.partition->push_front(
+              std::static_pointer_cast< WtoComponentT, WtoVertexT >(
+                  std::make_shared< WtoVertexT >(vertex,
+                                                 typename WtoVertexT::
+                                                     PrivateCtor())));
+        }
+        frames.pop_back();
+        return_head(frames, head);
       } else {
-        min = succ_dfn;
-      }
-      if (min <= head) {
-        head = min;
-        loop = true;
-      }
-    }
-    if (head == this->dfn(vertex)) {
-      this->set_dfn(vertex, Dfn::plus_infinity());
-      NodeRef element = this->pop();
-      if (loop) {
-        while (element != vertex) {
-          this->set_dfn(element, Dfn(0));
-          element = this->pop();
+        if (frame.it != frame.et) {
+          NodeRef succ = *frame.it;
+          ++frame.it;
+          if (dfns.get(succ) == 0) {
+            start_visit(dfns, stack, frames, num, succ, frame.partition);
+          }
+          continue;
         }
-        partition->push_front(
+
+        // All the successors of the head are visited
+        frame.outer->push_front(
             std::static_pointer_cast< WtoComponentT, WtoCycleT >(
-                this->component(cfg, vertex)));
-      } else {
-        partition->push_front(
-            std::static_pointer_cast< WtoComponentT, WtoVertexT >(
-                std::make_shared<
-                    WtoVertexT >(vertex, typename WtoVertexT::PrivateCtor())));
+                std::make_shared< WtoCycleT >(frame.vertex,
+                                              std::move(frame.partition),
+                                              typename WtoCycleT::
+                                                  PrivateCtor())));
+        Dfn head = frame.head;
+        frames.pop_back();
+        return_head(frames, head);
       }
     }
-    return head;
+
+    this->_nesting_table->reserve(static_cast< std::size_t >(num));
   }
 
   void build_nesting() {
@@ -532,6 +661,7 @@ private:
     for (Iterator it = this->begin(); it != this->end(); ++it) {
       it->accept(builder);
     }
+    this->_acyclic = builder.acyclic();
   }
 
 public:
@@ -568,29 +698,29 @@ public:
   /// \brief Compute the weak topological order of the given graph
   explicit Wto(GraphRef cfg)
       : _components(std::make_shared< WtoComponentList >()),
-        _dfn_table(std::make_shared< DfnTable >()),
-        _num(0),
-        _stack(std::make_shared< Stack >()),
-        _nesting_table(std::make_shared< NestingTable >()) {
-    this->visit(cfg, GraphTrait::entry(cfg), this->_components);
-    this->_dfn_table.reset();
-    this->_stack.reset();
+        _nesting_table(std::make_shared< NestingTable >()),
+        _acyclic(true) {
+    this->build(cfg);
     this->build_nesting();
   }
 
   /// \brief Copy constructor
   Wto(const Wto& other)
-      : _components(other._components), _nesting_table(other._nesting_table) {}
+      : _components(other._components),
+        _nesting_table(other._nesting_table),
+        _acyclic(other._acyclic) {}
 
   /// \brief Move constructor
   Wto(Wto&& other)
       : _components(std::move(other._components)),
-        _nesting_table(std::move(other._nesting_table)) {}
+        _nesting_table(std::move(other._nesting_table)),
+        _acyclic(other._acyclic) {}
 
   /// \brief Copy assignment operator
   Wto& operator=(const Wto& other) {
     this->_components = other._components;
     this->_nesting_table = other._nesting_table;
+    this->_acyclic = other._acyclic;
     return *this;
   }
 
@@ -598,6 +728,7 @@ public:
   Wto& operator=(Wto&& other) {
     this->_components = std::move(other._components);
     this->_nesting_table = std::move(other._nesting_table);
+    this->_acyclic = other._acyclic;
     return *this;
   }
 
@@ -614,6 +745,11 @@ public:
     return it->second;
   }
 
+  /// \brief Return true if the weak topological order has no cycle
+  ///
+  /// The components are then all vertices, in topological order.
+  bool acyclic() const { return this->_acyclic; }
+
   void accept(WtoComponentVisitor< GraphRef, GraphTrait >& v) {
     for (Iterator it = this->begin(); it != this->end(); ++it) {
       it->accept(v);
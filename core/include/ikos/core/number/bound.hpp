@@ -57,32 +57,73 @@
 namespace ikos {
 namespace core {
 
+namespace detail {
+
+/// \brief Infinity flag of a Bound< Number >
+template < typename Number >
+class BoundInfinity {
+private:
+  bool _is_infinite = false;
+
+protected:
+  /// \brief Return the infinity flag of the bound with number `n`
+  bool load_infinite(const Number& /*n*/) const { return this->_is_infinite; }
+
+  /// \brief Set the infinity flag of the bound with number `n`
+  void store_infinite(Number& /*n*/, bool is_infinite) {
+    this->_is_infinite = is_infinite;
+  }
+};
+
+/// \brief Infinity flag of a Bound< ZNumber >
+///
+/// The flag is stored in the spare bit of the ZNumber tag, hence a ZBound is
+/// not larger than a ZNumber.
+template <>
+class BoundInfinity< ZNumber > {
+protected:
+  /// \brief Return the infinity flag of the bound with number `n`
+  static bool load_infinite(const ZNumber& n) { return n._spare_bit; }
+
+  /// \brief Set the infinity flag of the bound with number `n`
+  static void store_infinite(ZNumber& n, bool is_infinite) {
+    n._spare_bit = is_infinite;
+  }
+};
+
+} // end namespace detail
+
 /// \brief Bound
 ///
 /// This is either -oo, +oo or a number.
 template < typename Number >
-class Bound {
+class Bound : private detail::BoundInfinity< Number > {
 private:
-  bool _is_infinite;
   Number _n;
 
-  // Invariant: _is_infinite => (_n == 1 or _n == -1)
+  // Invariant: is_infinite() => (_n == 1 or _n == -1)
 
 private:
   /// \brief Private constructor
-  Bound(bool is_infinite, int n) : _is_infinite(is_infinite), _n(n) {
+  Bound(bool is_infinite, int n) : _n(n) {
+    this->set_infinite(is_infinite);
     this->normalize();
   }
 
   /// \brief Private constructor
-  Bound(bool is_infinite, Number n)
-      : _is_infinite(is_infinite), _n(std::move(n)) {
+  Bound(bool is_infinite, Number n) : _n(std::move(n)) {
+    this->set_infinite(is_infinite);
     this->normalize();
   }
 
+  /// \brief Set the infinity flag
+  void set_infinite(bool is_infinite) {
+    this->store_infinite(this->_n, is_infinite);
+  }
+
   /// \brief Normalize the bound
   void normalize() {
-    if (this->_is_infinite) {
+    if (this->is_infinite()) {
       this->_n = (this->_n >= 0) ? 1 : -1;
     }
   }
@@ -92,10 +133,10 @@ public:
   Bound() = delete;
 
   /// \brief Create a bound
-  explicit Bound(int n) : _is_infinite(false), _n(n) {}
+  explicit Bound(int n) : _n(n) { this->set_infinite(false); }
 
   /// \brief Create a bound
-  explicit Bound(Number n) : _is_infinite(false), _n(std::move(n)) {}
+  explicit Bound(Number n) : _n(std::move(n)) { this->set_infinite(false); }
 
   /// \brief Copy constructor
   Bound(const Bound&) = default;
@@ -105,15 +146,15 @@ public:
 
   /// \brief Assign a number
   Bound& operator=(int n) {
-    this->_is_infinite = false;
     this->_n = n;
+    this->set_infinite(false);
     return *this;
   }
 
   /// \brief Assign a number
   Bound& operator=(Number n) {
-    this->_is_infinite = false;
     this->_n = std::move(n);
+    this->set_infinite(false);
     return *this;
   }
 
@@ -135,10 +176,10 @@ public:
 
 public:
   /// \brief Return true if the bound is infinite
-  bool is_infinite() const { return this->_is_infinite; }
+  bool is_infinite() const { return this->load_infinite(this->_n); }
 
   /// \brief Return true if the bound is finite
-  bool is_finite() const { return !this->_is_infinite; }
+  bool is_finite() const { return !this->is_infinite(); }
 
   /// \brief Return true if the bound is plus infinity
   bool is_plus_infinity() const { return this->is_infinite() && this->_n == 1; }
@@ -152,7 +193,7 @@ public:
   bool is_zero() const { return this->_n == 0; }
 
   /// \brief Unary minus
-  Bound operator-() const { return Bound(this->_is_infinite, -this->_n); }
+  Bound operator-() const { return Bound(this->is_infinite(), -this->_n); }
 
   /// \brief Add a bound
   void operator+=(const Bound& other) {
@@ -191,8 +232,9 @@ public:
     } else if (other.is_zero()) {
       this->operator=(other);
     } else {
+      bool is_infinite = this->is_infinite() || other.is_infinite();
       this->_n *= other._n;
-      this->_is_infinite = (this->_is_infinite || other._is_infinite);
+      this->set_infinite(is_infinite);
       this->normalize();
     }
   }
@@ -201,8 +243,8 @@ public:
   ///
   /// This is an optimized implementation.
   bool leq(const Bound& other) const {
-    if (this->_is_infinite xor other._is_infinite) {
-      if (this->_is_infinite) {
+    if (this->is_infinite() xor other.is_infinite()) {
+      if (this->is_infinite()) {
         return this->_n == -1;
       } else {
         return other._n == 1;
@@ -215,8 +257,8 @@ public:
   ///
   /// This is an optimized implementation.
   bool geq(const Bound& other) const {
-    if (this->_is_infinite xor other._is_infinite) {
-      if (this->_is_infinite) {
+    if (this->is_infinite() xor other.is_infinite()) {
+      if (this->is_infinite()) {
         return this->_n == 1;
       } else {
         return other._n == -1;
@@ -227,7 +269,7 @@ public:
 
   /// \brief Equality comparison
   bool equals(const Bound& other) const {
-    return this->_is_infinite == other._is_infinite && this->_n == other._n;
+    return this->is_infinite() == other.is_infinite() && this->_n == other._n;
   }
 
   /// \brief Return the number, or boost::none if the bound is infinite
@@ -319,7 +361,7 @@ inline Bound< Number > operator*(const Bound< Number >& lhs,
   if (lhs.is_zero() || rhs.is_zero()) {
     return BoundT(false, 0);
   } else {
-    return BoundT(lhs._is_infinite || rhs._is_infinite, lhs._n * rhs._n);
+    return BoundT(lhs.is_infinite() || rhs.is_infinite(), lhs._n * rhs._n);
   }
 }
 
@@ -474,6 +516,9 @@ inline std::ostream& operator<<(std::ostream& o, const Bound< Number >& bound) {
 /// \brief Bound on unlimited precision integers
 using ZBound = Bound< ZNumber >;
 
+static_assert(sizeof(ZBound) == sizeof(ZNumber),
+              "the infinity flag of a ZBound should fit in the ZNumber");
+
 /// \brief Bound on unlimited precision rationals
 using QBound = Bound< QNumber >;
 
@@ -0,0 +1,345 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Machine integers with a bit-width and signedness known at compile time
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <ikos/core/number/machine_int.hpp>
+#include <ikos/core/number/signedness.hpp>
+#include <ikos/core/support/assert.hpp>
+
+namespace ikos {
+namespace core {
+
+/// \brief Machine integer with a bit-width and signedness known at compile
+/// time
+///
+/// The value is stored in a uint64_t, with the high bits masked out. All
+/// operations wrap around, like MachineInt, but the bit-width checks and the
+/// masks are resolved at compile time.
+///
+/// Only bit-widths up to 64 bits are supported. Use MachineInt otherwise.
+template < unsigned BitWidth, Signedness Sign >
+class FixedMachineInt {
+public:
+  static_assert(BitWidth > 0 && BitWidth <= 64, "unsupported bit-width");
+
+  /// \brief Integral type able to hold all values
+  using IntegralType =
+      std::conditional_t< Sign == Signed, int64_t, uint64_t >;
+
+private:
+  /// \brief Mask of the low `BitWidth` bits
+  static constexpr uint64_t Mask = ~uint64_t(0) >> (64 - BitWidth);
+
+  /// \brief Mask of the sign bit
+  static constexpr uint64_t SignBit = uint64_t(1) << (BitWidth - 1);
+
+private:
+  /// \brief Normalized value, the high bits are always zero
+  uint64_t _n;
+
+  struct NormalizedTag {};
+
+  /// \brief Private constructor for normalized integers
+  constexpr FixedMachineInt(uint64_t n, NormalizedTag) : _n(n) {}
+
+public:
+  /// \brief Create the integer zero
+  constexpr FixedMachineInt() : _n(0) {}
+
+  /// \brief Create a machine integer from an integral type, with wrapping
+  template < typename T,
+             class = std::enable_if_t< std::is_integral< T >::value > >
+  constexpr explicit FixedMachineInt(T n)
+      : _n(static_cast< uint64_t >(n) & Mask) {}
+
+  /// \brief Create a machine integer from a MachineInt
+  explicit FixedMachineInt(const MachineInt& n)
+      : _n(static_cast< uint64_t >(n.to< IntegralType >()) & Mask) {
+    ikos_assert_msg(n.bit_width() == BitWidth && n.sign() == Sign,
+                    "incompatible machine integer");
+  }
+
+  /// \brief Copy constructor
+  constexpr FixedMachineInt(const FixedMachineInt&) noexcept = default;
+
+  /// \brief Copy assignment operator
+  FixedMachineInt& operator=(const FixedMachineInt&) noexcept = default;
+
+  /// \brief Return the bit-width
+  static constexpr unsigned bit_width() { return BitWidth; }
+
+  /// \brief Return the signedness
+  static constexpr Signedness sign() { return Sign; }
+
+  /// \brief Return the minimum integer
+  static constexpr FixedMachineInt min() {
+    return FixedMachineInt(Sign == Signed ? SignBit : 0, NormalizedTag{});
+  }
+
+  /// \brief Return the maximum integer
+  static constexpr FixedMachineInt max() {
+    return FixedMachineInt(Sign == Signed ? Mask >> 1 : Mask, NormalizedTag{});
+  }
+
+  /// \brief Return the value
+  constexpr IntegralType value() const {
+    return Sign == Signed ? static_cast< IntegralType >(
+                                (this->_n ^ SignBit) - SignBit)
+                          : static_cast< IntegralType >(this->_n);
+  }
+
+  /// \brief Return the two's complement representation
+  constexpr uint64_t bits() const { return this->_n; }
+
+  /// \brief Return the integer as a MachineInt
+  MachineInt to_machine_int() const {
+    return MachineInt(this->value(), BitWidth, Sign);
+  }
+
+  /// \brief Return true if the integer is the minimum
+  constexpr bool is_min() const { return *this == min(); }
+
+  /// \brief Return true if the integer is the maximum
+  constexpr bool is_max() const { return *this == max(); }
+
+  /// \brief Return true if the integer is zero
+  constexpr bool is_zero() const { return this->_n == 0; }
+
+  /// \brief Return true if the integer is strictly negative
+  constexpr bool is_negative() const {
+    return Sign == Signed && (this->_n & SignBit) != 0;
+  }
+
+  /// \name Arithmetic operators, with wrapping
+  /// @{
+
+  friend constexpr FixedMachineInt operator+(FixedMachineInt a,
+                                             FixedMachineInt b) {
+    return FixedMachineInt((a._n + b._n) & Mask, NormalizedTag{});
+  }
+
+  friend constexpr FixedMachineInt operator-(FixedMachineInt a,
+                                             FixedMachineInt b) {
+    return FixedMachineInt((a._n - b._n) & Mask, NormalizedTag{});
+  }
+
+  friend constexpr FixedMachineInt operator*(FixedMachineInt a,
+                                             FixedMachineInt b) {
+    return FixedMachineInt((a._n * b._n) & Mask, NormalizedTag{});
+  }
+
+  /// \brief Division, rounding towards zero
+  ///
+  /// min / -1 wraps to min.
+  friend FixedMachineInt operator/(FixedMachineInt a, FixedMachineInt b) {
+    ikos_assert_msg(!b.is_zero(), "division by zero");
+    if (Sign == Signed) {
+      if (a.is_min() && b._n == Mask) {
+        return a;
+      }
+      return FixedMachineInt(a.value() / b.value());
+    } else {
+      return FixedMachineInt(a._n / b._n, NormalizedTag{});
+    }
+  }
+
+  /// \brief Remainder, with the sign of the dividend
+  friend FixedMachineInt operator%(FixedMachineInt a, FixedMachineInt b) {
+    ikos_assert_msg(!b.is_zero(), "division by zero");
+    if (Sign == Signed) {
+      if (b._n == Mask) {
+        return FixedMachineInt();
+      }
+      return FixedMachineInt(a.value() % b.value());
+    } else {
+      return FixedMachineInt(a._n % b._n, NormalizedTag{});
+    }
+  }
+
+  friend constexpr FixedMachineInt operator-(FixedMachineInt a) {
+    return FixedMachineInt((~a._n + 1) & Mask, NormalizedTag{});
+  }
+
+  /// @}
+  /// \name Bitwise operators
+  /// @{
+
+  friend constexpr FixedMachineInt operator~(FixedMachineInt a) {
+    return FixedMachineInt(~a._n & Mask, NormalizedTag{});
+  }
+
+  friend constexpr FixedMachineInt operator&(FixedMachineInt a,
+                                             FixedMachineInt b) {
+    return FixedMachineInt(a._n & b._n, NormalizedTag{});
+  }
+
+  friend constexpr FixedMachineInt operator|(FixedMachineInt a,
+                                             FixedMachineInt b) {
+    return FixedMachineInt(a._n | b._n, NormalizedTag{});
+  }
+
+  friend constexpr FixedMachineInt operator^(FixedMachineInt a,
+                                             FixedMachineInt b) {
+    return FixedMachineInt(a._n ^ b._n, NormalizedTag{});
+  }
+
+  /// \brief Left shift, with wrapping
+  ///
+  /// The shift amount has to be less than the bit-width.
+  friend FixedMachineInt shl(FixedMachineInt a, unsigned shift) {
+    ikos_assert_msg(shift < BitWidth, "invalid shift");
+    return FixedMachineInt((a._n << shift) & Mask, NormalizedTag{});
+  }
+
+  /// \brief Logical shift right
+  ///
+  /// The shift amount has to be less than the bit-width.
+  friend FixedMachineInt lshr(FixedMachineInt a, unsigned shift) {
+    ikos_assert_msg(shift < BitWidth, "invalid shift");
+    return FixedMachineInt(a._n >> shift, NormalizedTag{});
+  }
+
+  /// \brief Arithmetic shift right
+  ///
+  /// The shift amount has to be less than the bit-width.
+  friend FixedMachineInt ashr(FixedMachineInt a, unsigned shift) {
+    ikos_assert_msg(shift < BitWidth, "invalid shift");
+    uint64_t n = a._n >> shift;
+    if ((a._n & SignBit) != 0) {
+      n |= ~(Mask >> shift) & Mask;
+    }
+    return FixedMachineInt(n, NormalizedTag{});
+  }
+
+  /// @}
+  /// \name Comparison operators
+  /// @{
+
+  friend constexpr bool operator==(FixedMachineInt a, FixedMachineInt b) {
+    return a._n == b._n;
+  }
+
+  friend constexpr bool operator!=(FixedMachineInt a, FixedMachineInt b) {
+    return a._n != b._n;
+  }
+
+  friend constexpr bool operator<(FixedMachineInt a, FixedMachineInt b) {
+    return a.value() < b.value();
+  }
+
+  friend constexpr bool operator<=(FixedMachineInt a, FixedMachineInt b) {
+    return a.value() <= b.value();
+  }
+
+  friend constexpr bool operator>(FixedMachineInt a, FixedMachineInt b) {
+    return a.value() > b.value();
+  }
+
+  friend constexpr bool operator>=(FixedMachineInt a, FixedMachineInt b) {
+    return a.value() >= b.value();
+  }
+
+  /// @}
+
+}; // end class FixedMachineInt
+
+/// \brief Tag for a FixedMachineInt type, see dispatch_fixed_machine_int()
+template < unsigned BitWidth, Signedness Sign >
+struct FixedMachineIntTag {
+  using Type = FixedMachineInt< BitWidth, Sign >;
+};
+
+/// \brief Select a FixedMachineInt type for the given bit-width and signedness
+///
+/// Calls `f(FixedMachineIntTag< BitWidth, Sign >{})` for the common
+/// bit-widths (1, 8, 16, 32 and 64 bits), or `fallback()` otherwise. This
+/// allows to dispatch once per operation to a kernel specialized for the
+/// bit-width, instead of checking it on each machine integer operation.
+///
+/// Both functions must return the same type.
+template < typename Function, typename Fallback >
+inline auto dispatch_fixed_machine_int(unsigned bit_width,
+                                       Signedness sign,
+                                       Function&& f,
+                                       Fallback&& fallback)
+    -> decltype(fallback()) {
+  if (sign == Signed) {
+    switch (bit_width) {
+      case 1:
+        return f(FixedMachineIntTag< 1, Signed >{});
+      case 8:
+        return f(FixedMachineIntTag< 8, Signed >{});
+      case 16:
+        return f(FixedMachineIntTag< 16, Signed >{});
+      case 32:
+        return f(FixedMachineIntTag< 32, Signed >{});
+      case 64:
+        return f(FixedMachineIntTag< 64, Signed >{});
+      default:
+        return fallback();
+    }
+  } else {
+    switch (bit_width) {
+      case 1:
+        return f(FixedMachineIntTag< 1, Unsigned >{});
+      case 8:
+        return f(FixedMachineIntTag< 8, Unsigned >{});
+      case 16:
+        return f(FixedMachineIntTag< 16, Unsigned >{});
+      case 32:
+        return f(FixedMachineIntTag< 32, Unsigned >{});
+      case 64:
+        return f(FixedMachineIntTag< 64, Unsigned >{});
+      default:
+        return fallback();
+    }
+  }
+}
+
+} // end namespace core
+} // end namespace ikos
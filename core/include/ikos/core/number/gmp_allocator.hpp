@@ -0,0 +1,196 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Memory functions of GMP using per-thread pools
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <gmp.h>
+
+#include <ikos/core/adt/pool_allocator.hpp>
+#include <ikos/core/support/compiler.hpp>
+
+namespace ikos {
+namespace core {
+
+namespace gmp_allocator_impl {
+
+/// \brief Largest size allocated in a pool, in bytes
+///
+/// Sizes are rounded up to the next power of two, starting at 16 bytes.
+/// Larger limb arrays use malloc.
+constexpr std::size_t MaxPooledSize = 256;
+
+/// \brief Number of allocations of the current thread
+///
+/// This is trivially destructible, so that it can still be used during the
+/// destruction of static objects.
+inline uint64_t& allocation_count() {
+  static thread_local uint64_t count = 0;
+  return count;
+}
+
+/// \brief Allocate `size` bytes, with `size <= MaxPooledSize`
+inline void* pool_allocate(std::size_t size) {
+  using namespace pool_allocator_impl;
+  if (size <= 16) {
+    return BlockPool< 16 >::allocate();
+  } else if (size <= 32) {
+    return BlockPool< 32 >::allocate();
+  } else if (size <= 64) {
+    return BlockPool< 64 >::allocate();
+  } else if (size <= 128) {
+    return BlockPool< 128 >::allocate();
+  } else {
+    return BlockPool< 256 >::allocate();
+  }
+}
+
+/// \brief Deallocate a block of `size` bytes, with `size <= MaxPooledSize`
+inline void pool_deallocate(void* p, std::size_t size) {
+  using namespace pool_allocator_impl;
+  if (size <= 16) {
+    BlockPool< 16 >::deallocate(p);
+  } else if (size <= 32) {
+    BlockPool< 32 >::deallocate(p);
+  } else if (size <= 64) {
+    BlockPool< 64 >::deallocate(p);
+  } else if (size <= 128) {
+    BlockPool< 128 >::deallocate(p);
+  } else {
+    BlockPool< 256 >::deallocate(p);
+  }
+}
+
+/// \brief Return the size of the block holding `size` bytes
+inline std::size_t block_size(std::size_t size) {
+  std::size_t block = 16;
+  while (block < size) {
+    block *= 2;
+  }
+  return block;
+}
+
+/// \brief Allocation function for GMP
+inline void* allocate(std::size_t size) {
+  allocation_count()++;
+#ifndef IKOS_DISABLE_POOL_ALLOCATOR
+  if (ikos_likely(size <= MaxPooledSize)) {
+    return pool_allocate(size);
+  }
+#endif
+  void* p = std::malloc(size);
+  if (ikos_unlikely(p == nullptr)) {
+    std::abort();
+  }
+  return p;
+}
+
+/// \brief Reallocation function for GMP
+inline void* reallocate(void* p, std::size_t old_size, std::size_t new_size) {
+#ifndef IKOS_DISABLE_POOL_ALLOCATOR
+  if (old_size <= MaxPooledSize || new_size <= MaxPooledSize) {
+    if (old_size <= MaxPooledSize && new_size <= MaxPooledSize &&
+        block_size(old_size) == block_size(new_size)) {
+      return p;
+    }
+    void* q = allocate(new_size);
+    std::memcpy(q, p, old_size < new_size ? old_size : new_size);
+    if (old_size <= MaxPooledSize) {
+      pool_deallocate(p, old_size);
+    } else {
+      std::free(p);
+    }
+    return q;
+  }
+#else
+  ikos_ignore(old_size);
+#endif
+  allocation_count()++;
+  void* q = std::realloc(p, new_size);
+  if (ikos_unlikely(q == nullptr)) {
+    std::abort();
+  }
+  return q;
+}
+
+/// \brief Deallocation function for GMP
+inline void deallocate(void* p, std::size_t size) {
+#ifndef IKOS_DISABLE_POOL_ALLOCATOR
+  if (ikos_likely(size <= MaxPooledSize)) {
+    pool_deallocate(p, size);
+    return;
+  }
+#else
+  ikos_ignore(size);
+#endif
+  std::free(p);
+}
+
+} // end namespace gmp_allocator_impl
+
+/// \brief Use per-thread pools for the limbs allocated by GMP
+///
+/// Small limb arrays, i.e most of the ZNumber and QNumber, are allocated in
+/// the per-thread pools of PoolAllocator, without any synchronization.
+///
+/// This must be called before any GMP allocation, since memory allocated by
+/// the previous functions cannot be released in a pool.
+inline void install_gmp_allocator() {
+  mp_set_memory_functions(gmp_allocator_impl::allocate,
+                          gmp_allocator_impl::reallocate,
+                          gmp_allocator_impl::deallocate);
+}
+
+/// \brief Return the number of GMP allocations made by the current thread
+///
+/// This is only counted after install_gmp_allocator() is called.
+inline uint64_t gmp_allocation_count() {
+  return gmp_allocator_impl::allocation_count();
+}
+
+} // end namespace core
+} // end namespace ikos
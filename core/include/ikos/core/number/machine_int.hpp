@@ -44,6 +44,7 @@
 #pragma once
 
 #include <ikos/core/number/compatibility.hpp>
+#include <ikos/core/number/overflow.hpp>
 #include <ikos/core/number/signedness.hpp>
 #include <ikos/core/number/supported_integral.hpp>
 #include <ikos/core/number/z_number.hpp>
@@ -129,8 +130,13 @@ public:
     ikos_assert_msg(bit_width > 0, "invalid bit width");
 
     if (this->is_small()) {
-      ZNumber m = mod(n, power_of_2(this->_bit_width));
-      this->_n.i = m.to< uint64_t >();
+      if (ikos_likely(n.fits< int64_t >())) {
+        // Truncating the two's complement representation is a modulo 2**64
+        this->_n.i = static_cast< uint64_t >(n.to< int64_t >());
+      } else {
+        ZNumber m = mod(n, power_of_2(this->_bit_width));
+        this->_n.i = m.to< uint64_t >();
+      }
     } else {
       this->_n.p = new ZNumber(n);
     }
@@ -503,8 +509,9 @@ private:
     }
 
 #if __has_builtin(__builtin_clzll) || IKOS_GNUC_PREREQ(4, 0, 0)
-    if (std::is_same< uint64_t, unsigned long long >::value) {
-      return static_cast< unsigned >(__builtin_clzll(n));
+    if (sizeof(uint64_t) == sizeof(unsigned long long)) {
+      return static_cast< unsigned >(
+          __builtin_clzll(static_cast< unsigned long long >(n)));
     }
 #endif
 
@@ -1082,20 +1089,17 @@ inline MachineInt mul(const MachineInt& lhs,
   assert_compatible(lhs, rhs);
   if (lhs.is_small()) {
     MachineInt result(lhs._n.i * rhs._n.i, lhs._bit_width, lhs._sign);
-    if (lhs.bit_width() == 1) {
-      if (lhs.is_signed()) {
-        overflow = (lhs.is_min() && rhs.is_min());
-      } else {
-        overflow = false;
-      }
+    if (lhs.is_signed()) {
+      int64_t a = MachineInt::sign_extend_64(lhs._n.i, lhs._bit_width);
+      int64_t b = MachineInt::sign_extend_64(rhs._n.i, rhs._bit_width);
+      int64_t p;
+      overflow = detail::mul_overflow(a, b, &p) ||
+                 MachineInt::sign_extend_64(static_cast< uint64_t >(p),
+                                            lhs._bit_width) != p;
     } else {
-      if (lhs.is_signed()) {
-        overflow = !lhs.is_zero() && !rhs.is_zero() &&
-                   (div(result, rhs) != lhs || div(result, lhs) != rhs);
-      } else {
-        overflow = !lhs.is_zero() && !rhs.is_zero() &&
-                   (div(result, rhs) != lhs || div(result, lhs) != rhs);
-      }
+      uint64_t p;
+      overflow = detail::mul_overflow(lhs._n.i, rhs._n.i, &p) ||
+                 (lhs._bit_width < 64 && (p >> lhs._bit_width) != 0);
     }
     return result;
   } else {
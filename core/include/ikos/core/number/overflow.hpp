@@ -0,0 +1,133 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Integer arithmetic with overflow detection
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include <ikos/core/support/compiler.hpp>
+
+// clang-format off
+
+/// \macro IKOS_HAS_OVERFLOW_BUILTINS
+/// \brief Evaluates to 1 if the compiler provides __builtin_*_overflow
+#if __has_builtin(__builtin_add_overflow) || IKOS_GNUC_PREREQ(5, 0, 0)
+# define IKOS_HAS_OVERFLOW_BUILTINS 1
+#else
+# define IKOS_HAS_OVERFLOW_BUILTINS 0
+#endif
+
+// clang-format on
+
+namespace ikos {
+namespace core {
+namespace detail {
+
+/// \brief Compute `*r = a + b`, return true if the addition overflows
+inline bool add_overflow(int64_t a, int64_t b, int64_t* r) {
+#if IKOS_HAS_OVERFLOW_BUILTINS
+  return __builtin_add_overflow(a, b, r);
+#else
+  if ((b > 0 && a > std::numeric_limits< int64_t >::max() - b) ||
+      (b < 0 && a < std::numeric_limits< int64_t >::min() - b)) {
+    return true;
+  }
+  *r = a + b;
+  return false;
+#endif
+}
+
+/// \brief Compute `*r = a - b`, return true if the subtraction overflows
+inline bool sub_overflow(int64_t a, int64_t b, int64_t* r) {
+#if IKOS_HAS_OVERFLOW_BUILTINS
+  return __builtin_sub_overflow(a, b, r);
+#else
+  if ((b < 0 && a > std::numeric_limits< int64_t >::max() + b) ||
+      (b > 0 && a < std::numeric_limits< int64_t >::min() + b)) {
+    return true;
+  }
+  *r = a - b;
+  return false;
+#endif
+}
+
+/// \brief Compute `*r = a * b`, return true if the multiplication overflows
+inline bool mul_overflow(int64_t a, int64_t b, int64_t* r) {
+#if IKOS_HAS_OVERFLOW_BUILTINS
+  return __builtin_mul_overflow(a, b, r);
+#else
+  if (a == 0 || b == 0) {
+    *r = 0;
+    return false;
+  }
+  if ((a == -1 && b == std::numeric_limits< int64_t >::min()) ||
+      (b == -1 && a == std::numeric_limits< int64_t >::min())) {
+    return true;
+  }
+  auto p = static_cast< int64_t >(static_cast< uint64_t >(a) *
+                                  static_cast< uint64_t >(b));
+  if (p / b != a) {
+    return true;
+  }
+  *r = p;
+  return false;
+#endif
+}
+
+/// \brief Compute `*r = a * b`, return true if the multiplication overflows
+inline bool mul_overflow(uint64_t a, uint64_t b, uint64_t* r) {
+#if IKOS_HAS_OVERFLOW_BUILTINS
+  return __builtin_mul_overflow(a, b, r);
+#else
+  if (a != 0 && b > std::numeric_limits< uint64_t >::max() / a) {
+    return true;
+  }
+  *r = a * b;
+  return false;
+#endif
+}
+
+} // end namespace detail
+} // end namespace core
+} // end namespace ikos
@@ -46,8 +46,12 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <iosfwd>
+#include <limits>
+#include <new>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -58,6 +62,7 @@
 #include <boost/functional/hash.hpp>
 
 #include <ikos/core/number/exception.hpp>
+#include <ikos/core/number/overflow.hpp>
 #include <ikos/core/number/supported_integral.hpp>
 #include <ikos/core/number/z_number.hpp>
 #include <ikos/core/support/assert.hpp>
@@ -73,23 +78,35 @@ template <>
 struct IsSupportedIntegralOrZNumber< const ZNumber& > : public std::true_type {
 };
 
-namespace detail {
-
-/// \brief Helper that returns either an integral type or a mpz_class
-template < typename T >
-struct ZNumberAdapter : public MpzAdapter< T > {};
-
-template <>
-struct ZNumberAdapter< const ZNumber& > {
-  const mpz_class& operator()(const ZNumber& n) { return n.mpz(); }
-};
-
-} // end namespace detail
-
 /// \brief Class for unlimited precision rationals
+///
+/// Rationals whose numerator and denominator fit in 64 bits are stored inline,
+/// and operations on them use the compiler overflow builtins. GMP is only used
+/// when a result does not fit in 64 bits.
 class QNumber {
 private:
-  mpq_class _n;
+  /// \brief Inline representation
+  ///
+  /// The fraction is in canonical form: `den > 0` and `gcd(num, den) = 1`.
+  struct Small {
+    int64_t num;
+    int64_t den;
+  };
+
+  /// \brief True if the number is stored in `_small`, false if in `_big`
+  ///
+  /// Invariant: the number is stored in `_small` if and only if its canonical
+  /// numerator and denominator fit in an int64_t, hence the representation is
+  /// canonical.
+  bool _is_small;
+
+  union {
+    /// \brief Inline representation
+    Small _small;
+
+    /// \brief GMP representation, for numbers that do not fit in 64 bits
+    mpq_class _big;
+  };
 
 public:
   /// \brief Create a QNumber from a string representation
@@ -132,35 +149,58 @@ public:
   /// @{
 
   /// \brief Default constructor that creates a QNumber equals to 0
-  QNumber() = default;
+  QNumber() noexcept : _is_small(true), _small{0, 1} {}
 
   /// \brief Copy constructor
-  QNumber(const QNumber&) = default;
+  QNumber(const QNumber& other) : _is_small(other._is_small) {
+    if (other._is_small) {
+      this->_small = other._small;
+    } else {
+      new (&this->_big) mpq_class(other._big);
+    }
+  }
 
   /// \brief Move constructor
-  QNumber(QNumber&&) = default;
+  QNumber(QNumber&& other) noexcept : _is_small(other._is_small) {
+    if (other._is_small) {
+      this->_small = other._small;
+    } else {
+      new (&this->_big) mpq_class(std::move(other._big));
+      other.set_small(Small{0, 1});
+    }
+  }
 
   /// \brief Create a QNumber from a ZNumber
-  explicit QNumber(const ZNumber& n) : _n(n._n) {}
+  explicit QNumber(const ZNumber& n) : _is_small(true), _small{0, 1} {
+    if (n.fits< int64_t >()) {
+      this->_small.num = n.to< int64_t >();
+    } else {
+      this->set_big(mpq_class(n.mpz()));
+    }
+  }
 
   /// \brief Create a QNumber from a ZNumber
-  explicit QNumber(ZNumber&& n) : _n(std::move(n)._n) {}
+  explicit QNumber(ZNumber&& n) : QNumber(static_cast< const ZNumber& >(n)) {}
 
   /// \brief Create a QNumber from an integral type
   template < typename N,
              class = std::enable_if_t< IsSupportedIntegral< N >::value > >
-  explicit QNumber(N n) : _n(detail::MpzAdapter< N >()(n)) {}
+  explicit QNumber(N n) : _is_small(true), _small{0, 1} {
+    if (detail::fits_int64(n)) {
+      this->_small.num = static_cast< int64_t >(n);
+    } else {
+      this->set_big(mpq_class(detail::MpzAdapter< N >()(n)));
+    }
+  }
 
   /// \brief Create a QNumber from a mpq_class
-  explicit QNumber(const mpq_class& n) : _n(n) {
-    ikos_assert_msg(this->_n.get_den() != 0, "denominator is zero");
-    this->_n.canonicalize();
-  }
+  explicit QNumber(const mpq_class& n) : QNumber(mpq_class(n)) {}
 
   /// \brief Create a QNumber from a mpq_class
-  explicit QNumber(mpq_class&& n) : _n(std::move(n)) {
-    ikos_assert_msg(this->_n.get_den() != 0, "denominator is zero");
-    this->_n.canonicalize();
+  explicit QNumber(mpq_class&& n) : _is_small(true), _small{0, 1} {
+    ikos_assert_msg(n.get_den() != 0, "denominator is zero");
+    n.canonicalize();
+    this->set_big(std::move(n));
   }
 
   /// \brief Create a QNumber from a numerator and a denominator
@@ -168,69 +208,98 @@ public:
              typename D,
              class = std::enable_if_t< IsSupportedIntegral< N >::value &&
                                        IsSupportedIntegral< D >::value > >
-  explicit QNumber(N n, D d)
-      : _n(detail::MpzAdapter< N >()(n), detail::MpzAdapter< D >()(d)) {
-    ikos_assert_msg(this->_n.get_den() != 0, "denominator is zero");
-    this->_n.canonicalize();
-  }
+  explicit QNumber(N n, D d) : QNumber(ZNumber(n), ZNumber(d)) {}
 
   /// \brief Create a QNumber from a numerator and a denominator
-  explicit QNumber(const ZNumber& n, const ZNumber& d) : _n(n._n, d._n) {
-    ikos_assert_msg(this->_n.get_den() != 0, "denominator is zero");
-    this->_n.canonicalize();
+  explicit QNumber(const ZNumber& n, const ZNumber& d)
+      : _is_small(true), _small{0, 1} {
+    ikos_assert_msg(d != 0, "denominator is zero");
+    if (!(n.fits< int64_t >() && d.fits< int64_t >() &&
+          canonical(n.to< int64_t >(), d.to< int64_t >(), &this->_small))) {
+      mpq_class q(n.mpz(), d.mpz());
+      q.canonicalize();
+      this->set_big(std::move(q));
+    }
   }
 
   /// \brief Create a QNumber from a numerator and a denominator
   explicit QNumber(ZNumber&& n, ZNumber&& d)
-      : _n(std::move(n)._n, std::move(d)._n) {
-    ikos_assert_msg(this->_n.get_den() != 0, "denominator is zero");
-    this->_n.canonicalize();
-  }
+      : QNumber(static_cast< const ZNumber& >(n),
+                static_cast< const ZNumber& >(d)) {}
 
   struct NormalizedTag {};
 
   /// \brief Create a QNumber from a normalized mpq_class
-  QNumber(const mpq_class& n, NormalizedTag) : _n(n) {}
+  QNumber(const mpq_class& n, NormalizedTag) : QNumber(mpq_class(n)) {}
 
   /// \brief Create a QNumber from a normalized mpq_class
-  QNumber(mpq_class&& n, NormalizedTag) : _n(std::move(n)) {}
+  QNumber(mpq_class&& n, NormalizedTag) : _is_small(true), _small{0, 1} {
+    this->set_big(std::move(n));
+  }
 
   /// \brief Destructor
-  ~QNumber() = default;
+  ~QNumber() {
+    if (!this->_is_small) {
+      this->_big.~mpq_class();
+    }
+  }
 
   /// @}
   /// \name Assignment Operators
   /// @{
 
   /// \brief Copy assignment
-  QNumber& operator=(const QNumber&) = default;
+  QNumber& operator=(const QNumber& other) {
+    if (other._is_small) {
+      this->set_small(other._small);
+    } else if (this->_is_small) {
+      new (&this->_big) mpq_class(other._big);
+      this->_is_small = false;
+    } else {
+      this->_big = other._big;
+    }
+    return *this;
+  }
 
   /// \brief Move assignment
-  QNumber& operator=(QNumber&&) noexcept = default;
-
-  /// \brief Assignment for ZNumber
-  QNumber& operator=(const ZNumber& n) {
-    this->_n = n._n;
+  QNumber& operator=(QNumber&& other) noexcept {
+    if (this == &other) {
+      return *this;
+    }
+    if (other._is_small) {
+      this->set_small(other._small);
+    } else {
+      if (this->_is_small) {
+        new (&this->_big) mpq_class(std::move(other._big));
+        this->_is_small = false;
+      } else {
+        this->_big = std::move(other._big);
+      }
+      other.set_small(Small{0, 1});
+    }
     return *this;
   }
 
   /// \brief Assignment for ZNumber
-  QNumber& operator=(ZNumber&& n) noexcept {
-    this->_n = std::move(n._n);
-    return *this;
-  }
+  QNumber& operator=(const ZNumber& n) { return *this = QNumber(n); }
+
+  /// \brief Assignment for ZNumber
+  QNumber& operator=(ZNumber&& n) { return *this = QNumber(n); }
 
   /// \brief Assignment for integral types
   template < typename N,
              typename = std::enable_if_t< IsSupportedIntegral< N >::value > >
   QNumber& operator=(N n) {
-    this->_n = detail::MpzAdapter< N >()(n);
-    return *this;
+    return *this = QNumber(n);
   }
 
   /// \brief Addition assignment
   QNumber& operator+=(const QNumber& x) {
-    this->_n += x._n;
+    if (this->_is_small && x._is_small &&
+        add(this->_small, x._small, &this->_small)) {
+      return *this;
+    }
+    this->set_big(this->mpq() + x.mpq());
     return *this;
   }
 
@@ -239,13 +308,16 @@ public:
       typename N,
       class = std::enable_if_t< IsSupportedIntegralOrZNumber< N >::value > >
   QNumber& operator+=(N x) {
-    this->_n += detail::ZNumberAdapter< N >()(x);
-    return *this;
+    return this->operator+=(QNumber(x));
   }
 
   /// \brief Subtraction assignment
   QNumber& operator-=(const QNumber& x) {
-    this->_n -= x._n;
+    if (this->_is_small && x._is_small &&
+        sub(this->_small, x._small, &this->_small)) {
+      return *this;
+    }
+    this->set_big(this->mpq() - x.mpq());
     return *this;
   }
 
@@ -254,13 +326,16 @@ public:
       typename N,
       class = std::enable_if_t< IsSupportedIntegralOrZNumber< N >::value > >
   QNumber& operator-=(N x) {
-    this->_n -= detail::ZNumberAdapter< N >()(x);
-    return *this;
+    return this->operator-=(QNumber(x));
   }
 
   /// \brief Multiplication assignment
   QNumber& operator*=(const QNumber& x) {
-    this->_n *= x._n;
+    if (this->_is_small && x._is_small &&
+        mul(this->_small, x._small, &this->_small)) {
+      return *this;
+    }
+    this->set_big(this->mpq() * x.mpq());
     return *this;
   }
 
@@ -269,14 +344,17 @@ public:
       typename N,
       class = std::enable_if_t< IsSupportedIntegralOrZNumber< N >::value > >
   QNumber& operator*=(N x) {
-    this->_n *= detail::ZNumberAdapter< N >()(x);
-    return *this;
+    return this->operator*=(QNumber(x));
   }
 
   /// \brief Division assignment
   QNumber& operator/=(const QNumber& x) {
-    ikos_assert_msg(x._n != 0, "division by zero");
-    this->_n /= x._n;
+    ikos_assert_msg(!x.is_zero(), "division by zero");
+    if (this->_is_small && x._is_small &&
+        div(this->_small, x._small, &this->_small)) {
+      return *this;
+    }
+    this->set_big(this->mpq() / x.mpq());
     return *this;
   }
 
@@ -286,8 +364,7 @@ public:
       class = std::enable_if_t< IsSupportedIntegralOrZNumber< N >::value > >
   QNumber& operator/=(N x) {
     ikos_assert_msg(x != 0, "division by zero");
-    this->_n /= detail::ZNumberAdapter< N >()(x);
-    return *this;
+    return this->operator/=(QNumber(x));
   }
 
   /// @}
@@ -299,30 +376,50 @@ public:
 
   /// \brief Prefix increment
   QNumber& operator++() {
-    ++this->_n;
+    int64_t r;
+    if (this->_is_small &&
+        !detail::add_overflow(this->_small.num, this->_small.den, &r)) {
+      this->_small.num = r;
+      return *this;
+    }
+    this->set_big(this->mpq() + 1);
     return *this;
   }
 
   /// \brief Postfix increment
   const QNumber operator++(int) {
     QNumber r(*this);
-    ++this->_n;
+    ++(*this);
     return r;
   }
 
   /// \brief Unary minus
-  const QNumber operator-() const { return QNumber(-this->_n); }
+  const QNumber operator-() const {
+    if (this->_is_small &&
+        this->_small.num != std::numeric_limits< int64_t >::min()) {
+      QNumber r;
+      r._small = Small{-this->_small.num, this->_small.den};
+      return r;
+    }
+    return QNumber(-this->mpq(), NormalizedTag{});
+  }
 
   /// \brief Prefix decrement
   QNumber& operator--() {
-    --this->_n;
+    int64_t r;
+    if (this->_is_small &&
+        !detail::sub_overflow(this->_small.num, this->_small.den, &r)) {
+      this->_small.num = r;
+      return *this;
+    }
+    this->set_big(this->mpq() - 1);
     return *this;
   }
 
   /// \brief Postfix decrement
   const QNumber operator--(int) {
     QNumber r(*this);
-    --this->_n;
+    --(*this);
     return r;
   }
 
@@ -331,18 +428,37 @@ public:
   /// @{
 
   /// \brief Get the numerator
-  ZNumber numerator() const { return ZNumber(this->_n.get_num()); }
+  ZNumber numerator() const {
+    if (this->_is_small) {
+      return ZNumber(this->_small.num);
+    }
+    return ZNumber(this->_big.get_num());
+  }
 
   /// \brief Get the denominator
-  ZNumber denominator() const { return ZNumber(this->_n.get_den()); }
+  ZNumber denominator() const {
+    if (this->_is_small) {
+      return ZNumber(this->_small.den);
+    }
+    return ZNumber(this->_big.get_den());
+  }
 
   /// \brief Round to upper integer
   ZNumber round_to_upper() const {
-    const mpz_class& num = this->_n.get_num();
-    const mpz_class& den = this->_n.get_den();
+    if (this->_is_small) {
+      // The denominator is positive, thus the division cannot overflow
+      int64_t q = this->_small.num / this->_small.den;
+      if (this->_small.num % this->_small.den == 0 || this->_small.num < 0) {
+        return ZNumber(q);
+      } else {
+        return ZNumber(q) + 1;
+      }
+    }
+    const mpz_class& num = this->_big.get_num();
+    const mpz_class& den = this->_big.get_den();
     ZNumber q(num / den);
     ZNumber r(num % den);
-    if (r == 0 || this->_n < 0) {
+    if (r == 0 || this->_big < 0) {
       return q;
     } else {
       return q + 1;
@@ -351,11 +467,20 @@ public:
 
   /// \brief Round to lower integer
   ZNumber round_to_lower() const {
-    const mpz_class& num = this->_n.get_num();
-    const mpz_class& den = this->_n.get_den();
+    if (this->_is_small) {
+      // The denominator is positive, thus the division cannot overflow
+      int64_t q = this->_small.num / this->_small.den;
+      if (this->_small.num % this->_small.den == 0 || this->_small.num > 0) {
+        return ZNumber(q);
+      } else {
+        return ZNumber(q) - 1;
+      }
+    }
+    const mpz_class& num = this->_big.get_num();
+    const mpz_class& den = this->_big.get_den();
     ZNumber q(num / den);
     ZNumber r(num % den);
-    if (r == 0 || this->_n > 0) {
+    if (r == 0 || this->_big > 0) {
       return q;
     } else {
       return q - 1;
@@ -366,18 +491,143 @@ public:
   /// \name Conversion Functions
   /// @{
 
-  /// \brief Get the internal representation
-  const mpq_class& mpq() const { return this->_n; }
+  /// \brief Return the number as a mpq_class
+  mpq_class mpq() const {
+    if (this->_is_small) {
+      return mpq_class(
+          mpz_class(detail::MpzAdapter< int64_t >()(this->_small.num)),
+          mpz_class(detail::MpzAdapter< int64_t >()(this->_small.den)));
+    }
+    return this->_big;
+  }
 
   /// \brief Return a string of the QNumber in the given base
   ///
   /// The base can vary from 2 to 36, or from -2 to -36
-  std::string str(int base = 10) const { return this->_n.get_str(base); }
+  std::string str(int base = 10) const {
+    if (this->_is_small && base == 10) {
+      if (this->_small.den == 1) {
+        return std::to_string(this->_small.num);
+      }
+      return std::to_string(this->_small.num) + "/" +
+             std::to_string(this->_small.den);
+    }
+    return this->mpq().get_str(base);
+  }
 
   /// @}
 
+private:
+  /// \brief Return true if the number is 0
+  bool is_zero() const { return this->_is_small && this->_small.num == 0; }
+
+  /// \brief Set the number to the given canonical fraction
+  void set_small(Small n) noexcept {
+    if (!this->_is_small) {
+      this->_big.~mpq_class();
+      this->_is_small = true;
+    }
+    this->_small = n;
+  }
+
+  /// \brief Set the number to the given canonical mpq_class
+  ///
+  /// This switches to the inline representation if the number fits.
+  void set_big(mpq_class&& n) {
+    if (detail::MpzFits< int64_t >()(n.get_num()) &&
+        detail::MpzFits< int64_t >()(n.get_den())) {
+      this->set_small(Small{detail::MpzTo< int64_t >()(n.get_num()),
+                            detail::MpzTo< int64_t >()(n.get_den())});
+    } else if (this->_is_small) {
+      new (&this->_big) mpq_class(std::move(n));
+      this->_is_small = false;
+    } else {
+      this->_big = std::move(n);
+    }
+  }
+
+  /// \brief Compute the canonical form of `num / den` in `r`
+  ///
+  /// Return false if it does not fit in 64 bits.
+  static bool canonical(int64_t num, int64_t den, Small* r) {
+    if (den < 0) {
+      if (num == std::numeric_limits< int64_t >::min() ||
+          den == std::numeric_limits< int64_t >::min()) {
+        return false;
+      }
+      num = -num;
+      den = -den;
+    }
+    auto g = static_cast< int64_t >(
+        detail::gcd_u64(detail::unsigned_abs(num),
+                        static_cast< uint64_t >(den)));
+    r->num = num / g;
+    r->den = den / g;
+    return true;
+  }
+
+  /// \brief Compute `x + y` in `r`, return false on overflow
+  static bool add(Small x, Small y, Small* r) {
+    int64_t n1, n2, num, den;
+    auto g = static_cast< int64_t >(detail::gcd_u64(
+        static_cast< uint64_t >(x.den), static_cast< uint64_t >(y.den)));
+    return !detail::mul_overflow(x.num, y.den / g, &n1) &&
+           !detail::mul_overflow(y.num, x.den / g, &n2) &&
+           !detail::add_overflow(n1, n2, &num) &&
+           !detail::mul_overflow(x.den, y.den / g, &den) &&
+           canonical(num, den, r);
+  }
+
+  /// \brief Compute `x - y` in `r`, return false on overflow
+  static bool sub(Small x, Small y, Small* r) {
+    int64_t n1, n2, num, den;
+    auto g = static_cast< int64_t >(detail::gcd_u64(
+        static_cast< uint64_t >(x.den), static_cast< uint64_t >(y.den)));
+    return !detail::mul_overflow(x.num, y.den / g, &n1) &&
+           !detail::mul_overflow(y.num, x.den / g, &n2) &&
+           !detail::sub_overflow(n1, n2, &num) &&
+           !detail::mul_overflow(x.den, y.den / g, &den) &&
+           canonical(num, den, r);
+  }
+
+  /// \brief Compute `x * y` in `r`, return false on overflow
+  static bool mul(Small x, Small y, Small* r) {
+    // Cross-reduce, so that the result is canonical
+    auto g1 = static_cast< int64_t >(
+        detail::gcd_u64(detail::unsigned_abs(x.num),
+                        static_cast< uint64_t >(y.den)));
+    auto g2 = static_cast< int64_t >(
+        detail::gcd_u64(detail::unsigned_abs(y.num),
+                        static_cast< uint64_t >(x.den)));
+    int64_t num, den;
+    if (detail::mul_overflow(x.num / g1, y.num / g2, &num) ||
+        detail::mul_overflow(x.den / g2, y.den / g1, &den)) {
+      return false;
+    }
+    r->num = num;
+    r->den = den;
+    return true;
+  }
+
+  /// \brief Compute `x / y` in `r`, return false on overflow
+  static bool div(Small x, Small y, Small* r) {
+    if (y.num == std::numeric_limits< int64_t >::min()) {
+      return false;
+    }
+    Small inv = (y.num < 0) ? Small{-y.den, -y.num} : Small{y.den, y.num};
+    return mul(x, inv, r);
+  }
+
+  friend bool operator==(const QNumber&, const QNumber&);
+
+  friend bool operator<(const QNumber&, const QNumber&);
+
+  friend std::ostream& operator<<(std::ostream& o, const QNumber& n);
+
   friend std::istream& operator>>(std::istream& i, QNumber& n);
 
+  friend std::size_t hash_value(const QNumber&);
+
 }; // end class QNumber
 
 /// \name Binary Operators
@@ -385,7 +635,9 @@ public:
 
 /// \brief Addition
 inline QNumber operator+(const QNumber& lhs, const QNumber& rhs) {
-  return QNumber(lhs.mpq() + rhs.mpq(), QNumber::NormalizedTag{});
+  QNumber r(lhs);
+  r += rhs;
+  return r;
 }
 
 /// \brief Addition with integral types or ZNumber
@@ -393,8 +645,9 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline QNumber operator+(const QNumber& lhs, T rhs) {
-  return QNumber(lhs.mpq() + detail::ZNumberAdapter< T >()(rhs),
-                 QNumber::NormalizedTag{});
+  QNumber r(lhs);
+  r += QNumber(rhs);
+  return r;
 }
 
 /// \brief Addition with integral types or ZNumber
@@ -402,13 +655,16 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline QNumber operator+(T lhs, const QNumber& rhs) {
-  return QNumber(detail::ZNumberAdapter< T >()(lhs) + rhs.mpq(),
-                 QNumber::NormalizedTag{});
+  QNumber r(lhs);
+  r += rhs;
+  return r;
 }
 
 /// \brief Subtraction
 inline QNumber operator-(const QNumber& lhs, const QNumber& rhs) {
-  return QNumber(lhs.mpq() - rhs.mpq(), QNumber::NormalizedTag{});
+  QNumber r(lhs);
+  r -= rhs;
+  return r;
 }
 
 /// \brief Subtraction with integral types or ZNumber
@@ -416,8 +672,9 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline QNumber operator-(const QNumber& lhs, T rhs) {
-  return QNumber(lhs.mpq() - detail::ZNumberAdapter< T >()(rhs),
-                 QNumber::NormalizedTag{});
+  QNumber r(lhs);
+  r -= QNumber(rhs);
+  return r;
 }
 
 /// \brief Subtraction with integral types or ZNumber
@@ -425,13 +682,16 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline QNumber operator-(T lhs, const QNumber& rhs) {
-  return QNumber(detail::ZNumberAdapter< T >()(lhs) - rhs.mpq(),
-                 QNumber::NormalizedTag{});
+  QNumber r(lhs);
+  r -= rhs;
+  return r;
 }
 
 /// \brief Multiplication
 inline QNumber operator*(const QNumber& lhs, const QNumber& rhs) {
-  return QNumber(lhs.mpq() * rhs.mpq(), QNumber::NormalizedTag{});
+  QNumber r(lhs);
+  r *= rhs;
+  return r;
 }
 
 /// \brief Multiplication with integral types or ZNumber
@@ -439,8 +699,9 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline QNumber operator*(const QNumber& lhs, T rhs) {
-  return QNumber(lhs.mpq() * detail::ZNumberAdapter< T >()(rhs),
-                 QNumber::NormalizedTag{});
+  QNumber r(lhs);
+  r *= QNumber(rhs);
+  return r;
 }
 
 /// \brief Multiplication with integral types or ZNumber
@@ -448,14 +709,16 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline QNumber operator*(T lhs, const QNumber& rhs) {
-  return QNumber(detail::ZNumberAdapter< T >()(lhs) * rhs.mpq(),
-                 QNumber::NormalizedTag{});
+  QNumber r(lhs);
+  r *= rhs;
+  return r;
 }
 
 /// \brief Division
 inline QNumber operator/(const QNumber& lhs, const QNumber& rhs) {
-  ikos_assert_msg(rhs.mpq() != 0, "division by zero");
-  return QNumber(lhs.mpq() / rhs.mpq(), QNumber::NormalizedTag{});
+  QNumber r(lhs);
+  r /= rhs;
+  return r;
 }
 
 /// \brief Division with integral types or ZNumber
@@ -464,8 +727,9 @@ template <
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline QNumber operator/(const QNumber& lhs, T rhs) {
   ikos_assert_msg(rhs != 0, "division by zero");
-  return QNumber(lhs.mpq() / detail::ZNumberAdapter< T >()(rhs),
-                 QNumber::NormalizedTag{});
+  QNumber r(lhs);
+  r /= QNumber(rhs);
+  return r;
 }
 
 /// \brief Division with integral types or ZNumber
@@ -473,9 +737,9 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline QNumber operator/(T lhs, const QNumber& rhs) {
-  ikos_assert_msg(rhs.mpq() != 0, "division by zero");
-  return QNumber(detail::ZNumberAdapter< T >()(lhs) / rhs.mpq(),
-                 QNumber::NormalizedTag{});
+  QNumber r(lhs);
+  r /= rhs;
+  return r;
 }
 
 /// @}
@@ -484,7 +748,15 @@ inline QNumber operator/(T lhs, const QNumber& rhs) {
 
 /// \brief Equality operator
 inline bool operator==(const QNumber& lhs, const QNumber& rhs) {
-  return lhs.mpq() == rhs.mpq();
+  if (lhs._is_small && rhs._is_small) {
+    return lhs._small.num == rhs._small.num &&
+           lhs._small.den == rhs._small.den;
+  } else if (lhs._is_small || rhs._is_small) {
+    // The representation is canonical
+    return false;
+  } else {
+    return lhs._big == rhs._big;
+  }
 }
 
 /// \brief Equality operator with integral types or ZNumber
@@ -492,7 +764,7 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline bool operator==(const QNumber& lhs, T rhs) {
-  return lhs.mpq() == detail::ZNumberAdapter< T >()(rhs);
+  return lhs == QNumber(rhs);
 }
 
 /// \brief Equality operator with integral types or ZNumber
@@ -500,12 +772,12 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline bool operator==(T lhs, const QNumber& rhs) {
-  return detail::ZNumberAdapter< T >()(lhs) == rhs.mpq();
+  return QNumber(lhs) == rhs;
 }
 
 /// \brief Inequality operator
 inline bool operator!=(const QNumber& lhs, const QNumber& rhs) {
-  return lhs.mpq() != rhs.mpq();
+  return !(lhs == rhs);
 }
 
 /// \brief Inequality operator with integral types or ZNumber
@@ -513,7 +785,7 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline bool operator!=(const QNumber& lhs, T rhs) {
-  return lhs.mpq() != detail::ZNumberAdapter< T >()(rhs);
+  return !(lhs == QNumber(rhs));
 }
 
 /// \brief Inequality operator with integral types or ZNumber
@@ -521,11 +793,19 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline bool operator!=(T lhs, const QNumber& rhs) {
-  return detail::ZNumberAdapter< T >()(lhs) != rhs.mpq();
+  return !(QNumber(lhs) == rhs);
 }
 
 /// \brief Less than comparison
 inline bool operator<(const QNumber& lhs, const QNumber& rhs) {
+  if (lhs._is_small && rhs._is_small) {
+    // Denominators are positive
+    int64_t a, b;
+    if (!detail::mul_overflow(lhs._small.num, rhs._small.den, &a) &&
+        !detail::mul_overflow(rhs._small.num, lhs._small.den, &b)) {
+      return a < b;
+    }
+  }
   return lhs.mpq() < rhs.mpq();
 }
 
@@ -534,7 +814,7 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline bool operator<(const QNumber& lhs, T rhs) {
-  return lhs.mpq() < detail::ZNumberAdapter< T >()(rhs);
+  return lhs < QNumber(rhs);
 }
 
 /// \brief Less than comparison with integral types or ZNumber
@@ -542,12 +822,12 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline bool operator<(T lhs, const QNumber& rhs) {
-  return detail::ZNumberAdapter< T >()(lhs) < rhs.mpq();
+  return QNumber(lhs) < rhs;
 }
 
 /// \brief Less or equal comparison
 inline bool operator<=(const QNumber& lhs, const QNumber& rhs) {
-  return lhs.mpq() <= rhs.mpq();
+  return !(rhs < lhs);
 }
 
 /// \brief Less or equal comparison with integral types or ZNumber
@@ -555,7 +835,7 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline bool operator<=(const QNumber& lhs, T rhs) {
-  return lhs.mpq() <= detail::ZNumberAdapter< T >()(rhs);
+  return !(QNumber(rhs) < lhs);
 }
 
 /// \brief Less or equal comparison with integral types or ZNumber
@@ -563,12 +843,12 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline bool operator<=(T lhs, const QNumber& rhs) {
-  return detail::ZNumberAdapter< T >()(lhs) <= rhs.mpq();
+  return !(rhs < QNumber(lhs));
 }
 
 /// \brief Greater than comparison
 inline bool operator>(const QNumber& lhs, const QNumber& rhs) {
-  return lhs.mpq() > rhs.mpq();
+  return rhs < lhs;
 }
 
 /// \brief Greater than comparison with integral types or ZNumber
@@ -576,7 +856,7 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline bool operator>(const QNumber& lhs, T rhs) {
-  return lhs.mpq() > detail::ZNumberAdapter< T >()(rhs);
+  return QNumber(rhs) < lhs;
 }
 
 /// \brief Greater than comparison with integral types or ZNumber
@@ -584,12 +864,12 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline bool operator>(T lhs, const QNumber& rhs) {
-  return detail::ZNumberAdapter< T >()(lhs) > rhs.mpq();
+  return rhs < QNumber(lhs);
 }
 
 /// \brief Greater or equal comparison
 inline bool operator>=(const QNumber& lhs, const QNumber& rhs) {
-  return lhs.mpq() >= rhs.mpq();
+  return !(lhs < rhs);
 }
 
 /// \brief Greater or equal comparison with integral types or ZNumber
@@ -597,7 +877,7 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline bool operator>=(const QNumber& lhs, T rhs) {
-  return lhs.mpq() >= detail::ZNumberAdapter< T >()(rhs);
+  return !(lhs < QNumber(rhs));
 }
 
 /// \brief Greater or equal comparison with integral types or ZNumber
@@ -605,7 +885,7 @@ template <
     typename T,
     class = std::enable_if_t< IsSupportedIntegralOrZNumber< T >::value > >
 inline bool operator>=(T lhs, const QNumber& rhs) {
-  return detail::ZNumberAdapter< T >()(lhs) >= rhs.mpq();
+  return !(QNumber(lhs) < rhs);
 }
 
 /// @}
@@ -654,7 +934,7 @@ inline const QNumber& max(const QNumber& a,
 
 /// \brief Return the absolute value of the given number
 inline QNumber abs(const QNumber& n) {
-  return QNumber(abs(n.mpq()));
+  return (n < 0) ? -n : n;
 }
 
 /// @}
@@ -663,13 +943,22 @@ inline QNumber abs(const QNumber& n) {
 
 /// \brief Write a QNumber on a stream, in base 10
 inline std::ostream& operator<<(std::ostream& o, const QNumber& n) {
-  o << n.mpq();
+  if (n._is_small) {
+    o << n._small.num;
+    if (n._small.den != 1) {
+      o << '/' << n._small.den;
+    }
+  } else {
+    o << n._big;
+  }
   return o;
 }
 
 /// \brief Read a QNumber from a stream, in base 10
 inline std::istream& operator>>(std::istream& i, QNumber& n) {
-  i >> n._n;
+  mpq_class q;
+  i >> q;
+  n = QNumber(std::move(q));
   return i;
 }
 
@@ -677,8 +966,13 @@ inline std::istream& operator>>(std::istream& i, QNumber& n) {
 
 /// \brief Return the hash of a QNumber
 inline std::size_t hash_value(const QNumber& n) {
-  const mpq_class& m = n.mpq();
   std::size_t result = 0;
+  if (n._is_small) {
+    boost::hash_combine(result, n._small.num);
+    boost::hash_combine(result, n._small.den);
+    return result;
+  }
+  const mpq_class& m = n._big;
   boost::hash_combine(result, m.get_num_mpz_t()[0]._mp_size);
   for (int i = 0, e = std::abs(m.get_num_mpz_t()[0]._mp_size); i < e; ++i) {
     boost::hash_combine(result, m.get_num_mpz_t()[0]._mp_d[i]);
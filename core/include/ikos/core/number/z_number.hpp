@@ -46,8 +46,12 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <iosfwd>
+#include <limits>
+#include <new>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -58,6 +62,7 @@
 #include <boost/functional/hash.hpp>
 
 #include <ikos/core/number/exception.hpp>
+#include <ikos/core/number/overflow.hpp>
 #include <ikos/core/number/supported_integral.hpp>
 #include <ikos/core/support/assert.hpp>
 
@@ -280,12 +285,76 @@ template <>
 struct MpzTo< long long >
     : public MpzToLongLong< sizeof(long long) == sizeof(long) > {};
 
+/// \brief Return true if the given integer fits in an int64_t
+template < typename T >
+inline bool fits_int64(T n) {
+  static_assert(sizeof(T) <= sizeof(int64_t), "unexpected size");
+  return std::is_signed< T >::value ||
+         static_cast< uint64_t >(n) <=
+             static_cast< uint64_t >(std::numeric_limits< int64_t >::max());
+}
+
+/// \brief Return true if the given int64_t fits in the given integer type
+template < typename T >
+inline bool int64_fits(int64_t n) {
+  if (std::is_signed< T >::value) {
+    return n >= static_cast< int64_t >(std::numeric_limits< T >::min()) &&
+           n <= static_cast< int64_t >(std::numeric_limits< T >::max());
+  } else {
+    return n >= 0 &&
+           static_cast< uint64_t >(n) <=
+               static_cast< uint64_t >(std::numeric_limits< T >::max());
+  }
+}
+
+/// \brief Return the absolute value of the given int64_t, as an uint64_t
+inline uint64_t unsigned_abs(int64_t n) {
+  return n < 0 ? uint64_t(0) - static_cast< uint64_t >(n)
+               : static_cast< uint64_t >(n);
+}
+
+/// \brief Return the greatest common divisor of the given uint64_t
+inline uint64_t gcd_u64(uint64_t a, uint64_t b) {
+  while (b != 0) {
+    uint64_t t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+// forward declaration
+template < typename Number >
+class BoundInfinity;
+
 } // end namespace detail
 
 /// \brief Class for unlimited precision integers
+///
+/// Numbers that fit in 64 bits are stored inline, and operations on them use
+/// the compiler overflow builtins. GMP is only used when a result does not fit
+/// in 64 bits.
 class ZNumber {
 private:
-  mpz_class _n;
+  /// \brief True if the number is stored in `_small`, false if in `_big`
+  ///
+  /// Invariant: the number is stored in `_small` if and only if it fits in an
+  /// int64_t, hence the representation is canonical.
+  bool _is_small : 1;
+
+  /// \brief Spare bit of the tag, available to the owner of the number
+  ///
+  /// It is not part of the value: it is preserved by copies and ignored by
+  /// all the operations. See detail::BoundInfinity< ZNumber >.
+  bool _spare_bit : 1;
+
+  union {
+    /// \brief Inline representation
+    int64_t _small;
+
+    /// \brief GMP representation, for numbers that do not fit in 64 bits
+    mpz_class _big;
+  };
 
 public:
   /// \brief Create a ZNumber from a string representation
@@ -328,95 +397,186 @@ public:
   /// @{
 
   /// \brief Default constructor that creates a ZNumber equals to 0
-  ZNumber() = default;
+  ZNumber() noexcept : _is_small(true), _spare_bit(false), _small(0) {}
 
   /// \brief Copy constructor
-  ZNumber(const ZNumber&) = default;
+  ZNumber(const ZNumber& other)
+      : _is_small(other._is_small), _spare_bit(other._spare_bit) {
+    if (other._is_small) {
+      this->_small = other._small;
+    } else {
+      new (&this->_big) mpz_class(other._big);
+    }
+  }
 
   /// \brief Move constructor
-  ZNumber(ZNumber&&) = default;
+  ZNumber(ZNumber&& other) noexcept
+      : _is_small(other._is_small), _spare_bit(other._spare_bit) {
+    if (other._is_small) {
+      this->_small = other._small;
+    } else {
+      new (&this->_big) mpz_class(std::move(other._big));
+      other.set_small(0);
+    }
+  }
 
   /// \brief Create a ZNumber from a mpz_class
-  explicit ZNumber(const mpz_class& n) : _n(n) {}
+  explicit ZNumber(const mpz_class& n)
+      : _is_small(true), _spare_bit(false), _small(0) {
+    if (detail::MpzFits< int64_t >()(n)) {
+      this->_small = detail::MpzTo< int64_t >()(n);
+    } else {
+      new (&this->_big) mpz_class(n);
+      this->_is_small = false;
+    }
+  }
 
   /// \brief Create a ZNumber from a mpz_class
-  explicit ZNumber(mpz_class&& n) : _n(std::move(n)) {}
+  explicit ZNumber(mpz_class&& n)
+      : _is_small(true), _spare_bit(false), _small(0) {
+    if (detail::MpzFits< int64_t >()(n)) {
+      this->_small = detail::MpzTo< int64_t >()(n);
+    } else {
+      new (&this->_big) mpz_class(std::move(n));
+      this->_is_small = false;
+    }
+  }
 
   /// \brief Create a ZNumber from an integral type
   template < typename T,
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
-  explicit ZNumber(T n) : _n(detail::MpzAdapter< T >()(n)) {}
+  explicit ZNumber(T n) : _is_small(true), _spare_bit(false), _small(0) {
+    if (detail::fits_int64(n)) {
+      this->_small = static_cast< int64_t >(n);
+    } else {
+      new (&this->_big) mpz_class(detail::MpzAdapter< T >()(n));
+      this->_is_small = false;
+    }
+  }
 
   /// \brief Destructor
-  ~ZNumber() = default;
+  ~ZNumber() {
+    if (!this->_is_small) {
+      this->_big.~mpz_class();
+    }
+  }
 
   /// @}
   /// \name Assignment Operators
   /// @{
 
   /// \brief Copy assignment
-  ZNumber& operator=(const ZNumber&) = default;
+  ZNumber& operator=(const ZNumber& other) {
+    this->_spare_bit = other._spare_bit;
+    if (other._is_small) {
+      this->set_small(other._small);
+    } else if (this->_is_small) {
+      new (&this->_big) mpz_class(other._big);
+      this->_is_small = false;
+    } else {
+      this->_big = other._big;
+    }
+    return *this;
+  }
 
   /// \brief Move assignment
-  ZNumber& operator=(ZNumber&&) noexcept = default;
+  ZNumber& operator=(ZNumber&& other) noexcept {
+    if (this == &other) {
+      return *this;
+    }
+    this->_spare_bit = other._spare_bit;
+    if (other._is_small) {
+      this->set_small(other._small);
+    } else {
+      if (this->_is_small) {
+        new (&this->_big) mpz_class(std::move(other._big));
+        this->_is_small = false;
+      } else {
+        this->_big = std::move(other._big);
+      }
+      other.set_small(0);
+    }
+    return *this;
+  }
 
   /// \brief Assignment for integral types
   template < typename T,
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   ZNumber& operator=(T n) {
-    this->_n = detail::MpzAdapter< T >()(n);
+    if (detail::fits_int64(n)) {
+      this->set_small(static_cast< int64_t >(n));
+    } else {
+      *this = ZNumber(n);
+    }
     return *this;
   }
 
   /// \brief Addition assignment
   ZNumber& operator+=(const ZNumber& x) {
-    this->_n += x._n;
-    return *this;
+    int64_t r;
+    if (this->_is_small && x._is_small &&
+        !detail::add_overflow(this->_small, x._small, &r)) {
+      this->_small = r;
+      return *this;
+    }
+    return this->apply_mpz(x, [](mpz_class& a, const auto& b) { a += b; });
   }
 
   /// \brief Addition assignment with integral types
   template < typename T,
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   ZNumber& operator+=(T x) {
-    this->_n += detail::MpzAdapter< T >()(x);
-    return *this;
+    return this->operator+=(ZNumber(x));
   }
 
   /// \brief Subtraction assignment
   ZNumber& operator-=(const ZNumber& x) {
-    this->_n -= x._n;
-    return *this;
+    int64_t r;
+    if (this->_is_small && x._is_small &&
+        !detail::sub_overflow(this->_small, x._small, &r)) {
+      this->_small = r;
+      return *this;
+    }
+    return this->apply_mpz(x, [](mpz_class& a, const auto& b) { a -= b; });
   }
 
   /// \brief Subtraction assignment with integral types
   template < typename T,
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   ZNumber& operator-=(T x) {
-    this->_n -= detail::MpzAdapter< T >()(x);
-    return *this;
+    return this->operator-=(ZNumber(x));
   }
 
   /// \brief Multiplication assignment
   ZNumber& operator*=(const ZNumber& x) {
-    this->_n *= x._n;
-    return *this;
+    int64_t r;
+    if (this->_is_small && x._is_small &&
+        !detail::mul_overflow(this->_small, x._small, &r)) {
+      this->_small = r;
+      return *this;
+    }
+    return this->apply_mpz(x, [](mpz_class& a, const auto& b) { a *= b; });
   }
 
   /// \brief Multiplication assignment with integral types
   template < typename T,
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   ZNumber& operator*=(T x) {
-    this->_n *= detail::MpzAdapter< T >()(x);
-    return *this;
+    return this->operator*=(ZNumber(x));
   }
 
   /// \brief Integer division assignment
   ///
   /// Integer division with rounding towards zero.
   ZNumber& operator/=(const ZNumber& x) {
-    ikos_assert_msg(x._n != 0, "division by zero");
-    this->_n /= x._n;
-    return *this;
+    ikos_assert_msg(!x.is_zero(), "division by zero");
+    if (this->_is_small && x._is_small &&
+        !(this->_small == std::numeric_limits< int64_t >::min() &&
+          x._small == -1)) {
+      this->_small /= x._small;
+      return *this;
+    }
+    return this->apply_mpz(x, [](mpz_class& a, const auto& b) { a /= b; });
   }
 
   /// \brief Integer division assignment with integral types
@@ -426,8 +586,7 @@ public:
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   ZNumber& operator/=(T x) {
     ikos_assert_msg(x != 0, "division by zero");
-    this->_n /= detail::MpzAdapter< T >()(x);
-    return *this;
+    return this->operator/=(ZNumber(x));
   }
 
   /// \brief Remainder assignment
@@ -438,9 +597,13 @@ public:
   /// The sign of `x` is ignored, and the result will have the same sign as
   /// `this`.
   ZNumber& operator%=(const ZNumber& x) {
-    ikos_assert_msg(x._n != 0, "division by zero");
-    this->_n %= x._n;
-    return *this;
+    ikos_assert_msg(!x.is_zero(), "division by zero");
+    if (this->_is_small && x._is_small) {
+      // Avoid the overflow of `INT64_MIN % -1`
+      this->_small = (x._small == -1) ? 0 : (this->_small % x._small);
+      return *this;
+    }
+    return this->apply_mpz(x, [](mpz_class& a, const auto& b) { a %= b; });
   }
 
   /// \brief Remainder assignment with integral types
@@ -454,60 +617,64 @@ public:
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   ZNumber& operator%=(T x) {
     ikos_assert_msg(x != 0, "division by zero");
-    this->_n %= detail::MpzAdapter< T >()(x);
-    return *this;
+    return this->operator%=(ZNumber(x));
   }
 
   /// \brief Bitwise AND assignment
   ZNumber& operator&=(const ZNumber& x) {
-    this->_n &= x._n;
-    return *this;
+    if (this->_is_small && x._is_small) {
+      this->_small &= x._small;
+      return *this;
+    }
+    return this->apply_mpz(x, [](mpz_class& a, const auto& b) { a &= b; });
   }
 
   /// \brief Bitwise AND assignment with integral types
   template < typename T,
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   ZNumber& operator&=(T x) {
-    this->_n &= detail::MpzAdapter< T >()(x);
-    return *this;
+    return this->operator&=(ZNumber(x));
   }
 
   /// \brief Bitwise OR assignment
   ZNumber& operator|=(const ZNumber& x) {
-    this->_n |= x._n;
-    return *this;
+    if (this->_is_small && x._is_small) {
+      this->_small |= x._small;
+      return *this;
+    }
+    return this->apply_mpz(x, [](mpz_class& a, const auto& b) { a |= b; });
   }
 
   /// \brief Bitwise OR assignment with integral types
   template < typename T,
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   ZNumber& operator|=(T x) {
-    this->_n |= detail::MpzAdapter< T >()(x);
-    return *this;
+    return this->operator|=(ZNumber(x));
   }
 
   /// \brief Bitwise XOR assignment
   ZNumber& operator^=(const ZNumber& x) {
-    this->_n ^= x._n;
-    return *this;
+    if (this->_is_small && x._is_small) {
+      this->_small ^= x._small;
+      return *this;
+    }
+    return this->apply_mpz(x, [](mpz_class& a, const auto& b) { a ^= b; });
   }
 
   /// \brief Bitwise XOR assignment with integral types
   template < typename T,
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   ZNumber& operator^=(T x) {
-    this->_n ^= detail::MpzAdapter< T >()(x);
-    return *this;
+    return this->operator^=(ZNumber(x));
   }
 
   /// \brief Left binary shift assignment
   ///
   /// This is undefined if `x` isn't between 0 and 2**32 - 1
   ZNumber& operator<<=(const ZNumber& x) {
-    ikos_assert_msg(x._n >= 0, "shift count is negative");
-    ikos_assert_msg(x._n.fits_ulong_p(), "shift count is too big");
-    this->_n <<= x._n.get_ui();
-    return *this;
+    ikos_assert_msg(x.sign() >= 0, "shift count is negative");
+    ikos_assert_msg(x.fits< unsigned long >(), "shift count is too big");
+    return this->shl(x.to< unsigned long >());
   }
 
   /// \brief Left binary shift assignment with integral types
@@ -517,18 +684,16 @@ public:
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   ZNumber& operator<<=(T x) {
     ikos_assert_msg(x >= 0, "shift count is negative");
-    this->_n <<= static_cast< unsigned long int >(x);
-    return *this;
+    return this->shl(static_cast< unsigned long int >(x));
   }
 
   /// \brief Right binary shift
   ///
   /// This is undefined if `x` isn't between 0 and 2**32 - 1
   ZNumber& operator>>=(const ZNumber& x) {
-    ikos_assert_msg(x._n >= 0, "shift count is negative");
-    ikos_assert_msg(x._n.fits_ulong_p(), "shift count is too big");
-    this->_n >>= x._n.get_ui();
-    return *this;
+    ikos_assert_msg(x.sign() >= 0, "shift count is negative");
+    ikos_assert_msg(x.fits< unsigned long >(), "shift count is too big");
+    return this->shr(x.to< unsigned long >());
   }
 
   /// \brief Right binary shift with integral types
@@ -538,8 +703,7 @@ public:
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   ZNumber& operator>>=(T x) {
     ikos_assert_msg(x >= 0, "shift count is negative");
-    this->_n >>= static_cast< unsigned long int >(x);
-    return *this;
+    return this->shr(static_cast< unsigned long int >(x));
   }
 
   /// @}
@@ -551,30 +715,50 @@ public:
 
   /// \brief Prefix increment
   ZNumber& operator++() {
-    ++this->_n;
+    if (this->_is_small &&
+        this->_small != std::numeric_limits< int64_t >::max()) {
+      ++this->_small;
+      return *this;
+    }
+    this->promote();
+    ++this->_big;
+    this->normalize();
     return *this;
   }
 
   /// \brief Postfix increment
   const ZNumber operator++(int) {
     ZNumber r(*this);
-    ++this->_n;
+    ++(*this);
     return r;
   }
 
   /// \brief Unary minus
-  const ZNumber operator-() const { return ZNumber(-this->_n); }
+  const ZNumber operator-() const {
+    if (this->_is_small &&
+        this->_small != std::numeric_limits< int64_t >::min()) {
+      return ZNumber(-this->_small);
+    }
+    return ZNumber(-this->mpz());
+  }
 
   /// \brief Prefix decrement
   ZNumber& operator--() {
-    --this->_n;
+    if (this->_is_small &&
+        this->_small != std::numeric_limits< int64_t >::min()) {
+      --this->_small;
+      return *this;
+    }
+    this->promote();
+    --this->_big;
+    this->normalize();
     return *this;
   }
 
   /// \brief Postfix decrement
   const ZNumber operator--(int) {
     ZNumber r(*this);
-    --this->_n;
+    --(*this);
     return r;
   }
 
@@ -582,14 +766,17 @@ public:
   ///
   /// This is undefined for negative numbers.
   ZNumber next_power_of_2() const {
-    ikos_assert(this->_n >= 0);
+    ikos_assert(this->sign() >= 0);
 
-    if (this->_n <= 1) {
+    if (this->_is_small && this->_small <= 1) {
       return ZNumber(1);
     }
 
-    ZNumber n(this->_n - 1);
-    return ZNumber(mpz_class(1) << n.size_in_bits());
+    ZNumber n(*this);
+    --n;
+    ZNumber r(1);
+    r.shl(n.size_in_bits());
+    return r;
   }
 
   /// @}
@@ -600,66 +787,191 @@ public:
   ///
   /// This is undefined if the number is 0.
   uint64_t trailing_zeros() const {
-    ikos_assert(this->_n != 0);
-    return mpz_scan1(this->_n.get_mpz_t(), 0);
+    ikos_assert(!this->is_zero());
+    if (this->_is_small) {
+#if __has_builtin(__builtin_ctzll) || IKOS_GNUC_PREREQ(4, 0, 0)
+      return static_cast< uint64_t >(
+          __builtin_ctzll(static_cast< uint64_t >(this->_small)));
+#else
+      return mpz_scan1(this->mpz().get_mpz_t(), 0);
+#endif
+    }
+    return mpz_scan1(this->_big.get_mpz_t(), 0);
   }
 
   /// \brief Return the number of trailing '1' bits
   ///
   /// This is undefined if the number is -1.
   uint64_t trailing_ones() const {
-    ikos_assert(this->_n != -1);
-    return mpz_scan0(this->_n.get_mpz_t(), 0);
+    ikos_assert(!(this->_is_small && this->_small == -1));
+    if (this->_is_small) {
+#if __has_builtin(__builtin_ctzll) || IKOS_GNUC_PREREQ(4, 0, 0)
+      return static_cast< uint64_t >(
+          __builtin_ctzll(~static_cast< uint64_t >(this->_small)));
+#else
+      return mpz_scan0(this->mpz().get_mpz_t(), 0);
+#endif
+    }
+    return mpz_scan0(this->_big.get_mpz_t(), 0);
   }
 
   /// \brief Return the number of bits
   ///
   /// The sign is ignored.
   uint64_t size_in_bits() const {
-    return mpz_sizeinbase(this->_n.get_mpz_t(), 2);
+    if (this->_is_small) {
+      if (this->_small == 0) {
+        return 1;
+      }
+#if __has_builtin(__builtin_clzll) || IKOS_GNUC_PREREQ(4, 0, 0)
+      return 64 - static_cast< uint64_t >(
+                      __builtin_clzll(detail::unsigned_abs(this->_small)));
+#else
+      return mpz_sizeinbase(this->mpz().get_mpz_t(), 2);
+#endif
+    }
+    return mpz_sizeinbase(this->_big.get_mpz_t(), 2);
   }
 
   /// @}
   /// \name Conversion Functions
   /// @{
 
-  /// \brief Get the internal representation
-  const mpz_class& mpz() const { return this->_n; }
+  /// \brief Return the number as a mpz_class
+  mpz_class mpz() const {
+    if (this->_is_small) {
+      return mpz_class(detail::MpzAdapter< int64_t >()(this->_small));
+    }
+    return this->_big;
+  }
 
   /// \brief Return true if the number fits in the given integer type
   template < typename T,
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   bool fits() const {
-    return detail::MpzFits< T >()(this->_n);
+    if (this->_is_small) {
+      return detail::int64_fits< T >(this->_small);
+    }
+    return detail::MpzFits< T >()(this->_big);
   }
 
   /// \brief Return the number as the given integer type
   template < typename T,
              class = std::enable_if_t< IsSupportedIntegral< T >::value > >
   T to() const {
-    ikos_assert_msg(detail::MpzFits< T >()(this->_n), "does not fit");
-    return detail::MpzTo< T >()(this->_n);
+    ikos_assert_msg(this->fits< T >(), "does not fit");
+    if (this->_is_small) {
+      return static_cast< T >(this->_small);
+    }
+    return detail::MpzTo< T >()(this->_big);
   }
 
   /// \brief Return a string representation of the ZNumber in the given base
   ///
   /// The base can vary from 2 to 36, or from -2 to -36
-  std::string str(int base = 10) const { return this->_n.get_str(base); }
+  std::string str(int base = 10) const {
+    if (this->_is_small && base == 10) {
+      return std::to_string(this->_small);
+    }
+    return this->mpz().get_str(base);
+  }
 
   /// @}
 
+private:
+  /// \brief Return true if the number is 0
+  bool is_zero() const { return this->_is_small && this->_small == 0; }
+
+  /// \brief Return -1, 0 or 1 depending on the sign of the number
+  int sign() const {
+    if (this->_is_small) {
+      return (this->_small > 0) - (this->_small < 0);
+    }
+    return mpz_sgn(this->_big.get_mpz_t());
+  }
+
+  /// \brief Set the number to the given int64_t
+  void set_small(int64_t n) noexcept {
+    if (!this->_is_small) {
+      this->_big.~mpz_class();
+      this->_is_small = true;
+    }
+    this->_small = n;
+  }
+
+  /// \brief Switch to the GMP representation
+  void promote() {
+    if (this->_is_small) {
+      int64_t n = this->_small;
+      new (&this->_big) mpz_class(detail::MpzAdapter< int64_t >()(n));
+      this->_is_small = false;
+    }
+  }
+
+  /// \brief Switch back to the inline representation, if the number fits
+  void normalize() {
+    if (!this->_is_small && detail::MpzFits< int64_t >()(this->_big)) {
+      this->set_small(detail::MpzTo< int64_t >()(this->_big));
+    }
+  }
+
+  /// \brief Apply `op` on the GMP representations of `this` and `x`
+  template < typename Op >
+  ZNumber& apply_mpz(const ZNumber& x, Op op) {
+    this->promote();
+    if (x._is_small) {
+      op(this->_big, detail::MpzAdapter< int64_t >()(x._small));
+    } else {
+      op(this->_big, x._big);
+    }
+    this->normalize();
+    return *this;
+  }
+
+  /// \brief Left binary shift by `n` bits
+  ZNumber& shl(unsigned long n) {
+    int64_t r;
+    if (this->_is_small && n < 63 &&
+        !detail::mul_overflow(this->_small, int64_t(1) << n, &r)) {
+      this->_small = r;
+      return *this;
+    }
+    this->promote();
+    this->_big <<= n;
+    this->normalize();
+    return *this;
+  }
+
+  /// \brief Right binary shift by `n` bits, rounding towards minus infinity
+  ZNumber& shr(unsigned long n) {
+    if (this->_is_small) {
+      if (n < 64) {
+        this->_small >>= n;
+      } else {
+        this->_small = (this->_small < 0) ? -1 : 0;
+      }
+      return *this;
+    }
+    this->_big >>= n;
+    this->normalize();
+    return *this;
+  }
+
+  friend class detail::BoundInfinity< ZNumber >;
+
+  friend bool operator==(const ZNumber&, const ZNumber&);
+
+  friend bool operator<(const ZNumber&, const ZNumber&);
+
   friend ZNumber mod(const ZNumber&, const ZNumber&);
 
   friend ZNumber gcd(const ZNumber&, const ZNumber&);
 
   friend ZNumber lcm(const ZNumber&, const ZNumber&);
 
-  friend void gcd_extended(
-      const ZNumber&, const ZNumber&, ZNumber&, ZNumber&, ZNumber&);
-
-  friend std::istream& operator>>(std::istream& i, ZNumber& n);
+  friend std::ostream& operator<<(std::ostream& o, const ZNumber& n);
 
-  friend class QNumber;
+  friend std::size_t hash_value(const ZNumber&);
 
 }; // end class ZNumber
 
@@ -668,67 +980,86 @@ public:
 
 /// \brief Addition
 inline ZNumber operator+(const ZNumber& lhs, const ZNumber& rhs) {
-  return ZNumber(lhs.mpz() + rhs.mpz());
+  ZNumber r(lhs);
+  r += rhs;
+  return r;
 }
 
 /// \brief Addition with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator+(const ZNumber& lhs, T rhs) {
-  return ZNumber(lhs.mpz() + detail::MpzAdapter< T >()(rhs));
+  ZNumber r(lhs);
+  r += rhs;
+  return r;
 }
 
 /// \brief Addition with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator+(T lhs, const ZNumber& rhs) {
-  return ZNumber(detail::MpzAdapter< T >()(lhs) + rhs.mpz());
+  ZNumber r(lhs);
+  r += rhs;
+  return r;
 }
 
 /// \brief Subtraction
 inline ZNumber operator-(const ZNumber& lhs, const ZNumber& rhs) {
-  return ZNumber(lhs.mpz() - rhs.mpz());
+  ZNumber r(lhs);
+  r -= rhs;
+  return r;
 }
 
 /// \brief Subtraction with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator-(const ZNumber& lhs, T rhs) {
-  return ZNumber(lhs.mpz() - detail::MpzAdapter< T >()(rhs));
+  ZNumber r(lhs);
+  r -= rhs;
+  return r;
 }
 
 /// \brief Subtraction with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator-(T lhs, const ZNumber& rhs) {
-  return ZNumber(detail::MpzAdapter< T >()(lhs) - rhs.mpz());
+  ZNumber r(lhs);
+  r -= rhs;
+  return r;
 }
 
 /// \brief Multiplication
 inline ZNumber operator*(const ZNumber& lhs, const ZNumber& rhs) {
-  return ZNumber(lhs.mpz() * rhs.mpz());
+  ZNumber r(lhs);
+  r *= rhs;
+  return r;
 }
 
 /// \brief Multiplication with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator*(const ZNumber& lhs, T rhs) {
-  return ZNumber(lhs.mpz() * detail::MpzAdapter< T >()(rhs));
+  ZNumber r(lhs);
+  r *= rhs;
+  return r;
 }
 
 /// \brief Multiplication with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator*(T lhs, const ZNumber& rhs) {
-  return ZNumber(detail::MpzAdapter< T >()(lhs) * rhs.mpz());
+  ZNumber r(lhs);
+  r *= rhs;
+  return r;
 }
 
 /// \brief Integer division
 ///
 /// Integer division with rounding towards zero.
 inline ZNumber operator/(const ZNumber& lhs, const ZNumber& rhs) {
-  ikos_assert_msg(rhs.mpz() != 0, "division by zero");
-  return ZNumber(lhs.mpz() / rhs.mpz());
+  ZNumber r(lhs);
+  r /= rhs;
+  return r;
 }
 
 /// \brief Integer division with integral types
@@ -737,8 +1068,9 @@ inline ZNumber operator/(const ZNumber& lhs, const ZNumber& rhs) {
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator/(const ZNumber& lhs, T rhs) {
-  ikos_assert_msg(rhs != 0, "division by zero");
-  return ZNumber(lhs.mpz() / detail::MpzAdapter< T >()(rhs));
+  ZNumber r(lhs);
+  r /= rhs;
+  return r;
 }
 
 /// \brief Integer division with integral types
@@ -747,8 +1079,9 @@ inline ZNumber operator/(const ZNumber& lhs, T rhs) {
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator/(T lhs, const ZNumber& rhs) {
-  ikos_assert_msg(rhs.mpz() != 0, "division by zero");
-  return ZNumber(detail::MpzAdapter< T >()(lhs) / rhs.mpz());
+  ZNumber r(lhs);
+  r /= rhs;
+  return r;
 }
 
 /// \brief Remainder
@@ -759,8 +1092,9 @@ inline ZNumber operator/(T lhs, const ZNumber& rhs) {
 /// The sign of `rhs` is ignored, and the result will have the same sign as
 /// `lhs`.
 inline ZNumber operator%(const ZNumber& lhs, const ZNumber& rhs) {
-  ikos_assert_msg(rhs.mpz() != 0, "division by zero");
-  return ZNumber(lhs.mpz() % rhs.mpz());
+  ZNumber r(lhs);
+  r %= rhs;
+  return r;
 }
 
 /// \brief Remainder with integral types
@@ -773,8 +1107,9 @@ inline ZNumber operator%(const ZNumber& lhs, const ZNumber& rhs) {
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator%(const ZNumber& lhs, T rhs) {
-  ikos_assert_msg(rhs != 0, "division by zero");
-  return ZNumber(lhs.mpz() % detail::MpzAdapter< T >()(rhs));
+  ZNumber r(lhs);
+  r %= rhs;
+  return r;
 }
 
 /// \brief Remainder with integral types
@@ -787,74 +1122,93 @@ inline ZNumber operator%(const ZNumber& lhs, T rhs) {
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator%(T lhs, const ZNumber& rhs) {
-  ikos_assert_msg(rhs.mpz() != 0, "division by zero");
-  return ZNumber(detail::MpzAdapter< T >()(lhs) % rhs.mpz());
+  ZNumber r(lhs);
+  r %= rhs;
+  return r;
 }
 
 /// \brief Bitwise AND
 inline ZNumber operator&(const ZNumber& lhs, const ZNumber& rhs) {
-  return ZNumber(lhs.mpz() & rhs.mpz());
+  ZNumber r(lhs);
+  r &= rhs;
+  return r;
 }
 
 /// \brief Bitwise AND with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator&(const ZNumber& lhs, T rhs) {
-  return ZNumber(lhs.mpz() & detail::MpzAdapter< T >()(rhs));
+  ZNumber r(lhs);
+  r &= rhs;
+  return r;
 }
 
 /// \brief Bitwise AND with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator&(T lhs, const ZNumber& rhs) {
-  return ZNumber(detail::MpzAdapter< T >()(lhs) & rhs.mpz());
+  ZNumber r(lhs);
+  r &= rhs;
+  return r;
 }
 
 /// \brief Bitwise OR
 inline ZNumber operator|(const ZNumber& lhs, const ZNumber& rhs) {
-  return ZNumber(lhs.mpz() | rhs.mpz());
+  ZNumber r(lhs);
+  r |= rhs;
+  return r;
 }
 
 /// \brief Bitwise OR with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator|(const ZNumber& lhs, T rhs) {
-  return ZNumber(lhs.mpz() | detail::MpzAdapter< T >()(rhs));
+  ZNumber r(lhs);
+  r |= rhs;
+  return r;
 }
 
 /// \brief Bitwise OR with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator|(T lhs, const ZNumber& rhs) {
-  return ZNumber(detail::MpzAdapter< T >()(lhs) | rhs.mpz());
+  ZNumber r(lhs);
+  r |= rhs;
+  return r;
 }
 
 /// \brief Bitwise XOR
 inline ZNumber operator^(const ZNumber& lhs, const ZNumber& rhs) {
-  return ZNumber(lhs.mpz() ^ rhs.mpz());
+  ZNumber r(lhs);
+  r ^= rhs;
+  return r;
 }
 
 /// \brief Bitwise XOR with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator^(const ZNumber& lhs, T rhs) {
-  return ZNumber(lhs.mpz() ^ detail::MpzAdapter< T >()(rhs));
+  ZNumber r(lhs);
+  r ^= rhs;
+  return r;
 }
 
 /// \brief Bitwise XOR with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator^(T lhs, const ZNumber& rhs) {
-  return ZNumber(detail::MpzAdapter< T >()(lhs) ^ rhs.mpz());
+  ZNumber r(lhs);
+  r ^= rhs;
+  return r;
 }
 
 /// \brief Left binary shift
 ///
 /// This is undefined if `rhs` isn't between 0 and 2**32 - 1
 inline ZNumber operator<<(const ZNumber& lhs, const ZNumber& rhs) {
-  ikos_assert_msg(rhs.mpz() >= 0, "shift count is negative");
-  ikos_assert_msg(rhs.mpz().fits_ulong_p(), "shift count is too big");
-  return ZNumber(lhs.mpz() << rhs.mpz().get_ui());
+  ZNumber r(lhs);
+  r <<= rhs;
+  return r;
 }
 
 /// \brief Left binary shift with integral types
@@ -863,8 +1217,9 @@ inline ZNumber operator<<(const ZNumber& lhs, const ZNumber& rhs) {
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator<<(const ZNumber& lhs, T rhs) {
-  ikos_assert_msg(rhs >= 0, "shift count is negative");
-  return ZNumber(lhs.mpz() << static_cast< unsigned long int >(rhs));
+  ZNumber r(lhs);
+  r <<= rhs;
+  return r;
 }
 
 /// \brief Left binary shift with integral types
@@ -882,9 +1237,9 @@ inline ZNumber operator<<(T lhs, const ZNumber& rhs) {
 ///
 /// This is undefined if `rhs` isn't between 0 and 2**32 - 1
 inline ZNumber operator>>(const ZNumber& lhs, const ZNumber& rhs) {
-  ikos_assert_msg(rhs.mpz() >= 0, "shift count is negative");
-  ikos_assert_msg(rhs.mpz().fits_ulong_p(), "shift count is too big");
-  return ZNumber(lhs.mpz() >> rhs.mpz().get_ui());
+  ZNumber r(lhs);
+  r >>= rhs;
+  return r;
 }
 
 /// \brief Right binary shift with integral types
@@ -893,8 +1248,9 @@ inline ZNumber operator>>(const ZNumber& lhs, const ZNumber& rhs) {
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline ZNumber operator>>(const ZNumber& lhs, T rhs) {
-  ikos_assert_msg(rhs >= 0, "shift count is negative");
-  return ZNumber(lhs.mpz() >> static_cast< unsigned long int >(rhs));
+  ZNumber r(lhs);
+  r >>= rhs;
+  return r;
 }
 
 /// \brief Right binary shift with integral types
@@ -914,116 +1270,133 @@ inline ZNumber operator>>(T lhs, const ZNumber& rhs) {
 
 /// \brief Equality operator
 inline bool operator==(const ZNumber& lhs, const ZNumber& rhs) {
-  return lhs.mpz() == rhs.mpz();
+  if (lhs._is_small && rhs._is_small) {
+    return lhs._small == rhs._small;
+  } else if (lhs._is_small || rhs._is_small) {
+    // The representation is canonical
+    return false;
+  } else {
+    return lhs._big == rhs._big;
+  }
 }
 
 /// \brief Equality operator with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline bool operator==(const ZNumber& lhs, T rhs) {
-  return lhs.mpz() == detail::MpzAdapter< T >()(rhs);
+  return lhs == ZNumber(rhs);
 }
 
 /// \brief Equality operator with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline bool operator==(T lhs, const ZNumber& rhs) {
-  return detail::MpzAdapter< T >()(lhs) == rhs.mpz();
+  return ZNumber(lhs) == rhs;
 }
 
 /// \brief Inequality operator
 inline bool operator!=(const ZNumber& lhs, const ZNumber& rhs) {
-  return lhs.mpz() != rhs.mpz();
+  return !(lhs == rhs);
 }
 
 /// \brief Inequality operator with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline bool operator!=(const ZNumber& lhs, T rhs) {
-  return lhs.mpz() != detail::MpzAdapter< T >()(rhs);
+  return !(lhs == ZNumber(rhs));
 }
 
 /// \brief Inequality operator with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline bool operator!=(T lhs, const ZNumber& rhs) {
-  return detail::MpzAdapter< T >()(lhs) != rhs.mpz();
+  return !(ZNumber(lhs) == rhs);
 }
 
 /// \brief Less than comparison
 inline bool operator<(const ZNumber& lhs, const ZNumber& rhs) {
-  return lhs.mpz() < rhs.mpz();
+  if (lhs._is_small && rhs._is_small) {
+    return lhs._small < rhs._small;
+  } else if (lhs._is_small) {
+    // `rhs` does not fit in an int64_t
+    return mpz_sgn(rhs._big.get_mpz_t()) > 0;
+  } else if (rhs._is_small) {
+    // `lhs` does not fit in an int64_t
+    return mpz_sgn(lhs._big.get_mpz_t()) < 0;
+  } else {
+    return lhs._big < rhs._big;
+  }
 }
 
 /// \brief Less than comparison with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline bool operator<(const ZNumber& lhs, T rhs) {
-  return lhs.mpz() < detail::MpzAdapter< T >()(rhs);
+  return lhs < ZNumber(rhs);
 }
 
 /// \brief Less than comparison with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline bool operator<(T lhs, const ZNumber& rhs) {
-  return detail::MpzAdapter< T >()(lhs) < rhs.mpz();
+  return ZNumber(lhs) < rhs;
 }
 
 /// \brief Less or equal comparison
 inline bool operator<=(const ZNumber& lhs, const ZNumber& rhs) {
-  return lhs.mpz() <= rhs.mpz();
+  return !(rhs < lhs);
 }
 
 /// \brief Less or equal comparison with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline bool operator<=(const ZNumber& lhs, T rhs) {
-  return lhs.mpz() <= detail::MpzAdapter< T >()(rhs);
+  return !(ZNumber(rhs) < lhs);
 }
 
 /// \brief Less or equal comparison with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline bool operator<=(T lhs, const ZNumber& rhs) {
-  return detail::MpzAdapter< T >()(lhs) <= rhs.mpz();
+  return !(rhs < ZNumber(lhs));
 }
 
 /// \brief Greater than comparison
 inline bool operator>(const ZNumber& lhs, const ZNumber& rhs) {
-  return lhs.mpz() > rhs.mpz();
+  return rhs < lhs;
 }
 
 /// \brief Greater than comparison with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline bool operator>(const ZNumber& lhs, T rhs) {
-  return lhs.mpz() > detail::MpzAdapter< T >()(rhs);
+  return ZNumber(rhs) < lhs;
 }
 
 /// \brief Greater than comparison with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline bool operator>(T lhs, const ZNumber& rhs) {
-  return detail::MpzAdapter< T >()(lhs) > rhs.mpz();
+  return rhs < ZNumber(lhs);
 }
 
 /// \brief Greater or equal comparison
 inline bool operator>=(const ZNumber& lhs, const ZNumber& rhs) {
-  return lhs.mpz() >= rhs.mpz();
+  return !(lhs < rhs);
 }
 
 /// \brief Greater or equal comparison with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline bool operator>=(const ZNumber& lhs, T rhs) {
-  return lhs.mpz() >= detail::MpzAdapter< T >()(rhs);
+  return !(lhs < ZNumber(rhs));
 }
 
 /// \brief Greater or equal comparison with integral types
 template < typename T,
            class = std::enable_if_t< IsSupportedIntegral< T >::value > >
 inline bool operator>=(T lhs, const ZNumber& rhs) {
-  return detail::MpzAdapter< T >()(lhs) >= rhs.mpz();
+  return !(ZNumber(lhs) < rhs);
 }
 
 /// @}
@@ -1077,15 +1450,23 @@ inline const ZNumber& max(const ZNumber& a,
 ///
 /// The sign of `d` is ignored, and the result is always non-negative.
 inline ZNumber mod(const ZNumber& n, const ZNumber& d) {
-  ikos_assert_msg(d.mpz() != 0, "division by zero");
-  ZNumber r;
-  mpz_mod(r._n.get_mpz_t(), n._n.get_mpz_t(), d._n.get_mpz_t());
-  return r;
+  ikos_assert_msg(d != 0, "division by zero");
+  if (n._is_small && d._is_small &&
+      d._small != std::numeric_limits< int64_t >::min()) {
+    int64_t r = (d._small == -1) ? 0 : (n._small % d._small);
+    if (r < 0) {
+      r += (d._small < 0) ? -d._small : d._small;
+    }
+    return ZNumber(r);
+  }
+  mpz_class r;
+  mpz_mod(r.get_mpz_t(), n.mpz().get_mpz_t(), d.mpz().get_mpz_t());
+  return ZNumber(std::move(r));
 }
 
 /// \brief Return the absolute value of the given number
 inline ZNumber abs(const ZNumber& n) {
-  return ZNumber(abs(n.mpz()));
+  return (n < 0) ? -n : n;
 }
 
 /// \brief Return the greatest common divisor of the given numbers
@@ -1094,9 +1475,13 @@ inline ZNumber abs(const ZNumber& n) {
 /// negative. Except if both inputs are zero; then this function defines
 /// `gcd(0, 0) = 0`.
 inline ZNumber gcd(const ZNumber& a, const ZNumber& b) {
-  ZNumber r;
-  mpz_gcd(r._n.get_mpz_t(), a._n.get_mpz_t(), b._n.get_mpz_t());
-  return r;
+  if (a._is_small && b._is_small) {
+    return ZNumber(detail::gcd_u64(detail::unsigned_abs(a._small),
+                                   detail::unsigned_abs(b._small)));
+  }
+  mpz_class r;
+  mpz_gcd(r.get_mpz_t(), a.mpz().get_mpz_t(), b.mpz().get_mpz_t());
+  return ZNumber(std::move(r));
 }
 
 /// \brief Return the greatest common divisor of the given numbers
@@ -1106,9 +1491,20 @@ inline ZNumber gcd(const ZNumber& a, const ZNumber& b, const ZNumber& c) {
 
 /// \brief Return the least common multiple of the given numbers
 inline ZNumber lcm(const ZNumber& a, const ZNumber& b) {
-  ZNumber r;
-  mpz_lcm(r._n.get_mpz_t(), a._n.get_mpz_t(), b._n.get_mpz_t());
-  return r;
+  if (a._is_small && b._is_small) {
+    uint64_t x = detail::unsigned_abs(a._small);
+    uint64_t y = detail::unsigned_abs(b._small);
+    if (x == 0 || y == 0) {
+      return ZNumber(0);
+    }
+    uint64_t r;
+    if (!detail::mul_overflow(x / detail::gcd_u64(x, y), y, &r)) {
+      return ZNumber(r);
+    }
+  }
+  mpz_class r;
+  mpz_lcm(r.get_mpz_t(), a.mpz().get_mpz_t(), b.mpz().get_mpz_t());
+  return ZNumber(std::move(r));
 }
 
 /// \brief Run Euclid's algorithm
@@ -1119,11 +1515,15 @@ inline ZNumber lcm(const ZNumber& a, const ZNumber& b) {
 /// negative (or zero if both inputs are zero).
 inline void gcd_extended(
     const ZNumber& a, const ZNumber& b, ZNumber& g, ZNumber& u, ZNumber& v) {
-  mpz_gcdext(g._n.get_mpz_t(),
-             u._n.get_mpz_t(),
-             v._n.get_mpz_t(),
-             a._n.get_mpz_t(),
-             b._n.get_mpz_t());
+  mpz_class g_mpz, u_mpz, v_mpz;
+  mpz_gcdext(g_mpz.get_mpz_t(),
+             u_mpz.get_mpz_t(),
+             v_mpz.get_mpz_t(),
+             a.mpz().get_mpz_t(),
+             b.mpz().get_mpz_t());
+  g = ZNumber(std::move(g_mpz));
+  u = ZNumber(std::move(u_mpz));
+  v = ZNumber(std::move(v_mpz));
 }
 
 /// @}
@@ -1132,13 +1532,19 @@ inline void gcd_extended(
 
 /// \brief Write a ZNumber on a stream, in base 10
 inline std::ostream& operator<<(std::ostream& o, const ZNumber& n) {
-  o << n.mpz();
+  if (n._is_small) {
+    o << n._small;
+  } else {
+    o << n._big;
+  }
   return o;
 }
 
 /// \brief Read a ZNumber from a stream, in base 10
 inline std::istream& operator>>(std::istream& i, ZNumber& n) {
-  i >> n._n;
+  mpz_class m;
+  i >> m;
+  n = ZNumber(std::move(m));
   return i;
 }
 
@@ -1146,7 +1552,10 @@ inline std::istream& operator>>(std::istream& i, ZNumber& n) {
 
 /// \brief Return the hash of a ZNumber
 inline std::size_t hash_value(const ZNumber& n) {
-  const mpz_class& m = n.mpz();
+  if (n._is_small) {
+    return boost::hash_value(n._small);
+  }
+  const mpz_class& m = n._big;
   std::size_t result = 0;
   boost::hash_combine(result, m.get_mpz_t()[0]._mp_size);
   for (int i = 0, e = std::abs(m.get_mpz_t()[0]._mp_size); i < e; ++i) {
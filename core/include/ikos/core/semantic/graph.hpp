@@ -43,6 +43,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <ikos/core/support/mpl.hpp>
 
 namespace ikos {
@@ -75,6 +77,16 @@ namespace core {
 ///   Return iterators over the predecessors of the given node
 ///
 /// The GraphRef type should also be cheap to copy
+///
+/// Optionally, graphs that can number their nodes may provide:
+///
+/// static std::size_t index(NodeRef)
+///   Return a unique index for the given node
+///
+/// static std::size_t num_indices(GraphRef)
+///   Return an upper bound on the node indices of the graph
+///
+/// See IsIndexableGraph.
 template < typename GraphRef >
 struct GraphTraits {};
 
@@ -134,5 +146,29 @@ struct IsGraph<
             typename GraphTrait::PredecessorNodeIterator >::value > > >
     : std::true_type {};
 
+/// \brief Check if a type implements GraphTraits with node indices
+///
+/// Node indices must be dense, i.e within [0, GraphTrait::num_indices(g)).
+template < typename GraphRef,
+           typename GraphTrait = GraphTraits< GraphRef >,
+           typename = void >
+struct IsIndexableGraph : std::false_type {};
+
+template < typename GraphRef, typename GraphTrait >
+struct IsIndexableGraph<
+    GraphRef,
+    GraphTrait,
+    void_t<
+        // GraphTrait has: index(NodeRef) -> std::size_t
+        std::enable_if_t<
+            std::is_same< decltype(GraphTrait::index(
+                              std::declval< typename GraphTrait::NodeRef >())),
+                          std::size_t >::value >,
+        // GraphTrait has: num_indices(GraphRef) -> std::size_t
+        std::enable_if_t< std::is_same< decltype(GraphTrait::num_indices(
+                                            std::declval< GraphRef >())),
+                                        std::size_t >::value > > >
+    : std::true_type {};
+
 } // end namespace core
 } // end namespace ikos
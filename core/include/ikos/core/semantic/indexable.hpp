@@ -97,5 +97,35 @@ struct IsIndexable<
                                         std::declval< T >())) >::value > >
     : std::true_type {};
 
+/// \brief Traits for objects with dense indexes
+///
+/// Dense indexes are small indexes allocated consecutively, e.g by a counter.
+/// They are used e.g. by the dense map for storing the objects in arrays.
+///
+/// An object with dense indexes must provide:
+///
+/// static Index dense_index(const T&)
+///   Return a unique dense index
+///
+/// The trait is optional, and has to be specialized for each specific type.
+template < typename T >
+struct DenseIndexableTraits {};
+
+/// \brief Check if a type implements DenseIndexableTraits
+template < typename T,
+           typename DenseIndexableTrait = DenseIndexableTraits< T >,
+           typename = void >
+struct IsDenseIndexable : std::false_type {};
+
+template < typename T, typename DenseIndexableTrait >
+struct IsDenseIndexable<
+    T,
+    DenseIndexableTrait,
+    // Check if DenseIndexableTrait has: dense_index(const T&) -> Index
+    std::enable_if_t< std::is_same< Index,
+                                    decltype(DenseIndexableTrait::dense_index(
+                                        std::declval< T >())) >::value > >
+    : std::true_type {};
+
 } // end namespace core
 } // end namespace ikos
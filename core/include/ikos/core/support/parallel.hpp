@@ -0,0 +1,313 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Parallel execution of independent tasks
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ikos {
+namespace core {
+
+/// \brief Process-wide flag telling whether several threads may read the same
+/// abstract values
+///
+/// Abstract domains sharing state between copies (e.g, PolymorphicDomain)
+/// only lock it on reads while this is active, so that the single-threaded
+/// analysis does not pay for the locks.
+class ConcurrentReads {
+private:
+  static std::atomic< unsigned >& count_storage() {
+    static std::atomic< unsigned > count(0);
+    return count;
+  }
+
+public:
+  /// \brief Enter a scope where several threads may read the same abstract
+  /// values
+  ///
+  /// This must be called while no other thread reads abstract values, or
+  /// while the scope is already active.
+  static void enter() { count_storage().fetch_add(1); }
+
+  /// \brief Exit a scope entered with enter()
+  ///
+  /// This must be called while no other thread reads abstract values, or
+  /// while the scope is still active for another reason.
+  static void exit() { count_storage().fetch_sub(1); }
+
+  /// \brief Return true if several threads may read the same abstract values
+  static bool active() {
+    return count_storage().load(std::memory_order_relaxed) != 0;
+  }
+
+}; // end class ConcurrentReads
+
+namespace parallel_impl {
+
+/// \brief Persistent pool of worker threads, running one batch at a time
+///
+/// A batch is a task run by the calling thread and by up to N workers. The
+/// workers are created on demand and kept until the end of the process.
+class ThreadPool {
+private:
+  /// \brief Held by the thread running a batch
+  std::mutex _batch_mutex;
+
+  /// \brief Protects the members below
+  std::mutex _mutex;
+
+  /// \brief Signaled when a batch starts, or when the pool stops
+  std::condition_variable _start;
+
+  /// \brief Signaled when a worker finishes its part of a batch
+  std::condition_variable _finish;
+
+  /// \brief Worker threads
+  std::vector< std::thread > _threads;
+
+  /// \brief Task of the current batch
+  const std::function< void() >* _task = nullptr;
+
+  /// \brief Number of the current batch
+  std::size_t _batch = 0;
+
+  /// \brief Number of workers that can still join the current batch
+  unsigned _slots = 0;
+
+  /// \brief Number of workers running the current task
+  unsigned _running = 0;
+
+  /// \brief True when the pool is destroyed
+  bool _stop = false;
+
+public:
+  ThreadPool() = default;
+
+  ThreadPool(const ThreadPool&) = delete;
+
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /// \brief Stop and join the workers
+  ~ThreadPool() {
+    {
+      std::lock_guard< std::mutex > lock(this->_mutex);
+      this->_stop = true;
+    }
+    this->_start.notify_all();
+    for (std::thread& thread : this->_threads) {
+      thread.join();
+    }
+  }
+
+  /// \brief Return the pool of the process
+  static ThreadPool& get() {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  /// \brief Return true if the calling thread is a worker of a pool
+  static bool& is_worker() {
+    static thread_local bool worker = false;
+    return worker;
+  }
+
+  /// \brief Run `task` on the calling thread and on up to `workers` workers
+  ///
+  /// Returns false without running anything if another thread is running a
+  /// batch. The task must return once all the work is done.
+  bool try_run(unsigned workers, const std::function< void() >& task) {
+    std::unique_lock< std::mutex > batch_lock(this->_batch_mutex,
+                                              std::try_to_lock);
+    if (!batch_lock.owns_lock()) {
+      return false;
+    }
+
+    {
+      std::lock_guard< std::mutex > lock(this->_mutex);
+      while (this->_threads.size() < workers) {
+        this->_threads.emplace_back([this] { this->work(); });
+      }
+      this->_task = &task;
+      this->_batch++;
+      this->_slots = workers;
+    }
+    this->_start.notify_all();
+
+    task();
+
+    // Close the batch, and wait for the workers that joined it
+    std::unique_lock< std::mutex > lock(this->_mutex);
+    this->_slots = 0;
+    this->_finish.wait(lock, [this] { return this->_running == 0; });
+    this->_task = nullptr;
+    return true;
+  }
+
+private:
+  /// \brief Main loop of a worker
+  void work() {
+    is_worker() = true;
+    std::size_t last_batch = 0;
+    std::unique_lock< std::mutex > lock(this->_mutex);
+    while (true) {
+      this->_start.wait(lock, [&] {
+        return this->_stop ||
+               (this->_batch != last_batch && this->_slots > 0);
+      });
+      if (this->_stop) {
+        return;
+      }
+      last_batch = this->_batch;
+      this->_slots--;
+      this->_running++;
+      const std::function< void() >& task = *this->_task;
+      lock.unlock();
+      task();
+      lock.lock();
+      if (--this->_running == 0) {
+        this->_finish.notify_one();
+      }
+    }
+  }
+
+}; // end class ThreadPool
+
+} // end namespace parallel_impl
+
+/// \brief Parallel execution of independent tasks
+///
+/// Used by the abstract domains to process independent parts of an abstract
+/// value (e.g, the packs of a variable packing domain) concurrently.
+///
+/// The number of threads is a process-wide setting, 1 (sequential) by default.
+/// The calls are run by a persistent pool of threads, created on first use.
+class Parallel {
+private:
+  static std::atomic< unsigned >& jobs_storage() {
+    static std::atomic< unsigned > jobs(1);
+    return jobs;
+  }
+
+public:
+  /// \brief Set the number of threads, including the calling thread
+  static void set_jobs(unsigned jobs) {
+    jobs_storage().store(std::max(jobs, 1u));
+  }
+
+  /// \brief Return the number of threads, including the calling thread
+  static unsigned jobs() { return jobs_storage().load(); }
+
+  /// \brief Call `f(i)` for each `i` in [0, n)
+  ///
+  /// The calls are distributed over several threads if there are at least
+  /// `threshold` of them, otherwise they are performed sequentially by the
+  /// calling thread. The calls must be independent. They are also performed
+  /// sequentially when called from a call of another for_each_index(), or
+  /// while another thread uses the pool.
+  ///
+  /// ConcurrentReads is active during the parallel calls.
+  ///
+  /// If a call throws an exception, the remaining calls are skipped and the
+  /// exception is rethrown by the calling thread.
+  template < typename Function >
+  static void for_each_index(std::size_t n,
+                             std::size_t threshold,
+                             const Function& f) {
+    unsigned jobs = Parallel::jobs();
+    if (jobs <= 1 || n < threshold || n < 2 ||
+        parallel_impl::ThreadPool::is_worker()) {
+      for (std::size_t i = 0; i < n; i++) {
+        f(i);
+      }
+      return;
+    }
+
+    jobs = static_cast< unsigned >(std::min< std::size_t >(jobs, n));
+
+    std::atomic< std::size_t > next(0);
+    std::atomic< bool > failed(false);
+    std::exception_ptr error = nullptr;
+    std::mutex error_mutex;
+
+    std::function< void() > worker = [&]() {
+      while (!failed.load(std::memory_order_relaxed)) {
+        std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+        if (i >= n) {
+          return;
+        }
+        try {
+          f(i);
+        } catch (...) {
+          std::lock_guard< std::mutex > lock(error_mutex);
+          if (error == nullptr) {
+            error = std::current_exception();
+          }
+          failed.store(true, std::memory_order_relaxed);
+        }
+      }
+    };
+
+    ConcurrentReads::enter();
+    bool parallel = parallel_impl::ThreadPool::get().try_run(jobs - 1, worker);
+    ConcurrentReads::exit();
+    if (!parallel) {
+      worker();
+    }
+
+    if (error != nullptr) {
+      std::rethrow_exception(error);
+    }
+  }
+
+}; // end class Parallel
+
+} // end namespace core
+} // end namespace ikos
@@ -51,6 +51,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <boost/optional.hpp>
 
 #include <ikos/core/domain/abstract_domain.hpp>
@@ -333,6 +335,19 @@ public:
     this->join_with(other);
   }
 
+  Congruence widening_threshold(
+      const Congruence& other,
+      const std::vector< MachineInt >& /*thresholds*/) const {
+    // equivalent to join, domain is flat
+    return this->join(other);
+  }
+
+  void widen_threshold_with(const Congruence& other,
+                            const std::vector< MachineInt >& /*thresholds*/) {
+    // equivalent to join, domain is flat
+    this->join_with(other);
+  }
+
   Congruence meet(const Congruence& other) const override {
     assert_compatible(*this, other);
     return Congruence(this->_c.meet(other._c), this->_bit_width, this->_sign);
@@ -43,6 +43,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <boost/optional.hpp>
 
 #include <ikos/core/domain/abstract_domain.hpp>
@@ -197,6 +199,19 @@ public:
     this->join_with(other);
   }
 
+  Constant widening_threshold(
+      const Constant& other,
+      const std::vector< MachineInt >& /*thresholds*/) const {
+    // equivalent to join, domain is flat
+    return this->join(other);
+  }
+
+  void widen_threshold_with(const Constant& other,
+                            const std::vector< MachineInt >& /*thresholds*/) {
+    // equivalent to join, domain is flat
+    this->join_with(other);
+  }
+
   Constant meet(const Constant& other) const override {
     assert_compatible(*this, other);
     if (this->is_bottom() || other.is_top()) {
@@ -43,10 +43,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 #include <boost/optional.hpp>
 
 #include <ikos/core/domain/abstract_domain.hpp>
+#include <ikos/core/number/fixed_machine_int.hpp>
 #include <ikos/core/number/machine_int.hpp>
+#include <ikos/core/number/overflow.hpp>
 #include <ikos/core/value/numeric/interval.hpp>
 
 namespace ikos {
@@ -270,6 +277,51 @@ public:
     this->operator=(this->widening_threshold(other, threshold));
   }
 
+  /// \brief Perform the widening of two intervals with a set of thresholds
+  ///
+  /// An unstable bound is set to the closest threshold that includes it, or
+  /// to the minimum or maximum if there is none. Thresholds are cast to the
+  /// type of the interval.
+  Interval widening_threshold(const Interval& other,
+                              const std::vector< MachineInt >& thresholds)
+      const {
+    assert_compatible(*this, other);
+    if (this->is_bottom()) {
+      return other;
+    } else if (other.is_bottom()) {
+      return *this;
+    } else {
+      MachineInt lb = this->_lb;
+      if (other._lb < this->_lb) {
+        lb = MachineInt::min(this->bit_width(), this->sign());
+        for (const MachineInt& threshold : thresholds) {
+          MachineInt tmp = threshold.cast(this->bit_width(), this->sign());
+          if (tmp <= other._lb && tmp > lb) {
+            lb = tmp;
+          }
+        }
+      }
+
+      MachineInt ub = this->_ub;
+      if (other._ub > this->_ub) {
+        ub = MachineInt::max(this->bit_width(), this->sign());
+        for (const MachineInt& threshold : thresholds) {
+          MachineInt tmp = threshold.cast(this->bit_width(), this->sign());
+          if (tmp >= other._ub && tmp < ub) {
+            ub = tmp;
+          }
+        }
+      }
+
+      return Interval(lb, ub);
+    }
+  }
+
+  void widen_threshold_with(const Interval& other,
+                            const std::vector< MachineInt >& thresholds) {
+    this->operator=(this->widening_threshold(other, thresholds));
+  }
+
   Interval meet(const Interval& other) const override {
     assert_compatible(*this, other);
     if (this->is_bottom()) {
@@ -512,6 +564,256 @@ public:
 
 }; // end class Interval
 
+namespace interval_impl {
+
+/// \brief Integer interval with 64-bit bounds
+///
+/// The binary operators use kernels on 64-bit bounds when both operands fit,
+/// instead of going through ZInterval. A kernel returns false if an
+/// intermediate result overflows, in which case the operator falls back on
+/// the generic implementation.
+///
+/// Invariant: is bottom <=> lb > ub
+struct SmallInterval {
+  int64_t lb;
+  int64_t ub;
+
+  /// \brief Return true if the interval is bottom
+  bool is_bottom() const { return this->lb > this->ub; }
+
+  /// \brief Return true if the interval contains 0
+  bool contains_zero() const { return this->lb <= 0 && 0 <= this->ub; }
+};
+
+/// \brief Convert a non-bottom interval into a SmallInterval
+///
+/// Return false if the bit-width is greater than 64, or if a bound does not
+/// fit in an int64_t (i.e, 64-bit unsigned integers greater than 2**63-1).
+inline bool to_small(const Interval& i, SmallInterval& r) {
+  if (i.bit_width() > 64 || !i.lb().fits< int64_t >() ||
+      !i.ub().fits< int64_t >()) {
+    return false;
+  }
+  r.lb = i.lb().to< int64_t >();
+  r.ub = i.ub().to< int64_t >();
+  return true;
+}
+
+/// \brief Convert a SmallInterval into a machine integer interval, with
+/// wrapping
+///
+/// Equivalent to Interval::from_z_interval(i, bit_width, sign, WrapTag{})
+inline Interval from_small(const SmallInterval& i,
+                           unsigned bit_width,
+                           Signedness sign,
+                           Interval::WrapTag) {
+  if (i.is_bottom()) {
+    return Interval::bottom(bit_width, sign);
+  }
+
+  // The width is exact in unsigned arithmetic since lb <= ub
+  uint64_t width =
+      static_cast< uint64_t >(i.ub) - static_cast< uint64_t >(i.lb);
+  if (bit_width < 64 && (width >> bit_width) != 0) {
+    return Interval::top(bit_width, sign);
+  }
+
+  // Both bounds are equal modulo 2**bit_width to the original bounds, and
+  // width < 2**bit_width, so the wrapped interval is exact iff lb <= ub
+  MachineInt lb(i.lb, bit_width, sign);
+  MachineInt ub(i.ub, bit_width, sign);
+  if (lb <= ub) {
+    return Interval(std::move(lb), std::move(ub));
+  } else {
+    return Interval::top(bit_width, sign);
+  }
+}
+
+/// \brief Convert a SmallInterval into a machine integer interval, with
+/// truncation
+///
+/// Equivalent to Interval::from_z_interval(i, bit_width, sign, TruncTag{})
+inline Interval from_small(const SmallInterval& i,
+                           unsigned bit_width,
+                           Signedness sign,
+                           Interval::TruncTag) {
+  int64_t min = 0;
+  int64_t max = std::numeric_limits< int64_t >::max();
+  if (sign == Signed) {
+    if (bit_width < 64) {
+      min = -(int64_t(1) << (bit_width - 1));
+      max = (int64_t(1) << (bit_width - 1)) - 1;
+    } else {
+      min = std::numeric_limits< int64_t >::min();
+    }
+  } else if (bit_width < 63) {
+    max = (int64_t(1) << bit_width) - 1;
+  }
+
+  int64_t lb = std::max(i.lb, min);
+  int64_t ub = std::min(i.ub, max);
+  if (lb > ub) {
+    return Interval::bottom(bit_width, sign);
+  } else {
+    return Interval(MachineInt(lb, bit_width, sign),
+                    MachineInt(ub, bit_width, sign));
+  }
+}
+
+/// \brief Convert a SmallInterval into a machine integer interval of a fixed
+/// bit-width and signedness, with wrapping
+template < typename IntT >
+inline Interval from_small(const SmallInterval& i, Interval::WrapTag) {
+  if (i.is_bottom()) {
+    return Interval::bottom(IntT::bit_width(), IntT::sign());
+  }
+
+  uint64_t width =
+      static_cast< uint64_t >(i.ub) - static_cast< uint64_t >(i.lb);
+  if (width > (IntT::max() - IntT::min()).bits()) {
+    return Interval::top(IntT::bit_width(), IntT::sign());
+  }
+
+  IntT lb(i.lb);
+  IntT ub(i.ub);
+  if (lb <= ub) {
+    return Interval(lb.to_machine_int(), ub.to_machine_int());
+  } else {
+    return Interval::top(IntT::bit_width(), IntT::sign());
+  }
+}
+
+/// \brief Convert a SmallInterval into a machine integer interval of a fixed
+/// bit-width and signedness, with truncation
+template < typename IntT >
+inline Interval from_small(const SmallInterval& i, Interval::TruncTag) {
+  // Bounds of IntT, clamped to int64_t
+  constexpr auto min = static_cast< int64_t >(IntT::min().value());
+  constexpr auto max =
+      IntT::max().bits() > uint64_t(std::numeric_limits< int64_t >::max())
+          ? std::numeric_limits< int64_t >::max()
+          : static_cast< int64_t >(IntT::max().value());
+
+  if (i.lb > max || i.ub < min || i.is_bottom()) {
+    return Interval::bottom(IntT::bit_width(), IntT::sign());
+  } else {
+    return Interval(IntT(i.lb < min ? min : i.lb).to_machine_int(),
+                    IntT(i.ub > max ? max : i.ub).to_machine_int());
+  }
+}
+
+/// \brief Addition kernel
+inline bool add(const SmallInterval& a,
+                const SmallInterval& b,
+                SmallInterval& r) {
+  return !detail::add_overflow(a.lb, b.lb, &r.lb) &&
+         !detail::add_overflow(a.ub, b.ub, &r.ub);
+}
+
+/// \brief Subtraction kernel
+inline bool sub(const SmallInterval& a,
+                const SmallInterval& b,
+                SmallInterval& r) {
+  return !detail::sub_overflow(a.lb, b.ub, &r.lb) &&
+         !detail::sub_overflow(a.ub, b.lb, &r.ub);
+}
+
+/// \brief Multiplication kernel
+inline bool mul(const SmallInterval& a,
+                const SmallInterval& b,
+                SmallInterval& r) {
+  int64_t ll, lu, ul, uu;
+  if (detail::mul_overflow(a.lb, b.lb, &ll) ||
+      detail::mul_overflow(a.lb, b.ub, &lu) ||
+      detail::mul_overflow(a.ub, b.lb, &ul) ||
+      detail::mul_overflow(a.ub, b.ub, &uu)) {
+    return false;
+  }
+  r.lb = std::min({ll, lu, ul, uu});
+  r.ub = std::max({ll, lu, ul, uu});
+  return true;
+}
+
+/// \brief Return the union of two intervals
+inline SmallInterval join(const SmallInterval& a, const SmallInterval& b) {
+  if (a.is_bottom()) {
+    return b;
+  } else if (b.is_bottom()) {
+    return a;
+  } else {
+    return SmallInterval{std::min(a.lb, b.lb), std::max(a.ub, b.ub)};
+  }
+}
+
+/// \brief Division kernel, rounding towards zero
+///
+/// Same semantic as the division of ZInterval.
+inline bool div(const SmallInterval& a,
+                const SmallInterval& b,
+                SmallInterval& r) {
+  if (a.is_bottom() || b.is_bottom()) {
+    r = SmallInterval{0, -1};
+    return true;
+  } else if (b.contains_zero()) {
+    SmallInterval l, u;
+    if (!div(a, SmallInterval{b.lb, -1}, l) ||
+        !div(a, SmallInterval{1, b.ub}, u)) {
+      return false;
+    }
+    r = join(l, u);
+    return true;
+  } else if (a.contains_zero()) {
+    SmallInterval l, u;
+    if (!div(SmallInterval{a.lb, -1}, b, l) ||
+        !div(SmallInterval{1, a.ub}, b, u)) {
+      return false;
+    }
+    r = join(join(l, u), SmallInterval{0, 0});
+    return true;
+  } else {
+    // The only overflow is min / -1
+    if ((a.lb == std::numeric_limits< int64_t >::min() ||
+         a.ub == std::numeric_limits< int64_t >::min()) &&
+        (b.lb == -1 || b.ub == -1)) {
+      return false;
+    }
+    int64_t ll = a.lb / b.lb;
+    int64_t lu = a.lb / b.ub;
+    int64_t ul = a.ub / b.lb;
+    int64_t uu = a.ub / b.ub;
+    r.lb = std::min({ll, lu, ul, uu});
+    r.ub = std::max({ll, lu, ul, uu});
+    return true;
+  }
+}
+
+/// \brief Apply a kernel on the bounds of two non-bottom intervals
+///
+/// Return boost::none if the kernel cannot be used.
+template < typename Kernel, typename Tag >
+inline boost::optional< Interval > apply(Kernel kernel,
+                                         const Interval& lhs,
+                                         const Interval& rhs,
+                                         Tag tag) {
+  SmallInterval a, b, r;
+  if (to_small(lhs, a) && to_small(rhs, b) && kernel(a, b, r)) {
+    return dispatch_fixed_machine_int(
+        lhs.bit_width(),
+        lhs.sign(),
+        [&r, tag](auto int_tag) {
+          using IntT = typename decltype(int_tag)::Type;
+          return from_small< IntT >(r, tag);
+        },
+        [&r, &lhs, tag] {
+          return from_small(r, lhs.bit_width(), lhs.sign(), tag);
+        });
+  } else {
+    return boost::none;
+  }
+}
+
+} // end namespace interval_impl
+
 /// \name Binary Operators
 /// @{
 
@@ -523,6 +825,12 @@ inline Interval add(const Interval& lhs, const Interval& rhs) {
   } else if (rhs.is_bottom()) {
     return rhs;
   } else {
+    if (auto r = interval_impl::apply(interval_impl::add,
+                                      lhs,
+                                      rhs,
+                                      Interval::WrapTag{})) {
+      return std::move(*r);
+    }
     return Interval::from_z_interval(lhs.to_z_interval() + rhs.to_z_interval(),
                                      lhs.bit_width(),
                                      lhs.sign(),
@@ -538,6 +846,12 @@ inline Interval add_no_wrap(const Interval& lhs, const Interval& rhs) {
   } else if (rhs.is_bottom()) {
     return rhs;
   } else {
+    if (auto r = interval_impl::apply(interval_impl::add,
+                                      lhs,
+                                      rhs,
+                                      Interval::TruncTag{})) {
+      return std::move(*r);
+    }
     return Interval::from_z_interval(lhs.to_z_interval() + rhs.to_z_interval(),
                                      lhs.bit_width(),
                                      lhs.sign(),
@@ -553,6 +867,12 @@ inline Interval sub(const Interval& lhs, const Interval& rhs) {
   } else if (rhs.is_bottom()) {
     return rhs;
   } else {
+    if (auto r = interval_impl::apply(interval_impl::sub,
+                                      lhs,
+                                      rhs,
+                                      Interval::WrapTag{})) {
+      return std::move(*r);
+    }
     return Interval::from_z_interval(lhs.to_z_interval() - rhs.to_z_interval(),
                                      lhs.bit_width(),
                                      lhs.sign(),
@@ -568,6 +888,12 @@ inline Interval sub_no_wrap(const Interval& lhs, const Interval& rhs) {
   } else if (rhs.is_bottom()) {
     return rhs;
   } else {
+    if (auto r = interval_impl::apply(interval_impl::sub,
+                                      lhs,
+                                      rhs,
+                                      Interval::TruncTag{})) {
+      return std::move(*r);
+    }
     return Interval::from_z_interval(lhs.to_z_interval() - rhs.to_z_interval(),
                                      lhs.bit_width(),
                                      lhs.sign(),
@@ -583,6 +909,12 @@ inline Interval mul(const Interval& lhs, const Interval& rhs) {
   } else if (rhs.is_bottom()) {
     return rhs;
   } else {
+    if (auto r = interval_impl::apply(interval_impl::mul,
+                                      lhs,
+                                      rhs,
+                                      Interval::WrapTag{})) {
+      return std::move(*r);
+    }
     return Interval::from_z_interval(lhs.to_z_interval() * rhs.to_z_interval(),
                                      lhs.bit_width(),
                                      lhs.sign(),
@@ -598,6 +930,12 @@ inline Interval mul_no_wrap(const Interval& lhs, const Interval& rhs) {
   } else if (rhs.is_bottom()) {
     return rhs;
   } else {
+    if (auto r = interval_impl::apply(interval_impl::mul,
+                                      lhs,
+                                      rhs,
+                                      Interval::TruncTag{})) {
+      return std::move(*r);
+    }
     return Interval::from_z_interval(lhs.to_z_interval() * rhs.to_z_interval(),
                                      lhs.bit_width(),
                                      lhs.sign(),
@@ -614,6 +952,12 @@ inline Interval div(const Interval& lhs, const Interval& rhs) {
     return rhs;
   } else {
     // overflow is undefined behavior
+    if (auto r = interval_impl::apply(interval_impl::div,
+                                      lhs,
+                                      rhs,
+                                      Interval::TruncTag{})) {
+      return std::move(*r);
+    }
     return Interval::from_z_interval(lhs.to_z_interval() / rhs.to_z_interval(),
                                      lhs.bit_width(),
                                      lhs.sign(),
@@ -704,6 +1048,17 @@ inline Interval shl(const Interval& lhs, const Interval& rhs) {
     }
 
     // [a, b] << [c, d] = [a, b] * [1 << c, 1 << d]
+    interval_impl::SmallInterval a, c, r;
+    if (interval_impl::to_small(lhs, a) && shift._ub.to< uint64_t >() < 63) {
+      c.lb = int64_t(1) << shift._lb.to< uint64_t >();
+      c.ub = int64_t(1) << shift._ub.to< uint64_t >();
+      if (interval_impl::mul(a, c, r)) {
+        return interval_impl::from_small(r,
+                                         lhs.bit_width(),
+                                         lhs.sign(),
+                                         Interval::WrapTag{});
+      }
+    }
     numeric::ZInterval coeff(ZBound(1 << shift._lb.to_z_number()),
                              ZBound(1 << shift._ub.to_z_number()));
     return Interval::from_z_interval(lhs.to_z_interval() * coeff,
@@ -736,6 +1091,17 @@ inline Interval shl_no_wrap(const Interval& lhs, const Interval& rhs) {
     }
 
     // [a, b] << [c, d] = [a, b] * [1 << c, 1 << d]
+    interval_impl::SmallInterval a, c, r;
+    if (interval_impl::to_small(lhs, a) && shift._ub.to< uint64_t >() < 63) {
+      c.lb = int64_t(1) << shift._lb.to< uint64_t >();
+      c.ub = int64_t(1) << shift._ub.to< uint64_t >();
+      if (interval_impl::mul(a, c, r)) {
+        return interval_impl::from_small(r,
+                                         lhs.bit_width(),
+                                         lhs.sign(),
+                                         Interval::TruncTag{});
+      }
+    }
     numeric::ZInterval coeff(ZBound(1 << shift._lb.to_z_number()),
                              ZBound(1 << shift._ub.to_z_number()));
     return Interval::from_z_interval(lhs.to_z_interval() * coeff,
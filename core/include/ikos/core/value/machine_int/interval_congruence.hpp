@@ -118,7 +118,7 @@ private:
       // congruence is a singleton, refine the interval
       if (!(lb <= this->_c.residue() && this->_c.residue() <= ub)) {
         this->set_to_bottom();
-      } else {
+      } else if (lb != ub) {
         this->_i = Interval(
             MachineInt(this->_c.residue(), this->bit_width(), this->sign()));
       }
@@ -136,7 +136,7 @@ private:
     } else if (x == y) {
       this->_i = Interval(MachineInt(x, this->bit_width(), this->sign()));
       this->_c = ZCongruence(x);
-    } else {
+    } else if (x != lb || y != ub) {
       this->_i = Interval(MachineInt(x, this->bit_width(), this->sign()),
                           MachineInt(y, this->bit_width(), this->sign()));
     }
@@ -354,6 +354,22 @@ public:
     this->normalize();
   }
 
+  IntervalCongruence widening_threshold(
+      const IntervalCongruence& other,
+      const std::vector< MachineInt >& thresholds) const {
+    assert_compatible(*this, other);
+    return IntervalCongruence(this->_i.widening_threshold(other._i, thresholds),
+                              this->_c.widening(other._c));
+  }
+
+  void widen_threshold_with(const IntervalCongruence& other,
+                            const std::vector< MachineInt >& thresholds) {
+    assert_compatible(*this, other);
+    this->_i.widen_threshold_with(other._i, thresholds);
+    this->_c.widen_with(other._c);
+    this->normalize();
+  }
+
   IntervalCongruence meet(const IntervalCongruence& other) const override {
     assert_compatible(*this, other);
     return IntervalCongruence(this->_i.meet(other._i), this->_c.meet(other._c));
@@ -0,0 +1,879 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Machine integer known bits abstract value
+ *
+ * Based on the KnownBits analysis of LLVM (llvm/Support/KnownBits.h)
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+
+#include <boost/optional.hpp>
+
+#include <ikos/core/domain/abstract_domain.hpp>
+#include <ikos/core/number/machine_int.hpp>
+#include <ikos/core/number/z_number.hpp>
+#include <ikos/core/value/machine_int/congruence.hpp>
+#include <ikos/core/value/machine_int/interval.hpp>
+
+namespace ikos {
+namespace core {
+namespace machine_int {
+
+/// \brief Machine integer known bits abstract value
+///
+/// Each bit of the machine integer is either known to be 0, known to be 1, or
+/// unknown. This is represented with two masks: `zeros` contains the bits known
+/// to be 0 and `ones` contains the bits known to be 1.
+///
+/// Top is represented with both masks equal to 0. Bottom is represented with
+/// both masks equal to -1 (i.e, all bits are known to be 0 and 1).
+class KnownBits final : public core::AbstractDomain< KnownBits > {
+private:
+  MachineInt _zeros;
+  MachineInt _ones;
+
+  /* Invariants:
+   * _zeros.bit_width() == _ones.bit_width()
+   * _zeros.sign() == _ones.sign()
+   * (_zeros & _ones) != 0 => _zeros.all_ones() && _ones.all_ones()
+   */
+
+private:
+  /// \brief Normalize the known bits
+  void normalize() {
+    if (!and_(this->_zeros, this->_ones).is_zero()) {
+      // Conflicting bits
+      this->set_to_bottom();
+    }
+  }
+
+private:
+  struct TopTag {};
+  struct BottomTag {};
+
+  /// \brief Create the top known bits (for bit-width 1)
+  explicit KnownBits(TopTag)
+      : _zeros(MachineInt::zero(1, Signed)),
+        _ones(MachineInt::zero(1, Signed)) {}
+
+  /// \brief Create the bottom known bits (for bit-width 1)
+  explicit KnownBits(BottomTag)
+      : _zeros(MachineInt::all_ones(1, Signed)),
+        _ones(MachineInt::all_ones(1, Signed)) {}
+
+  /// \brief Create the top known bits for the given bit-width and signedness
+  KnownBits(TopTag, unsigned bit_width, Signedness sign)
+      : _zeros(MachineInt::zero(bit_width, sign)),
+        _ones(MachineInt::zero(bit_width, sign)) {}
+
+  /// \brief Create the bottom known bits for the given bit-width and signedness
+  KnownBits(BottomTag, unsigned bit_width, Signedness sign)
+      : _zeros(MachineInt::all_ones(bit_width, sign)),
+        _ones(MachineInt::all_ones(bit_width, sign)) {}
+
+public:
+  /// \brief Create the top known bits
+  KnownBits() : KnownBits(TopTag{}) {}
+
+  /// \brief Create the known bits of the machine integer n
+  explicit KnownBits(const MachineInt& n) : _zeros(~n), _ones(n) {}
+
+  /// \brief Create the known bits from the masks of bits known to be 0 and 1
+  KnownBits(MachineInt zeros, MachineInt ones)
+      : _zeros(std::move(zeros)), _ones(std::move(ones)) {
+    assert_compatible(this->_zeros, this->_ones);
+    this->normalize();
+  }
+
+  /// \brief Copy constructor
+  KnownBits(const KnownBits&) = default;
+
+  /// \brief Move constructor
+  KnownBits(KnownBits&&) = default;
+
+  /// \brief Copy assignment operator
+  KnownBits& operator=(const KnownBits&) = default;
+
+  /// \brief Move assignment operator
+  KnownBits& operator=(KnownBits&&) = default;
+
+  /// \brief Destructor
+  ~KnownBits() override = default;
+
+  /// \brief Return a mask with the `n` lowest bits set
+  static MachineInt low_bits(unsigned n, unsigned bit_width, Signedness sign) {
+    if (n == 0) {
+      return MachineInt::zero(bit_width, sign);
+    } else if (n >= bit_width) {
+      return MachineInt::all_ones(bit_width, sign);
+    } else {
+      return lshr(MachineInt::all_ones(bit_width, sign),
+                  MachineInt(bit_width - n, bit_width, sign));
+    }
+  }
+
+  /// \brief Return a mask with the `n` highest bits set
+  static MachineInt high_bits(unsigned n, unsigned bit_width, Signedness sign) {
+    if (n >= bit_width) {
+      return MachineInt::all_ones(bit_width, sign);
+    } else {
+      return ~low_bits(bit_width - n, bit_width, sign);
+    }
+  }
+
+  /// \brief Return the number of trailing '1' bits of the given mask
+  static unsigned trailing_ones(const MachineInt& m) {
+    if (m.all_ones()) {
+      return m.bit_width();
+    } else if (m.is_signed()) {
+      return static_cast< unsigned >(
+          m.sign_cast(Unsigned).to_z_number().trailing_ones());
+    } else {
+      return static_cast< unsigned >(m.to_z_number().trailing_ones());
+    }
+  }
+
+  /// \brief Create the top known bits
+  static KnownBits top() { return KnownBits(TopTag{}); }
+
+  /// \brief Create the bottom known bits
+  static KnownBits bottom() { return KnownBits(BottomTag{}); }
+
+  /// \brief Create the top known bits for the given bit-width and signedness
+  static KnownBits top(unsigned bit_width, Signedness sign) {
+    return KnownBits(TopTag{}, bit_width, sign);
+  }
+
+  /// \brief Create the bottom known bits for the given bit-width and signedness
+  static KnownBits bottom(unsigned bit_width, Signedness sign) {
+    return KnownBits(BottomTag{}, bit_width, sign);
+  }
+
+  /// \brief Return the bit width of the known bits
+  unsigned bit_width() const { return this->_zeros.bit_width(); }
+
+  /// \brief Return the signedness (Signed or Unsigned) of the known bits
+  Signedness sign() const { return this->_zeros.sign(); }
+
+  bool is_signed() const { return this->sign() == Signed; }
+  bool is_unsigned() const { return this->sign() == Unsigned; }
+
+  /// \brief Return the mask of bits known to be 0
+  const MachineInt& zeros() const {
+    ikos_assert(!this->is_bottom());
+    return this->_zeros;
+  }
+
+  /// \brief Return the mask of bits known to be 1
+  const MachineInt& ones() const {
+    ikos_assert(!this->is_bottom());
+    return this->_ones;
+  }
+
+  bool is_bottom() const override {
+    return this->_zeros.all_ones() && this->_ones.all_ones();
+  }
+
+  bool is_top() const override {
+    return this->_zeros.is_zero() && this->_ones.is_zero();
+  }
+
+  void set_to_bottom() override {
+    this->_zeros = MachineInt::all_ones(this->bit_width(), this->sign());
+    this->_ones = MachineInt::all_ones(this->bit_width(), this->sign());
+  }
+
+  void set_to_top() override {
+    this->_zeros.set_zero();
+    this->_ones.set_zero();
+  }
+
+  bool leq(const KnownBits& other) const override {
+    assert_compatible(*this, other);
+    if (this->is_bottom()) {
+      return true;
+    } else if (other.is_bottom()) {
+      return false;
+    } else {
+      return or_(this->_zeros, other._zeros) == this->_zeros &&
+             or_(this->_ones, other._ones) == this->_ones;
+    }
+  }
+
+  bool equals(const KnownBits& other) const override {
+    assert_compatible(*this, other);
+    return this->_zeros == other._zeros && this->_ones == other._ones;
+  }
+
+  KnownBits join(const KnownBits& other) const override {
+    assert_compatible(*this, other);
+    if (this->is_bottom()) {
+      return other;
+    } else if (other.is_bottom()) {
+      return *this;
+    } else {
+      return KnownBits(and_(this->_zeros, other._zeros),
+                       and_(this->_ones, other._ones));
+    }
+  }
+
+  void join_with(const KnownBits& other) override {
+    this->operator=(this->join(other));
+  }
+
+  KnownBits widening(const KnownBits& other) const override {
+    // equivalent to join, domain has a finite height
+    return this->join(other);
+  }
+
+  void widen_with(const KnownBits& other) override {
+    // equivalent to join, domain has a finite height
+    this->join_with(other);
+  }
+
+  KnownBits widening_threshold(const KnownBits& other,
+                               const MachineInt& /*threshold*/) const {
+    // equivalent to join, domain has a finite height
+    return this->join(other);
+  }
+
+  void widen_threshold_with(const KnownBits& other,
+                            const MachineInt& /*threshold*/) {
+    // equivalent to join, domain has a finite height
+    this->join_with(other);
+  }
+
+  KnownBits widening_threshold(
+      const KnownBits& other,
+      const std::vector< MachineInt >& /*thresholds*/) const {
+    // equivalent to join, domain has a finite height
+    return this->join(other);
+  }
+
+  void widen_threshold_with(const KnownBits& other,
+                            const std::vector< MachineInt >& /*thresholds*/) {
+    // equivalent to join, domain has a finite height
+    this->join_with(other);
+  }
+
+  KnownBits meet(const KnownBits& other) const override {
+    assert_compatible(*this, other);
+    if (this->is_bottom()) {
+      return *this;
+    } else if (other.is_bottom()) {
+      return other;
+    } else {
+      return KnownBits(or_(this->_zeros, other._zeros),
+                       or_(this->_ones, other._ones));
+    }
+  }
+
+  void meet_with(const KnownBits& other) override {
+    this->operator=(this->meet(other));
+  }
+
+  KnownBits narrowing(const KnownBits& other) const override {
+    // equivalent to meet, domain has a finite height
+    return this->meet(other);
+  }
+
+  void narrow_with(const KnownBits& other) override {
+    // equivalent to meet, domain has a finite height
+    this->meet_with(other);
+  }
+
+  /// \name Unary Operators
+  /// @{
+
+  /// \brief Truncate the machine integer known bits to the given bit width
+  KnownBits trunc(unsigned bit_width) const {
+    ikos_assert(this->bit_width() > bit_width);
+    if (this->is_bottom()) {
+      return bottom(bit_width, this->sign());
+    }
+    return KnownBits(this->_zeros.trunc(bit_width),
+                     this->_ones.trunc(bit_width));
+  }
+
+  /// \brief Extend the machine integer known bits to the given bit width
+  KnownBits ext(unsigned bit_width) const {
+    ikos_assert(this->bit_width() < bit_width);
+    if (this->is_bottom()) {
+      return bottom(bit_width, this->sign());
+    } else if (this->is_signed()) {
+      // The sign extension of the masks propagates the known sign bit
+      return KnownBits(this->_zeros.ext(bit_width), this->_ones.ext(bit_width));
+    } else {
+      // The new bits are known to be 0
+      return KnownBits(or_(this->_zeros.ext(bit_width),
+                           high_bits(bit_width - this->bit_width(),
+                                     bit_width,
+                                     this->sign())),
+                       this->_ones.ext(bit_width));
+    }
+  }
+
+  /// \brief Change the machine integer known bits sign (bitcast)
+  KnownBits sign_cast(Signedness sign) const {
+    ikos_assert(this->sign() != sign);
+    if (this->is_bottom()) {
+      return bottom(this->bit_width(), sign);
+    }
+    return KnownBits(this->_zeros.sign_cast(sign), this->_ones.sign_cast(sign));
+  }
+
+  /// \brief Cast the machine integer known bits to the given bit width and sign
+  ///
+  /// This is equivalent to trunc()/ext() + sign_cast() (in this specific order)
+  KnownBits cast(unsigned bit_width, Signedness sign) const {
+    KnownBits r = *this;
+    if (r.bit_width() > bit_width) {
+      r = r.trunc(bit_width);
+    } else if (r.bit_width() < bit_width) {
+      r = r.ext(bit_width);
+    }
+    if (r.sign() != sign) {
+      r = r.sign_cast(sign);
+    }
+    return r;
+  }
+
+  /// \brief Bitwise not operator
+  KnownBits not_() const {
+    if (this->is_bottom()) {
+      return *this;
+    }
+    return KnownBits(this->_ones, this->_zeros);
+  }
+
+  /// @}
+  /// \name Conversion Functions
+  /// @{
+
+  /// \brief Return the smallest machine integer with the known bits
+  MachineInt min() const {
+    ikos_assert(!this->is_bottom());
+    if (this->is_signed() && !this->sign_bit_known()) {
+      // The smallest value is negative
+      return or_(this->_ones, MachineInt::min(this->bit_width(), Signed));
+    } else {
+      return this->_ones;
+    }
+  }
+
+  /// \brief Return the greatest machine integer with the known bits
+  MachineInt max() const {
+    ikos_assert(!this->is_bottom());
+    if (this->is_signed() && !this->sign_bit_known()) {
+      // The greatest value is positive
+      return and_(~this->_zeros, MachineInt::max(this->bit_width(), Signed));
+    } else {
+      return ~this->_zeros;
+    }
+  }
+
+  /// \brief Return the interval of machine integers with the known bits
+  Interval to_interval() const {
+    if (this->is_bottom()) {
+      return Interval::bottom(this->bit_width(), this->sign());
+    }
+    return Interval(this->min(), this->max());
+  }
+
+  /// \brief Return the congruence of machine integers with the known bits
+  ///
+  /// If the `n` lowest bits are known, the result is 2^n Z + b, where b is the
+  /// value of these `n` bits.
+  Congruence to_congruence() const {
+    if (this->is_bottom()) {
+      return Congruence::bottom(this->bit_width(), this->sign());
+    }
+    boost::optional< MachineInt > n = this->singleton();
+    if (n) {
+      return Congruence(*n);
+    }
+    unsigned known = trailing_ones(or_(this->_zeros, this->_ones));
+    if (known == 0) {
+      return Congruence::top(this->bit_width(), this->sign());
+    }
+    MachineInt b =
+        and_(this->_ones, low_bits(known, this->bit_width(), this->sign()));
+    return Congruence(ZNumber(1) << known,
+                      b.to_z_number(),
+                      this->bit_width(),
+                      this->sign());
+  }
+
+  /// \brief Return the known bits of the machine integers in the given interval
+  ///
+  /// The highest bits shared by the lower bound and the upper bound are known.
+  static KnownBits from_interval(const Interval& i) {
+    if (i.is_bottom()) {
+      return bottom(i.bit_width(), i.sign());
+    } else if (i.sign() == Signed && i.lb().is_negative() &&
+               !i.ub().is_negative()) {
+      // The bit patterns of the interval are not contiguous
+      return top(i.bit_width(), i.sign());
+    }
+    unsigned n = xor_(i.lb(), i.ub()).leading_zeros();
+    MachineInt mask = high_bits(n, i.bit_width(), i.sign());
+    return KnownBits(and_(~i.lb(), mask), and_(i.lb(), mask));
+  }
+
+  /// \brief Return the known bits of the machine integers in the given
+  /// congruence
+  ///
+  /// If the modulus of the congruence is 2^n * m, the `n` lowest bits are
+  /// known.
+  static KnownBits from_congruence(const Congruence& c) {
+    if (c.is_bottom()) {
+      return bottom(c.bit_width(), c.sign());
+    }
+    boost::optional< MachineInt > n = c.singleton();
+    if (n) {
+      return KnownBits(*n);
+    }
+    unsigned known = static_cast< unsigned >(
+        std::min(c.modulus().trailing_zeros(),
+                 static_cast< uint64_t >(c.bit_width())));
+    MachineInt mask = low_bits(known, c.bit_width(), c.sign());
+    MachineInt b(c.residue(), c.bit_width(), c.sign());
+    return KnownBits(and_(~b, mask), and_(b, mask));
+  }
+
+  /// @}
+
+  /// \brief If all the bits are known, return the machine integer, otherwise
+  /// return boost::none
+  boost::optional< MachineInt > singleton() const {
+    if (!this->is_bottom() && or_(this->_zeros, this->_ones).all_ones()) {
+      return this->_ones;
+    } else {
+      return boost::none;
+    }
+  }
+
+  /// \brief Return true if the machine integer n has the known bits
+  bool contains(const MachineInt& n) const {
+    assert_compatible(*this, n);
+    return !this->is_bottom() && and_(n, this->_zeros).is_zero() &&
+           and_(~n, this->_ones).is_zero();
+  }
+
+  /// \brief Return true if the sign bit is known
+  bool sign_bit_known() const {
+    return or_(this->_zeros, this->_ones).high_bit();
+  }
+
+  /// \brief Return the number of trailing bits known to be 0
+  unsigned trailing_zeros() const { return trailing_ones(this->_zeros); }
+
+  /// \brief Return the number of leading bits known to be 0
+  unsigned leading_zeros() const { return this->_zeros.leading_ones(); }
+
+  void dump(std::ostream& o) const override {
+    if (this->is_bottom()) {
+      o << "⊥";
+    } else if (this->is_top()) {
+      o << "T";
+    } else {
+      MachineInt one(1, this->bit_width(), Unsigned);
+      MachineInt zeros = this->_zeros.cast(this->bit_width(), Unsigned);
+      MachineInt ones = this->_ones.cast(this->bit_width(), Unsigned);
+      for (unsigned i = this->bit_width(); i > 0; i--) {
+        MachineInt bit =
+            shl(one, MachineInt(i - 1, this->bit_width(), Unsigned));
+        if (!and_(zeros, bit).is_zero()) {
+          o << '0';
+        } else if (!and_(ones, bit).is_zero()) {
+          o << '1';
+        } else {
+          o << '?';
+        }
+      }
+    }
+  }
+
+  static std::string name() { return "known bits"; }
+
+}; // end class KnownBits
+
+/// \name Binary Operators
+/// @{
+
+/// \brief Return `lhs + rhs + carry`, with wrapping
+///
+/// See computeForAddCarry() in LLVM
+inline KnownBits add_with_carry(const KnownBits& lhs,
+                                const KnownBits& rhs,
+                                bool carry) {
+  unsigned bit_width = lhs.bit_width();
+  Signedness sign = lhs.sign();
+  MachineInt c(carry ? 1 : 0, bit_width, sign);
+
+  // Greatest and smallest possible sums
+  MachineInt sum_zeros = add(add(~lhs.zeros(), ~rhs.zeros()), c);
+  MachineInt sum_ones = add(add(lhs.ones(), rhs.ones()), c);
+
+  // Known carry bits
+  MachineInt carry_zeros = ~xor_(xor_(sum_zeros, lhs.zeros()), rhs.zeros());
+  MachineInt carry_ones = xor_(xor_(sum_ones, lhs.ones()), rhs.ones());
+
+  MachineInt known = and_(and_(or_(lhs.zeros(), lhs.ones()),
+                               or_(rhs.zeros(), rhs.ones())),
+                          or_(carry_zeros, carry_ones));
+  return KnownBits(and_(~sum_zeros, known), and_(sum_ones, known));
+}
+
+/// \brief Addition with wrapping
+inline KnownBits add(const KnownBits& lhs, const KnownBits& rhs) {
+  assert_compatible(lhs, rhs);
+  if (lhs.is_bottom()) {
+    return lhs;
+  } else if (rhs.is_bottom()) {
+    return rhs;
+  } else {
+    return add_with_carry(lhs, rhs, false);
+  }
+}
+
+/// \brief Addition without wrapping
+inline KnownBits add_no_wrap(const KnownBits& lhs, const KnownBits& rhs) {
+  return add(lhs, rhs);
+}
+
+/// \brief Substraction with wrapping
+inline KnownBits sub(const KnownBits& lhs, const KnownBits& rhs) {
+  assert_compatible(lhs, rhs);
+  if (lhs.is_bottom()) {
+    return lhs;
+  } else if (rhs.is_bottom()) {
+    return rhs;
+  } else {
+    // lhs - rhs = lhs + ~rhs + 1
+    return add_with_carry(lhs, rhs.not_(), true);
+  }
+}
+
+/// \brief Substraction without wrapping
+inline KnownBits sub_no_wrap(const KnownBits& lhs, const KnownBits& rhs) {
+  return sub(lhs, rhs);
+}
+
+/// \brief Multiplication with wrapping
+inline KnownBits mul(const KnownBits& lhs, const KnownBits& rhs) {
+  assert_compatible(lhs, rhs);
+  if (lhs.is_bottom()) {
+    return lhs;
+  } else if (rhs.is_bottom()) {
+    return rhs;
+  }
+
+  boost::optional< MachineInt > x = lhs.singleton();
+  boost::optional< MachineInt > y = rhs.singleton();
+  if (x && y) {
+    return KnownBits(mul(*x, *y));
+  }
+
+  unsigned bit_width = lhs.bit_width();
+  Signedness sign = lhs.sign();
+
+  // The trailing zeros add up
+  unsigned zeros =
+      std::min(lhs.trailing_zeros() + rhs.trailing_zeros(), bit_width);
+
+  // The lowest bits of the result only depend on the lowest bits of the
+  // operands
+  unsigned known =
+      std::min(KnownBits::trailing_ones(or_(lhs.zeros(), lhs.ones())),
+               KnownBits::trailing_ones(or_(rhs.zeros(), rhs.ones())));
+  MachineInt mask = KnownBits::low_bits(known, bit_width, sign);
+  MachineInt low = and_(mul(lhs.ones(), rhs.ones()), mask);
+
+  return KnownBits(or_(and_(~low, mask),
+                       KnownBits::low_bits(zeros, bit_width, sign)),
+                   low);
+}
+
+/// \brief Multiplication without wrapping
+inline KnownBits mul_no_wrap(const KnownBits& lhs, const KnownBits& rhs) {
+  return mul(lhs, rhs);
+}
+
+/// \brief Division
+inline KnownBits div(const KnownBits& lhs, const KnownBits& rhs) {
+  assert_compatible(lhs, rhs);
+  if (lhs.is_bottom()) {
+    return lhs;
+  } else if (rhs.is_bottom()) {
+    return rhs;
+  }
+
+  boost::optional< MachineInt > y = rhs.singleton();
+  if (y && y->is_zero()) {
+    // Division by zero
+    return KnownBits::bottom(lhs.bit_width(), lhs.sign());
+  }
+
+  boost::optional< MachineInt > x = lhs.singleton();
+  if (x && y) {
+    if (x->is_signed() && x->is_min() && y->all_ones()) {
+      // Overflow
+      return KnownBits::top(lhs.bit_width(), lhs.sign());
+    }
+    return KnownBits(div(*x, *y));
+  } else if (lhs.is_unsigned()) {
+    // The result is smaller than lhs
+    return KnownBits(KnownBits::high_bits(lhs.leading_zeros(),
+                                          lhs.bit_width(),
+                                          lhs.sign()),
+                     MachineInt::zero(lhs.bit_width(), lhs.sign()));
+  } else {
+    return KnownBits::top(lhs.bit_width(), lhs.sign());
+  }
+}
+
+/// \brief Exact division
+inline KnownBits div_exact(const KnownBits& lhs, const KnownBits& rhs) {
+  return div(lhs, rhs);
+}
+
+/// \brief Remainder
+inline KnownBits rem(const KnownBits& lhs, const KnownBits& rhs) {
+  assert_compatible(lhs, rhs);
+  if (lhs.is_bottom()) {
+    return lhs;
+  } else if (rhs.is_bottom()) {
+    return rhs;
+  }
+
+  unsigned bit_width = lhs.bit_width();
+  Signedness sign = lhs.sign();
+
+  boost::optional< MachineInt > y = rhs.singleton();
+  if (y && y->is_zero()) {
+    // Division by zero
+    return KnownBits::bottom(bit_width, sign);
+  }
+
+  boost::optional< MachineInt > x = lhs.singleton();
+  if (x && y) {
+    if (x->is_signed() && x->is_min() && y->all_ones()) {
+      // Overflow
+      return KnownBits::top(bit_width, sign);
+    }
+    return KnownBits(rem(*x, *y));
+  } else if (lhs.is_unsigned()) {
+    if (y && and_(*y, sub(*y, MachineInt(1, bit_width, sign))).is_zero()) {
+      // Remainder by a power of 2, keep the lowest bits
+      MachineInt mask = sub(*y, MachineInt(1, bit_width, sign));
+      return KnownBits(or_(lhs.zeros(), ~mask), and_(lhs.ones(), mask));
+    }
+
+    // The result is smaller than both lhs and rhs
+    unsigned zeros = std::max(lhs.leading_zeros(), rhs.leading_zeros());
+    return KnownBits(KnownBits::high_bits(zeros, bit_width, sign),
+                     MachineInt::zero(bit_width, sign));
+  } else {
+    return KnownBits::top(bit_width, sign);
+  }
+}
+
+/// \brief Apply a shift operator `f` for all the possible shift amounts
+///
+/// The shift amount has to be between 0 and bit_width - 1
+template < typename ShiftFunction >
+inline KnownBits shift(const KnownBits& lhs,
+                       const KnownBits& rhs,
+                       ShiftFunction f) {
+  assert_compatible(lhs, rhs);
+  if (lhs.is_bottom()) {
+    return lhs;
+  } else if (rhs.is_bottom()) {
+    return rhs;
+  }
+
+  unsigned bit_width = lhs.bit_width();
+  Signedness sign = lhs.sign();
+
+  boost::optional< MachineInt > y = rhs.singleton();
+  if (y) {
+    ZNumber n = y->to_z_number();
+    if (!(0 <= n && n < bit_width)) {
+      // Invalid operand
+      return KnownBits::bottom(bit_width, sign);
+    }
+    return f(lhs, *y, n.to< unsigned >());
+  }
+
+  KnownBits r = KnownBits::bottom(bit_width, sign);
+  for (unsigned i = 0; i < bit_width && !r.is_top(); i++) {
+    MachineInt n(i, bit_width, sign);
+    if (rhs.contains(n)) {
+      r.join_with(f(lhs, n, i));
+    }
+  }
+  return r;
+}
+
+/// \brief Left shift with wrapping
+///
+/// The right hand side has to be between 0 and bit_width - 1
+inline KnownBits shl(const KnownBits& lhs, const KnownBits& rhs) {
+  return shift(lhs,
+               rhs,
+               [](const KnownBits& x, const MachineInt& n, unsigned i) {
+                 // The lowest bits are known to be 0
+                 return KnownBits(or_(shl(x.zeros(), n),
+                                      KnownBits::low_bits(i,
+                                                          x.bit_width(),
+                                                          x.sign())),
+                                  shl(x.ones(), n));
+               });
+}
+
+/// \brief Left shift without wrapping
+///
+/// The right hand side has to be between 0 and bit_width - 1
+inline KnownBits shl_no_wrap(const KnownBits& lhs, const KnownBits& rhs) {
+  return shl(lhs, rhs);
+}
+
+/// \brief Logical shift right
+///
+/// The right hand side has to be between 0 and bit_width - 1
+inline KnownBits lshr(const KnownBits& lhs, const KnownBits& rhs) {
+  return shift(lhs,
+               rhs,
+               [](const KnownBits& x, const MachineInt& n, unsigned i) {
+                 // The highest bits are known to be 0
+                 return KnownBits(or_(lshr(x.zeros(), n),
+                                      KnownBits::high_bits(i,
+                                                           x.bit_width(),
+                                                           x.sign())),
+                                  lshr(x.ones(), n));
+               });
+}
+
+/// \brief Exact logical shift right
+///
+/// The right hand side has to be between 0 and bit_width - 1
+inline KnownBits lshr_exact(const KnownBits& lhs, const KnownBits& rhs) {
+  return lshr(lhs, rhs);
+}
+
+/// \brief Arithmetic shift right
+///
+/// The right hand side has to be between 0 and bit_width - 1
+inline KnownBits ashr(const KnownBits& lhs, const KnownBits& rhs) {
+  return shift(lhs,
+               rhs,
+               [](const KnownBits& x, const MachineInt& n, unsigned /*i*/) {
+                 // The known sign bit is propagated
+                 return KnownBits(ashr(x.zeros(), n), ashr(x.ones(), n));
+               });
+}
+
+/// \brief Exact arithmetic shift right
+///
+/// The right hand side has to be between 0 and bit_width - 1
+inline KnownBits ashr_exact(const KnownBits& lhs, const KnownBits& rhs) {
+  return ashr(lhs, rhs);
+}
+
+/// \brief Bitwise AND
+inline KnownBits and_(const KnownBits& lhs, const KnownBits& rhs) {
+  assert_compatible(lhs, rhs);
+  if (lhs.is_bottom()) {
+    return lhs;
+  } else if (rhs.is_bottom()) {
+    return rhs;
+  } else {
+    return KnownBits(or_(lhs.zeros(), rhs.zeros()),
+                     and_(lhs.ones(), rhs.ones()));
+  }
+}
+
+/// \brief Bitwise OR
+inline KnownBits or_(const KnownBits& lhs, const KnownBits& rhs) {
+  assert_compatible(lhs, rhs);
+  if (lhs.is_bottom()) {
+    return lhs;
+  } else if (rhs.is_bottom()) {
+    return rhs;
+  } else {
+    return KnownBits(and_(lhs.zeros(), rhs.zeros()),
+                     or_(lhs.ones(), rhs.ones()));
+  }
+}
+
+/// \brief Bitwise XOR
+inline KnownBits xor_(const KnownBits& lhs, const KnownBits& rhs) {
+  assert_compatible(lhs, rhs);
+  if (lhs.is_bottom()) {
+    return lhs;
+  } else if (rhs.is_bottom()) {
+    return rhs;
+  } else {
+    MachineInt known = and_(or_(lhs.zeros(), lhs.ones()),
+                            or_(rhs.zeros(), rhs.ones()));
+    MachineInt value = xor_(lhs.ones(), rhs.ones());
+    return KnownBits(and_(~value, known), and_(value, known));
+  }
+}
+
+/// @}
+/// \name Input / Output
+/// @{
+
+/// \brief Write known bits on a stream
+inline std::ostream& operator<<(std::ostream& o, const KnownBits& kb) {
+  kb.dump(o);
+  return o;
+}
+
+/// @}
+
+} // end namespace machine_int
+} // end namespace core
+} // end namespace ikos
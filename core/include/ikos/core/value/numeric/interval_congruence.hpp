@@ -123,7 +123,7 @@ private:
       if (!this->_i.contains(this->_c.residue())) {
         this->_i.set_to_bottom();
         this->_c.set_to_bottom();
-      } else {
+      } else if (!this->_i.singleton()) {
         this->_i = IntervalT(this->_c.residue());
       }
       return;
@@ -142,15 +142,19 @@ private:
       } else if (x == y) {
         this->_i = IntervalT(x);
         this->_c = CongruenceT(x);
-      } else {
+      } else if (x != *lb.number() || y != *ub.number()) {
         this->_i = IntervalT(BoundT(x), BoundT(y));
       }
     } else if (lb.is_finite()) {
       ZNumber x = R(this->_c, *lb.number());
-      this->_i = IntervalT(BoundT(x), ub);
+      if (x != *lb.number()) {
+        this->_i = IntervalT(BoundT(x), ub);
+      }
     } else if (ub.is_finite()) {
       ZNumber y = L(this->_c, *ub.number());
-      this->_i = IntervalT(lb, BoundT(y));
+      if (y != *ub.number()) {
+        this->_i = IntervalT(lb, BoundT(y));
+      }
     }
   }
 
@@ -337,5 +337,42 @@ inline std::ostream& operator<<(
   return o;
 }
 
+/// \brief Pointer abstract value with a packed points-to set
+///
+/// Pointers with the same points-to set share it, see PackedPointsToSet.
+/// The offset interval is stored inline, since machine integers of at most
+/// 64 bits do not allocate. This is meant to store many pointer abstract
+/// values, e.g, the results of a pointer analysis.
+template < typename MemoryLocationRef >
+class PackedPointerAbsValue final {
+public:
+  using PointerAbsValueT = PointerAbsValue< MemoryLocationRef >;
+  using PackedPointsToSetT = PackedPointsToSet< MemoryLocationRef >;
+  using MachineIntInterval = machine_int::Interval;
+
+private:
+  PackedPointsToSetT _points_to;
+  MachineIntInterval _offset;
+  Nullity _nullity;
+  Uninitialized _uninitialized;
+
+public:
+  /// \brief Pack the given pointer abstract value
+  explicit PackedPointerAbsValue(const PointerAbsValueT& value)
+      : _points_to(value.points_to()),
+        _offset(value.offset()),
+        _nullity(value.nullity()),
+        _uninitialized(value.uninitialized()) {}
+
+  /// \brief Return the pointer abstract value
+  PointerAbsValueT unpack() const {
+    return PointerAbsValueT(this->_points_to.get(),
+                            this->_offset,
+                            this->_nullity,
+                            this->_uninitialized);
+  }
+
+}; // end class PackedPointerAbsValue
+
 } // end namespace core
 } // end namespace ikos
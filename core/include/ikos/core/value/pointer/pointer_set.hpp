@@ -59,17 +59,22 @@ namespace core {
 ///   * An interval representing the offsets
 ///
 /// It does not handle null and uninitialized pointers.
+///
+/// The points-to set is packed, since pointer sets are stored for each memory
+/// location (see PackedPointsToSet). Operations on pointer sets sharing the
+/// same points-to set skip the points-to sets.
 template < typename MemoryLocationRef >
 class PointerSet final
     : public core::AbstractDomain< PointerSet< MemoryLocationRef > > {
 public:
   using PointsToSetT = PointsToSet< MemoryLocationRef >;
+  using PackedPointsToSetT = PackedPointsToSet< MemoryLocationRef >;
   using PointerAbsValueT = PointerAbsValue< MemoryLocationRef >;
   using MachineIntInterval = machine_int::Interval;
 
 private:
   /// \brief Set of memory locations (i.e, addresses) pointed by the pointers
-  PointsToSetT _points_to;
+  PackedPointsToSetT _points_to;
 
   /// \brief Offsets interval
   MachineIntInterval _offsets;
@@ -77,21 +82,33 @@ private:
 private:
   /// \brief Normalize the pointer set
   void normalize() {
-    if (this->_points_to.is_bottom() || this->_points_to.is_empty()) {
+    if (this->points_to().is_bottom() || this->points_to().is_empty()) {
       this->_offsets.set_to_bottom();
     } else if (this->_offsets.is_bottom()) {
-      this->_points_to.set_to_bottom();
+      this->_points_to = PackedPointsToSetT(PointsToSetT::bottom());
+    }
+  }
+
+  /// \brief Apply `op` on the points-to sets of `this` and `other`
+  ///
+  /// `op` must be idempotent, since it is skipped on shared points-to sets.
+  template < typename Op >
+  void apply_points_to(const PointerSet& other, Op op) {
+    if (this->_points_to.shares(other._points_to)) {
+      return;
     }
+    PointsToSetT points_to = this->points_to();
+    op(points_to, other.points_to());
+    this->_points_to = PackedPointsToSetT(points_to);
   }
 
 public:
   /// \brief Create the top pointer set
-  PointerSet()
-      : _points_to(PointsToSetT::top()), _offsets(MachineIntInterval::top()) {}
+  PointerSet() : _offsets(MachineIntInterval::top()) {}
 
   /// \brief Create the pointer set with the given points-to set and interval
-  PointerSet(PointsToSetT points_to, MachineIntInterval offsets)
-      : _points_to(std::move(points_to)), _offsets(std::move(offsets)) {
+  PointerSet(const PointsToSetT& points_to, MachineIntInterval offsets)
+      : _points_to(points_to), _offsets(std::move(offsets)) {
     this->normalize();
   }
 
@@ -147,7 +164,7 @@ public:
   }
 
   /// \brief Return the points-to set
-  const PointsToSetT& points_to() const { return this->_points_to; }
+  const PointsToSetT& points_to() const { return this->_points_to.get(); }
 
   /// \brief Return the interval offsets
   const MachineIntInterval& offsets() const { return this->_offsets; }
@@ -159,72 +176,88 @@ public:
   Uninitialized uninitialized() const { return Uninitialized::top(); }
 
   bool is_bottom() const override {
-    return this->_points_to.is_bottom(); // Correct because of normalization
+    return this->points_to().is_bottom(); // Correct because of normalization
   }
 
   bool is_top() const override {
-    return this->_points_to.is_top() && this->_offsets.is_top();
+    return this->points_to().is_top() && this->_offsets.is_top();
   }
 
   void set_to_bottom() override {
-    this->_points_to.set_to_bottom();
+    this->_points_to = PackedPointsToSetT(PointsToSetT::bottom());
     this->_offsets.set_to_bottom();
   }
 
   void set_to_top() override {
-    this->_points_to.set_to_top();
+    this->_points_to = PackedPointsToSetT(PointsToSetT::top());
     this->_offsets.set_to_top();
   }
 
   bool leq(const PointerSet& other) const override {
-    return this->_points_to.leq(other._points_to) &&
+    return (this->_points_to.shares(other._points_to) ||
+            this->points_to().leq(other.points_to())) &&
            this->_offsets.leq(other._offsets);
   }
 
   bool equals(const PointerSet& other) const override {
-    return this->_points_to.equals(other._points_to) &&
+    return (this->_points_to.shares(other._points_to) ||
+            this->points_to().equals(other.points_to())) &&
            this->_offsets.equals(other._offsets);
   }
 
   void join_with(const PointerSet& other) override {
-    this->_points_to.join_with(other._points_to);
+    this->apply_points_to(other, [](PointsToSetT& x, const PointsToSetT& y) {
+      x.join_with(y);
+    });
     this->_offsets.join_with(other._offsets);
     this->normalize();
   }
 
   void join_loop_with(const PointerSet& other) override {
-    this->_points_to.join_loop_with(other._points_to);
+    this->apply_points_to(other, [](PointsToSetT& x, const PointsToSetT& y) {
+      x.join_loop_with(y);
+    });
     this->_offsets.join_loop_with(other._offsets);
     this->normalize();
   }
 
   void join_iter_with(const PointerSet& other) override {
-    this->_points_to.join_iter_with(other._points_to);
+    this->apply_points_to(other, [](PointsToSetT& x, const PointsToSetT& y) {
+      x.join_iter_with(y);
+    });
     this->_offsets.join_iter_with(other._offsets);
     this->normalize();
   }
 
   void widen_with(const PointerSet& other) override {
-    this->_points_to.widen_with(other._points_to);
+    this->apply_points_to(other, [](PointsToSetT& x, const PointsToSetT& y) {
+      x.widen_with(y);
+    });
     this->_offsets.widen_with(other._offsets);
     this->normalize();
   }
 
   void meet_with(const PointerSet& other) override {
-    this->_points_to.meet_with(other._points_to);
+    this->apply_points_to(other, [](PointsToSetT& x, const PointsToSetT& y) {
+      x.meet_with(y);
+    });
     this->_offsets.meet_with(other._offsets);
     this->normalize();
   }
 
   void narrow_with(const PointerSet& other) override {
-    this->_points_to.narrow_with(other._points_to);
+    this->apply_points_to(other, [](PointsToSetT& x, const PointsToSetT& y) {
+      x.narrow_with(y);
+    });
     this->_offsets.narrow_with(other._offsets);
     this->normalize();
   }
 
   /// \brief Add a pointer abstract value in the set
   void add(const PointerAbsValueT& pointer) {
-    this->_points_to.join_with(pointer.points_to());
+    PointsToSetT points_to = this->points_to();
+    points_to.join_with(pointer.points_to());
+    this->_points_to = PackedPointsToSetT(points_to);
     this->_offsets.join_with(pointer.offset());
     this->normalize();
   }
@@ -234,10 +267,10 @@ public:
       o << "⊥";
     } else if (this->is_top()) {
       o << "T";
-    } else if (this->_points_to.is_empty()) {
+    } else if (this->points_to().is_empty()) {
       o << "{}";
     } else {
-      this->_points_to.dump(o);
+      this->points_to().dump(o);
       o << " + ";
       this->_offsets.dump(o);
     }
@@ -43,9 +43,13 @@
 
 #pragma once
 
+#include <memory>
+
+#include <boost/functional/hash.hpp>
 #include <boost/optional.hpp>
 
-#include <ikos/core/adt/patricia_tree/set.hpp>
+#include <ikos/core/adt/patricia_tree/small_set.hpp>
+#include <ikos/core/adt/patricia_tree/utils.hpp>
 #include <ikos/core/domain/abstract_domain.hpp>
 #include <ikos/core/semantic/memory_location.hpp>
 
@@ -65,14 +69,14 @@ private:
   enum Kind { BottomKind, TopKind, SetKind };
 
 private:
-  using PatriciaTreeSetT = PatriciaTreeSet< MemoryLocationRef >;
+  using SetT = SmallPatriciaTreeSet< MemoryLocationRef >;
 
 public:
-  using Iterator = typename PatriciaTreeSetT::Iterator;
+  using Iterator = typename SetT::Iterator;
 
 private:
   Kind _kind;
-  PatriciaTreeSetT _set;
+  SetT _set;
 
 private:
   struct TopTag {};
@@ -295,6 +299,109 @@ public:
 
 }; // end class PointsToSet
 
+/// \brief Points-to set stored behind an interned handle
+///
+/// Equal points-to sets packed by the same thread share the same immutable
+/// PointsToSet, so a packed points-to set is the size of a shared pointer,
+/// and equal sets are compared with pointer equality. Top, bottom and the
+/// empty set point to static instances, without reference counting.
+///
+/// This is meant to store points-to sets, not to compute on them.
+template < typename MemoryLocationRef >
+class PackedPointsToSet final {
+public:
+  using PointsToSetT = PointsToSet< MemoryLocationRef >;
+
+private:
+  using Handle = std::shared_ptr< const PointsToSetT >;
+
+private:
+  Handle _set;
+
+private:
+  /// \brief Return a handle on a static points-to set
+  static Handle static_handle(const PointsToSetT& set) {
+    // Aliasing constructor with an empty owner: copies do not touch any
+    // reference counter
+    return Handle(Handle(), &set);
+  }
+
+  /// \brief Return the handle on the top points-to set
+  static const Handle& top_handle() {
+    static const PointsToSetT set = PointsToSetT::top();
+    static const Handle handle = static_handle(set);
+    return handle;
+  }
+
+  /// \brief Return the handle on the bottom points-to set
+  static const Handle& bottom_handle() {
+    static const PointsToSetT set = PointsToSetT::bottom();
+    static const Handle handle = static_handle(set);
+    return handle;
+  }
+
+  /// \brief Return the handle on the empty points-to set
+  static const Handle& empty_handle() {
+    static const PointsToSetT set = PointsToSetT::empty();
+    static const Handle handle = static_handle(set);
+    return handle;
+  }
+
+  /// \brief Return the interned handle on the given points-to set
+  static Handle intern(const PointsToSetT& set) {
+    if (set.is_top()) {
+      return top_handle();
+    } else if (set.is_bottom()) {
+      return bottom_handle();
+    } else if (set.is_empty()) {
+      return empty_handle();
+    }
+
+    std::size_t hash = 0;
+    for (MemoryLocationRef m : set) {
+      boost::hash_combine(hash, IndexableTraits< MemoryLocationRef >::index(m));
+    }
+    return patricia_tree_utils::InterningTable< PointsToSetT >::get().intern(
+        hash,
+        [&](const PointsToSetT& other) { return other.equals(set); },
+        [&] { return std::make_shared< const PointsToSetT >(set); });
+  }
+
+public:
+  /// \brief Create the top packed points-to set
+  PackedPointsToSet() : _set(top_handle()) {}
+
+  /// \brief Pack the given points-to set
+  explicit PackedPointsToSet(const PointsToSetT& set) : _set(intern(set)) {}
+
+  /// \brief Copy constructor
+  PackedPointsToSet(const PackedPointsToSet&) = default;
+
+  /// \brief Move constructor
+  PackedPointsToSet(PackedPointsToSet&&) noexcept = default;
+
+  /// \brief Copy assignment operator
+  PackedPointsToSet& operator=(const PackedPointsToSet&) = default;
+
+  /// \brief Move assignment operator
+  PackedPointsToSet& operator=(PackedPointsToSet&&) noexcept = default;
+
+  /// \brief Destructor
+  ~PackedPointsToSet() = default;
+
+  /// \brief Return the points-to set
+  const PointsToSetT& get() const { return *this->_set; }
+
+  /// \brief Return true if both packed sets share the same points-to set
+  ///
+  /// This implies that the points-to sets are equal. Equal points-to sets
+  /// packed by different threads might not be shared.
+  bool shares(const PackedPointsToSet& other) const {
+    return this->_set == other._set;
+  }
+
+}; // end class PackedPointsToSet
+
 /// \brief Write a points-to set on a stream
 template < typename MemoryLocationRef >
 inline std::ostream& operator<<(
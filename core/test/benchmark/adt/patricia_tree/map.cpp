@@ -0,0 +1,110 @@
+/*******************************************************************************
+ *
+ * Benchmarks for PatriciaTreeMap
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <benchmark/benchmark.h>
+
+#include <ikos/core/adt/patricia_tree/map.hpp>
+
+using Index = ikos::core::Index;
+using Map = ikos::core::PatriciaTreeMap< Index, int >;
+
+namespace {
+
+/// \brief Return a map with the keys `offset, offset + step, ...`
+Map make_map(int64_t size, Index offset, Index step) {
+  Map m;
+  for (int64_t i = 0; i < size; i++) {
+    m.insert_or_assign(offset + static_cast< Index >(i) * step,
+                       static_cast< int >(i));
+  }
+  return m;
+}
+
+} // end anonymous namespace
+
+static void BM_insert(benchmark::State& state) {
+  for (auto _ : state) {
+    Map m = make_map(state.range(0), 0, 7);
+    benchmark::DoNotOptimize(m);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_insert)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void BM_at(benchmark::State& state) {
+  Map m = make_map(state.range(0), 0, 7);
+  Index key = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.at(key));
+    key = (key + 7) % (static_cast< Index >(state.range(0)) * 7);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_at)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void BM_join(benchmark::State& state) {
+  // Half of the keys are shared
+  Map left = make_map(state.range(0), 0, 2);
+  Map right = make_map(state.range(0), static_cast< Index >(state.range(0)), 2);
+  for (auto _ : state) {
+    Map m = left;
+    m.join_with(right, [](int x, int y) {
+      return boost::optional< int >(std::max(x, y));
+    });
+    benchmark::DoNotOptimize(m);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_join)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void BM_leq(benchmark::State& state) {
+  // Same content, different trees
+  Map left = make_map(state.range(0), 0, 3);
+  Map right = make_map(state.range(0), 0, 3);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        left.leq(right, [](int x, int y) { return x <= y; }));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_leq)->RangeMultiplier(8)->Range(8, 1 << 15);
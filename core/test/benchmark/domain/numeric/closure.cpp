@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * Benchmarks for the closure of relational numerical domains
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <ikos/core/domain/numeric/dbm.hpp>
+#include <ikos/core/domain/numeric/octagon.hpp>
+#include <ikos/core/domain/numeric/var_packing_dbm.hpp>
+#include <ikos/core/example/variable_factory.hpp>
+
+using ZNumber = ikos::core::ZNumber;
+using VariableFactory = ikos::core::example::VariableFactory;
+using Variable = ikos::core::example::VariableFactory::VariableRef;
+using VariableExpr = ikos::core::VariableExpression< ZNumber, Variable >;
+using ZBound = ikos::core::ZBound;
+using Interval = ikos::core::numeric::ZInterval;
+using DBM = ikos::core::numeric::DBM< ZNumber, Variable >;
+using Octagon = ikos::core::numeric::Octagon< ZNumber, Variable >;
+using VarPackingDBM = ikos::core::numeric::VarPackingDBM< ZNumber, Variable >;
+
+namespace {
+
+/// \brief Return `n` variables
+std::vector< Variable > make_variables(VariableFactory& vfac, int64_t n) {
+  std::vector< Variable > vars;
+  for (int64_t i = 0; i < n; i++) {
+    vars.push_back(vfac.get("v" + std::to_string(i)));
+  }
+  return vars;
+}
+
+/// \brief Add the chain `v0 <= v1 - 1 <= ... <= vn - n`, with `v0 in [0, 10]`
+///
+/// The closure has to propagate the bounds along the whole chain.
+template < typename Domain >
+void add_chain(Domain& inv, const std::vector< Variable >& vars) {
+  inv.set(vars[0], Interval(ZBound(0), ZBound(10)));
+  for (std::size_t i = 1; i < vars.size(); i++) {
+    inv.add(VariableExpr(vars[i - 1]) - VariableExpr(vars[i]) <= -1);
+  }
+}
+
+/// \brief Measure the closure after adding a chain of constraints
+template < typename Domain >
+void BM_chain(benchmark::State& state) {
+  VariableFactory vfac;
+  std::vector< Variable > vars = make_variables(vfac, state.range(0));
+  for (auto _ : state) {
+    Domain inv = Domain::top();
+    add_chain(inv, vars);
+    inv.normalize();
+    benchmark::DoNotOptimize(inv.to_interval(vars.back()));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+/// \brief Measure the join of two closed abstract values
+template < typename Domain >
+void BM_join(benchmark::State& state) {
+  VariableFactory vfac;
+  std::vector< Variable > vars = make_variables(vfac, state.range(0));
+  Domain left = Domain::top();
+  add_chain(left, vars);
+  Domain right = left;
+  right.set(vars[0], Interval(ZBound(5), ZBound(20)));
+  left.normalize();
+  right.normalize();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(left.join(right));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+} // end anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_chain, DBM)->RangeMultiplier(2)->Range(4, 64);
+BENCHMARK_TEMPLATE(BM_chain, Octagon)->RangeMultiplier(2)->Range(4, 64);
+BENCHMARK_TEMPLATE(BM_chain, VarPackingDBM)->RangeMultiplier(2)->Range(4, 64);
+
+BENCHMARK_TEMPLATE(BM_join, DBM)->RangeMultiplier(2)->Range(4, 64);
+BENCHMARK_TEMPLATE(BM_join, Octagon)->RangeMultiplier(2)->Range(4, 64);
+BENCHMARK_TEMPLATE(BM_join, VarPackingDBM)->RangeMultiplier(2)->Range(4, 64);
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * Benchmarks for MachineInt
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <benchmark/benchmark.h>
+
+#include <ikos/core/number/machine_int.hpp>
+
+using MachineInt = ikos::core::MachineInt;
+using ikos::core::Signed;
+using ikos::core::Unsigned;
+
+namespace {
+
+/// \brief Return a pair of operands of the given bit-width
+std::pair< MachineInt, MachineInt > make_operands(int64_t bit_width) {
+  auto width = static_cast< unsigned >(bit_width);
+  MachineInt x = MachineInt::max(width, Signed);
+  MachineInt y(1234567, width, Signed);
+  return {x, y};
+}
+
+} // end anonymous namespace
+
+static void BM_add(benchmark::State& state) {
+  auto ops = make_operands(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(add(ops.first, ops.second));
+  }
+}
+BENCHMARK(BM_add)->Arg(32)->Arg(64)->Arg(128);
+
+static void BM_mul(benchmark::State& state) {
+  auto ops = make_operands(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mul(ops.first, ops.second));
+  }
+}
+BENCHMARK(BM_mul)->Arg(32)->Arg(64)->Arg(128);
+
+static void BM_div(benchmark::State& state) {
+  auto ops = make_operands(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(div(ops.first, ops.second));
+  }
+}
+BENCHMARK(BM_div)->Arg(32)->Arg(64)->Arg(128);
+
+static void BM_compare(benchmark::State& state) {
+  auto ops = make_operands(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ops.first <= ops.second);
+  }
+}
+BENCHMARK(BM_compare)->Arg(32)->Arg(64)->Arg(128);
+
+static void BM_sign_cast(benchmark::State& state) {
+  auto ops = make_operands(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ops.first.sign_cast(Unsigned));
+  }
+}
+BENCHMARK(BM_sign_cast)->Arg(32)->Arg(64)->Arg(128);
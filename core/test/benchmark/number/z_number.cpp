@@ -0,0 +1,93 @@
+/*******************************************************************************
+ *
+ * Benchmarks for ZNumber
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <benchmark/benchmark.h>
+
+#include <ikos/core/number/z_number.hpp>
+
+using ZNumber = ikos::core::ZNumber;
+
+namespace {
+
+/// \brief Return a number of the given size in bits
+ZNumber make_number(int64_t bits) {
+  return (ZNumber(1) << ZNumber(bits)) - 3;
+}
+
+} // end anonymous namespace
+
+static void BM_add(benchmark::State& state) {
+  ZNumber x = make_number(state.range(0));
+  ZNumber y = make_number(state.range(0)) - 5;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(x + y);
+  }
+}
+BENCHMARK(BM_add)->Arg(32)->Arg(64)->Arg(128)->Arg(1024);
+
+static void BM_mul(benchmark::State& state) {
+  ZNumber x = make_number(state.range(0));
+  ZNumber y = make_number(state.range(0)) - 5;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(x * y);
+  }
+}
+BENCHMARK(BM_mul)->Arg(32)->Arg(64)->Arg(128)->Arg(1024);
+
+static void BM_div(benchmark::State& state) {
+  ZNumber x = make_number(state.range(0));
+  ZNumber y = make_number(state.range(0) / 2) - 5;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(x / y);
+  }
+}
+BENCHMARK(BM_div)->Arg(32)->Arg(64)->Arg(128)->Arg(1024);
+
+static void BM_compare(benchmark::State& state) {
+  ZNumber x = make_number(state.range(0));
+  ZNumber y = make_number(state.range(0)) - 5;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(x <= y);
+  }
+}
+BENCHMARK(BM_compare)->Arg(32)->Arg(64)->Arg(128)->Arg(1024);
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *
+ * Benchmarks for the parallel operations on variable packing domains
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <ikos/core/domain/numeric/var_packing_dbm.hpp>
+#include <ikos/core/example/variable_factory.hpp>
+#include <ikos/core/support/parallel.hpp>
+
+using ZNumber = ikos::core::ZNumber;
+using VariableFactory = ikos::core::example::VariableFactory;
+using Variable = ikos::core::example::VariableFactory::VariableRef;
+using VariableExpr = ikos::core::VariableExpression< ZNumber, Variable >;
+using ZBound = ikos::core::ZBound;
+using Interval = ikos::core::numeric::ZInterval;
+using VarPackingDBM = ikos::core::numeric::VarPackingDBM< ZNumber, Variable >;
+using Parallel = ikos::core::Parallel;
+
+namespace {
+
+/// \brief Measure a call to Parallel::for_each_index() doing no work
+///
+/// This is the fixed cost of dispatching calls to the threads.
+void BM_dispatch(benchmark::State& state) {
+  Parallel::set_jobs(static_cast< unsigned >(state.range(0)));
+  std::size_t n = static_cast< std::size_t >(state.range(0));
+  for (auto _ : state) {
+    Parallel::for_each_index(n, 1, [](std::size_t i) {
+      benchmark::DoNotOptimize(i);
+    });
+  }
+  Parallel::set_jobs(1);
+}
+
+/// \brief Measure the join of two values with `range(0)` packs of two
+/// variables, all different, using `range(1)` threads
+void BM_join_packs(benchmark::State& state) {
+  VariableFactory vfac;
+  VarPackingDBM left = VarPackingDBM::top();
+  VarPackingDBM right = VarPackingDBM::top();
+  for (int64_t i = 0; i < state.range(0); i++) {
+    Variable x = vfac.get("x" + std::to_string(i));
+    Variable y = vfac.get("y" + std::to_string(i));
+    left.set(x, Interval(ZBound(0), ZBound(10)));
+    left.add(VariableExpr(x) - VariableExpr(y) <= -1);
+    right.set(x, Interval(ZBound(5), ZBound(20)));
+    right.add(VariableExpr(x) - VariableExpr(y) <= -2);
+  }
+  left.normalize();
+  right.normalize();
+  Parallel::set_jobs(static_cast< unsigned >(state.range(1)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(left.join(right));
+  }
+  Parallel::set_jobs(1);
+  state.SetComplexityN(state.range(0));
+}
+
+} // end anonymous namespace
+
+BENCHMARK(BM_dispatch)->Arg(2)->Arg(4)->UseRealTime();
+
+BENCHMARK(BM_join_packs)
+    ->ArgPair(8, 1)
+    ->ArgPair(16, 1)
+    ->ArgPair(32, 1)
+    ->ArgPair(64, 1)
+    ->ArgPair(128, 1)
+    ->ArgPair(32, 2)
+    ->ArgPair(32, 4)
+    ->ArgPair(128, 2)
+    ->ArgPair(128, 4)
+    ->UseRealTime();
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ *
+ * Benchmarks for machine_int::Interval
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <benchmark/benchmark.h>
+
+#include <ikos/core/value/machine_int/interval.hpp>
+
+using MachineInt = ikos::core::MachineInt;
+using Interval = ikos::core::machine_int::Interval;
+using ikos::core::Signed;
+
+namespace {
+
+/// \brief Return a pair of operands of the given bit-width
+std::pair< Interval, Interval > make_operands(int64_t bit_width) {
+  auto width = static_cast< unsigned >(bit_width);
+  Interval x(MachineInt(-100, width, Signed), MachineInt(1000, width, Signed));
+  Interval y(MachineInt(3, width, Signed), MachineInt(17, width, Signed));
+  return {x, y};
+}
+
+} // end anonymous namespace
+
+#define INTERVAL_BENCHMARK(OP)                                              \
+  static void BM_##OP(benchmark::State& state) {                            \
+    auto ops = make_operands(state.range(0));                               \
+    for (auto _ : state) {                                                  \
+      benchmark::DoNotOptimize(ikos::core::machine_int::OP(ops.first,       \
+                                                           ops.second));    \
+    }                                                                       \
+  }                                                                         \
+  BENCHMARK(BM_##OP)->Arg(8)->Arg(32)->Arg(64)->Arg(128)
+
+INTERVAL_BENCHMARK(add);
+INTERVAL_BENCHMARK(sub);
+INTERVAL_BENCHMARK(mul);
+INTERVAL_BENCHMARK(div);
+INTERVAL_BENCHMARK(rem);
+INTERVAL_BENCHMARK(shl);
+INTERVAL_BENCHMARK(ashr);
+INTERVAL_BENCHMARK(and_);
+INTERVAL_BENCHMARK(or_);
+
+static void BM_join(benchmark::State& state) {
+  auto ops = make_operands(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ops.first.join(ops.second));
+  }
+}
+BENCHMARK(BM_join)->Arg(8)->Arg(32)->Arg(64)->Arg(128);
+
+static void BM_widening(benchmark::State& state) {
+  auto ops = make_operands(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ops.second.widening(ops.first));
+  }
+}
+BENCHMARK(BM_widening)->Arg(8)->Arg(32)->Arg(64)->Arg(128);
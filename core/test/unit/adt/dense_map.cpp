@@ -0,0 +1,256 @@
+/*******************************************************************************
+ *
+ * Tests for DenseMap
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_dense_map
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include <ikos/core/adt/dense_map.hpp>
+
+namespace {
+
+/// \brief Key type with a dense index
+struct Id {
+  ikos::core::Index index;
+
+  bool operator==(const Id& other) const { return index == other.index; }
+};
+
+} // end anonymous namespace
+
+namespace ikos {
+namespace core {
+
+template <>
+struct DenseIndexableTraits< Id > {
+  static Index dense_index(const Id& id) { return id.index; }
+};
+
+} // end namespace core
+} // end namespace ikos
+
+using Map = ikos::core::DenseMap< Id, int >;
+
+BOOST_AUTO_TEST_CASE(insert_and_erase) {
+  Map m;
+  BOOST_CHECK(m.empty());
+  BOOST_CHECK(!m.at(Id{3}));
+
+  for (ikos::core::Index i = 100; i < 200; i += 3) {
+    m.insert_or_assign(Id{i}, static_cast< int >(i));
+  }
+  BOOST_CHECK(m.size() == 34);
+  BOOST_CHECK(*m.at(Id{103}) == 103);
+  BOOST_CHECK(!m.at(Id{104}));
+  BOOST_CHECK(!m.at(Id{3}));
+  BOOST_CHECK(!m.at(Id{1000}));
+
+  m.insert_or_assign(Id{103}, 0);
+  BOOST_CHECK(m.size() == 34);
+  BOOST_CHECK(*m.at(Id{103}) == 0);
+
+  // Iteration in the order of the dense indexes
+  std::vector< ikos::core::Index > keys;
+  for (const auto& entry : m) {
+    keys.push_back(entry.first.index);
+  }
+  BOOST_CHECK(keys.size() == 34);
+  BOOST_CHECK(std::is_sorted(keys.begin(), keys.end()));
+
+  for (ikos::core::Index i = 100; i < 200; i += 3) {
+    m.erase(Id{i});
+  }
+  BOOST_CHECK(m.empty());
+  BOOST_CHECK(m.span() == 0);
+  BOOST_CHECK(m.begin() == m.end());
+}
+
+BOOST_AUTO_TEST_CASE(copy_on_write) {
+  Map m;
+  for (ikos::core::Index i = 0; i < 100; i++) {
+    m.insert_or_assign(Id{i}, static_cast< int >(i));
+  }
+  Map n = m;
+  n.insert_or_assign(Id{42}, -1);
+  n.erase(Id{7});
+  BOOST_CHECK(*m.at(Id{42}) == 42);
+  BOOST_CHECK(*m.at(Id{7}) == 7);
+  BOOST_CHECK(*n.at(Id{42}) == -1);
+  BOOST_CHECK(!n.at(Id{7}));
+  BOOST_CHECK(m.size() == 100);
+  BOOST_CHECK(n.size() == 99);
+}
+
+BOOST_AUTO_TEST_CASE(assign_same_value) {
+  Map m;
+  for (ikos::core::Index i = 0; i < 100; i++) {
+    m.insert_or_assign(Id{i}, static_cast< int >(i));
+  }
+  Map n = m;
+  n.insert_or_assign(Id{42}, 42);
+
+  // Shared chunks are skipped without calling the comparison
+  int calls = 0;
+  auto cmp = [&calls](int x, int y) {
+    calls++;
+    return x <= y;
+  };
+  BOOST_CHECK(n.leq(m, cmp));
+  BOOST_CHECK(calls == 0);
+
+  n.insert_or_assign(Id{42}, -1);
+  BOOST_CHECK(n.leq(m, cmp));
+  BOOST_CHECK(calls > 0);
+}
+
+BOOST_AUTO_TEST_CASE(dirty_keys) {
+  Map m;
+  for (ikos::core::Index i = 0; i < 100; i++) {
+    m.insert_or_assign(Id{i}, static_cast< int >(i));
+  }
+
+  // Only the keys written since the copy are compared
+  std::vector< ikos::core::Index > visited;
+  auto cmp = [&visited](int x, int y) {
+    visited.push_back(static_cast< ikos::core::Index >(y));
+    return x <= y;
+  };
+  Map n = m;
+  n.insert_or_assign(Id{42}, 0);
+  n.insert_or_assign(Id{44}, 0);
+  n.insert_or_assign(Id{44}, 44);
+  BOOST_CHECK(n.leq(m, cmp));
+  BOOST_CHECK((visited == std::vector< ikos::core::Index >{42, 44}));
+
+  // Same with two copies of the same map
+  visited.clear();
+  Map o = m;
+  o.insert_or_assign(Id{40}, 0);
+  BOOST_CHECK(!n.leq(o, cmp));
+  visited.clear();
+  BOOST_CHECK(!o.leq(n, cmp));
+  BOOST_CHECK(visited.size() <= 3);
+
+  // Copies of a copy can still be compared with the original
+  visited.clear();
+  Map p = n;
+  p.insert_or_assign(Id{50}, 0);
+  BOOST_CHECK(p.leq(m, cmp));
+  BOOST_CHECK((visited == std::vector< ikos::core::Index >{42, 44, 50}));
+
+  // Widening at a loop head only combines the keys written by the body
+  int calls = 0;
+  auto widen = [&calls](int x, int y) -> boost::optional< int > {
+    calls++;
+    return std::max(x, y);
+  };
+  Map q = m;
+  q.insert_or_assign(Id{7}, 1000);
+  Map r = m;
+  r.join_with(q, widen);
+  BOOST_CHECK(calls == 1);
+  BOOST_CHECK(*r.at(Id{7}) == 1000);
+  BOOST_CHECK(*r.at(Id{8}) == 8);
+
+  // Writing in place a chunk that was copied invalidates the copies
+  Map a;
+  for (ikos::core::Index i = 0; i < 32; i++) {
+    a.insert_or_assign(Id{i}, static_cast< int >(i));
+  }
+  Map b = a;
+  b.insert_or_assign(Id{3}, -1);
+  a.insert_or_assign(Id{20}, -1);
+  BOOST_CHECK(!b.leq(a, cmp));
+}
+
+BOOST_AUTO_TEST_CASE(binary_operations) {
+  auto cmp = [](int x, int y) { return x <= y; };
+  auto plus = [](int x, int y) -> boost::optional< int > {
+    if (x + y == 0) {
+      return boost::none;
+    }
+    return x + y;
+  };
+
+  Map m;
+  Map n;
+  for (ikos::core::Index i = 0; i < 100; i++) {
+    m.insert_or_assign(Id{i}, 1);
+  }
+  for (ikos::core::Index i = 50; i < 150; i++) {
+    n.insert_or_assign(Id{i}, 2);
+  }
+
+  BOOST_CHECK(m.leq(m, cmp));
+  BOOST_CHECK(m.equals(m, std::equal_to< int >()));
+  BOOST_CHECK(!m.leq(n, cmp));
+  BOOST_CHECK(!m.equals(n, std::equal_to< int >()));
+
+  Map o = m;
+  o.intersect_with(n, plus);
+  BOOST_CHECK(o.size() == 50);
+  BOOST_CHECK(!o.at(Id{49}));
+  BOOST_CHECK(*o.at(Id{50}) == 3);
+  BOOST_CHECK(!o.at(Id{100}));
+
+  Map p = m;
+  p.join_with(n, plus);
+  BOOST_CHECK(p.size() == 150);
+  BOOST_CHECK(*p.at(Id{0}) == 1);
+  BOOST_CHECK(*p.at(Id{50}) == 3);
+  BOOST_CHECK(*p.at(Id{149}) == 2);
+  BOOST_CHECK(p.leq(o, std::equal_to< int >()));
+  BOOST_CHECK(!o.leq(p, std::equal_to< int >()));
+
+  // Removed by the combining function
+  Map q;
+  q.insert_or_assign(Id{10}, -1);
+  q.insert_or_assign(Id{500}, 5);
+  p.join_with(q, plus);
+  BOOST_CHECK(p.size() == 150);
+  BOOST_CHECK(!p.at(Id{10}));
+  BOOST_CHECK(*p.at(Id{500}) == 5);
+}
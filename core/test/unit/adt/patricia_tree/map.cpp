@@ -42,12 +42,27 @@
 
 #define BOOST_TEST_MODULE test_patricia_tree_map
 #define BOOST_TEST_DYN_LINK
+#include <functional>
+
 #include <boost/mpl/list.hpp>
 #include <boost/test/output_test_stream.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <ikos/core/adt/patricia_tree/map.hpp>
 
+namespace ikos {
+namespace core {
+
+template <>
+struct PatriciaTreeHashConsing< Index, int > {
+  static constexpr bool enabled = true;
+
+  static std::size_t hash(int value) { return std::hash< int >()(value); }
+};
+
+} // end namespace core
+} // end namespace ikos
+
 BOOST_AUTO_TEST_CASE(test_patricia_tree_map) {
   using Index = ikos::core::Index;
   using Map = ikos::core::PatriciaTreeMap< Index, std::string >;
@@ -268,3 +283,87 @@ BOOST_AUTO_TEST_CASE(test_patricia_tree_map) {
   const std::pair< Index, std::string > tab4[] = {{1, "hellozzzzz"}};
   BOOST_CHECK(std::equal(m.begin(), m.end(), std::begin(tab4), std::end(tab4)));
 }
+
+BOOST_AUTO_TEST_CASE(test_patricia_tree_map_hash_consing) {
+  using namespace ikos::core::patricia_tree_map_impl;
+  using Index = ikos::core::Index;
+  using Tree = std::shared_ptr< const PatriciaTree< Index, int > >;
+
+  // Build the same map in different orders
+  Tree s;
+  for (Index i = 0; i < 100; i++) {
+    s = insert_or_assign(s, i, static_cast< int >(i % 7));
+  }
+  Tree t;
+  for (Index i = 100; i > 0; i--) {
+    t = insert_or_assign(t, i - 1, static_cast< int >((i - 1) % 7));
+  }
+  BOOST_CHECK(s == t);
+
+  // Update a value and restore it
+  Tree u = insert_or_assign(s, Index(42), 1000);
+  BOOST_CHECK(u != s);
+  BOOST_CHECK(*find_value(u, Index(42)) == 1000);
+  u = insert_or_assign(u, Index(42), 0);
+  BOOST_CHECK(u == s);
+
+  Tree v = erase(s, Index(3));
+  BOOST_CHECK(size(v) == 99);
+  BOOST_CHECK(!find_value(v, Index(3)));
+  BOOST_CHECK(insert_or_assign(v, Index(3), 3) == s);
+}
+
+BOOST_AUTO_TEST_CASE(test_patricia_tree_map_size_in_bytes) {
+  using Index = ikos::core::Index;
+  using Map = ikos::core::PatriciaTreeMap< Index, int >;
+
+  Map m;
+  BOOST_CHECK(m.num_nodes() == 0);
+  BOOST_CHECK(m.size_in_bytes() == 0);
+
+  m.insert_or_assign(1, 1);
+  BOOST_CHECK(m.num_nodes() == 1);
+  std::size_t leaf_size = m.size_in_bytes();
+  BOOST_CHECK(leaf_size > 0);
+
+  for (Index i = 2; i <= 10; i++) {
+    m.insert_or_assign(i, static_cast< int >(i));
+  }
+  BOOST_CHECK(m.num_nodes() == 19);
+  BOOST_CHECK(m.size_in_bytes() > 10 * leaf_size);
+}
+
+BOOST_AUTO_TEST_CASE(test_patricia_tree_map_bulk) {
+  using Index = ikos::core::Index;
+  using Map = ikos::core::PatriciaTreeMap< Index, int >;
+
+  Map m;
+  for (Index i = 0; i < 100; i++) {
+    m.insert_or_assign((i * 37) % 101, static_cast< int >(i));
+  }
+
+  // Build from the iteration order
+  std::vector< std::pair< Index, int > > entries(m.begin(), m.end());
+  Map n = Map::from_sorted_range(entries.begin(), entries.end());
+  BOOST_CHECK(n.equals(m, std::equal_to< int >()));
+  BOOST_CHECK(
+      std::equal(n.begin(), n.end(), entries.begin(), entries.end()));
+
+  // Difference
+  Map o;
+  o.insert_or_assign(0, 0);
+  o.insert_or_assign(37, 5);
+  o.insert_or_assign(1000, 5);
+  n.difference_with(o,
+                    [](int left, int right) -> boost::optional< int > {
+                      if (left == right) {
+                        return boost::none;
+                      }
+                      return left - right;
+                    });
+  BOOST_CHECK(n.size() == 99);
+  BOOST_CHECK(!n.at(0));
+  BOOST_CHECK(*n.at(37) == -4);
+  BOOST_CHECK(!n.at(1000));
+  BOOST_CHECK(*n.at(74) == 2);
+}
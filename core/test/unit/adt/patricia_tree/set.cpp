@@ -42,12 +42,42 @@
 
 #define BOOST_TEST_MODULE test_patricia_tree_set
 #define BOOST_TEST_DYN_LINK
+#include <vector>
+
 #include <boost/mpl/list.hpp>
 #include <boost/test/output_test_stream.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <ikos/core/adt/patricia_tree/set.hpp>
 
+namespace {
+
+/// \brief Key type with hash-consing enabled
+struct Id {
+  ikos::core::Index index;
+
+  bool operator==(const Id& other) const { return index == other.index; }
+  bool operator!=(const Id& other) const { return index != other.index; }
+};
+
+} // end anonymous namespace
+
+namespace ikos {
+namespace core {
+
+template <>
+struct IndexableTraits< Id > {
+  static Index index(const Id& id) { return id.index; }
+};
+
+template <>
+struct PatriciaTreeHashConsing< Id > {
+  static constexpr bool enabled = true;
+};
+
+} // end namespace core
+} // end namespace ikos
+
 BOOST_AUTO_TEST_CASE(test_patricia_tree_set) {
   using Index = ikos::core::Index;
   using Set = ikos::core::PatriciaTreeSet< Index >;
@@ -197,3 +227,71 @@ BOOST_AUTO_TEST_CASE(test_patricia_tree_set) {
   s2.insert(1);
   BOOST_CHECK(s1.intersect(s2).equals(Set({1})));
 }
+
+BOOST_AUTO_TEST_CASE(test_patricia_tree_set_hash_consing) {
+  using namespace ikos::core::patricia_tree_set_impl;
+  using Tree = std::shared_ptr< const PatriciaTree< Id > >;
+
+  // Build the same set in different orders
+  Tree s;
+  for (ikos::core::Index i = 0; i < 100; i++) {
+    s = insert(s, Id{i});
+  }
+  Tree t;
+  for (ikos::core::Index i = 100; i > 0; i--) {
+    t = insert(t, Id{i - 1});
+  }
+  BOOST_CHECK(s == t);
+
+  Tree u = erase(erase(s, Id{42}), Id{7});
+  Tree v = erase(erase(t, Id{7}), Id{42});
+  BOOST_CHECK(u == v);
+  BOOST_CHECK(u != s);
+  BOOST_CHECK(join(u, insert(insert(v, Id{7}), Id{42})) == s);
+  BOOST_CHECK(size(u) == 98);
+  BOOST_CHECK(!contains(u, Id{42}));
+  BOOST_CHECK(contains(u, Id{43}));
+}
+
+BOOST_AUTO_TEST_CASE(test_patricia_tree_set_bulk) {
+  using Set = ikos::core::PatriciaTreeSet< Id >;
+
+  Set s;
+  for (ikos::core::Index i = 0; i < 100; i++) {
+    s.insert(Id{(i * 37) % 101});
+  }
+
+  // Build from an unsorted range with duplicates
+  std::vector< Id > ids;
+  for (ikos::core::Index i = 100; i > 0; i--) {
+    ids.push_back(Id{((i - 1) * 37) % 101});
+    ids.push_back(Id{((i - 1) * 37) % 101});
+  }
+  Set t(ids.begin(), ids.end());
+  BOOST_CHECK(t.size() == 100);
+  BOOST_CHECK(s.equals(t));
+
+  // Build from the iteration order, with hash-consing
+  std::vector< Id > sorted(s.begin(), s.end());
+  Set u = Set::from_sorted_range(sorted.begin(), sorted.end());
+  BOOST_CHECK(u.equals(s));
+  BOOST_CHECK(std::equal(u.begin(), u.end(), sorted.begin(), sorted.end()));
+  BOOST_CHECK(Set::from_sorted_range(sorted.end(), sorted.end()).empty());
+
+  // Union of many sets
+  std::vector< Set > sets;
+  for (ikos::core::Index i = 0; i < 10; i++) {
+    Set part;
+    for (ikos::core::Index j = i; j < 100; j += 10) {
+      part.insert(Id{j});
+    }
+    sets.push_back(part);
+  }
+  Set v{Id{1000}};
+  v.join_with_many(sets.begin(), sets.end());
+  BOOST_CHECK(v.size() == 101);
+  BOOST_CHECK(v.contains(Id{1000}));
+  for (ikos::core::Index i = 0; i < 100; i++) {
+    BOOST_CHECK(v.contains(Id{i}));
+  }
+}
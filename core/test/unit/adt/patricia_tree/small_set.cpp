@@ -0,0 +1,154 @@
+/*******************************************************************************
+ *
+ * Tests for SmallPatriciaTreeSet
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_patricia_tree_small_set
+#define BOOST_TEST_DYN_LINK
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ikos/core/adt/patricia_tree/small_set.hpp>
+
+using Index = ikos::core::Index;
+using Set = ikos::core::SmallPatriciaTreeSet< Index, 4 >;
+using TreeSet = ikos::core::PatriciaTreeSet< Index >;
+
+BOOST_AUTO_TEST_CASE(test_insert_erase) {
+  Set s;
+  BOOST_CHECK(s.empty());
+  BOOST_CHECK(s.is_inline());
+  BOOST_CHECK(s.begin() == s.end());
+
+  s.insert(3);
+  s.insert(1);
+  s.insert(3);
+  BOOST_CHECK(s.size() == 2);
+  BOOST_CHECK(s.contains(1));
+  BOOST_CHECK(s.contains(3));
+  BOOST_CHECK(!s.contains(2));
+  BOOST_CHECK(s.size_in_bytes() == 0);
+
+  s.insert(2);
+  s.insert(4);
+  BOOST_CHECK(s.size() == 4);
+  BOOST_CHECK(s.is_inline());
+
+  s.insert(5);
+  BOOST_CHECK(s.size() == 5);
+  BOOST_CHECK(!s.is_inline());
+  BOOST_CHECK(s.contains(5));
+
+  s.erase(5);
+  BOOST_CHECK(s.size() == 4);
+  BOOST_CHECK(s.is_inline());
+  BOOST_CHECK(!s.contains(5));
+
+  s.erase(1);
+  s.erase(1);
+  BOOST_CHECK(s.size() == 3);
+  BOOST_CHECK(!s.contains(1));
+
+  s.clear();
+  BOOST_CHECK(s.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_iteration_order) {
+  std::vector< Index > keys = {8, 1, 6, 3, 12, 2, 7};
+
+  for (std::size_t n = 0; n <= keys.size(); n++) {
+    Set s(keys.begin(), keys.begin() + n);
+    TreeSet t(keys.begin(), keys.begin() + n);
+    BOOST_CHECK(s.size() == n);
+    BOOST_CHECK(std::vector< Index >(s.begin(), s.end()) ==
+                std::vector< Index >(t.begin(), t.end()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_set_operations) {
+  std::vector< std::vector< Index > > sets = {{},
+                                              {1},
+                                              {1, 2},
+                                              {2, 4, 6},
+                                              {1, 2, 3, 4},
+                                              {1, 3, 5, 7, 9},
+                                              {2, 3, 4, 5, 6, 7}};
+
+  for (const auto& a : sets) {
+    for (const auto& b : sets) {
+      Set s1(a.begin(), a.end()), s2(b.begin(), b.end());
+      TreeSet t1(a.begin(), a.end()), t2(b.begin(), b.end());
+
+      BOOST_CHECK(s1.is_subset_of(s2) == t1.is_subset_of(t2));
+      BOOST_CHECK(s1.equals(s2) == t1.equals(t2));
+
+      Set j = s1.join(s2);
+      TreeSet tj = t1.join(t2);
+      BOOST_CHECK(j.size() == tj.size());
+      BOOST_CHECK(j.is_inline() == (j.size() <= 4));
+      BOOST_CHECK(std::vector< Index >(j.begin(), j.end()) ==
+                  std::vector< Index >(tj.begin(), tj.end()));
+
+      Set i = s1.intersect(s2);
+      TreeSet ti = t1.intersect(t2);
+      BOOST_CHECK(i.is_inline() == (i.size() <= 4));
+      BOOST_CHECK(std::vector< Index >(i.begin(), i.end()) ==
+                  std::vector< Index >(ti.begin(), ti.end()));
+
+      Set d = s1.difference(s2);
+      TreeSet td = t1.difference(t2);
+      BOOST_CHECK(d.is_inline() == (d.size() <= 4));
+      BOOST_CHECK(std::vector< Index >(d.begin(), d.end()) ==
+                  std::vector< Index >(td.begin(), td.end()));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_filter) {
+  Set s = {1, 2, 3, 4, 5, 6};
+  s.filter([](Index i) { return i % 2 == 0; });
+  BOOST_CHECK(s.size() == 3);
+  BOOST_CHECK(s.is_inline());
+  BOOST_CHECK(s.equals(Set{2, 4, 6}));
+
+  s.filter([](Index i) { return i > 2; });
+  BOOST_CHECK(s.equals(Set{4, 6}));
+}
@@ -0,0 +1,135 @@
+/*******************************************************************************
+ *
+ * Tests for PoolAllocator
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_pool_allocator
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <ikos/core/adt/pool_allocator.hpp>
+
+namespace {
+
+struct Object {
+  int x;
+  long y;
+
+  Object(int x_, long y_) : x(x_), y(y_) {}
+};
+
+} // end anonymous namespace
+
+BOOST_AUTO_TEST_CASE(reuse) {
+  ikos::core::PoolAllocator< Object > allocator;
+
+  Object* p = allocator.allocate(1);
+  allocator.deallocate(p, 1);
+  Object* q = allocator.allocate(1);
+  BOOST_CHECK(p == q);
+  allocator.deallocate(q, 1);
+
+  Object* array = allocator.allocate(10);
+  allocator.deallocate(array, 10);
+}
+
+BOOST_AUTO_TEST_CASE(make_pooled_shared) {
+  std::vector< std::shared_ptr< const Object > > objects;
+  for (int i = 0; i < 1000; i++) {
+    objects.push_back(ikos::core::make_pooled_shared< const Object >(i, 2 * i));
+  }
+  for (int i = 0; i < 1000; i++) {
+    BOOST_CHECK(objects[i]->x == i);
+    BOOST_CHECK(objects[i]->y == 2 * i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(threads) {
+  // Objects allocated by a thread and freed by another one
+  std::vector< std::shared_ptr< const Object > > objects;
+  std::thread producer([&objects] {
+    for (int i = 0; i < 1000; i++) {
+      objects.push_back(ikos::core::make_pooled_shared< const Object >(i, i));
+    }
+  });
+  producer.join();
+
+  std::thread consumer([&objects] {
+    for (int i = 0; i < 1000; i++) {
+      BOOST_CHECK(objects[i]->x == i);
+    }
+    objects.clear();
+  });
+  consumer.join();
+
+  // Blocks released by the exited threads are reused
+  auto object = ikos::core::make_pooled_shared< const Object >(1, 2);
+  BOOST_CHECK(object->x == 1 && object->y == 2);
+}
+
+BOOST_AUTO_TEST_CASE(trim) {
+  ikos::core::PoolAllocator< Object > allocator;
+
+  std::vector< Object* > objects;
+  for (int i = 0; i < 1000; i++) {
+    objects.push_back(allocator.allocate(1));
+  }
+
+  // Chunks with a block in use are kept
+  for (std::size_t i = 1; i < objects.size(); i++) {
+    allocator.deallocate(objects[i], 1);
+  }
+  std::size_t partial = ikos::core::trim_pool_allocators();
+  allocator.deallocate(objects[0], 1);
+  std::size_t full = ikos::core::trim_pool_allocators();
+  BOOST_CHECK(full > 0);
+  BOOST_CHECK(partial + full >= 1000 * sizeof(Object));
+
+  // Nothing left to release
+  BOOST_CHECK(ikos::core::trim_pool_allocators() == 0);
+
+  // The pool still works
+  Object* p = allocator.allocate(1);
+  allocator.deallocate(p, 1);
+}
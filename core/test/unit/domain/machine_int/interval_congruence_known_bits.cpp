@@ -0,0 +1,169 @@
+/*******************************************************************************
+ *
+ * Tests for machine_int::IntervalCongruenceKnownBitsDomain
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_machine_int_interval_congruence_known_bits_domain
+#define BOOST_TEST_DYN_LINK
+#include <boost/mpl/list.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <ikos/core/domain/machine_int/interval_congruence_known_bits.hpp>
+#include <ikos/core/example/machine_int/variable_factory.hpp>
+
+using Int = ikos::core::MachineInt;
+using Interval = ikos::core::machine_int::Interval;
+using Congruence = ikos::core::machine_int::Congruence;
+using IntervalCongruence = ikos::core::machine_int::IntervalCongruence;
+using KnownBits = ikos::core::machine_int::KnownBits;
+using ikos::core::Signed;
+using ikos::core::Unsigned;
+using ikos::core::machine_int::BinaryOperator;
+using ikos::core::machine_int::Predicate;
+using ikos::core::machine_int::UnaryOperator;
+using VariableFactory = ikos::core::example::machine_int::VariableFactory;
+using Variable = VariableFactory::VariableRef;
+using IntervalCongruenceKnownBitsDomain =
+    ikos::core::machine_int::IntervalCongruenceKnownBitsDomain< Variable >;
+
+BOOST_AUTO_TEST_CASE(is_top_and_bottom) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x", 32, Signed));
+
+  BOOST_CHECK(IntervalCongruenceKnownBitsDomain::top().is_top());
+  BOOST_CHECK(!IntervalCongruenceKnownBitsDomain::top().is_bottom());
+
+  BOOST_CHECK(!IntervalCongruenceKnownBitsDomain::bottom().is_top());
+  BOOST_CHECK(IntervalCongruenceKnownBitsDomain::bottom().is_bottom());
+
+  IntervalCongruenceKnownBitsDomain inv;
+  BOOST_CHECK(inv.is_top());
+  BOOST_CHECK(!inv.is_bottom());
+
+  inv.assign(x, Int(1, 32, Signed));
+  BOOST_CHECK(!inv.is_top());
+  BOOST_CHECK(!inv.is_bottom());
+
+  inv.set(x, Interval::bottom(32, Signed));
+  BOOST_CHECK(!inv.is_top());
+  BOOST_CHECK(inv.is_bottom());
+}
+
+BOOST_AUTO_TEST_CASE(join_and_meet) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x", 32, Unsigned));
+
+  IntervalCongruenceKnownBitsDomain inv1;
+  inv1.assign(x, Int(4, 32, Unsigned));
+  IntervalCongruenceKnownBitsDomain inv2;
+  inv2.assign(x, Int(12, 32, Unsigned));
+
+  IntervalCongruenceKnownBitsDomain inv = inv1.join(inv2);
+  BOOST_CHECK(inv.to_interval(x) ==
+              Interval(Int(4, 32, Unsigned), Int(12, 32, Unsigned)));
+  BOOST_CHECK(inv.to_congruence(x) ==
+              Congruence(Int(8, 32, Unsigned), Int(4, 32, Unsigned)));
+  BOOST_CHECK(inv1.leq(inv));
+  BOOST_CHECK(inv2.leq(inv));
+  BOOST_CHECK(inv.meet(inv1) == inv1);
+  BOOST_CHECK(inv1.meet(inv2).is_bottom());
+}
+
+BOOST_AUTO_TEST_CASE(bitwise_mask) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x", 32, Unsigned));
+  Variable y(vfac.get("y", 32, Unsigned));
+  Variable z(vfac.get("z", 32, Unsigned));
+
+  IntervalCongruenceKnownBitsDomain inv;
+  inv.apply(BinaryOperator::And, y, x, Int(0xF0, 32, Unsigned));
+  BOOST_CHECK(inv.to_known_bits(y) ==
+              KnownBits(Int(0xFFFFFF0F, 32, Unsigned), Int(0, 32, Unsigned)));
+  BOOST_CHECK(inv.to_interval(y) ==
+              Interval(Int(0, 32, Unsigned), Int(0xF0, 32, Unsigned)));
+  BOOST_CHECK(inv.to_congruence(y) ==
+              Congruence(Int(16, 32, Unsigned), Int(0, 32, Unsigned)));
+
+  inv.apply(BinaryOperator::Or, z, y, Int(1, 32, Unsigned));
+  BOOST_CHECK(inv.to_interval(z) ==
+              Interval(Int(1, 32, Unsigned), Int(0xF1, 32, Unsigned)));
+  BOOST_CHECK(inv.to_congruence(z) ==
+              Congruence(Int(16, 32, Unsigned), Int(1, 32, Unsigned)));
+}
+
+BOOST_AUTO_TEST_CASE(reduction) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x", 32, Unsigned));
+  Variable y(vfac.get("y", 32, Unsigned));
+
+  // x in [0, 15] and x is odd
+  IntervalCongruenceKnownBitsDomain inv;
+  inv.set(x, IntervalCongruence(Interval(Int(0, 32, Unsigned),
+                                         Int(15, 32, Unsigned)),
+                                Congruence(Int(2, 32, Unsigned),
+                                           Int(1, 32, Unsigned))));
+  BOOST_CHECK(inv.to_known_bits(x) ==
+              KnownBits(Int(0xFFFFFFF0, 32, Unsigned), Int(1, 32, Unsigned)));
+
+  // y = x & 6 is even and at most 6
+  inv.apply(BinaryOperator::And, y, x, Int(6, 32, Unsigned));
+  BOOST_CHECK(inv.to_interval_congruence(y) ==
+              IntervalCongruence(Interval(Int(0, 32, Unsigned),
+                                          Int(6, 32, Unsigned)),
+                                 Congruence(Int(2, 32, Unsigned),
+                                            Int(0, 32, Unsigned))));
+
+  // x & 1 == 0 is unreachable
+  inv.apply(BinaryOperator::And, y, x, Int(1, 32, Unsigned));
+  inv.add(Predicate::EQ, y, Int(0, 32, Unsigned));
+  BOOST_CHECK(inv.is_bottom());
+}
+
+BOOST_AUTO_TEST_CASE(forget) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x", 32, Unsigned));
+
+  IntervalCongruenceKnownBitsDomain inv;
+  inv.assign(x, Int(4, 32, Unsigned));
+  inv.forget(x);
+  BOOST_CHECK(inv.is_top());
+  BOOST_CHECK(inv.to_known_bits(x).is_top());
+}
@@ -46,10 +46,18 @@
 #include <boost/test/output_test_stream.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <ikos/core/domain/machine_int/congruence.hpp>
 #include <ikos/core/domain/machine_int/interval.hpp>
+#include <ikos/core/domain/machine_int/numeric_domain_adapter.hpp>
 #include <ikos/core/domain/machine_int/polymorphic_domain.hpp>
+#include <ikos/core/domain/numeric/dbm.hpp>
+#include <ikos/core/domain/numeric/interval.hpp>
 #include <ikos/core/example/machine_int/variable_factory.hpp>
+#include <ikos/core/support/parallel.hpp>
 
 using Int = ikos::core::MachineInt;
 using Interval = ikos::core::machine_int::Interval;
@@ -67,6 +75,12 @@ using PolymorphicDomain =
     ikos::core::machine_int::PolymorphicDomain< Variable >;
 using IntervalDomain = ikos::core::machine_int::IntervalDomain< Variable >;
 using CongruenceDomain = ikos::core::machine_int::CongruenceDomain< Variable >;
+using AdaptedIntervalDomain = ikos::core::machine_int::NumericDomainAdapter<
+    Variable,
+    ikos::core::numeric::IntervalDomain< ikos::core::ZNumber, Variable > >;
+using AdaptedDBM = ikos::core::machine_int::NumericDomainAdapter<
+    Variable,
+    ikos::core::numeric::DBM< ikos::core::ZNumber, Variable > >;
 
 BOOST_AUTO_TEST_CASE(is_top_and_bottom) {
   VariableFactory vfac;
@@ -945,3 +959,110 @@ BOOST_AUTO_TEST_CASE(to_congruence) {
   BOOST_CHECK(inv.to_congruence(e2) ==
               Congruence(Int(4, 32, Signed), Int(2, 32, Signed)));
 }
+
+BOOST_AUTO_TEST_CASE(copy_on_write) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x", 32, Signed));
+  Variable y(vfac.get("y", 32, Signed));
+
+  PolymorphicDomain inv1(IntervalDomain::top());
+  inv1.set(x, Interval(Int(1, 32, Signed)));
+
+  PolymorphicDomain inv2 = inv1;
+  PolymorphicDomain inv3 = inv2;
+  BOOST_CHECK(inv1.equals(inv2));
+  BOOST_CHECK(inv2.leq(inv3));
+
+  inv2.set(y, Interval(Int(2, 32, Signed)));
+  BOOST_CHECK(inv1.to_interval(y) == Interval::top(32, Signed));
+  BOOST_CHECK(inv2.to_interval(y) == Interval(Int(2, 32, Signed)));
+  BOOST_CHECK(inv3.to_interval(y) == Interval::top(32, Signed));
+  BOOST_CHECK(inv2.leq(inv1));
+  BOOST_CHECK(!inv1.leq(inv2));
+
+  inv1.join_with(inv2);
+  BOOST_CHECK(inv1.equals(inv3));
+
+  inv3.meet_with(inv3);
+  BOOST_CHECK(inv3.to_interval(x) == Interval(Int(1, 32, Signed)));
+
+  inv3.set_to_bottom();
+  BOOST_CHECK(inv3.is_bottom());
+  BOOST_CHECK(!inv1.is_bottom());
+  BOOST_CHECK(inv1.to_interval(x) == Interval(Int(1, 32, Signed)));
+
+  inv1 = inv2;
+  inv2.forget(y);
+  BOOST_CHECK(inv1.to_interval(y) == Interval(Int(2, 32, Signed)));
+  BOOST_CHECK(inv2.to_interval(y) == Interval::top(32, Signed));
+}
+
+BOOST_AUTO_TEST_CASE(in_place_and_heap) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x", 32, Signed));
+
+  // IntervalDomain is stored in place, AdaptedIntervalDomain on the heap
+  PolymorphicDomain inv1(IntervalDomain::top());
+  inv1.set(x, Interval(Int(1, 32, Signed)));
+  PolymorphicDomain inv2(AdaptedIntervalDomain::top());
+  inv2.set(x, Interval(Int(2, 32, Signed)));
+
+  PolymorphicDomain inv3 = inv2;
+  inv3 = inv1;
+  inv3.set(x, Interval(Int(3, 32, Signed)));
+  BOOST_CHECK(inv1.to_interval(x) == Interval(Int(1, 32, Signed)));
+  BOOST_CHECK(inv3.to_interval(x) == Interval(Int(3, 32, Signed)));
+
+  inv3 = inv2;
+  inv3.set(x, Interval(Int(4, 32, Signed)));
+  BOOST_CHECK(inv2.to_interval(x) == Interval(Int(2, 32, Signed)));
+  BOOST_CHECK(inv3.to_interval(x) == Interval(Int(4, 32, Signed)));
+
+  PolymorphicDomain inv4 = std::move(inv1);
+  BOOST_CHECK(inv4.to_interval(x) == Interval(Int(1, 32, Signed)));
+  inv4 = std::move(inv3);
+  BOOST_CHECK(inv4.to_interval(x) == Interval(Int(4, 32, Signed)));
+  inv4 = PolymorphicDomain(IntervalDomain::top());
+  BOOST_CHECK(inv4.is_top());
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_reads) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x", 32, Signed));
+  Variable z = x;
+
+  // The DBM is stored on the heap, and normalized lazily
+  PolymorphicDomain inv(AdaptedDBM::top());
+  inv.set(x, Interval(Int(1, 32, Signed)));
+  for (int i = 0; i < 32; i++) {
+    Variable y(vfac.get("y" + std::to_string(i), 32, Signed));
+    inv.add(Predicate::LE, z, y);
+    z = y;
+  }
+
+  // Read the value and copy it from several threads
+  ikos::core::ConcurrentReads::enter();
+  std::vector< Interval > results(8, Interval::bottom(32, Signed));
+  std::vector< std::thread > threads;
+  for (std::size_t i = 0; i < results.size(); i++) {
+    threads.emplace_back([&inv, &results, z, i]() {
+      if (i % 2 == 0) {
+        inv.normalize();
+        results[i] = inv.to_interval(z);
+      } else {
+        PolymorphicDomain copy = inv;
+        copy.normalize();
+        results[i] = copy.to_interval(z);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  ikos::core::ConcurrentReads::exit();
+
+  Interval expected(Int(1, 32, Signed), Int::max(32, Signed));
+  for (const Interval& result : results) {
+    BOOST_CHECK(result == expected);
+  }
+}
@@ -712,6 +712,68 @@ BOOST_AUTO_TEST_CASE(add) {
   BOOST_CHECK(inv.is_bottom());
 }
 
+BOOST_AUTO_TEST_CASE(add_large_constants) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x"));
+  Variable y(vfac.get("y"));
+  Variable z(vfac.get("z"));
+
+  // Constants that do not fit the machine integer closure
+  ZNumber big = ZNumber(1) << 62;
+
+  DBM inv;
+  inv.add(VariableExpr(x) <= big);
+  inv.add(VariableExpr(y) <= VariableExpr(x) + 5);
+  inv.add(VariableExpr(z) <= VariableExpr(y) - big);
+  inv.normalize();
+  BOOST_CHECK(inv.to_interval(y) ==
+              Interval(Bound::minus_infinity(), Bound(big + 5)));
+  BOOST_CHECK(inv.to_interval(z) ==
+              Interval(Bound::minus_infinity(), Bound(5)));
+
+  inv.add(VariableExpr(z) >= 6);
+  BOOST_CHECK(inv.is_bottom());
+}
+
+BOOST_AUTO_TEST_CASE(add_incremental) {
+  VariableFactory vfac;
+  std::vector< Variable > vars;
+  for (int i = 0; i < 10; i++) {
+    vars.push_back(vfac.get("v" + std::to_string(i)));
+  }
+
+  DBM inv;
+  for (Variable v : vars) {
+    inv.add(VariableExpr(v) >= 0);
+    inv.add(VariableExpr(v) <= 10);
+  }
+  inv.normalize();
+
+  inv.add(VariableExpr(vars[0]) - VariableExpr(vars[1]) <= -5);
+  inv.normalize();
+  BOOST_CHECK(inv.to_interval(vars[0]) == Interval(Bound(0), Bound(5)));
+  BOOST_CHECK(inv.to_interval(vars[1]) == Interval(Bound(5), Bound(10)));
+
+  inv.add(VariableExpr(vars[1]) - VariableExpr(vars[2]) <= -3);
+  inv.add(VariableExpr(vars[3]) - VariableExpr(vars[0]) <= 0);
+  inv.normalize();
+  BOOST_CHECK(inv.to_interval(vars[0]) == Interval(Bound(0), Bound(2)));
+  BOOST_CHECK(inv.to_interval(vars[2]) == Interval(Bound(8), Bound(10)));
+  BOOST_CHECK(inv.to_interval(vars[3]) == Interval(Bound(0), Bound(2)));
+
+  inv.forget(vars[1]);
+  inv.add(VariableExpr(vars[3]) - VariableExpr(vars[4]) <= -9);
+  inv.normalize();
+  BOOST_CHECK(inv.to_interval(vars[0]) == Interval(Bound(0), Bound(2)));
+  BOOST_CHECK(inv.to_interval(vars[3]) == Interval(Bound(0), Bound(1)));
+  BOOST_CHECK(inv.to_interval(vars[4]) == Interval(Bound(9), Bound(10)));
+
+  inv.add(VariableExpr(vars[2]) <= 9);
+  BOOST_CHECK(!inv.is_bottom());
+  inv.add(VariableExpr(vars[0]) - VariableExpr(vars[2]) <= -10);
+  BOOST_CHECK(inv.is_bottom());
+}
+
 BOOST_AUTO_TEST_CASE(set) {
   VariableFactory vfac;
   Variable x(vfac.get("x"));
@@ -797,6 +859,51 @@ BOOST_AUTO_TEST_CASE(forget) {
   BOOST_CHECK(inv.is_top());
 }
 
+BOOST_AUTO_TEST_CASE(forget_reuse_and_compact) {
+  VariableFactory vfac;
+  std::vector< Variable > vars;
+  for (int i = 0; i < 40; i++) {
+    vars.push_back(vfac.get("v" + std::to_string(i)));
+  }
+
+  // Chain v0 <= v1 <= ... <= v19, with v0 >= 0 and v19 <= 100
+  DBM inv;
+  inv.add(VariableExpr(vars[0]) >= 0);
+  for (int i = 0; i < 19; i++) {
+    inv.add(VariableExpr(vars[i]) - VariableExpr(vars[i + 1]) <= -1);
+  }
+  inv.add(VariableExpr(vars[19]) <= 100);
+  inv.normalize();
+  BOOST_CHECK(inv.to_interval(vars[10]) == Interval(Bound(10), Bound(91)));
+
+  // Forgotten indexes are reused by new variables
+  inv.forget(vars[5]);
+  inv.add(VariableExpr(vars[20]) - VariableExpr(vars[10]) <= 0);
+  inv.add(VariableExpr(vars[20]) >= 0);
+  inv.normalize();
+  BOOST_CHECK(inv.to_interval(vars[5]) == Interval::top());
+  BOOST_CHECK(inv.to_interval(vars[20]) == Interval(Bound(0), Bound(91)));
+  BOOST_CHECK(inv.to_interval(vars[10]) == Interval(Bound(10), Bound(91)));
+
+  // Forgetting most variables compacts the matrix
+  for (int i = 1; i < 19; i++) {
+    if (i != 10) {
+      inv.forget(vars[i]);
+    }
+  }
+  inv.normalize();
+  BOOST_CHECK(inv.to_interval(vars[0]) == Interval(Bound(0), Bound(81)));
+  BOOST_CHECK(inv.to_interval(vars[10]) == Interval(Bound(10), Bound(91)));
+  BOOST_CHECK(inv.to_interval(vars[19]) == Interval(Bound(19), Bound(100)));
+  BOOST_CHECK(inv.to_interval(vars[20]) == Interval(Bound(0), Bound(91)));
+
+  for (int i = 21; i < 40; i++) {
+    inv.add(VariableExpr(vars[i]) - VariableExpr(vars[19]) <= i);
+  }
+  inv.add(VariableExpr(vars[39]) >= 200);
+  BOOST_CHECK(inv.is_bottom());
+}
+
 BOOST_AUTO_TEST_CASE(to_interval) {
   VariableFactory vfac;
   Variable x(vfac.get("x"));
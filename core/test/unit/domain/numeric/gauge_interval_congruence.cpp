@@ -57,6 +57,7 @@ using VariableExpression = ikos::core::VariableExpression< ZNumber, Variable >;
 using BinaryOperator = ikos::core::numeric::BinaryOperator;
 using ZConstant = ikos::core::numeric::ZConstant;
 using ZInterval = ikos::core::numeric::ZInterval;
+using ZCongruence = ikos::core::numeric::ZCongruence;
 using GaugeBound = ikos::core::numeric::GaugeBound< ZNumber, Variable >;
 using Gauge = ikos::core::numeric::Gauge< ZNumber, Variable >;
 using GaugeSemiLattice =
@@ -627,3 +628,27 @@ BOOST_AUTO_TEST_CASE(gauge_interval_congruence_domain_apply_var_var_num) {
                           w,
                           ZInterval(ZBound::minus_infinity(), ZBound(16)));
 }
+
+BOOST_AUTO_TEST_CASE(gauge_interval_congruence_domain_lazy_reduction) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x"));
+  Variable y(vfac.get("y"));
+
+  GaugeIntervalCongruenceDomain d1;
+  d1.refine(x, ZInterval(ZBound(1), ZBound(1)));
+  d1.refine(x, ZCongruence(ZNumber(2), ZNumber(0)));
+  test_domain(d1, true, false);
+
+  GaugeIntervalCongruenceDomain d2;
+  d2.refine(x, ZInterval(ZBound(0), ZBound(10)));
+  d2.refine(x, ZCongruence(ZNumber(4), ZNumber(0)));
+  d2.assign(y, x);
+  test_domain_to_interval(d2, y, ZInterval(ZBound(0), ZBound(8)));
+  BOOST_CHECK(d2.to_congruence(y) == ZCongruence(ZNumber(4), ZNumber(0)));
+
+  GaugeIntervalCongruenceDomain d3;
+  d3.refine(x, ZInterval(ZBound(0), ZBound(8)));
+  d3.refine(x, ZCongruence(ZNumber(4), ZNumber(0)));
+  BOOST_CHECK(d2.leq(d3));
+  BOOST_CHECK(d3.leq(d2.join(d3)));
+}
@@ -323,3 +323,72 @@ BOOST_AUTO_TEST_CASE(test_9) {
 
   // TODO(marthaud): Add checks
 }
+
+BOOST_AUTO_TEST_CASE(test_incremental_closure) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x"));
+  Variable y(vfac.get("y"));
+  Variable z(vfac.get("z"));
+
+  Octagon s1(Octagon::top());
+  s1.add(VariableExpr(x) >= 0);
+  s1.add(VariableExpr(y) <= 10);
+  s1.add(VariableExpr(z) <= 10);
+  s1.normalize();
+
+  s1.add(VariableExpr(x) - VariableExpr(y) <= -2);
+  s1.normalize();
+  BOOST_CHECK(s1.to_interval(y) == ZInterval(ZBound(2), ZBound(10)));
+  BOOST_CHECK(s1.to_interval(x) == ZInterval(ZBound(0), ZBound(8)));
+
+  s1.add(VariableExpr(y) + VariableExpr(z) <= 5);
+  s1.normalize();
+  BOOST_CHECK(s1.to_interval(x) == ZInterval(ZBound(0), ZBound(8)));
+  BOOST_CHECK(s1.to_interval(z) == ZInterval(ZBound::minus_infinity(),
+                                             ZBound(3)));
+
+  s1.add(VariableExpr(z) >= 0);
+  s1.normalize();
+  BOOST_CHECK(s1.to_interval(y) == ZInterval(ZBound(2), ZBound(5)));
+  BOOST_CHECK(s1.to_interval(x) == ZInterval(ZBound(0), ZBound(3)));
+
+  s1.add(VariableExpr(x) + VariableExpr(z) >= 4);
+  BOOST_CHECK(s1.is_bottom());
+}
+
+BOOST_AUTO_TEST_CASE(test_forget_reuse_and_compact) {
+  VariableFactory vfac;
+  std::vector< Variable > vars;
+  for (int i = 0; i < 20; i++) {
+    vars.push_back(vfac.get("v" + std::to_string(i)));
+  }
+
+  // v0 + v_i <= 10 and v_i >= 1, for all i > 0
+  Octagon s2(Octagon::top());
+  s2.add(VariableExpr(vars[0]) >= 0);
+  for (int i = 1; i < 10; i++) {
+    s2.add(VariableExpr(vars[0]) + VariableExpr(vars[i]) <= 10);
+    s2.add(VariableExpr(vars[i]) >= 1);
+  }
+  // Forgotten indexes are reused by new variables
+  s2.forget(vars[1]);
+  s2.add(VariableExpr(vars[10]) - VariableExpr(vars[2]) <= 0);
+  s2.normalize();
+  BOOST_CHECK(s2.to_interval(vars[1]) == ZInterval::top());
+  BOOST_CHECK(s2.to_interval(vars[0]) == ZInterval(ZBound(0), ZBound(9)));
+  BOOST_CHECK(s2.to_interval(vars[10]) ==
+              ZInterval(ZBound::minus_infinity(), ZBound(10)));
+
+  // Forgetting most variables compacts the matrix
+  for (int i = 2; i < 9; i++) {
+    s2.forget(vars[i]);
+  }
+  s2.normalize();
+  BOOST_CHECK(s2.to_interval(vars[0]) == ZInterval(ZBound(0), ZBound(9)));
+  BOOST_CHECK(s2.to_interval(vars[9]) == ZInterval(ZBound(1), ZBound(10)));
+  BOOST_CHECK(s2.to_interval(vars[10]) ==
+              ZInterval(ZBound::minus_infinity(), ZBound(10)));
+
+  s2.add(VariableExpr(vars[9]) <= 0);
+  BOOST_CHECK(s2.is_bottom());
+}
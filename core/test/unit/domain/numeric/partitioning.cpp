@@ -0,0 +1,161 @@
+/*******************************************************************************
+ *
+ * Tests for PartitioningDomain
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_partitioning_domain
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <ikos/core/domain/numeric/interval.hpp>
+#include <ikos/core/domain/numeric/partitioning.hpp>
+#include <ikos/core/example/variable_factory.hpp>
+#include <ikos/core/number/z_number.hpp>
+
+using ZNumber = ikos::core::ZNumber;
+using VariableFactory = ikos::core::example::VariableFactory;
+using Variable = ikos::core::example::VariableFactory::VariableRef;
+using VariableExpr = ikos::core::VariableExpression< ZNumber, Variable >;
+using Bound = ikos::core::ZBound;
+using Interval = ikos::core::numeric::ZInterval;
+using IntervalDomain = ikos::core::numeric::IntervalDomain< ZNumber, Variable >;
+using PartitioningDomain = ikos::core::numeric::
+    PartitioningDomain< ZNumber, Variable, IntervalDomain, 3 >;
+
+BOOST_AUTO_TEST_CASE(is_top_and_bottom) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x"));
+
+  BOOST_CHECK(PartitioningDomain::top().is_top());
+  BOOST_CHECK(!PartitioningDomain::top().is_bottom());
+
+  BOOST_CHECK(!PartitioningDomain::bottom().is_top());
+  BOOST_CHECK(PartitioningDomain::bottom().is_bottom());
+
+  PartitioningDomain inv;
+  inv.partition_on(x);
+  BOOST_CHECK(inv.is_top());
+  BOOST_CHECK(!inv.is_bottom());
+
+  inv.assign(x, 1);
+  BOOST_CHECK(!inv.is_top());
+  BOOST_CHECK(!inv.is_bottom());
+
+  inv.set(x, Interval::bottom());
+  BOOST_CHECK(!inv.is_top());
+  BOOST_CHECK(inv.is_bottom());
+}
+
+BOOST_AUTO_TEST_CASE(join) {
+  VariableFactory vfac;
+  Variable flag(vfac.get("flag"));
+  Variable x(vfac.get("x"));
+
+  PartitioningDomain inv_a, inv_b;
+  inv_a.partition_on(flag);
+  inv_a.assign(flag, 0);
+  inv_a.assign(x, 0);
+  inv_b.partition_on(flag);
+  inv_b.assign(flag, 1);
+  inv_b.assign(x, 10);
+
+  PartitioningDomain inv = inv_a.join(inv_b);
+  BOOST_CHECK(inv.num_disjuncts() == 2);
+  BOOST_CHECK(inv.to_interval(x) == Interval(Bound(0), Bound(10)));
+  BOOST_CHECK(inv_a.leq(inv));
+  BOOST_CHECK(inv_b.leq(inv));
+  BOOST_CHECK(!inv.leq(inv_a));
+
+  // The relation between flag and x is kept
+  inv.add(VariableExpr(flag) == 1);
+  BOOST_CHECK(inv.to_interval(x) == Interval(10));
+
+  // Disjuncts with the same key are joined
+  inv_b.assign(x, 20);
+  inv = inv_a.join(inv_b).join(inv_b);
+  BOOST_CHECK(inv.num_disjuncts() == 2);
+  inv.add(VariableExpr(flag) == 1);
+  BOOST_CHECK(inv.to_interval(x) == Interval(20));
+}
+
+BOOST_AUTO_TEST_CASE(max_disjuncts) {
+  VariableFactory vfac;
+  Variable flag(vfac.get("flag"));
+  Variable x(vfac.get("x"));
+
+  PartitioningDomain inv = PartitioningDomain::bottom();
+  for (int i = 0; i < 5; i++) {
+    PartitioningDomain d;
+    d.partition_on(flag);
+    d.assign(flag, i);
+    d.assign(x, 10 * i);
+    inv.join_with(d);
+    BOOST_CHECK(inv.num_disjuncts() <= 3);
+  }
+  BOOST_CHECK(inv.to_interval(x) == Interval(Bound(0), Bound(40)));
+  BOOST_CHECK(inv.to_interval(flag) == Interval(Bound(0), Bound(4)));
+}
+
+BOOST_AUTO_TEST_CASE(widening) {
+  VariableFactory vfac;
+  Variable flag(vfac.get("flag"));
+  Variable x(vfac.get("x"));
+
+  PartitioningDomain inv_a, inv_b;
+  inv_a.partition_on(flag);
+  inv_a.assign(flag, 0);
+  inv_a.assign(x, 0);
+  inv_b = inv_a;
+  inv_b.assign(x, 1);
+
+  // Same partitions: widening per partition
+  PartitioningDomain inv = inv_a.widening(inv_b);
+  BOOST_CHECK(inv.num_disjuncts() == 1);
+  BOOST_CHECK(inv.to_interval(flag) == Interval(0));
+  BOOST_CHECK(inv.to_interval(x) ==
+              Interval(Bound(0), Bound::plus_infinity()));
+
+  // New partition: partitions are collapsed
+  inv_b.assign(flag, 1);
+  inv = inv_a.widening(inv_a.join(inv_b));
+  BOOST_CHECK(inv.num_disjuncts() == 1);
+  BOOST_CHECK(inv.to_interval(flag) ==
+              Interval(Bound(0), Bound::plus_infinity()));
+}
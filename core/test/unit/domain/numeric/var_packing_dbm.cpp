@@ -46,6 +46,10 @@
 #include <boost/test/output_test_stream.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <ikos/core/domain/numeric/var_packing_dbm.hpp>
 #include <ikos/core/example/variable_factory.hpp>
 
@@ -888,3 +892,42 @@ BOOST_AUTO_TEST_CASE(to_interval_congruence) {
                                          3 * VariableExpr(y) + 1) ==
               IntervalCongruence(Interval(Bound(-9), Bound(-4))));
 }
+
+BOOST_AUTO_TEST_CASE(concurrent_copies) {
+  VariableFactory vfac;
+  std::vector< Variable > vars;
+  for (int i = 0; i < 16; i++) {
+    vars.push_back(vfac.get("v" + std::to_string(i)));
+  }
+
+  // Merge the packs pairwise, so that the paths have several steps
+  VarPackingDBM inv;
+  inv.set(vars[0], Interval(Bound(0), Bound(10)));
+  for (std::size_t step = 1; step < vars.size(); step *= 2) {
+    for (std::size_t i = 0; i + step < vars.size(); i += 2 * step) {
+      inv.add(VariableExpr(vars[i]) - VariableExpr(vars[i + step]) <= -1);
+    }
+  }
+  inv.normalize();
+
+  // Copies share the equivalence relation and the packs, and are written and
+  // read by several threads
+  std::vector< Interval > results(8, Interval::bottom());
+  std::vector< std::thread > threads;
+  for (std::size_t i = 0; i < results.size(); i++) {
+    threads.emplace_back([&inv, &vars, &results, i]() {
+      VarPackingDBM copy = inv;
+      copy.add(VariableExpr(vars[15]) <= ZNumber(100 + i));
+      results[i] = copy.to_interval(vars[15]);
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (std::size_t i = 0; i < results.size(); i++) {
+    BOOST_CHECK(results[i] == Interval(Bound(4), Bound(100 + i)));
+  }
+  BOOST_CHECK(inv.to_interval(vars[15]) ==
+              Interval(Bound(4), Bound::plus_infinity()));
+}
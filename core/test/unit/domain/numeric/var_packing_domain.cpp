@@ -54,6 +54,8 @@ using ZNumber = ikos::core::ZNumber;
 using VariableFactory = ikos::core::example::VariableFactory;
 using Variable = ikos::core::example::VariableFactory::VariableRef;
 using VariableExpr = ikos::core::VariableExpression< ZNumber, Variable >;
+using LinearConstraintSystem =
+    ikos::core::LinearConstraintSystem< ZNumber, Variable >;
 using BinaryOperator = ikos::core::numeric::BinaryOperator;
 using Bound = ikos::core::ZBound;
 using Interval = ikos::core::numeric::ZInterval;
@@ -355,6 +357,38 @@ BOOST_AUTO_TEST_CASE(join) {
   BOOST_CHECK((inv1.join(inv2) == inv3));
 }
 
+BOOST_AUTO_TEST_CASE(join_same_partition) {
+  VariableFactory vfac;
+  Variable x(vfac.get("x"));
+  Variable y(vfac.get("y"));
+  Variable z(vfac.get("z"));
+
+  VarPackingDomain inv1;
+  inv1.set(x, Interval(Bound(0), Bound(10)));
+  inv1.add(VariableExpr(y) <= VariableExpr(x));
+  inv1.set(z, Interval(Bound(0), Bound(10)));
+
+  // Copies share their packs until written
+  VarPackingDomain inv2 = inv1;
+  inv2.refine(z, Interval(Bound(0), Bound(5)));
+  BOOST_CHECK(inv1.to_interval(z) == Interval(Bound(0), Bound(10)));
+  BOOST_CHECK(inv2.to_interval(z) == Interval(Bound(0), Bound(5)));
+  BOOST_CHECK(inv2.leq(inv1));
+  BOOST_CHECK(!inv1.leq(inv2));
+
+  VarPackingDomain inv3 = inv1.join(inv2);
+  BOOST_CHECK(inv3 == inv1);
+  BOOST_CHECK(inv3.to_interval(z) == Interval(Bound(0), Bound(10)));
+  inv3.add(VariableExpr(x) <= 3);
+  inv3.normalize();
+  BOOST_CHECK(inv3.to_interval(y) ==
+              Interval(Bound::minus_infinity(), Bound(3)));
+  BOOST_CHECK(inv1.to_interval(x) == Interval(Bound(0), Bound(10)));
+
+  VarPackingDomain inv4 = inv2.meet(inv1);
+  BOOST_CHECK(inv4 == inv2);
+}
+
 BOOST_AUTO_TEST_CASE(widening) {
   VariableFactory vfac;
   Variable x(vfac.get("x"));
@@ -764,6 +798,23 @@ BOOST_AUTO_TEST_CASE(add) {
   inv.add(VariableExpr(x) + VariableExpr(y) >= 0);
   inv.add(VariableExpr(x) - VariableExpr(y) >= 3);
   BOOST_CHECK(inv.is_bottom());
+
+  inv.set_to_top();
+  LinearConstraintSystem csts;
+  csts.add(VariableExpr(x) >= 1);
+  csts.add(VariableExpr(z) <= 4);
+  csts.add(VariableExpr(y) >= VariableExpr(x) + 2);
+  csts.add(VariableExpr(w) <= VariableExpr(z));
+  inv.add(csts);
+  inv.normalize();
+  BOOST_CHECK(inv.to_interval(y) == Interval(Bound(3), Bound::plus_infinity()));
+  BOOST_CHECK(inv.to_interval(w) ==
+              Interval(Bound::minus_infinity(), Bound(4)));
+
+  csts.add(VariableExpr(y) + 2 <= VariableExpr(w));
+  inv.add(csts);
+  inv.normalize();
+  BOOST_CHECK(inv.is_bottom());
 }
 
 BOOST_AUTO_TEST_CASE(set) {
@@ -352,3 +352,130 @@ BOOST_AUTO_TEST_CASE(test_4) {
                                                      Uninitialized::top()));
   BOOST_CHECK(s.get_memory(nrows) == PointerAbsValue::bottom(64, Unsigned));
 }
+
+BOOST_AUTO_TEST_CASE(test_5) {
+  // Cycle of copies:
+  //
+  // p = &x;
+  // q = p;
+  // r = q;
+  // p = r;
+  // *q = &y;
+  // s = *r;
+  // t = s + 4;
+
+  VariableFactory vfac;
+  MemoryFactory memfac;
+
+  Variable p(vfac.get("p"));
+  Variable q(vfac.get("q"));
+  Variable r(vfac.get("r"));
+  Variable s(vfac.get("s"));
+  Variable t(vfac.get("t"));
+
+  MemLocation x(memfac.get("x"));
+  MemLocation y(memfac.get("y"));
+
+  ConstraintSystem cs(64, Unsigned);
+  Interval zero(Int(0, 64, Unsigned));
+
+  cs.add(Assign::create(p, AddrOperand::create(x, zero)));
+  cs.add(Assign::create(q, VarOperand::create(p, zero)));
+  cs.add(Assign::create(r, VarOperand::create(q, zero)));
+  cs.add(Assign::create(p, VarOperand::create(r, zero)));
+  cs.add(Store::create(q, AddrOperand::create(y, zero)));
+  cs.add(Load::create(s, VarOperand::create(r, zero)));
+  cs.add(Assign::create(t,
+                        VarOperand::create(s, Interval(Int(4, 64, Unsigned)))));
+
+  cs.solve();
+
+  PointerAbsValue px(PointsToSet{x}, zero, Nullity::top(), Uninitialized());
+  BOOST_CHECK(cs.get_pointer(p) == px);
+  BOOST_CHECK(cs.get_pointer(q) == px);
+  BOOST_CHECK(cs.get_pointer(r) == px);
+
+  std::size_t count = 0;
+  for (auto it = cs.pointer_begin(), et = cs.pointer_end(); it != et; ++it) {
+    count++;
+  }
+  BOOST_CHECK(count == 5);
+
+  BOOST_CHECK(cs.get_memory(x) ==
+              PointerAbsValue(PointsToSet{y},
+                              zero,
+                              Nullity::top(),
+                              Uninitialized::top()));
+  BOOST_CHECK(cs.get_pointer(s) == cs.get_memory(x));
+  BOOST_CHECK(cs.get_pointer(t) ==
+              PointerAbsValue(PointsToSet{y},
+                              Interval(Int(4, 64, Unsigned)),
+                              Nullity::top(),
+                              Uninitialized::top()));
+}
+
+BOOST_AUTO_TEST_CASE(test_6) {
+  // Loop with pointer arithmetic:
+  //
+  // p = &x;
+  // q = p + 4;
+  // p = q;
+
+  VariableFactory vfac;
+  MemoryFactory memfac;
+
+  Variable p(vfac.get("p"));
+  Variable q(vfac.get("q"));
+
+  MemLocation x(memfac.get("x"));
+
+  ConstraintSystem cs(64, Unsigned);
+  Interval zero(Int(0, 64, Unsigned));
+
+  cs.add(Assign::create(p, AddrOperand::create(x, zero)));
+  cs.add(Assign::create(q,
+                        VarOperand::create(p, Interval(Int(4, 64, Unsigned)))));
+  cs.add(Assign::create(p, VarOperand::create(q, zero)));
+
+  cs.solve();
+
+  BOOST_CHECK(cs.get_pointer(p).points_to() == PointsToSet{x});
+  BOOST_CHECK(cs.get_pointer(p).offset().lb() == Int(0, 64, Unsigned));
+  BOOST_CHECK(cs.get_pointer(p).offset().ub() == Int::max(64, Unsigned));
+}
+
+BOOST_AUTO_TEST_CASE(test_offset_insensitive) {
+  // Same loop as test_6, solved without offsets:
+  //
+  // p = &x;
+  // q = p + 4;
+  // p = q;
+  // *p = &y;
+
+  VariableFactory vfac;
+  MemoryFactory memfac;
+
+  Variable p(vfac.get("p"));
+  Variable q(vfac.get("q"));
+
+  MemLocation x(memfac.get("x"));
+  MemLocation y(memfac.get("y"));
+
+  ConstraintSystem cs(64, Unsigned);
+  Interval zero(Int(0, 64, Unsigned));
+
+  cs.add(Assign::create(p, AddrOperand::create(x, zero)));
+  cs.add(Assign::create(q,
+                        VarOperand::create(p, Interval(Int(4, 64, Unsigned)))));
+  cs.add(Assign::create(p, VarOperand::create(q, zero)));
+  cs.add(Store::create(p, AddrOperand::create(y, zero)));
+
+  cs.solve(/*widening_threshold = */ 50, /*track_offsets = */ false);
+
+  BOOST_CHECK(cs.get_pointer(p).points_to() == PointsToSet{x});
+  BOOST_CHECK(cs.get_pointer(p).offset().is_top());
+  BOOST_CHECK(cs.get_pointer(q).points_to() == PointsToSet{x});
+  BOOST_CHECK(cs.get_pointer(q).offset().is_top());
+  BOOST_CHECK(cs.get_memory(x).points_to() == PointsToSet{y});
+  BOOST_CHECK(cs.get_memory(x).offset().is_top());
+}
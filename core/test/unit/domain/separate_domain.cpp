@@ -0,0 +1,107 @@
+/*******************************************************************************
+ *
+ * Tests for SeparateDomain
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_separate_domain
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+#include <ikos/core/domain/separate_domain.hpp>
+#include <ikos/core/example/variable_factory.hpp>
+#include <ikos/core/value/nullity.hpp>
+
+using VariableFactory = ikos::core::example::VariableFactory;
+using Variable = ikos::core::example::VariableFactory::VariableRef;
+using Nullity = ikos::core::Nullity;
+using SeparateDomain = ikos::core::SeparateDomain< Variable, Nullity >;
+
+BOOST_AUTO_TEST_CASE(dense_representation) {
+  VariableFactory vfac;
+  std::vector< Variable > vars;
+  for (int i = 0; i < 100; i++) {
+    vars.push_back(vfac.get("x" + std::to_string(i)));
+  }
+
+  SeparateDomain inv;
+  for (int i = 0; i < 16; i++) {
+    inv.set(vars[i], Nullity::null());
+  }
+  BOOST_CHECK(!inv.is_dense());
+
+  for (int i = 16; i < 64; i++) {
+    inv.set(vars[i], Nullity::non_null());
+  }
+  BOOST_CHECK(inv.is_dense());
+  BOOST_CHECK(inv.get(vars[3]) == Nullity::null());
+  BOOST_CHECK(inv.get(vars[40]) == Nullity::non_null());
+  BOOST_CHECK(inv.get(vars[80]).is_top());
+
+  // Mixed representations
+  SeparateDomain sparse;
+  sparse.set(vars[3], Nullity::null());
+  sparse.set(vars[40], Nullity::null());
+  BOOST_CHECK(!sparse.is_dense());
+  BOOST_CHECK(inv.leq(sparse) == false);
+  BOOST_CHECK(sparse.join(inv).get(vars[3]) == Nullity::null());
+  BOOST_CHECK(sparse.join(inv).get(vars[40]).is_top());
+
+  SeparateDomain joined = inv.join(sparse);
+  BOOST_CHECK(joined.get(vars[3]) == Nullity::null());
+  BOOST_CHECK(joined.get(vars[40]).is_top());
+  BOOST_CHECK(!joined.is_dense());
+
+  BOOST_CHECK(inv.meet(sparse).is_bottom());
+  SeparateDomain copy = inv;
+  BOOST_CHECK(copy.equals(inv));
+  copy.set(vars[40], Nullity::null());
+  BOOST_CHECK(!copy.equals(inv));
+  BOOST_CHECK(inv.get(vars[40]) == Nullity::non_null());
+
+  // Back to a patricia tree when most keys are forgotten
+  for (int i = 0; i < 60; i++) {
+    inv.forget(vars[i]);
+  }
+  BOOST_CHECK(!inv.is_dense());
+  BOOST_CHECK(inv.get(vars[61]) == Nullity::non_null());
+  BOOST_CHECK(inv.get(vars[3]).is_top());
+}
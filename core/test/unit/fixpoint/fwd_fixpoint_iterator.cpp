@@ -0,0 +1,474 @@
+/*******************************************************************************
+ *
+ * Tests for InterleavedFwdFixpointIterator
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_fwd_fixpoint_iterator
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ikos/core/domain/discrete_domain.hpp>
+#include <ikos/core/domain/numeric/dbm.hpp>
+#include <ikos/core/domain/numeric/var_packing_domain.hpp>
+#include <ikos/core/example/muzq.hpp>
+#include <ikos/core/example/variable_factory.hpp>
+#include <ikos/core/fixpoint/fwd_fixpoint_iterator.hpp>
+
+using namespace ikos::core;
+
+using VariableFactory = example::VariableFactory;
+using Variable = example::VariableFactory::VariableRef;
+using VariableSet = DiscreteDomain< Variable >;
+using BasicBlock = muzq::BasicBlock< Variable >;
+using ControlFlowGraph = muzq::ControlFlowGraph< Variable >;
+using Statement = muzq::Statement< Variable >;
+using ZVarExpr = VariableExpression< ZNumber, Variable >;
+using ZLinearExpression = LinearExpression< ZNumber, Variable >;
+using ZLinearAssignment = muzq::ZLinearAssignment< Variable >;
+using ZLinearAssertion = muzq::ZLinearAssertion< Variable >;
+using DBM = numeric::DBM< ZNumber, Variable >;
+using VarPackingDBM = numeric::VarPackingDomain< ZNumber, Variable, DBM >;
+
+/// \brief Fixpoint iterator collecting the names of the visited blocks
+class VisitedBlocks final
+    : public InterleavedFwdFixpointIterator< ControlFlowGraph*, VariableSet > {
+private:
+  VariableFactory& _vfac;
+
+public:
+  std::map< std::string, VariableSet > pre_map;
+  std::map< std::string, VariableSet > post_map;
+
+public:
+  VisitedBlocks(ControlFlowGraph* cfg, VariableFactory& vfac)
+      : InterleavedFwdFixpointIterator(cfg), _vfac(vfac) {}
+
+  VisitedBlocks(ControlFlowGraph* cfg, WtoT wto, VariableFactory& vfac)
+      : InterleavedFwdFixpointIterator(cfg, std::move(wto)), _vfac(vfac) {}
+
+  VariableSet analyze_node(BasicBlock* bb, VariableSet inv) override {
+    inv.add(this->_vfac.get(bb->name()));
+    return inv;
+  }
+
+  VariableSet analyze_edge(BasicBlock*,
+                           BasicBlock*,
+                           VariableSet inv) override {
+    return inv;
+  }
+
+  void process_pre(BasicBlock* bb, const VariableSet& inv) override {
+    this->pre_map.emplace(bb->name(), inv);
+  }
+
+  void process_post(BasicBlock* bb, const VariableSet& inv) override {
+    this->post_map.emplace(bb->name(), inv);
+  }
+};
+
+BOOST_AUTO_TEST_CASE(run_and_process) {
+  ControlFlowGraph cfg("entry");
+  BasicBlock* entry = cfg.get("entry");
+  BasicBlock* head = cfg.get("head");
+  BasicBlock* body = cfg.get("body");
+  BasicBlock* body2 = cfg.get("body2");
+  BasicBlock* exit = cfg.get("exit");
+
+  entry->add_successor(head);
+  head->add_successor(body);
+  body->add_successor(body2);
+  body2->add_successor(head);
+  head->add_successor(exit);
+  entry->add_successor(exit);
+
+  VariableFactory vfac;
+
+  VisitedBlocks full(&cfg, vfac);
+  full.run(VariableSet::bottom());
+
+  VisitedBlocks fused(&cfg, vfac);
+  fused.run_and_process(VariableSet::bottom());
+
+  BOOST_CHECK(full.pre_map.size() == 5);
+  BOOST_CHECK(fused.pre_map.size() == 5);
+  for (const auto& entry : full.pre_map) {
+    BOOST_CHECK(fused.pre_map.at(entry.first).equals(entry.second));
+  }
+  for (const auto& entry : full.post_map) {
+    BOOST_CHECK(fused.post_map.at(entry.first).equals(entry.second));
+  }
+
+  BOOST_CHECK(fused.post_map.at("exit").contains(vfac.get("body2")));
+  BOOST_CHECK(fused.post_map.at("exit").contains(vfac.get("exit")));
+
+  // Invariants are dropped
+  BOOST_CHECK(fused.pre(exit).is_bottom());
+  BOOST_CHECK(fused.post(head).is_bottom());
+  BOOST_CHECK(!full.pre(exit).is_bottom());
+}
+
+BOOST_AUTO_TEST_CASE(prebuilt_wto) {
+  ControlFlowGraph cfg("entry");
+  BasicBlock* entry = cfg.get("entry");
+  BasicBlock* head = cfg.get("head");
+  BasicBlock* body = cfg.get("body");
+  BasicBlock* exit = cfg.get("exit");
+
+  entry->add_successor(head);
+  head->add_successor(body);
+  body->add_successor(head);
+  head->add_successor(exit);
+
+  VariableFactory vfac;
+  Wto< ControlFlowGraph* > wto(&cfg);
+
+  VisitedBlocks first(&cfg, wto, vfac);
+  first.run(VariableSet::bottom());
+
+  VisitedBlocks second(&cfg, wto, vfac);
+  second.run(VariableSet::bottom());
+
+  VisitedBlocks fresh(&cfg, vfac);
+  fresh.run(VariableSet::bottom());
+
+  BOOST_CHECK(first.pre_map.size() == 4);
+  for (const auto& entry : fresh.pre_map) {
+    BOOST_CHECK(first.pre_map.at(entry.first).equals(entry.second));
+    BOOST_CHECK(second.pre_map.at(entry.first).equals(entry.second));
+  }
+  BOOST_CHECK(first.post(exit).contains(vfac.get("body")));
+}
+
+BOOST_AUTO_TEST_CASE(run_concurrent) {
+  ControlFlowGraph cfg("entry");
+  BasicBlock* entry = cfg.get("entry");
+  BasicBlock* merge = cfg.get("merge");
+  BasicBlock* exit = cfg.get("exit");
+
+  VariableFactory vfac;
+  vfac.get("entry");
+  vfac.get("merge");
+  vfac.get("exit");
+
+  // Switch with independent branches, some of them containing a loop
+  for (int i = 0; i < 8; i++) {
+    std::string name = "case" + std::to_string(i);
+    BasicBlock* head = cfg.get(name);
+    entry->add_successor(head);
+    vfac.get(name);
+    if (i % 2 == 0) {
+      BasicBlock* body = cfg.get(name + ".body");
+      head->add_successor(body);
+      body->add_successor(head);
+      vfac.get(name + ".body");
+    }
+    head->add_successor(merge);
+  }
+  merge->add_successor(exit);
+
+  VisitedBlocks sequential(&cfg, vfac);
+  sequential.run(VariableSet::bottom());
+
+  VisitedBlocks concurrent(&cfg, vfac);
+  concurrent.run_concurrent(VariableSet::bottom(), 4);
+
+  BOOST_CHECK(sequential.pre_map.size() == 15);
+  BOOST_CHECK(concurrent.pre_map.size() == 15);
+  for (const auto& entry : sequential.pre_map) {
+    BOOST_CHECK(concurrent.pre_map.at(entry.first).equals(entry.second));
+  }
+  for (const auto& entry : sequential.post_map) {
+    BOOST_CHECK(concurrent.post_map.at(entry.first).equals(entry.second));
+  }
+
+  BOOST_CHECK(concurrent.post(exit).contains(vfac.get("case3")));
+  BOOST_CHECK(concurrent.post(exit).contains(vfac.get("case6.body")));
+}
+
+/// \brief Fixpoint iterator on linear assignments and assertions, using a
+/// domain normalized lazily
+class PackedBlocks final
+    : public InterleavedFwdFixpointIterator< ControlFlowGraph*,
+                                             VarPackingDBM > {
+public:
+  std::map< std::string, VarPackingDBM > pre_map;
+  std::map< std::string, VarPackingDBM > post_map;
+
+public:
+  explicit PackedBlocks(ControlFlowGraph* cfg)
+      : InterleavedFwdFixpointIterator(cfg) {}
+
+  VarPackingDBM analyze_node(BasicBlock* bb, VarPackingDBM inv) override {
+    for (Statement* stmt : *bb) {
+      if (auto assign = dyn_cast< ZLinearAssignment >(stmt)) {
+        inv.assign(assign->result(), assign->operand());
+      } else if (auto assert = dyn_cast< ZLinearAssertion >(stmt)) {
+        inv.add(assert->constraint());
+      }
+    }
+    return inv;
+  }
+
+  VarPackingDBM analyze_edge(BasicBlock*,
+                             BasicBlock*,
+                             VarPackingDBM inv) override {
+    return inv;
+  }
+
+  void process_pre(BasicBlock* bb, const VarPackingDBM& inv) override {
+    this->pre_map.emplace(bb->name(), inv);
+  }
+
+  void process_post(BasicBlock* bb, const VarPackingDBM& inv) override {
+    this->post_map.emplace(bb->name(), inv);
+  }
+};
+
+BOOST_AUTO_TEST_CASE(run_concurrent_var_packing) {
+  ControlFlowGraph cfg("entry");
+  BasicBlock* entry = cfg.get("entry");
+  BasicBlock* merge = cfg.get("merge");
+
+  VariableFactory vfac;
+  Variable n(vfac.get("n"));
+  Variable i(vfac.get("i"));
+  Variable j(vfac.get("j"));
+  Variable k(vfac.get("k"));
+
+  // The post invariant of the entry is read by all the branches
+  entry->add(std::make_unique< ZLinearAssignment >(n, ZLinearExpression(100)));
+  entry->add(std::make_unique< ZLinearAssignment >(k, ZVarExpr(n) + 1));
+  entry->add(std::make_unique< ZLinearAssignment >(i, ZLinearExpression(0)));
+  entry->add(std::make_unique< ZLinearAssertion >(ZVarExpr(i) <= ZVarExpr(j)));
+  entry->add(std::make_unique< ZLinearAssertion >(ZVarExpr(j) <= ZVarExpr(k)));
+
+  // Switch with independent loops
+  for (int c = 0; c < 16; c++) {
+    std::string name = "case" + std::to_string(c);
+    BasicBlock* head = cfg.get(name);
+    BasicBlock* body = cfg.get(name + ".body");
+    BasicBlock* exit = cfg.get(name + ".exit");
+    entry->add_successor(head);
+    head->add_successor(body);
+    head->add_successor(exit);
+    body->add_successor(head);
+    exit->add_successor(merge);
+    body->add(std::make_unique< ZLinearAssertion >(ZVarExpr(i) <= ZVarExpr(n)));
+    body->add(std::make_unique< ZLinearAssignment >(i, ZVarExpr(i) + (c + 1)));
+    exit->add(std::make_unique< ZLinearAssertion >(ZVarExpr(i) >= ZVarExpr(n)));
+  }
+
+  PackedBlocks sequential(&cfg);
+  sequential.run(VarPackingDBM::top());
+
+  PackedBlocks concurrent(&cfg);
+  concurrent.run_concurrent(VarPackingDBM::top(), 8);
+
+  BOOST_CHECK(sequential.pre_map.size() == 50);
+  BOOST_CHECK(concurrent.pre_map.size() == 50);
+  for (const auto& entry : sequential.pre_map) {
+    BOOST_CHECK(concurrent.pre_map.at(entry.first).equals(entry.second));
+  }
+  for (const auto& entry : sequential.post_map) {
+    BOOST_CHECK(concurrent.post_map.at(entry.first).equals(entry.second));
+  }
+
+  BOOST_CHECK(concurrent.pre(merge).to_interval(k) == numeric::ZInterval(101));
+}
+
+/// \brief Fixpoint tracer recording the events, and checking their nesting
+class RecordingTracer final : public FixpointTracer< BasicBlock* > {
+public:
+  std::vector< std::pair< FixpointEvent, std::string > > begins;
+  std::vector< std::pair< FixpointEvent, BasicBlock* > > stack;
+
+public:
+  void begin(FixpointEvent event, BasicBlock* node, unsigned) override {
+    this->begins.emplace_back(event, node->name());
+    this->stack.emplace_back(event, node);
+  }
+
+  void end(FixpointEvent event, BasicBlock* node, unsigned) override {
+    BOOST_REQUIRE(!this->stack.empty());
+    BOOST_CHECK(this->stack.back().first == event);
+    BOOST_CHECK(this->stack.back().second == node);
+    this->stack.pop_back();
+  }
+
+  std::size_t count(FixpointEvent event, const std::string& name) const {
+    return static_cast< std::size_t >(
+        std::count(this->begins.begin(),
+                   this->begins.end(),
+                   std::make_pair(event, name)));
+  }
+};
+
+BOOST_AUTO_TEST_CASE(tracer) {
+  ControlFlowGraph cfg("entry");
+  BasicBlock* entry = cfg.get("entry");
+  BasicBlock* head = cfg.get("head");
+  BasicBlock* body = cfg.get("body");
+  BasicBlock* exit = cfg.get("exit");
+
+  entry->add_successor(head);
+  head->add_successor(body);
+  body->add_successor(head);
+  head->add_successor(exit);
+
+  VariableFactory vfac;
+  RecordingTracer tracer;
+
+  VisitedBlocks traced(&cfg, vfac);
+  traced.set_tracer(&tracer);
+  traced.run(VariableSet::bottom());
+
+  VisitedBlocks untraced(&cfg, vfac);
+  untraced.run(VariableSet::bottom());
+
+  BOOST_CHECK(tracer.stack.empty());
+  BOOST_CHECK(tracer.count(FixpointEvent::Node, "entry") == 1);
+  BOOST_CHECK(tracer.count(FixpointEvent::Node, "exit") == 1);
+  BOOST_CHECK(tracer.count(FixpointEvent::Cycle, "head") == 1);
+  BOOST_CHECK(tracer.count(FixpointEvent::IncreasingIteration, "head") >= 1);
+  BOOST_CHECK(tracer.count(FixpointEvent::Extrapolate, "head") >= 1);
+  BOOST_CHECK(tracer.count(FixpointEvent::Refine, "head") >= 1);
+  BOOST_CHECK(tracer.count(FixpointEvent::Node, "head") ==
+              tracer.count(FixpointEvent::IncreasingIteration, "head") +
+                  tracer.count(FixpointEvent::DecreasingIteration, "head"));
+  BOOST_CHECK(tracer.count(FixpointEvent::Node, "body") ==
+              tracer.count(FixpointEvent::Node, "head"));
+
+  for (const auto& entry : untraced.pre_map) {
+    BOOST_CHECK(traced.pre_map.at(entry.first).equals(entry.second));
+  }
+}
+
+/// \brief Fixpoint iterator adding the name of each block and its extra
+/// variables, which can be edited between two runs
+class EditedBlocks final
+    : public InterleavedFwdFixpointIterator< ControlFlowGraph*, VariableSet > {
+private:
+  VariableFactory& _vfac;
+
+public:
+  std::map< std::string, std::vector< std::string > > extra;
+
+public:
+  EditedBlocks(ControlFlowGraph* cfg, VariableFactory& vfac)
+      : InterleavedFwdFixpointIterator(cfg), _vfac(vfac) {}
+
+  VariableSet analyze_node(BasicBlock* bb, VariableSet inv) override {
+    inv.add(this->_vfac.get(bb->name()));
+    for (const std::string& name : this->extra[bb->name()]) {
+      inv.add(this->_vfac.get(name));
+    }
+    return inv;
+  }
+
+  VariableSet analyze_edge(BasicBlock*,
+                           BasicBlock*,
+                           VariableSet inv) override {
+    return inv;
+  }
+
+  void process_pre(BasicBlock*, const VariableSet&) override {}
+
+  void process_post(BasicBlock*, const VariableSet&) override {}
+};
+
+BOOST_AUTO_TEST_CASE(run_incremental) {
+  ControlFlowGraph cfg("entry");
+  BasicBlock* entry = cfg.get("entry");
+  BasicBlock* head = cfg.get("head");
+  BasicBlock* body = cfg.get("body");
+  BasicBlock* mid = cfg.get("mid");
+  BasicBlock* exit = cfg.get("exit");
+
+  entry->add_successor(head);
+  head->add_successor(body);
+  body->add_successor(head);
+  head->add_successor(mid);
+  mid->add_successor(exit);
+
+  VariableFactory vfac;
+
+  EditedBlocks previous(&cfg, vfac);
+  previous.run(VariableSet::bottom());
+
+  // Edit a block after the loop
+  EditedBlocks edited(&cfg, vfac);
+  edited.extra["mid"] = {"x"};
+  edited.reuse_invariants(previous);
+  RecordingTracer tracer;
+  edited.set_tracer(&tracer);
+  BOOST_CHECK(edited.run_incremental(VariableSet::bottom(), {mid}));
+
+  // The loop is not analyzed again
+  BOOST_CHECK(tracer.count(FixpointEvent::Node, "head") == 0);
+  BOOST_CHECK(tracer.count(FixpointEvent::Node, "mid") == 1);
+  BOOST_CHECK(tracer.count(FixpointEvent::Node, "exit") == 1);
+
+  EditedBlocks full(&cfg, vfac);
+  full.extra["mid"] = {"x"};
+  full.run(VariableSet::bottom());
+  for (BasicBlock* bb : {entry, head, body, mid, exit}) {
+    BOOST_CHECK(edited.pre(bb).equals(full.pre(bb)));
+    BOOST_CHECK(edited.post(bb).equals(full.post(bb)));
+  }
+  BOOST_CHECK(edited.post(exit).contains(vfac.get("x")));
+
+  // Edit the loop without changing its invariants
+  EditedBlocks same(&cfg, vfac);
+  same.extra["mid"] = {"x"};
+  same.extra["body"] = {"entry"};
+  same.reuse_invariants(edited);
+  RecordingTracer same_tracer;
+  same.set_tracer(&same_tracer);
+  BOOST_CHECK(!same.run_incremental(VariableSet::bottom(), {body}));
+  BOOST_CHECK(same_tracer.count(FixpointEvent::Cycle, "head") == 1);
+  BOOST_CHECK(same_tracer.count(FixpointEvent::Node, "mid") == 0);
+  BOOST_CHECK(same.post(exit).equals(full.post(exit)));
+}
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ *
+ * Tests for invariant tables
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_invariant_table
+#define BOOST_TEST_DYN_LINK
+#include <boost/mpl/list.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <ikos/core/domain/numeric/interval.hpp>
+#include <ikos/core/example/muzq.hpp>
+#include <ikos/core/example/variable_factory.hpp>
+#include <ikos/core/fixpoint/invariant_table.hpp>
+
+using namespace ikos::core;
+
+using VariableFactory = example::VariableFactory;
+using Variable = example::VariableFactory::VariableRef;
+using ZInterval = numeric::Interval< ZNumber >;
+using ZIntervalDomain = numeric::IntervalDomain< ZNumber, Variable >;
+using BasicBlock = muzq::BasicBlock< Variable >;
+using ControlFlowGraph = muzq::ControlFlowGraph< Variable >;
+
+using HashTable = HashInvariantTable< ControlFlowGraph*, ZIntervalDomain >;
+using DenseTable = DenseInvariantTable< ControlFlowGraph*, ZIntervalDomain >;
+
+using TableTypes = boost::mpl::list< HashTable, DenseTable >;
+
+BOOST_AUTO_TEST_CASE(traits) {
+  BOOST_CHECK((IsIndexableGraph< ControlFlowGraph* >::value));
+  BOOST_CHECK(
+      (std::is_same<
+          InvariantTableTraits< ControlFlowGraph*, ZIntervalDomain >::Table,
+          DenseTable >::value));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(set_and_get, Table, TableTypes) {
+  ControlFlowGraph cfg("entry");
+  BasicBlock* entry = cfg.get("entry");
+  BasicBlock* bb1 = cfg.get("bb1");
+  BasicBlock* bb2 = cfg.get("bb2");
+
+  VariableFactory vfac;
+  Variable x(vfac.get("x"));
+
+  ZIntervalDomain inv = ZIntervalDomain::top();
+  inv.set(x, ZInterval(ZBound(0), ZBound(10)));
+
+  Table table(&cfg);
+  BOOST_CHECK(table.get(entry).is_bottom());
+  BOOST_CHECK(table.get(bb1).is_bottom());
+
+  table.set(bb1, inv);
+  BOOST_CHECK(table.get(bb1).equals(inv));
+  BOOST_CHECK(table.get(bb2).is_bottom());
+
+  table.set(bb1, ZIntervalDomain::top());
+  BOOST_CHECK(table.get(bb1).is_top());
+  BOOST_CHECK(table.get(entry).is_bottom());
+}
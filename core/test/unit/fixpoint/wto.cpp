@@ -0,0 +1,201 @@
+/*******************************************************************************
+ *
+ * Tests for weak topological orders
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_invariant_table
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+#include <ikos/core/example/muzq.hpp>
+#include <ikos/core/example/variable_factory.hpp>
+#include <ikos/core/fixpoint/wto.hpp>
+
+using namespace ikos::core;
+
+using VariableFactory = example::VariableFactory;
+using Variable = example::VariableFactory::VariableRef;
+using BasicBlock = muzq::BasicBlock< Variable >;
+using ControlFlowGraph = muzq::ControlFlowGraph< Variable >;
+
+/// \brief Graph traits of ControlFlowGraph* without node indices
+struct HashGraphTraits {
+  using Traits = GraphTraits< ControlFlowGraph* >;
+  using NodeRef = Traits::NodeRef;
+  using SuccessorNodeIterator = Traits::SuccessorNodeIterator;
+  using PredecessorNodeIterator = Traits::PredecessorNodeIterator;
+
+  static NodeRef entry(ControlFlowGraph* cfg) { return Traits::entry(cfg); }
+
+  static SuccessorNodeIterator successor_begin(NodeRef bb) {
+    return Traits::successor_begin(bb);
+  }
+
+  static SuccessorNodeIterator successor_end(NodeRef bb) {
+    return Traits::successor_end(bb);
+  }
+
+  static PredecessorNodeIterator predecessor_begin(NodeRef bb) {
+    return Traits::predecessor_begin(bb);
+  }
+
+  static PredecessorNodeIterator predecessor_end(NodeRef bb) {
+    return Traits::predecessor_end(bb);
+  }
+};
+
+/// \brief Return a textual representation of a weak topological order
+template < typename GraphTrait >
+class WtoPrinter final
+    : public WtoComponentVisitor< ControlFlowGraph*, GraphTrait > {
+public:
+  std::string str;
+
+  void visit(const WtoVertex< ControlFlowGraph*, GraphTrait >& v) override {
+    this->separator();
+    this->str += v.node()->name();
+  }
+
+  void visit(const WtoCycle< ControlFlowGraph*, GraphTrait >& c) override {
+    this->separator();
+    this->str += "(" + c.head()->name();
+    for (auto it = c.begin(); it != c.end(); ++it) {
+      it->accept(*this);
+    }
+    this->str += ")";
+  }
+
+private:
+  void separator() {
+    if (!this->str.empty() && this->str.back() != '(') {
+      this->str += " ";
+    }
+  }
+};
+
+template < typename GraphTrait >
+std::string wto_str(ControlFlowGraph* cfg) {
+  Wto< ControlFlowGraph*, GraphTrait > wto(cfg);
+  WtoPrinter< GraphTrait > printer;
+  wto.accept(printer);
+  return printer.str;
+}
+
+BOOST_AUTO_TEST_CASE(traits) {
+  BOOST_CHECK((IsIndexableGraph< ControlFlowGraph* >::value));
+  BOOST_CHECK(
+      (!IsIndexableGraph< ControlFlowGraph*, HashGraphTraits >::value));
+}
+
+BOOST_AUTO_TEST_CASE(nested_cycles) {
+  ControlFlowGraph cfg("entry");
+  BasicBlock* entry = cfg.get("entry");
+  BasicBlock* head = cfg.get("head");
+  BasicBlock* body = cfg.get("body");
+  BasicBlock* inner = cfg.get("inner");
+  BasicBlock* latch = cfg.get("latch");
+  BasicBlock* exit = cfg.get("exit");
+
+  entry->add_successor(head);
+  head->add_successor(body);
+  body->add_successor(inner);
+  inner->add_successor(inner);
+  inner->add_successor(latch);
+  latch->add_successor(head);
+  head->add_successor(exit);
+
+  std::string expected = "entry (head body (inner) latch) exit";
+  BOOST_CHECK_EQUAL(wto_str< GraphTraits< ControlFlowGraph* > >(&cfg),
+                    expected);
+  BOOST_CHECK_EQUAL(wto_str< HashGraphTraits >(&cfg), expected);
+
+  using WtoNestingT =
+      WtoNesting< ControlFlowGraph*, GraphTraits< ControlFlowGraph* > >;
+
+  Wto< ControlFlowGraph* > wto(&cfg);
+  BOOST_CHECK(!wto.acyclic());
+  BOOST_CHECK(wto.nesting(entry) == WtoNestingT());
+  BOOST_CHECK(wto.nesting(head) == WtoNestingT());
+  BOOST_CHECK(wto.nesting(inner) == wto.nesting(latch));
+  BOOST_CHECK(wto.nesting(head) <= wto.nesting(inner));
+  BOOST_CHECK(!(wto.nesting(inner) <= wto.nesting(head)));
+}
+
+BOOST_AUTO_TEST_CASE(acyclic) {
+  ControlFlowGraph cfg("entry");
+  BasicBlock* entry = cfg.get("entry");
+  BasicBlock* left = cfg.get("left");
+  BasicBlock* right = cfg.get("right");
+  BasicBlock* exit = cfg.get("exit");
+
+  entry->add_successor(left);
+  entry->add_successor(right);
+  left->add_successor(exit);
+  right->add_successor(exit);
+
+  Wto< ControlFlowGraph* > wto(&cfg);
+  BOOST_CHECK(wto.acyclic());
+  BOOST_CHECK_EQUAL(wto_str< GraphTraits< ControlFlowGraph* > >(&cfg),
+                    wto_str< HashGraphTraits >(&cfg));
+}
+
+BOOST_AUTO_TEST_CASE(long_chain) {
+  // A recursive construction would overflow the stack on this graph
+  const int n = 200000;
+  ControlFlowGraph cfg("bb0");
+  BasicBlock* prev = cfg.get("bb0");
+  for (int i = 1; i < n; i++) {
+    BasicBlock* bb = cfg.get("bb" + std::to_string(i));
+    prev->add_successor(bb);
+    prev = bb;
+  }
+  prev->add_successor(cfg.get("bb1"));
+
+  Wto< ControlFlowGraph* > wto(&cfg);
+  BOOST_CHECK(!wto.acyclic());
+  std::size_t num_components = 0;
+  for (auto it = wto.begin(); it != wto.end(); ++it) {
+    num_components++;
+  }
+  BOOST_CHECK_EQUAL(num_components, 2);
+  BOOST_CHECK(wto.nesting(cfg.get("bb0")) <= wto.nesting(prev));
+}
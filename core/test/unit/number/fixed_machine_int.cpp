@@ -0,0 +1,156 @@
+/*******************************************************************************
+ *
+ * Tests for FixedMachineInt
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_fixed_machine_integer
+#define BOOST_TEST_DYN_LINK
+#include <cstdint>
+#include <vector>
+
+#include <boost/mpl/list.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <ikos/core/number/fixed_machine_int.hpp>
+#include <ikos/core/number/machine_int.hpp>
+
+using Int = ikos::core::MachineInt;
+using ikos::core::FixedMachineInt;
+using ikos::core::Signed;
+using ikos::core::Unsigned;
+
+using FixedTypes = boost::mpl::list< FixedMachineInt< 1, Signed >,
+                                     FixedMachineInt< 1, Unsigned >,
+                                     FixedMachineInt< 8, Signed >,
+                                     FixedMachineInt< 8, Unsigned >,
+                                     FixedMachineInt< 32, Signed >,
+                                     FixedMachineInt< 32, Unsigned >,
+                                     FixedMachineInt< 64, Signed >,
+                                     FixedMachineInt< 64, Unsigned > >;
+
+BOOST_AUTO_TEST_CASE(test_constexpr) {
+  using Int8 = FixedMachineInt< 8, Signed >;
+  using UInt8 = FixedMachineInt< 8, Unsigned >;
+
+  static_assert(Int8::min().value() == -128, "");
+  static_assert(Int8::max().value() == 127, "");
+  static_assert(UInt8::min().value() == 0, "");
+  static_assert(UInt8::max().value() == 255, "");
+  static_assert(Int8(200).value() == -56, "");
+  static_assert((Int8(127) + Int8(1)).is_min(), "");
+  static_assert((UInt8(0) - UInt8(1)).is_max(), "");
+  static_assert(Int8(-1) < Int8(0), "");
+  static_assert(UInt8(0) < UInt8(255), "");
+  BOOST_CHECK(true);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_operations, FixedInt, FixedTypes) {
+  unsigned bit_width = FixedInt::bit_width();
+  auto sign = FixedInt::sign();
+
+  std::vector< int64_t > values = {0, 1, 2, 3, 7, 100, 12345, -1, -2, -3};
+  values.push_back(FixedInt::min().value());
+  values.push_back(FixedInt::max().value());
+  values.push_back((FixedInt::min() + FixedInt(1)).value());
+  values.push_back((FixedInt::max() - FixedInt(1)).value());
+
+  for (int64_t x : values) {
+    FixedInt a(x);
+    Int ma(x, bit_width, sign);
+    BOOST_CHECK(a.to_machine_int() == ma);
+    BOOST_CHECK(FixedInt(ma) == a);
+    BOOST_CHECK((-a).to_machine_int() == -ma);
+    BOOST_CHECK((~a).to_machine_int() == ~ma);
+    BOOST_CHECK(a.is_min() == ma.is_min());
+    BOOST_CHECK(a.is_max() == ma.is_max());
+    BOOST_CHECK(a.is_negative() == ma.is_negative());
+
+    for (unsigned shift = 0; shift < bit_width; shift++) {
+      Int s(shift, bit_width, sign);
+      if (s != shift) {
+        continue;
+      }
+      BOOST_CHECK(shl(a, shift).to_machine_int() == shl(ma, s));
+      BOOST_CHECK(lshr(a, shift).to_machine_int() == lshr(ma, s));
+      BOOST_CHECK(ashr(a, shift).to_machine_int() == ashr(ma, s));
+    }
+
+    for (int64_t y : values) {
+      FixedInt b(y);
+      Int mb(y, bit_width, sign);
+      BOOST_CHECK((a + b).to_machine_int() == ma + mb);
+      BOOST_CHECK((a - b).to_machine_int() == ma - mb);
+      BOOST_CHECK((a * b).to_machine_int() == ma * mb);
+      BOOST_CHECK((a & b).to_machine_int() == (ma & mb));
+      BOOST_CHECK((a | b).to_machine_int() == (ma | mb));
+      BOOST_CHECK((a ^ b).to_machine_int() == (ma ^ mb));
+      if (!b.is_zero()) {
+        BOOST_CHECK((a / b).to_machine_int() == ma / mb);
+        BOOST_CHECK((a % b).to_machine_int() == ma % mb);
+      }
+      BOOST_CHECK((a == b) == (ma == mb));
+      BOOST_CHECK((a < b) == (ma < mb));
+      BOOST_CHECK((a <= b) == (ma <= mb));
+      BOOST_CHECK((a > b) == (ma > mb));
+      BOOST_CHECK((a >= b) == (ma >= mb));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_dispatch) {
+  auto width = [](unsigned bit_width, ikos::core::Signedness sign) {
+    return ikos::core::dispatch_fixed_machine_int(
+        bit_width,
+        sign,
+        [](auto tag) {
+          using IntT = typename decltype(tag)::Type;
+          return static_cast< int >(IntT::bit_width());
+        },
+        [] { return -1; });
+  };
+
+  BOOST_CHECK(width(1, Signed) == 1);
+  BOOST_CHECK(width(8, Unsigned) == 8);
+  BOOST_CHECK(width(16, Signed) == 16);
+  BOOST_CHECK(width(32, Unsigned) == 32);
+  BOOST_CHECK(width(64, Signed) == 64);
+  BOOST_CHECK(width(12, Signed) == -1);
+  BOOST_CHECK(width(128, Unsigned) == -1);
+}
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *
+ * Tests for the GMP memory functions
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <thread>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_gmp_allocator
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <ikos/core/number/gmp_allocator.hpp>
+#include <ikos/core/number/q_number.hpp>
+#include <ikos/core/number/z_number.hpp>
+
+using Z = ikos::core::ZNumber;
+using Q = ikos::core::QNumber;
+
+namespace {
+
+/// \brief Install the GMP memory functions before any test
+struct InstallGmpAllocator {
+  InstallGmpAllocator() { ikos::core::install_gmp_allocator(); }
+};
+
+/// \brief Compute 3^n, growing the limbs across all the size classes
+Z power_of_three(unsigned n) {
+  Z x(1);
+  for (unsigned i = 0; i < n; i++) {
+    x *= 3;
+  }
+  return x;
+}
+
+} // end anonymous namespace
+
+BOOST_GLOBAL_FIXTURE(InstallGmpAllocator);
+
+BOOST_AUTO_TEST_CASE(arithmetic) {
+  uint64_t before = ikos::core::gmp_allocation_count();
+
+  Z x = power_of_three(2000);
+  Z y = x;
+  for (unsigned i = 0; i < 2000; i++) {
+    y /= 3;
+  }
+  BOOST_CHECK(y == 1);
+  BOOST_CHECK(x % 3 == 0);
+  BOOST_CHECK(x > power_of_three(1999));
+
+  Q q(x, power_of_three(1000));
+  BOOST_CHECK(q == Q(power_of_three(1000)));
+
+  BOOST_CHECK(ikos::core::gmp_allocation_count() > before);
+}
+
+BOOST_AUTO_TEST_CASE(threads) {
+  // Numbers are created on a thread and released on another
+  std::vector< Z > numbers;
+  std::thread producer([&numbers] {
+    for (unsigned i = 0; i < 200; i++) {
+      numbers.push_back(power_of_three(i));
+    }
+  });
+  producer.join();
+
+  std::thread consumer([&numbers] {
+    for (unsigned i = 0; i < 200; i++) {
+      BOOST_CHECK(numbers[i] == power_of_three(i));
+    }
+    numbers.clear();
+  });
+  consumer.join();
+}
@@ -2198,3 +2198,43 @@ BOOST_AUTO_TEST_CASE(test_le_unsigned) {
   BOOST_CHECK(Int(13, 4, Unsigned) <= Int(15, 4, Unsigned));
   BOOST_CHECK(Int(15, 4, Unsigned) <= Int(15, 4, Unsigned));
 }
+
+BOOST_AUTO_TEST_CASE(test_mul_with_overflow_exhaustive) {
+  using ZNumber = ikos::core::ZNumber;
+
+  for (unsigned bit_width = 1; bit_width <= 6; bit_width++) {
+    for (auto sign : {Signed, Unsigned}) {
+      Int min = Int::min(bit_width, sign);
+      Int max = Int::max(bit_width, sign);
+      for (ZNumber a = min.to_z_number(); a <= max.to_z_number(); ++a) {
+        for (ZNumber b = min.to_z_number(); b <= max.to_z_number(); ++b) {
+          bool overflow = false;
+          Int r =
+              mul(Int(a, bit_width, sign), Int(b, bit_width, sign), overflow);
+          ZNumber p = a * b;
+          BOOST_CHECK(r == Int(p, bit_width, sign));
+          BOOST_CHECK(overflow ==
+                      (p < min.to_z_number() || p > max.to_z_number()));
+        }
+      }
+    }
+  }
+
+  bool overflow = false;
+  mul(Int(1L << 32, 64, Signed), Int(1L << 31, 64, Signed), overflow);
+  BOOST_CHECK(overflow);
+  mul(Int(1L << 31, 64, Signed), Int(1L << 31, 64, Signed), overflow);
+  BOOST_CHECK(!overflow);
+  mul(Int(-1, 64, Signed), Int::min(64, Signed), overflow);
+  BOOST_CHECK(overflow);
+  mul(Int(1UL << 32, 64, Unsigned), Int(1UL << 32, 64, Unsigned), overflow);
+  BOOST_CHECK(overflow);
+  mul(Int(1UL << 32, 64, Unsigned), Int(1UL << 31, 64, Unsigned), overflow);
+  BOOST_CHECK(!overflow);
+  mul(Int(ZNumber(-3), 64, Signed), Int(ZNumber(5), 64, Signed), overflow);
+  BOOST_CHECK(!overflow);
+
+  // Conversion of ZNumbers that do not fit in 64 bits
+  BOOST_CHECK(Int((ZNumber(1) << 70) + 5, 8, Unsigned) == Int(5, 8, Unsigned));
+  BOOST_CHECK(Int((ZNumber(-1) << 70) - 1, 8, Signed) == Int(-1, 8, Signed));
+}
@@ -40,6 +40,8 @@
  *
  ******************************************************************************/
 
+#include <limits>
+
 #define BOOST_TEST_MODULE test_q_number
 #define BOOST_TEST_DYN_LINK
 #include <boost/mpl/list.hpp>
@@ -345,3 +347,61 @@ BOOST_AUTO_TEST_CASE(test_q_number) {
   output << Q(1, 2);
   BOOST_CHECK(output.is_equal("1/2"));
 }
+
+BOOST_AUTO_TEST_CASE(test_q_number_overflow) {
+  using Z = ikos::core::ZNumber;
+  using Q = ikos::core::QNumber;
+
+  const long max = std::numeric_limits< long >::max();
+  const long min = std::numeric_limits< long >::min();
+  const Q values[] = {Q(0),
+                      Q(1),
+                      Q(-1),
+                      Q(1, 2),
+                      Q(-2, 3),
+                      Q(max),
+                      Q(min),
+                      Q(1, max),
+                      Q(-1, max),
+                      Q(min, max),
+                      Q(max - 1, max),
+                      Q(Z(max) + 1),
+                      Q(Z(1), Z(max) + 1),
+                      Q(Z(min) * 4, Z(3))};
+
+  // Compare the results with the GMP implementation
+  for (const Q& x : values) {
+    const mpq_class a = x.mpq();
+    BOOST_CHECK(Q(a) == x);
+    BOOST_CHECK((-x).mpq() == -a);
+    BOOST_CHECK(abs(x).mpq() == abs(a));
+    BOOST_CHECK(x.numerator().mpz() == a.get_num());
+    BOOST_CHECK(x.denominator().mpz() == a.get_den());
+    BOOST_CHECK(x.str() == a.get_str());
+    BOOST_CHECK(hash_value(x) == hash_value(Q(a)));
+
+    for (const Q& y : values) {
+      const mpq_class b = y.mpq();
+      BOOST_CHECK((x + y).mpq() == a + b);
+      BOOST_CHECK((x - y).mpq() == a - b);
+      BOOST_CHECK((x * y).mpq() == a * b);
+      BOOST_CHECK((x < y) == (a < b));
+      BOOST_CHECK((x == y) == (a == b));
+      if (b != 0) {
+        BOOST_CHECK((x / y).mpq() == a / b);
+      }
+    }
+  }
+
+  // Results that fit in 64 bits again are stored inline
+  Q n(max);
+  ++n;
+  BOOST_CHECK(n > max);
+  --n;
+  BOOST_CHECK(n == max);
+  BOOST_CHECK(n.round_to_lower() == max);
+  BOOST_CHECK(Q(-7, 2).round_to_lower() == -4);
+  BOOST_CHECK(Q(-7, 2).round_to_upper() == -3);
+  BOOST_CHECK(Q(7, 2).round_to_lower() == 3);
+  BOOST_CHECK(Q(7, 2).round_to_upper() == 4);
+}
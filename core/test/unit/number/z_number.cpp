@@ -595,3 +595,68 @@ BOOST_AUTO_TEST_CASE(test_z_number) {
   output << Z(42);
   BOOST_CHECK(output.is_equal("42"));
 }
+
+BOOST_AUTO_TEST_CASE(test_z_number_overflow) {
+  using Z = ikos::core::ZNumber;
+
+  const long max = std::numeric_limits< long >::max();
+  const long min = std::numeric_limits< long >::min();
+  const Z values[] = {Z(0),
+                      Z(1),
+                      Z(-1),
+                      Z(2),
+                      Z(-3),
+                      Z(max),
+                      Z(min),
+                      Z(max - 1),
+                      Z(min + 1),
+                      Z(max) + 1,
+                      Z(min) - 1,
+                      Z(max) * 4,
+                      Z(min) * 4};
+
+  // Compare the results with the GMP implementation
+  for (const Z& x : values) {
+    const mpz_class a = x.mpz();
+    BOOST_CHECK(Z(a) == x);
+    BOOST_CHECK((-x).mpz() == -a);
+    BOOST_CHECK(abs(x).mpz() == abs(a));
+    BOOST_CHECK(x.size_in_bits() == mpz_sizeinbase(a.get_mpz_t(), 2));
+    BOOST_CHECK((x << 3).mpz() == (a << 3));
+    BOOST_CHECK((x << 70).mpz() == (a << 70));
+    BOOST_CHECK((x >> 3).mpz() == (a >> 3));
+    BOOST_CHECK((x >> 70).mpz() == (a >> 70));
+    BOOST_CHECK(hash_value(x) == hash_value(Z(a)));
+
+    for (const Z& y : values) {
+      const mpz_class b = y.mpz();
+      BOOST_CHECK((x + y).mpz() == a + b);
+      BOOST_CHECK((x - y).mpz() == a - b);
+      BOOST_CHECK((x * y).mpz() == a * b);
+      BOOST_CHECK((x & y).mpz() == (a & b));
+      BOOST_CHECK((x | y).mpz() == (a | b));
+      BOOST_CHECK((x ^ y).mpz() == (a ^ b));
+      BOOST_CHECK((x < y) == (a < b));
+      BOOST_CHECK((x == y) == (a == b));
+      BOOST_CHECK(gcd(x, y).mpz() == gcd(a, b));
+      BOOST_CHECK(lcm(x, y).mpz() == lcm(a, b));
+      if (b != 0) {
+        BOOST_CHECK((x / y).mpz() == a / b);
+        BOOST_CHECK((x % y).mpz() == a % b);
+        mpz_class m;
+        mpz_mod(m.get_mpz_t(), a.get_mpz_t(), b.get_mpz_t());
+        BOOST_CHECK(mod(x, y).mpz() == m);
+      }
+    }
+  }
+
+  // Results that fit in 64 bits again are stored inline
+  Z n(max);
+  ++n;
+  BOOST_CHECK(n > max);
+  --n;
+  BOOST_CHECK(n == max);
+  BOOST_CHECK(n.fits< long >());
+  BOOST_CHECK((Z(min) / -1).mpz() == -mpz_class(min));
+  BOOST_CHECK(Z(min) % -1 == 0);
+}
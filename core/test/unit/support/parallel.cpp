@@ -0,0 +1,118 @@
+/*******************************************************************************
+ *
+ * Tests for Parallel
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_parallel
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <ikos/core/support/parallel.hpp>
+
+using ikos::core::ConcurrentReads;
+using ikos::core::Parallel;
+
+BOOST_AUTO_TEST_CASE(for_each_index) {
+  Parallel::set_jobs(4);
+
+  // The pool is reused by successive calls
+  for (int k = 0; k < 100; k++) {
+    std::vector< std::atomic< int > > calls(64);
+    std::atomic< bool > concurrent(true);
+    Parallel::for_each_index(calls.size(), 2, [&](std::size_t i) {
+      calls[i]++;
+      if (!ConcurrentReads::active()) {
+        concurrent = false;
+      }
+    });
+    for (const auto& n : calls) {
+      BOOST_CHECK(n == 1);
+    }
+    BOOST_CHECK(concurrent);
+    BOOST_CHECK(!ConcurrentReads::active());
+  }
+
+  // Below the threshold, calls are sequential
+  std::vector< int > order;
+  Parallel::for_each_index(8, 32, [&](std::size_t i) {
+    order.push_back(static_cast< int >(i));
+  });
+  BOOST_CHECK((order == std::vector< int >{0, 1, 2, 3, 4, 5, 6, 7}));
+
+  Parallel::set_jobs(1);
+}
+
+BOOST_AUTO_TEST_CASE(nested) {
+  Parallel::set_jobs(4);
+
+  std::atomic< int > calls(0);
+  Parallel::for_each_index(8, 2, [&](std::size_t) {
+    Parallel::for_each_index(8, 2, [&](std::size_t) { calls++; });
+  });
+  BOOST_CHECK(calls == 64);
+
+  Parallel::set_jobs(1);
+}
+
+BOOST_AUTO_TEST_CASE(exception) {
+  Parallel::set_jobs(4);
+
+  BOOST_CHECK_THROW(Parallel::for_each_index(64,
+                                             2,
+                                             [](std::size_t i) {
+                                               if (i == 10) {
+                                                 throw std::runtime_error(
+                                                     "error");
+                                               }
+                                             }),
+                    std::runtime_error);
+  BOOST_CHECK(!ConcurrentReads::active());
+
+  // The pool still works
+  std::atomic< int > calls(0);
+  Parallel::for_each_index(64, 2, [&](std::size_t) { calls++; });
+  BOOST_CHECK(calls == 64);
+
+  Parallel::set_jobs(1);
+}
@@ -3710,3 +3710,58 @@ BOOST_AUTO_TEST_CASE(test_widening_threshold) {
                               Int(257, 32, Unsigned)) ==
       Interval(Int(0, 8, Signed), Int(127, 8, Signed)));
 }
+
+BOOST_AUTO_TEST_CASE(test_small_kernels) {
+  // Compare the 64-bit kernels with the generic implementation
+  for (unsigned bit_width : {1U, 8U, 32U, 63U, 64U, 65U}) {
+    for (auto sign : {Signed, Unsigned}) {
+      Int min = Int::min(bit_width, sign);
+      Int max = Int::max(bit_width, sign);
+      Int one(1, bit_width, sign);
+      std::vector< Int > bounds = {min,
+                                   min + one,
+                                   Int(-3, bit_width, sign),
+                                   Int(-1, bit_width, sign),
+                                   Int(0, bit_width, sign),
+                                   one,
+                                   Int(5, bit_width, sign),
+                                   max - one,
+                                   max};
+
+      std::vector< Interval > intervals;
+      for (const auto& lb : bounds) {
+        for (const auto& ub : bounds) {
+          if (lb <= ub) {
+            intervals.emplace_back(lb, ub);
+          }
+        }
+      }
+
+      for (const auto& x : intervals) {
+        for (const auto& y : intervals) {
+          ZInterval zx = x.to_z_interval();
+          ZInterval zy = y.to_z_interval();
+          auto wrap = [=](const ZInterval& z) {
+            return Interval::from_z_interval(z,
+                                             bit_width,
+                                             sign,
+                                             Interval::WrapTag{});
+          };
+          auto trunc = [=](const ZInterval& z) {
+            return Interval::from_z_interval(z,
+                                             bit_width,
+                                             sign,
+                                             Interval::TruncTag{});
+          };
+          BOOST_CHECK(add(x, y) == wrap(zx + zy));
+          BOOST_CHECK(add_no_wrap(x, y) == trunc(zx + zy));
+          BOOST_CHECK(sub(x, y) == wrap(zx - zy));
+          BOOST_CHECK(sub_no_wrap(x, y) == trunc(zx - zy));
+          BOOST_CHECK(mul(x, y) == wrap(zx * zy));
+          BOOST_CHECK(mul_no_wrap(x, y) == trunc(zx * zy));
+          BOOST_CHECK(div(x, y) == trunc(zx / zy));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,337 @@
+/*******************************************************************************
+ *
+ * Tests for machine_int::KnownBits
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_machine_integer_known_bits
+#define BOOST_TEST_DYN_LINK
+#include <functional>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ikos/core/number/machine_int.hpp>
+#include <ikos/core/value/machine_int/known_bits.hpp>
+
+using Int = ikos::core::MachineInt;
+using Interval = ikos::core::machine_int::Interval;
+using Congruence = ikos::core::machine_int::Congruence;
+using KnownBits = ikos::core::machine_int::KnownBits;
+using ikos::core::Signed;
+using ikos::core::Signedness;
+using ikos::core::Unsigned;
+
+/// \brief Return all the known bits values of the given bit-width
+static std::vector< KnownBits > all_known_bits(unsigned bit_width,
+                                               Signedness sign) {
+  std::vector< KnownBits > r;
+  int n = 1 << bit_width;
+  for (int zeros = 0; zeros < n; zeros++) {
+    for (int ones = 0; ones < n; ones++) {
+      if ((zeros & ones) == 0) {
+        r.emplace_back(Int(zeros, bit_width, sign), Int(ones, bit_width, sign));
+      }
+    }
+  }
+  return r;
+}
+
+/// \brief Return all the machine integers of the given bit-width
+static std::vector< Int > all_ints(unsigned bit_width, Signedness sign) {
+  std::vector< Int > r;
+  for (int i = 0; i < (1 << bit_width); i++) {
+    r.emplace_back(i, bit_width, sign);
+  }
+  return r;
+}
+
+/// \brief Check that `abstract_op` over-approximates `concrete_op`
+static void check_soundness(
+    Signedness sign,
+    const std::function< KnownBits(const KnownBits&, const KnownBits&) >&
+        abstract_op,
+    const std::function< bool(const Int&, const Int&, Int&) >& concrete_op) {
+  const unsigned bit_width = 4;
+  std::vector< KnownBits > values = all_known_bits(bit_width, sign);
+  std::vector< Int > ints = all_ints(bit_width, sign);
+
+  for (const auto& x : values) {
+    for (const auto& y : values) {
+      KnownBits z = abstract_op(x, y);
+      for (const auto& a : ints) {
+        if (!x.contains(a)) {
+          continue;
+        }
+        for (const auto& b : ints) {
+          if (!y.contains(b)) {
+            continue;
+          }
+          Int c(0, bit_width, sign);
+          if (concrete_op(a, b, c)) {
+            BOOST_CHECK(z.contains(c));
+          }
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_constructors) {
+  BOOST_CHECK(KnownBits() == KnownBits::top(1, Signed));
+
+  KnownBits x(Int(5, 8, Unsigned));
+  BOOST_CHECK(x.zeros() == Int(250, 8, Unsigned));
+  BOOST_CHECK(x.ones() == Int(5, 8, Unsigned));
+  BOOST_CHECK(x.singleton() == Int(5, 8, Unsigned));
+
+  BOOST_CHECK(KnownBits(Int(1, 8, Unsigned), Int(1, 8, Unsigned)).is_bottom());
+  BOOST_CHECK(KnownBits(Int(0, 8, Unsigned), Int(0, 8, Unsigned)).is_top());
+}
+
+BOOST_AUTO_TEST_CASE(test_lattice) {
+  KnownBits x(Int(4, 8, Unsigned));
+  KnownBits y(Int(6, 8, Unsigned));
+  KnownBits z = x.join(y);
+  BOOST_CHECK(z == KnownBits(Int(249, 8, Unsigned), Int(4, 8, Unsigned)));
+  BOOST_CHECK(x.leq(z));
+  BOOST_CHECK(y.leq(z));
+  BOOST_CHECK(!z.leq(x));
+  BOOST_CHECK(z.meet(x) == x);
+  BOOST_CHECK(x.meet(y).is_bottom());
+  BOOST_CHECK(KnownBits::bottom(8, Unsigned).leq(x));
+  BOOST_CHECK(x.leq(KnownBits::top(8, Unsigned)));
+}
+
+BOOST_AUTO_TEST_CASE(test_conversions) {
+  // 0b0000?1?0
+  KnownBits x(Int(241, 8, Unsigned), Int(4, 8, Unsigned));
+  BOOST_CHECK(x.to_interval() ==
+              Interval(Int(4, 8, Unsigned), Int(14, 8, Unsigned)));
+  BOOST_CHECK(x.to_congruence() ==
+              Congruence(Int(2, 8, Unsigned), Int(0, 8, Unsigned)));
+
+  BOOST_CHECK(KnownBits::from_interval(
+                  Interval(Int(16, 8, Unsigned), Int(31, 8, Unsigned))) ==
+              KnownBits(Int(224, 8, Unsigned), Int(16, 8, Unsigned)));
+  BOOST_CHECK(KnownBits::from_interval(
+                  Interval(Int(-1, 8, Signed), Int(1, 8, Signed)))
+                  .is_top());
+  BOOST_CHECK(KnownBits::from_congruence(
+                  Congruence(Int(8, 8, Unsigned), Int(3, 8, Unsigned))) ==
+              KnownBits(Int(4, 8, Unsigned), Int(3, 8, Unsigned)));
+
+  // Signed, with an unknown sign bit
+  KnownBits y(Int(1, 8, Signed), Int(0, 8, Signed));
+  BOOST_CHECK(y.to_interval() ==
+              Interval(Int(-128, 8, Signed), Int(126, 8, Signed)));
+}
+
+BOOST_AUTO_TEST_CASE(test_ext_trunc) {
+  KnownBits x(Int(240, 8, Unsigned), Int(4, 8, Unsigned));
+  BOOST_CHECK(x.ext(16) ==
+              KnownBits(Int(65520, 16, Unsigned), Int(4, 16, Unsigned)));
+  BOOST_CHECK(x.trunc(4) ==
+              KnownBits(Int(0, 4, Unsigned), Int(4, 4, Unsigned)));
+
+  // Known negative sign bit
+  KnownBits y(Int(0, 8, Signed), Int(-128, 8, Signed));
+  BOOST_CHECK(y.ext(16) ==
+              KnownBits(Int(0, 16, Signed), Int(-128, 16, Signed)));
+}
+
+BOOST_AUTO_TEST_CASE(test_bitwise) {
+  KnownBits top(Int(0, 8, Unsigned), Int(0, 8, Unsigned));
+  KnownBits mask(Int(0xF0, 8, Unsigned));
+  BOOST_CHECK(and_(top, mask) ==
+              KnownBits(Int(0x0F, 8, Unsigned), Int(0, 8, Unsigned)));
+  BOOST_CHECK(or_(top, mask) ==
+              KnownBits(Int(0, 8, Unsigned), Int(0xF0, 8, Unsigned)));
+  BOOST_CHECK(and_(or_(top, mask), mask) == mask);
+
+  KnownBits x = and_(top, KnownBits(Int(0x0F, 8, Unsigned)));
+  BOOST_CHECK(shl(x, KnownBits(Int(4, 8, Unsigned))) ==
+              KnownBits(Int(0x0F, 8, Unsigned), Int(0, 8, Unsigned)));
+  BOOST_CHECK(lshr(x, KnownBits(Int(2, 8, Unsigned))) ==
+              KnownBits(Int(0xFC, 8, Unsigned), Int(0, 8, Unsigned)));
+  BOOST_CHECK(xor_(x, KnownBits(Int(0xFF, 8, Unsigned))) ==
+              KnownBits(Int(0, 8, Unsigned), Int(0xF0, 8, Unsigned)));
+}
+
+BOOST_AUTO_TEST_CASE(test_arithmetic) {
+  // Even numbers
+  KnownBits even(Int(1, 8, Unsigned), Int(0, 8, Unsigned));
+  BOOST_CHECK(add(even, KnownBits(Int(1, 8, Unsigned))) ==
+              KnownBits(Int(0, 8, Unsigned), Int(1, 8, Unsigned)));
+  BOOST_CHECK(mul(even, even) ==
+              KnownBits(Int(3, 8, Unsigned), Int(0, 8, Unsigned)));
+  BOOST_CHECK(add(KnownBits(Int(3, 8, Unsigned)),
+                  KnownBits(Int(4, 8, Unsigned))) ==
+              KnownBits(Int(7, 8, Unsigned)));
+  BOOST_CHECK(sub(KnownBits(Int(3, 8, Unsigned)),
+                  KnownBits(Int(4, 8, Unsigned))) ==
+              KnownBits(Int(255, 8, Unsigned)));
+}
+
+BOOST_AUTO_TEST_CASE(test_soundness) {
+  for (Signedness sign : {Signed, Unsigned}) {
+    check_soundness(sign,
+                    [](const KnownBits& x, const KnownBits& y) {
+                      return add(x, y);
+                    },
+                    [](const Int& a, const Int& b, Int& c) {
+                      c = add(a, b);
+                      return true;
+                    });
+    check_soundness(sign,
+                    [](const KnownBits& x, const KnownBits& y) {
+                      return sub(x, y);
+                    },
+                    [](const Int& a, const Int& b, Int& c) {
+                      c = sub(a, b);
+                      return true;
+                    });
+    check_soundness(sign,
+                    [](const KnownBits& x, const KnownBits& y) {
+                      return mul(x, y);
+                    },
+                    [](const Int& a, const Int& b, Int& c) {
+                      c = mul(a, b);
+                      return true;
+                    });
+    check_soundness(sign,
+                    [](const KnownBits& x, const KnownBits& y) {
+                      return div(x, y);
+                    },
+                    [](const Int& a, const Int& b, Int& c) {
+                      if (b.is_zero() || (a.is_min() && b.is_signed() &&
+                                          b.all_ones())) {
+                        return false;
+                      }
+                      c = div(a, b);
+                      return true;
+                    });
+    check_soundness(sign,
+                    [](const KnownBits& x, const KnownBits& y) {
+                      return rem(x, y);
+                    },
+                    [](const Int& a, const Int& b, Int& c) {
+                      if (b.is_zero() || (a.is_min() && b.is_signed() &&
+                                          b.all_ones())) {
+                        return false;
+                      }
+                      c = rem(a, b);
+                      return true;
+                    });
+    check_soundness(sign,
+                    [](const KnownBits& x, const KnownBits& y) {
+                      return shl(x, y);
+                    },
+                    [](const Int& a, const Int& b, Int& c) {
+                      if (b.is_negative() || b >= Int(4, 4, b.sign())) {
+                        return false;
+                      }
+                      c = shl(a, b);
+                      return true;
+                    });
+    check_soundness(sign,
+                    [](const KnownBits& x, const KnownBits& y) {
+                      return lshr(x, y);
+                    },
+                    [](const Int& a, const Int& b, Int& c) {
+                      if (b.is_negative() || b >= Int(4, 4, b.sign())) {
+                        return false;
+                      }
+                      c = lshr(a, b);
+                      return true;
+                    });
+    check_soundness(sign,
+                    [](const KnownBits& x, const KnownBits& y) {
+                      return ashr(x, y);
+                    },
+                    [](const Int& a, const Int& b, Int& c) {
+                      if (b.is_negative() || b >= Int(4, 4, b.sign())) {
+                        return false;
+                      }
+                      c = ashr(a, b);
+                      return true;
+                    });
+    check_soundness(sign,
+                    [](const KnownBits& x, const KnownBits& y) {
+                      return and_(x, y);
+                    },
+                    [](const Int& a, const Int& b, Int& c) {
+                      c = and_(a, b);
+                      return true;
+                    });
+    check_soundness(sign,
+                    [](const KnownBits& x, const KnownBits& y) {
+                      return or_(x, y);
+                    },
+                    [](const Int& a, const Int& b, Int& c) {
+                      c = or_(a, b);
+                      return true;
+                    });
+    check_soundness(sign,
+                    [](const KnownBits& x, const KnownBits& y) {
+                      return xor_(x, y);
+                    },
+                    [](const Int& a, const Int& b, Int& c) {
+                      c = xor_(a, b);
+                      return true;
+                    });
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_conversions_soundness) {
+  for (Signedness sign : {Signed, Unsigned}) {
+    for (const auto& x : all_known_bits(4, sign)) {
+      Interval i = x.to_interval();
+      Congruence c = x.to_congruence();
+      for (const auto& a : all_ints(4, sign)) {
+        if (x.contains(a)) {
+          BOOST_CHECK(i.contains(a));
+          BOOST_CHECK(c.contains(a));
+          BOOST_CHECK(KnownBits::from_interval(i).contains(a));
+          BOOST_CHECK(KnownBits::from_congruence(c).contains(a));
+        }
+      }
+    }
+  }
+}
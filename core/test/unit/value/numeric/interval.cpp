@@ -231,6 +231,35 @@ BOOST_AUTO_TEST_CASE(test_bound_shl) {
   BOOST_CHECK(ZBound(-2) << ZBound(3) == ZBound(-16));
 }
 
+BOOST_AUTO_TEST_CASE(test_bound_infinity_flag) {
+  BOOST_CHECK(sizeof(ZBound) == sizeof(ZNumber));
+
+  ZBound inf = ZBound::plus_infinity();
+  ZBound copy(inf);
+  ZBound moved(std::move(copy));
+  BOOST_CHECK(moved.is_plus_infinity());
+  BOOST_CHECK(-moved == ZBound::minus_infinity());
+
+  // Assigning a number clears the flag
+  moved = ZNumber(1);
+  BOOST_CHECK(moved.is_finite());
+  BOOST_CHECK(moved.number() == ZNumber(1));
+  moved = inf;
+  BOOST_CHECK(moved.is_plus_infinity());
+
+  // Big numbers
+  ZBound big(ZNumber::from_string("100000000000000000000"));
+  BOOST_CHECK(big.is_finite());
+  BOOST_CHECK(big * ZBound::minus_infinity() == ZBound::minus_infinity());
+  BOOST_CHECK(big + inf == inf);
+  BOOST_CHECK(big - big == ZBound(0));
+  BOOST_CHECK(big < inf);
+  BOOST_CHECK(ZBound::minus_infinity() < big);
+  big *= inf;
+  BOOST_CHECK(big.is_plus_infinity());
+  BOOST_CHECK(!big.number());
+}
+
 BOOST_AUTO_TEST_CASE(test_interval_shl) {
   BOOST_CHECK(ZInterval(4) << ZInterval::bottom() == ZInterval::bottom());
   BOOST_CHECK(ZInterval::bottom() << ZInterval(2) == ZInterval::bottom());
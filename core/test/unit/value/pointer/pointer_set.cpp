@@ -0,0 +1,110 @@
+/*******************************************************************************
+ *
+ * Tests for PointerSet
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#define BOOST_TEST_MODULE test_pointer_solver
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <ikos/core/example/variable_factory.hpp>
+#include <ikos/core/value/pointer/pointer_set.hpp>
+
+using ikos::core::Unsigned;
+using Int = ikos::core::MachineInt;
+using Interval = ikos::core::machine_int::Interval;
+using MemoryFactory = ikos::core::example::VariableFactory;
+using MemLocation = MemoryFactory::VariableRef;
+using PointsToSet = ikos::core::PointsToSet< MemLocation >;
+using PackedPointsToSet = ikos::core::PackedPointsToSet< MemLocation >;
+using PointerSet = ikos::core::PointerSet< MemLocation >;
+
+BOOST_AUTO_TEST_CASE(test_packed_points_to_set) {
+  MemoryFactory memfac;
+  MemLocation x(memfac.get("x"));
+  MemLocation y(memfac.get("y"));
+  MemLocation z(memfac.get("z"));
+
+  PackedPointsToSet a(PointsToSet{x, y});
+  PackedPointsToSet b(PointsToSet{y, x});
+  PackedPointsToSet c(PointsToSet{x, z});
+
+  BOOST_CHECK(a.shares(b));
+  BOOST_CHECK(!a.shares(c));
+  BOOST_CHECK(a.get() == (PointsToSet{x, y}));
+  BOOST_CHECK(c.get() == (PointsToSet{x, z}));
+
+  BOOST_CHECK(PackedPointsToSet().get().is_top());
+  BOOST_CHECK(
+      PackedPointsToSet().shares(PackedPointsToSet(PointsToSet::top())));
+  BOOST_CHECK(PackedPointsToSet(PointsToSet::bottom()).get().is_bottom());
+  BOOST_CHECK(PackedPointsToSet(PointsToSet::empty()).get().is_empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_pointer_set) {
+  MemoryFactory memfac;
+  MemLocation x(memfac.get("x"));
+  MemLocation y(memfac.get("y"));
+
+  Interval zero(Int(0, 64, Unsigned));
+  Interval four(Int(4, 64, Unsigned));
+  Interval zero_four(Int(0, 64, Unsigned), Int(4, 64, Unsigned));
+
+  PointerSet a(PointsToSet{x}, zero);
+  PointerSet b(PointsToSet{x}, four);
+  PointerSet c(PointsToSet{y}, zero);
+
+  BOOST_CHECK(a.join(b) == PointerSet(PointsToSet{x}, zero_four));
+  BOOST_CHECK(a.join(c) == PointerSet(PointsToSet{x, y}, zero));
+  BOOST_CHECK(a.leq(a.join(b)));
+  BOOST_CHECK(!a.join(c).leq(a));
+  BOOST_CHECK(a.meet(b).is_bottom());
+  BOOST_CHECK(a.meet(c) == PointerSet::empty(64, Unsigned));
+  BOOST_CHECK(PointerSet(PointsToSet{x}, Interval::bottom(64, Unsigned))
+                  .is_bottom());
+
+  PointerSet d = a;
+  d.set_to_top();
+  BOOST_CHECK(d.is_top());
+  BOOST_CHECK(a.leq(d));
+  d.set_to_bottom();
+  BOOST_CHECK(d.is_bottom());
+  BOOST_CHECK(d.leq(a));
+}
@@ -6,6 +6,7 @@
  * For convenience, this header includes:
  *   * ikos/frontend/llvm/import/exception.hpp
  *   * ikos/frontend/llvm/import/importer.hpp
+ *   * ikos/frontend/llvm/import/value_index.hpp
  *
  * Author: Maxime Arthaud
  *
@@ -49,3 +50,4 @@
 
 #include <ikos/frontend/llvm/import/exception.hpp>
 #include <ikos/frontend/llvm/import/importer.hpp>
+#include <ikos/frontend/llvm/import/value_index.hpp>
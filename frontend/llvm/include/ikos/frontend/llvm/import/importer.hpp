@@ -43,6 +43,12 @@
 
 #pragma once
 
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <llvm/ADT/DenseSet.h>
+#include <llvm/IR/Function.h>
 #include <llvm/IR/Module.h>
 
 #include <ikos/ar/semantic/bundle.hpp>
@@ -56,6 +62,71 @@ namespace import {
 /// \brief Check if the given module has debug information
 bool has_debug_info(llvm::Module&);
 
+/// \brief Set of LLVM functions
+using FunctionSet = llvm::DenseSet< llvm::Function* >;
+
+/// \brief Read all the function bodies of a lazily loaded module
+///
+/// \throws ImportError if a function body cannot be read
+void materialize_functions(llvm::Module&);
+
+/// \brief Compute the functions reachable from the given entry points
+///
+/// A function is reachable if it is called or has its address taken in a
+/// reachable function or in a global variable initializer.
+///
+/// In a lazily loaded module, only the bodies of the reachable functions are
+/// read, the others stay in the bitcode file.
+///
+/// \throws ImportError if a function body cannot be read
+FunctionSet reachable_functions(llvm::Module&,
+                                const std::vector< std::string >& entry_points);
+
+/// \brief Statistics of an import
+///
+/// Times are in seconds. The time of a helper includes the time of the other
+/// helpers it calls, for instance translating a constant translates its type.
+struct ImportStatistics {
+  /// \brief Time to create the global variables and functions
+  double declarations_time = 0;
+
+  /// \brief Time to translate the global variable initializers
+  double initializers_time = 0;
+
+  /// \brief Time to translate the function bodies (wall clock)
+  double bodies_time = 0;
+
+  /// \brief Time to translate the types that were not cached
+  double types_time = 0;
+
+  /// \brief Time to match debug information types with llvm types
+  double match_di_types_time = 0;
+
+  /// \brief Time to translate the constants that were not cached
+  double constants_time = 0;
+
+  /// \brief Time to recognize library functions
+  double library_functions_time = 0;
+
+  /// \brief Number of translated types
+  std::size_t types = 0;
+
+  /// \brief Number of type translations found in the cache
+  std::size_t type_cache_hits = 0;
+
+  /// \brief Number of translated constants
+  std::size_t constants = 0;
+
+  /// \brief Number of constant translations found in the cache
+  std::size_t constant_cache_hits = 0;
+
+  /// \brief Number of external functions recognized as library functions
+  std::size_t library_functions = 0;
+
+  /// \brief Number of statements in the translated function bodies
+  std::size_t statements = 0;
+};
+
 /// \brief Import from LLVM to AR
 class Importer {
 public:
@@ -95,9 +166,24 @@ private:
   // AR Context
   ar::Context& _context;
 
+  // Number of threads used to translate function bodies
+  unsigned _jobs;
+
+  // Whether only the bodies of the functions in `_reachable` are translated
+  bool _only_reachable;
+
+  // Reachable functions
+  FunctionSet _reachable;
+
+  // Statistics of the last import
+  ImportStatistics _statistics;
+
 public:
   /// \brief Public constructor
-  explicit Importer(ar::Context& ctx) : _context(ctx) {}
+  ///
+  /// \param jobs Number of threads used to translate function bodies
+  explicit Importer(ar::Context& ctx, unsigned jobs = 1)
+      : _context(ctx), _jobs(jobs), _only_reachable(false) {}
 
   /// \brief Default copy constructor
   Importer(const Importer&) = default;
@@ -114,10 +200,22 @@ public:
   /// \brief Destructor
   ~Importer() = default;
 
+  /// \brief Only translate the bodies of the given functions
+  ///
+  /// The set is usually computed by `reachable_functions()`, which also reads
+  /// their bodies. Other functions are imported as declarations.
+  void set_reachable_functions(FunctionSet functions) {
+    this->_only_reachable = true;
+    this->_reachable = std::move(functions);
+  }
+
   /// \brief Generate an AR bundle from a LLVM module
   ///
   /// \throws ImportError on errors
   ar::Bundle* import(llvm::Module&, ImportOptions opts = DefaultOptions);
+
+  /// \brief Return the statistics of the last import
+  const ImportStatistics& statistics() const { return this->_statistics; }
 };
 
 IKOS_DECLARE_OPERATORS_FOR_FLAGS(Importer::ImportOptions)
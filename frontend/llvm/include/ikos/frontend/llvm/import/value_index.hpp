@@ -0,0 +1,129 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Index of the LLVM values of a module
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/IR/Module.h>
+
+#include <ikos/ar/format/binary.hpp>
+
+namespace ikos {
+namespace frontend {
+namespace import {
+
+/// \brief Index of the LLVM values of a module
+///
+/// Numbers all the values of a module (global variables, functions,
+/// arguments, basic blocks, instructions and constants) in a deterministic
+/// order, so that the same bitcode always gives the same identifiers.
+///
+/// This is used to store the LLVM front-end objects of an AR bundle in the
+/// binary format (see ar::BinaryWriter), and to bind them again to a freshly
+/// parsed module (see ar::BinaryReader).
+class ValueIndex final : public ar::FrontendIndex {
+private:
+  // Values, by identifier minus one
+  std::vector< llvm::Value* > _values;
+
+  // Map from value to identifier
+  llvm::DenseMap< llvm::Value*, std::uint64_t > _ids;
+
+public:
+  /// \brief Index all the values of the given module
+  explicit ValueIndex(llvm::Module&);
+
+  /// \brief Destructor
+  ~ValueIndex() override;
+
+  /// \brief Get the identifier of the front-end object of a global variable
+  std::uint64_t id(ar::GlobalVariable*) override;
+
+  /// \brief Get the identifier of the front-end object of a function
+  std::uint64_t id(ar::Function*) override;
+
+  /// \brief Get the identifier of the front-end object of a variable
+  std::uint64_t id(ar::Variable*) override;
+
+  /// \brief Get the identifier of the front-end object of a basic block
+  std::uint64_t id(ar::BasicBlock*) override;
+
+  /// \brief Get the identifier of the front-end object of a statement
+  std::uint64_t id(ar::Statement*) override;
+
+  /// \brief Set the front-end object of a global variable
+  void resolve(ar::GlobalVariable*, std::uint64_t) override;
+
+  /// \brief Set the front-end object of a function
+  void resolve(ar::Function*, std::uint64_t) override;
+
+  /// \brief Set the front-end object of a variable
+  void resolve(ar::Variable*, std::uint64_t) override;
+
+  /// \brief Set the front-end object of a basic block
+  void resolve(ar::BasicBlock*, std::uint64_t) override;
+
+  /// \brief Set the front-end object of a statement
+  void resolve(ar::Statement*, std::uint64_t) override;
+
+private:
+  /// \brief Add a value in the index
+  void add(llvm::Value*);
+
+  /// \brief Add the operands of a user in the index, recursively
+  void add_operands(llvm::User*);
+
+  /// \brief Return the identifier of a value, or 0
+  std::uint64_t lookup(llvm::Value*) const;
+
+  /// \brief Return the value with the given identifier, or null
+  llvm::Value* value(std::uint64_t) const;
+
+}; // end class ValueIndex
+
+} // end namespace import
+} // end namespace frontend
+} // end namespace ikos
@@ -61,6 +61,14 @@ llvm::FunctionPass* createLowerSelectPass();
 /// \brief Mark all internal functions with the AlwaysInline attribute
 llvm::ModulePass* createMarkInternalInlinePass();
 
+/// \brief Mark small leaf functions with the AlwaysInline attribute
+///
+/// A function is marked if it has at most `max_size` instructions, no loops,
+/// only calls intrinsics or external functions, and is called from at most
+/// `max_call_sites` call sites.
+llvm::ModulePass* createMarkSmallInlinePass(unsigned max_size,
+                                            unsigned max_call_sites);
+
 /// \brief Mark as unreachable any non side-effect function that does not return
 llvm::ModulePass* createMarkNoReturnFunctionPass();
 
@@ -91,6 +99,9 @@ void initializeLowerSelectPassPass(llvm::PassRegistry&);
 /// \brief Initialize the MarkInternalInlinePass
 void initializeMarkInternalInlinePassPass(llvm::PassRegistry&);
 
+/// \brief Initialize the MarkSmallInlinePass
+void initializeMarkSmallInlinePassPass(llvm::PassRegistry&);
+
 /// \brief Initialize the MarkNoReturnFunctionPass
 void initializeMarkNoReturnFunctionPassPass(llvm::PassRegistry&);
 
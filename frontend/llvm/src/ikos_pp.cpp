@@ -56,7 +56,10 @@
 #include <llvm/Support/CommandLine.h>
 #include <llvm/Support/Debug.h>
 #include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MD5.h>
 #include <llvm/Support/ManagedStatic.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
 #include <llvm/Support/PrettyStackTrace.h>
 #include <llvm/Support/Signals.h>
 #include <llvm/Support/SourceMgr.h>
@@ -91,6 +94,23 @@ static llvm::cl::list< std::string > EntryPoints(
 static llvm::cl::opt< bool > InlineAll("inline-all",
                                        llvm::cl::desc("Inline all functions"));
 
+static llvm::cl::opt< bool > InlineSmall(
+    "inline-small",
+    llvm::cl::desc("Inline small leaf functions without loops that have few "
+                   "call sites"));
+
+static llvm::cl::opt< unsigned > InlineMaxSize(
+    "inline-max-size",
+    llvm::cl::desc("Maximum number of instructions of a function inlined by "
+                   "-inline-small"),
+    llvm::cl::init(30));
+
+static llvm::cl::opt< unsigned > InlineMaxCallSites(
+    "inline-max-call-sites",
+    llvm::cl::desc("Maximum number of call sites of a function inlined by "
+                   "-inline-small"),
+    llvm::cl::init(4));
+
 static llvm::cl::opt< bool > NoVerify(
     "disable-verify", llvm::cl::desc("Do not run the verifier"));
 
@@ -132,6 +152,99 @@ static llvm::cl::opt< OptLevelType > OptLevel(
 static llvm::cl::list< const llvm::PassInfo*, bool, llvm::PassNameParser >
     CustomPassList(llvm::cl::desc("Custom Optimizations available:"));
 
+static llvm::cl::opt< std::string > CacheDirectory(
+    "cache-dir",
+    llvm::cl::desc("Directory of the preprocessed bitcode cache, keyed by a "
+                   "hash of the input and of the options"),
+    llvm::cl::value_desc("directory"));
+
+/// \brief Return the key of the input in the cache
+static std::string make_cache_key(const llvm::MemoryBuffer& input) {
+  llvm::MD5 md5;
+  md5.update(input.getBuffer());
+  md5.update(llvm::StringRef(std::to_string(OptLevel.getValue())));
+  md5.update(llvm::StringRef(std::to_string(InlineMaxSize.getValue())));
+  md5.update(llvm::StringRef(std::to_string(InlineMaxCallSites.getValue())));
+  for (bool flag : {InlineAll.getValue(),
+                    InlineSmall.getValue(),
+                    NoVerify.getValue(),
+                    DiscardValueNames.getValue(),
+                    OutputAssembly.getValue(),
+                    PreserveBitcodeUseListOrder.getValue(),
+                    PreserveAssemblyUseListOrder.getValue()}) {
+    md5.update(flag ? "1" : "0");
+  }
+  for (const auto& entry_point : EntryPoints) {
+    md5.update(";");
+    md5.update(entry_point);
+  }
+  for (const llvm::PassInfo* pass_info : CustomPassList) {
+    md5.update(";");
+    md5.update(pass_info->getPassArgument());
+  }
+
+  llvm::MD5::MD5Result result;
+  md5.final(result);
+  llvm::SmallString< 32 > str;
+  llvm::MD5::stringifyResult(result, str);
+  return str.str().str();
+}
+
+/// \brief Return the path of the cached output for the given key
+static std::string cache_path(const std::string& key) {
+  llvm::SmallString< 128 > path(CacheDirectory.getValue());
+  llvm::sys::path::append(path, key + (OutputAssembly ? ".ll" : ".bc"));
+  return path.str().str();
+}
+
+/// \brief Store the output in the cache
+///
+/// The file is written under a temporary name first, so that concurrent runs
+/// never read a partial file. Errors are not fatal.
+static void save_cache(const std::string& key, llvm::StringRef content) {
+  std::error_code ec = llvm::sys::fs::create_directories(CacheDirectory);
+  if (ec) {
+    return;
+  }
+
+  std::string path = cache_path(key);
+  llvm::SmallString< 128 > tmp_path;
+  int fd;
+  ec = llvm::sys::fs::createUniqueFile(path + ".%%%%%%.tmp", fd, tmp_path);
+  if (ec) {
+    return;
+  }
+  {
+    llvm::raw_fd_ostream out(fd, /*shouldClose = */ true);
+    out << content;
+    if (out.has_error()) {
+      out.clear_error();
+      llvm::sys::fs::remove(tmp_path);
+      return;
+    }
+  }
+  if (llvm::sys::fs::rename(tmp_path, path)) {
+    llvm::sys::fs::remove(tmp_path);
+  }
+}
+
+/// \brief Add the passes inlining small leaf functions
+///
+/// Unlike -inline-all, this only removes the calls that are cheaper to
+/// analyze inlined than through a separate fixpoint, with a bounded growth of
+/// the code size.
+static void add_inline_small_passes(llvm::legacy::PassManager& pass_manager) {
+  // Mark small leaf functions always_inline (ikos-pp -mark-small-inline)
+  pass_manager.add(
+      ikos_pp::createMarkSmallInlinePass(InlineMaxSize, InlineMaxCallSites));
+
+  // Inline always_inline functions (opt -always-inline)
+  pass_manager.add(llvm::createAlwaysInlinerLegacyPass());
+
+  // Kill unused internal functions (opt -globaldce)
+  pass_manager.add(llvm::createGlobalDCEPass());
+}
+
 /// \brief Main for ikos-pp
 int main(int argc, char** argv) {
   llvm::sys::PrintStackTraceOnErrorSignal(argv[0]);
@@ -201,9 +314,43 @@ int main(int argc, char** argv) {
   // If -discard-value-names, discard all the names (except for GlobalValue)
   context.setDiscardValueNames(DiscardValueNames);
 
+  // Read the input file
+  llvm::ErrorOr< std::unique_ptr< llvm::MemoryBuffer > > input =
+      llvm::MemoryBuffer::getFileOrSTDIN(InputFilename);
+  if (std::error_code ec = input.getError()) {
+    llvm::errs() << progname << ": " << InputFilename
+                 << ": error: " << ec.message() << "\n";
+    return 1;
+  }
+
+  // Default to standard output
+  if (OutputFilename.empty()) {
+    OutputFilename = "-";
+  }
+
+  // Look for the preprocessed bitcode in the cache
+  std::string cache_key;
+  if (!CacheDirectory.empty()) {
+    cache_key = make_cache_key(**input);
+
+    llvm::ErrorOr< std::unique_ptr< llvm::MemoryBuffer > > cached =
+        llvm::MemoryBuffer::getFile(cache_path(cache_key));
+    if (cached) {
+      std::error_code ec;
+      llvm::ToolOutputFile output(OutputFilename, ec, llvm::sys::fs::F_None);
+      if (ec) {
+        llvm::errs() << progname << ": " << ec.message() << '\n';
+        return 1;
+      }
+      output.os() << (*cached)->getBuffer();
+      output.keep();
+      return 0;
+    }
+  }
+
   // Load the input module
   std::unique_ptr< llvm::Module > module =
-      llvm::parseIRFile(InputFilename, err, context);
+      llvm::parseIR((*input)->getMemBufferRef(), err, context);
   if (!module) {
     err.print(progname.c_str(), llvm::errs());
     return 1;
@@ -216,11 +363,6 @@ int main(int argc, char** argv) {
     return 1;
   }
 
-  // Default to standard output
-  if (OutputFilename.empty()) {
-    OutputFilename = "-";
-  }
-
   // Output stream
   std::error_code ec;
   std::unique_ptr< llvm::ToolOutputFile > output =
@@ -265,6 +407,10 @@ int main(int argc, char** argv) {
     // note: unfortunately, it removes some debug info about global variables
     pass_manager.add(llvm::createGlobalDCEPass());
 
+    if (InlineSmall) {
+      add_inline_small_passes(pass_manager);
+    }
+
     // Dead code elimination (opt -dce)
     pass_manager.add(llvm::createDeadCodeEliminationPass());
 
@@ -366,6 +512,8 @@ int main(int argc, char** argv) {
 
       // Kill unused internal global (opt -globaldce)
       pass_manager.add(llvm::createGlobalDCEPass());
+    } else if (InlineSmall) {
+      add_inline_small_passes(pass_manager);
     }
 
     // Remove unreachable blocks
@@ -459,18 +607,28 @@ int main(int argc, char** argv) {
   }
 
   // Output pass
+  //
+  // When caching, the output is written in memory first
+  llvm::SmallString< 0 > buffer;
+  llvm::raw_svector_ostream buffer_os(buffer);
+  llvm::raw_ostream& os =
+      cache_key.empty() ? static_cast< llvm::raw_ostream& >(output->os())
+                        : buffer_os;
   if (OutputAssembly) {
-    pass_manager.add(llvm::createPrintModulePass(output->os(),
-                                                 "",
-                                                 PreserveAssemblyUseListOrder));
-  } else {
     pass_manager.add(
-        createBitcodeWriterPass(output->os(), PreserveBitcodeUseListOrder));
+        llvm::createPrintModulePass(os, "", PreserveAssemblyUseListOrder));
+  } else {
+    pass_manager.add(createBitcodeWriterPass(os, PreserveBitcodeUseListOrder));
   }
 
   // Run all the passes
   pass_manager.run(*module);
 
+  if (!cache_key.empty()) {
+    output->os() << buffer.str();
+    save_cache(cache_key, buffer.str());
+  }
+
   output->keep();
 
   return 0;
@@ -61,6 +61,7 @@ namespace import {
 
 ar::GlobalVariable* BundleImporter::translate_global_variable(
     llvm::GlobalVariable* gv) {
+  auto lock = _ctx.lock();
   auto it = this->_globals.find(gv);
 
   if (it != this->_globals.end()) {
@@ -128,6 +129,7 @@ ar::GlobalVariable* BundleImporter::translate_global_variable(
 
 ar::Code* BundleImporter::translate_global_variable_initializer(
     llvm::GlobalVariable* gv) {
+  auto lock = _ctx.lock();
   ar::GlobalVariable* ar_gv = this->translate_global_variable(gv);
   ikos_assert(ar_gv->is_definition());
 
@@ -150,6 +152,7 @@ ar::Code* BundleImporter::translate_global_variable_initializer(
 }
 
 ar::Function* BundleImporter::translate_function(llvm::Function* fun) {
+  auto lock = _ctx.lock();
   auto it = this->_functions.find(fun);
 
   if (it != this->_functions.end()) {
@@ -169,10 +172,10 @@ ar::Function* BundleImporter::translate_function(llvm::Function* fun) {
   if (dbg != nullptr) {
     // Debug information available
     ar_fun = this->translate_function_di(fun, dbg);
-  } else if (fun->isDeclaration()) {
-    // No debug information on external function
+  } else if (!_ctx.has_body(fun)) {
+    // No debug information on external or unreachable function
     ar_fun = this->translate_extern_function(fun);
-  } else if (!fun->isDeclaration() && fun->getName().startswith("__clang_")) {
+  } else if (fun->getName().startswith("__clang_")) {
     // Auto-generated by clang
     ar_fun = this->translate_clang_generated_function(fun);
   } else {
@@ -214,11 +217,11 @@ ar::Function* BundleImporter::translate_function_di(llvm::Function* fun,
   return ar::Function::create(this->_bundle,
                               type,
                               fun->getName().str(),
-                              /*is_definition = */ !fun->isDeclaration());
+                              /*is_definition = */ _ctx.has_body(fun));
 }
 
 ar::Function* BundleImporter::translate_extern_function(llvm::Function* fun) {
-  ikos_assert(fun->isDeclaration());
+  ikos_assert(!_ctx.has_body(fun));
 
   ar::Function* ar_fun = nullptr;
 
@@ -326,7 +329,16 @@ ar::Function* BundleImporter::translate_intrinsic_function(
 }
 
 ar::Function* BundleImporter::translate_library_function(llvm::Function* fun) {
-  ar::Function* ar_fun = _ctx.lib_fun_imp->function(fun->getName());
+  auto lock = _ctx.lock();
+  ar::Function* ar_fun = nullptr;
+  {
+    ScopeImportTimer timer(_ctx.stats.library_functions_time,
+                           _ctx.library_functions_depth);
+    ar_fun = _ctx.lib_fun_imp->function(fun->getName());
+  }
+  if (ar_fun != nullptr) {
+    _ctx.stats.library_functions++;
+  }
 
   // sanity check
   if (ar_fun != nullptr &&
@@ -352,7 +364,7 @@ ar::Function* BundleImporter::translate_clang_generated_function(
   return ar::Function::create(this->_bundle,
                               ar_type,
                               fun->getName().str(),
-                              /*is_definition = */ !fun->isDeclaration());
+                              /*is_definition = */ _ctx.has_body(fun));
 }
 
 ar::Code* BundleImporter::translate_function_body(llvm::Function* fun) {
@@ -83,6 +83,7 @@ static ar::MachineInt to_machine_int(const llvm::APInt& n,
 ar::Value* ConstantImporter::translate_constant(llvm::Constant* cst,
                                                 ar::Type* type,
                                                 ar::BasicBlock* bb) {
+  auto lock = _ctx.lock();
   // List of constant expressions to handle
   llvm::SmallVector< ConstantExpression, 4 > exprs;
 
@@ -118,12 +119,17 @@ ar::Value* ConstantImporter::translate_constant(llvm::Constant* cst,
                                                 ar::Type* type,
                                                 ar::BasicBlock* bb,
                                                 ConstantExpressionList& exprs) {
+  auto lock = _ctx.lock();
   auto it = this->_constants.find({cst, type});
 
   if (it != this->_constants.end()) {
+    _ctx.stats.constant_cache_hits++;
     return it->second;
   }
 
+  ScopeImportTimer timer(_ctx.stats.constants_time, _ctx.constants_depth);
+  _ctx.stats.constants++;
+
   ar::Value* ar_cst = nullptr;
   ar::Type* orig_type = type;
 
@@ -560,6 +566,7 @@ std::unique_ptr< ar::UnaryOperation > ConstantImporter::translate_ptrtoint(
 
 ar::Value* ConstantImporter::translate_cast_integer_constant(
     llvm::Constant* cst, ar::IntegerType* type) {
+  auto lock = _ctx.lock();
   ikos_assert(type != nullptr);
 
   auto it = this->_constants.find({cst, type});
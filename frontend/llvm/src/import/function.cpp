@@ -477,7 +477,12 @@ void FunctionImporter::translate_intrinsic_call(
 
   if (_ctx.bundle_imp->ignore_intrinsic(call->getIntrinsicID())) {
     return; // ignored intrinsic (llvm.dbg.value, etc.)
-  } else if (auto memcpy = llvm::dyn_cast< llvm::MemCpyInst >(call)) {
+  }
+
+  // Intrinsic statements can create functions in the bundle
+  auto lock = _ctx.lock();
+
+  if (auto memcpy = llvm::dyn_cast< llvm::MemCpyInst >(call)) {
     ar::Value* dest = this->translate_value(bb_translation,
                                             memcpy->getRawDest(),
                                             void_ptr_ty);
@@ -43,6 +43,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <mutex>
+
+#include <llvm/ADT/DenseSet.h>
 #include <llvm/IR/DataLayout.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
@@ -104,6 +108,24 @@ public:
   /// \brief Helper class to translate global values and functions
   BundleImporter* bundle_imp;
 
+  /// \brief Functions whose body is translated, or null for all of them
+  const llvm::DenseSet< llvm::Function* >* reachable;
+
+  /// \brief True if function bodies are translated by several threads
+  bool parallel;
+
+  /// \brief Mutex protecting the helpers and the bundle in parallel mode
+  std::recursive_mutex mutex;
+
+  /// \brief Statistics of the import, protected by the mutex
+  ImportStatistics stats;
+
+  /// \brief Nesting depth of the timed scopes, see ScopeImportTimer
+  unsigned types_depth = 0;
+  unsigned match_di_types_depth = 0;
+  unsigned constants_depth = 0;
+  unsigned library_functions_depth = 0;
+
 public:
   /// \brief Create an ImportContext
   ImportContext(llvm::Module& module_, ar::Bundle* bundle_, ImportOptions opts_)
@@ -117,7 +139,9 @@ public:
         type_imp(nullptr),
         lib_fun_imp(nullptr),
         constant_imp(nullptr),
-        bundle_imp(nullptr) {}
+        bundle_imp(nullptr),
+        reachable(nullptr),
+        parallel(false) {}
 
   void set_type_importer(TypeImporter& type_imp_) {
     this->type_imp = &type_imp_;
@@ -135,8 +159,68 @@ public:
     this->bundle_imp = &bundle_imp_;
   }
 
+  /// \brief Return true if the body of the given function is translated
+  bool has_body(llvm::Function* fun) const {
+    return !fun->isDeclaration() &&
+           (this->reachable == nullptr || this->reachable->count(fun) > 0);
+  }
+
+  /// \brief Lock the shared state, if function bodies are translated in
+  /// parallel
+  std::unique_lock< std::recursive_mutex > lock() {
+    if (this->parallel) {
+      return std::unique_lock< std::recursive_mutex >(this->mutex);
+    } else {
+      return std::unique_lock< std::recursive_mutex >();
+    }
+  }
+
 }; // end struct ImportContext
 
+/// \brief Add the time spent in a scope to an import statistic
+///
+/// Nested scopes on the same statistic are only counted once. It must be
+/// created while holding the import context lock.
+class ScopeImportTimer {
+private:
+  using Clock = std::chrono::steady_clock;
+
+private:
+  double& _total;
+  unsigned& _depth;
+  Clock::time_point _start;
+
+public:
+  /// \brief Start the timer, unless a scope on `total` is already running
+  ScopeImportTimer(double& total, unsigned& depth)
+      : _total(total), _depth(depth) {
+    if (this->_depth++ == 0) {
+      this->_start = Clock::now();
+    }
+  }
+
+  /// \brief Deleted copy constructor
+  ScopeImportTimer(const ScopeImportTimer&) = delete;
+
+  /// \brief Deleted move constructor
+  ScopeImportTimer(ScopeImportTimer&&) = delete;
+
+  /// \brief Deleted copy assignment operator
+  ScopeImportTimer& operator=(const ScopeImportTimer&) = delete;
+
+  /// \brief Deleted move assignment operator
+  ScopeImportTimer& operator=(ScopeImportTimer&&) = delete;
+
+  /// \brief Add the elapsed time to `total`
+  ~ScopeImportTimer() {
+    if (--this->_depth == 0) {
+      this->_total +=
+          std::chrono::duration< double >(Clock::now() - this->_start).count();
+    }
+  }
+
+}; // end class ScopeImportTimer
+
 } // end namespace import
 } // end namespace frontend
 } // end namespace ikos
@@ -43,9 +43,23 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <llvm/ADT/DenseSet.h>
 #include <llvm/IR/Function.h>
+#include <llvm/IR/GlobalAlias.h>
 #include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/InstIterator.h>
 #include <llvm/IR/Module.h>
+#include <llvm/Support/Error.h>
 
 #include <ikos/core/support/assert.hpp>
 
@@ -70,6 +84,180 @@ bool has_debug_info(llvm::Module& m) {
   return m.debug_compile_units_begin() != m.debug_compile_units_end();
 }
 
+// Reachable functions
+
+namespace {
+
+/// \brief Read the body of a function of a lazily loaded module
+void materialize(llvm::Function* fun) {
+  if (llvm::Error err = fun->materialize()) {
+    throw ImportError("could not read the body of llvm function @" +
+                      fun->getName().str() + ": " +
+                      llvm::toString(std::move(err)));
+  }
+}
+
+/// \brief Compute the functions reachable from a set of entry points
+///
+/// The function pointers are over-approximated by the functions whose address
+/// is taken in a reachable function or in a global variable initializer.
+///
+/// In a lazily loaded module, the bodies of the reachable functions are read.
+class ReachableFunctions {
+private:
+  // Reachable functions
+  FunctionSet _reachable;
+
+  // Functions to visit
+  std::vector< llvm::Function* > _worklist;
+
+  // Visited constants
+  llvm::DenseSet< llvm::Constant* > _constants;
+
+public:
+  /// \brief Compute the reachable functions
+  ReachableFunctions(llvm::Module& module,
+                     const std::vector< std::string >& entry_points) {
+    for (const std::string& name : entry_points) {
+      if (llvm::Function* fun = module.getFunction(name)) {
+        this->add(fun);
+      }
+    }
+
+    for (auto it = module.global_begin(), et = module.global_end(); it != et;
+         ++it) {
+      llvm::GlobalVariable& gv = *it;
+      if (gv.hasInitializer()) {
+        this->visit(gv.getInitializer());
+      }
+    }
+
+    while (!this->_worklist.empty()) {
+      llvm::Function* fun = this->_worklist.back();
+      this->_worklist.pop_back();
+
+      materialize(fun);
+      if (fun->hasPersonalityFn()) {
+        this->visit(fun->getPersonalityFn());
+      }
+      for (auto it = llvm::inst_begin(fun), et = llvm::inst_end(fun); it != et;
+           ++it) {
+        for (llvm::Value* operand : it->operands()) {
+          this->visit(operand);
+        }
+      }
+    }
+  }
+
+  /// \brief Move out the reachable functions
+  FunctionSet take_functions() { return std::move(this->_reachable); }
+
+private:
+  /// \brief Mark a function as reachable
+  void add(llvm::Function* fun) {
+    if (this->_reachable.insert(fun).second && !fun->isDeclaration()) {
+      this->_worklist.push_back(fun);
+    }
+  }
+
+  /// \brief Mark the functions referenced by an operand as reachable
+  void visit(llvm::Value* value) {
+    if (auto fun = llvm::dyn_cast< llvm::Function >(value)) {
+      this->add(fun);
+    } else if (auto alias = llvm::dyn_cast< llvm::GlobalAlias >(value)) {
+      this->visit(alias->getAliasee());
+    } else if (llvm::isa< llvm::GlobalValue >(value)) {
+      // Global variable initializers are visited at the beginning
+      return;
+    } else if (auto cst = llvm::dyn_cast< llvm::Constant >(value)) {
+      if (this->_constants.insert(cst).second) {
+        for (llvm::Value* operand : cst->operands()) {
+          this->visit(operand);
+        }
+      }
+    }
+  }
+
+}; // end class ReachableFunctions
+
+/// \brief Translate the given function bodies, on `jobs` threads
+void translate_function_bodies(ImportContext& ctx,
+                               BundleImporter& bundle_imp,
+                               const std::vector< llvm::Function* >& functions,
+                               unsigned jobs_) {
+  auto jobs = static_cast< std::size_t >(jobs_);
+  jobs = std::min(jobs, functions.size());
+
+  if (jobs <= 1) {
+    for (llvm::Function* fun : functions) {
+      bundle_imp.translate_function_body(fun);
+    }
+    return;
+  }
+
+  // Function bodies are translated concurrently. The helpers and the bundle
+  // are shared, they are protected by the import context mutex.
+  ctx.parallel = true;
+
+  std::atomic< std::size_t > next(0);
+  std::exception_ptr error = nullptr;
+  std::mutex error_mutex;
+
+  auto worker = [&]() {
+    while (true) {
+      std::size_t i = next++;
+      if (i >= functions.size()) {
+        return;
+      }
+      {
+        std::lock_guard< std::mutex > lock(error_mutex);
+        if (error) {
+          return;
+        }
+      }
+      try {
+        bundle_imp.translate_function_body(functions[i]);
+      } catch (...) {
+        std::lock_guard< std::mutex > lock(error_mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        return;
+      }
+    }
+  };
+
+  std::vector< std::thread > threads;
+  threads.reserve(jobs);
+  for (std::size_t i = 0; i < jobs; i++) {
+    threads.emplace_back(worker);
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  ctx.parallel = false;
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+} // end anonymous namespace
+
+void materialize_functions(llvm::Module& module) {
+  if (llvm::Error err = module.materializeAll()) {
+    throw ImportError("could not read llvm module: " +
+                      llvm::toString(std::move(err)));
+  }
+}
+
+FunctionSet reachable_functions(
+    llvm::Module& module, const std::vector< std::string >& entry_points) {
+  ReachableFunctions reachable(module, entry_points);
+  return reachable.take_functions();
+}
+
 // Importer
 
 ar::Bundle* Importer::import(llvm::Module& module, ImportOptions opts) {
@@ -88,6 +276,13 @@ ar::Bundle* Importer::import(llvm::Module& module, ImportOptions opts) {
   // Create an ImportContext and Helper objects
   ImportContext ctx(module, bundle, opts);
 
+  // Only translate the bodies of the reachable functions, if requested
+  if (this->_only_reachable) {
+    ctx.reachable = &this->_reachable;
+  } else {
+    materialize_functions(module);
+  }
+
   TypeImporter type_imp(ctx);
   ctx.set_type_importer(type_imp);
 
@@ -100,7 +295,13 @@ ar::Bundle* Importer::import(llvm::Module& module, ImportOptions opts) {
   BundleImporter bundle_imp(ctx);
   ctx.set_bundle_importer(bundle_imp);
 
+  using Clock = std::chrono::steady_clock;
+  auto elapsed = [](Clock::time_point start) {
+    return std::chrono::duration< double >(Clock::now() - start).count();
+  };
+
   // Create all the global variables (names and types only)
+  Clock::time_point start = Clock::now();
   for (auto it = module.global_begin(), et = module.global_end(); it != et;
        ++it) {
     llvm::GlobalVariable& gv = *it;
@@ -111,8 +312,10 @@ ar::Bundle* Importer::import(llvm::Module& module, ImportOptions opts) {
   for (llvm::Function& fun : module) {
     bundle_imp.translate_function(&fun);
   }
+  ctx.stats.declarations_time = elapsed(start);
 
   // Translate all global variable initializers
+  start = Clock::now();
   for (auto it = module.global_begin(), et = module.global_end(); it != et;
        ++it) {
     llvm::GlobalVariable& gv = *it;
@@ -120,14 +323,28 @@ ar::Bundle* Importer::import(llvm::Module& module, ImportOptions opts) {
       bundle_imp.translate_global_variable_initializer(&gv);
     }
   }
+  ctx.stats.initializers_time = elapsed(start);
 
   // Translate all function bodies
+  std::vector< llvm::Function* > functions;
   for (llvm::Function& fun : module) {
-    if (!fun.isDeclaration()) {
-      bundle_imp.translate_function_body(&fun);
+    if (ctx.has_body(&fun)) {
+      functions.push_back(&fun);
+    }
+  }
+
+  start = Clock::now();
+  translate_function_bodies(ctx, bundle_imp, functions, this->_jobs);
+  ctx.stats.bodies_time = elapsed(start);
+
+  for (llvm::Function* fun : functions) {
+    ar::Function* ar_fun = bundle_imp.translate_function(fun);
+    for (ar::BasicBlock* bb : *ar_fun->body()) {
+      ctx.stats.statements += bb->num_statements();
     }
   }
 
+  this->_statistics = ctx.stats;
   return bundle;
 }
 
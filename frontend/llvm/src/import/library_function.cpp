@@ -50,6 +50,7 @@ namespace frontend {
 namespace import {
 
 ar::Function* LibraryFunctionImporter::function(llvm::StringRef name) {
+  auto lock = _ctx.lock();
   // ikos functions
   if (this->_enable_ikos) {
     if (name == "__ikos_assert") {
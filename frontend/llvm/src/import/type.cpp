@@ -43,6 +43,8 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
+
 #include <ikos/core/support/assert.hpp>
 
 #include <ikos/ar/support/cast.hpp>
@@ -85,7 +87,8 @@ namespace import {
 namespace dwarf = llvm::dwarf;
 
 TypeImporter::TypeImporter(ImportContext& ctx)
-    : _context(ctx.ar_context),
+    : _ctx(ctx),
+      _context(ctx.ar_context),
       _llvm_data_layout(ctx.llvm_data_layout),
       _ar_data_layout(ctx.ar_data_layout),
       _translation_depth(0) {
@@ -111,12 +114,17 @@ TypeImporter::TypeImporter(ImportContext& ctx)
 
 ar::Type* TypeImporter::translate_di_type(llvm::DIType* di_type,
                                           llvm::Type* llvm_type) {
+  auto lock = _ctx.lock();
   auto it = this->_di_types.find({di_type, llvm_type});
 
   if (it != this->_di_types.end()) {
+    _ctx.stats.type_cache_hits++;
     return it->second;
   }
 
+  ScopeImportTimer timer(_ctx.stats.types_time, _ctx.types_depth);
+  _ctx.stats.types++;
+
   if (di_type == nullptr) {
     return this->translate_null_di_type(llvm_type);
   } else if (di_type->isForwardDecl()) {
@@ -1125,6 +1133,7 @@ ar::Type* TypeImporter::translate_subroutine_di_type(
 
 ar::FunctionType* TypeImporter::translate_function_di_type(
     llvm::DISubroutineType* di_type, llvm::Function* fun) {
+  auto lock = _ctx.lock();
   check_import(di_type != nullptr,
                "unexpected null pointer for llvm::DISubroutineType of "
                "llvm::Function");
@@ -1134,6 +1143,9 @@ ar::FunctionType* TypeImporter::translate_function_di_type(
 }
 
 bool TypeImporter::match_di_type(llvm::DIType* di_type, llvm::Type* type) {
+  auto lock = _ctx.lock();
+  ScopeImportTimer timer(_ctx.stats.match_di_types_time,
+                         _ctx.match_di_types_depth);
   SeenDITypes seen;
   return this->match_di_type(di_type, type, seen);
 }
@@ -1147,18 +1159,41 @@ bool TypeImporter::match_di_type(llvm::DIType* di_type,
     return true;
   } else if (auto basic_type = llvm::dyn_cast< llvm::DIBasicType >(di_type)) {
     return this->match_basic_di_type(basic_type, type);
-  } else if (auto derived_type =
-                 llvm::dyn_cast< llvm::DIDerivedType >(di_type)) {
-    return this->match_derived_di_type(derived_type, type, seen);
+  }
+
+  auto key = std::make_pair(di_type, type);
+  auto memo = this->_di_type_matches.find(key);
+  if (memo != this->_di_type_matches.end()) {
+    return memo->second;
+  }
+
+  unsigned lowest_assumption = seen.lowest_assumption;
+  seen.lowest_assumption = std::numeric_limits< unsigned >::max();
+  seen.depth++;
+
+  bool result;
+  if (auto derived_type = llvm::dyn_cast< llvm::DIDerivedType >(di_type)) {
+    result = this->match_derived_di_type(derived_type, type, seen);
   } else if (auto composite_type =
                  llvm::dyn_cast< llvm::DICompositeType >(di_type)) {
-    return this->match_composite_di_type(composite_type, type, seen);
+    result = this->match_composite_di_type(composite_type, type, seen);
   } else if (auto subroutine_type =
                  llvm::dyn_cast< llvm::DISubroutineType >(di_type)) {
-    return this->match_subroutine_di_type(subroutine_type, type, seen);
+    result = this->match_subroutine_di_type(subroutine_type, type, seen);
   } else {
     throw ImportError("unexpected llvm::DIType");
   }
+
+  seen.depth--;
+
+  // A match only holds on its own if it does not rely on the assumption that
+  // a structure being matched by a caller matches. A mismatch always holds.
+  if (!result || seen.lowest_assumption > seen.depth) {
+    this->_di_type_matches.try_emplace(key, result);
+  }
+  seen.lowest_assumption = std::min(lowest_assumption, seen.lowest_assumption);
+
+  return result;
 }
 
 bool TypeImporter::match_null_di_type(llvm::Type* type) {
@@ -1369,9 +1404,11 @@ bool TypeImporter::match_struct_di_type(llvm::DICompositeType* di_type,
   }
 
   // Avoid infinite recursion
-  auto p = seen.insert({di_type, type});
+  auto p = seen.pairs.try_emplace({di_type, type}, seen.depth);
   if (!p.second) {
-    return true; // already processing
+    // already processing
+    seen.lowest_assumption = std::min(seen.lowest_assumption, p.first->second);
+    return true;
   }
 
   // Collect debug info members
@@ -1753,12 +1790,17 @@ bool TypeImporter::match_subroutine_di_type(llvm::DISubroutineType* di_type,
 
 ar::Type* TypeImporter::translate_type(llvm::Type* type,
                                        ar::Signedness preferred) {
+  auto lock = _ctx.lock();
   auto it = this->_types.find({type, preferred});
 
   if (it != this->_types.end()) {
+    _ctx.stats.type_cache_hits++;
     return it->second;
   }
 
+  ScopeImportTimer timer(_ctx.stats.types_time, _ctx.types_depth);
+  _ctx.stats.types++;
+
   if (type->isVoidTy()) {
     return this->translate_void_type(type, preferred);
   } else if (type->isIntegerTy()) {
@@ -1919,6 +1961,7 @@ ar::FunctionType* TypeImporter::translate_function_type(
 }
 
 bool TypeImporter::match_ar_type(llvm::Type* llvm_type, ar::Type* ar_type) {
+  auto lock = _ctx.lock();
   SeenARTypes seen;
   return this->match_ar_type(llvm_type, ar_type, seen);
 }
@@ -2093,6 +2136,7 @@ bool TypeImporter::match_function_ar_type(llvm::Type* llvm_type,
 
 bool TypeImporter::match_extern_function_type(llvm::FunctionType* llvm_type,
                                               ar::FunctionType* ar_type) {
+  auto lock = _ctx.lock();
   if (llvm_type->isVarArg() != ar_type->is_var_arg() ||
       llvm_type->getNumParams() != ar_type->num_parameters()) {
     return false;
@@ -2130,6 +2174,7 @@ bool TypeImporter::match_extern_function_param_type(llvm::Type* llvm_type,
 }
 
 void TypeImporter::sanity_check_size(llvm::Type* llvm_type, ar::Type* ar_type) {
+  auto lock = _ctx.lock();
   if (this->_translation_depth > 0) {
     // Disable checks, some types are not complete yet.
     return;
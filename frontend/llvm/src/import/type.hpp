@@ -45,6 +45,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include <boost/container/flat_set.hpp>
 
 #include <llvm/ADT/DenseMap.h>
@@ -93,6 +95,9 @@ namespace import {
 /// \brief Helper class to translate types
 class TypeImporter {
 private:
+  // Import context
+  ImportContext& _ctx;
+
   // AR context
   ar::Context& _context;
 
@@ -109,6 +114,10 @@ private:
   // Map from llvm type + signedness to AR type
   llvm::DenseMap< std::pair< llvm::Type*, ar::Signedness >, ar::Type* > _types;
 
+  // Map from debug info + llvm type to the result of match_di_type()
+  llvm::DenseMap< std::pair< llvm::DIType*, llvm::Type* >, bool >
+      _di_type_matches;
+
   // Input source languages
   llvm::SmallSet< llvm::dwarf::SourceLanguage, 2 > _languages;
 
@@ -190,8 +199,19 @@ public:
   bool match_di_type(llvm::DIType*, llvm::Type*);
 
 private:
-  using SeenDITypes =
-      boost::container::flat_set< std::pair< llvm::DIType*, llvm::Type* > >;
+  /// \brief State of a match_di_type() query
+  struct SeenDITypes {
+    /// \brief Structures being matched, with their recursion depth
+    ///
+    /// They are assumed to match when they are encountered again.
+    llvm::DenseMap< std::pair< llvm::DIType*, llvm::Type* >, unsigned > pairs;
+
+    /// \brief Current recursion depth
+    unsigned depth = 0;
+
+    /// \brief Lowest depth of a structure that was assumed to match
+    unsigned lowest_assumption = std::numeric_limits< unsigned >::max();
+  };
 
   /// \brief Check whether a llvm::DIType matches a llvm::Type
   bool match_di_type(llvm::DIType*, llvm::Type*, SeenDITypes&);
@@ -0,0 +1,188 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of the index of LLVM values
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/Instruction.h>
+
+#include <ikos/frontend/llvm/import/value_index.hpp>
+
+namespace ikos {
+namespace frontend {
+namespace import {
+
+ValueIndex::ValueIndex(llvm::Module& module) {
+  // Globals first, since they can be used anywhere
+  for (llvm::GlobalVariable& gv : module.globals()) {
+    this->add(&gv);
+  }
+  for (llvm::Function& fun : module) {
+    this->add(&fun);
+  }
+  for (llvm::GlobalAlias& alias : module.aliases()) {
+    this->add(&alias);
+  }
+
+  // Global variable initializers
+  for (llvm::GlobalVariable& gv : module.globals()) {
+    this->add_operands(&gv);
+  }
+  for (llvm::GlobalAlias& alias : module.aliases()) {
+    this->add_operands(&alias);
+  }
+
+  // Function bodies
+  for (llvm::Function& fun : module) {
+    for (llvm::Argument& arg : fun.args()) {
+      this->add(&arg);
+    }
+    for (llvm::BasicBlock& bb : fun) {
+      this->add(&bb);
+      for (llvm::Instruction& inst : bb) {
+        this->add(&inst);
+      }
+    }
+
+    // Operands are visited once all the instructions have an identifier
+    for (llvm::BasicBlock& bb : fun) {
+      for (llvm::Instruction& inst : bb) {
+        this->add_operands(&inst);
+      }
+    }
+  }
+}
+
+ValueIndex::~ValueIndex() = default;
+
+void ValueIndex::add(llvm::Value* value) {
+  if (this->_ids.count(value) == 0) {
+    this->_values.push_back(value);
+    this->_ids.try_emplace(value, this->_values.size());
+  }
+}
+
+void ValueIndex::add_operands(llvm::User* user) {
+  for (llvm::Value* operand : user->operand_values()) {
+    if (operand == nullptr || this->_ids.count(operand) != 0) {
+      continue;
+    }
+    this->add(operand);
+    if (auto cst = llvm::dyn_cast< llvm::Constant >(operand)) {
+      this->add_operands(cst);
+    }
+  }
+}
+
+std::uint64_t ValueIndex::lookup(llvm::Value* value) const {
+  if (value == nullptr) {
+    return 0;
+  }
+  auto it = this->_ids.find(value);
+  return it != this->_ids.end() ? it->second : 0;
+}
+
+llvm::Value* ValueIndex::value(std::uint64_t id) const {
+  if (id == 0 || id > this->_values.size()) {
+    return nullptr;
+  }
+  return this->_values[id - 1];
+}
+
+std::uint64_t ValueIndex::id(ar::GlobalVariable* gv) {
+  return this->lookup(gv->frontend_or_null< llvm::GlobalVariable >());
+}
+
+std::uint64_t ValueIndex::id(ar::Function* fun) {
+  return this->lookup(fun->frontend_or_null< llvm::Function >());
+}
+
+std::uint64_t ValueIndex::id(ar::Variable* var) {
+  return this->lookup(var->frontend_or_null< llvm::Value >());
+}
+
+std::uint64_t ValueIndex::id(ar::BasicBlock* bb) {
+  return this->lookup(bb->frontend_or_null< llvm::BasicBlock >());
+}
+
+std::uint64_t ValueIndex::id(ar::Statement* stmt) {
+  return this->lookup(stmt->frontend_or_null< llvm::Value >());
+}
+
+void ValueIndex::resolve(ar::GlobalVariable* gv, std::uint64_t id) {
+  if (auto value = llvm::dyn_cast_or_null< llvm::GlobalVariable >(
+          this->value(id))) {
+    gv->set_frontend(value);
+  }
+}
+
+void ValueIndex::resolve(ar::Function* fun, std::uint64_t id) {
+  if (auto value = llvm::dyn_cast_or_null< llvm::Function >(this->value(id))) {
+    fun->set_frontend(value);
+  }
+}
+
+void ValueIndex::resolve(ar::Variable* var, std::uint64_t id) {
+  if (llvm::Value* value = this->value(id)) {
+    var->set_frontend(value);
+  }
+}
+
+void ValueIndex::resolve(ar::BasicBlock* bb, std::uint64_t id) {
+  if (auto value = llvm::dyn_cast_or_null< llvm::BasicBlock >(
+          this->value(id))) {
+    bb->set_frontend(value);
+  }
+}
+
+void ValueIndex::resolve(ar::Statement* stmt, std::uint64_t id) {
+  if (llvm::Value* value = this->value(id)) {
+    stmt->set_frontend(value);
+  }
+}
+
+} // end namespace import
+} // end namespace frontend
+} // end namespace ikos
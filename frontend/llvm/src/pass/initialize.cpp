@@ -47,6 +47,7 @@ void ikos::frontend::pass::initializeIkosPasses(llvm::PassRegistry& PR) {
   llvm::initializeLowerCstExprPassPass(PR);
   llvm::initializeLowerSelectPassPass(PR);
   llvm::initializeMarkInternalInlinePassPass(PR);
+  llvm::initializeMarkSmallInlinePassPass(PR);
   llvm::initializeMarkNoReturnFunctionPassPass(PR);
   llvm::initializeNameValuesPassPass(PR);
   llvm::initializeRemovePrintfCallsPassPass(PR);
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ *
+ * \file
+ * \brief Implementation of the MarkSmallInlinePass
+ *
+ * Author: IKOS contributors
+ *
+ * Contact: ikos@lists.nasa.gov
+ *
+ * Notices:
+ *
+ * Copyright (c) 2026 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Disclaimers:
+ *
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+ * ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+ * TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS,
+ * ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE
+ * ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+ * THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+ * ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+ * RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+ * RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+ * DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+ * IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+ *
+ * Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL
+ * AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS
+ * IN ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH
+ * USE, INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM,
+ * RECIPIENT'S USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD
+ * HARMLESS THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS,
+ * AS WELL AS ANY PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.
+ * RECIPIENT'S SOLE REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE,
+ * UNILATERAL TERMINATION OF THIS AGREEMENT.
+ *
+ ******************************************************************************/
+
+#include <llvm/ADT/Statistic.h>
+#include <llvm/Analysis/CFG.h>
+#include <llvm/IR/CallSite.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/IntrinsicInst.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Pass.h>
+
+#include <ikos/frontend/llvm/pass.hpp>
+
+#define DEBUG_TYPE "mark-small-inline"
+
+using namespace llvm;
+
+STATISTIC(NumMarked, "Number of small leaf functions marked always_inline");
+
+namespace {
+
+/// \brief Default maximum number of instructions of an inlined function
+constexpr unsigned DefaultMaxSize = 30;
+
+/// \brief Default maximum number of call sites of an inlined function
+constexpr unsigned DefaultMaxCallSites = 4;
+
+struct MarkSmallInlinePass final : public ModulePass {
+  static char ID; // Pass identification
+
+  /// \brief Maximum number of instructions, debug intrinsics excluded
+  unsigned MaxSize;
+
+  /// \brief Maximum number of call sites
+  unsigned MaxCallSites;
+
+  explicit MarkSmallInlinePass(unsigned max_size = DefaultMaxSize,
+                               unsigned max_call_sites = DefaultMaxCallSites)
+      : ModulePass(ID), MaxSize(max_size), MaxCallSites(max_call_sites) {}
+
+  void getAnalysisUsage(AnalysisUsage& AU) const override {
+    AU.setPreservesAll();
+  }
+
+  bool runOnModule(Module& M) override {
+    bool change = false;
+    for (Function& F : M) {
+      if (is_small_leaf(F) && has_few_call_sites(F)) {
+        F.addFnAttr(Attribute::AlwaysInline);
+        change = true;
+        ++NumMarked;
+      }
+    }
+    return change;
+  }
+
+  /// \brief Return true if the function is small, without loops, and only
+  /// calls intrinsics or external functions
+  bool is_small_leaf(const Function& F) const {
+    if (F.isDeclaration() || F.isVarArg() ||
+        F.hasFnAttribute(Attribute::NoInline) ||
+        F.hasFnAttribute(Attribute::AlwaysInline)) {
+      return false;
+    }
+
+    unsigned size = 0;
+    for (const Instruction& I : instructions(F)) {
+      if (isa< DbgInfoIntrinsic >(I)) {
+        continue;
+      }
+      if (++size > MaxSize) {
+        return false;
+      }
+      ImmutableCallSite CS(&I);
+      if (CS) {
+        const Function* callee = CS.getCalledFunction();
+        if (callee == nullptr || !callee->isDeclaration()) {
+          return false;
+        }
+      }
+    }
+
+    SmallVector< std::pair< const BasicBlock*, const BasicBlock* >, 1 >
+        back_edges;
+    FindFunctionBackedges(F, back_edges);
+    return back_edges.empty();
+  }
+
+  /// \brief Return true if the function is called at least once, and at most
+  /// MaxCallSites times
+  bool has_few_call_sites(const Function& F) const {
+    unsigned num_call_sites = 0;
+    for (const Use& U : F.uses()) {
+      ImmutableCallSite CS(U.getUser());
+      if (CS && CS.isCallee(&U)) {
+        if (++num_call_sites > MaxCallSites) {
+          return false;
+        }
+      }
+    }
+    return num_call_sites > 0;
+  }
+
+}; // end struct MarkSmallInlinePass
+
+} // end anonymous namespace
+
+char MarkSmallInlinePass::ID = 0;
+
+INITIALIZE_PASS(MarkSmallInlinePass,
+                "mark-small-inline",
+                "Mark small leaf functions without loops for inlining",
+                false,
+                false);
+
+ModulePass* ikos::frontend::pass::createMarkSmallInlinePass(
+    unsigned max_size, unsigned max_call_sites) {
+  return new MarkSmallInlinePass(max_size, max_call_sites);
+}